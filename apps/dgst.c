@@ -67,6 +67,20 @@
 #include <openssl/x509.h>
 #include <openssl/pem.h>
 #include <openssl/hmac.h>
+#ifndef OPENSSL_NO_SM3
+# include <openssl/sm3.h>
+#endif
+
+#if defined(OPENSSL_SYS_UNIX) && !defined(OPENSSL_NO_POSIX_IO)
+# define DGST_MMAP
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+/* size of the file window mapped at a time, a multiple of any page size */
+# define MMAP_WINDOW    ((size_t)1 << 30)
+#endif
 
 #undef BUFSIZE
 #define BUFSIZE 1024*8
@@ -79,6 +93,11 @@ int do_fp(BIO *out, unsigned char *buf, BIO *bp, int sep, int binout,
           const char *sig_name, const char *md_name,
           const char *file, BIO *bmd);
 
+#ifdef DGST_MMAP
+static int do_mmap(BIO *bmd, const char *file);
+#endif
+static int set_tree_params(BIO *bmd, size_t leaf_size, int nthreads);
+
 static void list_md_fn(const EVP_MD *m,
                        const char *from, const char *to, void *arg)
 {
@@ -129,6 +148,11 @@ int MAIN(int argc, char **argv)
     char *hmac_key = NULL;
     char *mac_name = NULL;
     int non_fips_allow = 0;
+    int use_mmap = 0;
+#ifndef OPENSSL_NO_SM3
+    size_t tree_leaf_size = 0;
+    int tree_threads = 0;
+#endif
     STACK_OF(OPENSSL_STRING) *sigopts = NULL, *macopts = NULL;
 
     apps_startup();
@@ -158,6 +182,27 @@ int MAIN(int argc, char **argv)
             separator = 1;
         else if (strcmp(*argv, "-r") == 0)
             separator = 2;
+        else if (strcmp(*argv, "-mmap") == 0)
+            use_mmap = 1;
+#ifndef OPENSSL_NO_SM3
+        else if (strcmp(*argv, "-leafsize") == 0) {
+            if (--argc < 1)
+                break;
+            tree_leaf_size = (size_t)atol(*(++argv));
+            if (tree_leaf_size == 0) {
+                BIO_printf(bio_err, "invalid leaf size %s\n", *argv);
+                goto end;
+            }
+        } else if (strcmp(*argv, "-threads") == 0) {
+            if (--argc < 1)
+                break;
+            tree_threads = atoi(*(++argv));
+            if (tree_threads <= 0) {
+                BIO_printf(bio_err, "invalid number of threads %s\n", *argv);
+                goto end;
+            }
+        }
+#endif
         else if (strcmp(*argv, "-rand") == 0) {
             if (--argc < 1)
                 break;
@@ -261,6 +306,10 @@ int MAIN(int argc, char **argv)
         BIO_printf(bio_err, "-binary         output in binary form\n");
         BIO_printf(bio_err, "-hmac arg       set the HMAC key to arg\n");
         BIO_printf(bio_err, "-non-fips-allow allow use of non FIPS digest\n");
+#ifdef DGST_MMAP
+        BIO_printf(bio_err,
+                   "-mmap           read input files through a memory mapping\n");
+#endif
         BIO_printf(bio_err,
                    "-sign   file    sign digest using private key in file\n");
         BIO_printf(bio_err,
@@ -283,6 +332,13 @@ int MAIN(int argc, char **argv)
                    "-engine e       use engine e, possibly a hardware device.\n");
 #endif
 
+#ifndef OPENSSL_NO_SM3
+        BIO_printf(bio_err,
+                   "-leafsize n     leaf size in bytes of the sm3-tree digest\n");
+        BIO_printf(bio_err,
+                   "-threads n      number of threads of the sm3-tree digest\n");
+#endif
+
         EVP_MD_do_all_sorted(list_md_fn, bio_err);
         goto end;
     }
@@ -453,6 +509,12 @@ int MAIN(int argc, char **argv)
         }
     }
 
+    if (!set_tree_params(bmd, tree_leaf_size, tree_threads)) {
+        BIO_printf(bio_err, "Error setting sm3-tree parameters\n");
+        ERR_print_errors(bio_err);
+        goto end;
+    }
+
     if (sigfile && sigkey) {
         BIO *sigbio;
         sigbio = BIO_new_file(sigfile, "rb");
@@ -504,6 +566,30 @@ int MAIN(int argc, char **argv)
         err = 0;
         for (i = 0; i < argc; i++) {
             int r;
+#ifdef DGST_MMAP
+            if (use_mmap && (r = do_mmap(bmd, argv[i])) >= 0) {
+                /*
+                 * The file is already digested, detach the file BIO so
+                 * that do_fp() only finalises the context.
+                 */
+                (void)BIO_pop(bmd);
+                if (r == 0) {
+                    BIO_printf(bio_err, "Read Error in %s\n", argv[i]);
+                    ERR_print_errors(bio_err);
+                    err++;
+                } else {
+                    r = do_fp(out, buf, bmd, separator, out_bin, sigkey,
+                              sigbuf, siglen, sig_name, md_name, argv[i],
+                              bmd);
+                    if (r)
+                        err = r;
+                }
+                (void)BIO_reset(bmd);
+                (void)set_tree_params(bmd, tree_leaf_size, tree_threads);
+                (void)BIO_push(bmd, in);
+                continue;
+            }
+#endif
             if (BIO_read_filename(in, argv[i]) <= 0) {
                 perror(argv[i]);
                 err++;
@@ -514,6 +600,7 @@ int MAIN(int argc, char **argv)
             if (r)
                 err = r;
             (void)BIO_reset(bmd);
+            (void)set_tree_params(bmd, tree_leaf_size, tree_threads);
         }
     }
  end:
@@ -615,3 +702,73 @@ int do_fp(BIO *out, unsigned char *buf, BIO *bp, int sep, int binout,
     }
     return 0;
 }
+
+/*
+ * Apply -leafsize and -threads to an sm3-tree context, BIO_reset() puts
+ * the context back to the defaults so this is repeated after each file.
+ */
+static int set_tree_params(BIO *bmd, size_t leaf_size, int nthreads)
+{
+#ifndef OPENSSL_NO_SM3
+    EVP_MD_CTX *mctx;
+
+    if (!leaf_size && !nthreads)
+        return 1;
+    if (!BIO_get_md_ctx(bmd, &mctx) || EVP_MD_CTX_md(mctx) != EVP_sm3_tree())
+        return 1;
+    return EVP_MD_CTX_ctrl(mctx, EVP_MD_CTRL_SM3_TREE_PARAMS, nthreads,
+                           leaf_size ? &leaf_size : NULL);
+#else
+    return 1;
+#endif
+}
+
+#ifdef DGST_MMAP
+/*
+ * Feed a regular file to the digest of bmd straight from a read-only
+ * mapping, so large inputs are hashed without being copied through the
+ * BIO buffer. Returns 1 on success, 0 on a digest or mapping error and
+ * -1 if the file cannot be mapped, in which case the caller falls back
+ * to reading it.
+ */
+static int do_mmap(BIO *bmd, const char *file)
+{
+    EVP_MD_CTX *mctx;
+    struct stat st;
+    unsigned char *p;
+    off_t off;
+    size_t len;
+    int fd, ret = -1;
+
+    if (BIO_get_md_ctx(bmd, &mctx) <= 0)
+        return 0;
+    if ((fd = open(file, O_RDONLY)) < 0)
+        return -1;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+        goto end;
+
+    ret = 1;
+    for (off = 0; off < st.st_size; off += len) {
+        len = (size_t)(st.st_size - off);
+        if (len > MMAP_WINDOW)
+            len = MMAP_WINDOW;
+        p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, off);
+        if (p == MAP_FAILED) {
+            /* nothing digested yet, let the caller read the file */
+            ret = off ? 0 : -1;
+            break;
+        }
+# ifdef MADV_SEQUENTIAL
+        (void)madvise(p, len, MADV_SEQUENTIAL);
+# endif
+        if (!EVP_DigestUpdate(mctx, p, len))
+            ret = 0;
+        munmap(p, len);
+        if (ret == 0)
+            break;
+    }
+ end:
+    close(fd);
+    return ret;
+}
+#endif
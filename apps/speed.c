@@ -79,6 +79,7 @@
 # define DSA_SECONDS     10
 # define ECDSA_SECONDS   10
 # define ECDH_SECONDS    10
+# define SM2_SECONDS     10
 
 /* 11-Sep-92 Andrew Daviel   Support for Silicon Graphics IRIX added */
 /* 06-Apr-92 Luke Brennan    Support for VMS and add extra signal calls */
@@ -192,6 +193,21 @@
 #  include <openssl/ecdh.h>
 # endif
 # include <openssl/modes.h>
+# ifndef OPENSSL_NO_SM3
+#  include <openssl/sm3.h>
+# endif
+# ifndef OPENSSL_NO_SMS4
+#  include <openssl/sms4.h>
+# endif
+# ifndef OPENSSL_NO_ZUC
+#  include <openssl/zuc.h>
+# endif
+# ifndef OPENSSL_NO_SM2
+#  include <openssl/sm2.h>
+# endif
+# ifndef OPENSSL_NO_ECIES
+#  include <openssl/ecies.h>
+# endif
 
 # ifdef OPENSSL_FIPS
 #  ifdef OPENSSL_DOING_MAKEDEPEND
@@ -225,6 +241,25 @@
 #  define NO_FORK
 # endif
 
+# if defined(OPENSSL_THREADS) && defined(OPENSSL_SYS_UNIX)
+#  define SPEED_THREADS
+#  include <pthread.h>
+# endif
+# define MAX_THREADS     64
+
+/* the time stamp counter, to report cycles per byte */
+# if defined(__GNUC__) && !defined(OPENSSL_NO_ASM) && \
+     (defined(__i386__) || defined(__x86_64__))
+#  define SPEED_CYCLES
+static double speed_cycles(void)
+{
+    unsigned int lo, hi;
+
+    __asm__ volatile ("rdtsc":"=a" (lo), "=d"(hi));
+    return (double)hi * 4294967296.0 + (double)lo;
+}
+# endif
+
 # undef BUFSIZE
 # define BUFSIZE ((long)1024*8+1)
 static volatile int run = 0;
@@ -241,10 +276,11 @@ static void print_result(int alg, int run_no, int count, double time_used);
 static int do_multi(int multi);
 # endif
 
-# define ALGOR_NUM       30
+# define ALGOR_NUM       35
 # define SIZE_NUM        5
 # define RSA_NUM         4
 # define DSA_NUM         3
+# define GM_NUM          7
 
 # define EC_NUM       16
 # define MAX_ECDH_SIZE 256
@@ -256,12 +292,27 @@ static const char *names[ALGOR_NUM] = {
     "aes-128 cbc", "aes-192 cbc", "aes-256 cbc",
     "camellia-128 cbc", "camellia-192 cbc", "camellia-256 cbc",
     "evp", "sha256", "sha512", "whirlpool",
-    "aes-128 ige", "aes-192 ige", "aes-256 ige", "ghash"
+    "aes-128 ige", "aes-192 ige", "aes-256 ige", "ghash",
+    "sm3", "sms4 cbc", "sms4 ctr", "sms4 gcm", "zuc"
 };
 
 static double results[ALGOR_NUM][SIZE_NUM];
+static double cycles[ALGOR_NUM][SIZE_NUM];
 static int lengths[SIZE_NUM] = { 16, 64, 256, 1024, 8 * 1024 };
 
+/* SM2 and ECIES over sm2p256v1 */
+static const char *gm_names[GM_NUM] = {
+    "sm2 sign", "sm2 verify", "sm2 enc", "sm2 dec", "sm2 kap",
+    "ecies enc", "ecies dec"
+};
+
+static double gm_results[GM_NUM];
+
+# ifndef OPENSSL_NO_SMS4
+/* -evp sms4-cbc, the sms4 cbc jobs go through EVP_sms4_cbc() */
+static int sms4_cbc_evp = 0;
+# endif
+
 # ifndef OPENSSL_NO_RSA
 static double rsa_results[RSA_NUM][2];
 # endif
@@ -275,7 +326,7 @@ static double ecdsa_results[EC_NUM][2];
 static double ecdh_results[EC_NUM][1];
 # endif
 
-# if defined(OPENSSL_NO_DSA) && !(defined(OPENSSL_NO_ECDSA) && defined(OPENSSL_NO_ECDH))
+# if defined(OPENSSL_NO_DSA) && !(defined(OPENSSL_NO_ECDSA) && defined(OPENSSL_NO_ECDH) && defined(OPENSSL_NO_EC))
 static const char rnd_seed[] =
     "string to make the random number generator think it has entropy";
 static int rnd_fake = 0;
@@ -368,6 +419,51 @@ static void *KDF1_SHA1(const void *in, size_t inlen, void *out,
 
 static void multiblock_speed(const EVP_CIPHER *evp_cipher);
 
+/*
+ * The SM2, SM3, SMS4, ZUC and ECIES benchmarks run one job per thread,
+ * each job has its own buffer, keys and contexts.
+ */
+typedef struct speed_job_st SPEED_JOB;
+struct speed_job_st {
+    int (*op) (SPEED_JOB *job);
+    int len;
+    long max;
+    long count;
+    double cycles;
+    int err;
+    unsigned char *buf;
+    unsigned char iv[32];
+    unsigned char in[512];
+    size_t inlen;
+    unsigned char out[512];
+    EVP_CIPHER_CTX ctx;
+# ifndef OPENSSL_NO_SMS4
+    sms4_key_t sms4_key;
+# endif
+# ifndef OPENSSL_NO_ZUC
+    ZUC_KEY zuc_key;
+# endif
+# ifndef OPENSSL_NO_EC
+    EC_KEY *ec_key;
+    EC_KEY *peer_key;
+# endif
+# ifndef OPENSSL_NO_ECIES
+    ECIES_PARAMS ecies;
+# endif
+};
+
+static int speed_sym_init(SPEED_JOB *job, int alg, const unsigned char *key);
+# ifndef OPENSSL_NO_EC
+static int speed_gm_init(SPEED_JOB *job, int alg, EC_KEY *key, EC_KEY *peer);
+# endif
+static void speed_job_cleanup(SPEED_JOB *job);
+static long run_jobs(SPEED_JOB *jobs, int n, int len, long max,
+                     double *cyc);
+# ifdef SPEED_THREADS
+static int speed_threads_init(void);
+static void speed_threads_cleanup(void);
+# endif
+
 int MAIN(int, char **);
 
 int MAIN(int argc, char **argv)
@@ -516,6 +612,11 @@ int MAIN(int argc, char **argv)
 # define D_IGE_192_AES   27
 # define D_IGE_256_AES   28
 # define D_GHASH         29
+# define D_SM3           30
+# define D_CBC_SMS4      31
+# define D_CTR_SMS4      32
+# define D_GCM_SMS4      33
+# define D_ZUC           34
     double d = 0.0;
     long c[ALGOR_NUM][SIZE_NUM];
 # define R_DSA_512       0
@@ -543,6 +644,14 @@ int MAIN(int argc, char **argv)
 # define R_EC_B409    14
 # define R_EC_B571    15
 
+# define R_SM2_SIGN      0
+# define R_SM2_VERIFY    1
+# define R_SM2_ENC       2
+# define R_SM2_DEC       3
+# define R_SM2_KAP       4
+# define R_ECIES_ENC     5
+# define R_ECIES_DEC     6
+
 # ifndef OPENSSL_NO_RSA
     RSA *rsa_key[RSA_NUM];
     long rsa_c[RSA_NUM][2];
@@ -631,6 +740,17 @@ int MAIN(int argc, char **argv)
     int secret_idx = 0;
     long ecdh_c[EC_NUM][2];
 # endif
+# ifndef OPENSSL_NO_EC
+    EC_KEY *gm_key = NULL, *gm_peer = NULL;
+# endif
+    long gm_c[GM_NUM];
+    int gm_doit[GM_NUM];
+    SPEED_JOB *jobs = NULL;
+    int threads = 1;
+# ifdef SPEED_THREADS
+    int threads_init = 0;
+# endif
+    double cyc;
 
     int rsa_doit[RSA_NUM];
     int dsa_doit[DSA_NUM];
@@ -656,6 +776,8 @@ int MAIN(int argc, char **argv)
 
     apps_startup();
     memset(results, 0, sizeof(results));
+    memset(cycles, 0, sizeof(cycles));
+    memset(gm_results, 0, sizeof(gm_results));
 # ifndef OPENSSL_NO_DSA
     memset(dsa_key, 0, sizeof(dsa_key));
 # endif
@@ -710,6 +832,8 @@ int MAIN(int argc, char **argv)
     for (i = 0; i < EC_NUM; i++)
         ecdh_doit[i] = 0;
 # endif
+    for (i = 0; i < GM_NUM; i++)
+        gm_doit[i] = 0;
 
     j = 0;
     argc--;
@@ -774,6 +898,22 @@ int MAIN(int argc, char **argv)
             j--;                /* Otherwise, -mr gets confused with an
                                  * algorithm. */
         }
+# endif
+# ifdef SPEED_THREADS
+        else if ((argc > 0) && (strcmp(*argv, "-threads") == 0)) {
+            argc--;
+            argv++;
+            if (argc == 0) {
+                BIO_printf(bio_err, "no thread count given\n");
+                goto end;
+            }
+            threads = atoi(argv[0]);
+            if (threads <= 0 || threads > MAX_THREADS) {
+                BIO_printf(bio_err, "bad thread count\n");
+                goto end;
+            }
+            j--;
+        }
 # endif
         else if (argc > 0 && !strcmp(*argv, "-mr")) {
             mr = 1;
@@ -875,6 +1015,29 @@ int MAIN(int argc, char **argv)
             doit[D_CBC_256_CML] = 1;
         else
 # endif
+# ifndef OPENSSL_NO_SM3
+        if (strcmp(*argv, "sm3") == 0)
+            doit[D_SM3] = 1;
+        else
+# endif
+# ifndef OPENSSL_NO_SMS4
+        if (strcmp(*argv, "sms4-cbc") == 0)
+            doit[D_CBC_SMS4] = 1;
+        else if (strcmp(*argv, "sms4-ctr") == 0)
+            doit[D_CTR_SMS4] = 1;
+        else if (strcmp(*argv, "sms4-gcm") == 0)
+            doit[D_GCM_SMS4] = 1;
+        else if (strcmp(*argv, "sms4") == 0) {
+            doit[D_CBC_SMS4] = 1;
+            doit[D_CTR_SMS4] = 1;
+            doit[D_GCM_SMS4] = 1;
+        } else
+# endif
+# ifndef OPENSSL_NO_ZUC
+        if (strcmp(*argv, "zuc") == 0)
+            doit[D_ZUC] = 1;
+        else
+# endif
 # ifndef OPENSSL_NO_RSA
 #  if 0                         /* was: #ifdef RSAref */
         if (strcmp(*argv, "rsaref") == 0) {
@@ -1062,6 +1225,28 @@ int MAIN(int argc, char **argv)
             for (i = 0; i < EC_NUM; i++)
                 ecdh_doit[i] = 1;
         } else
+# endif
+# ifndef OPENSSL_NO_SM2
+        if (strcmp(*argv, "sm2sign") == 0)
+            gm_doit[R_SM2_SIGN] = 1;
+        else if (strcmp(*argv, "sm2verify") == 0)
+            gm_doit[R_SM2_VERIFY] = 1;
+        else if (strcmp(*argv, "sm2enc") == 0)
+            gm_doit[R_SM2_ENC] = 1;
+        else if (strcmp(*argv, "sm2dec") == 0)
+            gm_doit[R_SM2_DEC] = 1;
+        else if (strcmp(*argv, "sm2kap") == 0)
+            gm_doit[R_SM2_KAP] = 1;
+        else if (strcmp(*argv, "sm2") == 0) {
+            for (i = R_SM2_SIGN; i <= R_SM2_KAP; i++)
+                gm_doit[i] = 1;
+        } else
+# endif
+# ifndef OPENSSL_NO_ECIES
+        if (strcmp(*argv, "ecies") == 0) {
+            gm_doit[R_ECIES_ENC] = 1;
+            gm_doit[R_ECIES_DEC] = 1;
+        } else
 # endif
         {
             BIO_printf(bio_err, "Error: bad option or value\n");
@@ -1139,6 +1324,19 @@ int MAIN(int argc, char **argv)
             BIO_printf(bio_err, "rc4");
 # endif
             BIO_printf(bio_err, "\n");
+# ifndef OPENSSL_NO_SM3
+            BIO_printf(bio_err, "sm3      ");
+# endif
+# ifndef OPENSSL_NO_SMS4
+            BIO_printf(bio_err, "sms4-cbc sms4-ctr sms4-gcm ");
+# endif
+# ifndef OPENSSL_NO_ZUC
+            BIO_printf(bio_err, "zuc");
+# endif
+# if !defined(OPENSSL_NO_SM3) || !defined(OPENSSL_NO_SMS4) || \
+    !defined(OPENSSL_NO_ZUC)
+            BIO_printf(bio_err, "\n");
+# endif
 
 # ifndef OPENSSL_NO_RSA
             BIO_printf(bio_err, "rsa512   rsa1024  rsa2048  rsa4096\n");
@@ -1165,6 +1363,9 @@ int MAIN(int argc, char **argv)
                        "ecdhb163  ecdhb233  ecdhb283  ecdhb409  ecdhb571\n");
             BIO_printf(bio_err, "ecdh\n");
 # endif
+# ifndef OPENSSL_NO_SM2
+            BIO_printf(bio_err, "sm2sign  sm2verify sm2enc   sm2dec   sm2kap\n");
+# endif
 
 # ifndef OPENSSL_NO_IDEA
             BIO_printf(bio_err, "idea     ");
@@ -1188,12 +1389,23 @@ int MAIN(int argc, char **argv)
             BIO_printf(bio_err, "rsa      ");
 # endif
 # ifndef OPENSSL_NO_BF
-            BIO_printf(bio_err, "blowfish");
+            BIO_printf(bio_err, "blowfish ");
+# endif
+# ifndef OPENSSL_NO_SMS4
+            BIO_printf(bio_err, "sms4     ");
+# endif
+# ifndef OPENSSL_NO_SM2
+            BIO_printf(bio_err, "sm2      ");
+# endif
+# ifndef OPENSSL_NO_ECIES
+            BIO_printf(bio_err, "ecies");
 # endif
 # if !defined(OPENSSL_NO_IDEA) || !defined(OPENSSL_NO_SEED) || \
     !defined(OPENSSL_NO_RC2) || !defined(OPENSSL_NO_DES) || \
     !defined(OPENSSL_NO_RSA) || !defined(OPENSSL_NO_BF) || \
-    !defined(OPENSSL_NO_AES) || !defined(OPENSSL_NO_CAMELLIA)
+    !defined(OPENSSL_NO_AES) || !defined(OPENSSL_NO_CAMELLIA) || \
+    !defined(OPENSSL_NO_SMS4) || !defined(OPENSSL_NO_SM2) || \
+    !defined(OPENSSL_NO_ECIES)
             BIO_printf(bio_err, "\n");
 # endif
 
@@ -1218,6 +1430,11 @@ int MAIN(int argc, char **argv)
 # ifndef NO_FORK
             BIO_printf(bio_err,
                        "-multi n        " "run n benchmarks in parallel.\n");
+# endif
+# ifdef SPEED_THREADS
+            BIO_printf(bio_err,
+                       "-threads n      "
+                       "run the SM2, SM3, SMS4, ZUC and ECIES benchmarks in n threads.\n");
 # endif
             goto end;
         }
@@ -1226,6 +1443,21 @@ int MAIN(int argc, char **argv)
         j++;
     }
 
+# ifndef OPENSSL_NO_SMS4
+    /*
+     * The EVP SMS4-CBC encryption is timed by the sms4 cbc jobs, so that
+     * it runs in the threads and gets its cycles per byte like sms4-ctr
+     * and sms4-gcm.
+     */
+    if (doit[D_EVP] && evp_cipher != NULL
+        && EVP_CIPHER_nid(evp_cipher) == NID_sms4_cbc
+        && !decrypt && !multiblock) {
+        doit[D_EVP] = 0;
+        doit[D_CBC_SMS4] = 1;
+        sms4_cbc_evp = 1;
+    }
+# endif
+
 # ifndef NO_FORK
     if (multi && do_multi(multi))
         goto show_res;
@@ -1248,11 +1480,35 @@ int MAIN(int argc, char **argv)
         for (i = 0; i < EC_NUM; i++)
             ecdh_doit[i] = 1;
 # endif
+        for (i = 0; i < GM_NUM; i++)
+            gm_doit[i] = 1;
     }
     for (i = 0; i < ALGOR_NUM; i++)
         if (doit[i])
             pr_header++;
 
+    /*
+     * User CPU time adds up over the threads, the threads are timed in
+     * real time like the -multi children.
+     */
+    if (threads > 1)
+        usertime = 0;
+    jobs = (SPEED_JOB *)OPENSSL_malloc(threads * sizeof(SPEED_JOB));
+    if (jobs == NULL) {
+        BIO_printf(bio_err, "out of memory\n");
+        goto end;
+    }
+    memset(jobs, 0, threads * sizeof(SPEED_JOB));
+# ifdef SPEED_THREADS
+    if (threads > 1) {
+        if (!speed_threads_init()) {
+            BIO_printf(bio_err, "out of memory\n");
+            goto end;
+        }
+        threads_init = 1;
+    }
+# endif
+
     if (usertime == 0 && !mr)
         BIO_printf(bio_err,
                    "You have chosen to measure elapsed time "
@@ -1370,6 +1626,13 @@ int MAIN(int argc, char **argv)
     c[D_IGE_192_AES][0] = count;
     c[D_IGE_256_AES][0] = count;
     c[D_GHASH][0] = count;
+    c[D_SM3][0] = count;
+    c[D_CBC_SMS4][0] = count;
+    c[D_CTR_SMS4][0] = count;
+    c[D_GCM_SMS4][0] = count;
+    c[D_ZUC][0] = count * 5;
+    for (i = 0; i < GM_NUM; i++)
+        gm_c[i] = count / 1000;
 
     for (i = 1; i < SIZE_NUM; i++) {
         c[D_MD2][i] = c[D_MD2][0] * 4 * lengths[0] / lengths[i];
@@ -1382,6 +1645,7 @@ int MAIN(int argc, char **argv)
         c[D_SHA256][i] = c[D_SHA256][0] * 4 * lengths[0] / lengths[i];
         c[D_SHA512][i] = c[D_SHA512][0] * 4 * lengths[0] / lengths[i];
         c[D_WHIRLPOOL][i] = c[D_WHIRLPOOL][0] * 4 * lengths[0] / lengths[i];
+        c[D_SM3][i] = c[D_SM3][0] * 4 * lengths[0] / lengths[i];
     }
     for (i = 1; i < SIZE_NUM; i++) {
         long l0, l1;
@@ -1406,6 +1670,10 @@ int MAIN(int argc, char **argv)
         c[D_IGE_128_AES][i] = c[D_IGE_128_AES][i - 1] * l0 / l1;
         c[D_IGE_192_AES][i] = c[D_IGE_192_AES][i - 1] * l0 / l1;
         c[D_IGE_256_AES][i] = c[D_IGE_256_AES][i - 1] * l0 / l1;
+        c[D_CBC_SMS4][i] = c[D_CBC_SMS4][i - 1] * l0 / l1;
+        c[D_CTR_SMS4][i] = c[D_CTR_SMS4][i - 1] * l0 / l1;
+        c[D_GCM_SMS4][i] = c[D_GCM_SMS4][i - 1] * l0 / l1;
+        c[D_ZUC][i] = c[D_ZUC][i - 1] * l0 / l1;
     }
 #   ifndef OPENSSL_NO_RSA
     rsa_c[R_RSA_512][0] = count / 2000;
@@ -1533,6 +1801,7 @@ int MAIN(int argc, char **argv)
 
 #   define COND(d) (count < (d))
 #   define COUNT(d) (d)
+#   define MAX_COUNT(d) (d)
 #  else
 /* not worth fixing */
 #   error "You cannot disable DES on systems without SIGALRM."
@@ -1540,6 +1809,7 @@ int MAIN(int argc, char **argv)
 # else
 #  define COND(c) (run && count<0x7fffffff)
 #  define COUNT(d) (count)
+#  define MAX_COUNT(d) 0x7fffffff
 #  ifndef _WIN32
     signal(SIGALRM, sig_done);
 #  endif
@@ -1821,6 +2091,37 @@ int MAIN(int argc, char **argv)
         CRYPTO_gcm128_release(ctx);
     }
 # endif
+    for (k = D_SM3; k <= D_ZUC; k++) {
+        if (!doit[k])
+            continue;
+        for (i = 0; i < threads; i++)
+            if (!speed_sym_init(&jobs[i], k, key16))
+                break;
+        if (i < threads) {
+            BIO_printf(bio_err, "%s setup failure.\n", names[k]);
+            ERR_print_errors(bio_err);
+            doit[k] = 0;
+        } else {
+            for (j = 0; j < SIZE_NUM; j++) {
+                print_message(names[k], c[k][j], lengths[j]);
+                Time_F(START);
+                count = run_jobs(jobs, threads, lengths[j],
+                                 MAX_COUNT(c[k][j]), &cyc);
+                d = Time_F(STOP);
+                if (count < 0) {
+                    BIO_printf(bio_err, "%s failure.\n", names[k]);
+                    ERR_print_errors(bio_err);
+                    doit[k] = 0;
+                    break;
+                }
+                print_result(k, j, count, d);
+                if (count > 0)
+                    cycles[k][j] = cyc / ((double)count * lengths[j]);
+            }
+        }
+        for (i = 0; i < threads; i++)
+            speed_job_cleanup(&jobs[i]);
+    }
 # ifndef OPENSSL_NO_CAMELLIA
     if (doit[D_CBC_128_CML]) {
         for (j = 0; j < SIZE_NUM; j++) {
@@ -2354,6 +2655,59 @@ int MAIN(int argc, char **argv)
     if (rnd_fake)
         RAND_cleanup();
 # endif
+
+# ifndef OPENSSL_NO_EC
+    for (k = 0; k < GM_NUM; k++)
+        if (gm_doit[k])
+            break;
+    if (k < GM_NUM && RAND_status() != 1) {
+        RAND_seed(rnd_seed, sizeof rnd_seed);
+        rnd_fake = 1;
+    }
+    if (k < GM_NUM) {
+        gm_key = EC_KEY_new_by_curve_name(NID_sm2p256v1);
+        gm_peer = EC_KEY_new_by_curve_name(NID_sm2p256v1);
+        if (gm_key == NULL || gm_peer == NULL ||
+            !EC_KEY_generate_key(gm_key) || !EC_KEY_generate_key(gm_peer)) {
+            BIO_printf(bio_err, "SM2 key generation failure.\n");
+            ERR_print_errors(bio_err);
+            for (k = 0; k < GM_NUM; k++)
+                gm_doit[k] = 0;
+        } else
+            EC_KEY_precompute_mult(gm_key, NULL);
+    }
+    for (k = 0; k < GM_NUM; k++) {
+        if (!gm_doit[k])
+            continue;
+        for (i = 0; i < threads; i++)
+            if (!speed_gm_init(&jobs[i], k, gm_key, gm_peer))
+                break;
+        if (i < threads) {
+            BIO_printf(bio_err, "%s setup failure.\n", gm_names[k]);
+            ERR_print_errors(bio_err);
+            gm_doit[k] = 0;
+        } else {
+            pkey_print_message("", gm_names[k], gm_c[k], 256, SM2_SECONDS);
+            Time_F(START);
+            count = run_jobs(jobs, threads, 32, MAX_COUNT(gm_c[k]), &cyc);
+            d = Time_F(STOP);
+            if (count <= 0) {
+                BIO_printf(bio_err, "%s failure.\n", gm_names[k]);
+                ERR_print_errors(bio_err);
+                gm_doit[k] = 0;
+            } else {
+                BIO_printf(bio_err,
+                           mr ? "+R8:%ld:%s:%.2f\n" :
+                           "%ld %s ops in %.2fs\n", count, gm_names[k], d);
+                gm_results[k] = d / (double)count;
+            }
+        }
+        for (i = 0; i < threads; i++)
+            speed_job_cleanup(&jobs[i]);
+    }
+    if (rnd_fake)
+        RAND_cleanup();
+# endif
 # ifndef NO_FORK
  show_res:
 # endif
@@ -2492,6 +2846,43 @@ int MAIN(int argc, char **argv)
                     ecdh_results[k][0], 1.0 / ecdh_results[k][0]);
     }
 # endif
+    j = 1;
+    for (k = 0; k < GM_NUM; k++) {
+        if (!gm_doit[k])
+            continue;
+        if (j && !mr) {
+            printf("%30sop      op/s\n", " ");
+            j = 0;
+        }
+        if (mr)
+            fprintf(stdout, "+F6:%u:%f:%f\n",
+                    k, gm_results[k], 1.0 / gm_results[k]);
+        else
+            fprintf(stdout, "%-28s %8.4fs %8.1f\n",
+                    gm_names[k], gm_results[k], 1.0 / gm_results[k]);
+    }
+
+    /* cycles are only counted for the SM3, SMS4 and ZUC benchmarks */
+    j = 1;
+    for (k = D_SM3; k <= D_ZUC; k++) {
+        if (!doit[k] || cycles[k][0] <= 0)
+            continue;
+        if (j && !mr) {
+            fprintf(stdout, "The 'numbers' are in cycles per byte processed.\n");
+            fprintf(stdout, "type        ");
+            for (j = 0; j < SIZE_NUM; j++)
+                fprintf(stdout, "%7d bytes", lengths[j]);
+            fprintf(stdout, "\n");
+        }
+        j = 0;
+        if (mr)
+            fprintf(stdout, "+C:%d:%s", k, names[k]);
+        else
+            fprintf(stdout, "%-13s", names[k]);
+        for (i = 0; i < SIZE_NUM; i++)
+            fprintf(stdout, mr ? ":%.2f" : " %11.2f ", cycles[k][i]);
+        fprintf(stdout, "\n");
+    }
 
     mret = 0;
 
@@ -2501,6 +2892,18 @@ int MAIN(int argc, char **argv)
         OPENSSL_free(buf);
     if (buf2 != NULL)
         OPENSSL_free(buf2);
+    if (jobs != NULL)
+        OPENSSL_free(jobs);
+# ifdef SPEED_THREADS
+    if (threads_init)
+        speed_threads_cleanup();
+# endif
+# ifndef OPENSSL_NO_EC
+    if (gm_key != NULL)
+        EC_KEY_free(gm_key);
+    if (gm_peer != NULL)
+        EC_KEY_free(gm_peer);
+# endif
 # ifndef OPENSSL_NO_RSA
     for (i = 0; i < RSA_NUM; i++)
         if (rsa_key[i] != NULL)
@@ -2750,6 +3153,29 @@ static int do_multi(int multi)
 
             }
 #  endif
+            else if (!strncmp(buf, "+F6:", 4)) {
+                int k;
+                double d;
+
+                p = buf + 4;
+                k = atoi(sstrsep(&p, sep));
+
+                d = atof(sstrsep(&p, sep));
+                if (n)
+                    gm_results[k] = 1 / (1 / gm_results[k] + 1 / d);
+                else
+                    gm_results[k] = d;
+            } else if (!strncmp(buf, "+C:", 3)) {
+                int alg;
+                int j;
+
+                /* the children run at once, average their cycles */
+                p = buf + 3;
+                alg = atoi(sstrsep(&p, sep));
+                sstrsep(&p, sep);
+                for (j = 0; j < SIZE_NUM; ++j)
+                    cycles[alg][j] += atof(sstrsep(&p, sep)) / multi;
+            }
 
             else if (!strncmp(buf, "+H:", 3)) {
             } else
@@ -2871,4 +3297,361 @@ end:
     if (out)
         OPENSSL_free(out);
 }
+
+/*
+ * The SM2, SM3, SMS4, ZUC and ECIES jobs. The ops return 1 on success,
+ * a job stops at the first failure.
+ */
+# ifndef OPENSSL_NO_SM3
+static int speed_sm3(SPEED_JOB *job)
+{
+    return EVP_Digest(job->buf, job->len, job->out, NULL, EVP_sm3(), NULL);
+}
+# endif
+
+# ifndef OPENSSL_NO_SMS4
+static int speed_sms4_cbc(SPEED_JOB *job)
+{
+    sms4_cbc_encrypt(job->buf, job->buf, job->len, &job->sms4_key, job->iv,
+                     1);
+    return 1;
+}
+
+/* sms4-ctr, and sms4-cbc under -evp */
+static int speed_sms4_evp(SPEED_JOB *job)
+{
+    int outl;
+
+    return EVP_EncryptUpdate(&job->ctx, job->buf, &outl, job->buf, job->len);
+}
+
+static int speed_sms4_gcm(SPEED_JOB *job)
+{
+    int outl;
+
+    return EVP_EncryptInit_ex(&job->ctx, NULL, NULL, NULL, job->iv)
+        && EVP_EncryptUpdate(&job->ctx, job->buf, &outl, job->buf, job->len)
+        && EVP_EncryptFinal_ex(&job->ctx, job->buf + outl, &outl)
+        && EVP_CIPHER_CTX_ctrl(&job->ctx, EVP_CTRL_GCM_GET_TAG, 16, job->out);
+}
+# endif
+
+# ifndef OPENSSL_NO_ZUC
+static int speed_zuc(SPEED_JOB *job)
+{
+    ZUC_encrypt(&job->zuc_key, job->len, job->buf, job->buf);
+    return 1;
+}
+# endif
+
+# ifndef OPENSSL_NO_SM2
+static int speed_sm2_sign(SPEED_JOB *job)
+{
+    unsigned int siglen = sizeof(job->out);
+
+    return SM2_sign(NID_undef, job->iv, job->len, job->out, &siglen,
+                    job->ec_key);
+}
+
+static int speed_sm2_verify(SPEED_JOB *job)
+{
+    return SM2_verify(NID_undef, job->iv, job->len, job->in,
+                      (int)job->inlen, job->ec_key) == SM2_VERIFY_SUCCESS;
+}
+
+static int speed_sm2_enc(SPEED_JOB *job)
+{
+    size_t outlen = sizeof(job->out);
+
+    return SM2_encrypt(job->iv, job->len, job->out, &outlen, job->ec_key);
+}
+
+static int speed_sm2_dec(SPEED_JOB *job)
+{
+    size_t outlen = sizeof(job->out);
+
+    return SM2_decrypt(job->in, job->inlen, job->out, &outlen, job->ec_key);
+}
+
+/* the initiator side, against the responder's point prepared in job->in */
+static int speed_sm2_kap(SPEED_JOB *job)
+{
+    SM2_KAP_CTX ctx;
+    size_t len = sizeof(job->out);
+    int ret;
+
+    if (!SM2_KAP_CTX_init(&ctx, job->ec_key, job->peer_key, 1, 0))
+        return 0;
+    ret = SM2_KAP_prepare(&ctx, job->out, &len)
+        && SM2_KAP_compute_key(&ctx, job->in, job->inlen, job->out, 16,
+                               NULL, NULL);
+    SM2_KAP_CTX_cleanup(&ctx);
+    return ret;
+}
+# endif
+
+# ifndef OPENSSL_NO_ECIES
+static int speed_ecies_enc(SPEED_JOB *job)
+{
+    size_t outlen = sizeof(job->out);
+
+    return ECIES_encrypt(job->out, &outlen, &job->ecies, job->iv, job->len,
+                         job->ec_key);
+}
+
+static int speed_ecies_dec(SPEED_JOB *job)
+{
+    size_t outlen = sizeof(job->out);
+
+    return ECIES_decrypt(job->out, &outlen, &job->ecies, job->in,
+                         job->inlen, job->ec_key);
+}
+# endif
+
+static int speed_sym_init(SPEED_JOB *job, int alg, const unsigned char *key)
+{
+    if (job->buf == NULL
+        && (job->buf = (unsigned char *)OPENSSL_malloc(BUFSIZE)) == NULL)
+        return 0;
+    memset(job->buf, 0, BUFSIZE);
+    EVP_CIPHER_CTX_init(&job->ctx);
+
+    switch (alg) {
+# ifndef OPENSSL_NO_SM3
+    case D_SM3:
+        job->op = speed_sm3;
+        return 1;
+# endif
+# ifndef OPENSSL_NO_SMS4
+    case D_CBC_SMS4:
+        if (sms4_cbc_evp) {
+            job->op = speed_sms4_evp;
+            return EVP_EncryptInit_ex(&job->ctx, EVP_sms4_cbc(), NULL, key,
+                                      job->iv);
+        }
+        sms4_set_encrypt_key(&job->sms4_key, key);
+        job->op = speed_sms4_cbc;
+        return 1;
+    case D_CTR_SMS4:
+        job->op = speed_sms4_evp;
+        return EVP_EncryptInit_ex(&job->ctx, EVP_sms4_ctr(), NULL, key,
+                                  job->iv);
+    case D_GCM_SMS4:
+        job->op = speed_sms4_gcm;
+        return EVP_EncryptInit_ex(&job->ctx, EVP_sms4_gcm(), NULL, key,
+                                  job->iv);
+# endif
+# ifndef OPENSSL_NO_ZUC
+    case D_ZUC:
+        ZUC_set_key(&job->zuc_key, key, job->iv);
+        job->op = speed_zuc;
+        return 1;
+# endif
+    }
+    return 0;
+}
+
+# ifndef OPENSSL_NO_EC
+/*
+ * Every job works on its own copy of the keys, the signature, ciphertext
+ * or key agreement point the op consumes is prepared here.
+ */
+static int speed_gm_init(SPEED_JOB *job, int alg, EC_KEY *key, EC_KEY *peer)
+{
+#  ifndef OPENSSL_NO_SM2
+    SM2_KAP_CTX ctx;
+    unsigned int siglen;
+    int ret;
+#  endif
+
+    memset(job->iv, 0x5a, sizeof(job->iv));
+    job->len = sizeof(job->iv);
+    job->inlen = sizeof(job->in);
+    if ((job->ec_key = EC_KEY_dup(key)) == NULL
+        || (job->peer_key = EC_KEY_dup(peer)) == NULL)
+        return 0;
+
+#  ifndef OPENSSL_NO_ECIES
+    job->ecies.kdf_nid = NID_x9_63_kdf;
+    job->ecies.kdf_md = EVP_sm3();
+    job->ecies.sym_cipher = EVP_sms4_cbc();
+    job->ecies.mac_nid = NID_hmac_full_ecies;
+    job->ecies.mac_md = EVP_sm3();
+    job->ecies.mac_cipher = NULL;
+#  endif
+
+    switch (alg) {
+#  ifndef OPENSSL_NO_SM2
+    case R_SM2_SIGN:
+        job->op = speed_sm2_sign;
+        return 1;
+    case R_SM2_VERIFY:
+        job->op = speed_sm2_verify;
+        siglen = sizeof(job->in);
+        if (!SM2_sign(NID_undef, job->iv, job->len, job->in, &siglen,
+                      job->ec_key))
+            return 0;
+        job->inlen = siglen;
+        return 1;
+    case R_SM2_ENC:
+        job->op = speed_sm2_enc;
+        return 1;
+    case R_SM2_DEC:
+        job->op = speed_sm2_dec;
+        return SM2_encrypt(job->iv, job->len, job->in, &job->inlen,
+                           job->ec_key);
+    case R_SM2_KAP:
+        job->op = speed_sm2_kap;
+        if (!SM2_KAP_CTX_init(&ctx, job->peer_key, job->ec_key, 0, 0))
+            return 0;
+        ret = SM2_KAP_prepare(&ctx, job->in, &job->inlen);
+        SM2_KAP_CTX_cleanup(&ctx);
+        return ret;
+#  endif
+#  ifndef OPENSSL_NO_ECIES
+    case R_ECIES_ENC:
+        job->op = speed_ecies_enc;
+        return 1;
+    case R_ECIES_DEC:
+        job->op = speed_ecies_dec;
+        return ECIES_encrypt(job->in, &job->inlen, &job->ecies, job->iv,
+                             job->len, job->ec_key);
+#  endif
+    }
+    return 0;
+}
+# endif
+
+static void speed_job_cleanup(SPEED_JOB *job)
+{
+    if (job->buf != NULL)
+        OPENSSL_free(job->buf);
+    EVP_CIPHER_CTX_cleanup(&job->ctx);
+# ifndef OPENSSL_NO_EC
+    if (job->ec_key != NULL)
+        EC_KEY_free(job->ec_key);
+    if (job->peer_key != NULL)
+        EC_KEY_free(job->peer_key);
+# endif
+    OPENSSL_cleanse(job, sizeof(*job));
+}
+
+static void *speed_loop(void *arg)
+{
+    SPEED_JOB *job = (SPEED_JOB *)arg;
+# ifdef SPEED_CYCLES
+    double start = speed_cycles();
+# endif
+
+    for (job->count = 0; run && job->count < job->max; job->count++) {
+        if (!job->op(job)) {
+            job->err = 1;
+            break;
+        }
+    }
+# ifdef SPEED_CYCLES
+    job->cycles = speed_cycles() - start;
+# endif
+    return NULL;
+}
+
+/*
+ * Runs n jobs of len bytes at once, job 0 in the calling thread. Returns
+ * the number of ops done by all of them and the cycles they spent, or -1
+ * if one of them failed.
+ */
+static long run_jobs(SPEED_JOB *jobs, int n, int len, long max, double *cyc)
+{
+# ifdef SPEED_THREADS
+    pthread_t tid[MAX_THREADS];
+# endif
+    long count = 0;
+    int i, started = n;
+
+    for (i = 0; i < n; i++) {
+        jobs[i].len = len;
+        jobs[i].max = max;
+        jobs[i].count = 0;
+        jobs[i].cycles = 0;
+        jobs[i].err = 0;
+    }
+    run = 1;
+# ifdef SPEED_THREADS
+    for (i = 1; i < n; i++) {
+        if (pthread_create(&tid[i], NULL, speed_loop, &jobs[i]) != 0) {
+            jobs[i].err = 1;
+            started = i;
+            break;
+        }
+    }
+# endif
+    speed_loop(&jobs[0]);
+# ifdef SPEED_THREADS
+    for (i = 1; i < started; i++)
+        pthread_join(tid[i], NULL);
+# endif
+
+    *cyc = 0;
+    for (i = 0; i < n; i++) {
+        if (jobs[i].err)
+            return -1;
+        count += jobs[i].count;
+        *cyc += jobs[i].cycles;
+    }
+    return count;
+}
+
+# ifdef SPEED_THREADS
+/*
+ * The threads always get real locks, the callback gmssl installs for
+ * OPENSSL_DEBUG_LOCKING only checks the lock usage. It is put back once
+ * the run is over.
+ */
+static pthread_mutex_t *speed_locks = NULL;
+static void (*speed_prev_locking_cb) (int, int, const char *, int) = NULL;
+
+static void speed_locking_callback(int mode, int type, const char *file,
+                                   int line)
+{
+    if (mode & CRYPTO_LOCK)
+        pthread_mutex_lock(&speed_locks[type]);
+    else
+        pthread_mutex_unlock(&speed_locks[type]);
+}
+
+static void speed_threadid_callback(CRYPTO_THREADID *id)
+{
+    CRYPTO_THREADID_set_numeric(id, (unsigned long)pthread_self());
+}
+
+static int speed_threads_init(void)
+{
+    int i;
+
+    speed_locks = (pthread_mutex_t *)
+        OPENSSL_malloc(CRYPTO_num_locks() * sizeof(pthread_mutex_t));
+    if (speed_locks == NULL)
+        return 0;
+    for (i = 0; i < CRYPTO_num_locks(); i++)
+        pthread_mutex_init(&speed_locks[i], NULL);
+    /* the id callback can be set only once, keep one already there */
+    if (CRYPTO_THREADID_get_callback() == NULL)
+        CRYPTO_THREADID_set_callback(speed_threadid_callback);
+    speed_prev_locking_cb = CRYPTO_get_locking_callback();
+    CRYPTO_set_locking_callback(speed_locking_callback);
+    return 1;
+}
+
+static void speed_threads_cleanup(void)
+{
+    int i;
+
+    CRYPTO_set_locking_callback(speed_prev_locking_cb);
+    speed_prev_locking_cb = NULL;
+    for (i = 0; i < CRYPTO_num_locks(); i++)
+        pthread_mutex_destroy(&speed_locks[i]);
+    OPENSSL_free(speed_locks);
+    speed_locks = NULL;
+}
+# endif
 #endif
@@ -128,6 +128,8 @@ typedef struct ec_group_st
 
 typedef struct ec_point_st EC_POINT;
 
+typedef struct ec_point_table_st EC_POINT_TABLE;
+
 /********************************************************************/
 /*               EC_METHODs for curves over GF(p)                   */
 /********************************************************************/
@@ -698,6 +700,47 @@ int EC_GROUP_precompute_mult(EC_GROUP *group, BN_CTX *ctx);
  */
 int EC_GROUP_have_precompute_mult(const EC_GROUP *group);
 
+/** Creates a table of multiples of a point that is used in many
+ *  multiplications, such as a public key verifying many signatures
+ *  \param  group  underlying EC_GROUP object
+ *  \param  point  EC_POINT object, not the point at infinity
+ *  \param  ctx    BN_CTX object (optional)
+ *  \return newly created EC_POINT_TABLE object or NULL if an error occurred
+ */
+EC_POINT_TABLE *EC_POINT_TABLE_new(const EC_GROUP *group,
+                                   const EC_POINT *point, BN_CTX *ctx);
+
+/** Frees an EC_POINT_TABLE object, the tables are reference counted
+ *  \param  table  EC_POINT_TABLE object to be freed
+ */
+void EC_POINT_TABLE_free(EC_POINT_TABLE *table);
+
+/** Increments the reference count of an EC_POINT_TABLE object
+ *  \param  table  EC_POINT_TABLE object
+ *  \return 1 on success and 0 if an error occurred
+ */
+int EC_POINT_TABLE_up_ref(EC_POINT_TABLE *table);
+
+/** Returns the point of an EC_POINT_TABLE object
+ *  \param  table  EC_POINT_TABLE object
+ *  \return the EC_POINT the table was created for
+ */
+const EC_POINT *EC_POINT_TABLE_get0_point(const EC_POINT_TABLE *table);
+
+/** Computes r = generator * n + q * m where q is the point of the table.
+ *  Runs in variable time, so only for public scalars as in verification.
+ *  \param  group  underlying EC_GROUP object
+ *  \param  r      EC_POINT object for the result
+ *  \param  n      BIGNUM with the multiplier for the group generator (optional)
+ *  \param  table  EC_POINT_TABLE object of q
+ *  \param  m      BIGNUM with the multiplier for q
+ *  \param  ctx    BN_CTX object (optional)
+ *  \return 1 on success and 0 if an error occured
+ */
+int EC_POINT_mul_table(const EC_GROUP *group, EC_POINT *r, const BIGNUM *n,
+                       const EC_POINT_TABLE *table, const BIGNUM *m,
+                       BN_CTX *ctx);
+
 /********************************************************************/
 /*                       ASN1 stuff                                 */
 /********************************************************************/
@@ -1243,6 +1286,16 @@ void ERR_load_EC_strings(void);
 # define EC_F_PKEY_SM2_DERIVE				  316
 # define EC_F_PKEY_SM2_CTRL				  317
 # define EC_F_PKEY_SM2_CTRL_STR				  318
+# define EC_F_ECP_SM2Z256_GET_AFFINE			  319
+# define EC_F_ECP_SM2Z256_MULT_PRECOMPUTE		  323
+# define EC_F_ECP_SM2Z256_MUL_TABLE			  328
+# define EC_F_ECP_SM2Z256_POINTS_MUL			  320
+# define EC_F_ECP_SM2Z256_POINT_TABLE_NEW		  327
+# define EC_F_ECP_SM2Z256_PRE_COMP_NEW			  324
+# define EC_F_ECP_SM2Z256_SET_WORDS			  321
+# define EC_F_ECP_SM2Z256_WINDOWED_MUL			  322
+# define EC_F_EC_POINT_MUL_TABLE				  326
+# define EC_F_EC_POINT_TABLE_NEW				  325
 # endif
 
 /* Reason codes. */
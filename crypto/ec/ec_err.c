@@ -259,6 +259,18 @@ static ERR_STRING_DATA EC_str_functs[] = {
     {ERR_FUNC(EC_F_PKEY_SM2_SIGN), "PKEY_SM2_SIGN"},
     {ERR_FUNC(EC_F_PKEY_SM2_ENCRYPT), "PKEY_SM2_ENCRYPT"},
     {ERR_FUNC(EC_F_PKEY_SM2_DECRYPT), "PKEY_SM2_DECRYPT"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_GET_AFFINE), "ecp_sm2z256_get_affine"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_MULT_PRECOMPUTE),
+     "ecp_sm2z256_mult_precompute"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_MUL_TABLE), "ecp_sm2z256_mul_table"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_POINTS_MUL), "ecp_sm2z256_points_mul"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_POINT_TABLE_NEW),
+     "ecp_sm2z256_point_table_new"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_PRE_COMP_NEW), "ecp_sm2z256_pre_comp_new"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_SET_WORDS), "ecp_sm2z256_set_words"},
+    {ERR_FUNC(EC_F_ECP_SM2Z256_WINDOWED_MUL), "ecp_sm2z256_windowed_mul"},
+    {ERR_FUNC(EC_F_EC_POINT_MUL_TABLE), "EC_POINT_mul_table"},
+    {ERR_FUNC(EC_F_EC_POINT_TABLE_NEW), "EC_POINT_TABLE_new"},
     {0, NULL}
 };
 
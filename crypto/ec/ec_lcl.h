@@ -196,6 +196,14 @@ struct ec_method_st {
     int (*field_decode) (const EC_GROUP *, BIGNUM *r, const BIGNUM *a,
                          BN_CTX *);
     int (*field_set_to_one) (const EC_GROUP *, BIGNUM *r, BN_CTX *);
+    /*
+     * used by EC_POINT_TABLE_new, EC_POINT_TABLE_free, EC_POINT_mul_table
+     * (EC_POINT_mul is used if 'point_table_new' is 0):
+     */
+    void *(*point_table_new) (const EC_GROUP *, const EC_POINT *, BN_CTX *);
+    void (*point_table_free) (void *);
+    int (*mul_table) (const EC_GROUP *, EC_POINT *r, const BIGNUM *scalar,
+                      const void *table, const BIGNUM *p_scalar, BN_CTX *);
 } /* EC_METHOD */ ;
 
 typedef struct ec_extra_data_st {
@@ -310,6 +318,13 @@ struct ec_point_st {
                                  * special case */
 } /* EC_POINT */ ;
 
+struct ec_point_table_st {
+    const EC_METHOD *meth;
+    EC_POINT *point;            /* the point the table is for */
+    void *data;                 /* method specific multiples of point */
+    int references;
+} /* EC_POINT_TABLE */ ;
+
 /*
  * method functions in ec_mult.c (ec_lib.c uses these as defaults if
  * group->method->mul is 0)
@@ -559,6 +574,16 @@ int ec_precompute_mont_data(EC_GROUP *);
 const EC_METHOD *EC_GFp_nistz256_method(void);
 #endif
 
+#if !defined(OPENSSL_NO_SM2) && !defined(OPENSSL_NO_SM2Z256) && \
+    defined(SIXTY_FOUR_BIT_LONG) && defined(__SIZEOF_INT128__)
+# define ECP_SM2Z256
+/** Returns GFp methods using montgomery multiplication, with 64-bit limb
+ * arithmetic specialised to the SM2 prime of sm2p256v1.
+ *  \return  EC_METHOD object
+ */
+const EC_METHOD *EC_GFp_sm2z256_method(void);
+#endif
+
 #ifdef OPENSSL_FIPS
 EC_GROUP *FIPS_ec_group_new_curve_gfp(const BIGNUM *p, const BIGNUM *a,
                                       const BIGNUM *b, BN_CTX *ctx);
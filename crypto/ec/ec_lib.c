@@ -1094,6 +1094,85 @@ int EC_GROUP_have_precompute_mult(const EC_GROUP *group)
                                  * been performed */
 }
 
+EC_POINT_TABLE *EC_POINT_TABLE_new(const EC_GROUP *group,
+                                   const EC_POINT *point, BN_CTX *ctx)
+{
+    EC_POINT_TABLE *ret;
+
+    if (group->meth != point->meth) {
+        ECerr(EC_F_EC_POINT_TABLE_NEW, EC_R_INCOMPATIBLE_OBJECTS);
+        return NULL;
+    }
+    if (EC_POINT_is_at_infinity(group, point)) {
+        ECerr(EC_F_EC_POINT_TABLE_NEW, EC_R_POINT_AT_INFINITY);
+        return NULL;
+    }
+
+    ret = OPENSSL_malloc(sizeof *ret);
+    if (ret == NULL) {
+        ECerr(EC_F_EC_POINT_TABLE_NEW, ERR_R_MALLOC_FAILURE);
+        return NULL;
+    }
+    ret->meth = group->meth;
+    ret->data = NULL;
+    ret->references = 1;
+
+    if ((ret->point = EC_POINT_dup(point, group)) == NULL)
+        goto err;
+    if (group->meth->point_table_new != 0 &&
+        (ret->data = group->meth->point_table_new(group, point, ctx)) == NULL)
+        goto err;
+
+    return ret;
+
+ err:
+    EC_POINT_TABLE_free(ret);
+    return NULL;
+}
+
+void EC_POINT_TABLE_free(EC_POINT_TABLE *table)
+{
+    int i;
+
+    if (table == NULL)
+        return;
+
+    i = CRYPTO_add(&table->references, -1, CRYPTO_LOCK_EC_PRE_COMP);
+    if (i > 0)
+        return;
+
+    if (table->data != NULL)
+        table->meth->point_table_free(table->data);
+    if (table->point != NULL)
+        EC_POINT_free(table->point);
+    OPENSSL_free(table);
+}
+
+int EC_POINT_TABLE_up_ref(EC_POINT_TABLE *table)
+{
+    return CRYPTO_add(&table->references, 1, CRYPTO_LOCK_EC_PRE_COMP) > 1;
+}
+
+const EC_POINT *EC_POINT_TABLE_get0_point(const EC_POINT_TABLE *table)
+{
+    return table->point;
+}
+
+int EC_POINT_mul_table(const EC_GROUP *group, EC_POINT *r, const BIGNUM *n,
+                       const EC_POINT_TABLE *table, const BIGNUM *m,
+                       BN_CTX *ctx)
+{
+    if (group->meth != table->meth || group->meth != r->meth) {
+        ECerr(EC_F_EC_POINT_MUL_TABLE, EC_R_INCOMPATIBLE_OBJECTS);
+        return 0;
+    }
+
+    if (table->data == NULL)
+        return EC_POINT_mul(group, r, n, table->point, m, ctx);
+
+    return group->meth->mul_table(group, r, n, table->data, m, ctx);
+}
+
 /*
  * ec_precompute_mont_data sets |group->mont_data| from |group->order| and
  * returns one on success. On error it returns zero.
@@ -0,0 +1,1742 @@
+/* crypto/ec/ecp_sm2z256.c */
+/* ====================================================================
+ * Copyright (c) 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ */
+
+/*
+ * The SM2 curve sm2p256v1 with 4x64-bit limbs, following ecp_nistz256.c.
+ * Field elements are kept in the Montgomery domain of the ec_GFp_mont
+ * methods (R = 2^256), so the coordinates of an EC_POINT can be used as
+ * they are. The SM2 prime is p = 2^256 - 2^224 - 2^96 + 2^64 - 1, as
+ * p = -1 mod 2^64 the Montgomery reduction needs no multiplication to find
+ * the quotient digit, and like P-256 the curve has a = -3.
+ */
+
+#include <string.h>
+#include <openssl/bn.h>
+#include <openssl/err.h>
+#include <openssl/ec.h>
+#include "cryptlib.h"
+#include "ec_lcl.h"
+
+#ifdef ECP_SM2Z256
+
+typedef __uint128_t u128;
+
+# define TOBN(hi,lo)    ((BN_ULONG)hi<<32|lo)
+
+# if defined(__GNUC__)
+#  define ALIGN32       __attribute((aligned(32)))
+# else
+#  define ALIGN32
+# endif
+
+# define ALIGNPTR(p,N)  ((unsigned char *)p+N-(size_t)p%N)
+# define P256_LIMBS     (256/BN_BITS2)
+
+typedef struct {
+    BN_ULONG X[P256_LIMBS];
+    BN_ULONG Y[P256_LIMBS];
+    BN_ULONG Z[P256_LIMBS];
+} P256_POINT;
+
+typedef struct {
+    BN_ULONG X[P256_LIMBS];
+    BN_ULONG Y[P256_LIMBS];
+} P256_POINT_AFFINE;
+
+typedef P256_POINT_AFFINE PRECOMP256_ROW[64];
+
+/* structure for precomputed multiples of the generator */
+typedef struct ec_pre_comp_st {
+    const EC_GROUP *group;      /* Parent EC_GROUP object */
+    size_t w;                   /* Window size */
+    /*
+     * Constant time access to the X and Y coordinates of the pre-computed,
+     * generator multiplies, in the Montgomery domain. Pre-calculated
+     * multiplies are stored in affine form.
+     */
+    PRECOMP256_ROW *precomp;
+    void *precomp_storage;
+    int references;
+} EC_PRE_COMP;
+
+/* The SM2 prime */
+static const BN_ULONG P[P256_LIMBS] = {
+    TOBN(0xffffffff, 0xffffffff), TOBN(0xffffffff, 0x00000000),
+    TOBN(0xffffffff, 0xffffffff), TOBN(0xfffffffe, 0xffffffff)
+};
+
+/* One converted into the Montgomery domain */
+static const BN_ULONG ONE[P256_LIMBS] = {
+    TOBN(0x00000000, 0x00000001), TOBN(0x00000000, 0xffffffff),
+    TOBN(0x00000000, 0x00000000), TOBN(0x00000001, 0x00000000)
+};
+
+static void *sm2z256_pre_comp_dup(void *);
+static void sm2z256_pre_comp_free(void *);
+static void sm2z256_pre_comp_clear_free(void *);
+static EC_PRE_COMP *sm2z256_pre_comp_new(const EC_GROUP *group);
+
+/* Precomputed tables for the default generator */
+#include "ecp_sm2z256_table.c"
+
+/*
+ * r = a - p if that does not borrow, else a, where a is the 257-bit
+ * value (carry, a[])
+ */
+static void sm2z256_reduce_once(BN_ULONG r[P256_LIMBS],
+                                const BN_ULONG a[P256_LIMBS], BN_ULONG carry)
+{
+    BN_ULONG t[P256_LIMBS], mask;
+    u128 c = 0;
+    int i;
+
+    for (i = 0; i < P256_LIMBS; i++) {
+        c = (u128)a[i] - P[i] - (BN_ULONG)(c >> 64 & 1);
+        t[i] = (BN_ULONG)c;
+    }
+    /* the borrow is cancelled by the carry if there is one */
+    mask = (BN_ULONG)0 - ((BN_ULONG)(c >> 64 & 1) & ~carry);
+    for (i = 0; i < P256_LIMBS; i++)
+        r[i] = (a[i] & mask) | (t[i] & ~mask);
+}
+
+/* Modular add: res = a+b mod P */
+static void sm2z256_add(BN_ULONG res[P256_LIMBS],
+                        const BN_ULONG a[P256_LIMBS],
+                        const BN_ULONG b[P256_LIMBS])
+{
+    BN_ULONG t[P256_LIMBS];
+    u128 c = 0;
+    int i;
+
+    for (i = 0; i < P256_LIMBS; i++) {
+        c = (u128)a[i] + b[i] + (BN_ULONG)(c >> 64);
+        t[i] = (BN_ULONG)c;
+    }
+    sm2z256_reduce_once(res, t, (BN_ULONG)(c >> 64));
+}
+
+/* Modular sub: res = a-b mod P */
+static void sm2z256_sub(BN_ULONG res[P256_LIMBS],
+                        const BN_ULONG a[P256_LIMBS],
+                        const BN_ULONG b[P256_LIMBS])
+{
+    BN_ULONG t[P256_LIMBS], mask;
+    u128 c = 0;
+    int i;
+
+    for (i = 0; i < P256_LIMBS; i++) {
+        c = (u128)a[i] - b[i] - (BN_ULONG)(c >> 64 & 1);
+        t[i] = (BN_ULONG)c;
+    }
+    /* add p back on a borrow */
+    mask = (BN_ULONG)0 - (BN_ULONG)(c >> 64 & 1);
+    c = 0;
+    for (i = 0; i < P256_LIMBS; i++) {
+        c = (u128)t[i] + (P[i] & mask) + (BN_ULONG)(c >> 64);
+        res[i] = (BN_ULONG)c;
+    }
+}
+
+/* Modular neg: res = -a mod P */
+static void sm2z256_neg(BN_ULONG res[P256_LIMBS], const BN_ULONG a[P256_LIMBS])
+{
+    static const BN_ULONG zero[P256_LIMBS] = { 0 };
+
+    sm2z256_sub(res, zero, a);
+}
+
+/* Modular mul by 2: res = 2*a mod P */
+static void sm2z256_mul_by_2(BN_ULONG res[P256_LIMBS],
+                             const BN_ULONG a[P256_LIMBS])
+{
+    sm2z256_add(res, a, a);
+}
+
+/* Modular mul by 3: res = 3*a mod P */
+static void sm2z256_mul_by_3(BN_ULONG res[P256_LIMBS],
+                             const BN_ULONG a[P256_LIMBS])
+{
+    BN_ULONG t[P256_LIMBS];
+
+    sm2z256_add(t, a, a);
+    sm2z256_add(res, t, a);
+}
+
+/* Modular div by 2: res = a/2 mod P */
+static void sm2z256_div_by_2(BN_ULONG res[P256_LIMBS],
+                             const BN_ULONG a[P256_LIMBS])
+{
+    BN_ULONG t[P256_LIMBS], mask = (BN_ULONG)0 - (a[0] & 1), top;
+    u128 c = 0;
+    int i;
+
+    /* make a even by adding p, then shift the 257-bit sum */
+    for (i = 0; i < P256_LIMBS; i++) {
+        c = (u128)a[i] + (P[i] & mask) + (BN_ULONG)(c >> 64);
+        t[i] = (BN_ULONG)c;
+    }
+    top = (BN_ULONG)(c >> 64);
+    for (i = 0; i < P256_LIMBS - 1; i++)
+        res[i] = (t[i] >> 1) | (t[i + 1] << 63);
+    res[P256_LIMBS - 1] = (t[P256_LIMBS - 1] >> 1) | (top << 63);
+}
+
+/*
+ * res = t*2^-256 mod P for the 512-bit t, which is overwritten. As
+ * -P^-1 = 1 mod 2^64 the quotient digit of each step is the low limb.
+ */
+static void sm2z256_mont_reduce(BN_ULONG res[P256_LIMBS],
+                                BN_ULONG t[2 * P256_LIMBS])
+{
+    BN_ULONG m, top = 0;
+    u128 c;
+    int i, j;
+
+    for (i = 0; i < P256_LIMBS; i++) {
+        m = t[i];
+        c = ((u128)m * P[0] + t[i]) >> 64;
+        for (j = 1; j < P256_LIMBS; j++) {
+            c += (u128)m * P[j] + t[i + j];
+            t[i + j] = (BN_ULONG)c;
+            c >>= 64;
+        }
+        c += (u128)t[i + P256_LIMBS] + top;
+        t[i + P256_LIMBS] = (BN_ULONG)c;
+        top = (BN_ULONG)(c >> 64);
+    }
+    sm2z256_reduce_once(res, t + P256_LIMBS, top);
+}
+
+/* Montgomery mul: res = a*b*2^-256 mod P */
+static void sm2z256_mul_mont(BN_ULONG res[P256_LIMBS],
+                             const BN_ULONG a[P256_LIMBS],
+                             const BN_ULONG b[P256_LIMBS])
+{
+    BN_ULONG t[2 * P256_LIMBS];
+    u128 c;
+    int i, j;
+
+    for (i = 0; i < P256_LIMBS; i++) {
+        c = 0;
+        for (j = 0; j < P256_LIMBS; j++) {
+            c += (u128)a[j] * b[i] + (i == 0 ? 0 : t[i + j]);
+            t[i + j] = (BN_ULONG)c;
+            c >>= 64;
+        }
+        t[i + P256_LIMBS] = (BN_ULONG)c;
+    }
+    sm2z256_mont_reduce(res, t);
+}
+
+/* Montgomery sqr: res = a*a*2^-256 mod P */
+static void sm2z256_sqr_mont(BN_ULONG res[P256_LIMBS],
+                             const BN_ULONG a[P256_LIMBS])
+{
+    BN_ULONG t[2 * P256_LIMBS], hi;
+    u128 c;
+    int i, j;
+
+    /* the cross products a[i]*a[j], i < j */
+    t[0] = 0;
+    t[2 * P256_LIMBS - 1] = 0;
+    for (i = 0; i < P256_LIMBS - 1; i++) {
+        c = 0;
+        for (j = i + 1; j < P256_LIMBS; j++) {
+            c += (u128)a[i] * a[j] + (i == 0 ? 0 : t[i + j]);
+            t[i + j] = (BN_ULONG)c;
+            c >>= 64;
+        }
+        t[i + P256_LIMBS] = (BN_ULONG)c;
+    }
+
+    /* doubled, plus the squares */
+    hi = 0;
+    c = 0;
+    for (i = 0; i < P256_LIMBS; i++) {
+        u128 sq = (u128)a[i] * a[i];
+        BN_ULONG lo = t[2 * i], up = t[2 * i + 1];
+
+        c += (u128)(lo << 1 | hi) + (BN_ULONG)sq;
+        t[2 * i] = (BN_ULONG)c;
+        c >>= 64;
+        hi = lo >> 63;
+        c += (u128)(up << 1 | hi) + (BN_ULONG)(sq >> 64);
+        t[2 * i + 1] = (BN_ULONG)c;
+        c >>= 64;
+        hi = up >> 63;
+    }
+    sm2z256_mont_reduce(res, t);
+}
+
+/* Convert a number from Montgomery domain, by multiplying with 1 */
+static void sm2z256_from_mont(BN_ULONG res[P256_LIMBS],
+                              const BN_ULONG in[P256_LIMBS])
+{
+    static const BN_ULONG one[P256_LIMBS] = { 1 };
+
+    sm2z256_mul_mont(res, in, one);
+}
+
+static void copy_conditional(BN_ULONG dst[P256_LIMBS],
+                             const BN_ULONG src[P256_LIMBS], BN_ULONG move)
+{
+    BN_ULONG mask1 = -move;
+    BN_ULONG mask2 = ~mask1;
+
+    dst[0] = (src[0] & mask1) ^ (dst[0] & mask2);
+    dst[1] = (src[1] & mask1) ^ (dst[1] & mask2);
+    dst[2] = (src[2] & mask1) ^ (dst[2] & mask2);
+    dst[3] = (src[3] & mask1) ^ (dst[3] & mask2);
+}
+
+static BN_ULONG is_zero(BN_ULONG in)
+{
+    in |= (0 - in);
+    in = ~in;
+    in &= BN_MASK2;
+    in >>= BN_BITS2 - 1;
+    return in;
+}
+
+static BN_ULONG is_equal(const BN_ULONG a[P256_LIMBS],
+                         const BN_ULONG b[P256_LIMBS])
+{
+    BN_ULONG res;
+
+    res = a[0] ^ b[0];
+    res |= a[1] ^ b[1];
+    res |= a[2] ^ b[2];
+    res |= a[3] ^ b[3];
+
+    return is_zero(res);
+}
+
+static BN_ULONG is_one(const BN_ULONG a[P256_LIMBS])
+{
+    return is_equal(a, ONE);
+}
+
+/* Constant time access to the table of 16 points, index 0 is infinity */
+static void sm2z256_select_w5(P256_POINT *val, const P256_POINT *in_t,
+                              int index)
+{
+    int i;
+
+    memset(val, 0, sizeof(*val));
+    for (i = 0; i < 16; i++) {
+        BN_ULONG move = is_zero((BN_ULONG)(i + 1) ^ (BN_ULONG)index);
+
+        copy_conditional(val->X, in_t[i].X, move);
+        copy_conditional(val->Y, in_t[i].Y, move);
+        copy_conditional(val->Z, in_t[i].Z, move);
+    }
+}
+
+/* Constant time access to a row of 64 affine points, index 0 is infinity */
+static void sm2z256_select_w7(P256_POINT_AFFINE *val,
+                              const P256_POINT_AFFINE *in_t, int index)
+{
+    int i;
+
+    memset(val, 0, sizeof(*val));
+    for (i = 0; i < 64; i++) {
+        BN_ULONG move = is_zero((BN_ULONG)(i + 1) ^ (BN_ULONG)index);
+
+        copy_conditional(val->X, in_t[i].X, move);
+        copy_conditional(val->Y, in_t[i].Y, move);
+    }
+}
+
+/* Recode window to a signed digit, see ecp_nistputil.c for details */
+static unsigned int _booth_recode_w5(unsigned int in)
+{
+    unsigned int s, d;
+
+    s = ~((in >> 5) - 1);
+    d = (1 << 6) - in - 1;
+    d = (d & s) | (in & ~s);
+    d = (d >> 1) + (d & 1);
+
+    return (d << 1) + (s & 1);
+}
+
+static unsigned int _booth_recode_w7(unsigned int in)
+{
+    unsigned int s, d;
+
+    s = ~((in >> 7) - 1);
+    d = (1 << 8) - in - 1;
+    d = (d & s) | (in & ~s);
+    d = (d >> 1) + (d & 1);
+
+    return (d << 1) + (s & 1);
+}
+
+static int sm2z256_set_words(BIGNUM *a, BN_ULONG words[P256_LIMBS])
+{
+    if (bn_wexpand(a, P256_LIMBS) == NULL) {
+        ECerr(EC_F_ECP_SM2Z256_SET_WORDS, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    memcpy(a->d, words, sizeof(BN_ULONG) * P256_LIMBS);
+    a->top = P256_LIMBS;
+    bn_correct_top(a);
+    return 1;
+}
+
+/* Point double: r = 2*a */
+static void sm2z256_point_double(P256_POINT *r, const P256_POINT *a)
+{
+    BN_ULONG S[P256_LIMBS];
+    BN_ULONG M[P256_LIMBS];
+    BN_ULONG Zsqr[P256_LIMBS];
+    BN_ULONG tmp0[P256_LIMBS];
+
+    const BN_ULONG *in_x = a->X;
+    const BN_ULONG *in_y = a->Y;
+    const BN_ULONG *in_z = a->Z;
+
+    BN_ULONG *res_x = r->X;
+    BN_ULONG *res_y = r->Y;
+    BN_ULONG *res_z = r->Z;
+
+    sm2z256_mul_by_2(S, in_y);
+
+    sm2z256_sqr_mont(Zsqr, in_z);
+
+    sm2z256_sqr_mont(S, S);
+
+    sm2z256_mul_mont(res_z, in_z, in_y);
+    sm2z256_mul_by_2(res_z, res_z);
+
+    sm2z256_add(M, in_x, Zsqr);
+    sm2z256_sub(Zsqr, in_x, Zsqr);
+
+    sm2z256_sqr_mont(res_y, S);
+    sm2z256_div_by_2(res_y, res_y);
+
+    sm2z256_mul_mont(M, M, Zsqr);
+    sm2z256_mul_by_3(M, M);
+
+    sm2z256_mul_mont(S, S, in_x);
+    sm2z256_mul_by_2(tmp0, S);
+
+    sm2z256_sqr_mont(res_x, M);
+
+    sm2z256_sub(res_x, res_x, tmp0);
+    sm2z256_sub(S, S, res_x);
+
+    sm2z256_mul_mont(S, S, M);
+    sm2z256_sub(res_y, S, res_y);
+}
+
+/* Point addition: r = a+b */
+static void sm2z256_point_add(P256_POINT *r,
+                              const P256_POINT *a, const P256_POINT *b)
+{
+    BN_ULONG U2[P256_LIMBS], S2[P256_LIMBS];
+    BN_ULONG U1[P256_LIMBS], S1[P256_LIMBS];
+    BN_ULONG Z1sqr[P256_LIMBS];
+    BN_ULONG Z2sqr[P256_LIMBS];
+    BN_ULONG H[P256_LIMBS], R[P256_LIMBS];
+    BN_ULONG Hsqr[P256_LIMBS];
+    BN_ULONG Rsqr[P256_LIMBS];
+    BN_ULONG Hcub[P256_LIMBS];
+
+    BN_ULONG res_x[P256_LIMBS];
+    BN_ULONG res_y[P256_LIMBS];
+    BN_ULONG res_z[P256_LIMBS];
+
+    BN_ULONG in1infty, in2infty;
+
+    const BN_ULONG *in1_x = a->X;
+    const BN_ULONG *in1_y = a->Y;
+    const BN_ULONG *in1_z = a->Z;
+
+    const BN_ULONG *in2_x = b->X;
+    const BN_ULONG *in2_y = b->Y;
+    const BN_ULONG *in2_z = b->Z;
+
+    /* We encode infinity as (0,0), which is not on the curve,
+     * so it is OK. */
+    in1infty = (in1_x[0] | in1_x[1] | in1_x[2] | in1_x[3] |
+                in1_y[0] | in1_y[1] | in1_y[2] | in1_y[3]);
+    in2infty = (in2_x[0] | in2_x[1] | in2_x[2] | in2_x[3] |
+                in2_y[0] | in2_y[1] | in2_y[2] | in2_y[3]);
+
+    in1infty = is_zero(in1infty);
+    in2infty = is_zero(in2infty);
+
+    sm2z256_sqr_mont(Z2sqr, in2_z);             /* Z2^2 */
+    sm2z256_sqr_mont(Z1sqr, in1_z);             /* Z1^2 */
+
+    sm2z256_mul_mont(S1, Z2sqr, in2_z);         /* S1 = Z2^3 */
+    sm2z256_mul_mont(S2, Z1sqr, in1_z);         /* S2 = Z1^3 */
+
+    sm2z256_mul_mont(S1, S1, in1_y);            /* S1 = Y1*Z2^3 */
+    sm2z256_mul_mont(S2, S2, in2_y);            /* S2 = Y2*Z1^3 */
+    sm2z256_sub(R, S2, S1);                     /* R = S2 - S1 */
+
+    sm2z256_mul_mont(U1, in1_x, Z2sqr);         /* U1 = X1*Z2^2 */
+    sm2z256_mul_mont(U2, in2_x, Z1sqr);         /* U2 = X2*Z1^2 */
+    sm2z256_sub(H, U2, U1);                     /* H = U2 - U1 */
+
+    /*
+     * This should not happen during sign/ecdh, so no constant time violation
+     */
+    if (is_equal(U1, U2) && !in1infty && !in2infty) {
+        if (is_equal(S1, S2)) {
+            sm2z256_point_double(r, a);
+            return;
+        } else {
+            memset(r, 0, sizeof(*r));
+            return;
+        }
+    }
+
+    sm2z256_sqr_mont(Rsqr, R);                  /* R^2 */
+    sm2z256_mul_mont(res_z, H, in1_z);          /* Z3 = H*Z1*Z2 */
+    sm2z256_sqr_mont(Hsqr, H);                  /* H^2 */
+    sm2z256_mul_mont(res_z, res_z, in2_z);      /* Z3 = H*Z1*Z2 */
+    sm2z256_mul_mont(Hcub, Hsqr, H);            /* H^3 */
+
+    sm2z256_mul_mont(U2, U1, Hsqr);             /* U1*H^2 */
+    sm2z256_mul_by_2(Hsqr, U2);                 /* 2*U1*H^2 */
+
+    sm2z256_sub(res_x, Rsqr, Hsqr);
+    sm2z256_sub(res_x, res_x, Hcub);
+
+    sm2z256_sub(res_y, U2, res_x);
+
+    sm2z256_mul_mont(S2, S1, Hcub);
+    sm2z256_mul_mont(res_y, R, res_y);
+    sm2z256_sub(res_y, res_y, S2);
+
+    copy_conditional(res_x, in2_x, in1infty);
+    copy_conditional(res_y, in2_y, in1infty);
+    copy_conditional(res_z, in2_z, in1infty);
+
+    copy_conditional(res_x, in1_x, in2infty);
+    copy_conditional(res_y, in1_y, in2infty);
+    copy_conditional(res_z, in1_z, in2infty);
+
+    memcpy(r->X, res_x, sizeof(res_x));
+    memcpy(r->Y, res_y, sizeof(res_y));
+    memcpy(r->Z, res_z, sizeof(res_z));
+}
+
+/* Point addition when b is known to be affine: r = a+b */
+static void sm2z256_point_add_affine(P256_POINT *r,
+                                     const P256_POINT *a,
+                                     const P256_POINT_AFFINE *b)
+{
+    BN_ULONG U2[P256_LIMBS], S2[P256_LIMBS];
+    BN_ULONG Z1sqr[P256_LIMBS];
+    BN_ULONG H[P256_LIMBS], R[P256_LIMBS];
+    BN_ULONG Hsqr[P256_LIMBS];
+    BN_ULONG Rsqr[P256_LIMBS];
+    BN_ULONG Hcub[P256_LIMBS];
+
+    BN_ULONG res_x[P256_LIMBS];
+    BN_ULONG res_y[P256_LIMBS];
+    BN_ULONG res_z[P256_LIMBS];
+
+    BN_ULONG in1infty, in2infty;
+
+    const BN_ULONG *in1_x = a->X;
+    const BN_ULONG *in1_y = a->Y;
+    const BN_ULONG *in1_z = a->Z;
+
+    const BN_ULONG *in2_x = b->X;
+    const BN_ULONG *in2_y = b->Y;
+
+    /*
+     * In affine representation we encode infty as (0,0), which is not on the
+     * curve, so it is OK
+     */
+    in1infty = (in1_x[0] | in1_x[1] | in1_x[2] | in1_x[3] |
+                in1_y[0] | in1_y[1] | in1_y[2] | in1_y[3]);
+    in2infty = (in2_x[0] | in2_x[1] | in2_x[2] | in2_x[3] |
+                in2_y[0] | in2_y[1] | in2_y[2] | in2_y[3]);
+
+    in1infty = is_zero(in1infty);
+    in2infty = is_zero(in2infty);
+
+    sm2z256_sqr_mont(Z1sqr, in1_z);             /* Z1^2 */
+
+    sm2z256_mul_mont(U2, in2_x, Z1sqr);         /* U2 = X2*Z1^2 */
+    sm2z256_sub(H, U2, in1_x);                  /* H = U2 - U1 */
+
+    sm2z256_mul_mont(S2, Z1sqr, in1_z);         /* S2 = Z1^3 */
+
+    sm2z256_mul_mont(res_z, H, in1_z);          /* Z3 = H*Z1*Z2 */
+
+    sm2z256_mul_mont(S2, S2, in2_y);            /* S2 = Y2*Z1^3 */
+    sm2z256_sub(R, S2, in1_y);                  /* R = S2 - S1 */
+
+    /* a = b is not handled by the formulas below, see point_add */
+    if (is_zero(H[0] | H[1] | H[2] | H[3]) && !in1infty && !in2infty) {
+        P256_POINT t;
+
+        if (is_zero(R[0] | R[1] | R[2] | R[3])) {
+            memcpy(t.X, in2_x, sizeof(t.X));
+            memcpy(t.Y, in2_y, sizeof(t.Y));
+            memcpy(t.Z, ONE, sizeof(t.Z));
+            sm2z256_point_double(r, &t);
+        } else
+            memset(r, 0, sizeof(*r));
+        return;
+    }
+
+    sm2z256_sqr_mont(Hsqr, H);                  /* H^2 */
+    sm2z256_sqr_mont(Rsqr, R);                  /* R^2 */
+    sm2z256_mul_mont(Hcub, Hsqr, H);            /* H^3 */
+
+    sm2z256_mul_mont(U2, in1_x, Hsqr);          /* U1*H^2 */
+    sm2z256_mul_by_2(Hsqr, U2);                 /* 2*U1*H^2 */
+
+    sm2z256_sub(res_x, Rsqr, Hsqr);
+    sm2z256_sub(res_x, res_x, Hcub);
+    sm2z256_sub(H, U2, res_x);
+
+    sm2z256_mul_mont(S2, in1_y, Hcub);
+    sm2z256_mul_mont(H, H, R);
+    sm2z256_sub(res_y, H, S2);
+
+    copy_conditional(res_x, in2_x, in1infty);
+    copy_conditional(res_x, in1_x, in2infty);
+
+    copy_conditional(res_y, in2_y, in1infty);
+    copy_conditional(res_y, in1_y, in2infty);
+
+    copy_conditional(res_z, ONE, in1infty);
+    copy_conditional(res_z, in1_z, in2infty);
+
+    memcpy(r->X, res_x, sizeof(res_x));
+    memcpy(r->Y, res_y, sizeof(res_y));
+    memcpy(r->Z, res_z, sizeof(res_z));
+}
+
+
+/* r = in^-1 mod p */
+static void sm2z256_mod_inverse(BN_ULONG r[P256_LIMBS],
+                                const BN_ULONG in[P256_LIMBS])
+{
+    /*
+     * The exponent p-2 is fffffffe ffffffff ffffffff ffffffff ffffffff
+     * 00000000 ffffffff fffffffd, x_k below is in^(2^k-1)
+     */
+    BN_ULONG x2[P256_LIMBS];
+    BN_ULONG x3[P256_LIMBS];
+    BN_ULONG x6[P256_LIMBS];
+    BN_ULONG x12[P256_LIMBS];
+    BN_ULONG x15[P256_LIMBS];
+    BN_ULONG x30[P256_LIMBS];
+    BN_ULONG x32[P256_LIMBS];
+    BN_ULONG res[P256_LIMBS];
+    int i;
+
+    sm2z256_sqr_mont(res, in);
+    sm2z256_mul_mont(x2, res, in);
+
+    sm2z256_sqr_mont(res, x2);
+    sm2z256_mul_mont(x3, res, in);
+
+    sm2z256_sqr_mont(res, x3);
+    for (i = 0; i < 2; i++)
+        sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(x6, res, x3);
+
+    sm2z256_sqr_mont(res, x6);
+    for (i = 0; i < 5; i++)
+        sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(x12, res, x6);
+
+    sm2z256_sqr_mont(res, x12);
+    for (i = 0; i < 2; i++)
+        sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(x15, res, x3);
+
+    sm2z256_sqr_mont(res, x15);
+    for (i = 0; i < 14; i++)
+        sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(x30, res, x15);
+
+    sm2z256_sqr_mont(res, x30);
+    sm2z256_mul_mont(res, res, in);             /* x31 */
+    sm2z256_sqr_mont(x32, res);
+    sm2z256_mul_mont(x32, x32, in);
+
+    /* fffffffe */
+    sm2z256_sqr_mont(res, res);
+
+    /* ffffffff ffffffff ffffffff ffffffff */
+    for (i = 0; i < 4; i++) {
+        int j;
+
+        for (j = 0; j < 32; j++)
+            sm2z256_sqr_mont(res, res);
+        sm2z256_mul_mont(res, res, x32);
+    }
+
+    /* 00000000 */
+    for (i = 0; i < 32; i++)
+        sm2z256_sqr_mont(res, res);
+
+    /* ffffffff */
+    for (i = 0; i < 32; i++)
+        sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(res, res, x32);
+
+    /* fffffffd */
+    for (i = 0; i < 30; i++)
+        sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(res, res, x30);
+    sm2z256_sqr_mont(res, res);
+    sm2z256_sqr_mont(res, res);
+    sm2z256_mul_mont(res, res, in);
+
+    memcpy(r, res, sizeof(res));
+}
+
+/*
+ * sm2z256_bignum_to_field_elem copies the contents of |in| to |out| and
+ * returns one if it fits. Otherwise it returns zero.
+ */
+static int sm2z256_bignum_to_field_elem(BN_ULONG out[P256_LIMBS],
+                                        const BIGNUM *in)
+{
+    if (in->top > P256_LIMBS)
+        return 0;
+
+    memset(out, 0, sizeof(BN_ULONG) * P256_LIMBS);
+    memcpy(out, in->d, sizeof(BN_ULONG) * in->top);
+    return 1;
+}
+
+/*
+ * Writes the little-endian bytes of the scalar, reduced mod the order if
+ * it is out of range, to p_str[33]
+ */
+static int sm2z256_scalar_to_bytes(unsigned char p_str[33],
+                                   const EC_GROUP *group,
+                                   const BIGNUM *scalar, BN_CTX *ctx)
+{
+    int i;
+
+    /* This is an unusual input, we don't guarantee constant-timeness. */
+    if ((BN_num_bits(scalar) > 256) || BN_is_negative(scalar)) {
+        BIGNUM *mod;
+
+        if ((mod = BN_CTX_get(ctx)) == NULL)
+            return 0;
+        if (!BN_nnmod(mod, scalar, &group->order, ctx)) {
+            ECerr(EC_F_ECP_SM2Z256_WINDOWED_MUL, ERR_R_BN_LIB);
+            return 0;
+        }
+        scalar = mod;
+    }
+
+    for (i = 0; i < scalar->top * BN_BYTES; i += BN_BYTES) {
+        BN_ULONG d = scalar->d[i / BN_BYTES];
+
+        p_str[i + 0] = d & 0xff;
+        p_str[i + 1] = (d >> 8) & 0xff;
+        p_str[i + 2] = (d >> 16) & 0xff;
+        p_str[i + 3] = (d >> 24) & 0xff;
+        p_str[i + 4] = (d >> 32) & 0xff;
+        p_str[i + 5] = (d >> 40) & 0xff;
+        p_str[i + 6] = (d >> 48) & 0xff;
+        p_str[i + 7] = (d >> 56) & 0xff;
+    }
+    for (; i < 33; i++)
+        p_str[i] = 0;
+    return 1;
+}
+
+/* r = sum(scalar[i]*point[i]) */
+static int sm2z256_windowed_mul(const EC_GROUP *group,
+                                P256_POINT *r,
+                                const BIGNUM **scalar,
+                                const EC_POINT **point,
+                                int num, BN_CTX *ctx)
+{
+    int i, ret = 0;
+    unsigned int index;
+    unsigned char (*p_str)[33] = NULL;
+    const unsigned int window_size = 5;
+    const unsigned int mask = (1 << (window_size + 1)) - 1;
+    unsigned int wvalue;
+    BN_ULONG tmp[P256_LIMBS];
+    ALIGN32 P256_POINT h;
+    P256_POINT (*table)[16] = NULL;
+    void *table_storage = NULL;
+
+    if ((table_storage =
+         OPENSSL_malloc(num * 16 * sizeof(P256_POINT) + 64)) == NULL
+        || (p_str =
+            OPENSSL_malloc(num * 33 * sizeof(unsigned char))) == NULL) {
+        ECerr(EC_F_ECP_SM2Z256_WINDOWED_MUL, ERR_R_MALLOC_FAILURE);
+        goto err;
+    } else {
+        table = (void *)ALIGNPTR(table_storage, 64);
+    }
+
+    for (i = 0; i < num; i++) {
+        P256_POINT *row = table[i];
+
+        if (!sm2z256_scalar_to_bytes(p_str[i], group, scalar[i], ctx))
+            goto err;
+
+        /* table[0] is implicitly (0,0,0) (the point at infinity),
+         * therefore it is not stored. All other values are actually
+         * stored with an offset of -1 in table.
+         */
+
+        if (!sm2z256_bignum_to_field_elem(row[1 - 1].X, &point[i]->X)
+            || !sm2z256_bignum_to_field_elem(row[1 - 1].Y, &point[i]->Y)
+            || !sm2z256_bignum_to_field_elem(row[1 - 1].Z, &point[i]->Z)) {
+            ECerr(EC_F_ECP_SM2Z256_WINDOWED_MUL,
+                  EC_R_COORDINATES_OUT_OF_RANGE);
+            goto err;
+        }
+
+        sm2z256_point_double(&row[ 2 - 1], &row[ 1 - 1]);
+        sm2z256_point_add   (&row[ 3 - 1], &row[ 2 - 1], &row[1 - 1]);
+        sm2z256_point_double(&row[ 4 - 1], &row[ 2 - 1]);
+        sm2z256_point_double(&row[ 6 - 1], &row[ 3 - 1]);
+        sm2z256_point_double(&row[ 8 - 1], &row[ 4 - 1]);
+        sm2z256_point_double(&row[12 - 1], &row[ 6 - 1]);
+        sm2z256_point_add   (&row[ 5 - 1], &row[ 4 - 1], &row[1 - 1]);
+        sm2z256_point_add   (&row[ 7 - 1], &row[ 6 - 1], &row[1 - 1]);
+        sm2z256_point_add   (&row[ 9 - 1], &row[ 8 - 1], &row[1 - 1]);
+        sm2z256_point_add   (&row[13 - 1], &row[12 - 1], &row[1 - 1]);
+        sm2z256_point_double(&row[14 - 1], &row[ 7 - 1]);
+        sm2z256_point_double(&row[10 - 1], &row[ 5 - 1]);
+        sm2z256_point_add   (&row[15 - 1], &row[14 - 1], &row[1 - 1]);
+        sm2z256_point_add   (&row[11 - 1], &row[10 - 1], &row[1 - 1]);
+        sm2z256_point_add   (&row[16 - 1], &row[15 - 1], &row[1 - 1]);
+    }
+
+    index = 255;
+
+    wvalue = p_str[0][(index - 1) / 8];
+    wvalue = (wvalue >> ((index - 1) % 8)) & mask;
+
+    sm2z256_select_w5(r, table[0], _booth_recode_w5(wvalue) >> 1);
+
+    while (index >= 5) {
+        for (i = (index == 255 ? 1 : 0); i < num; i++) {
+            unsigned int off = (index - 1) / 8;
+
+            wvalue = p_str[i][off] | p_str[i][off + 1] << 8;
+            wvalue = (wvalue >> ((index - 1) % 8)) & mask;
+
+            wvalue = _booth_recode_w5(wvalue);
+
+            sm2z256_select_w5(&h, table[i], wvalue >> 1);
+
+            sm2z256_neg(tmp, h.Y);
+            copy_conditional(h.Y, tmp, (wvalue & 1));
+
+            sm2z256_point_add(r, r, &h);
+        }
+
+        index -= window_size;
+
+        sm2z256_point_double(r, r);
+        sm2z256_point_double(r, r);
+        sm2z256_point_double(r, r);
+        sm2z256_point_double(r, r);
+        sm2z256_point_double(r, r);
+    }
+
+    /* Final window */
+    for (i = 0; i < num; i++) {
+        wvalue = p_str[i][0];
+        wvalue = (wvalue << 1) & mask;
+
+        wvalue = _booth_recode_w5(wvalue);
+
+        sm2z256_select_w5(&h, table[i], wvalue >> 1);
+
+        sm2z256_neg(tmp, h.Y);
+        copy_conditional(h.Y, tmp, wvalue & 1);
+
+        sm2z256_point_add(r, r, &h);
+    }
+
+    ret = 1;
+ err:
+    if (table_storage)
+        OPENSSL_free(table_storage);
+    if (p_str)
+        OPENSSL_free(p_str);
+    return ret;
+}
+
+/* Coordinates of G, for which we have precomputed tables */
+const static BN_ULONG def_xG[P256_LIMBS] = {
+    TOBN(0x61328990, 0xf418029e), TOBN(0x3e7981ed, 0xdca6c050),
+    TOBN(0xd6a1ed99, 0xac24c3c3), TOBN(0x91167a5e, 0xe1c13b05)
+};
+
+const static BN_ULONG def_yG[P256_LIMBS] = {
+    TOBN(0xc1354e59, 0x3c2d0ddd), TOBN(0xc1f5e578, 0x8d3295fa),
+    TOBN(0x8d4cfb06, 0x6e2a48f8), TOBN(0x63cd65d4, 0x81d735bd)
+};
+
+/*
+ * sm2z256_is_affine_G returns one if |generator| is the standard SM2
+ * generator.
+ */
+static int sm2z256_is_affine_G(const EC_POINT *generator)
+{
+    return (generator->X.top == P256_LIMBS) &&
+        (generator->Y.top == P256_LIMBS) &&
+        (generator->Z.top == P256_LIMBS) &&
+        is_equal(generator->X.d, def_xG) &&
+        is_equal(generator->Y.d, def_yG) && is_one(generator->Z.d);
+}
+
+static int sm2z256_mult_precompute(EC_GROUP *group, BN_CTX *ctx)
+{
+    /*
+     * We precompute a table for a Booth encoded exponent (wNAF) based
+     * computation. Each table holds 64 values for safe access, with an
+     * implicit value of infinity at index zero. We use window of size 7, and
+     * therefore require ceil(256/7) = 37 tables.
+     */
+    BIGNUM *order;
+    EC_POINT *P = NULL, *T = NULL;
+    const EC_POINT *generator;
+    EC_PRE_COMP *pre_comp;
+    BN_CTX *new_ctx = NULL;
+    int i, j, k, ret = 0;
+    size_t w;
+
+    PRECOMP256_ROW *preComputedTable = NULL;
+    unsigned char *precomp_storage = NULL;
+
+    /* if there is an old EC_PRE_COMP object, throw it away */
+    EC_EX_DATA_free_data(&group->extra_data, sm2z256_pre_comp_dup,
+                         sm2z256_pre_comp_free,
+                         sm2z256_pre_comp_clear_free);
+
+    generator = EC_GROUP_get0_generator(group);
+    if (generator == NULL) {
+        ECerr(EC_F_ECP_SM2Z256_MULT_PRECOMPUTE, EC_R_UNDEFINED_GENERATOR);
+        return 0;
+    }
+
+    if (sm2z256_is_affine_G(generator)) {
+        /*
+         * No need to calculate tables for the standard generator because we
+         * have them statically.
+         */
+        return 1;
+    }
+
+    if ((pre_comp = sm2z256_pre_comp_new(group)) == NULL)
+        return 0;
+
+    if (ctx == NULL) {
+        ctx = new_ctx = BN_CTX_new();
+        if (ctx == NULL)
+            goto err;
+    }
+
+    BN_CTX_start(ctx);
+    order = BN_CTX_get(ctx);
+
+    if (order == NULL)
+        goto err;
+
+    if (!EC_GROUP_get_order(group, order, ctx))
+        goto err;
+
+    if (BN_is_zero(order)) {
+        ECerr(EC_F_ECP_SM2Z256_MULT_PRECOMPUTE, EC_R_UNKNOWN_ORDER);
+        goto err;
+    }
+
+    w = 7;
+
+    if ((precomp_storage =
+         OPENSSL_malloc(37 * 64 * sizeof(P256_POINT_AFFINE) + 64)) == NULL) {
+        ECerr(EC_F_ECP_SM2Z256_MULT_PRECOMPUTE, ERR_R_MALLOC_FAILURE);
+        goto err;
+    } else {
+        preComputedTable = (void *)ALIGNPTR(precomp_storage, 64);
+    }
+
+    P = EC_POINT_new(group);
+    T = EC_POINT_new(group);
+    if (P == NULL || T == NULL)
+        goto err;
+
+    /*
+     * The zero entry is implicitly infinity, and we skip it, storing other
+     * values with -1 offset.
+     */
+    if (!EC_POINT_copy(T, generator))
+        goto err;
+
+    for (k = 0; k < 64; k++) {
+        if (!EC_POINT_copy(P, T))
+            goto err;
+        for (j = 0; j < 37; j++) {
+            if (!EC_POINT_make_affine(group, P, ctx))
+                goto err;
+            if (!sm2z256_bignum_to_field_elem(preComputedTable[j][k].X,
+                                              &P->X) ||
+                !sm2z256_bignum_to_field_elem(preComputedTable[j][k].Y,
+                                              &P->Y)) {
+                ECerr(EC_F_ECP_SM2Z256_MULT_PRECOMPUTE,
+                      EC_R_COORDINATES_OUT_OF_RANGE);
+                goto err;
+            }
+            for (i = 0; i < 7; i++) {
+                if (!EC_POINT_dbl(group, P, P, ctx))
+                    goto err;
+            }
+        }
+        if (!EC_POINT_add(group, T, T, generator, ctx))
+            goto err;
+    }
+
+    pre_comp->group = group;
+    pre_comp->w = w;
+    pre_comp->precomp = preComputedTable;
+    pre_comp->precomp_storage = precomp_storage;
+
+    precomp_storage = NULL;
+
+    if (!EC_EX_DATA_set_data(&group->extra_data, pre_comp,
+                             sm2z256_pre_comp_dup,
+                             sm2z256_pre_comp_free,
+                             sm2z256_pre_comp_clear_free)) {
+        goto err;
+    }
+
+    pre_comp = NULL;
+
+    ret = 1;
+
+ err:
+    if (ctx != NULL)
+        BN_CTX_end(ctx);
+    BN_CTX_free(new_ctx);
+
+    if (pre_comp)
+        sm2z256_pre_comp_free(pre_comp);
+    if (precomp_storage)
+        OPENSSL_free(precomp_storage);
+    if (P)
+        EC_POINT_free(P);
+    if (T)
+        EC_POINT_free(T);
+    return ret;
+}
+
+static int sm2z256_set_from_affine(EC_POINT *out, const EC_GROUP *group,
+                                   const P256_POINT_AFFINE *in, BN_CTX *ctx)
+{
+    BIGNUM x, y;
+    BN_ULONG d_x[P256_LIMBS], d_y[P256_LIMBS];
+
+    memcpy(d_x, in->X, sizeof(d_x));
+    x.d = d_x;
+    x.dmax = x.top = P256_LIMBS;
+    x.neg = 0;
+    x.flags = BN_FLG_STATIC_DATA;
+    bn_correct_top(&x);
+
+    memcpy(d_y, in->Y, sizeof(d_y));
+    y.d = d_y;
+    y.dmax = y.top = P256_LIMBS;
+    y.neg = 0;
+    y.flags = BN_FLG_STATIC_DATA;
+    bn_correct_top(&y);
+
+    /* the coordinates are in the Montgomery domain already */
+    if (!BN_copy(&out->X, &x) || !BN_copy(&out->Y, &y) ||
+        !group->meth->field_set_to_one(group, &out->Z, ctx))
+        return 0;
+    out->Z_is_one = 1;
+    return 1;
+}
+
+/*
+ * Sets *table to the multiples of the generator, from EC_GROUP_precompute_mult
+ * or the hardcoded table, or to NULL if there are none.
+ */
+static int sm2z256_generator_table(const EC_GROUP *group,
+                                   const EC_POINT *generator,
+                                   const PRECOMP256_ROW **table, BN_CTX *ctx)
+{
+    const EC_PRE_COMP *pre_comp;
+
+    *table = NULL;
+
+    /* look if we can use precomputed multiples of generator */
+    pre_comp =
+        EC_EX_DATA_get_data(group->extra_data, sm2z256_pre_comp_dup,
+                            sm2z256_pre_comp_free,
+                            sm2z256_pre_comp_clear_free);
+
+    if (pre_comp) {
+        /*
+         * If there is a precomputed table for the generator, check that
+         * it was generated with the same generator.
+         */
+        EC_POINT *pre_comp_generator = EC_POINT_new(group);
+        if (pre_comp_generator == NULL)
+            return 0;
+
+        if (!sm2z256_set_from_affine
+            (pre_comp_generator, group, pre_comp->precomp[0], ctx)) {
+            EC_POINT_free(pre_comp_generator);
+            return 0;
+        }
+
+        if (0 == EC_POINT_cmp(group, generator, pre_comp_generator, ctx))
+            *table = (const PRECOMP256_ROW *)pre_comp->precomp;
+
+        EC_POINT_free(pre_comp_generator);
+    }
+
+    if (*table == NULL && sm2z256_is_affine_G(generator)) {
+        /*
+         * If there is no precomputed data, but the generator is the
+         * default, the hardcoded table of ecp_sm2z256_table.c is used.
+         */
+        *table = (const PRECOMP256_ROW *)ecp_sm2z256_precomputed;
+    }
+
+    return 1;
+}
+
+/* r = scalar*G using the 37 rows of 7-bit windows of G */
+static int sm2z256_mul_g(const EC_GROUP *group, P256_POINT *r,
+                         const BIGNUM *scalar,
+                         const PRECOMP256_ROW *preComputedTable, BN_CTX *ctx)
+{
+    const unsigned int window_size = 7;
+    const unsigned int mask = (1 << (window_size + 1)) - 1;
+    unsigned int wvalue, index = 0;
+    unsigned char p_str[33];
+    ALIGN32 P256_POINT_AFFINE t;
+    BN_ULONG tmp[P256_LIMBS];
+    int i;
+
+    if (!sm2z256_scalar_to_bytes(p_str, group, scalar, ctx))
+        return 0;
+
+    /* First window */
+    wvalue = (p_str[0] << 1) & mask;
+    index += window_size;
+
+    wvalue = _booth_recode_w7(wvalue);
+
+    sm2z256_select_w7(&t, preComputedTable[0], wvalue >> 1);
+
+    sm2z256_neg(tmp, t.Y);
+    copy_conditional(t.Y, tmp, wvalue & 1);
+
+    memcpy(r->X, t.X, sizeof(t.X));
+    memcpy(r->Y, t.Y, sizeof(t.Y));
+    memcpy(r->Z, ONE, sizeof(ONE));
+
+    for (i = 1; i < 37; i++) {
+        unsigned int off = (index - 1) / 8;
+
+        wvalue = p_str[off] | p_str[off + 1] << 8;
+        wvalue = (wvalue >> ((index - 1) % 8)) & mask;
+        index += window_size;
+
+        wvalue = _booth_recode_w7(wvalue);
+
+        sm2z256_select_w7(&t, preComputedTable[i], wvalue >> 1);
+
+        sm2z256_neg(tmp, t.Y);
+        copy_conditional(t.Y, tmp, wvalue & 1);
+
+        sm2z256_point_add_affine(r, r, &t);
+    }
+
+    /* (0,0) is infinity in the affine additions, make it Z = 0 */
+    memset(tmp, 0, sizeof(tmp));
+    copy_conditional(r->Z, tmp, is_zero(r->X[0] | r->X[1] | r->X[2] |
+                                        r->X[3] | r->Y[0] | r->Y[1] |
+                                        r->Y[2] | r->Y[3]));
+
+    OPENSSL_cleanse(p_str, sizeof(p_str));
+    return 1;
+}
+
+/* r = scalar*G + sum(scalars[i]*points[i]) */
+static int sm2z256_points_mul(const EC_GROUP *group,
+                              EC_POINT *r,
+                              const BIGNUM *scalar,
+                              size_t num,
+                              const EC_POINT *points[],
+                              const BIGNUM *scalars[], BN_CTX *ctx)
+{
+    int ret = 0, no_precomp_for_generator = 0, p_is_infinity = 0;
+    size_t j;
+    BN_CTX *new_ctx = NULL;
+    const BIGNUM **new_scalars = NULL;
+    const EC_POINT **new_points = NULL;
+    const EC_POINT *generator = NULL;
+    const PRECOMP256_ROW *preComputedTable = NULL;
+    ALIGN32 P256_POINT p, t;
+
+    if (group->meth != r->meth) {
+        ECerr(EC_F_ECP_SM2Z256_POINTS_MUL, EC_R_INCOMPATIBLE_OBJECTS);
+        return 0;
+    }
+
+    if ((scalar == NULL) && (num == 0))
+        return EC_POINT_set_to_infinity(group, r);
+
+    for (j = 0; j < num; j++) {
+        if (group->meth != points[j]->meth) {
+            ECerr(EC_F_ECP_SM2Z256_POINTS_MUL, EC_R_INCOMPATIBLE_OBJECTS);
+            return 0;
+        }
+    }
+
+    if (ctx == NULL) {
+        ctx = new_ctx = BN_CTX_new();
+        if (ctx == NULL)
+            goto err;
+    }
+
+    BN_CTX_start(ctx);
+
+    if (scalar) {
+        generator = EC_GROUP_get0_generator(group);
+        if (generator == NULL) {
+            ECerr(EC_F_ECP_SM2Z256_POINTS_MUL, EC_R_UNDEFINED_GENERATOR);
+            goto err;
+        }
+
+        if (!sm2z256_generator_table(group, generator, &preComputedTable,
+                                     ctx))
+            goto err;
+
+        if (preComputedTable) {
+            if (!sm2z256_mul_g(group, &p, scalar, preComputedTable, ctx))
+                goto err;
+        } else {
+            p_is_infinity = 1;
+            no_precomp_for_generator = 1;
+        }
+    } else
+        p_is_infinity = 1;
+
+    if (no_precomp_for_generator) {
+        /*
+         * Without a precomputed table for the generator, it has to be
+         * handled like a normal point.
+         */
+        new_scalars = OPENSSL_malloc((num + 1) * sizeof(BIGNUM *));
+        new_points = OPENSSL_malloc((num + 1) * sizeof(EC_POINT *));
+        if (new_scalars == NULL || new_points == NULL) {
+            ECerr(EC_F_ECP_SM2Z256_POINTS_MUL, ERR_R_MALLOC_FAILURE);
+            goto err;
+        }
+
+        memcpy(new_scalars, scalars, num * sizeof(BIGNUM *));
+        new_scalars[num] = scalar;
+        memcpy(new_points, points, num * sizeof(EC_POINT *));
+        new_points[num] = generator;
+
+        scalars = new_scalars;
+        points = new_points;
+        num++;
+    }
+
+    if (num) {
+        P256_POINT *out = &t;
+        if (p_is_infinity)
+            out = &p;
+
+        if (!sm2z256_windowed_mul(group, out, scalars, points, num, ctx))
+            goto err;
+
+        if (!p_is_infinity)
+            sm2z256_point_add(&p, &p, out);
+    }
+
+    /* Not constant-time, but we're only operating on the public output. */
+    if (!sm2z256_set_words(&r->X, p.X) ||
+        !sm2z256_set_words(&r->Y, p.Y) ||
+        !sm2z256_set_words(&r->Z, p.Z)) {
+        goto err;
+    }
+    r->Z_is_one = is_one(p.Z) & 1;
+
+    ret = 1;
+
+ err:
+    if (ctx)
+        BN_CTX_end(ctx);
+    BN_CTX_free(new_ctx);
+    if (new_points)
+        OPENSSL_free(new_points);
+    if (new_scalars)
+        OPENSSL_free(new_scalars);
+    return ret;
+}
+
+static int sm2z256_get_affine(const EC_GROUP *group,
+                              const EC_POINT *point,
+                              BIGNUM *x, BIGNUM *y, BN_CTX *ctx)
+{
+    BN_ULONG z_inv2[P256_LIMBS];
+    BN_ULONG z_inv3[P256_LIMBS];
+    BN_ULONG x_aff[P256_LIMBS];
+    BN_ULONG y_aff[P256_LIMBS];
+    BN_ULONG point_x[P256_LIMBS], point_y[P256_LIMBS], point_z[P256_LIMBS];
+    BN_ULONG x_ret[P256_LIMBS], y_ret[P256_LIMBS];
+
+    if (EC_POINT_is_at_infinity(group, point)) {
+        ECerr(EC_F_ECP_SM2Z256_GET_AFFINE, EC_R_POINT_AT_INFINITY);
+        return 0;
+    }
+
+    if (!sm2z256_bignum_to_field_elem(point_x, &point->X) ||
+        !sm2z256_bignum_to_field_elem(point_y, &point->Y) ||
+        !sm2z256_bignum_to_field_elem(point_z, &point->Z)) {
+        ECerr(EC_F_ECP_SM2Z256_GET_AFFINE, EC_R_COORDINATES_OUT_OF_RANGE);
+        return 0;
+    }
+
+    sm2z256_mod_inverse(z_inv3, point_z);
+    sm2z256_sqr_mont(z_inv2, z_inv3);
+    sm2z256_mul_mont(x_aff, z_inv2, point_x);
+
+    if (x != NULL) {
+        sm2z256_from_mont(x_ret, x_aff);
+        if (!sm2z256_set_words(x, x_ret))
+            return 0;
+    }
+
+    if (y != NULL) {
+        sm2z256_mul_mont(z_inv3, z_inv3, z_inv2);
+        sm2z256_mul_mont(y_aff, z_inv3, point_y);
+        sm2z256_from_mont(y_ret, y_aff);
+        if (!sm2z256_set_words(y, y_ret))
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Tables of EC_POINT_TABLE_new, the odd multiples Q, 3Q, ..., 63Q in affine
+ * form for 7-bit wNAF, for each of Q = P, 2^64*P, 2^128*P and 2^192*P. The
+ * scalar is split in four 64-bit parts, so that only 64 doublings are left.
+ */
+# define SM2Z256_TABLE_W        7
+# define SM2Z256_TABLE_SIZE     (1 << (SM2Z256_TABLE_W - 2))
+# define SM2Z256_TABLE_ROWS     4
+# define SM2Z256_TABLE_BITS     (256 / SM2Z256_TABLE_ROWS)
+
+typedef P256_POINT_AFFINE SM2Z256_TABLE_ROW[SM2Z256_TABLE_SIZE];
+
+static void *sm2z256_point_table_new(const EC_GROUP *group,
+                                     const EC_POINT *point, BN_CTX *ctx)
+{
+    enum { N = SM2Z256_TABLE_ROWS * SM2Z256_TABLE_SIZE };
+    P256_POINT_AFFINE *ret;
+    P256_POINT *t;
+    P256_POINT q, two;
+    BN_ULONG (*acc)[P256_LIMBS] = NULL;
+    BN_ULONG inv[P256_LIMBS], z_inv[P256_LIMBS], z_inv2[P256_LIMBS];
+    int i, j;
+
+    ret = OPENSSL_malloc(N * sizeof(P256_POINT_AFFINE));
+    t = OPENSSL_malloc(N * sizeof(P256_POINT));
+    acc = OPENSSL_malloc(N * sizeof(*acc));
+    if (ret == NULL || t == NULL || acc == NULL) {
+        ECerr(EC_F_ECP_SM2Z256_POINT_TABLE_NEW, ERR_R_MALLOC_FAILURE);
+        goto err;
+    }
+
+    if (!sm2z256_bignum_to_field_elem(q.X, &point->X) ||
+        !sm2z256_bignum_to_field_elem(q.Y, &point->Y) ||
+        !sm2z256_bignum_to_field_elem(q.Z, &point->Z)) {
+        ECerr(EC_F_ECP_SM2Z256_POINT_TABLE_NEW,
+              EC_R_COORDINATES_OUT_OF_RANGE);
+        goto err;
+    }
+
+    for (j = 0; j < SM2Z256_TABLE_ROWS; j++) {
+        P256_POINT *row = t + j * SM2Z256_TABLE_SIZE;
+
+        if (j > 0)
+            for (i = 0; i < SM2Z256_TABLE_BITS; i++)
+                sm2z256_point_double(&q, &q);
+        row[0] = q;
+        sm2z256_point_double(&two, &q);
+        for (i = 1; i < SM2Z256_TABLE_SIZE; i++)
+            sm2z256_point_add(&row[i], &row[i - 1], &two);
+    }
+
+    /* one inversion for all of the Z coordinates */
+    memcpy(acc[0], t[0].Z, sizeof(acc[0]));
+    for (i = 1; i < N; i++)
+        sm2z256_mul_mont(acc[i], acc[i - 1], t[i].Z);
+    sm2z256_mod_inverse(inv, acc[N - 1]);
+
+    for (i = N - 1; i >= 0; i--) {
+        if (i > 0) {
+            sm2z256_mul_mont(z_inv, inv, acc[i - 1]);
+            sm2z256_mul_mont(inv, inv, t[i].Z);
+        } else
+            memcpy(z_inv, inv, sizeof(z_inv));
+
+        sm2z256_sqr_mont(z_inv2, z_inv);
+        sm2z256_mul_mont(ret[i].X, t[i].X, z_inv2);
+        sm2z256_mul_mont(z_inv2, z_inv2, z_inv);
+        sm2z256_mul_mont(ret[i].Y, t[i].Y, z_inv2);
+    }
+
+    OPENSSL_free(t);
+    OPENSSL_free(acc);
+    return ret;
+
+ err:
+    if (ret)
+        OPENSSL_free(ret);
+    if (t)
+        OPENSSL_free(t);
+    if (acc)
+        OPENSSL_free(acc);
+    return NULL;
+}
+
+static void sm2z256_point_table_free(void *table)
+{
+    OPENSSL_free(table);
+}
+
+/*
+ * Writes the width w NAF of the little-endian p_str[33] to digits[], least
+ * significant first, and returns the number of digits
+ */
+static int sm2z256_wnaf(signed char digits[33 * 8 + 1],
+                        const unsigned char p_str[33], int w)
+{
+    BN_ULONG k[5] = { 0 };
+    int i, d, len = 0;
+
+    for (i = 0; i < 33; i++)
+        k[i / 8] |= (BN_ULONG)p_str[i] << (8 * (i % 8));
+
+    while (k[0] | k[1] | k[2] | k[3] | k[4]) {
+        d = 0;
+        if (k[0] & 1) {
+            d = (int)(k[0] & ((1 << w) - 1));
+            if (d >= 1 << (w - 1))
+                d -= 1 << w;
+            /* k -= d, the low w bits become zero */
+            if (d > 0)
+                k[0] -= d;
+            else {
+                BN_ULONG c = (BN_ULONG)-d;
+
+                for (i = 0; i < 5; i++) {
+                    k[i] += c;
+                    c = k[i] < c;
+                }
+            }
+        }
+        digits[len++] = (signed char)d;
+        for (i = 0; i < 4; i++)
+            k[i] = (k[i] >> 1) | (k[i + 1] << (BN_BITS2 - 1));
+        k[4] >>= 1;
+    }
+
+    return len;
+}
+
+/* r = scalar*G + p_scalar*P with the table of P, in variable time */
+static int sm2z256_mul_table(const EC_GROUP *group, EC_POINT *r,
+                             const BIGNUM *scalar, const void *table,
+                             const BIGNUM *p_scalar, BN_CTX *ctx)
+{
+    const SM2Z256_TABLE_ROW *tab = table;
+    const PRECOMP256_ROW *preComputedTable = NULL;
+    const EC_POINT *generator;
+    BN_CTX *new_ctx = NULL;
+    unsigned char p_str[33];
+    signed char digits[SM2Z256_TABLE_ROWS][33 * 8 + 1];
+    int lens[SM2Z256_TABLE_ROWS];
+    ALIGN32 P256_POINT p, q;
+    P256_POINT_AFFINE t;
+    int i, j, len, ret = 0;
+
+    if (ctx == NULL) {
+        ctx = new_ctx = BN_CTX_new();
+        if (ctx == NULL)
+            return 0;
+    }
+
+    BN_CTX_start(ctx);
+
+    /* p_scalar*P, from the wNAF of the 64-bit parts of p_scalar */
+    memset(&p, 0, sizeof(p));
+    if (p_scalar != NULL) {
+        if (!sm2z256_scalar_to_bytes(p_str, group, p_scalar, ctx))
+            goto err;
+        len = 0;
+        for (j = 0; j < SM2Z256_TABLE_ROWS; j++) {
+            unsigned char part[33] = { 0 };
+
+            memcpy(part, p_str + j * SM2Z256_TABLE_BITS / 8,
+                   SM2Z256_TABLE_BITS / 8);
+            lens[j] = sm2z256_wnaf(digits[j], part, SM2Z256_TABLE_W);
+            if (lens[j] > len)
+                len = lens[j];
+        }
+
+        for (i = len - 1; i >= 0; i--) {
+            if (i < len - 1)
+                sm2z256_point_double(&p, &p);
+            for (j = 0; j < SM2Z256_TABLE_ROWS; j++) {
+                const P256_POINT_AFFINE *row = tab[j];
+                int d = i < lens[j] ? digits[j][i] : 0;
+
+                if (d == 0)
+                    continue;
+                if (d > 0)
+                    t = row[d >> 1];
+                else {
+                    memcpy(t.X, row[-d >> 1].X, sizeof(t.X));
+                    sm2z256_neg(t.Y, row[-d >> 1].Y);
+                }
+                sm2z256_point_add_affine(&p, &p, &t);
+            }
+        }
+        /* (0,0) is infinity in the affine additions, make it Z = 0 */
+        if (is_zero(p.X[0] | p.X[1] | p.X[2] | p.X[3] |
+                    p.Y[0] | p.Y[1] | p.Y[2] | p.Y[3]))
+            memset(p.Z, 0, sizeof(p.Z));
+    }
+
+    /* scalar*G */
+    if (scalar != NULL) {
+        generator = EC_GROUP_get0_generator(group);
+        if (generator == NULL) {
+            ECerr(EC_F_ECP_SM2Z256_MUL_TABLE, EC_R_UNDEFINED_GENERATOR);
+            goto err;
+        }
+        if (!sm2z256_generator_table(group, generator, &preComputedTable,
+                                     ctx))
+            goto err;
+        if (preComputedTable != NULL) {
+            if (!sm2z256_mul_g(group, &q, scalar, preComputedTable, ctx))
+                goto err;
+        } else if (!sm2z256_windowed_mul(group, &q, &scalar, &generator, 1,
+                                         ctx))
+            goto err;
+        sm2z256_point_add(&p, &p, &q);
+    }
+
+    if (!sm2z256_set_words(&r->X, p.X) ||
+        !sm2z256_set_words(&r->Y, p.Y) ||
+        !sm2z256_set_words(&r->Z, p.Z))
+        goto err;
+    r->Z_is_one = is_one(p.Z) & 1;
+
+    ret = 1;
+
+ err:
+    BN_CTX_end(ctx);
+    BN_CTX_free(new_ctx);
+    return ret;
+}
+
+static EC_PRE_COMP *sm2z256_pre_comp_new(const EC_GROUP *group)
+{
+    EC_PRE_COMP *ret = NULL;
+
+    if (!group)
+        return NULL;
+
+    ret = (EC_PRE_COMP *)OPENSSL_malloc(sizeof(EC_PRE_COMP));
+
+    if (!ret) {
+        ECerr(EC_F_ECP_SM2Z256_PRE_COMP_NEW, ERR_R_MALLOC_FAILURE);
+        return ret;
+    }
+
+    ret->group = group;
+    ret->w = 7;
+    ret->precomp = NULL;
+    ret->precomp_storage = NULL;
+    ret->references = 1;
+    return ret;
+}
+
+static void *sm2z256_pre_comp_dup(void *src_)
+{
+    EC_PRE_COMP *src = src_;
+
+    /* no need to actually copy, these objects never change! */
+    CRYPTO_add(&src->references, 1, CRYPTO_LOCK_EC_PRE_COMP);
+
+    return src_;
+}
+
+static void sm2z256_pre_comp_free(void *pre_)
+{
+    int i;
+    EC_PRE_COMP *pre = pre_;
+
+    if (!pre)
+        return;
+
+    i = CRYPTO_add(&pre->references, -1, CRYPTO_LOCK_EC_PRE_COMP);
+    if (i > 0)
+        return;
+
+    if (pre->precomp_storage)
+        OPENSSL_free(pre->precomp_storage);
+
+    OPENSSL_free(pre);
+}
+
+static void sm2z256_pre_comp_clear_free(void *pre_)
+{
+    int i;
+    EC_PRE_COMP *pre = pre_;
+
+    if (!pre)
+        return;
+
+    i = CRYPTO_add(&pre->references, -1, CRYPTO_LOCK_EC_PRE_COMP);
+    if (i > 0)
+        return;
+
+    if (pre->precomp_storage) {
+        OPENSSL_cleanse(pre->precomp, 37 * sizeof(PRECOMP256_ROW));
+        OPENSSL_free(pre->precomp_storage);
+    }
+    OPENSSL_cleanse(pre, sizeof *pre);
+    OPENSSL_free(pre);
+}
+
+static int sm2z256_window_have_precompute_mult(const EC_GROUP *group)
+{
+    const EC_POINT *generator = EC_GROUP_get0_generator(group);
+    if (generator != NULL && sm2z256_is_affine_G(generator)) {
+        /* There is a hard-coded table for the default generator. */
+        return 1;
+    }
+
+    return EC_EX_DATA_get_data(group->extra_data, sm2z256_pre_comp_dup,
+                               sm2z256_pre_comp_free,
+                               sm2z256_pre_comp_clear_free) != NULL;
+}
+
+const EC_METHOD *EC_GFp_sm2z256_method(void)
+{
+    static const EC_METHOD ret = {
+        EC_FLAGS_DEFAULT_OCT,
+        NID_X9_62_prime_field,
+        ec_GFp_mont_group_init,
+        ec_GFp_mont_group_finish,
+        ec_GFp_mont_group_clear_finish,
+        ec_GFp_mont_group_copy,
+        ec_GFp_mont_group_set_curve,
+        ec_GFp_simple_group_get_curve,
+        ec_GFp_simple_group_get_degree,
+        ec_GFp_simple_group_check_discriminant,
+        ec_GFp_simple_point_init,
+        ec_GFp_simple_point_finish,
+        ec_GFp_simple_point_clear_finish,
+        ec_GFp_simple_point_copy,
+        ec_GFp_simple_point_set_to_infinity,
+        ec_GFp_simple_set_Jprojective_coordinates_GFp,
+        ec_GFp_simple_get_Jprojective_coordinates_GFp,
+        ec_GFp_simple_point_set_affine_coordinates,
+        sm2z256_get_affine,
+        0, 0, 0,
+        ec_GFp_simple_add,
+        ec_GFp_simple_dbl,
+        ec_GFp_simple_invert,
+        ec_GFp_simple_is_at_infinity,
+        ec_GFp_simple_is_on_curve,
+        ec_GFp_simple_cmp,
+        ec_GFp_simple_make_affine,
+        ec_GFp_simple_points_make_affine,
+        sm2z256_points_mul,                         /* mul */
+        sm2z256_mult_precompute,                    /* precompute_mult */
+        sm2z256_window_have_precompute_mult,        /* have_precompute_mult */
+        ec_GFp_mont_field_mul,
+        ec_GFp_mont_field_sqr,
+        0,                                          /* field_div */
+        ec_GFp_mont_field_encode,
+        ec_GFp_mont_field_decode,
+        ec_GFp_mont_field_set_to_one,
+        sm2z256_point_table_new,
+        sm2z256_point_table_free,
+        sm2z256_mul_table
+    };
+
+    return &ret;
+}
+#endif
@@ -0,0 +1,9492 @@
+/*
+ * This is the precomputed constant time access table for the code in
+ * ecp_sm2z256.c, for the generator of sm2p256v1. It has the same layout
+ * as ecp_nistz256_table.c: 37 subtables of 64 affine points, entry k of
+ * subtable j is (k + 1) * 2^(7 * j) * G, with the coordinates in the
+ * Montgomery domain, encoded as eight little-endian BN_ULONGs, four for x
+ * and four for y.
+ */
+
+#if defined(__GNUC__)
+__attribute((aligned(4096)))
+#elif defined(_MSC_VER)
+__declspec(align(4096))
+#elif defined(__SUNPRO_C)
+# pragma align 4096(ecp_sm2z256_precomputed)
+#endif
+static const BN_ULONG ecp_sm2z256_precomputed[37][64 *
+                                                 sizeof(P256_POINT_AFFINE) /
+                                                 sizeof(BN_ULONG)] = {
+    {TOBN(0x61328990, 0xf418029e), TOBN(0x3e7981ed, 0xdca6c050),
+     TOBN(0xd6a1ed99, 0xac24c3c3), TOBN(0x91167a5e, 0xe1c13b05),
+     TOBN(0xc1354e59, 0x3c2d0ddd), TOBN(0xc1f5e578, 0x8d3295fa),
+     TOBN(0x8d4cfb06, 0x6e2a48f8), TOBN(0x63cd65d4, 0x81d735bd),
+     TOBN(0x0af037bf, 0xbc3be46a), TOBN(0x83bdc9ba, 0x2d8fa938),
+     TOBN(0x5349d94b, 0x5788cd24), TOBN(0x0d7e9c18, 0xcaa5736a),
+     TOBN(0x6a7e1a1d, 0x69db9ac1), TOBN(0xccbd8d37, 0xc4a8e82b),
+     TOBN(0xc7b14516, 0x9b7157ac), TOBN(0x947e7465, 0x6c21bdf5),
+     TOBN(0x1cda54fd, 0xab589e4a), TOBN(0x26765289, 0xdb4f0a0d),
+     TOBN(0x0a265a30, 0x8ceb4a0a), TOBN(0x3019fd6b, 0xfe887c64),
+     TOBN(0x0a10fbe9, 0x4b2fc190), TOBN(0xf40aa52b, 0x87cbce60),
+     TOBN(0xcc496bfa, 0x6dc13c97), TOBN(0x28ad3478, 0x5bb3fbb4),
+     TOBN(0x393f7c5a, 0x98615060), TOBN(0x487ea27f, 0xe9016209),
+     TOBN(0x8a86bcb4, 0xa09f9020), TOBN(0x50dc8e3a, 0xc899dbe1),
+     TOBN(0xfc099043, 0xfd619998), TOBN(0x1de135ea, 0x7c7383bd),
+     TOBN(0x4d0bd556, 0x32cf70ed), TOBN(0x6ffc31c5, 0x25bce9e3),
+     TOBN(0x9a575633, 0x6a9c8162), TOBN(0x15aa58f2, 0x21dfcc53),
+     TOBN(0x7ad354bf, 0x1ef5f4c5), TOBN(0x0f443ef3, 0x63f875b9),
+     TOBN(0x2e81d68f, 0xd3450133), TOBN(0xb30f4bbd, 0xe3607d18),
+     TOBN(0xb1826a4c, 0x362258ef), TOBN(0x7b415276, 0x142a6768),
+     TOBN(0x136a9c4c, 0x0acd72ba), TOBN(0xb1274a25, 0x5e7ec73c),
+     TOBN(0xf15a876e, 0x5de34db6), TOBN(0x85e74ca0, 0x8cba8047),
+     TOBN(0x08454cdd, 0xb469eb37), TOBN(0x8fbf6d1f, 0xc99754f8),
+     TOBN(0x1060e7f8, 0xec30e984), TOBN(0xb568bc97, 0x4b8c598a),
+     TOBN(0xaa3531c7, 0x81f06784), TOBN(0x0b894193, 0x07132520),
+     TOBN(0x84ee5b69, 0xacfe18c5), TOBN(0xbbf492e0, 0xd9fbec28),
+     TOBN(0x313a35c1, 0xe5f6186d), TOBN(0x0e449a2e, 0x757a01b8),
+     TOBN(0x96c9b992, 0x2bd99baf), TOBN(0x2ba05a8f, 0x3b84d777),
+     TOBN(0xde523a1c, 0x09122670), TOBN(0x90be6f2a, 0x22cc810c),
+     TOBN(0x086e6341, 0x4387df9e), TOBN(0x115c2fc0, 0xd9c44134),
+     TOBN(0x9334430d, 0x8799302a), TOBN(0x693b3500, 0xe27b7ea4),
+     TOBN(0xcbe1136f, 0x9a8f3382), TOBN(0xe77fd5f2, 0xb5778247),
+     TOBN(0x98e795c3, 0x30fbde86), TOBN(0x8e5e0495, 0xab21af8f),
+     TOBN(0x3925bf83, 0xb48669b4), TOBN(0x77d88740, 0x469522c8),
+     TOBN(0x8fbf8b5b, 0x987b04ce), TOBN(0x63c563a8, 0x3aff4428),
+     TOBN(0x5dc11165, 0x53a6e969), TOBN(0x822a6c24, 0x32697f4c),
+     TOBN(0x6774298a, 0x642cb143), TOBN(0xecdb60d8, 0x2d110e71),
+     TOBN(0xe810b11b, 0x1388728e), TOBN(0x2e8237d8, 0xd8603a8a),
+     TOBN(0x673968fc, 0x50aeeae1), TOBN(0x08c65d19, 0x6746a3f4),
+     TOBN(0x7a61a6b5, 0xd7dd7165), TOBN(0xe31bbfd9, 0xa9b6df3a),
+     TOBN(0x2b252ad0, 0x3421e115), TOBN(0x7557c8c7, 0xc6affc01),
+     TOBN(0xd90c19fd, 0x8a509267), TOBN(0x483da168, 0xe0d871c8),
+     TOBN(0x72d6f9b3, 0xc10729bf), TOBN(0x5dd84021, 0x15b7061e),
+     TOBN(0x9bfea2db, 0x9f2c587d), TOBN(0x528398a7, 0x98641ec2),
+     TOBN(0x18a65d8d, 0xf3afdd62), TOBN(0x89f38500, 0xd6d7e4e4),
+     TOBN(0x65708c6a, 0x9d8d4f07), TOBN(0xb90ea13c, 0xd0bdc7f4),
+     TOBN(0x58985855, 0x8c3e2b32), TOBN(0xfa48d5c5, 0xbcfad3a1),
+     TOBN(0x5c3544e7, 0x62385ffa), TOBN(0xb6bd39ed, 0x7e72aeb7),
+     TOBN(0x34e51c6a, 0x8000fe4e), TOBN(0x7da2bdfd, 0x89c46941),
+     TOBN(0x667ba91d, 0xe1bc2b2e), TOBN(0x3c80c9d0, 0x10a73e5c),
+     TOBN(0x4fadebbe, 0xc7f5c64d), TOBN(0xaef09eb4, 0x3ea35052),
+     TOBN(0x167ee11b, 0x26ec55f9), TOBN(0x45fa508a, 0x85189260),
+     TOBN(0xa0e9a439, 0x22542fc3), TOBN(0x3f194a6c, 0xddac78dc),
+     TOBN(0xa75ae72d, 0x6f74d053), TOBN(0x0f8babeb, 0x097c6617),
+     TOBN(0x1d12bc5c, 0x4303c247), TOBN(0xfe0c027a, 0xbd1e246c),
+     TOBN(0xe9ca1a99, 0xb69b55ad), TOBN(0xff6cd2b0, 0x117cd63a),
+     TOBN(0xf3489343, 0xdde97d4d), TOBN(0x9c14e38a, 0xbbb2ce1f),
+     TOBN(0x25866911, 0xcfddf221), TOBN(0x0df89411, 0x460efef1),
+     TOBN(0xf713f30e, 0x73ae8326), TOBN(0xd9be66a8, 0xcdd274a1),
+     TOBN(0xdf915ae2, 0x36885947), TOBN(0x2c5c1e9e, 0x7878b781),
+     TOBN(0xf71560c9, 0x39e8a120), TOBN(0x7121d6b8, 0x7273b59a),
+     TOBN(0x649535ce, 0x8ef4639d), TOBN(0xcd01076e, 0x14cc6d58),
+     TOBN(0x2705729a, 0x96e74f8a), TOBN(0xb07e3230, 0x5533037e),
+     TOBN(0x0846dcc1, 0x663c5c62), TOBN(0x6a4759c1, 0x10fc3ac1),
+     TOBN(0x3c126193, 0xcfbdfeff), TOBN(0x4a31dd20, 0x4996d845),
+     TOBN(0x48a76ba0, 0x19f2b658), TOBN(0xbe330142, 0x8890a8bc),
+     TOBN(0x287b34e1, 0x308aa041), TOBN(0xcbf5da24, 0x813adf29),
+     TOBN(0xcdfc5a58, 0xcdcdc439), TOBN(0xbda3bda2, 0x198a6075),
+     TOBN(0x639f92bc, 0x1497fe38), TOBN(0x8ed8eeac, 0xd58bd278),
+     TOBN(0xcf5d7ce6, 0xb417bfe4), TOBN(0xf617c54e, 0x44400c59),
+     TOBN(0xde635635, 0x7d8dc939), TOBN(0x2e6a3a75, 0x241baaff),
+     TOBN(0x02f324e5, 0xe07e8e97), TOBN(0xeb715487, 0x70f9fc9d),
+     TOBN(0xbefd3380, 0x86712116), TOBN(0x9b9e9707, 0x884efe46),
+     TOBN(0x611a1eec, 0x8c9e513f), TOBN(0xe2d8e3f5, 0x3b6dbcec),
+     TOBN(0x7cedab1c, 0x4f8964e4), TOBN(0xee12d062, 0xf4e139f8),
+     TOBN(0x8e63c9c0, 0x9a9af4f3), TOBN(0xe3246dbb, 0x8b907b23),
+     TOBN(0x70d5bda2, 0x71099001), TOBN(0x3d876d4a, 0x15fae7dd),
+     TOBN(0xaba0500f, 0x7b69c20e), TOBN(0xa8e3e094, 0x9834adf2),
+     TOBN(0x69db851b, 0x980b21b9), TOBN(0x274c1de2, 0x788c2a30),
+     TOBN(0x5caa5336, 0xd47d153d), TOBN(0xada69877, 0x57cef318),
+     TOBN(0x83879486, 0xa0551c80), TOBN(0x1611dea0, 0x658e61be),
+     TOBN(0x1fe95c82, 0x1b935068), TOBN(0x8f01e019, 0x5b229223),
+     TOBN(0x23017e05, 0x7e93c389), TOBN(0xce4ac99d, 0x9840dd64),
+     TOBN(0xddc9b900, 0x1de86399), TOBN(0x6abe5cc3, 0x88015785),
+     TOBN(0xc09545a9, 0xb3c50898), TOBN(0xbd443361, 0x6c05d902),
+     TOBN(0xed71f70c, 0x2c6bcc8c), TOBN(0x8dbc0b88, 0xbdf8e908),
+     TOBN(0x56eb5b98, 0x4fcbcd9a), TOBN(0xafb6fedc, 0x08114397),
+     TOBN(0x0500ce5b, 0xb35f7927), TOBN(0x7005bcf9, 0x95efe710),
+     TOBN(0x125cbed2, 0x2eba7f39), TOBN(0xc7c42e76, 0x6c488d44),
+     TOBN(0xdb8991f9, 0x676915c4), TOBN(0xdf6ae594, 0x9183839f),
+     TOBN(0x4f69c304, 0xc79f8bd1), TOBN(0x638cb070, 0xaa1662fa),
+     TOBN(0xc7f68c72, 0xba6f2599), TOBN(0x11bb84d9, 0x1f6edfa9),
+     TOBN(0x9ed156ec, 0xa215fda2), TOBN(0x19de7a91, 0x20c5ddb6),
+     TOBN(0xc1ed949d, 0x0668c65d), TOBN(0x96683044, 0xd0826f6a),
+     TOBN(0x1e6325e0, 0x1adaa8ff), TOBN(0xbc53bc24, 0x07ac392a),
+     TOBN(0x2c342db5, 0xd9f06e44), TOBN(0x3f529385, 0x30db8c1a),
+     TOBN(0xc5957d29, 0xe7492326), TOBN(0x3addc3df, 0x0663f829),
+     TOBN(0x8faa3169, 0x728cfdc1), TOBN(0xde53aa7c, 0x6b975134),
+     TOBN(0xf481759b, 0xefddc764), TOBN(0xd605474b, 0x09edaff3),
+     TOBN(0xc7df1eb9, 0x653d48c9), TOBN(0xa71e6854, 0xc5040212),
+     TOBN(0x136d8342, 0xafe945b5), TOBN(0x91707e7d, 0xe9d239c7),
+     TOBN(0xeda23dc5, 0xfb2e80de), TOBN(0x892bed73, 0xff614966),
+     TOBN(0x2ded2367, 0x838dc12d), TOBN(0x73fd298c, 0xb002bd9c),
+     TOBN(0xc548b426, 0x2c4629df), TOBN(0x93605d17, 0x8f7e03b7),
+     TOBN(0x32861816, 0xd37c24cc), TOBN(0x5bb54ee2, 0xe427975a),
+     TOBN(0x6da013d2, 0x32f943a9), TOBN(0x0746a77a, 0x9bc202e5),
+     TOBN(0x6db07a84, 0xcd1def5b), TOBN(0x9421fe7f, 0x861d9f9b),
+     TOBN(0x71767292, 0x692181fb), TOBN(0x0560e7e5, 0xc9d2441d),
+     TOBN(0xf1496afd, 0x4d7e922a), TOBN(0x67f42a3f, 0xe11fa533),
+     TOBN(0x9f903e5b, 0x977956cd), TOBN(0x37671e24, 0x1eb49608),
+     TOBN(0x967950a0, 0x21fb2047), TOBN(0x141f96fb, 0x35da3c6b),
+     TOBN(0xe07c3c40, 0xd27bba59), TOBN(0xbde5ed1d, 0x0e1af754),
+     TOBN(0xdc64c4b0, 0x54f1f257), TOBN(0xecb033c8, 0xb01196dc),
+     TOBN(0x54e65f4d, 0x8202d5bd), TOBN(0x63afcc93, 0x2b2fd451),
+     TOBN(0x1e929a39, 0x30640fb7), TOBN(0xdc91387e, 0x5b361718),
+     TOBN(0x10aadecb, 0xf8f0bbe8), TOBN(0x81d8f466, 0x0977e2bb),
+     TOBN(0xdcaa3790, 0xbd64cd96), TOBN(0xbc8ac152, 0xcee698d3),
+     TOBN(0xde7192f7, 0xa1143c45), TOBN(0xf7c9d826, 0xf5fb9ea0),
+     TOBN(0x54aea92e, 0xc9468f50), TOBN(0x340f4459, 0xcc427ed4),
+     TOBN(0x3fec5be9, 0x02ad5467), TOBN(0xec780d9c, 0x2cc6c8b5),
+     TOBN(0x7b179a8b, 0xb889c78a), TOBN(0x069a7ab9, 0x0aca32c5),
+     TOBN(0xe4e5215e, 0x591b9a36), TOBN(0x7802fb3e, 0x3bd54630),
+     TOBN(0x9a479313, 0x233c6eeb), TOBN(0x18c612ad, 0x4e1cbabc),
+     TOBN(0x28a29273, 0xc0e36f3b), TOBN(0xf4e2dfb1, 0x7d3deb26),
+     TOBN(0xa6c11369, 0xadbb3c8b), TOBN(0xd78af40b, 0x4c8ec378),
+     TOBN(0xffb3a80d, 0x03f0a982), TOBN(0x550e3e71, 0xa83be50a),
+     TOBN(0x845c0fb2, 0x418ee45b), TOBN(0x5297cf43, 0x0791b964),
+     TOBN(0x676b638c, 0xcc47e33b), TOBN(0xb1c52fac, 0xfecf85b2),
+     TOBN(0xf011b5e5, 0x3dba2c0e), TOBN(0xa6c68448, 0x026d4f11),
+     TOBN(0x11596db3, 0xc3f206fb), TOBN(0xc91c76dc, 0x29414a3c),
+     TOBN(0x1839b9d1, 0xb94ddc7c), TOBN(0xdfb20ce7, 0x56ae8610),
+     TOBN(0x3e2b1cd9, 0xd8734400), TOBN(0x59f9329a, 0xf01ea540),
+     TOBN(0x7d4c140c, 0x2351a2a9), TOBN(0x575c1e1b, 0xbf4c9823),
+     TOBN(0x8f11c2ca, 0x31068df9), TOBN(0xe3c17aa0, 0x05e6def0),
+     TOBN(0xe6281c70, 0x501c8630), TOBN(0xad240917, 0xc88a412e),
+     TOBN(0x6f21bfb7, 0x390492d7), TOBN(0x61ea1385, 0xc3a3ccb7),
+     TOBN(0x60494a83, 0x33733cbc), TOBN(0x8da622a0, 0x27ed8157),
+     TOBN(0x0022b154, 0x0471ad90), TOBN(0x3bd0a4c5, 0xd3568003),
+     TOBN(0xdc8e2d03, 0xd932df23), TOBN(0x859ed940, 0x7a1f5159),
+     TOBN(0xad670e63, 0x2a375b0f), TOBN(0x15922fae, 0x9520db97),
+     TOBN(0xfb73d16f, 0x59eb1a9b), TOBN(0x3ee8cc1f, 0x8511e541),
+     TOBN(0x20d72d59, 0x1590c321), TOBN(0x62eab566, 0x3bd075d4),
+     TOBN(0xac07a7c7, 0xfae123ab), TOBN(0x83b89abf, 0x1f10af6e),
+     TOBN(0x469962ec, 0x1da8ac5d), TOBN(0x09761c35, 0x8c58c3b3),
+     TOBN(0x2c086d5e, 0x7da90fc9), TOBN(0x458e5ffd, 0x5cc27782),
+     TOBN(0xc3f48611, 0xb9268939), TOBN(0x39fed873, 0xde4b9110),
+     TOBN(0x16ef8f78, 0xfda698cc), TOBN(0xb028dc21, 0xa973bb50),
+     TOBN(0x45eb849e, 0xe29b725b), TOBN(0xd41b5b6d, 0x14c6eae9),
+     TOBN(0x5e931b21, 0xc55d5720), TOBN(0xb628ccb2, 0xa0e40b19),
+     TOBN(0x42044ffe, 0x000651a5), TOBN(0x2130b4de, 0x076544e7),
+     TOBN(0x38428594, 0x3677c70f), TOBN(0xfdcdb038, 0xf8945d86),
+     TOBN(0xfb2e3d4c, 0x4169ae44), TOBN(0xd4695e9b, 0x0d13bce2),
+     TOBN(0x45191390, 0x039d646d), TOBN(0x983b7a2e, 0xb12ba339),
+     TOBN(0xdfd30d3e, 0x5923e7d6), TOBN(0xae3590f0, 0xba9d206a),
+     TOBN(0x7d58d334, 0xb6d5e62a), TOBN(0xb15b0544, 0x7e402b12),
+     TOBN(0xac57e113, 0x62ae8e01), TOBN(0x4d83804c, 0xf473edee),
+     TOBN(0x2faa7c4d, 0xc81bc828), TOBN(0xb16ed9d7, 0xfb62561f),
+     TOBN(0x4c9da270, 0x49c2fa93), TOBN(0x3b014c73, 0xb311d90d),
+     TOBN(0xd29c5d65, 0xf5443332), TOBN(0xb6457d54, 0xeebdb7c2),
+     TOBN(0xc6a0bf3a, 0x4cce9480), TOBN(0xd434a3b0, 0x85355854),
+     TOBN(0x178ca01b, 0x8b2c703c), TOBN(0x605bba53, 0x0ab71a51),
+     TOBN(0x2140948e, 0x3db948d5), TOBN(0xc45b2689, 0x5fb6b8c1),
+     TOBN(0x421f66de, 0xf17b47bd), TOBN(0x57627a5a, 0x2e9b3ee5),
+     TOBN(0xedf3920a, 0x66614339), TOBN(0x7ea61903, 0x4b638a46),
+     TOBN(0x7203d542, 0x3c030643), TOBN(0x7112bb3d, 0x5e631461),
+     TOBN(0x2604eac7, 0x2bc3da9c), TOBN(0x2e4964e7, 0x32d2541b),
+     TOBN(0x940faf46, 0xe8b6482a), TOBN(0x8f772fcb, 0x24d27c9e),
+     TOBN(0x125c34d7, 0xca7c5f88), TOBN(0x9903eadb, 0xd1f47795),
+     TOBN(0x11aaa417, 0xe2147129), TOBN(0x3ccef5c2, 0xf88a0a30),
+     TOBN(0x78d5207a, 0x90283f97), TOBN(0xba1261e9, 0xd25226b6),
+     TOBN(0xbfc79248, 0xd1e7a01c), TOBN(0x373f1cd5, 0x941ab2bd),
+     TOBN(0xf0881e21, 0x19a0668b), TOBN(0x7b793789, 0x1f77bf0a),
+     TOBN(0x49c2769b, 0x63d4523d), TOBN(0xf8df2cba, 0xf0399eaf),
+     TOBN(0x5ae94c69, 0x22a2a74d), TOBN(0xd08f8d45, 0xefd1e193),
+     TOBN(0x64341fc4, 0xc681f376), TOBN(0x3a8e25c8, 0xec918711),
+     TOBN(0xdf35304d, 0x0608f50f), TOBN(0x9b4c6967, 0x9a973742),
+     TOBN(0xb5c1f5d3, 0xbfba043b), TOBN(0xaff4f896, 0xe975f03b),
+     TOBN(0xea1f39bd, 0xae2cbb01), TOBN(0x4cc1c4cb, 0xa62915ff),
+     TOBN(0x5eb4afa3, 0x89e943b8), TOBN(0x8c4d27e5, 0x154e565a),
+     TOBN(0x4e2e5a7e, 0x7f2bced6), TOBN(0x7af408e2, 0x4487f6a3),
+     TOBN(0xe5dacbae, 0x97a60de7), TOBN(0x9774834c, 0x4401b0ad),
+     TOBN(0x7683bb00, 0x8a9113f9), TOBN(0xc6fe7e8b, 0x42b2ba67),
+     TOBN(0xc0c0564d, 0x54e760c8), TOBN(0xf7b05401, 0x118606c2),
+     TOBN(0x554a9b0f, 0xec3cd7b9), TOBN(0xce75ecfb, 0x27916a21),
+     TOBN(0xf6638997, 0x12118abd), TOBN(0x2ba6e754, 0x097da3a7),
+     TOBN(0x1df82085, 0x0fdf9985), TOBN(0xbf73502a, 0x546c864a),
+     TOBN(0xdfde9323, 0xc02d9ce0), TOBN(0x580491e2, 0xe4dd0e7d),
+     TOBN(0xe71522d2, 0xae43b9b4), TOBN(0x876e3627, 0x6a231a41),
+     TOBN(0xfa8ff511, 0xb36362ec), TOBN(0x11c5a9f6, 0x34085959),
+     TOBN(0x272b86f2, 0x9770c62b), TOBN(0xf0626225, 0x7c7e8827),
+     TOBN(0x929168bf, 0xea1e13eb), TOBN(0xdb892971, 0xce59b0f5),
+     TOBN(0x6769e31d, 0x4f826f34), TOBN(0xfa1dd934, 0x0a955cec),
+     TOBN(0x123d9ca2, 0xa294d7ea), TOBN(0x8699063b, 0x4492569b),
+     TOBN(0x6a50eae9, 0xa8dd86c3), TOBN(0x3d757d10, 0x12c06c38),
+     TOBN(0x5a92c2c0, 0x3e41e556), TOBN(0xa64595eb, 0x6330c21a),
+     TOBN(0x70d8141a, 0xe184d925), TOBN(0x8543f2ce, 0xa2f10304),
+     TOBN(0x4559b0a2, 0x9eaca504), TOBN(0xb9843a4b, 0x2617bc9b),
+     TOBN(0x5b28d4ee, 0x1b641003), TOBN(0x3e9af8e1, 0x4ced538a),
+     TOBN(0x3790fe89, 0x7bdf7dc2), TOBN(0xc7c74941, 0xc32549ee),
+     TOBN(0xdcc8295b, 0xabcd2f42), TOBN(0x48b29a4f, 0xead078b6),
+     TOBN(0x8e8b28e3, 0x2040178e), TOBN(0xceff8f3e, 0x971725fc),
+     TOBN(0x4a97b6fa, 0xfcee2cc1), TOBN(0x775df6a9, 0xbac85b56),
+     TOBN(0x32e5cbe6, 0xd28a21cc), TOBN(0xe8b86ada, 0xae2b82db),
+     TOBN(0x44dfbb50, 0x86e38e96), TOBN(0x45d3fe7d, 0x1afc2d4b),
+     TOBN(0x838b356e, 0xd23f620d), TOBN(0x2e8fa8ac, 0x4592fe4b),
+     TOBN(0x1396e1b3, 0x3af5b1d8), TOBN(0x9c0c2ef3, 0xcbf50fb0),
+     TOBN(0xd9efb6c9, 0x836e93e9), TOBN(0xe6eb5870, 0x0899163f),
+     TOBN(0x3a2f6d77, 0xdca00d1b), TOBN(0x36f55f89, 0xb40ba0d6),
+     TOBN(0xf3b1701f, 0x32866e57), TOBN(0xf0768473, 0x59de0f2e),
+     TOBN(0xe55d7aed, 0xab57962d), TOBN(0x45004985, 0x2b60cabb),
+     TOBN(0x8d539d6e, 0xd5498888), TOBN(0x176ce1a0, 0xa5e0ff6a),
+     TOBN(0xcb7c15ef, 0xdc088c50), TOBN(0x90393d7a, 0xc9a9ae2f),
+     TOBN(0xd9c1a140, 0xd396bdce), TOBN(0x4215b78b, 0x6fb2800f),
+     TOBN(0x8939109f, 0x2f76b0df), TOBN(0x0f250897, 0x2adb40a8),
+     TOBN(0x4db0007c, 0x3a86e009), TOBN(0x6ef0ad95, 0xf968a635),
+     TOBN(0x58a82d4b, 0x8eaefa78), TOBN(0xe8a181cb, 0x493604a4),
+     TOBN(0x36c84e34, 0x520d216d), TOBN(0x2b2ef6b5, 0xc666171c),
+     TOBN(0x9469b91f, 0x2ce29d37), TOBN(0x3ecd84e7, 0xc15f20aa),
+     TOBN(0xf1090635, 0x292edd2c), TOBN(0x6d439362, 0x7c3447f6),
+     TOBN(0x51b9a0a9, 0x3eea3fdf), TOBN(0x68e0d1f8, 0x9e57e450),
+     TOBN(0x25d249d5, 0x7380931e), TOBN(0x87f03fad, 0x2011a45b),
+     TOBN(0x89df0324, 0xefde1ca3), TOBN(0x52ae43cd, 0x9a9b4330),
+     TOBN(0xfe48bc64, 0xa1867c1b), TOBN(0xdd874f66, 0x9866920e),
+     TOBN(0x6942a7e4, 0xfcf50251), TOBN(0xf5c10048, 0x9c5f6298),
+     TOBN(0x305183eb, 0x00973d66), TOBN(0x1ce66760, 0x95baf07c),
+     TOBN(0x74c9d971, 0x74822e13), TOBN(0x2ccd7fbb, 0x76b5e6ef),
+     TOBN(0x51688b49, 0xa3e1ca18), TOBN(0x1beb5bbb, 0xa603f2f1),
+     TOBN(0x09a231d1, 0x962534b6), TOBN(0x70417ce1, 0xafa92f75),
+     TOBN(0xb86b6d82, 0xe154bc00), TOBN(0x5a0b19e8, 0x895483e5),
+     TOBN(0xb15f6c05, 0xa0ff1e44), TOBN(0x2938b88a, 0xfdd8615d),
+     TOBN(0x81800a05, 0x971615c3), TOBN(0x6be6d56b, 0xc03d2039),
+     TOBN(0xff3e57d2, 0xc476ce64), TOBN(0x5b509b7b, 0x6f583ee8),
+     TOBN(0x1d92c36c, 0x7c1f5d3b), TOBN(0x1e60b19b, 0xe11df757),
+     TOBN(0x20261501, 0xe37e36f6), TOBN(0xb68a9aaa, 0x29bc86e3),
+     TOBN(0xfba81eaa, 0xf61d23ca), TOBN(0x63440834, 0xd5adaa18),
+     TOBN(0xa80d76ed, 0xa5f93bb8), TOBN(0x3264283d, 0x5a728480),
+     TOBN(0xd6171111, 0xe4b8c48e), TOBN(0x3ee227a1, 0xde557cca),
+     TOBN(0x2bebc09a, 0x3cb59841), TOBN(0x2f8047fe, 0x99bf6205),
+     TOBN(0xb78b243e, 0x4c43845f), TOBN(0x484ac183, 0x46d3b5e0),
+     TOBN(0xa07be476, 0x0314524d), TOBN(0xc0a3aa35, 0x1ab4c447),
+     TOBN(0x2f302d58, 0x9c341f84), TOBN(0x264911a7, 0x84f130ba),
+     TOBN(0x30bed408, 0x3ee64343), TOBN(0xd7d6e92d, 0x5dc5868a),
+     TOBN(0x92074568, 0x80adb3fb), TOBN(0x005ab33c, 0xa133123e),
+     TOBN(0x105119fd, 0x42e1da50), TOBN(0x6987117d, 0xb7f6b1e8),
+     TOBN(0xa2315af3, 0xc2bccb7a), TOBN(0x95ddd3ee, 0x8672c98a),
+     TOBN(0xa9032645, 0x5f48f607), TOBN(0x76861e62, 0xc5273603),
+     TOBN(0x71aaa35f, 0x88817217), TOBN(0x57e95b6c, 0x2892afac),
+     TOBN(0xf65e909b, 0x9e84c791), TOBN(0x257bcc2d, 0xaa52f3b1),
+     TOBN(0xd5f6110a, 0x865c665a), TOBN(0xddc3afe1, 0x30c08b4c),
+     TOBN(0x4df3d04a, 0xefec26fc), TOBN(0xf229bddf, 0xb035af5d),
+     TOBN(0x364913cf, 0xd191b439), TOBN(0xf41b8f6d, 0x5a7fa8a4),
+     TOBN(0x677cc51b, 0x6f6c1219), TOBN(0x593afe4a, 0x148b7f64),
+     TOBN(0x80ffa5ae, 0x0d038ad4), TOBN(0xf44d3df3, 0x36256c8f),
+     TOBN(0x0a3077c8, 0xbc978dce), TOBN(0xf3d9b4b0, 0x745b8317),
+     TOBN(0x8bbf4484, 0xb6b1852c), TOBN(0x0cd02ed4, 0x0e78ff07),
+     TOBN(0x91cb827e, 0x49c24238), TOBN(0x58adaee5, 0xdaa3cb55)},
+    {TOBN(0x07e6ce4d, 0x033fc12a), TOBN(0xba4f98a1, 0x4886f316),
+     TOBN(0xb24b38f3, 0xe66f3f11), TOBN(0xe3f6205a, 0x5ea4bde3),
+     TOBN(0x00705387, 0xa77b998f), TOBN(0x2c9b4457, 0x9549f3b1),
+     TOBN(0xdef6625b, 0x533a61d6), TOBN(0x4eda7e2a, 0x7e4f781a),
+     TOBN(0xe9730aaa, 0xfd120134), TOBN(0xb22b9089, 0xc057309c),
+     TOBN(0x98e79565, 0x84726ce7), TOBN(0x0e1431a0, 0xd635a584),
+     TOBN(0xbd387023, 0xe834ffa6), TOBN(0x64198ddf, 0x036ab1ae),
+     TOBN(0x46e5ebb1, 0x9124b684), TOBN(0xa316fa44, 0x233b3c6d),
+     TOBN(0xec2a9325, 0x84782513), TOBN(0xd67c8ab7, 0x2903d20b),
+     TOBN(0x6b65b262, 0x157f9aee), TOBN(0x547be60c, 0x69f964a2),
+     TOBN(0x001bf327, 0xee0419db), TOBN(0x92fa0800, 0xf20c7005),
+     TOBN(0x1e11e745, 0xcdc1ccda), TOBN(0xa785ec10, 0xe471f822),
+     TOBN(0xbc970210, 0xa1371aa4), TOBN(0xaff481a0, 0x54b5424e),
+     TOBN(0xbcdf91fd, 0x0e64269b), TOBN(0x18bb37bb, 0xb02fc7cf),
+     TOBN(0xd99edd79, 0x6f69d439), TOBN(0x4e27a58f, 0x169514b2),
+     TOBN(0x80eca1ca, 0x66e19ae4), TOBN(0x0470e965, 0x0788696d),
+     TOBN(0xa6b1992f, 0x8c9d34f6), TOBN(0xaf062ffe, 0xa5ed969e),
+     TOBN(0xbca2580d, 0x3a6d7ae2), TOBN(0xf30cd9e6, 0xc8999158),
+     TOBN(0x93e57897, 0x49d1ab0d), TOBN(0xcfa3aa4d, 0x30214280),
+     TOBN(0x0ca8b4fd, 0x0a814831), TOBN(0xdad179db, 0x0b10097c),
+     TOBN(0x63778bfc, 0x3dfdc228), TOBN(0xc0bae0ad, 0xb9648a36),
+     TOBN(0xda8cb8ab, 0x015a99b5), TOBN(0xb045cccb, 0x8366b58a),
+     TOBN(0x74ef8ef4, 0x4164cebd), TOBN(0x41e71fc8, 0xc5e00e5f),
+     TOBN(0x753cf906, 0x4479468e), TOBN(0x78b5223f, 0x332ea72d),
+     TOBN(0x8fc3e370, 0xddebafa2), TOBN(0x15ffcce0, 0x351f9f04),
+     TOBN(0x3fbd5f5c, 0x45b0efdc), TOBN(0xb8216623, 0x0fe3b460),
+     TOBN(0xe8322fbd, 0x533c7db6), TOBN(0xf3866d15, 0x00a243ff),
+     TOBN(0xf1194ae2, 0xa0e5aaea), TOBN(0x3e93eb01, 0xb9287b3d),
+     TOBN(0x528a9e2f, 0x5876d6e8), TOBN(0x93c48f85, 0xd2b622d7),
+     TOBN(0x88d9eac8, 0x3e5411d7), TOBN(0xb7e4a6ba, 0x00a70e91),
+     TOBN(0xaf18e5ba, 0xf1c43b2e), TOBN(0x46578c7e, 0xa2f347de),
+     TOBN(0x19ca736d, 0xf009638f), TOBN(0xa6563f1e, 0xbd1acd29),
+     TOBN(0xdf9bcd3a, 0x2f4126e7), TOBN(0xecc22d13, 0xd62efebd),
+     TOBN(0xd9b29b4b, 0x10943242), TOBN(0x499ffa74, 0x670136f9),
+     TOBN(0xa2a9ad2c, 0x2b889952), TOBN(0x945f306e, 0xfd132dad),
+     TOBN(0xfd05b884, 0x15cebfd7), TOBN(0x653e70af, 0xc7a5627f),
+     TOBN(0xfefc54b5, 0x577dae35), TOBN(0x9d2f0546, 0xaac3a655),
+     TOBN(0xb96bd298, 0xfac31d00), TOBN(0x3328a51c, 0xee69563d),
+     TOBN(0x5e19098e, 0x43195f4e), TOBN(0x657f4ba5, 0xa998010b),
+     TOBN(0x45f29a84, 0x4047ccb6), TOBN(0x833a5443, 0x6e423da6),
+     TOBN(0x97e480c6, 0xca33f42b), TOBN(0x20a51033, 0x06e52a05),
+     TOBN(0x85e87255, 0x0a9be572), TOBN(0xe8bc857a, 0xb988b582),
+     TOBN(0x782495e8, 0xc183c500), TOBN(0xf33a87fd, 0xfee0ae2f),
+     TOBN(0xf069fe20, 0xc64d1dec), TOBN(0x0b6dd98a, 0xf4b08816),
+     TOBN(0x6e6cf298, 0x99229a90), TOBN(0xa6840bc8, 0x1d71d532),
+     TOBN(0x803e5407, 0x71e3a8b7), TOBN(0xd5611ee4, 0x6afd9a0e),
+     TOBN(0xd739ca0e, 0xbbbefa73), TOBN(0x6082dbab, 0xc5ec48b7),
+     TOBN(0xa0ab10df, 0xbbdea0ec), TOBN(0xb1b7ebe4, 0xf1633e03),
+     TOBN(0xfa752496, 0x7be26441), TOBN(0xf52cb1b6, 0x0ef683e6),
+     TOBN(0x1c96401f, 0x39dd611d), TOBN(0x09c5a35b, 0x7bb19083),
+     TOBN(0xa2f002b8, 0x00a5d5a1), TOBN(0x4e300ddd, 0xacf4e8ed),
+     TOBN(0x0d26b600, 0xb4cc58c6), TOBN(0x5a53863a, 0x50062651),
+     TOBN(0x62e64475, 0xad1cac22), TOBN(0x2008653e, 0xc7e11395),
+     TOBN(0xa875ad01, 0xd9479c4a), TOBN(0x3e6cf633, 0x804b30d1),
+     TOBN(0x58b3ef6e, 0xb6b06e46), TOBN(0x74c45dbe, 0xf7b8410b),
+     TOBN(0x02675759, 0xc278458d), TOBN(0xb2ef4956, 0xacd30bd1),
+     TOBN(0x1a4a5773, 0x339aae8d), TOBN(0xa775b952, 0x0c0fe175),
+     TOBN(0x7b39ac1b, 0x5d5d5ac1), TOBN(0x3f183d49, 0x11a511b6),
+     TOBN(0x9524e286, 0x045ac045), TOBN(0x0498d296, 0x4934c52f),
+     TOBN(0x1fec5474, 0x9b636528), TOBN(0xec6f7a37, 0xc3e9b84b),
+     TOBN(0x870b12dd, 0x12ee579d), TOBN(0x2a9a12ab, 0x06dd62d6),
+     TOBN(0xbcd52599, 0x071d7582), TOBN(0x7a36193a, 0xa869c457),
+     TOBN(0xd29e6592, 0xe976ae5b), TOBN(0xe82c8712, 0xadfecd58),
+     TOBN(0xbc83a440, 0xf714686d), TOBN(0xfe19344a, 0x0c21e3ba),
+     TOBN(0x2a32c989, 0xd7a191ae), TOBN(0x00a25163, 0x4e58caca),
+     TOBN(0x2c6501b8, 0xe4a11597), TOBN(0xb3e45d09, 0x7f1891e6),
+     TOBN(0xb7f532b1, 0x659fd516), TOBN(0x99cf64de, 0xa7002930),
+     TOBN(0x56357ed4, 0xf2cd2d4d), TOBN(0xa94cf5c5, 0x3447951f),
+     TOBN(0x26c7f244, 0x76a164be), TOBN(0xbd83e20b, 0xa72e974c),
+     TOBN(0x64e9c241, 0xda31de06), TOBN(0x022bc0f0, 0x1cdb203d),
+     TOBN(0x5eec4fcb, 0x55c0601f), TOBN(0xa1504f91, 0xb168a484),
+     TOBN(0xb9cf98b1, 0x1243026d), TOBN(0x6a009deb, 0xfb3e5a1c),
+     TOBN(0xf1df3752, 0x60657650), TOBN(0xa5bbd8f5, 0xcb1b8d9e),
+     TOBN(0x9e0d9447, 0x81b6af13), TOBN(0x8572cecf, 0x624cb828),
+     TOBN(0x28319d57, 0xd003617a), TOBN(0x175c4766, 0x996fde09),
+     TOBN(0x168514b2, 0x04878e13), TOBN(0x58a541d7, 0xec83a771),
+     TOBN(0xafdaad3b, 0x29fb000f), TOBN(0x1977a8de, 0xc20f56f5),
+     TOBN(0x450faf6f, 0xc5b7ba77), TOBN(0x93253964, 0xe5954518),
+     TOBN(0x11ee0f31, 0x644c3385), TOBN(0x6c24de9d, 0xa8a57bad),
+     TOBN(0xe8ff408c, 0x5533a7ba), TOBN(0x660a74d9, 0xeace56fa),
+     TOBN(0xb4b2543b, 0x8cc2a866), TOBN(0x69f23f18, 0xeffc0cbf),
+     TOBN(0x0db4682a, 0x5308b9b1), TOBN(0xce7fac53, 0x17037e08),
+     TOBN(0xf02098c4, 0x0a885b01), TOBN(0xd375c03d, 0xb2e4eb6e),
+     TOBN(0xb6d4f6c1, 0x70d4b81b), TOBN(0xa2b5e9cd, 0x7ce5f297),
+     TOBN(0x787229cc, 0xb8a233c3), TOBN(0x44ef5dd8, 0x3419867f),
+     TOBN(0x00316d22, 0x79d3d8dc), TOBN(0xdcf32003, 0x90bb1410),
+     TOBN(0x62ad0125, 0x835d2264), TOBN(0x768c8658, 0x0ed6605c),
+     TOBN(0xa31abf17, 0xfc44e760), TOBN(0xc91848ac, 0xbb22e570),
+     TOBN(0xad1882f5, 0xb16c805f), TOBN(0xb74cc0ed, 0x7ccf9e9a),
+     TOBN(0x9635af23, 0x7b122dd7), TOBN(0x48a20903, 0x5c3cd11b),
+     TOBN(0xa24820b6, 0x34c1eb54), TOBN(0x31a3c330, 0x5284dcb3),
+     TOBN(0xd966cf59, 0x069c2ee4), TOBN(0xa74eec6f, 0xb3ff9335),
+     TOBN(0xf44eeb99, 0x4620e739), TOBN(0x7663a596, 0xf4159a9a),
+     TOBN(0x79c54f42, 0xb4b745b1), TOBN(0xa8d34937, 0x59db9482),
+     TOBN(0x35fad92a, 0x579501df), TOBN(0x1d81bbe3, 0x289d7c2b),
+     TOBN(0x1d60a274, 0xddf3d371), TOBN(0xf08e23e5, 0x46df1233),
+     TOBN(0x4bc4c079, 0xf3a95f04), TOBN(0x0b43e660, 0xa8626015),
+     TOBN(0xedb31526, 0x246ae3ac), TOBN(0xa8536eb6, 0x41247209),
+     TOBN(0x6893a7df, 0xfdfacc62), TOBN(0xf3de226f, 0xc557777b),
+     TOBN(0xa68c8d8c, 0x0d7f4265), TOBN(0x55a628eb, 0x15c685e3),
+     TOBN(0x8cad8f87, 0x5ecec6ee), TOBN(0x4aefda2d, 0x2a06c242),
+     TOBN(0x46a21033, 0x57f00a7d), TOBN(0x91910c3a, 0x7ed125cf),
+     TOBN(0x0b7f0e4a, 0x541165d2), TOBN(0x15ed1b93, 0x553eeec1),
+     TOBN(0xadf5b4db, 0xd24e020b), TOBN(0xf05307a3, 0xa7493b8b),
+     TOBN(0x725548dc, 0x62070042), TOBN(0x74d71526, 0xc274916a),
+     TOBN(0x3269851e, 0x6f098d01), TOBN(0xb2e01cb7, 0xf9ec928c),
+     TOBN(0x96c2d922, 0x2b4368cd), TOBN(0x8eb84b03, 0xa0ec45d1),
+     TOBN(0x733ad068, 0x26e5b3ac), TOBN(0xced3679e, 0x93c5a962),
+     TOBN(0x23c6a22d, 0xdd6eb876), TOBN(0xbd98ad9a, 0xa343dc3b),
+     TOBN(0x61933d03, 0x56054515), TOBN(0x4a64b769, 0xe45cd744),
+     TOBN(0x617a63f3, 0x12586de6), TOBN(0x04984a9f, 0x7976e7d1),
+     TOBN(0xb00ba446, 0xcd2a0a6b), TOBN(0x5b64e7f5, 0x7d059d46),
+     TOBN(0x8801ce04, 0x6a4b08e6), TOBN(0x66f31460, 0xb13bbe9c),
+     TOBN(0xb174e887, 0x4d87114e), TOBN(0xb2fee192, 0xf348e94f),
+     TOBN(0xfede2283, 0x7c822d05), TOBN(0x8d50c49c, 0x8f82b14a),
+     TOBN(0x21ea4f6e, 0x0f5f1b5d), TOBN(0x68627cf0, 0xc1818095),
+     TOBN(0xc1c0650c, 0x8a7b2458), TOBN(0x82ab62bb, 0x8bbc6aff),
+     TOBN(0x7b3665d7, 0x6ce6989d), TOBN(0x2ad7991f, 0x7579e973),
+     TOBN(0x701287aa, 0x7e9e8510), TOBN(0xb296a038, 0x0a18da53),
+     TOBN(0xf8c3af86, 0x2bf00fdc), TOBN(0x55776951, 0xb220dc06),
+     TOBN(0x4e6e4b4f, 0x7d7dd541), TOBN(0x812feac7, 0xfe5c7431),
+     TOBN(0x6bdfa63e, 0x340297b1), TOBN(0xecc11e55, 0x98009910),
+     TOBN(0xee4c6165, 0xb25b98c0), TOBN(0x8a07b0d2, 0x02c5939c),
+     TOBN(0x9b36c176, 0x23147c40), TOBN(0x396054a2, 0xde2eab3a),
+     TOBN(0x1f41010b, 0x2c439171), TOBN(0x3ff85ee6, 0xe8139388),
+     TOBN(0x4ada4c7d, 0x8f077633), TOBN(0x9976011a, 0x824e6023),
+     TOBN(0xa2501197, 0xeaf49f63), TOBN(0xdff2122f, 0xd60b0c4c),
+     TOBN(0x1a6a3abb, 0xbab3df90), TOBN(0x854bbcc6, 0xb66ffd5f),
+     TOBN(0x525964a9, 0x728572c1), TOBN(0x8a4923a2, 0xfadbd14b),
+     TOBN(0x03830df9, 0xcd90b61b), TOBN(0xcdb00f4a, 0x79c2afe9),
+     TOBN(0xff2f84bb, 0xa6c3f13d), TOBN(0xdee45c30, 0x5c0de4dd),
+     TOBN(0x3e1dd748, 0xfba2e933), TOBN(0xe9dcc690, 0x7c51124c),
+     TOBN(0x725177af, 0x28e11f62), TOBN(0xc8e120a1, 0x8a64fdf5),
+     TOBN(0x82ab73df, 0xf24fb357), TOBN(0x2d5d1618, 0x44724879),
+     TOBN(0x09627e26, 0x96c66b86), TOBN(0x1d547cae, 0xc81d38c1),
+     TOBN(0xbe8991a4, 0xd0f76658), TOBN(0xf1508662, 0xcf11a976),
+     TOBN(0xa5dafebd, 0x3be3e582), TOBN(0xd9f545ba, 0x07399295),
+     TOBN(0xd9f564a4, 0x676f9598), TOBN(0xec00bddf, 0x9294431e),
+     TOBN(0xc1971113, 0xc1fdc758), TOBN(0xe32f572f, 0x69a001de),
+     TOBN(0x048d7776, 0xb907f044), TOBN(0x4a474e6e, 0x5ca10e67),
+     TOBN(0x6476dd40, 0x3039a4b7), TOBN(0x85de9baa, 0x018ee2b8),
+     TOBN(0x0c945aeb, 0xfd7365f2), TOBN(0x2b47dc0d, 0x96c7267e),
+     TOBN(0xb12b48a7, 0x0410de25), TOBN(0x3ba7a11a, 0x177242c1),
+     TOBN(0x44e6cee7, 0x6504ff87), TOBN(0xb2605ff6, 0x9d19f26c),
+     TOBN(0xa56bb589, 0x50fb1b6b), TOBN(0x98dc1180, 0x71d2fb53),
+     TOBN(0xa4fdc6f8, 0xa1b78e04), TOBN(0xbea745b0, 0x39d9349d),
+     TOBN(0xac474229, 0x62d7eb73), TOBN(0x7b765138, 0x8b808ac3),
+     TOBN(0x882370af, 0xd0ca219f), TOBN(0x28dcff7b, 0x9d1c23e8),
+     TOBN(0xc6dc70eb, 0x3872f0a9), TOBN(0xb2f21248, 0xdfb642b1),
+     TOBN(0x86838f0f, 0x65bbdfc9), TOBN(0x1d04a8b5, 0x40b28364),
+     TOBN(0xd4fa229d, 0x1e4d8d58), TOBN(0x74ee5e20, 0xfad0a9cd),
+     TOBN(0x25a59aae, 0x5a40ec4a), TOBN(0x73be91f3, 0x3727d6cd),
+     TOBN(0x9c31405e, 0xd63f64eb), TOBN(0x9943c34c, 0x91d2f1c1),
+     TOBN(0x70ad75d7, 0x4fcdbf34), TOBN(0xa6ce7145, 0xb239e00d),
+     TOBN(0x136bceed, 0xcd04b9e9), TOBN(0xb9ebeb8d, 0x44ed7f96),
+     TOBN(0x068b43a5, 0x5d136280), TOBN(0x2e1b6624, 0x4c559b6b),
+     TOBN(0xe3808e72, 0x5472d67b), TOBN(0x73450378, 0xce74546e),
+     TOBN(0xc1b1b66e, 0xea1d58f7), TOBN(0x2b576e4f, 0xe34c2a7d),
+     TOBN(0xc2b1bdf7, 0x2f732803), TOBN(0x37aea390, 0x9f8e48c3),
+     TOBN(0x8bbbb61e, 0x944f1cf3), TOBN(0x5cc7ccaa, 0x86c59643),
+     TOBN(0xaf4c18e3, 0x8d5b000a), TOBN(0x23b0edd0, 0x2b6d561c),
+     TOBN(0x11b67ef0, 0x0d6cbe27), TOBN(0x679d789b, 0xb1b50e9d),
+     TOBN(0xda198336, 0x372c4015), TOBN(0x5da50baf, 0x65781ea7),
+     TOBN(0x00b3a6d4, 0x550201ba), TOBN(0x988b89f7, 0xecfffc72),
+     TOBN(0xf2f08a09, 0x25948852), TOBN(0x4036bbb7, 0x406d1a34),
+     TOBN(0x1cd57f08, 0x23d2dd87), TOBN(0x11a4387e, 0x4704dac3),
+     TOBN(0xb8091a7a, 0xc5413b59), TOBN(0xe58940c6, 0x09b5fa71),
+     TOBN(0x70fd5154, 0x6a75397c), TOBN(0xea544375, 0x5c59ff75),
+     TOBN(0x15e5bed3, 0xac25bd3a), TOBN(0x1bed3c33, 0x6b17971e),
+     TOBN(0x046fc1cd, 0xbaa96968), TOBN(0xda1b010d, 0x7090256f),
+     TOBN(0xeec55752, 0xe6677d20), TOBN(0x8eac5d06, 0x24c9bb42),
+     TOBN(0xc2f6270e, 0x8f4120e0), TOBN(0xd9ae9fff, 0x07748faa),
+     TOBN(0x5a1b2634, 0xe8f7b7af), TOBN(0x1fcd743d, 0x81b1612d),
+     TOBN(0x6b065aa2, 0x3d420398), TOBN(0xe758b9c7, 0x41e06643),
+     TOBN(0xe1e52b53, 0x7f111b3b), TOBN(0xb9ee0a5d, 0x83498731),
+     TOBN(0x49c19631, 0xea8154f4), TOBN(0x8f5a3479, 0xe1c08746),
+     TOBN(0xe032d7c1, 0x65dd5561), TOBN(0x6c3420fe, 0x442bef09),
+     TOBN(0x1d390561, 0xa64eff47), TOBN(0x0d8fbf07, 0x902763bf),
+     TOBN(0x0262f26d, 0xa4bc6856), TOBN(0x7c1b59a7, 0x9f4f2101),
+     TOBN(0x663d9b38, 0x51240642), TOBN(0x39a0b4c2, 0x77ce53cc),
+     TOBN(0x1c896beb, 0x61f5e655), TOBN(0x75c4c049, 0x9f4bfd2d),
+     TOBN(0xb8799a15, 0x10111b02), TOBN(0xc76f8641, 0xa4c2fa0e),
+     TOBN(0xd77ff7fd, 0x185fc036), TOBN(0x53212bd6, 0xf5acbd16),
+     TOBN(0x4ef7431f, 0x0408cff8), TOBN(0x45aa9d99, 0xfb082c4b),
+     TOBN(0x22c1fa8e, 0xf0438565), TOBN(0x8e3a2ee3, 0x4cb43ab5),
+     TOBN(0x457df338, 0x232081d1), TOBN(0xd1293d9b, 0x482ff47b),
+     TOBN(0x802a300e, 0x68106365), TOBN(0xa8f27aa1, 0xe51978c9),
+     TOBN(0x6ca0edda, 0xa6a6a4d3), TOBN(0x4cab1223, 0x24c9526a),
+     TOBN(0x26234b2e, 0x56730245), TOBN(0x9a04c15d, 0xe1b54be4),
+     TOBN(0x153fb6cf, 0xee89282b), TOBN(0x5901ca12, 0xd79d81ad),
+     TOBN(0xbe6853d8, 0x7c3c5ffd), TOBN(0x16d3efb5, 0x35e1942a),
+     TOBN(0x3491f207, 0x3b56bece), TOBN(0x0d75e0c1, 0x5b818cfd),
+     TOBN(0x79a0e319, 0x40969df4), TOBN(0x75e4632c, 0x9ae34b31),
+     TOBN(0x4a47585c, 0x68e8df30), TOBN(0x4a4a40e4, 0x2a495467),
+     TOBN(0x92b8a6f5, 0x2762eae9), TOBN(0xa204cd80, 0xc9a3d133),
+     TOBN(0xa441ecfd, 0xd1ff23cf), TOBN(0xd06feb58, 0x4550ee57),
+     TOBN(0xe14ca6a1, 0xdc032002), TOBN(0x9a780e57, 0x05505a36),
+     TOBN(0xad93852e, 0x08cb2b29), TOBN(0xa54deaab, 0x008b00c4),
+     TOBN(0x8cd2c71a, 0xe1042350), TOBN(0x2014b85d, 0xa8915596),
+     TOBN(0x1228b3e4, 0x97ddd1dc), TOBN(0xa97282ce, 0x4a3b3ab7),
+     TOBN(0xd978cd73, 0x0f1559ad), TOBN(0x2e877fa2, 0x86b14d3c),
+     TOBN(0x01d3dc94, 0x3660f189), TOBN(0x90ad950d, 0x0d2b4ddd),
+     TOBN(0xa8d26760, 0x92245e3e), TOBN(0xfc1bf8d5, 0x4964245d),
+     TOBN(0x31206c72, 0xac3d97eb), TOBN(0x39dfd972, 0xa58c64cb),
+     TOBN(0xd631907f, 0x7efbbd16), TOBN(0x4fdc84e2, 0x174f1fd5),
+     TOBN(0xe81e89b3, 0x5c277996), TOBN(0xcb277b4e, 0x5f79f1de),
+     TOBN(0x2eff44b3, 0x2ed1962c), TOBN(0xbe36a640, 0x72883505),
+     TOBN(0x14a1fac0, 0x545e69a0), TOBN(0x76dbbcbd, 0xd6f658b9),
+     TOBN(0x0720c584, 0x78e2e86d), TOBN(0x52fccffb, 0xcaeead35),
+     TOBN(0x06f28c72, 0x587fd1b2), TOBN(0xec36a912, 0x9e48bf69),
+     TOBN(0x74874436, 0xdaa3cdbd), TOBN(0xb3f7409f, 0xcdc2f2a3),
+     TOBN(0x0e50d7fa, 0x1951c078), TOBN(0xd97ff34e, 0xee8949f0),
+     TOBN(0x00db635e, 0x742d7b1d), TOBN(0x5c0b280e, 0x29f0d0f9),
+     TOBN(0xafa7e616, 0xeabf9b35), TOBN(0x7341e2c7, 0x2c8a76e8),
+     TOBN(0x9679e34d, 0x2e96f198), TOBN(0x8c2661c0, 0x90ee26ca),
+     TOBN(0x9c6dab35, 0x67a6516e), TOBN(0x7c8edc4b, 0x46b4b34f),
+     TOBN(0xc502cf2f, 0x2afba4fe), TOBN(0x76847ae0, 0x6776dbf1),
+     TOBN(0xace02706, 0xa2c3c83e), TOBN(0x0012645f, 0x4601c550),
+     TOBN(0x1940e14a, 0xef6189bd), TOBN(0xba7f615f, 0x2cdf5e89),
+     TOBN(0x698101aa, 0x438a3781), TOBN(0xf568a45d, 0xa9e22357),
+     TOBN(0x83af640e, 0x1f913210), TOBN(0x529a29fd, 0x8d505edc),
+     TOBN(0xdf3d3090, 0xd6b0c85a), TOBN(0x46e23886, 0x6897ea43),
+     TOBN(0x97cca980, 0x416577ae), TOBN(0x1f5a96a8, 0x9aa08fc3),
+     TOBN(0xcb014b33, 0x56c05c30), TOBN(0x1944765a, 0x05ec9be4),
+     TOBN(0x2d6789cc, 0xddc4371d), TOBN(0xd768f5a6, 0xf3618fc2),
+     TOBN(0x77065e11, 0x3da93c1c), TOBN(0x4ea3fbc3, 0x0e27b3eb),
+     TOBN(0x7c1bfba0, 0x11ba30e9), TOBN(0xfc6fba67, 0x1036ebe6),
+     TOBN(0x0053a30c, 0xd3231aed), TOBN(0x7f0613d9, 0xee3ac524),
+     TOBN(0x95ec2fd9, 0x63093df6), TOBN(0xfbc63768, 0x7c0eea52),
+     TOBN(0xf767b286, 0x8b64ea48), TOBN(0x6959b0ec, 0xf75bc633),
+     TOBN(0x47e34c3b, 0xc9f63154), TOBN(0xd616b19f, 0xa524bc76),
+     TOBN(0xefc9bb54, 0x632ac100), TOBN(0xd9abba10, 0xb4d96a7d),
+     TOBN(0x3b7dd91a, 0xfe2ad7e8), TOBN(0x29134cd7, 0xb4ebf343),
+     TOBN(0x49d1c305, 0x152864fd), TOBN(0x3afd83d0, 0x80efc220),
+     TOBN(0x3552517e, 0x3f2f0d27), TOBN(0x0a2b5006, 0xfda48969),
+     TOBN(0x568863ed, 0x3c3e8ec9), TOBN(0xd99d5c62, 0x891edec9),
+     TOBN(0xb0ddc129, 0xd1c9d6ee), TOBN(0x373dad74, 0x57db23b4),
+     TOBN(0x7c178b0b, 0xb416c7df), TOBN(0x77431dac, 0x4f8a7153),
+     TOBN(0xf5288888, 0x41c1367e), TOBN(0xf1518939, 0xb838c91c),
+     TOBN(0x81e17838, 0x541f3281), TOBN(0x70030244, 0x65b2bde5),
+     TOBN(0xdc309424, 0x7350251c), TOBN(0xfac0c6ad, 0x7c811130),
+     TOBN(0x3817aa1a, 0x6a141269), TOBN(0x1aa5a92f, 0xe10b4a6d),
+     TOBN(0x996cca7f, 0x34648a96), TOBN(0x517a25b9, 0x4e2a4f52),
+     TOBN(0xff95ac42, 0x38b1547c), TOBN(0x01d981b6, 0xd9b9cd4f),
+     TOBN(0xcc34d15e, 0x88d60eba), TOBN(0x45851bf4, 0xa0ea1a51),
+     TOBN(0x5d5f9b30, 0x82854ee0), TOBN(0x914be21f, 0x176ea156),
+     TOBN(0xecac86d1, 0x2a05c368), TOBN(0x255cb9c0, 0x73a666a8),
+     TOBN(0x5e4799d9, 0x78c0eec5), TOBN(0x40ed8989, 0x8fc05a71),
+     TOBN(0x54888ac2, 0x8ae03edd), TOBN(0xef3e9865, 0xa83b554b),
+     TOBN(0x47b41822, 0xb7612fe4), TOBN(0xf6e16fd5, 0x8f76cd2e),
+     TOBN(0x091c7b12, 0xa977b5dd), TOBN(0x7051bf6b, 0x8f99d4aa),
+     TOBN(0x9f737902, 0xfed218fe), TOBN(0xd8112477, 0xb752c612),
+     TOBN(0xbb45c287, 0x18d13bd3), TOBN(0xbbf3a894, 0x23c6dd1a),
+     TOBN(0xc8171c5e, 0x13b9cf87), TOBN(0x2dfc7792, 0x34f5348d),
+     TOBN(0x9b9a662d, 0x985cabd4), TOBN(0x588a6ebc, 0x4d971de0),
+     TOBN(0xda9fd894, 0x574cba64), TOBN(0x7e0f0cca, 0x651e6e67)},
+    {TOBN(0x88ca276c, 0x4b8bceb8), TOBN(0x6d4ec101, 0x752d1106),
+     TOBN(0x2ad98063, 0xf834dcbf), TOBN(0x4da81d19, 0xdfff19d0),
+     TOBN(0x4ccc7cd2, 0x3a9828ff), TOBN(0xf1e389b0, 0x2e64b332),
+     TOBN(0xe2fb6a6c, 0x7308b81c), TOBN(0xc6df66b2, 0x5bcc0ac6),
+     TOBN(0x5ccb8c75, 0xe1c58c80), TOBN(0x2ba9de04, 0x83fcc95a),
+     TOBN(0xccdeb0ee, 0xdfccbcf9), TOBN(0x1d667d4f, 0x70f3d3ad),
+     TOBN(0xc6aa14a5, 0x36269820), TOBN(0x329a308b, 0x0fe87940),
+     TOBN(0x39869970, 0xede5cfb2), TOBN(0xc33c3068, 0xf601bb2c),
+     TOBN(0x3087444a, 0xa1a8781b), TOBN(0x6cb5b706, 0x5cff3cbf),
+     TOBN(0x7673a8e4, 0x83082714), TOBN(0xc4bce015, 0x0842a792),
+     TOBN(0xae71a033, 0x53e2a531), TOBN(0x147b28f8, 0x8b5315f9),
+     TOBN(0xcc460133, 0x6c5ab37a), TOBN(0xb1dd088b, 0x540dde16),
+     TOBN(0xec250455, 0x11c09289), TOBN(0x83042ba7, 0x164079c9),
+     TOBN(0x4881640c, 0x6e3879a2), TOBN(0x77c5babc, 0x802452ee),
+     TOBN(0x7a7759a6, 0x7088f360), TOBN(0x02da352c, 0xb74be7e9),
+     TOBN(0x15800cdb, 0xe0338289), TOBN(0xad69f7c9, 0x501688c6),
+     TOBN(0xb7d35063, 0x57ae1213), TOBN(0xd536753a, 0x97024ecd),
+     TOBN(0x9d680716, 0x24938196), TOBN(0xac1bee4c, 0x44ed6d4e),
+     TOBN(0x6dd9c9bf, 0x33e95503), TOBN(0x5ee9f1fd, 0x88fc1c3d),
+     TOBN(0x4a701ff4, 0x21654473), TOBN(0x9a316450, 0xbd2ffe36),
+     TOBN(0xe9130a63, 0x103b5fa2), TOBN(0xe97f7120, 0x8eee983b),
+     TOBN(0x54b7f85b, 0xe8749cba), TOBN(0x69976910, 0xbb1bca55),
+     TOBN(0x9ec4034f, 0xf4e621d3), TOBN(0xaad567ed, 0x695e17da),
+     TOBN(0x7647f054, 0xcedb2ea8), TOBN(0xf85f944c, 0x09fc7433),
+     TOBN(0x30af23b3, 0xb95eeddd), TOBN(0xfd1d565a, 0x89985f3d),
+     TOBN(0xfbb53173, 0x4c254738), TOBN(0xb07ba56a, 0x171170a4),
+     TOBN(0x5069882c, 0x294d55d1), TOBN(0xae0385c4, 0x792694c1),
+     TOBN(0x0a0c7927, 0x11225dc6), TOBN(0xadcc5f08, 0xe22867c9),
+     TOBN(0x164ac67f, 0xaee03999), TOBN(0x4de174d3, 0x79ff7f91),
+     TOBN(0x063e4943, 0x548da6ea), TOBN(0x5264880b, 0xdb7ccdf7),
+     TOBN(0x4a18f34b, 0x49b992cc), TOBN(0xe16b6f4d, 0x14065870),
+     TOBN(0xd32479ac, 0x4cdb0e21), TOBN(0xce8151f6, 0x162bc9f8),
+     TOBN(0x0f8d9a2f, 0xe8f78545), TOBN(0x091643db, 0x3145b086),
+     TOBN(0x5915a582, 0x23a1bcc9), TOBN(0x97348efd, 0x8a280fc7),
+     TOBN(0x3f9d6236, 0x65eccf5d), TOBN(0xd1a34937, 0x01ac8146),
+     TOBN(0x1b8e5128, 0x8ad0d5c1), TOBN(0x5cbcc9ef, 0xd581dd11),
+     TOBN(0x947ceaff, 0xed059f1d), TOBN(0xf5754d03, 0x7460a186),
+     TOBN(0x37698fa6, 0x0164ff7b), TOBN(0x630900d2, 0x35805339),
+     TOBN(0xe467a6be, 0xeddd6bbc), TOBN(0xc53bffec, 0x5e36b12e),
+     TOBN(0x06dfd3f9, 0xf831fc7d), TOBN(0xd995fcc4, 0xdaef86ac),
+     TOBN(0x7d148468, 0x32d5b2e3), TOBN(0x7796b94c, 0x6335f566),
+     TOBN(0x693983d6, 0x6769b8bd), TOBN(0xff0306aa, 0xed5244fa),
+     TOBN(0x2e90d41a, 0x89b8e801), TOBN(0x1af09d86, 0x39e732f3),
+     TOBN(0x96d14e1f, 0x320ccb1d), TOBN(0xbaf21c6f, 0xc05dcece),
+     TOBN(0x8ae82a1c, 0xc216cf37), TOBN(0xac437f45, 0x773828bf),
+     TOBN(0x8c12ff18, 0x9d51a85b), TOBN(0xfeb563be, 0x34c16578),
+     TOBN(0x9d9353b6, 0xc6706966), TOBN(0xcdc6eb5a, 0x0cda8733),
+     TOBN(0x033c186e, 0x3e4953db), TOBN(0x2ba46a66, 0xb2e37f7c),
+     TOBN(0xb32115e2, 0xb9f3ee06), TOBN(0x1bc12cec, 0xdd6346a9),
+     TOBN(0x6b9c2142, 0x321242fe), TOBN(0xcf9b9bb3, 0x5c68ea06),
+     TOBN(0x7fe554ac, 0x920d49bc), TOBN(0x90b3a9b4, 0x37aedebb),
+     TOBN(0xacb181e0, 0x7695af86), TOBN(0xd1c99c55, 0xfd567fea),
+     TOBN(0xb7c18083, 0xfccf76eb), TOBN(0xc693bdbb, 0xf93113a3),
+     TOBN(0x215ff05d, 0x66e03205), TOBN(0x4424aaea, 0xf76d2a12),
+     TOBN(0xb23f2782, 0xe7f30891), TOBN(0xad814d5e, 0x062db479),
+     TOBN(0x347ec1d0, 0x4aea78c3), TOBN(0x3d0f0a7e, 0x6a2332f2),
+     TOBN(0x02ecefa6, 0x8ad9e323), TOBN(0x16c81248, 0x0d45e0c9),
+     TOBN(0xd4b6253d, 0x2757306c), TOBN(0xe90203a3, 0x81e42d04),
+     TOBN(0xbcef10fb, 0xc13782f0), TOBN(0x823efe5d, 0x156267d4),
+     TOBN(0x18add11a, 0xfddb0092), TOBN(0x27068a29, 0xb104561a),
+     TOBN(0x7eb7f516, 0xda0abf3e), TOBN(0x3c92ac94, 0x61b3381f),
+     TOBN(0xbad7320e, 0xd3418870), TOBN(0xbab7a126, 0x07dbe066),
+     TOBN(0xe7ce59be, 0x2def303f), TOBN(0x0bf1f237, 0x2d1e0c9f),
+     TOBN(0x12c18d1e, 0x38f418dc), TOBN(0x7fcc5e3e, 0xb85bb676),
+     TOBN(0x0bcf25ad, 0x1b038ac6), TOBN(0x35388760, 0xddf1becb),
+     TOBN(0x5734bf37, 0x8a1ad137), TOBN(0x92f3a250, 0xb7645056),
+     TOBN(0x6ed926a4, 0x718a5ace), TOBN(0x8e63f0a2, 0xb967f1cf),
+     TOBN(0x6d9cccc9, 0xd835fe33), TOBN(0xb1b5efee, 0x31f82e18),
+     TOBN(0x997aa2a4, 0x24f2c6b1), TOBN(0xde87114f, 0x9e536a91),
+     TOBN(0x01938bd2, 0x0f819ec8), TOBN(0x012e9031, 0xef772a43),
+     TOBN(0x1578eb4c, 0x77aa9256), TOBN(0x052b4088, 0x61a0c8ed),
+     TOBN(0x1153a330, 0x6ab5a380), TOBN(0xa3e7f085, 0x132f5675),
+     TOBN(0x5e946e00, 0x909b8a41), TOBN(0x55f7d231, 0x16a3c156),
+     TOBN(0xcd952464, 0x8ac8f8e3), TOBN(0x7c5184d4, 0xcd8d67f7),
+     TOBN(0xb3468964, 0x39ef93a7), TOBN(0xf4aa0b7e, 0x4e9058c8),
+     TOBN(0xa409403e, 0x4b7c713f), TOBN(0x9d55e33c, 0x41a83e50),
+     TOBN(0x9efee704, 0x7e1754b8), TOBN(0x54085471, 0xb1c0027b),
+     TOBN(0xc5e7a6fa, 0x45af4e6d), TOBN(0xb4d3cd58, 0x30048569),
+     TOBN(0xd2c20014, 0xf3ae8e79), TOBN(0xd0b6af13, 0x849f3f23),
+     TOBN(0x3a1db915, 0x17982a8c), TOBN(0xea3c8099, 0xf9ffcf90),
+     TOBN(0x25d9eb82, 0x7bada472), TOBN(0xff84d98c, 0x09afd498),
+     TOBN(0x5e2c1ffe, 0x56ff21f4), TOBN(0xafd07201, 0x2f2f3a94),
+     TOBN(0xb0227fe6, 0xcdb673bc), TOBN(0x58fc0e7e, 0xfe8d7326),
+     TOBN(0xb988d3eb, 0x191bfd4d), TOBN(0x82499093, 0x2474d8b6),
+     TOBN(0xd1ef53cb, 0x68caff21), TOBN(0x3cff018c, 0x5074160a),
+     TOBN(0x609a4688, 0x98f982fc), TOBN(0xee5caaac, 0x562a099e),
+     TOBN(0xf650365b, 0xf8c6cfd7), TOBN(0x2652aa23, 0x9cbc10ee),
+     TOBN(0x904fd66e, 0x6ab86f4e), TOBN(0x6a25bbc3, 0x2d82f3d8),
+     TOBN(0xd3e6ecad, 0x19c7a275), TOBN(0x05ed0451, 0x3604b2dd),
+     TOBN(0xdd1d87e2, 0x00c71863), TOBN(0xd9fc8793, 0x8cd23356),
+     TOBN(0x3337f8ba, 0x0036b81f), TOBN(0x63b5a762, 0xb5300622),
+     TOBN(0x4cf696f1, 0xce8800e3), TOBN(0x12cb3261, 0x07e3cbc3),
+     TOBN(0x18eac953, 0x0fa12b5b), TOBN(0x45ccf073, 0x77d159b5),
+     TOBN(0xa7480444, 0x6e844a0d), TOBN(0x4404e6c6, 0xd77d1c18),
+     TOBN(0x003e43a6, 0xce1af18f), TOBN(0x8a828081, 0x17fdffcc),
+     TOBN(0x91b63c11, 0xcabf3d17), TOBN(0xa4dedc21, 0xad26f286),
+     TOBN(0x6bf62b69, 0x1a2b1579), TOBN(0x3b67b87b, 0xceeb29ff),
+     TOBN(0x451ffadb, 0x40d4b996), TOBN(0x10c6ae50, 0x080978f8),
+     TOBN(0x959d47e2, 0x2c242dc5), TOBN(0xced9e922, 0x5423e158),
+     TOBN(0x9a212d4c, 0x8d8a68f1), TOBN(0xeff3d644, 0x3708393f),
+     TOBN(0x43f51810, 0xfbaffded), TOBN(0x3886ccb4, 0x0f6fd7c3),
+     TOBN(0xb939247b, 0x13c31946), TOBN(0xbc1ee613, 0xaa1fd72a),
+     TOBN(0x6d40140a, 0x631fd790), TOBN(0x9382e3ba, 0xd26b3fd9),
+     TOBN(0xff414370, 0xb3af96c3), TOBN(0x38c813cf, 0xe0ea9ad6),
+     TOBN(0xf8844c3c, 0x157594da), TOBN(0x2a7b514f, 0xcac628bd),
+     TOBN(0xc023e4e2, 0xc08c5107), TOBN(0x6c164496, 0x3f2722fe),
+     TOBN(0x842e1d06, 0xc03a22ad), TOBN(0x5dbc2865, 0x37ddae0d),
+     TOBN(0x46dfc88d, 0x0342bc72), TOBN(0x873c805c, 0xa4a3c65c),
+     TOBN(0xd202853b, 0x60aa5c14), TOBN(0x1dc35d34, 0x3850cc05),
+     TOBN(0x8014357e, 0x0cabccfd), TOBN(0x1aa44ce9, 0xc5a5225a),
+     TOBN(0xa3cef920, 0x3a8444b4), TOBN(0xcf3f91b3, 0xc95384b1),
+     TOBN(0x1d625ba1, 0xc9e5da54), TOBN(0xbf1fba37, 0xb1d0f46a),
+     TOBN(0xdcef4fad, 0xfb3f4885), TOBN(0xa49debb2, 0x3267f912),
+     TOBN(0x6417d37a, 0x1e121cb8), TOBN(0xa6d871fc, 0x533e94c9),
+     TOBN(0x89f80208, 0x2e4834fb), TOBN(0x27e83f0f, 0xb353452f),
+     TOBN(0xaf009f3c, 0xe1f8f322), TOBN(0xa5b77a77, 0x89319fd8),
+     TOBN(0x0a89e741, 0xedf71900), TOBN(0xd679b841, 0xd514d93f),
+     TOBN(0x8878577f, 0xb0a03702), TOBN(0xc9607b78, 0x85a209ae),
+     TOBN(0xb7bd0616, 0x59432a28), TOBN(0x0da060a2, 0xed567145),
+     TOBN(0x44e35a7a, 0x1a449f52), TOBN(0x9c9a2c82, 0xbbaccc0f),
+     TOBN(0x83abd436, 0xd83701f4), TOBN(0x56e8bfe8, 0x4bb9cbe8),
+     TOBN(0x5b545cc8, 0xc631cd1e), TOBN(0x6d03426f, 0x955aca7d),
+     TOBN(0x049fc9fa, 0x2f8db817), TOBN(0xfcec1799, 0xdc59675f),
+     TOBN(0xa00ed392, 0x0455f095), TOBN(0x6d7cfa5f, 0xe5096b18),
+     TOBN(0x2cda5cae, 0xe30ae90b), TOBN(0x2cc34290, 0xcaabea0d),
+     TOBN(0x564afcd9, 0x41e67856), TOBN(0x210c7a09, 0xcf6ef8b7),
+     TOBN(0xc316d352, 0xf82a591d), TOBN(0x5fe8cc4d, 0xab43d2a1),
+     TOBN(0xd8ebce97, 0x8b4e9470), TOBN(0x26c78f44, 0xba321a07),
+     TOBN(0xa63f4b34, 0xd75e509c), TOBN(0x9122bbc5, 0xb9a6c63b),
+     TOBN(0x8bf792a3, 0x17942443), TOBN(0x95b05d68, 0x7f4f70f9),
+     TOBN(0x57d7dee5, 0x13b70dc8), TOBN(0xe84259ed, 0xfc376fdd),
+     TOBN(0xf8c4c4ff, 0xe3e313b4), TOBN(0xf8e2d3da, 0x13fa8ff1),
+     TOBN(0x9692c390, 0xf8e4eede), TOBN(0x3b514551, 0x0e95a902),
+     TOBN(0x45c1670c, 0x7360623e), TOBN(0xf7a74f55, 0x6abd2a82),
+     TOBN(0x99b16e7e, 0x24e8e721), TOBN(0xae52fa2a, 0x512f1401),
+     TOBN(0x46c60e80, 0x3f3a09d5), TOBN(0xf803d1b3, 0x0750e968),
+     TOBN(0x17840d2f, 0x1791644e), TOBN(0x3e32b3db, 0x3b7981e6),
+     TOBN(0x2d0830a5, 0xd3dfae10), TOBN(0x1b28d118, 0x6cc6dd0d),
+     TOBN(0x944a9889, 0x78368274), TOBN(0x310da94a, 0x55b1bf81),
+     TOBN(0x503061ec, 0x0d739056), TOBN(0x1947e940, 0xb4d73288),
+     TOBN(0x760ee846, 0x0228346f), TOBN(0x108765b3, 0xc5cff077),
+     TOBN(0x22092b39, 0xbeb12160), TOBN(0xa631d553, 0xb63001af),
+     TOBN(0x9340cac4, 0x0af3d43a), TOBN(0xe6cbfb54, 0x60d338a3),
+     TOBN(0x2280ff0c, 0x7ca3f604), TOBN(0xaf48f86b, 0x3ba738cb),
+     TOBN(0x7435dd78, 0x47d372ff), TOBN(0xbf9c7149, 0xf005c006),
+     TOBN(0x624084b9, 0x7a8d0e81), TOBN(0x50b578f3, 0x4840496c),
+     TOBN(0x414ca2c1, 0xb52a4266), TOBN(0xa3c30275, 0x5535ef0b),
+     TOBN(0xd4b808c1, 0xb50f7f47), TOBN(0xe6781ae2, 0x9a199920),
+     TOBN(0x50141234, 0x27a91ef8), TOBN(0x2f4f5937, 0x5b77d060),
+     TOBN(0x1be8269e, 0xc2dcb03d), TOBN(0xa293017c, 0x9f65043f),
+     TOBN(0x1678dfe0, 0x8caac401), TOBN(0x4942d8ce, 0x968b1716),
+     TOBN(0xa9b55fae, 0xae36e201), TOBN(0xcfe4bde3, 0xd5279632),
+     TOBN(0x6126d744, 0x79d637e6), TOBN(0x8491f1a8, 0xd63b4aad),
+     TOBN(0xdf97b736, 0x9816b82c), TOBN(0xafca2c36, 0x796408c1),
+     TOBN(0xc17f3f01, 0x7a8e8058), TOBN(0xb3335a24, 0xe74705e2),
+     TOBN(0xee200023, 0x46e3e3b0), TOBN(0x07bce061, 0x40630e08),
+     TOBN(0x46b42c00, 0xee8f9dfc), TOBN(0x3b8e8509, 0x9e9b7f58),
+     TOBN(0x83df4b18, 0xd36e8e89), TOBN(0x09631af5, 0x15d50555),
+     TOBN(0xb7906b77, 0xef1ee3f1), TOBN(0x8272dc83, 0x4bd1e17b),
+     TOBN(0xf160bfd9, 0x4903faac), TOBN(0x7fe9e999, 0x0dc71e59),
+     TOBN(0x6ee9b790, 0xe714187d), TOBN(0x7391ec2a, 0x9d5a656f),
+     TOBN(0xcbb55ec6, 0xe10b20f0), TOBN(0xbba3b57b, 0xec3645d6),
+     TOBN(0x9c3265bc, 0xe18322e8), TOBN(0xdb49b0f3, 0x93328c91),
+     TOBN(0xa911db72, 0x49c2bbec), TOBN(0xf71b4df3, 0x6e5bd229),
+     TOBN(0xdccede33, 0x7ba27baa), TOBN(0x1af4476a, 0x4b712a97),
+     TOBN(0xf0aaabec, 0x8a8683ad), TOBN(0x138cdac5, 0x6fa8e84c),
+     TOBN(0xd2d50b00, 0xdc78b1ad), TOBN(0x26fc0b72, 0x696442b9),
+     TOBN(0x12cd5d8b, 0x125bf11b), TOBN(0x2a2ce980, 0xc4f82ca6),
+     TOBN(0x9921c0a6, 0x52e00dd3), TOBN(0x98e8707a, 0xf1d7e1af),
+     TOBN(0xaa7aa8b8, 0xdf03b040), TOBN(0xb3ba8b23, 0xdff6bd74),
+     TOBN(0x2fd0faab, 0x31db8c0b), TOBN(0x4697e9bf, 0x2819b732),
+     TOBN(0x2dc3a5d0, 0x0425b866), TOBN(0x4b9e7899, 0xd97816f1),
+     TOBN(0x1355c412, 0x4c756c70), TOBN(0x2d4c4eee, 0x0fa089af),
+     TOBN(0x4d8425a8, 0x3b8a01b5), TOBN(0xcc26b8a9, 0xa3531d3a),
+     TOBN(0x6eebe11b, 0x7ebd9eea), TOBN(0xd511a797, 0x92c0f858),
+     TOBN(0xaa863f01, 0xec49a0c8), TOBN(0x7fb65625, 0xa8242995),
+     TOBN(0x9de9d3f4, 0x3dbc00c3), TOBN(0xb846152f, 0x3f7d61ab),
+     TOBN(0xc060fdbd, 0xd0d74549), TOBN(0xe722aab2, 0x7b273702),
+     TOBN(0x9e54f098, 0xd81b6f6e), TOBN(0x32dbaa5f, 0x9e2fde1f),
+     TOBN(0x14cc9995, 0x9ebbc796), TOBN(0x4ca6686c, 0x0eb83921),
+     TOBN(0x6e65d7c6, 0x10a0c0bd), TOBN(0x1f6930d7, 0xb3c0f6cd),
+     TOBN(0xe4e0a933, 0x4d783d6f), TOBN(0xc945ee7f, 0x70b20ad4),
+     TOBN(0x521bd135, 0x034b0265), TOBN(0xeb5d96e0, 0x0fa9be95),
+     TOBN(0x834c28c2, 0x357ef592), TOBN(0x08ab5b4c, 0xb81df99f),
+     TOBN(0x6be99d80, 0xf464825d), TOBN(0x1cc83719, 0x9a0c1293),
+     TOBN(0x76616803, 0xe7e43c6a), TOBN(0x6fa33715, 0x91cc47ac),
+     TOBN(0xc3fdb99b, 0xdbfc08b9), TOBN(0x66e1ef2d, 0x68e2b249),
+     TOBN(0xd3d8ef7f, 0x64a4a438), TOBN(0x775a70fc, 0xa6f25b00),
+     TOBN(0x2444c682, 0xa0cb5443), TOBN(0x264c2662, 0x4b743ee7),
+     TOBN(0xd7a1adc4, 0xa303eb20), TOBN(0x3f14821b, 0xf60a5b98),
+     TOBN(0xa439102d, 0x1a1d7661), TOBN(0x47c25a37, 0x8d8a5a1a),
+     TOBN(0xdf4a48db, 0xa34c66a9), TOBN(0xab467364, 0x4c828c73),
+     TOBN(0xd3caad73, 0x3459cc8b), TOBN(0x08eeb442, 0x181b16c2),
+     TOBN(0x3444abbb, 0x70600d33), TOBN(0xaa2a39c4, 0xcd0f8e70),
+     TOBN(0x5fc6ae8f, 0x24836d70), TOBN(0xc119be84, 0x47d32fd4),
+     TOBN(0x2b3f3771, 0x0d6000ce), TOBN(0x439893a8, 0xe602337a),
+     TOBN(0x4b75ff6e, 0xc1e8e564), TOBN(0x6185413c, 0xe451cf42),
+     TOBN(0x0276d3b6, 0x162c3150), TOBN(0x844539e0, 0x3aea9c55),
+     TOBN(0xfc629ee6, 0x42e9d70b), TOBN(0x4eb9b7e6, 0x0be610c9),
+     TOBN(0x8c53fda1, 0x39ca3d92), TOBN(0xd2e4cfa6, 0x14c2e9e2),
+     TOBN(0x3c1f6895, 0xf14b31b2), TOBN(0xad42d951, 0xeb951fad),
+     TOBN(0x5b20a169, 0xb8f10fc1), TOBN(0x284810bd, 0x586c61cd),
+     TOBN(0x0c4a89aa, 0xe863d781), TOBN(0x2eda4847, 0x9c235d5c),
+     TOBN(0x8e141950, 0xe6005150), TOBN(0x75716e1b, 0x52785efa),
+     TOBN(0x290ced58, 0x8305624e), TOBN(0x398956a8, 0x06650920),
+     TOBN(0xd057a47b, 0xdb5bd5b6), TOBN(0xf2d85299, 0xbe9e119c),
+     TOBN(0x4783095c, 0x7c5fc039), TOBN(0x72f7e7cd, 0x05363915),
+     TOBN(0xe46b90d1, 0xdf3e2968), TOBN(0xaadb3dae, 0xaaea2e53),
+     TOBN(0xf5d37496, 0x0cc4f426), TOBN(0xa59bffa8, 0x59d78369),
+     TOBN(0x7ad4cc11, 0xf0a46b04), TOBN(0xcbd63351, 0xb8e21b9e),
+     TOBN(0x60d255e6, 0x5653ebbf), TOBN(0x3eaa59af, 0x4d6b5843),
+     TOBN(0x90049d25, 0x9e1df2e2), TOBN(0x9a185a6d, 0xe56aa105),
+     TOBN(0xbd31c5cf, 0x80e3d909), TOBN(0x30caad3b, 0xa1f034d1),
+     TOBN(0xaca74fa1, 0xd9c7c342), TOBN(0xac722cfc, 0x9565cf8a),
+     TOBN(0x8b172ce6, 0x5b42e582), TOBN(0x9e99e4e5, 0x9b0607b2),
+     TOBN(0x284eb579, 0x9446ca45), TOBN(0x6c5464ba, 0xc57c9feb),
+     TOBN(0x1437fc95, 0xe511bc3b), TOBN(0x22d7bc16, 0x834d0889),
+     TOBN(0x62e545b2, 0xc5071c43), TOBN(0x4c644d48, 0x8cb4acd6),
+     TOBN(0xd9efbe50, 0x68246492), TOBN(0xc9d169e7, 0xcbd8ad0e),
+     TOBN(0xcb7365dc, 0x798ae01f), TOBN(0x5783f98f, 0x6d0dea3a),
+     TOBN(0x9b4a7e38, 0xec454423), TOBN(0x27405d08, 0x96ff4c8c),
+     TOBN(0x9769f097, 0x0c462f7c), TOBN(0xcbda5412, 0x7dc946aa),
+     TOBN(0xdacb510f, 0xe7dd5146), TOBN(0x9c9a0d39, 0x30507b37),
+     TOBN(0xa605730b, 0x05ded0ac), TOBN(0x7e683472, 0x6c6c7b5b),
+     TOBN(0xb378d92c, 0x7c952984), TOBN(0xec76370d, 0x72ae34d6),
+     TOBN(0x1fde0bde, 0xacda665b), TOBN(0xc8f648f4, 0xb931afc1),
+     TOBN(0x2b55adb2, 0xb960f6ce), TOBN(0x71b3bdd4, 0x7336a643),
+     TOBN(0xf66e77bf, 0x73cc39e7), TOBN(0xf582c5e8, 0x2fa3999a),
+     TOBN(0x30ecd0c7, 0xaf986d1d), TOBN(0xa2ae53ed, 0x4557dd65),
+     TOBN(0x97ebccfb, 0x7d618a1d), TOBN(0xcbf54149, 0x11eed889),
+     TOBN(0xdd0ff0e7, 0xd8f2bdd4), TOBN(0x6ac4a9fb, 0xfa769e74),
+     TOBN(0xdfdfc7e9, 0x93e5abab), TOBN(0x0c7151c5, 0xdffc6fcc),
+     TOBN(0x6d75e962, 0x5cbae56c), TOBN(0x77fae152, 0x96dccb89),
+     TOBN(0x275c4946, 0x6cc0e535), TOBN(0xc4a400a9, 0x81781318),
+     TOBN(0x8b9f872c, 0x77ba50e6), TOBN(0x971b6cb3, 0xa138eeb4),
+     TOBN(0xa7e7d1f9, 0x53f552a7), TOBN(0x360512ce, 0x8447c730),
+     TOBN(0xf0c73bbb, 0xc5454439), TOBN(0x7f1b9b18, 0xa3a24b5c),
+     TOBN(0xc5bb48dc, 0x51fa7d6b), TOBN(0xd264d6ec, 0x8b05a553),
+     TOBN(0x123caaf2, 0xe9371f83), TOBN(0xdf5da393, 0xb149f564),
+     TOBN(0x38e02eb6, 0x853b9bab), TOBN(0xc6aab96e, 0x95bf6647),
+     TOBN(0x4890be89, 0x3141219b), TOBN(0x7afe4c2f, 0x7883fe8e),
+     TOBN(0xc27bd13c, 0x59b86241), TOBN(0x1b9720f5, 0xaacebdc9),
+     TOBN(0xa054e203, 0xf6b2174c), TOBN(0xd4e7b952, 0x60f6de8e),
+     TOBN(0xcf7b1aea, 0xf4558633), TOBN(0x43fc1881, 0xbefa40a6),
+     TOBN(0x592164dd, 0xe23cef63), TOBN(0xfe57d6e8, 0xf7b4aaf2),
+     TOBN(0x38a5e2c9, 0xe8aef9bc), TOBN(0x576bd78c, 0x1ac2b10b),
+     TOBN(0x2357944c, 0x14309d10), TOBN(0x9933d7ed, 0xed0ed94a),
+     TOBN(0xb8792ea3, 0x0339f299), TOBN(0xcfb44322, 0x87fd9bd1),
+     TOBN(0x864f2fd5, 0x92966739), TOBN(0x7435ecc5, 0xd3cfd83e),
+     TOBN(0x8516d277, 0xec4249f2), TOBN(0xaa7e1a8a, 0xfc158b34),
+     TOBN(0xfc0fc22b, 0xfbe640a1), TOBN(0xf287767f, 0x91121fec),
+     TOBN(0x0ce48273, 0x3f590dcb), TOBN(0x5e994e2f, 0xf087c249),
+     TOBN(0x681a38c7, 0x65604726), TOBN(0x4f8c6ae3, 0x247a421e),
+     TOBN(0x1a51eaa0, 0x1294956e), TOBN(0x0984b1ef, 0x47c9b324),
+     TOBN(0x3749bd0d, 0x597b7696), TOBN(0x9d432b78, 0x08e57ee7),
+     TOBN(0x3092afe1, 0x2ba112d2), TOBN(0x89ccee49, 0x16c5a7f5)},
+    {TOBN(0x355e9d7b, 0x54089685), TOBN(0x9f0ec68f, 0x40818349),
+     TOBN(0x4cf4d8cd, 0x3861b80f), TOBN(0xcce669fd, 0xc1f5fa14),
+     TOBN(0xea212509, 0x1788f9da), TOBN(0x32953613, 0xf3ccf239),
+     TOBN(0x1048d092, 0x50027f3b), TOBN(0xe807b39d, 0x4270fbcb),
+     TOBN(0x5099dc55, 0x95e388c3), TOBN(0xd0670ff5, 0xea44e3ea),
+     TOBN(0xd212c993, 0x61b41f7b), TOBN(0x4f594af9, 0xfaf13305),
+     TOBN(0xbc508bf2, 0x05c01232), TOBN(0x76833536, 0x39ff08a5),
+     TOBN(0xa1cf70bd, 0xb837741a), TOBN(0xba8e6616, 0xaaf7bd2a),
+     TOBN(0xde04c343, 0xdef27938), TOBN(0x3f15ca91, 0x48cee32a),
+     TOBN(0xcb61573b, 0x9dd142da), TOBN(0xc094eefd, 0x126dd9bc),
+     TOBN(0x5d42f1a5, 0x136bb4da), TOBN(0x75693952, 0xdb2f3449),
+     TOBN(0x98017cd6, 0x5c16795e), TOBN(0x9e401530, 0x2afb67db),
+     TOBN(0x6376749f, 0x9b7c6c75), TOBN(0x680eacdc, 0xacbca35d),
+     TOBN(0xe87fd5b5, 0x5e145b32), TOBN(0xeb20d1ba, 0x36b886af),
+     TOBN(0xca499055, 0x779b12bb), TOBN(0x6f290ff2, 0x0be39fb7),
+     TOBN(0x33ad6fe0, 0xf4a128ce), TOBN(0xf09e2a40, 0x9b31da81),
+     TOBN(0xb2ed3d70, 0x12039372), TOBN(0xb87e02c4, 0x2ff46c13),
+     TOBN(0x164246c6, 0xfb27dce2), TOBN(0xe34ee8f6, 0xe6d95811),
+     TOBN(0x66cc601c, 0x3ec1fde9), TOBN(0x056b3194, 0x80ffdd56),
+     TOBN(0xff009868, 0x9626aa21), TOBN(0xc3e4982c, 0x2d931092),
+     TOBN(0xbc0da9c1, 0xc3d42729), TOBN(0x4905da24, 0x720df0a0),
+     TOBN(0x0e5e1fa0, 0x45f6eadf), TOBN(0xc02033f3, 0x2aab7523),
+     TOBN(0x45ba916f, 0xedde75e1), TOBN(0xf43919bd, 0x75c68e52),
+     TOBN(0x00e7c076, 0x84892e6a), TOBN(0x259f8488, 0x70dfeb08),
+     TOBN(0x3bfd5f2c, 0xd8a869a0), TOBN(0x1df48669, 0x574e7d67),
+     TOBN(0x16d6ed5a, 0xe14cfd3b), TOBN(0x583aac2c, 0xfcf78465),
+     TOBN(0x67210e6b, 0x67da2ae9), TOBN(0x0b024e70, 0xcfee511d),
+     TOBN(0xf27e122c, 0x13839a4f), TOBN(0xfa5356c9, 0xb79dfa97),
+     TOBN(0xf0c24783, 0xf357999b), TOBN(0x2c21474c, 0x26bfacb3),
+     TOBN(0xe3abed6a, 0xd3ddb945), TOBN(0xbb21b764, 0x6031a5ea),
+     TOBN(0x6db3b68b, 0x8afc2a09), TOBN(0x1aac2f08, 0x81306b71),
+     TOBN(0x882c3371, 0x852eb6f5), TOBN(0xadfe0c1a, 0xd98e9b6f),
+     TOBN(0x0247ee7b, 0x7edcb9e5), TOBN(0xe29ec013, 0x1f29918b),
+     TOBN(0x5d1629e6, 0x6099b6ce), TOBN(0x68587803, 0xcb534584),
+     TOBN(0x6ccfeddb, 0x8ce551d3), TOBN(0x7ef98b72, 0xf85123a8),
+     TOBN(0x19af4771, 0xf9711dcd), TOBN(0x8f67858b, 0xfd80e4dd),
+     TOBN(0xa4c8c016, 0x7d607ee3), TOBN(0x15db36d7, 0x4015a479),
+     TOBN(0x0cb58eee, 0x9d28ea30), TOBN(0xb3d469b0, 0xbecb7b4e),
+     TOBN(0x811081b9, 0x6f476e2c), TOBN(0x264da3aa, 0x59c78fab),
+     TOBN(0xd6e5813d, 0x3cd73147), TOBN(0xce9e34a4, 0xe905362c),
+     TOBN(0xe551ec2e, 0xcb3afa55), TOBN(0x2c9bef25, 0x4b05589c),
+     TOBN(0xd36ddeb7, 0xbcd083bc), TOBN(0x1c180b52, 0xddb54a24),
+     TOBN(0xb84220f3, 0xc0961f32), TOBN(0xa71103fb, 0xfe3ae670),
+     TOBN(0x6a14d319, 0x46902477), TOBN(0x516701d2, 0x778b8eee),
+     TOBN(0x1cdb1025, 0x4c3166d5), TOBN(0x3a0ba2c2, 0x3d6fcb6e),
+     TOBN(0xa218b4af, 0xb3820def), TOBN(0xda6de958, 0xbfe8a8f8),
+     TOBN(0xc2b3c755, 0x4ceabdfa), TOBN(0xd3534691, 0x8d73edcb),
+     TOBN(0x453b8e63, 0x0ce17182), TOBN(0x6507a5b0, 0x01654263),
+     TOBN(0xb2b8e424, 0xd5da0e59), TOBN(0x7e599c75, 0x61ac4c2e),
+     TOBN(0xc64cb4c3, 0x41aff49a), TOBN(0x0e231e63, 0xea3e378e),
+     TOBN(0x707cc0e3, 0xe08edace), TOBN(0x18918dd2, 0x5410779f),
+     TOBN(0xcdd57690, 0x2eef6bb3), TOBN(0x4c54d7d8, 0xff758569),
+     TOBN(0x49459204, 0x2c89683c), TOBN(0x93596a16, 0x7827e518),
+     TOBN(0x6198954b, 0x2b20c939), TOBN(0x6672c94d, 0x8044d3ba),
+     TOBN(0x55e95fd3, 0x199b16dd), TOBN(0xa8484135, 0x4185999a),
+     TOBN(0x5e8709c8, 0xfe36e449), TOBN(0x47470e2e, 0x91401957),
+     TOBN(0x0058bb09, 0x0874afce), TOBN(0x19fb1d56, 0x606c3e52),
+     TOBN(0xe1208b2a, 0x710903a0), TOBN(0xecabc372, 0xd47dfd1c),
+     TOBN(0xd9daa7f4, 0x5e94818f), TOBN(0x1302ac8f, 0x5dc99882),
+     TOBN(0x7b4c6b15, 0xc44d37be), TOBN(0x0bcf6d4c, 0x72d19e0d),
+     TOBN(0x1e0bf063, 0x3fd5a1de), TOBN(0x5d05e901, 0xa75b5b8c),
+     TOBN(0xbbbdb1ab, 0xcb3c617a), TOBN(0x44954a8c, 0x1aef4706),
+     TOBN(0xbc3ceea3, 0xff6a6e47), TOBN(0x6140f421, 0x0ded1275),
+     TOBN(0xbb4b4c04, 0x4dabe95f), TOBN(0xc55e87da, 0x7135e813),
+     TOBN(0x15ad105c, 0xd963dd6b), TOBN(0x33d18f73, 0x666941a3),
+     TOBN(0x860ccabe, 0x5d9253d6), TOBN(0x2af702fd, 0xd16e8b69),
+     TOBN(0x7e46aadd, 0x74e525c0), TOBN(0xd9958a44, 0xaf59f48f),
+     TOBN(0xd8ca872f, 0x8e7de482), TOBN(0xc2270c14, 0xcf7d007d),
+     TOBN(0x87c6204e, 0xa200e574), TOBN(0x0ee014cb, 0x7b69e79e),
+     TOBN(0x176ff378, 0x82b23226), TOBN(0x802d829d, 0x8dbbb2f3),
+     TOBN(0xb902924f, 0xe0a4dc31), TOBN(0x1f1a9ec7, 0x5fe522f2),
+     TOBN(0xbcd95d85, 0x4da7c04a), TOBN(0x3a3a2e63, 0xb1543c0c),
+     TOBN(0x9e70a3ff, 0xf3271bf8), TOBN(0xd2522d88, 0xd2cd68ad),
+     TOBN(0xb777851b, 0xa6b727b9), TOBN(0x58953d6f, 0x63ff5264),
+     TOBN(0x5e111c22, 0xb65c70d2), TOBN(0xaae73c5b, 0xd3a5143f),
+     TOBN(0x2daa2bfc, 0x85ef5dc0), TOBN(0x5e7258d2, 0xea13ded3),
+     TOBN(0x4161127c, 0x2e3ce423), TOBN(0x7e35a0a2, 0x6b1af415),
+     TOBN(0x004483a8, 0xeed24b7b), TOBN(0x2816180a, 0x9f9d44f1),
+     TOBN(0x214add93, 0x062829a1), TOBN(0x262a0bef, 0x225e847c),
+     TOBN(0x4bb1b1ce, 0x5d6c53c4), TOBN(0xd02f829a, 0x91d06e53),
+     TOBN(0xcdc8ba5c, 0x784da27c), TOBN(0x78a6c0d2, 0x161b5836),
+     TOBN(0x6bea92c4, 0x8373c6a4), TOBN(0x815f1a30, 0xa881f59a),
+     TOBN(0x699c8642, 0x227cb8e2), TOBN(0x515d1e2b, 0x25a2b9d0),
+     TOBN(0xcb5f1c6c, 0x1787b3e5), TOBN(0xc9a10260, 0x104dddc6),
+     TOBN(0x18be4f2a, 0x0f3811e5), TOBN(0x8c05d3fc, 0x71e727d3),
+     TOBN(0xecae3e5f, 0xfa707140), TOBN(0x4bb05b16, 0xd275b463),
+     TOBN(0x74bad373, 0xb02a5ac8), TOBN(0x7232875a, 0x520344ee),
+     TOBN(0x32cef98c, 0x65059d8f), TOBN(0x68e0fdb6, 0x54e1b11d),
+     TOBN(0x683424f3, 0x3f3db43f), TOBN(0xf5f0878f, 0xabf4a83f),
+     TOBN(0x681350d9, 0x4ac2c5c9), TOBN(0x825e9ecb, 0x47dd3652),
+     TOBN(0x420743f0, 0x20713db6), TOBN(0x95db7427, 0xd1b082e5),
+     TOBN(0xa0e1117f, 0x1affa57d), TOBN(0x62c87b5e, 0xf940f325),
+     TOBN(0x6a65fda8, 0x4e1d5d9a), TOBN(0x0c0fe385, 0x345ccdef),
+     TOBN(0x19ff360f, 0xd6d72c0a), TOBN(0x1be1e8d7, 0xfb016131),
+     TOBN(0xe2f27e91, 0x025b45e1), TOBN(0x25bec266, 0x05259bf1),
+     TOBN(0xd7b8b4e7, 0xe51cc67e), TOBN(0x3a839aa5, 0xab80a20e),
+     TOBN(0x04a9b695, 0x9f85320d), TOBN(0xb939cd83, 0x98d669f3),
+     TOBN(0x24464ced, 0xe6948957), TOBN(0x463de507, 0xa43928e8),
+     TOBN(0x4e1844e7, 0xf8755845), TOBN(0xc9c71091, 0x5447e61c),
+     TOBN(0x1798f394, 0x599d4bd7), TOBN(0x758f7630, 0x1e072c64),
+     TOBN(0x83c93728, 0x739b1925), TOBN(0x692017d7, 0xfa8eb048),
+     TOBN(0x4a3a2a59, 0x478d1ee3), TOBN(0xb8e62912, 0x022640cd),
+     TOBN(0x4689a4dd, 0x8572b8d7), TOBN(0x6281ddfe, 0x8f79da63),
+     TOBN(0x788bf9aa, 0x212a153c), TOBN(0xb67e18f5, 0xb3438da6),
+     TOBN(0x3fbafc51, 0x31cebdb8), TOBN(0x7f8ad590, 0xb042bd47),
+     TOBN(0xf5d26c88, 0xe3055004), TOBN(0x7f23a149, 0x3d7d6f5c),
+     TOBN(0x2fee5428, 0x8758ccc0), TOBN(0xb08c91b7, 0xe1b80dfa),
+     TOBN(0xf2bcc903, 0xea0c0a53), TOBN(0xcdf2eae0, 0x04e684ff),
+     TOBN(0x354b2c07, 0xe1d9a693), TOBN(0x93b1fa2d, 0x97a833a8),
+     TOBN(0x2dcd22c7, 0xe9e5f2b1), TOBN(0xf040a69c, 0x18aa3163),
+     TOBN(0x4f9a4b29, 0x76939874), TOBN(0x58e5947f, 0x15e24d44),
+     TOBN(0x9b47a945, 0xb0c2ef6f), TOBN(0xc4a15b7d, 0xf630e92c),
+     TOBN(0x8d7a33e7, 0x7b1d4141), TOBN(0x44dabde9, 0x966486bc),
+     TOBN(0x387a6016, 0xef31dc9d), TOBN(0x76744b23, 0x1462ff61),
+     TOBN(0x2ad63954, 0x20cdd726), TOBN(0x9cff7e86, 0x0e7803da),
+     TOBN(0xaf5b8b4a, 0xfd124ed3), TOBN(0x466dbbbd, 0x050c1149),
+     TOBN(0x68352636, 0x06b296a3), TOBN(0x0ab40080, 0x7f3fe1ef),
+     TOBN(0x1fc38951, 0x05bf08f8), TOBN(0x69b54ae4, 0x633c457f),
+     TOBN(0x2ad428c6, 0x1a206c53), TOBN(0xd6725687, 0x8b09b3f9),
+     TOBN(0x552d4d0e, 0x0bc619c9), TOBN(0x0e88b313, 0x3113c689),
+     TOBN(0xb2483b80, 0xe87a91b4), TOBN(0xb9f842d7, 0x0c75377b),
+     TOBN(0x50463f38, 0x5a78145e), TOBN(0xf2d3810d, 0x830817a9),
+     TOBN(0x1819261e, 0x39cc886a), TOBN(0x697de51d, 0x8415699b),
+     TOBN(0x688a874e, 0x5cab106e), TOBN(0xde48f3bb, 0xcb8692ec),
+     TOBN(0xffa1de97, 0x38f4194d), TOBN(0x33d2726a, 0x3b996b63),
+     TOBN(0x787c0ec3, 0x0d2053a7), TOBN(0x9447e9cb, 0xeecd5c0c),
+     TOBN(0x077f121c, 0x284773c0), TOBN(0x496427e4, 0x815829a1),
+     TOBN(0x4b119786, 0x94def08b), TOBN(0x9e7b29e6, 0x9c15a778),
+     TOBN(0xa4d6d2be, 0xfd4a8a47), TOBN(0x4f000a12, 0x4333baef),
+     TOBN(0xc9049d86, 0x642c570b), TOBN(0x9424e8f9, 0x25e6aa6a),
+     TOBN(0x84de7fe9, 0xe011cfec), TOBN(0xf273f956, 0x1e8c83b0),
+     TOBN(0x98960835, 0xa47a40a6), TOBN(0xd91a20f1, 0x0a13c27b),
+     TOBN(0xaf08b4ef, 0xed703e13), TOBN(0xefcbcf34, 0xc9994946),
+     TOBN(0x019e6f38, 0x2d53b069), TOBN(0x3d62c3c0, 0x9b160894),
+     TOBN(0xac7ad700, 0xadfc8f3b), TOBN(0x41cc0cc3, 0x0042fce6),
+     TOBN(0x0228ae75, 0x21cf742c), TOBN(0x56a1152a, 0xf4c9a1a9),
+     TOBN(0x5d8a3321, 0xfebd27dc), TOBN(0x89bce700, 0x7c525f7f),
+     TOBN(0xe8f815a9, 0x1c1039ee), TOBN(0x9f6db698, 0x62e86536),
+     TOBN(0x1ea6e7a6, 0x66fe804d), TOBN(0x652acc41, 0x261aea16),
+     TOBN(0xde28e5d8, 0xf9df596b), TOBN(0x18f453c1, 0x1553a545),
+     TOBN(0xa224f763, 0x84eeb5c8), TOBN(0x8ac452f5, 0x835ba87e),
+     TOBN(0x9b2b5939, 0xc5f4c054), TOBN(0xb2577943, 0x3ac1cdcc),
+     TOBN(0x1ba2cd0d, 0x772c60dc), TOBN(0x1fa52c43, 0xd7a9bd1c),
+     TOBN(0x2efd4f4a, 0x60444f34), TOBN(0x7d188c05, 0x2bdcfc9d),
+     TOBN(0x49ef6825, 0xe1913711), TOBN(0xbca95ded, 0x600d6c46),
+     TOBN(0x63916baa, 0xaf8d66d3), TOBN(0x04981202, 0x2dc837a8),
+     TOBN(0xb501e517, 0x0d3ae79d), TOBN(0x99ff7864, 0xb4edb859),
+     TOBN(0x5099edee, 0xaf4ec081), TOBN(0x89574889, 0x964f4052),
+     TOBN(0x1690fdb8, 0x52066d70), TOBN(0xb403207d, 0x671f4e7f),
+     TOBN(0x8ebc1d1b, 0xd7413111), TOBN(0x1432d7fe, 0xb4cfdf14),
+     TOBN(0x9277666a, 0x65ad5d0e), TOBN(0xbd5ae578, 0xa928e194),
+     TOBN(0x2f6c10d5, 0xb64962fb), TOBN(0xe3d756c0, 0x2e794187),
+     TOBN(0xf04fd82a, 0xd3e6349c), TOBN(0xde602dba, 0xcc7d39b6),
+     TOBN(0x0886e20a, 0x044e7deb), TOBN(0x6e30c75f, 0xe9ba917e),
+     TOBN(0x763961fc, 0x4a322ede), TOBN(0x6df4a3cb, 0x2324bb92),
+     TOBN(0x9fe82323, 0x8f2ac967), TOBN(0x3c372afe, 0x2345372a),
+     TOBN(0xbf7e9c55, 0x50b66fec), TOBN(0x5db7dd71, 0x0c065cfa),
+     TOBN(0x3525e310, 0x50d459ea), TOBN(0xad7abe5a, 0x8122941a),
+     TOBN(0xc7aeba80, 0x122d92fa), TOBN(0x066c3765, 0xefcc1c24),
+     TOBN(0xa6d767ca, 0x8ffd71b1), TOBN(0x4a75fab5, 0x9cc16dbc),
+     TOBN(0x9acf8b89, 0xbb58b63d), TOBN(0x226cdcd3, 0x6fc8c090),
+     TOBN(0x852965b7, 0xae7fbd0b), TOBN(0x4cadd176, 0xb8bfe65f),
+     TOBN(0x4ccc11d1, 0xcfa2ac11), TOBN(0x8abf7420, 0x800319ab),
+     TOBN(0x24ab82cb, 0x88bb3ef1), TOBN(0x4d3db003, 0x524c0ce1),
+     TOBN(0x38483641, 0x3a431e8c), TOBN(0xfc0c04a0, 0x792848ad),
+     TOBN(0x2fc52bb8, 0xa07701b0), TOBN(0xdfdced3d, 0xf29c72cb),
+     TOBN(0x677e3d84, 0x5280c2e0), TOBN(0x2dda1451, 0xe98cbec5),
+     TOBN(0xba28b181, 0xaec26be2), TOBN(0x16694717, 0x5ddea39b),
+     TOBN(0x911ec5f0, 0x4b9aa9b0), TOBN(0x24b9aaa0, 0x3594ae7d),
+     TOBN(0x0ccfa661, 0xc3c136a0), TOBN(0x5518964d, 0xb7474319),
+     TOBN(0xf0b0427b, 0x2175c3dc), TOBN(0x08db4cfc, 0x966b7bad),
+     TOBN(0x6f61428a, 0x5e888ad1), TOBN(0xfaa96176, 0x57b52d37),
+     TOBN(0xe834013b, 0x10aac879), TOBN(0x73397bb0, 0x95a62172),
+     TOBN(0x97806839, 0x33a244b2), TOBN(0x0ab3806c, 0xc3bec0d0),
+     TOBN(0x4fc7a859, 0x2a72512d), TOBN(0x96474939, 0x0a4228b9),
+     TOBN(0x8e5d79a8, 0x4de4b4a5), TOBN(0x5a60d1b0, 0x05d62667),
+     TOBN(0xd31be21d, 0x08d90c20), TOBN(0x3f7ed5f2, 0xcc14dbb1),
+     TOBN(0xdc8f58f9, 0xd7d431c4), TOBN(0x714f6dee, 0x82b5c63f),
+     TOBN(0x6b285466, 0x76d2de93), TOBN(0x3c2f5d8f, 0xc39dd98c),
+     TOBN(0x9bba0075, 0xea3760a2), TOBN(0x75e0389a, 0x2411742e),
+     TOBN(0x87d6715a, 0x7ffdb955), TOBN(0x702108fc, 0x9efb199d),
+     TOBN(0xf11db1f9, 0x6c010f8a), TOBN(0xf52b1e0f, 0x7eb6871b),
+     TOBN(0xc49c0dc7, 0x97c3ed9e), TOBN(0x18846f95, 0x77220a50),
+     TOBN(0xdb2273bc, 0x97afddcb), TOBN(0x5b9a16d6, 0xcc469f75),
+     TOBN(0xee364394, 0x3beedaf4), TOBN(0x825e01d6, 0x528a9239),
+     TOBN(0xb60ba965, 0xffd0f17c), TOBN(0xc00106b0, 0xb888384b),
+     TOBN(0x6e24322f, 0x31751f74), TOBN(0xfe4d074c, 0x1821d05a),
+     TOBN(0xf2493c73, 0xbf072932), TOBN(0xa797e208, 0x21089f21),
+     TOBN(0xf1b318af, 0x2988abcd), TOBN(0xf887558f, 0x8e7da518),
+     TOBN(0xb8b9939c, 0x97836b57), TOBN(0xf793e3b5, 0xc0a74cf3),
+     TOBN(0xe191008a, 0x37684170), TOBN(0x7708823b, 0x05cb453c),
+     TOBN(0xec221d40, 0x361beb2c), TOBN(0x0e5a6cce, 0xeb1b68f4),
+     TOBN(0x3dc535f0, 0x9644e937), TOBN(0xf506d720, 0xfda6c1b7),
+     TOBN(0xc78c0e0b, 0xf99437bd), TOBN(0xa920b4d3, 0xcc9e2b09),
+     TOBN(0x550965fe, 0xf089b0e0), TOBN(0xf9813492, 0x0109d910),
+     TOBN(0xd2496f20, 0x8c9d5d83), TOBN(0x751b6900, 0x3e3e661f),
+     TOBN(0x921edbde, 0x9e6ac190), TOBN(0x75891359, 0xf02d0e7a),
+     TOBN(0xdeb0f83b, 0x1c4da092), TOBN(0x7b427915, 0x4feb2375),
+     TOBN(0x24637c72, 0x7c3a85c3), TOBN(0xbbfabf86, 0x3f214ac3),
+     TOBN(0xe8765740, 0xae22fbfa), TOBN(0x3a09fab0, 0x5f14045a),
+     TOBN(0x546d574f, 0x8190dd41), TOBN(0xdfcf0b73, 0x48b5a39f),
+     TOBN(0xf26c69de, 0x74097b2d), TOBN(0x37aa27ff, 0x3a7e3e90),
+     TOBN(0x0942447b, 0x83bbe3df), TOBN(0xe779fe20, 0x9ab378aa),
+     TOBN(0xad18ad23, 0x91e2264f), TOBN(0xe1dad926, 0xaaabd6d1),
+     TOBN(0x9de0aa4f, 0x5db5e5c8), TOBN(0x45c3d73e, 0xdb67e44e),
+     TOBN(0x440862a1, 0x5cd83936), TOBN(0x9f2b9a88, 0xffce9a79),
+     TOBN(0x63299069, 0x76cc6265), TOBN(0xf596a67f, 0x7a8830f5),
+     TOBN(0x7051c842, 0x8d1d8284), TOBN(0xa00d05a8, 0x3e5561fc),
+     TOBN(0x15ce42d5, 0x7a34d5bc), TOBN(0x4d9b3f5f, 0xb0e37254),
+     TOBN(0x26e84094, 0x38841ab4), TOBN(0xa7afd35d, 0x9a8ede27),
+     TOBN(0x4e8bcdb8, 0x14835fa9), TOBN(0x85d04ddc, 0x79493e39),
+     TOBN(0xbfa8fa79, 0xdf8f65ae), TOBN(0xe31d759a, 0xda6c7c62),
+     TOBN(0x76f27e70, 0x7600aea7), TOBN(0xbec79f15, 0xd4d9acf5),
+     TOBN(0x0f10bd0f, 0x5eae2ff6), TOBN(0x96c9eef1, 0x7116a0c4),
+     TOBN(0x30add2cc, 0x0cb6f595), TOBN(0x0c70b548, 0x943efe90),
+     TOBN(0x2ce8026f, 0x0a05f4a8), TOBN(0xaa3da153, 0xb7c53c00),
+     TOBN(0xcc46bf67, 0x8e385a26), TOBN(0x64bcf06e, 0x99bae0f6),
+     TOBN(0x49480a36, 0x035dcb4c), TOBN(0x2cc1a299, 0xe3cbae58),
+     TOBN(0x849f8633, 0xb5480cb2), TOBN(0x1d8fa56d, 0x5607d83e),
+     TOBN(0xcc3f0eee, 0xcea9f22b), TOBN(0x7d5ece29, 0x1a23f3da),
+     TOBN(0xc6f0a006, 0x8ae66f00), TOBN(0x2620157e, 0x78d648f0),
+     TOBN(0xfc717762, 0x40d2880f), TOBN(0x2e0e293c, 0xbe105017),
+     TOBN(0xb320f214, 0x854116f4), TOBN(0x5e4fa700, 0x2d5cd4ec),
+     TOBN(0x83fa0a23, 0xdffc1c55), TOBN(0x18fcb8d2, 0xc9a9ca15),
+     TOBN(0x9e9baccd, 0xd0ac70fe), TOBN(0x8ba02fb7, 0x27fe06ce),
+     TOBN(0x2708804c, 0x3868fdd4), TOBN(0x355eaf0c, 0x9ba83df4),
+     TOBN(0x014089ba, 0xbe43993a), TOBN(0xc8b59eda, 0x469cccd6),
+     TOBN(0x77c94507, 0xb893a5a7), TOBN(0x0dffd39b, 0x8e517fd5),
+     TOBN(0x71b6edb7, 0x13dbeadf), TOBN(0x1617b77f, 0xfea2d0cb),
+     TOBN(0xf7454736, 0x48ff989f), TOBN(0x27357890, 0xb618bfa3),
+     TOBN(0xf08c70ac, 0xa7181331), TOBN(0x33b6cfe5, 0xb8bc036d),
+     TOBN(0x75ed10f9, 0x7163f883), TOBN(0x979875fc, 0x47d1cbbd),
+     TOBN(0x6644b234, 0x7ad23938), TOBN(0x0f09e7f1, 0xd82e2bc8),
+     TOBN(0x1e6c512b, 0x5588a39d), TOBN(0xb44e6694, 0xce8eae85),
+     TOBN(0x107336e2, 0xf392a4c7), TOBN(0x2619b284, 0xdbcd7b43),
+     TOBN(0x7b7ec516, 0xb7f476a5), TOBN(0x0de74ef3, 0x43081af2),
+     TOBN(0x93d08bc6, 0xd8d54faf), TOBN(0x88d343a7, 0xf2ae6c9f),
+     TOBN(0x7cdb9003, 0xbc147c27), TOBN(0xd740b19d, 0x69248562),
+     TOBN(0x7f3c48bb, 0x464b3b60), TOBN(0xfc4cd7e9, 0xc91d92c1),
+     TOBN(0x8172af80, 0xd7420ac9), TOBN(0x66907b77, 0xb9a50be9),
+     TOBN(0xed99fea1, 0x9ec8e974), TOBN(0x624a8c94, 0x54f39b1c),
+     TOBN(0x9c4d608a, 0xce9798d1), TOBN(0x81e1652e, 0xa4812277),
+     TOBN(0xa2cf7509, 0xf58b7db8), TOBN(0xef2cd193, 0x745e450e),
+     TOBN(0x48ee8431, 0x9d9da493), TOBN(0x7b471698, 0xb8ce96fd),
+     TOBN(0x14dbaff8, 0xe7553998), TOBN(0xb0b14e4a, 0x822de823),
+     TOBN(0x11032354, 0x429d7c51), TOBN(0xc1bb3327, 0xd572d20e),
+     TOBN(0xff473811, 0x6a9c189e), TOBN(0x7cf2354e, 0x9c7b3b83),
+     TOBN(0x29681ff6, 0x7662df92), TOBN(0x09296227, 0x51c297d1),
+     TOBN(0x1b800b34, 0x5e3da635), TOBN(0xb5fd32d2, 0x745116e4),
+     TOBN(0xdae17a1f, 0x2565abb0), TOBN(0x4f39d3d7, 0x1fec80c2),
+     TOBN(0xb4a19cc2, 0x290c2f4b), TOBN(0x1a1b049e, 0x0b6e5ae0),
+     TOBN(0x41be6e92, 0x6a823b6b), TOBN(0x35648873, 0x969649ce),
+     TOBN(0xe85f995e, 0x2a8ed3d7), TOBN(0x9dc712e8, 0x2f319e47),
+     TOBN(0xc4402eff, 0x536d98a2), TOBN(0xca61e310, 0x37521e35),
+     TOBN(0xfed39621, 0xc3196672), TOBN(0x29e7743f, 0xff17e8a7),
+     TOBN(0x47eca488, 0x412a7c49), TOBN(0xf0114513, 0x33a2a6da)},
+    {TOBN(0x5675a12a, 0xe6880b5f), TOBN(0x9ba1e92c, 0xe2606d25),
+     TOBN(0xb012facb, 0xeb3b2125), TOBN(0x3c50fdfb, 0xc37b0099),
+     TOBN(0xc9ce461c, 0x9ce223e9), TOBN(0xcb90bdd6, 0xeefbd8ac),
+     TOBN(0xf657e5a4, 0xc631ea8e), TOBN(0x6584520b, 0x38a83ff6),
+     TOBN(0xd959f317, 0x635abcf0), TOBN(0xa516a43f, 0x99e17618),
+     TOBN(0xed90ccf2, 0xce3bd99b), TOBN(0x2fc6d460, 0xa9fb3290),
+     TOBN(0xb61ebe09, 0x0cde4302), TOBN(0x5a3b061f, 0xf908003b),
+     TOBN(0xf51bb736, 0xf60f5787), TOBN(0x1717f6e9, 0x057efc2f),
+     TOBN(0x565acf93, 0x1ca260ef), TOBN(0x7d6e797d, 0xf1811d23),
+     TOBN(0xe63c6920, 0x783e42c8), TOBN(0xdc9dbce8, 0x8dcb5158),
+     TOBN(0x1426dc7a, 0xc8e39022), TOBN(0xf3037f34, 0x30ebfe47),
+     TOBN(0x75aa6845, 0xf87d6395), TOBN(0xbf792fd5, 0x61f53539),
+     TOBN(0xa8bf2172, 0x6ddc3d83), TOBN(0xf68deb6e, 0xd88207bb),
+     TOBN(0xa8eae2eb, 0xcd03bd7e), TOBN(0x64c7f57e, 0x951f59a4),
+     TOBN(0x8badb223, 0xa1786d57), TOBN(0x2e7fda60, 0x71182790),
+     TOBN(0x9dc90e36, 0x9a5a9457), TOBN(0x6eca838b, 0xf4b07e07),
+     TOBN(0xad2e235b, 0x03264871), TOBN(0xb4c56243, 0xb8b933de),
+     TOBN(0xd9c2bdda, 0x91354c8e), TOBN(0x97d743ff, 0x6a73fc76),
+     TOBN(0xbed4109d, 0xce88013e), TOBN(0xa2428275, 0xf3b3bf4f),
+     TOBN(0x900d3560, 0x011e761c), TOBN(0x34925d7d, 0xe24fd6c2),
+     TOBN(0x08b966ca, 0xa8198235), TOBN(0x355d098c, 0xed2d764a),
+     TOBN(0xfac27f7c, 0xa3d63f3a), TOBN(0x3e553f6c, 0xd3edc140),
+     TOBN(0x64d72c7f, 0x11ff4334), TOBN(0x48735aab, 0xbc62cb57),
+     TOBN(0xcf064294, 0xeba21082), TOBN(0xc1f9e456, 0xbb8d96fd),
+     TOBN(0x1d24bdbc, 0x293cd945), TOBN(0x76985bcb, 0xea254e36),
+     TOBN(0x3df2cb6a, 0x876fb485), TOBN(0x0176969f, 0xcd1f673d),
+     TOBN(0x8b41cacb, 0x642133a7), TOBN(0x31ea88f8, 0x373880e2),
+     TOBN(0xccf1ff85, 0xb3b1463f), TOBN(0x88fffa15, 0xaca74a27),
+     TOBN(0x9a4b9b92, 0x167cdd1f), TOBN(0xa9118fc0, 0xf879b894),
+     TOBN(0xf6e73387, 0xc55479f5), TOBN(0xfadf82ed, 0xc626d292),
+     TOBN(0xa03bb761, 0x56e80e6a), TOBN(0x59a783f9, 0xf27555d1),
+     TOBN(0x027d63b6, 0x3d087e43), TOBN(0x29f9ff32, 0x02fdeded),
+     TOBN(0x88a9173d, 0x371d0ec5), TOBN(0x04ac4d0d, 0x08c0227a),
+     TOBN(0x00213011, 0x9c7ec715), TOBN(0x0d2b7c76, 0xd9d6b472),
+     TOBN(0xe678d53a, 0x5050bdff), TOBN(0x8f929d57, 0x65a5fcd5),
+     TOBN(0x0793920b, 0x1dc3e712), TOBN(0x9a6a690f, 0x4b073699),
+     TOBN(0x329d9a81, 0x758bdc9d), TOBN(0xebbaadd9, 0x7d867b66),
+     TOBN(0x0d7e6b19, 0xe6025f68), TOBN(0x50184374, 0xc53dce26),
+     TOBN(0x298cb00f, 0x3ed13916), TOBN(0x835fe31e, 0xf5d45b26),
+     TOBN(0x373a9c49, 0xf5a7fb7a), TOBN(0x59ed7e23, 0x34d3d8a8),
+     TOBN(0x1a8dfe33, 0x3baf6fa3), TOBN(0x926ccce7, 0xda53714f),
+     TOBN(0xda4feaed, 0x18ef6fe2), TOBN(0xeddaf090, 0xc3ca5cdd),
+     TOBN(0xc39c2046, 0xbfe06d45), TOBN(0x1d9e889e, 0x0d7f549f),
+     TOBN(0x209ace73, 0x8d537d0a), TOBN(0x6f182c88, 0x0e31e1ce),
+     TOBN(0x865e0761, 0x1b8c82e2), TOBN(0xcf11bcb9, 0xa659f2ab),
+     TOBN(0x1804bbeb, 0x7c868143), TOBN(0x2fa89a0e, 0x453e36eb),
+     TOBN(0x42d69d8f, 0x2e17bad1), TOBN(0xe7fcea6f, 0xdc2ec741),
+     TOBN(0xe7f19b45, 0x379ceb37), TOBN(0x84f0bd89, 0x49bb35a0),
+     TOBN(0xa8a50678, 0x5264b33d), TOBN(0x8cfae763, 0xab1c9e26),
+     TOBN(0x1e837dc3, 0xff9b931a), TOBN(0x76164be8, 0x796ac029),
+     TOBN(0x26a8bb2b, 0x1266db27), TOBN(0xfba4ab83, 0x54822255),
+     TOBN(0x7a5adcfd, 0x38524458), TOBN(0xa056c882, 0x44ee212c),
+     TOBN(0xe8db6fee, 0x55018577), TOBN(0xf71256b6, 0x91955960),
+     TOBN(0xeb1c118e, 0x10abe8d8), TOBN(0x984efc9f, 0xd45a8426),
+     TOBN(0x4e1b323a, 0x00f2c6ed), TOBN(0x1759a7af, 0x331baae2),
+     TOBN(0xf1587189, 0x2e00ba6c), TOBN(0xbd8a877e, 0xbb385d39),
+     TOBN(0x440d1eae, 0x57d6c1ae), TOBN(0x092abdef, 0xa957dc67),
+     TOBN(0x1065cbc6, 0x74554b3f), TOBN(0x67062382, 0x710566c7),
+     TOBN(0xd327679d, 0x6d04ae2b), TOBN(0x11507b00, 0xb0340551),
+     TOBN(0x2e571583, 0xa2f52d80), TOBN(0x673628f4, 0xe8578507),
+     TOBN(0xecb8f92d, 0x0cf4efe5), TOBN(0x88c47214, 0x960e2d22),
+     TOBN(0xca9549ef, 0x6059f079), TOBN(0xd0a3774a, 0x7016da7c),
+     TOBN(0xd51c95f6, 0x1d001cab), TOBN(0x2d744def, 0xa3feeec1),
+     TOBN(0xb7c20cc2, 0x0afedf2b), TOBN(0xbf16c5f1, 0x71d144a5),
+     TOBN(0x00384727, 0x3dc0d12e), TOBN(0xaa95f450, 0xb01cc80f),
+     TOBN(0x19be3106, 0xa6f8e927), TOBN(0x6d6e10aa, 0x0417ba8b),
+     TOBN(0x149f120c, 0x870e3491), TOBN(0x27380b41, 0x026dde94),
+     TOBN(0x97d00840, 0xf29b04e6), TOBN(0x21d5d7e3, 0x4bf9eb19),
+     TOBN(0xea1daad9, 0xd5327f05), TOBN(0xf1f45d94, 0x9c88c17c),
+     TOBN(0xc5f3dee2, 0x3f8ee0ab), TOBN(0x706b777c, 0x75238a56),
+     TOBN(0xf7aee379, 0xf834c60b), TOBN(0x5c24dae6, 0x13cfe17b),
+     TOBN(0x354c82e5, 0x8091804b), TOBN(0x0dec2fdf, 0x102a577b),
+     TOBN(0xbf3b7030, 0x5253f8fc), TOBN(0xe516fa69, 0xd913c01c),
+     TOBN(0x053afef4, 0xa105ba64), TOBN(0x91a1f36c, 0xc89c1e76),
+     TOBN(0x3375865c, 0x7e724e18), TOBN(0x43132144, 0x29327b2b),
+     TOBN(0x9cb2fc3b, 0x6f7bb24e), TOBN(0x20a6a16d, 0x6319e789),
+     TOBN(0x20bfbd77, 0x642c467a), TOBN(0x3452bb12, 0x259d50c8),
+     TOBN(0x0d3ba9c7, 0xec7ffab2), TOBN(0xbbdb5454, 0x3560e541),
+     TOBN(0xab1d6e22, 0xd63ba04b), TOBN(0xdf6f11d3, 0x7d24f015),
+     TOBN(0x7c4d61d2, 0xf3df15fa), TOBN(0xd5269f79, 0x40b3288c),
+     TOBN(0xf8516b9e, 0x0e7c7b6c), TOBN(0x48750d82, 0xc203dac8),
+     TOBN(0x89845d36, 0xa13d3083), TOBN(0xb3db3cfa, 0x280a131a),
+     TOBN(0x40045401, 0xfbf752e6), TOBN(0x0289f97b, 0x1432e856),
+     TOBN(0x41a9f371, 0x5fc1aa11), TOBN(0xe5c1e5a5, 0x8d464042),
+     TOBN(0xfbee2ea2, 0x589b71a7), TOBN(0xdd6ee5bd, 0x5de7056c),
+     TOBN(0xcf8a4541, 0x8fd6b6de), TOBN(0xb47831dc, 0xb15e33b1),
+     TOBN(0x126a2169, 0x2064321e), TOBN(0xa21d2d22, 0x6e517edd),
+     TOBN(0x1f8072be, 0x5ba5a30b), TOBN(0x24cca576, 0xc6a24b7d),
+     TOBN(0x57eab82f, 0x5c282027), TOBN(0x1620f5e6, 0x557344b3),
+     TOBN(0x59e852e0, 0x460b3385), TOBN(0xc906e3db, 0xf050816c),
+     TOBN(0xc031f8cf, 0x3eb398e8), TOBN(0x9c25b69b, 0x507ac07f),
+     TOBN(0x652baf2b, 0x9cf7bdbe), TOBN(0x06fedc53, 0x5ad91107),
+     TOBN(0xa8ca0be2, 0x4c4b12c5), TOBN(0x633292b6, 0x28762d5d),
+     TOBN(0xc04983f2, 0x827c0d5e), TOBN(0xcb6b867d, 0xc707ef03),
+     TOBN(0xa7fc0d5b, 0xb9ac1124), TOBN(0xa5ce085b, 0xaab7dcaf),
+     TOBN(0xb85e8f1c, 0x1cfda998), TOBN(0x8208df42, 0x27822503),
+     TOBN(0xeaa82320, 0xa8dd6d76), TOBN(0x7b2fb4ae, 0xad36eb73),
+     TOBN(0x24d73191, 0x97a7b040), TOBN(0xc3ff64ae, 0x4001e02f),
+     TOBN(0xd5d87157, 0x88799d94), TOBN(0x559142d0, 0x93ceb95a),
+     TOBN(0x798a453c, 0x59c3009a), TOBN(0x546b6fab, 0x7d6c83a2),
+     TOBN(0xe263b23a, 0x5c76029a), TOBN(0x85630532, 0x4ac62973),
+     TOBN(0x14ee0643, 0xecb007ac), TOBN(0xf9e06297, 0x7ca60905),
+     TOBN(0x21b2fb23, 0x92f1f170), TOBN(0x31c40918, 0x46528ab2),
+     TOBN(0x43b53242, 0x3395cfd2), TOBN(0x4042138f, 0x6d14fb40),
+     TOBN(0x80899c8c, 0x4464f342), TOBN(0x0f54c993, 0x084be305),
+     TOBN(0xfacecac3, 0xfbf84810), TOBN(0xa6585936, 0x8ae5244f),
+     TOBN(0xb467c3c0, 0x9a9f8d4a), TOBN(0x3e5f219c, 0xfd394895),
+     TOBN(0x39f0767a, 0x9bf85fa8), TOBN(0xd97cc55d, 0xd8ee6022),
+     TOBN(0xc480938f, 0xc83f86c4), TOBN(0x6479b8ef, 0xe43bfcc6),
+     TOBN(0x8e6f2e22, 0x38cabad7), TOBN(0x48e57fdd, 0x31f8c6aa),
+     TOBN(0x66dd6a77, 0xcfbbdcac), TOBN(0xc7d9950b, 0x50ece329),
+     TOBN(0x2e31f205, 0x0747a937), TOBN(0xc0f8a7e2, 0xa07acb8a),
+     TOBN(0x578477bd, 0x15eaa686), TOBN(0xd72fb935, 0xf2f58b50),
+     TOBN(0xe9fdbc6f, 0xd3a64d22), TOBN(0xa3e42674, 0x492dc89f),
+     TOBN(0x42410ffd, 0xa8fb7d24), TOBN(0x08a37dfd, 0x52676ed7),
+     TOBN(0x4607c41b, 0xcb5d6125), TOBN(0x7db48af8, 0x4001fa42),
+     TOBN(0xe2264eb1, 0x50cd30f0), TOBN(0xbb6fe952, 0xe215f8d7),
+     TOBN(0xf3ce2411, 0x97e3fe73), TOBN(0xe52e2179, 0x37f19247),
+     TOBN(0x9c7fc8c0, 0x20c233c1), TOBN(0x91c7e721, 0xb383b101),
+     TOBN(0x1163c472, 0xa7ac883f), TOBN(0xbe1c3b3a, 0x9d3b0f1e),
+     TOBN(0x07be716f, 0xa3536baf), TOBN(0x764d9f4e, 0x62e9c19a),
+     TOBN(0x15af3499, 0x8eaf19f4), TOBN(0x987a7c47, 0x38ea0ace),
+     TOBN(0xb03740b8, 0x4a1f0117), TOBN(0x5cd1164f, 0xfe098a9f),
+     TOBN(0xaf952cef, 0xc9d6fee5), TOBN(0x4e86dcbb, 0x3c0ad28b),
+     TOBN(0x81125450, 0x677b7a8f), TOBN(0xba889fce, 0xe69273d2),
+     TOBN(0x4a40a859, 0x582c5990), TOBN(0x836638b3, 0xf48934c3),
+     TOBN(0xe964e189, 0xf3596ba6), TOBN(0x2f417c0e, 0xde8b0754),
+     TOBN(0xd883169f, 0xd5f93f1b), TOBN(0x0318fe4e, 0xd45bb389),
+     TOBN(0xe2c998a1, 0xdb03273e), TOBN(0xc34f544d, 0x33ec151b),
+     TOBN(0xae0456b1, 0xeb92d963), TOBN(0xaab61ec4, 0x9738857f),
+     TOBN(0x4fb6a34e, 0xf71d9c39), TOBN(0xaa9dbd8c, 0xd816ec44),
+     TOBN(0xf6532e37, 0x5efdf950), TOBN(0x7151dc44, 0x67109c55),
+     TOBN(0xb18b586a, 0x3f4e322c), TOBN(0x27b30066, 0x3553a18b),
+     TOBN(0xbd31ea24, 0x1ae4cd85), TOBN(0xe8f88f4a, 0xa64de69a),
+     TOBN(0x8c946a97, 0x609c13bb), TOBN(0xbf8cc55a, 0x0eebd9f0),
+     TOBN(0x446aa2e4, 0x7a8892b9), TOBN(0x660c0a55, 0x65b98c31),
+     TOBN(0x568c56fc, 0xd3463522), TOBN(0xfa6bf3a6, 0xeb130aa5),
+     TOBN(0x16c1568b, 0x008dc0da), TOBN(0x9c4132cc, 0xfed70a87),
+     TOBN(0x3e983d09, 0xd497fdff), TOBN(0xd7a0e542, 0xf0ebe6b0),
+     TOBN(0x193a07e0, 0x68b542ca), TOBN(0x4909776b, 0x07c6ab4f),
+     TOBN(0x55b77ef4, 0x418acd7b), TOBN(0x64ba62d3, 0x47a77d32),
+     TOBN(0xaec1aa93, 0x2d1f562e), TOBN(0x3468725b, 0x10dc5999),
+     TOBN(0x422851b1, 0x6ff0d478), TOBN(0x15da8429, 0x8e7dddcc),
+     TOBN(0x38567920, 0xb8ac5238), TOBN(0xfd29eb4a, 0x2e3344d8),
+     TOBN(0x7b2af70c, 0x4fc636b5), TOBN(0x242acfc8, 0x879e7640),
+     TOBN(0x88e89786, 0xb5e25c7b), TOBN(0x85576b1b, 0x16ec1bfd),
+     TOBN(0xb31c8253, 0x1891e595), TOBN(0x14315dfe, 0xca5608a5),
+     TOBN(0xb9d61b76, 0xb0c14fd9), TOBN(0x5d5ad8a3, 0x734b6cab),
+     TOBN(0xc2ea321d, 0x44aee005), TOBN(0xd68abd2c, 0x147ed658),
+     TOBN(0x31152d60, 0x893db877), TOBN(0x4807ac46, 0x281487b6),
+     TOBN(0x58ebd15e, 0x65da04b5), TOBN(0xf0f74fd4, 0xb2f9d1fd),
+     TOBN(0x3d04aa65, 0x393c7d91), TOBN(0xb46fb59a, 0x8e7e6a2c),
+     TOBN(0x9236fdf1, 0xae1eed5d), TOBN(0x71936f56, 0x7810e2be),
+     TOBN(0xa1ead7d5, 0x6d9ff147), TOBN(0x32670ed8, 0x149a9b6d),
+     TOBN(0x12772fdd, 0xcb58ea59), TOBN(0xfce260b3, 0x9df52ddb),
+     TOBN(0x3221f2fb, 0xccab1e97), TOBN(0xf8ff7e37, 0x57762484),
+     TOBN(0xb0a31a1c, 0x855512cf), TOBN(0x293a819e, 0xd71d4c4e),
+     TOBN(0xc1ebc896, 0xcd6a900f), TOBN(0xc727a646, 0x9b9e0a4b),
+     TOBN(0x06124fc0, 0x0018f29f), TOBN(0x67bd8fed, 0x41b7730c),
+     TOBN(0xeeebf0f0, 0xc77be72e), TOBN(0x427fe6fe, 0x474d747a),
+     TOBN(0xa7fb9a4f, 0x932ccbf0), TOBN(0xabb9c85e, 0x5f3d489f),
+     TOBN(0xe7e4f956, 0xbdf26442), TOBN(0xd014848e, 0x38d17422),
+     TOBN(0xae37d855, 0xd3e9bff6), TOBN(0x88fbae1d, 0xca5aeb09),
+     TOBN(0x1a8a740b, 0xf025feaa), TOBN(0xc1a67821, 0xb9475ebb),
+     TOBN(0xb6cb6acc, 0xde2bf8a2), TOBN(0x9b2ab1ca, 0x66a0f14e),
+     TOBN(0xcbfbc068, 0x83b2ba59), TOBN(0x336ab62c, 0x68447934),
+     TOBN(0xd3a016a9, 0xf19719b8), TOBN(0x819a31bb, 0x0b5b9d6e),
+     TOBN(0x7b24be2b, 0x3e1c6c0b), TOBN(0x10834b4a, 0x013f6821),
+     TOBN(0xe5e5de27, 0x86f21d2c), TOBN(0x56b46a2d, 0xe9e35ad5),
+     TOBN(0xfc4e861d, 0xe2111e59), TOBN(0x7472ce5e, 0x6e37ca63),
+     TOBN(0xafab9a71, 0x27d2210e), TOBN(0x1644a0a6, 0x9ff6245a),
+     TOBN(0xee498acb, 0x8dbef51f), TOBN(0xd4c70da1, 0x2e9604d3),
+     TOBN(0xde487364, 0x6fecb64c), TOBN(0xa8fda1fd, 0xd15fb62f),
+     TOBN(0x97e2febe, 0x088de028), TOBN(0x4a769019, 0xecdce095),
+     TOBN(0x4cb6a338, 0x50a58ddb), TOBN(0x08df59d8, 0x17028d36),
+     TOBN(0xfe3a80ff, 0xb51722b7), TOBN(0xa3cc2fe2, 0x963c2383),
+     TOBN(0x40b2df49, 0x53cc5341), TOBN(0xf3e90d4c, 0xa3c4bf2f),
+     TOBN(0x3f25c5ec, 0x20f02731), TOBN(0xd84f5b5a, 0x69065d9a),
+     TOBN(0x156d350e, 0x129921be), TOBN(0xe98787cc, 0x1b116922),
+     TOBN(0xba5f9b82, 0x39e77b13), TOBN(0xee4d79f5, 0x044449a5),
+     TOBN(0xb54b7388, 0xdd6d852d), TOBN(0xf7554c5c, 0xf9ca5fdf),
+     TOBN(0x864d1fbf, 0x51228a81), TOBN(0x721e1add, 0x9a80f90b),
+     TOBN(0x89d4e297, 0xad0efa62), TOBN(0x4e471a87, 0x6dba9404),
+     TOBN(0x9a38158b, 0x1c1008b0), TOBN(0x3dfe81a7, 0x95c47ec2),
+     TOBN(0xcb02ce9b, 0x28603026), TOBN(0xfd3207aa, 0x3bd357fc),
+     TOBN(0xb3807bdd, 0xf296f5f2), TOBN(0x7895918d, 0x23c2ea7e),
+     TOBN(0xdc0eb62f, 0x88feb3ba), TOBN(0x024dfd84, 0xbdd75674),
+     TOBN(0xe5bd3828, 0x0a1e0496), TOBN(0xb8b1cd86, 0x24c8f30c),
+     TOBN(0xb559e34d, 0x674d10cf), TOBN(0x6955bb69, 0x9f962ec5),
+     TOBN(0x8bf1ab6c, 0x542af42d), TOBN(0x3f2f33fa, 0xdfa61256),
+     TOBN(0x32140195, 0x73d1049e), TOBN(0xf5089278, 0xdfd7f39b),
+     TOBN(0xb42eb51c, 0xb4237be0), TOBN(0xdf747f44, 0x874d0e57),
+     TOBN(0xbe64bb22, 0x77b5d475), TOBN(0x2c3d5ecb, 0x28308634),
+     TOBN(0x936a2987, 0xcb999c46), TOBN(0x5a30ddfa, 0xe26489ea),
+     TOBN(0x8bfc782e, 0xc8eabf9c), TOBN(0xb9995bb0, 0x74c8c6e3),
+     TOBN(0x4f99c7ac, 0x391f5c5a), TOBN(0x67f4092b, 0x5270c4ad),
+     TOBN(0x6771a29d, 0xe6e8135e), TOBN(0x988dfb2b, 0x6c698cec),
+     TOBN(0x7818600f, 0x77812aa1), TOBN(0x04393c83, 0xfd98e1c1),
+     TOBN(0xe448232e, 0x864ef146), TOBN(0x9b70ecf4, 0xa465ab71),
+     TOBN(0x31df0531, 0xb13cc704), TOBN(0x401ae0b3, 0x16e48426),
+     TOBN(0xa8106630, 0x7fc514ed), TOBN(0xda798170, 0xde4b1614),
+     TOBN(0xde892efc, 0xc2c684fe), TOBN(0xd5205bc1, 0x05d64eff),
+     TOBN(0x84df4ead, 0xe1d59ba5), TOBN(0x65245ca1, 0x89bb2ea7),
+     TOBN(0x3de6ca34, 0x64edbf51), TOBN(0x115296e4, 0x56bcebf9),
+     TOBN(0x0851631f, 0x7fd52a3d), TOBN(0x9881db71, 0x949ad4be),
+     TOBN(0x4b2337dd, 0x88caf772), TOBN(0x02da59de, 0x33ec7979),
+     TOBN(0x2473c620, 0xafe840df), TOBN(0x2965ebff, 0xa92ef1d0),
+     TOBN(0x2452854f, 0x6fcd9651), TOBN(0x97092935, 0xbac2ed99),
+     TOBN(0xf0743ce7, 0x08242246), TOBN(0x76fdd82c, 0x6d1a8439),
+     TOBN(0x3627c890, 0x61079258), TOBN(0x312f98f1, 0x82b21983),
+     TOBN(0xd87dceec, 0xe9173891), TOBN(0xad16cfe0, 0xd7a30e32),
+     TOBN(0xc404a1a6, 0xc9c7efaf), TOBN(0x46e34671, 0xd6df357e),
+     TOBN(0x92fec7c4, 0x7a02aa32), TOBN(0x567fef7e, 0x5a6a7bb9),
+     TOBN(0x35fd570c, 0xa3f97b5d), TOBN(0x456bad8c, 0x4a4b0dfa),
+     TOBN(0x85a3f42c, 0xa677f090), TOBN(0x35060bb8, 0x22a68d53),
+     TOBN(0x1cea9d11, 0x53567530), TOBN(0xf2cbc8dd, 0x8169fbce),
+     TOBN(0xa3e1d52d, 0x86cde794), TOBN(0x72a258cb, 0xb3bdf344),
+     TOBN(0x2997cd59, 0x31b8614d), TOBN(0x31ce2ea4, 0x8164b632),
+     TOBN(0xe495e9b7, 0x0eba7545), TOBN(0xaad69130, 0xbc4403b5),
+     TOBN(0x37f6389b, 0x45760d9b), TOBN(0x00f4d58d, 0xb871b17d),
+     TOBN(0x91973d4d, 0x4aa359d7), TOBN(0x249f510c, 0xc8dd0582),
+     TOBN(0xef11ac87, 0x7608be27), TOBN(0xce116714, 0xd940b1c7),
+     TOBN(0xf34881f3, 0xfef20037), TOBN(0x26222472, 0x98203f4e),
+     TOBN(0x4c9e98ed, 0xe9363154), TOBN(0xa806b3a6, 0x03a8158d),
+     TOBN(0xdd974d66, 0x09d16ce3), TOBN(0xe1bcc513, 0x59ae977a),
+     TOBN(0x0e6201c7, 0x218464d6), TOBN(0x05789811, 0x9e35c7af),
+     TOBN(0xb1596f7a, 0x8b33a863), TOBN(0x8fa93aeb, 0x42bd8284),
+     TOBN(0xf197c202, 0x46e11559), TOBN(0x356b9c81, 0xadd27d86),
+     TOBN(0x3c4080fd, 0x1695cb70), TOBN(0xc10c28cc, 0x20f20318),
+     TOBN(0xe9d7ed93, 0xce1ffab9), TOBN(0xb23976b3, 0x4f9de9bd),
+     TOBN(0x9b1b81dd, 0x6d61a6f2), TOBN(0x7537d729, 0xf6318874),
+     TOBN(0xb75022f4, 0x20cee7ab), TOBN(0x425fddba, 0xaa430952),
+     TOBN(0x54c4306d, 0x1ccfb3fd), TOBN(0xf10a54f1, 0x46a30a37),
+     TOBN(0x2d332a29, 0x74fd4925), TOBN(0x8d2fa921, 0x1438feb2),
+     TOBN(0x46a9c6b5, 0xfbb41bd2), TOBN(0x87e98550, 0xd30c65fd),
+     TOBN(0xfbcb2ca6, 0x66cd9a20), TOBN(0xc176530e, 0x91719670),
+     TOBN(0xdd4a1a18, 0xcec38056), TOBN(0xe6ef1793, 0x75544998),
+     TOBN(0xf58f69cf, 0x30583fb6), TOBN(0x12197860, 0xaa76bf2b),
+     TOBN(0x717813e5, 0x3bb686fc), TOBN(0x9beeb1ae, 0x0f06c403),
+     TOBN(0xd83416ee, 0x2782dc86), TOBN(0x5fc89c01, 0xb5500ccc),
+     TOBN(0x063aee25, 0x8e110ed3), TOBN(0x1a87377c, 0x45963073),
+     TOBN(0x86944f59, 0x5110634f), TOBN(0x50659ae1, 0x0ba76459),
+     TOBN(0xa00e48ff, 0xde9eb40d), TOBN(0x49235afa, 0xfe5b118c),
+     TOBN(0x81705008, 0xc425ee38), TOBN(0x3c01abc8, 0x2d5f2f92),
+     TOBN(0x4a21bc95, 0x6fdf148b), TOBN(0xea5cc30e, 0x0b7e6871),
+     TOBN(0x90b4abb6, 0x11713844), TOBN(0x3b7d734f, 0xf2001af9),
+     TOBN(0xfc616b89, 0x782b2020), TOBN(0x68b3935c, 0xd8b0e02d),
+     TOBN(0x54cf5b8c, 0x1cbb2de4), TOBN(0x42b0432a, 0xa7c0f7ac),
+     TOBN(0xa04e06ef, 0xbdffae5e), TOBN(0x36cac28e, 0xd4b636ee),
+     TOBN(0x08a06b2f, 0xc3a98127), TOBN(0x1ef0b57b, 0x290c5385),
+     TOBN(0x14e184b8, 0x27154c46), TOBN(0xa5dd3444, 0x60910b3e),
+     TOBN(0xd0008ac4, 0x3c67a74b), TOBN(0x2649cba4, 0xefed9fd1),
+     TOBN(0x26bc537a, 0xf0c1bb4f), TOBN(0x37f376ff, 0xd06b90f5),
+     TOBN(0x4d48d994, 0xbe7c89cf), TOBN(0x511c2158, 0x8d572003),
+     TOBN(0xc26fbac1, 0x088dda1e), TOBN(0xc3d55189, 0x7ad4934c),
+     TOBN(0x5233c176, 0x85dcaf7c), TOBN(0xec3a8a29, 0xa88b473d)},
+    {TOBN(0xfd96667a, 0xb1f0c175), TOBN(0xa256a611, 0x2ab99e7d),
+     TOBN(0xff07c1ea, 0x05e43f9d), TOBN(0x305700bc, 0x7e1c9cd6),
+     TOBN(0x3f1e2546, 0x2b2887a3), TOBN(0xdd782f49, 0xc772fd14),
+     TOBN(0x9125f996, 0x38584057), TOBN(0x19fd0396, 0x16a02cf9),
+     TOBN(0xa8d62bd3, 0x4c58174d), TOBN(0x872251d3, 0xa900551f),
+     TOBN(0x06f5862d, 0xf12802c3), TOBN(0x5d93c48a, 0xdd925555),
+     TOBN(0xc39b67d5, 0xbd6006f8), TOBN(0xea6f756b, 0xf96ccc67),
+     TOBN(0x140e853e, 0x543014db), TOBN(0x2bdc5674, 0xe9de42c0),
+     TOBN(0x01dfda7b, 0xe01c073d), TOBN(0x07a6bb65, 0xff9e1234),
+     TOBN(0x2a4f7f18, 0x622cee4e), TOBN(0xdf4cead8, 0x50f0a3a7),
+     TOBN(0x152b3c8e, 0x1b8c2903), TOBN(0x9e82e999, 0x5f2a89b3),
+     TOBN(0x0e6cfa7e, 0x68ce7a3c), TOBN(0xebb34d90, 0x0ca0464c),
+     TOBN(0xfa1a58fa, 0xeda49f74), TOBN(0xddb89957, 0x0e4545a3),
+     TOBN(0xd3576489, 0xc74c07e4), TOBN(0x64e4b39e, 0xb59b1008),
+     TOBN(0x3b090340, 0xf66b546c), TOBN(0x0e0f4013, 0xcdeb912f),
+     TOBN(0xbb00b46c, 0x01e55cca), TOBN(0x55b61b34, 0x99ad0768),
+     TOBN(0xb06b71fc, 0xe8bbda5b), TOBN(0x8de64d84, 0xa24b0a63),
+     TOBN(0xb73dc262, 0xb5d4603f), TOBN(0x5d5fa964, 0x1965a916),
+     TOBN(0xb48a4053, 0x3bc98966), TOBN(0xaa871863, 0x6f564743),
+     TOBN(0x88b00822, 0xe76a6a3e), TOBN(0x58c9e92e, 0xb38d9e0d),
+     TOBN(0xc0d22337, 0xe989963e), TOBN(0x2c4831ce, 0xd3778d5a),
+     TOBN(0xd775c6a5, 0xee8c4178), TOBN(0xe2391654, 0x9d0c2894),
+     TOBN(0xf7d4fe86, 0x5d0eb314), TOBN(0x42801b8f, 0x8b2290d3),
+     TOBN(0x73e9b332, 0xcdcefa78), TOBN(0xc0d169d9, 0x3e877fea),
+     TOBN(0x29c8138b, 0xffee23fa), TOBN(0xbff98230, 0xfb92e3b8),
+     TOBN(0x14077ad5, 0x8fa75007), TOBN(0x4d3a6e10, 0x88e61b81),
+     TOBN(0x218a867d, 0x3bcf733d), TOBN(0x20ff6566, 0x665e37fc),
+     TOBN(0xe39c0581, 0xda5cbf67), TOBN(0x4a6e1d7c, 0x8add8c4c),
+     TOBN(0xcab02370, 0x734a1327), TOBN(0xa1df7afc, 0x1951afa8),
+     TOBN(0x581cfbaf, 0x42638b8a), TOBN(0x39db6d2b, 0x2130eaa6),
+     TOBN(0x4bbc805b, 0xda2f91a5), TOBN(0x3dcb0a7e, 0xe569add8),
+     TOBN(0x724ab65a, 0xd721fa7d), TOBN(0xa5152b95, 0xf88f8008),
+     TOBN(0x7fe7f1b9, 0x281615ba), TOBN(0x419d1a53, 0x41d5aa0c),
+     TOBN(0xafc556dc, 0x9fb0917e), TOBN(0xab2a69f3, 0x616ce893),
+     TOBN(0xfb9a6eb1, 0xc0861e05), TOBN(0x0b74ae11, 0x5eb02b8f),
+     TOBN(0xccff0ad5, 0x3b1e44fe), TOBN(0x86dfe0e6, 0x88824f53),
+     TOBN(0xedf38dc4, 0x41177a46), TOBN(0xd9a955bb, 0x7f039a7b),
+     TOBN(0x4f152581, 0x4d8ae7c2), TOBN(0x063c9f83, 0x4f848819),
+     TOBN(0x54ea4526, 0x841e8783), TOBN(0xe86a4119, 0xaa5f2b32),
+     TOBN(0xb7529a3b, 0x19846dcf), TOBN(0x91356a07, 0x35689d70),
+     TOBN(0xbe66f5db, 0x8f049ef8), TOBN(0x0f5fd99e, 0xc38dd5ed),
+     TOBN(0x1896d52b, 0x1b4ae7a7), TOBN(0xf27c45c6, 0x480b1ebb),
+     TOBN(0xd88cff4c, 0x3fede5c1), TOBN(0x57d902c9, 0xda27560b),
+     TOBN(0x84aa7f07, 0x52d57deb), TOBN(0x8da4c7c8, 0x08bb6028),
+     TOBN(0x658f4dea, 0x8910763e), TOBN(0x6e5fcb48, 0x076a0f80),
+     TOBN(0x6a5447a4, 0xab65f9b9), TOBN(0xd7d863d4, 0xa75bb0c5),
+     TOBN(0x806c34a7, 0xe87e7916), TOBN(0x05391559, 0xcd961e88),
+     TOBN(0x5def2d88, 0x74fe6aeb), TOBN(0x8ac350b2, 0xf9226ca1),
+     TOBN(0xffa8a649, 0x12401813), TOBN(0xd6182762, 0x5337c55d),
+     TOBN(0xfce9d7ff, 0x3be902e3), TOBN(0xb3b275d1, 0xea0dd7a5),
+     TOBN(0x342620f4, 0x2cb48ac9), TOBN(0xc0369384, 0xa8b38a74),
+     TOBN(0x04b0ee6a, 0xc0695d3a), TOBN(0x4d025585, 0x94c5394d),
+     TOBN(0xff9635d0, 0x81443d16), TOBN(0x2342cbfa, 0xa6cc364b),
+     TOBN(0x63b0a032, 0x25bf8438), TOBN(0x6ccd3ce5, 0xa078d298),
+     TOBN(0xf93bd108, 0x91292fd3), TOBN(0xc887a31b, 0x14073286),
+     TOBN(0xeb1275bf, 0x9f62cd16), TOBN(0x0335bae3, 0x61578b46),
+     TOBN(0x810d5efd, 0x53348e4e), TOBN(0xf9cd822a, 0x63c74225),
+     TOBN(0x93d2e810, 0xa426bf44), TOBN(0x95a47a97, 0x019d36b3),
+     TOBN(0x1da421b9, 0xd5d1f840), TOBN(0xe5b8a55f, 0xd6c46e3c),
+     TOBN(0x2dd3a5e7, 0xc9244881), TOBN(0xd50f9cde, 0x70c1fd2f),
+     TOBN(0xbee2aca7, 0x614d9ff3), TOBN(0xd1f13b2c, 0x358f245a),
+     TOBN(0x9e92d83f, 0xc46f62ab), TOBN(0xc1dd32dd, 0x827d7374),
+     TOBN(0x1636d593, 0xc3e566e7), TOBN(0x81c2f4e7, 0x04ccb02b),
+     TOBN(0xb57782c6, 0xcd35b652), TOBN(0xad88787e, 0x88210d42),
+     TOBN(0x3ad52d72, 0xfbd7d35a), TOBN(0x4117f502, 0x37a2a095),
+     TOBN(0xed03d415, 0xd356b3b6), TOBN(0x135d5a8c, 0x15ca6087),
+     TOBN(0xfbaba41f, 0xef5dca2a), TOBN(0x660e5cd0, 0xafb4787d),
+     TOBN(0xe0e66378, 0xa55e9ef0), TOBN(0xf24513cf, 0x69939f56),
+     TOBN(0x0f38f09c, 0xab4f6bd9), TOBN(0xec3037b4, 0x922dcac1),
+     TOBN(0x706b201a, 0x08a1a51e), TOBN(0x15911351, 0x8ffff040),
+     TOBN(0x239d7b6a, 0xccf63d87), TOBN(0xeca37dc8, 0x5187f595),
+     TOBN(0x04ea79e4, 0xad5a0ab3), TOBN(0xcdd81522, 0xe9520e8f),
+     TOBN(0x7fe6b6aa, 0xc35e1020), TOBN(0x57b63c9e, 0x140ac884),
+     TOBN(0xc45c23fc, 0x33f19077), TOBN(0x468d2c36, 0xb71273c5),
+     TOBN(0xeb6839d6, 0xfc305ac2), TOBN(0xf6e310ff, 0x0183793a),
+     TOBN(0xbca206e4, 0x32da639d), TOBN(0x8eb5cac1, 0x8518e27e),
+     TOBN(0xfeed0feb, 0x66ed96f9), TOBN(0x1632632e, 0xecc3a8dc),
+     TOBN(0x90449363, 0x1455c8ae), TOBN(0x8d7619d4, 0x0aeada65),
+     TOBN(0x2f2fa898, 0x9f630ee9), TOBN(0xd78caf0c, 0x370db87c),
+     TOBN(0x46fa0fc9, 0xc45898cf), TOBN(0xa509cc3e, 0x2d84244f),
+     TOBN(0xbdbea4b4, 0xa5b099aa), TOBN(0x8e8fe284, 0x7592587b),
+     TOBN(0x0226d387, 0x42000897), TOBN(0xb6780551, 0x36db5cd9),
+     TOBN(0xd8fe5eb1, 0xca64f047), TOBN(0x6f21474b, 0xb77cf8cb),
+     TOBN(0xab8fcae7, 0xee45ae34), TOBN(0x73eaf9eb, 0x1f19cd67),
+     TOBN(0x5bb96415, 0xee4df6ce), TOBN(0xd1e27bcf, 0xa3ae4cf3),
+     TOBN(0x9bf7ace3, 0xc7f1868e), TOBN(0xe821aa8b, 0x82091dca),
+     TOBN(0xf732e6bc, 0xd381b6c4), TOBN(0x5feda346, 0xdd01864f),
+     TOBN(0x0933b92c, 0xb6387846), TOBN(0xbf1f1e83, 0xa0028029),
+     TOBN(0x0848bf8c, 0xa3e38124), TOBN(0xfe295fdf, 0x208fda8f),
+     TOBN(0x73379239, 0x8913a1c4), TOBN(0x59354b24, 0x7e78564e),
+     TOBN(0x042b7529, 0x32dcafbc), TOBN(0x752173d3, 0xfa93c5c7),
+     TOBN(0x6ffd4590, 0x9737135a), TOBN(0x249712b0, 0x0f983005),
+     TOBN(0xdbba2874, 0x1f25da8b), TOBN(0x14027f11, 0x097ba4a9),
+     TOBN(0xe429b3c7, 0x34b8e4a2), TOBN(0xd66a43e3, 0x056b4afc),
+     TOBN(0x158644ad, 0x2ac351e6), TOBN(0xff4aecd9, 0x164bc6cc),
+     TOBN(0xbb5b0c87, 0xf6c615ee), TOBN(0xc497d8ee, 0xd7679b1b),
+     TOBN(0xf666c625, 0xf1c6e97a), TOBN(0xe89f84b2, 0xc73a277f),
+     TOBN(0x2403d513, 0x746af4c0), TOBN(0xe6858fdf, 0xb7101feb),
+     TOBN(0x1a42c51b, 0x84f1dcb7), TOBN(0xc57f12e0, 0x8202bc04),
+     TOBN(0xf8326a93, 0x754df5ae), TOBN(0x3d3daf04, 0x81a46aef),
+     TOBN(0x8bb8c276, 0x01232d03), TOBN(0xd446c82e, 0xfb371cf1),
+     TOBN(0xe5e8b639, 0xefa495f4), TOBN(0x51a7b34a, 0x477e6493),
+     TOBN(0xffba5466, 0x824f2b6e), TOBN(0xcc67ddad, 0xf0eaa6a9),
+     TOBN(0xcf0f8ce1, 0xfee19b24), TOBN(0x34309127, 0x83b3df41),
+     TOBN(0xc8b13e8c, 0x9719a6cd), TOBN(0xb408e505, 0x619d5c33),
+     TOBN(0x8c1b831b, 0xa3158864), TOBN(0x506b3c16, 0x0b3d02bb),
+     TOBN(0xf23846bc, 0xbf11ff8d), TOBN(0xf0f043e8, 0x16e0328a),
+     TOBN(0x30b7b9cd, 0x65986a7a), TOBN(0x0951b102, 0x21b660cd),
+     TOBN(0x72a26c5f, 0x52bf29a5), TOBN(0xb513d669, 0xb6534592),
+     TOBN(0xb8ac15ad, 0x578195ea), TOBN(0xd6ed33ea, 0xc0785f88),
+     TOBN(0x39e23dbf, 0xb9e33946), TOBN(0xeadb2453, 0xf43e88eb),
+     TOBN(0x6d82fefa, 0x2746c34b), TOBN(0xe9172aa0, 0xcc542b54),
+     TOBN(0x8af6b819, 0xecb50699), TOBN(0x4af76939, 0x1c1d0af9),
+     TOBN(0x5a7dbbbe, 0x99dddb1a), TOBN(0x97b0a3aa, 0x891ea41d),
+     TOBN(0x32b457e6, 0x6e35ea4f), TOBN(0xe2a21c2a, 0x9d77b900),
+     TOBN(0xb18718d6, 0x2ac991cf), TOBN(0xc4416237, 0x740743cd),
+     TOBN(0xcc3f76b6, 0x6a05ab55), TOBN(0x2ab4b29e, 0x98091425),
+     TOBN(0xbf373ad1, 0xb6478fc8), TOBN(0x8a1a9489, 0x178b5844),
+     TOBN(0xb5295edf, 0x09daf4be), TOBN(0x07fbb119, 0x4ed54766),
+     TOBN(0x6e44367b, 0x7d0b9d8f), TOBN(0x6dc4d8f6, 0xedb96a10),
+     TOBN(0x2ba69106, 0x37fc19a3), TOBN(0x522eba39, 0x0b138296),
+     TOBN(0x751544c7, 0xfda58cf3), TOBN(0xaba6fe16, 0x0ba33938),
+     TOBN(0x48e085be, 0x94dac7d6), TOBN(0x06c87014, 0x19f99faa),
+     TOBN(0x33b9a8d6, 0x1a587f89), TOBN(0xdae382ca, 0x3fd8d8fe),
+     TOBN(0xb5b383c6, 0x150b0fcd), TOBN(0xf948da80, 0xed9b0f4c),
+     TOBN(0xcf075225, 0xccd05413), TOBN(0x3f31b12c, 0x4f62be64),
+     TOBN(0x23b21fc8, 0x368c17f6), TOBN(0x423d5369, 0x400bc690),
+     TOBN(0x5335dd1e, 0xdeac140e), TOBN(0xe631c249, 0x9493ad61),
+     TOBN(0xc274c695, 0x32fe490a), TOBN(0x42bcb4e1, 0x6d8ebd70),
+     TOBN(0x69059e1e, 0x65d7a1d0), TOBN(0xf36dfe2f, 0x29fdd109),
+     TOBN(0xacfea1ec, 0x0c4e6370), TOBN(0x97e7f722, 0x7a935ff4),
+     TOBN(0x83e7c7c3, 0xf8006bbd), TOBN(0x87a8b84d, 0x78e6792c),
+     TOBN(0x5cbe4883, 0x94d3d60f), TOBN(0x6eba464d, 0x91cbc054),
+     TOBN(0xf9c880d0, 0x021c38fa), TOBN(0x6200faf1, 0x21af4942),
+     TOBN(0xd5b2b12d, 0x5f03e261), TOBN(0x1659a0ac, 0xf3ea3e07),
+     TOBN(0x8008f18d, 0x836757a8), TOBN(0xfb2f467b, 0x75a8f8e0),
+     TOBN(0x9a6183c7, 0x9c9b00cc), TOBN(0x82ca07e3, 0x3bf842b0),
+     TOBN(0xe7089191, 0xee1f83d9), TOBN(0xc41ecde4, 0x2d0cd2da),
+     TOBN(0x0ce421b0, 0x4d1feacd), TOBN(0xe80a1395, 0x431c53f1),
+     TOBN(0xae9b2018, 0xe6bfccf5), TOBN(0xdf9f86ad, 0x8b359c3b),
+     TOBN(0x9887e28f, 0xb6170a5f), TOBN(0xf5b85d21, 0xf3c0c30c),
+     TOBN(0x30861cf8, 0x632af7a4), TOBN(0x2fb670ad, 0xbb4ec123),
+     TOBN(0x0668b84c, 0x3c425976), TOBN(0x55c21b4e, 0x02883af7),
+     TOBN(0x0fad58b5, 0xf8698d29), TOBN(0xef210770, 0x68b671c5),
+     TOBN(0x534d510a, 0x23f232b8), TOBN(0xdb66fec1, 0x49c99708),
+     TOBN(0xf1a6f3e7, 0x6d54721b), TOBN(0x8d37ab64, 0x4480f858),
+     TOBN(0x7fcfca6c, 0xb0f7f354), TOBN(0x58c7ff5f, 0x95bfd318),
+     TOBN(0x3048e9af, 0x903f9d91), TOBN(0xe480bc0e, 0x75357af0),
+     TOBN(0x4f915e1c, 0xa5a1162e), TOBN(0xdd539c21, 0x37efa40c),
+     TOBN(0x61a45c53, 0x789201c2), TOBN(0x1bc2333d, 0xe7890746),
+     TOBN(0xeed38f50, 0xbbed8f77), TOBN(0xc1e93732, 0x178501a0),
+     TOBN(0xfed5b1d1, 0xa8fb8623), TOBN(0xa3be3e2c, 0xdc3e1148),
+     TOBN(0x62fc1633, 0xa71a390a), TOBN(0x4be2868e, 0x2891c4c3),
+     TOBN(0x6573fe49, 0x2a0c3c23), TOBN(0x182d0bd4, 0xde1589d0),
+     TOBN(0x17c6a780, 0x5a7aa63d), TOBN(0x9d84cfa8, 0x12543191),
+     TOBN(0xcdb22db7, 0x950c85c9), TOBN(0xd03589e0, 0x119010c4),
+     TOBN(0xbcd02e8a, 0x8220dee8), TOBN(0xbd4d1f2a, 0x705632fd),
+     TOBN(0x00119bfd, 0x22f8e30b), TOBN(0x06c6e73e, 0x6eb97c32),
+     TOBN(0xa26f0a6a, 0x35abff53), TOBN(0x7d79a89f, 0x8564c37d),
+     TOBN(0x0347bb17, 0x1b207495), TOBN(0x1baf90e9, 0xb5c8253a),
+     TOBN(0x01059b5f, 0x37affc96), TOBN(0xbe76c578, 0xffee0a60),
+     TOBN(0x45d7291b, 0x75d6b83c), TOBN(0x212ff131, 0xe0b58129),
+     TOBN(0x4acc5748, 0xaa5d46ed), TOBN(0x9fc557d9, 0x9193931b),
+     TOBN(0x17568fcf, 0xda4eba9b), TOBN(0x2cf3690c, 0xa0edc975),
+     TOBN(0x0e8b0e7e, 0x953df6fd), TOBN(0x38ea7cea, 0x62036a87),
+     TOBN(0x57e01428, 0x655c3685), TOBN(0xaedfee73, 0xc39d8a43),
+     TOBN(0xed7f6598, 0x5fb27e0a), TOBN(0x524c3653, 0x946888e0),
+     TOBN(0xd84a299b, 0xe949b72f), TOBN(0x76c1397a, 0xb0c61ea4),
+     TOBN(0xfd9f7ed0, 0x1afe465a), TOBN(0x832c69ad, 0xdbbaf852),
+     TOBN(0xcd888c22, 0x03713338), TOBN(0x4e1fe026, 0xe3306617),
+     TOBN(0xa87adf86, 0x23521b97), TOBN(0x673d3625, 0xf9fbb2a0),
+     TOBN(0xf29a1413, 0x5d8f5b80), TOBN(0x6e9be0c4, 0xd3526501),
+     TOBN(0x6129f861, 0xe8bfd84d), TOBN(0x1df491d6, 0x77e35a47),
+     TOBN(0xefe0e9a9, 0xa84a82cb), TOBN(0x972bc3bc, 0x6d949612),
+     TOBN(0x8d7795f5, 0x3a766eca), TOBN(0x6119383f, 0x12fcc6d4),
+     TOBN(0xa66d9836, 0xc95f0e21), TOBN(0x77a0aa0a, 0x684e434b),
+     TOBN(0x3d55d256, 0x7dd7b05a), TOBN(0xda616243, 0x0fed8362),
+     TOBN(0x24bd0fe8, 0x383e94fe), TOBN(0xbc2b7334, 0x6bfd0cd2),
+     TOBN(0xf9497232, 0x321f7a70), TOBN(0x37a4c2f6, 0x6a3df54f),
+     TOBN(0x7ba783bf, 0x4ddc49d6), TOBN(0x4d142317, 0x04408c76),
+     TOBN(0x7502146b, 0x38b99f23), TOBN(0x479ab73c, 0x21992e8f),
+     TOBN(0xf605370a, 0xd52c41d3), TOBN(0x358b746d, 0x3a60435f),
+     TOBN(0xb2cbab94, 0x5bc537b8), TOBN(0x1fd24431, 0xb99057d3),
+     TOBN(0xff2242a0, 0xb8510f3c), TOBN(0x74b4965d, 0x0733bc53),
+     TOBN(0x30a3a634, 0x86edc9b2), TOBN(0x99c9cf19, 0x49c07c7f),
+     TOBN(0x9d8a50c2, 0x5b0cd506), TOBN(0x0ed9da5a, 0xbbcb3d65),
+     TOBN(0x6de1fb5e, 0x013f88ec), TOBN(0xc9356bff, 0x09086f8c),
+     TOBN(0xa272e1ac, 0x2b8825d7), TOBN(0x3ad83acb, 0xf2c5ba33),
+     TOBN(0x721ca22c, 0x275bce43), TOBN(0xf058b8a7, 0xd24f78e8),
+     TOBN(0xd178eb57, 0xeed46b97), TOBN(0x4ad7d425, 0x259fdb5b),
+     TOBN(0x669ed853, 0x1b515fe5), TOBN(0x9f14b8e5, 0x76fa1b5e),
+     TOBN(0xfaba8d0c, 0x3da46b02), TOBN(0x759c2c95, 0x338f7652),
+     TOBN(0x9a369cb0, 0xb5c0ceb3), TOBN(0xc1d2d1ab, 0x28a2a633),
+     TOBN(0x676190e3, 0xfcb48cd3), TOBN(0x9af97ab3, 0xee09c3b1),
+     TOBN(0x39323719, 0xf7e918f5), TOBN(0xc657cb57, 0xfd3cd554),
+     TOBN(0x78a33d05, 0xa2a02d5c), TOBN(0xda3b79df, 0x64ada03f),
+     TOBN(0x7115ab5c, 0x61b3a72a), TOBN(0xdd19f34b, 0x337194fc),
+     TOBN(0x0f23bfec, 0x8f0a14c3), TOBN(0x1fe19eec, 0xa60485d3),
+     TOBN(0x1ca308c3, 0xa463dc9b), TOBN(0x83e18dd0, 0x5e1ae8be),
+     TOBN(0x849eabdf, 0xd928c0e7), TOBN(0x2d131ff5, 0x6bd3e7b3),
+     TOBN(0xc84cd284, 0x45be4c14), TOBN(0xdee94092, 0xf8f4c719),
+     TOBN(0xe8f223ef, 0x3cb73831), TOBN(0x24382f88, 0x18c2361e),
+     TOBN(0x205366d0, 0xbe91c8dd), TOBN(0x1e17b50c, 0x56024b95),
+     TOBN(0x3c3487da, 0x742cabd3), TOBN(0xbe451387, 0x8bad494c),
+     TOBN(0xfae6c0bf, 0x18ffaef0), TOBN(0x2e7b0ee3, 0x85ed1ede),
+     TOBN(0x3cebaa05, 0x125d1488), TOBN(0xcd0de0fe, 0x7c8b7fb8),
+     TOBN(0x59434d54, 0x464bc74a), TOBN(0x17472da2, 0xa03fd77b),
+     TOBN(0xab23d042, 0x2c1a9edc), TOBN(0x5390625e, 0xd9cf4b37),
+     TOBN(0x43b85844, 0x0531264e), TOBN(0x8d71805e, 0xee7aedca),
+     TOBN(0x4ace3068, 0xfbe643ad), TOBN(0xc98d1cd2, 0x5f7d46c1),
+     TOBN(0xd4888744, 0xf59b3acd), TOBN(0xcf662d61, 0x27288b99),
+     TOBN(0xf2704561, 0x5bce2649), TOBN(0x33a8f3f9, 0x206ae654),
+     TOBN(0xe834843f, 0x9bce2b39), TOBN(0x8de8e41d, 0xa90cfc7d),
+     TOBN(0x398800ed, 0xd81115b4), TOBN(0x4d33f7c5, 0xff2532da),
+     TOBN(0x5ae37fb2, 0xdcc59e2c), TOBN(0xca27b622, 0x24015306),
+     TOBN(0x51beca89, 0x11e8d6e6), TOBN(0x08c0b7e2, 0xa9693774),
+     TOBN(0x795e1a21, 0x72fa713e), TOBN(0x5ec1c123, 0x4be58266),
+     TOBN(0x5d8e87da, 0x1be14fc3), TOBN(0x82cefc1e, 0x80283ad5),
+     TOBN(0x820a385b, 0xdab7865e), TOBN(0x11e32d62, 0xf3daf96c),
+     TOBN(0xf022ade7, 0x5835a989), TOBN(0x2cbc2554, 0x00242233),
+     TOBN(0x653335a0, 0xe7ce649c), TOBN(0x8b30baef, 0x6857eff7),
+     TOBN(0x7ea7c856, 0xf3288377), TOBN(0x1387b347, 0xe8572f5d),
+     TOBN(0x8a6b0352, 0xbe10c0cf), TOBN(0x2a74e834, 0x037c97b9),
+     TOBN(0xfe10bf59, 0x197b122e), TOBN(0xd1ee174c, 0x1918aced),
+     TOBN(0x568e5fb9, 0x3958c20d), TOBN(0x1188cbe6, 0x0484a92f),
+     TOBN(0x00ec14f4, 0x4b0d29e3), TOBN(0x2b2e078e, 0x16a2796d),
+     TOBN(0x48b8cffa, 0x20440444), TOBN(0xd4b877a0, 0x661ab68d),
+     TOBN(0x1f352ab1, 0xc4b459fa), TOBN(0x33accbe6, 0xc53aa54c),
+     TOBN(0xce4ff566, 0x02bb383b), TOBN(0xcad561c6, 0xfd62813d),
+     TOBN(0x0927c348, 0x01dfc9a8), TOBN(0x0dde73fb, 0x00fb9a61),
+     TOBN(0xd859809f, 0xfce59f34), TOBN(0x225bd9b6, 0x81872a46),
+     TOBN(0x2642add2, 0x0314bb90), TOBN(0x82dc7958, 0x0ae61eb8),
+     TOBN(0x84c97478, 0x22d5b667), TOBN(0xb2fe94d1, 0x6214f46d),
+     TOBN(0x834740f2, 0x12cb20de), TOBN(0x336dc7a7, 0x8aa69c94),
+     TOBN(0x8ca085a4, 0x939a33e6), TOBN(0xd59c9ae9, 0x75a94543),
+     TOBN(0x83c97f98, 0x3c47dd07), TOBN(0x0985f73e, 0xe3177231),
+     TOBN(0xe556c3fc, 0xebbc623d), TOBN(0x30a3242f, 0xb1b968fa),
+     TOBN(0x842ce9b0, 0xbcd05a51), TOBN(0x241a35ed, 0x0ad576ce),
+     TOBN(0x49ccaf3c, 0xbb4a793e), TOBN(0x6e6c7a7b, 0x4492a828),
+     TOBN(0x72f4f5fc, 0xba53eb42), TOBN(0x0ca4ba53, 0x3ea74dab),
+     TOBN(0xe7b5fb06, 0xbbaf9d5f), TOBN(0xd49c2e17, 0xb02d3b20),
+     TOBN(0x4d31052a, 0x2d933cc8), TOBN(0x5346e0b4, 0x07299aec),
+     TOBN(0x952a6205, 0x79aa99ec), TOBN(0xaab9bc32, 0xecb34e97),
+     TOBN(0xd539d7e4, 0x58ffe9ae), TOBN(0x91599393, 0x9d994472),
+     TOBN(0x6b1d4868, 0xe8822711), TOBN(0x8857e282, 0x73d452b8),
+     TOBN(0xad59adfd, 0xf08ed046), TOBN(0xdb755d65, 0xc1c47abe),
+     TOBN(0x2df8520b, 0x63275d49), TOBN(0xc3c712ec, 0x7f8a3249),
+     TOBN(0x55f2a108, 0x5215ef57), TOBN(0x955e07a3, 0x3ee2f149),
+     TOBN(0x2194ff53, 0x33f344f4), TOBN(0xb455b9fe, 0xbad16820),
+     TOBN(0xfe69ea78, 0x610b4e4c), TOBN(0x2957be96, 0x8ab11fe8),
+     TOBN(0x3efdee3c, 0x2ce14366), TOBN(0x42043f9f, 0x01eddf9f),
+     TOBN(0xfb7998b1, 0x93524f6c), TOBN(0x95ea64c0, 0xdfecf763),
+     TOBN(0xb23d2620, 0x21afa86f), TOBN(0xea757f03, 0x86b11457),
+     TOBN(0x0bc4d2d1, 0xb0148d30), TOBN(0x119b5535, 0x88ce4170),
+     TOBN(0xaab5bb67, 0x0aa9c8f6), TOBN(0xdfc9693c, 0x88e05de2),
+     TOBN(0x6cae7e57, 0xe3f1e9c3), TOBN(0x2b1ceb54, 0x6f6c3b9c)},
+    {TOBN(0x12e335ca, 0x87636183), TOBN(0x1461a65a, 0x719d1ca3),
+     TOBN(0x8150080a, 0xb14161d8), TOBN(0x08da4ebf, 0xc612e112),
+     TOBN(0xc95dfb6b, 0xa8498a9a), TOBN(0x099cf91d, 0xba0f8dba),
+     TOBN(0x12d2ae14, 0x4fb4f497), TOBN(0xfa3a28b0, 0x33cb7306),
+     TOBN(0xc89fc5d0, 0x0f01c7ce), TOBN(0x6fc45ffd, 0x7283bdf0),
+     TOBN(0x71dece81, 0x81151923), TOBN(0xed1cb14c, 0xc433fcc9),
+     TOBN(0x4279612b, 0xd3959bcf), TOBN(0xe163880b, 0x35b5732f),
+     TOBN(0x35414ca7, 0x71d0a1ca), TOBN(0xe8b9e651, 0x2c1e47f3),
+     TOBN(0x4ff11b0c, 0xc8df0a74), TOBN(0x346ba520, 0xe095ea9a),
+     TOBN(0x81dd2268, 0xcc2bc6c0), TOBN(0x2fb2e99f, 0xc2701468),
+     TOBN(0x0d213361, 0x98053f0e), TOBN(0xe0b8280d, 0xf7ae879a),
+     TOBN(0xd92b7a75, 0x952560f7), TOBN(0x8d17dfad, 0x9723b62e),
+     TOBN(0x5ce8a78a, 0x08b21362), TOBN(0xf37f5e7f, 0xd9fe0b36),
+     TOBN(0xdca66c7f, 0x2c87837c), TOBN(0x92524b94, 0x0bf2e993),
+     TOBN(0xfc0f020c, 0x71745788), TOBN(0x6018de46, 0x3cbfbf4c),
+     TOBN(0xa8446691, 0xac3de1c8), TOBN(0xb194d419, 0x5de5ae41),
+     TOBN(0x1586cdff, 0x2ff27af2), TOBN(0xee628535, 0xde26b5ef),
+     TOBN(0x58480040, 0xc682923e), TOBN(0x4dd4596b, 0x5e37da30),
+     TOBN(0x247b9fd7, 0x2f64225f), TOBN(0xdcc6de5f, 0x51ca2121),
+     TOBN(0x99fb41ac, 0x86e7ab9a), TOBN(0x54c782a0, 0x952b413a),
+     TOBN(0x7641190e, 0x7298c7d9), TOBN(0x499c35ed, 0x716eda14),
+     TOBN(0x316134bf, 0xbb764e90), TOBN(0x4d23467e, 0x884fc34e),
+     TOBN(0xfd1208a9, 0xf1d13484), TOBN(0x089d9605, 0xcd298a74),
+     TOBN(0xb398c85a, 0x73c4346a), TOBN(0x50064076, 0xf37f13de),
+     TOBN(0xfe10d25a, 0xa6ebb83d), TOBN(0xc5e3edf8, 0xa834b30d),
+     TOBN(0x546b5d5c, 0x683e09ff), TOBN(0x02f96218, 0xc6dc44c6),
+     TOBN(0x64528c55, 0xc0edfc04), TOBN(0xb5a44a2c, 0xb0fc3058),
+     TOBN(0x9f09b116, 0xceeff21c), TOBN(0x077bcd67, 0x6b0fbbcd),
+     TOBN(0x29aaa4a8, 0x9ce76a94), TOBN(0x847cd081, 0xc0725c97),
+     TOBN(0x0c099e90, 0x97e16665), TOBN(0xe409ffc9, 0x8f7b1fc4),
+     TOBN(0xc0575b80, 0x690941ed), TOBN(0x8e25100a, 0x92c0ee9d),
+     TOBN(0x71662d27, 0x9b75837d), TOBN(0x6eeb9e97, 0xe56bb22b),
+     TOBN(0xf1d6333f, 0x85c6a60b), TOBN(0x982fee9d, 0x1d7ccfaa),
+     TOBN(0x1c5e28e7, 0xd4634535), TOBN(0xa76e1d27, 0x94fec469),
+     TOBN(0x1fe944d6, 0xafe377ec), TOBN(0xbd579a25, 0x2f68ae6b),
+     TOBN(0x10eabb93, 0xab6b515e), TOBN(0xa17b5f6c, 0x31b4e4b8),
+     TOBN(0x05e785fb, 0xaf72c239), TOBN(0x597e2016, 0x8af42e92),
+     TOBN(0x663f5a72, 0xb32ae6c9), TOBN(0x3040ff13, 0x45541cc6),
+     TOBN(0x6140081f, 0xdeca6b32), TOBN(0xcdaccaf7, 0xc735001b),
+     TOBN(0x62de5066, 0xdaef0e68), TOBN(0x056e9021, 0xd837df99),
+     TOBN(0xba399283, 0x16cd1be7), TOBN(0x2a486323, 0xcfacf7ad),
+     TOBN(0x00c15730, 0x277777ce), TOBN(0x5d2f200f, 0xd49a254c),
+     TOBN(0xf38a1f3b, 0xdb68078d), TOBN(0x595dea3f, 0x33604a36),
+     TOBN(0x14749d8c, 0x904b60b2), TOBN(0xe70c96d8, 0x246348ff),
+     TOBN(0x04340d52, 0x390e35da), TOBN(0xc098e3d3, 0x27a9947c),
+     TOBN(0xe6d78198, 0x9ecc7a3f), TOBN(0x2c39102e, 0x23aa6df6),
+     TOBN(0xb83fed0d, 0x300f3cb1), TOBN(0xc0b1e356, 0xdcfbe054),
+     TOBN(0x3da2224c, 0x20cf45a8), TOBN(0x5be55df7, 0x2f30deda),
+     TOBN(0x4d31c29d, 0x2faa9530), TOBN(0x1d5783ae, 0x49d42f79),
+     TOBN(0xe588c224, 0xf618b3f3), TOBN(0x7d8a6f90, 0xf8f5b65d),
+     TOBN(0xa802a3d2, 0x62d09174), TOBN(0x4f1a93d9, 0xbddd1cb7),
+     TOBN(0xe08e1d3c, 0x35a5c1dc), TOBN(0x856b2323, 0xf9d2958e),
+     TOBN(0xefd1e3ba, 0x96f00090), TOBN(0xd489943f, 0x3e0d25de),
+     TOBN(0x082c40ae, 0x30c8626f), TOBN(0xf6e5b5ef, 0xa4f428e0),
+     TOBN(0x660414a3, 0x38a7f623), TOBN(0xcd4e68de, 0x23eefed8),
+     TOBN(0x6dcadc62, 0xfc14e750), TOBN(0xcb78b3bc, 0xbeae89b6),
+     TOBN(0x445acc56, 0x1d5e580e), TOBN(0xbf6547ef, 0xc43abe19),
+     TOBN(0xd160a81b, 0xc922d50f), TOBN(0x3877c7f8, 0xf68eed4e),
+     TOBN(0x395745ea, 0xf8a9f64a), TOBN(0x9085b253, 0x603350f6),
+     TOBN(0x2a4c71f1, 0x8b1df366), TOBN(0x49b9e818, 0xabe332dc),
+     TOBN(0xb3e76e66, 0x528960b1), TOBN(0x445dc393, 0xd84aecb3),
+     TOBN(0x13618436, 0x1612ad64), TOBN(0x3ccbeccc, 0x8c831e37),
+     TOBN(0x0fb0bd41, 0x6121383c), TOBN(0x316164a3, 0x80d895a3),
+     TOBN(0xc3d34153, 0x233f2f1e), TOBN(0x2905906f, 0xe0d92225),
+     TOBN(0xe12d66e2, 0x95456622), TOBN(0x10469942, 0xff554b13),
+     TOBN(0xa894af86, 0xf7126c09), TOBN(0x448f3267, 0xf581d3f5),
+     TOBN(0xb5512926, 0xa2b5e758), TOBN(0x08f02988, 0x43fddd90),
+     TOBN(0x5f437035, 0x8ba319e6), TOBN(0xd254188e, 0x865b37e7),
+     TOBN(0x5b281b23, 0x8a5cb63a), TOBN(0xa15a2712, 0x6dd136c2),
+     TOBN(0x00fab229, 0x169beae4), TOBN(0x400d3f37, 0xde31b4a1),
+     TOBN(0x275877a4, 0xf8545cb0), TOBN(0xb396a513, 0x36df0277),
+     TOBN(0xf9896978, 0x838ced07), TOBN(0x86e68167, 0x715cea8d),
+     TOBN(0x0eb0f0de, 0x06a5a96d), TOBN(0x2c7a3672, 0x1fcf91ae),
+     TOBN(0x287bf614, 0x630eca3a), TOBN(0x65347473, 0xf60c9d2d),
+     TOBN(0xed15a229, 0x906efa7f), TOBN(0xe7be6381, 0xd549b5b3),
+     TOBN(0x23f32972, 0x2ce9141b), TOBN(0x9618d9a1, 0xfcf823f8),
+     TOBN(0x3d0ef0d3, 0xa3d89e15), TOBN(0x4d5a30c9, 0x0d07f5eb),
+     TOBN(0xc359e310, 0x73e4887a), TOBN(0x2f4c6b7e, 0xdbdec349),
+     TOBN(0xc5a1d3e9, 0xba142643), TOBN(0x8f4fd58e, 0x11c794b6),
+     TOBN(0xcad091d1, 0x1810c63d), TOBN(0x5b616239, 0xf0bfa76c),
+     TOBN(0xe3433562, 0xa838792a), TOBN(0x4aead02b, 0x54148e98),
+     TOBN(0x809f2baf, 0xdb66f216), TOBN(0x09cc90ff, 0xeabfe5da),
+     TOBN(0x69eb235a, 0x63e8edad), TOBN(0x64f7acb5, 0xa7f95997),
+     TOBN(0xe999ea18, 0xfae20f25), TOBN(0xcd7ff208, 0x3c4966b3),
+     TOBN(0x595e0cc0, 0x345c8929), TOBN(0xfe43c73c, 0xde5e2498),
+     TOBN(0x0cdefc98, 0x503f216d), TOBN(0x8e4e170d, 0xf98826fb),
+     TOBN(0x1492247d, 0xb6c79b1c), TOBN(0xf8e24b38, 0xef0532aa),
+     TOBN(0x9f349d51, 0x044bc458), TOBN(0x2ef04ead, 0x1002d315),
+     TOBN(0xaf322f23, 0xda60d581), TOBN(0x07deaa88, 0x0681173f),
+     TOBN(0x86b97444, 0xa78feca0), TOBN(0x64d336ea, 0xc633a54d),
+     TOBN(0x10dd4b1f, 0x2a426cbf), TOBN(0x08d97c15, 0x7af59869),
+     TOBN(0xb8cc814b, 0x2d7fe97e), TOBN(0x7eacd2e1, 0x3bfb60fe),
+     TOBN(0x967dafb7, 0xb790881c), TOBN(0x2002b8e4, 0x3663e76c),
+     TOBN(0x3bd28ede, 0xf8e82490), TOBN(0x44dd2e81, 0x4bb2a47a),
+     TOBN(0xde750dfe, 0xdbc3f2f8), TOBN(0xd9b6e912, 0x6e2eec70),
+     TOBN(0xe8400e2f, 0x1e4c4d2f), TOBN(0xd3325697, 0x23217be2),
+     TOBN(0x030b7e39, 0xd4231a1d), TOBN(0x1f72e8b1, 0x613d17d8),
+     TOBN(0xcd423512, 0x01857d37), TOBN(0x9ecd682c, 0x0b4b7926),
+     TOBN(0xfe4ac1c3, 0x8ec44636), TOBN(0x4a030cbf, 0x9aacc091),
+     TOBN(0x12bb252e, 0x0b133f54), TOBN(0xbf90ea5d, 0xf970d266),
+     TOBN(0xe00d25f7, 0xf5484410), TOBN(0xb4984eeb, 0x2a922894),
+     TOBN(0x498102fd, 0x8e1e09ce), TOBN(0x8f8c9fcb, 0xe1d731bf),
+     TOBN(0xdb897669, 0x0b4983b7), TOBN(0x7a7767f9, 0x7b2468f5),
+     TOBN(0x1a2f9fe8, 0x72f4d5f4), TOBN(0x10e95aa9, 0xa6169daa),
+     TOBN(0x9487e50f, 0x520166e9), TOBN(0x6f6b115b, 0xc4ee6a95),
+     TOBN(0xaf29926f, 0xcf7560f8), TOBN(0x20a32458, 0x1f989e46),
+     TOBN(0x165a2232, 0xd3bd2473), TOBN(0x93d841ff, 0xe9fecdf8),
+     TOBN(0x71d63fa7, 0xbf9978c0), TOBN(0x381bcf34, 0xe7de184b),
+     TOBN(0x317c8e40, 0x347dfaef), TOBN(0x795b0f7d, 0x64464bf3),
+     TOBN(0x15dc99d6, 0x1364ec20), TOBN(0xc07fce28, 0x91600d3f),
+     TOBN(0x9825338b, 0xc8bebbda), TOBN(0x5e5e89f6, 0xa8547c03),
+     TOBN(0x3c50032f, 0x1a040b84), TOBN(0xcea7544f, 0x2b3a533d),
+     TOBN(0xea26d87d, 0x43247e19), TOBN(0x7e753390, 0xfba8368e),
+     TOBN(0xb35e75cb, 0x3c7bcfc6), TOBN(0xf78cb5ce, 0x7e44aab3),
+     TOBN(0x4a3534e9, 0xa98d7104), TOBN(0x2b83ea6c, 0x6f5852ea),
+     TOBN(0x11337fff, 0x68dced7c), TOBN(0xcca0f2c6, 0xd1a2a294),
+     TOBN(0xb547c662, 0x426bf202), TOBN(0xec50423e, 0x66194a34),
+     TOBN(0x11d34865, 0x78161e84), TOBN(0x83508c06, 0x64f04dec),
+     TOBN(0xd1c72976, 0xf7732345), TOBN(0xd624bacd, 0x18e77e0a),
+     TOBN(0x71344b75, 0xba79bdd9), TOBN(0xe4bfe085, 0x8d6c1474),
+     TOBN(0x505e8fd9, 0xcc5eb43a), TOBN(0x612ab1d0, 0xdaaf0621),
+     TOBN(0xde170783, 0xe6672368), TOBN(0xfee7df44, 0x83788673),
+     TOBN(0x364d6885, 0xd119271d), TOBN(0xdd70bae8, 0xe1b0cea2),
+     TOBN(0xb4b873ad, 0x5832adba), TOBN(0xad3ecc18, 0x8c683749),
+     TOBN(0x963d8793, 0x4d217a2e), TOBN(0x099e8c56, 0x1fa4702d),
+     TOBN(0x6d91bc47, 0xe6431f1b), TOBN(0x3fd21287, 0xa5f61399),
+     TOBN(0x2fc90bae, 0x682fa08b), TOBN(0x51699c85, 0xc1ca371c),
+     TOBN(0x16f29d74, 0x831c428f), TOBN(0x0ecefb66, 0x9fa2b504),
+     TOBN(0xd04ac53f, 0xa75c5a91), TOBN(0xcbe62421, 0x3bf0524b),
+     TOBN(0x91dcb3ce, 0xb8792826), TOBN(0x28a6bf88, 0x7885092a),
+     TOBN(0x24798e59, 0x64c1e218), TOBN(0x18e848dc, 0x3fec97dc),
+     TOBN(0x935e0f50, 0x9da457b7), TOBN(0x46b67ab7, 0xb8f497a6),
+     TOBN(0x15a38140, 0x7651e4ff), TOBN(0x6ba6c617, 0x4890cd7f),
+     TOBN(0xa527b8d2, 0x5fe253ca), TOBN(0x945277b8, 0xff3d603b),
+     TOBN(0x10796155, 0x75392f01), TOBN(0xcac8f713, 0x2bd9619d),
+     TOBN(0x71a87eca, 0xdebb8e28), TOBN(0xe8e6179e, 0x52ab1792),
+     TOBN(0x4ce3998b, 0xe33705e7), TOBN(0xf9a0661a, 0x48ba56e4),
+     TOBN(0x47f06b30, 0xd9e4e184), TOBN(0xda465f75, 0xf9f8f6df),
+     TOBN(0xb05acbbe, 0xc0ad3e20), TOBN(0xec8776a4, 0x92bc2c13),
+     TOBN(0xbb3971b7, 0x240a908b), TOBN(0x80a14367, 0xbbd0cecc),
+     TOBN(0x40911e50, 0x086949bc), TOBN(0x39b3ab69, 0x4064a19d),
+     TOBN(0x538c6d96, 0x6b07eaa7), TOBN(0x38c05b47, 0xd3723bde),
+     TOBN(0x1e669308, 0x080d2a64), TOBN(0x6b44dbe5, 0x2a77601f),
+     TOBN(0x35579681, 0xe7c6ce9a), TOBN(0xd2950b0e, 0xa16afa75),
+     TOBN(0xd228a3ba, 0xeaf7fafc), TOBN(0x9324e71d, 0xee878f00),
+     TOBN(0xa853bfc1, 0xe413c1ce), TOBN(0xfe916368, 0xdcf17d1c),
+     TOBN(0x8611383a, 0x2546154b), TOBN(0xdbdf225d, 0xe715b375),
+     TOBN(0x874d70a6, 0x8dbb0651), TOBN(0x84e58895, 0x9ed56391),
+     TOBN(0xca83d8ad, 0x3776503c), TOBN(0x2cf38b4e, 0x46e82d65),
+     TOBN(0x65af46e6, 0xadf3a8d1), TOBN(0x4f09a4ab, 0x1d31056d),
+     TOBN(0xdba27b42, 0xcacc81d5), TOBN(0xb6caa0ca, 0x5d6e1bdd),
+     TOBN(0x1086e441, 0xf7198b26), TOBN(0x15dfe6cb, 0xac572f9b),
+     TOBN(0xd9444337, 0xd2051dd5), TOBN(0x6c34b236, 0x834cd72d),
+     TOBN(0x84783216, 0x58df3f28), TOBN(0x59b8808e, 0x2e921372),
+     TOBN(0x3b268249, 0x55835302), TOBN(0x3299cbe0, 0x9f4863f1),
+     TOBN(0x616e3cdd, 0x4c4e213a), TOBN(0xa3c84868, 0x8c824317),
+     TOBN(0x884be61c, 0x460ed764), TOBN(0x388df47b, 0xb6041177),
+     TOBN(0x27089763, 0x60b29b0b), TOBN(0xd66d7d53, 0xe502ba08),
+     TOBN(0xadec85ca, 0x5acbfaf4), TOBN(0xfbacf9b7, 0x470c9519),
+     TOBN(0x5d18b7f6, 0xdbcda5b2), TOBN(0x7615c036, 0x0f228ed5),
+     TOBN(0xdfcd8273, 0xd6000825), TOBN(0xdacfcf11, 0x9d440eb3),
+     TOBN(0xa8257834, 0x7738fa46), TOBN(0x7db548af, 0x76281df3),
+     TOBN(0x71dd19f6, 0x3e0b052c), TOBN(0x811feef2, 0xd876613f),
+     TOBN(0x7536e854, 0xf9c3155c), TOBN(0x3e594973, 0x4c8c1220),
+     TOBN(0xf8c5c72d, 0x069b4228), TOBN(0xc077d394, 0x1f2f6b02),
+     TOBN(0x0032dfb9, 0x76393a52), TOBN(0x5e52c880, 0x706c3572),
+     TOBN(0x4a9d6e9d, 0xe003750f), TOBN(0x3d54814d, 0x6147cee7),
+     TOBN(0x09ed7f77, 0x23b655fa), TOBN(0x14fff651, 0xf1988361),
+     TOBN(0x742f3abd, 0xfb263d48), TOBN(0xedb557dc, 0x53699a0c),
+     TOBN(0xc692a474, 0x7ecd0f61), TOBN(0xdc64f583, 0x058f0d17),
+     TOBN(0x68a9ce75, 0x3227d3ed), TOBN(0xfd0b0320, 0x4601d083),
+     TOBN(0x7167b330, 0x9c2cee38), TOBN(0xef658993, 0x710e350d),
+     TOBN(0x75a83be1, 0x16910648), TOBN(0x5b32e77d, 0x2e7d446c),
+     TOBN(0x8e0534e5, 0xa86ba2de), TOBN(0xc8a92eac, 0xb692aeee),
+     TOBN(0x3cf686eb, 0xf663150f), TOBN(0x840eaade, 0x01962baf),
+     TOBN(0x3e06154f, 0xa264d877), TOBN(0xbbd04137, 0x24630300),
+     TOBN(0x0b0151bd, 0x58631468), TOBN(0x570ef82c, 0x9f99bbe5),
+     TOBN(0x03565f47, 0xb30f7b96), TOBN(0x000628e0, 0x98c04b24),
+     TOBN(0xd34a90ae, 0xd6ccdb2b), TOBN(0x1a584858, 0xa99a761c),
+     TOBN(0xa640ddca, 0x65e29f1b), TOBN(0xffb672f9, 0x728d3208),
+     TOBN(0x550f6392, 0x5433abd8), TOBN(0x4f35e116, 0x13ff0107),
+     TOBN(0xbb2b0fab, 0xe731a37b), TOBN(0x1e8a5a08, 0xc83d6e74),
+     TOBN(0xf617e177, 0xc6565e23), TOBN(0x8e370e5a, 0x76da0795),
+     TOBN(0xa5631e02, 0x03936a55), TOBN(0xe576bee9, 0xd41293ad),
+     TOBN(0xfcfd9bc7, 0x5381bc98), TOBN(0x8a42ddfd, 0x000a98ab),
+     TOBN(0xd6091ca6, 0xb49463c4), TOBN(0xf37f6b9f, 0x9754ce07),
+     TOBN(0xe1543897, 0xfa399fda), TOBN(0x7b029ead, 0x8810063c),
+     TOBN(0xa98a46bd, 0xec5a5b52), TOBN(0xdd162811, 0xd50cc504),
+     TOBN(0x4d725c1d, 0x67a95e56), TOBN(0xc36d6e8b, 0x8e17af44),
+     TOBN(0x38ffb699, 0x313454c1), TOBN(0x22c3da8c, 0x991e4eaa),
+     TOBN(0xfa36ee15, 0x0bb72dc0), TOBN(0x356bbf74, 0x4fd01d32),
+     TOBN(0x9ff71a30, 0x3c7939a3), TOBN(0xa0ad2fb5, 0x691786e9),
+     TOBN(0x7d7f4770, 0x283c34c1), TOBN(0x0148a4f0, 0x2454a31c),
+     TOBN(0xdcbb138a, 0xeab3b646), TOBN(0x7834bdb9, 0xf101223e),
+     TOBN(0x49de6cc3, 0x965baa81), TOBN(0x5462f15e, 0x15471215),
+     TOBN(0xd77e7a56, 0x81d17760), TOBN(0xa08c5ad9, 0x53f00de3),
+     TOBN(0x2e6e6686, 0x397ed010), TOBN(0xe444a5a9, 0x2bef28cb),
+     TOBN(0x1ab9d616, 0x4073cbe4), TOBN(0x24c6b9e0, 0x18f0b7dd),
+     TOBN(0x456482b6, 0xc2a93055), TOBN(0x0f89129f, 0xefbe8715),
+     TOBN(0xb50818c3, 0x62e5f6f2), TOBN(0x1d74a1ca, 0x3d63c663),
+     TOBN(0x9a9124ee, 0xd84bfa55), TOBN(0x6cf81f41, 0x254b3f04),
+     TOBN(0x7c9b7c3e, 0xa1051109), TOBN(0x71c3d6d6, 0x640e8df2),
+     TOBN(0x56571157, 0x62f6af2f), TOBN(0x2ec61a3f, 0xe1bc9ae8),
+     TOBN(0x20caa2ff, 0x2fcc848b), TOBN(0x71e30dac, 0xdc5c297e),
+     TOBN(0x11901efc, 0xfbc0740a), TOBN(0x4994fc5f, 0xb6e35fca),
+     TOBN(0x4dc09eba, 0x177de7dd), TOBN(0xedfdd25c, 0x0494bebf),
+     TOBN(0xc4821ed9, 0x0cbaeb8b), TOBN(0xa9ef7a48, 0x66788fbd),
+     TOBN(0x5b7a7ca5, 0xd65efbc2), TOBN(0xe18feb42, 0xa9cb1fc6),
+     TOBN(0x2cc74b9c, 0x56b00ab5), TOBN(0xf559a140, 0xdb4bf3f4),
+     TOBN(0x283136d4, 0xb8a4b54e), TOBN(0xe969e4f8, 0x37032aa2),
+     TOBN(0x5635fb66, 0xd85beed3), TOBN(0x32bc4fdd, 0xa72a54bb),
+     TOBN(0xc1e5ee2b, 0x4c386a49), TOBN(0x979fd877, 0x795a0b08),
+     TOBN(0x5acef24d, 0x431f0b8e), TOBN(0x9f1c4a80, 0xd13cafef),
+     TOBN(0xf19ac70b, 0x4659f447), TOBN(0x82bab6b6, 0x10f561ae),
+     TOBN(0x1268e7f3, 0xbbc879a7), TOBN(0x7e7d7141, 0x79c37165),
+     TOBN(0x491f049d, 0x597e313f), TOBN(0x6ca7e73e, 0xecc98736),
+     TOBN(0xd7712aa4, 0x80a31eb9), TOBN(0xbf7376ca, 0x2d8b99d7),
+     TOBN(0xc1166cdc, 0x2b8e5f7b), TOBN(0x562bf290, 0xf1a48c9b),
+     TOBN(0xa6e72238, 0x31c38c75), TOBN(0x51a9a100, 0xb5f42def),
+     TOBN(0xa0931d81, 0xa100b75f), TOBN(0x7022479d, 0x967830be),
+     TOBN(0x53eaaa1f, 0xc192bc29), TOBN(0x09504e7a, 0x4123a9f2),
+     TOBN(0xe897397f, 0x90671997), TOBN(0xc56185d2, 0x4294fda2),
+     TOBN(0xb531f278, 0x9819b185), TOBN(0x390155ff, 0xe9dda4cc),
+     TOBN(0x1258a5d9, 0x14d26bf9), TOBN(0x47d8f5ae, 0x7e5f13a1),
+     TOBN(0xef9e05e3, 0xe9591945), TOBN(0x92d20e07, 0x846441be),
+     TOBN(0x28cc70ef, 0x1d897ad1), TOBN(0xee962e74, 0x0bac861f),
+     TOBN(0x9b7a4236, 0xbed368e4), TOBN(0xe65ac22a, 0xe49b9720),
+     TOBN(0x851f0032, 0x22c1bd82), TOBN(0x771573ec, 0x1e75ab15),
+     TOBN(0x2e0a4635, 0x702eb71a), TOBN(0x65167c74, 0xee924cd9),
+     TOBN(0xe16b3515, 0x10ccabb5), TOBN(0x63cf15c4, 0x10ea5907),
+     TOBN(0x59dacdc6, 0x616f5290), TOBN(0x19eb409b, 0x8e372a43),
+     TOBN(0x5c879337, 0xe3c36beb), TOBN(0x5841e7e2, 0x0555fa1e),
+     TOBN(0xce197347, 0xf346ec2d), TOBN(0xe14818a8, 0x221db43d),
+     TOBN(0x1bf37115, 0xc935c025), TOBN(0xb22bdb03, 0xfee14ce0),
+     TOBN(0x893c5efa, 0xf0e3dfd6), TOBN(0x8fe9d56c, 0xb1f95e1e),
+     TOBN(0x6ee580e5, 0x407e4db0), TOBN(0x0292bfc4, 0x9fb33911),
+     TOBN(0x598ce787, 0xb2869cac), TOBN(0xd2f77720, 0x4798690a),
+     TOBN(0x2689e0f3, 0x9cb6015a), TOBN(0x8831ddeb, 0x7127b0e8),
+     TOBN(0x44db087b, 0x5c4fd58c), TOBN(0x04a0c68e, 0xcda33285),
+     TOBN(0xe55f00d7, 0xe1a4c364), TOBN(0xb3a2ea9a, 0xb6393b21),
+     TOBN(0x99ef4da3, 0x5e9d8db9), TOBN(0xa01f11d9, 0x17b484bc),
+     TOBN(0xc2283fbf, 0x1767f6ca), TOBN(0xbb524479, 0x9e77f389),
+     TOBN(0xc4ea3c66, 0x10149726), TOBN(0x4b71d644, 0x82ec5f64),
+     TOBN(0x0fe49d52, 0x642944c7), TOBN(0x69fef689, 0x5a17a7bd),
+     TOBN(0x2f3588fc, 0x8c3dce23), TOBN(0x9d429231, 0x68e0c237),
+     TOBN(0x63756076, 0x86fa61d2), TOBN(0x1d89c6b8, 0x729bc192),
+     TOBN(0x85e098d2, 0x00d3ffd1), TOBN(0x5bf292c2, 0xde6f9109),
+     TOBN(0xb20dc994, 0x3e7b8f23), TOBN(0xcbe51bad, 0x87c6eb54),
+     TOBN(0x263fd862, 0x0517b914), TOBN(0x447624ad, 0x225499a7),
+     TOBN(0xfbb831bb, 0x71f807d9), TOBN(0x9514fe38, 0x2fe2e021),
+     TOBN(0x881e8763, 0x52418e9a), TOBN(0x268e4655, 0xf1d9b43b),
+     TOBN(0xf917044a, 0x1f780af9), TOBN(0x3727b2d9, 0x3d758ba5),
+     TOBN(0x8487eb90, 0x68755cf3), TOBN(0x1887394e, 0x7fe12541),
+     TOBN(0x2e4c65d4, 0x46af8ca8), TOBN(0x72aae645, 0xb9e119dc),
+     TOBN(0x958e0094, 0x1ec6ad73), TOBN(0x84a7eec4, 0x8ce4573e),
+     TOBN(0x3d6d00d4, 0xf9254b96), TOBN(0x4ef44f58, 0x8e421732)},
+    {TOBN(0xf59de0f8, 0x7d3ad2ac), TOBN(0xd2670cb1, 0xc0f92c5c),
+     TOBN(0x8f05944a, 0xc900b6a5), TOBN(0x11aeed23, 0x8d9668eb),
+     TOBN(0x21b038e4, 0x7c488ea6), TOBN(0x406ea3f7, 0x78083d75),
+     TOBN(0xd22197b4, 0x3bd31fe2), TOBN(0xdc8f8ccb, 0x28a6ef9a),
+     TOBN(0x679a6483, 0x02887281), TOBN(0x13f3d39b, 0x7f9de66f),
+     TOBN(0x289c3c50, 0xf1a7dee2), TOBN(0xa510a53c, 0x40b698b8),
+     TOBN(0xc566c3fb, 0x06f799ad), TOBN(0xcc95a879, 0xb5374650),
+     TOBN(0xbd7343c0, 0x61c947b2), TOBN(0xbbbff69d, 0x9543e51b),
+     TOBN(0xb80d38dc, 0xba75aba9), TOBN(0xe9b61ac6, 0xd150f881),
+     TOBN(0x9f56af52, 0xca7b47c5), TOBN(0x040300d9, 0x77fb3128),
+     TOBN(0x36877184, 0xc01fd0c1), TOBN(0x40112a04, 0x8b6e134b),
+     TOBN(0x56daed90, 0xccd71653), TOBN(0xec553aa6, 0xb74bd62e),
+     TOBN(0x0398381d, 0x11476dde), TOBN(0x4959204d, 0x1ea0923f),
+     TOBN(0xd67427ad, 0x017745bd), TOBN(0xef022a74, 0x6935e467),
+     TOBN(0x57e799f5, 0x24e0380a), TOBN(0x6ee2b64f, 0xb5f1a730),
+     TOBN(0x9aeaac48, 0x521771d8), TOBN(0x02c8521c, 0x0992a13c),
+     TOBN(0x25dd9f41, 0x48f6934a), TOBN(0x8d191988, 0x3e38e31f),
+     TOBN(0x35548844, 0x32899837), TOBN(0xf87c696b, 0xf56b07d6),
+     TOBN(0xbc66e7d7, 0x73e927b9), TOBN(0x04cdac77, 0xbb0bedc5),
+     TOBN(0x1e6f2903, 0x0bcd022a), TOBN(0xafa637be, 0x22c574b5),
+     TOBN(0xcdca4b1e, 0x55c1759b), TOBN(0x3d46ee3b, 0xa6819d39),
+     TOBN(0xf7497ade, 0xb4b0fce9), TOBN(0x54aef506, 0xdcb613c3),
+     TOBN(0xbc11d721, 0x522ff464), TOBN(0xf53f16f2, 0x37bd3c51),
+     TOBN(0x88f29955, 0x485695b9), TOBN(0x428ce742, 0xdac00fe3),
+     TOBN(0xd971fbd2, 0xa3520c27), TOBN(0x2204fe54, 0xe05e1b9d),
+     TOBN(0xb08be507, 0xf0c15c89), TOBN(0xfeeda919, 0x901a15c3),
+     TOBN(0x6576ad3b, 0x84b60eb5), TOBN(0x40d4b9a1, 0x59e951da),
+     TOBN(0xbe96e1b8, 0x76244608), TOBN(0x3af35ec9, 0x58ef9f37),
+     TOBN(0xbfe5c43b, 0x153adbf7), TOBN(0x07a66edf, 0x80351fec),
+     TOBN(0x3d804235, 0x3b109e60), TOBN(0x4dc97176, 0xa832c162),
+     TOBN(0x03fec75f, 0xb1db1e5c), TOBN(0x6aa02da6, 0xa15b9900),
+     TOBN(0x5f9e808f, 0x4faa1cff), TOBN(0x90aa28bd, 0xa6412a26),
+     TOBN(0x2fb2c15b, 0xe041d453), TOBN(0x2b847efa, 0x86c18ef0),
+     TOBN(0x84f5ee9d, 0x115b7318), TOBN(0xd568b080, 0x71699936),
+     TOBN(0x34658ae7, 0x6ea5c852), TOBN(0x99f918b3, 0x126d10ce),
+     TOBN(0x75e3d9cc, 0x09b9407f), TOBN(0x11c6a0bb, 0x7883f978),
+     TOBN(0x522a6925, 0x876db0fd), TOBN(0xc5401ca1, 0x7a9a4211),
+     TOBN(0x89163b57, 0x6789e755), TOBN(0xd2b2c99a, 0x0fd6f1b8),
+     TOBN(0x427eea22, 0xa7b452dc), TOBN(0xce8e6682, 0xef9db65c),
+     TOBN(0xfd835810, 0xda9c80f7), TOBN(0xdb91bfbb, 0xea916411),
+     TOBN(0x7a5aefad, 0x798b5051), TOBN(0xbd7ebc88, 0x42a0d4cd),
+     TOBN(0x958e327a, 0xbac28520), TOBN(0xfa8bf6d4, 0x7d010c77),
+     TOBN(0x8a7040aa, 0x579752f4), TOBN(0x47974d84, 0xe573d895),
+     TOBN(0xfd2a0cdc, 0xfe16f77b), TOBN(0x0f08f86a, 0xdbf71fdc),
+     TOBN(0xb19de6f1, 0x2983bd4d), TOBN(0xb990931e, 0x1e3a28b3),
+     TOBN(0x43b71b8b, 0x00cbc4f9), TOBN(0x35d1ddd0, 0xf4d75a0e),
+     TOBN(0xc211951d, 0xc653f111), TOBN(0xbbc46824, 0x88750928),
+     TOBN(0x0cf6e752, 0x174803e3), TOBN(0x81f5e0ac, 0x8960d80c),
+     TOBN(0xe03ca085, 0x0c52fcf9), TOBN(0xa795382e, 0x0865ced4),
+     TOBN(0x03bd561c, 0xe7117376), TOBN(0x8608dde1, 0x3fd7184a),
+     TOBN(0xfd48fd50, 0xa2a98acc), TOBN(0x902fa587, 0x11df74b0),
+     TOBN(0x683f101d, 0xfa73b8f1), TOBN(0xc805d31b, 0xe7c0efa6),
+     TOBN(0xe5effb4e, 0x5b11d6c0), TOBN(0xba30f747, 0x01c8374c),
+     TOBN(0x8733511b, 0x0c275aec), TOBN(0xf140b740, 0x97354e36),
+     TOBN(0xb01ded69, 0x0341268e), TOBN(0x17bc3176, 0x27eac17b),
+     TOBN(0x88097703, 0x8984992c), TOBN(0x37bfafab, 0x3e05061c),
+     TOBN(0x7eca9f09, 0x111d0eb8), TOBN(0xda7eb023, 0x8f243481),
+     TOBN(0xac3cb2d6, 0x59b5e491), TOBN(0x56e725b1, 0x4f794842),
+     TOBN(0x43245254, 0x45b2dff6), TOBN(0xeafe73b9, 0xef10ec78),
+     TOBN(0x0d3cb2bc, 0x78819dbf), TOBN(0xff1cd617, 0xe784eb22),
+     TOBN(0x0dbaf1c9, 0x9ce0fcd6), TOBN(0x732ea65e, 0x3232a847),
+     TOBN(0xdb2ce218, 0x6a75d822), TOBN(0x88ffd479, 0x3d2273ca),
+     TOBN(0x89092ad2, 0xf2f26b61), TOBN(0xfb7041bd, 0x686706ab),
+     TOBN(0xe3d5fa75, 0x5e23597c), TOBN(0xa2035bf8, 0x5995fc84),
+     TOBN(0x1feecd2c, 0x4514b8bd), TOBN(0x57cb78b4, 0x434b9233),
+     TOBN(0x59bd2ad7, 0x24215322), TOBN(0x41437de2, 0x1ce8daa0),
+     TOBN(0x401bbece, 0x7147ce80), TOBN(0x5e462137, 0x5abb61e8),
+     TOBN(0xbbf21033, 0x5a3790eb), TOBN(0x9a791c09, 0x5134dee3),
+     TOBN(0xc8ded766, 0xcedd2cc1), TOBN(0xa3e48e9d, 0x6447b925),
+     TOBN(0xc73282a3, 0x69efa728), TOBN(0x8cb72c30, 0x8d408bec),
+     TOBN(0xfb4f2797, 0x41cf92eb), TOBN(0xef3f42a0, 0x26f2412e),
+     TOBN(0xdbc0f972, 0xa941ab5a), TOBN(0xc7bd62dd, 0x98337613),
+     TOBN(0x31892744, 0x4e45dcbd), TOBN(0x3b2979cb, 0xb51b7f91),
+     TOBN(0x41e002f5, 0x29b27fec), TOBN(0x9007ee68, 0x4dd51b0f),
+     TOBN(0x82f417a3, 0x6e23d565), TOBN(0x3321f343, 0x77127820),
+     TOBN(0x8d09d965, 0x199b32be), TOBN(0x948429eb, 0x5bc2017b),
+     TOBN(0x22b639f9, 0x124eb248), TOBN(0xed097f74, 0x125f8c22),
+     TOBN(0xdbc02517, 0x5f8bed34), TOBN(0xb93f5b42, 0x51aa29c3),
+     TOBN(0x6fedd599, 0xc7368c44), TOBN(0x99a5a795, 0x2c772a9a),
+     TOBN(0x30b35ba7, 0x7a5f156e), TOBN(0x9dc50978, 0x191c45af),
+     TOBN(0xe8d241f5, 0xb5b4c4fe), TOBN(0xda89eac1, 0xb75f54f8),
+     TOBN(0xb399dba0, 0x9ef86ae5), TOBN(0x2337bb46, 0x51c1b8c6),
+     TOBN(0xfe60b0c5, 0x4d02f348), TOBN(0x709f1235, 0x0afc6cd0),
+     TOBN(0x8a0b458b, 0xb40fce18), TOBN(0xefe143aa, 0xe3929cfa),
+     TOBN(0xab3a4b0d, 0x0ca6cec0), TOBN(0xcb235374, 0x67246ec3),
+     TOBN(0xdf9b0e89, 0x1ec2538f), TOBN(0x3ec2ea13, 0x80c7b53d),
+     TOBN(0x920c55f2, 0xd0ae3146), TOBN(0xd3ac4e1e, 0x43946090),
+     TOBN(0xeba72583, 0x97ebe7a4), TOBN(0x5031644a, 0x393d401f),
+     TOBN(0x802c3409, 0x9714de1a), TOBN(0xc62d66d0, 0xde5bacba),
+     TOBN(0xb6c2abeb, 0x903b8148), TOBN(0x203531ef, 0x5bffe1c4),
+     TOBN(0x186266de, 0xe862ead7), TOBN(0x21e643d5, 0x1a23bebb),
+     TOBN(0x15c13d11, 0x6edda603), TOBN(0x39b4a3a3, 0xb1bebc77),
+     TOBN(0xdb456c1a, 0xb9ac4754), TOBN(0xf497e6e9, 0x4d3f305a),
+     TOBN(0x84d27e3a, 0x3fa62dc0), TOBN(0xc18c3569, 0x2524b94f),
+     TOBN(0x92198954, 0xe380f5cb), TOBN(0x81d8221c, 0x272ea458),
+     TOBN(0x6fa082f6, 0x5f328491), TOBN(0x810ca5af, 0x8e304ccf),
+     TOBN(0xda9f1c15, 0x0d76e6d5), TOBN(0x4bd38afc, 0xb7abad72),
+     TOBN(0x14b5cc26, 0x08aa20f5), TOBN(0x010a1af8, 0x81061318),
+     TOBN(0xaf9d7a73, 0x03c287c0), TOBN(0x9ba5105a, 0xbc4d40ab),
+     TOBN(0x99e4b824, 0xb07937a6), TOBN(0x026d294c, 0xc869f63c),
+     TOBN(0xaaebde75, 0xc910b521), TOBN(0xc803ded4, 0xa7d5dd9c),
+     TOBN(0xc8b713b0, 0x62764be2), TOBN(0x5ea9ea2b, 0x92540cf3),
+     TOBN(0xbaa999c6, 0x6930bd0e), TOBN(0x57052e53, 0x1f4b254c),
+     TOBN(0xfb9fd699, 0x2b0b27ee), TOBN(0x86b70932, 0x4cc83793),
+     TOBN(0x09ab4dd7, 0xfba59bbe), TOBN(0x83204fee, 0x04f4609e),
+     TOBN(0x251cb390, 0x93934977), TOBN(0x8add9e8b, 0x647c13e8),
+     TOBN(0x444815d3, 0xe7ea7006), TOBN(0x22333c0a, 0xbd032c32),
+     TOBN(0xe7728dc8, 0x4058b7cb), TOBN(0xde8eb503, 0xd1bc061f),
+     TOBN(0x5d3ece2e, 0x493d76c2), TOBN(0xa425f3ae, 0xd804954a),
+     TOBN(0x49100271, 0xeac95eb8), TOBN(0x94e4dfa0, 0x38b4be56),
+     TOBN(0xa855893f, 0x650f9930), TOBN(0x1fa0a07d, 0x50264765),
+     TOBN(0x37a3c169, 0x0d1d40be), TOBN(0xfedb51e4, 0x2eed2a0d),
+     TOBN(0xa6e0c2b2, 0x1b3348b4), TOBN(0x9e361f42, 0xc414464e),
+     TOBN(0x3e14e2ee, 0x176e109a), TOBN(0x5f1a6bbe, 0xf4af92fd),
+     TOBN(0xf15d4647, 0x84beb8e5), TOBN(0xac3f01c1, 0x97d36132),
+     TOBN(0x36e669bf, 0x84ca42ae), TOBN(0xf789bdbd, 0xd9433ca1),
+     TOBN(0x384f37f4, 0xf71e84d4), TOBN(0x57de9473, 0x59d6481a),
+     TOBN(0xa9a81f99, 0xf5e6fa70), TOBN(0x26f0a64f, 0x6cb57bf3),
+     TOBN(0xc07e1c13, 0x061d38fe), TOBN(0x6fae70e9, 0x4a475732),
+     TOBN(0x6cfb6b1d, 0x840e595c), TOBN(0xb23cf1f2, 0x62848351),
+     TOBN(0xef6094c7, 0x4fcf8743), TOBN(0x7dc42218, 0x05fab119),
+     TOBN(0x3207463f, 0x5c220d15), TOBN(0xdf51b3f0, 0x22c4bfb2),
+     TOBN(0x13db445b, 0x1572735b), TOBN(0xd7662537, 0x2f6db574),
+     TOBN(0x692f1e05, 0x7796f888), TOBN(0x9f3d7a5b, 0x33f45593),
+     TOBN(0xb5deb892, 0x313de667), TOBN(0x75c872d7, 0x66a478a8),
+     TOBN(0xb67b5513, 0xc4992428), TOBN(0xf97e010e, 0xf70fde09),
+     TOBN(0x49b0f053, 0x60ee268c), TOBN(0x981b5141, 0xf67cd321),
+     TOBN(0xb5a1ac8d, 0x4fbc187c), TOBN(0x162417e2, 0xc12e6da8),
+     TOBN(0x07bb6fff, 0x62914938), TOBN(0xd385285b, 0x19f44438),
+     TOBN(0x05a610a1, 0xa28904dc), TOBN(0xd80a7099, 0x5a29b9f8),
+     TOBN(0x72ccb553, 0xc177af4a), TOBN(0xac0bd91b, 0x5e3752f4),
+     TOBN(0x8e8ae668, 0x7ae838a0), TOBN(0xcaa5a46c, 0x1fdfe7c3),
+     TOBN(0x2cc2c1a5, 0x93d34156), TOBN(0x22beffb1, 0x61fe4572),
+     TOBN(0x66f9f3ce, 0xfcdc7418), TOBN(0xbaccda41, 0x6af66892),
+     TOBN(0x775c783d, 0x1af43f56), TOBN(0x1b23b187, 0x0ae04034),
+     TOBN(0x5a9325f4, 0xe99b486b), TOBN(0x36d5bfe9, 0x8367ab05),
+     TOBN(0x17d8d2fb, 0xa519d028), TOBN(0x27b6beb2, 0xbe00e7e0),
+     TOBN(0x8d51c36c, 0x15a3f03a), TOBN(0xbf90e78b, 0x5faac8dd),
+     TOBN(0x4e8c28e7, 0xb27ab69f), TOBN(0x37ecf0c7, 0x4a553da4),
+     TOBN(0x3a39682f, 0x210fe720), TOBN(0x60c62e80, 0x0b0cdd0c),
+     TOBN(0x893aa225, 0xa16647cd), TOBN(0xcffb728e, 0x64ce0455),
+     TOBN(0x81891d39, 0xc4f0fe79), TOBN(0x1abe3073, 0xf9c39f00),
+     TOBN(0x88336c27, 0xf961d05c), TOBN(0xc9033a88, 0xa5fc96df),
+     TOBN(0x0d084405, 0x864b39f8), TOBN(0x866aa904, 0x851e95c9),
+     TOBN(0x0c36da08, 0x98bae4a8), TOBN(0x9f88d799, 0xb5feb202),
+     TOBN(0xcd9aeb4a, 0x8054e4da), TOBN(0x005206bf, 0x1e9134cb),
+     TOBN(0xd5f32bf8, 0x17ee6649), TOBN(0x9431dcd8, 0x60847ad2),
+     TOBN(0xbe6d62c7, 0x8a3e4050), TOBN(0x3ae68f7a, 0xedf10d40),
+     TOBN(0xa95c9ea0, 0x4604d71f), TOBN(0x01aa3fea, 0x415f8028),
+     TOBN(0x3dd55ca5, 0x5a41970a), TOBN(0x05978ad4, 0x0b5776b4),
+     TOBN(0x7c9f5bdd, 0x787fe20c), TOBN(0x23b9fb7d, 0x75fdba0b),
+     TOBN(0xfb1a724d, 0x5fcf3a0f), TOBN(0xd63b3515, 0x87817071),
+     TOBN(0xecae282d, 0x44e40138), TOBN(0x8732df23, 0x87605748),
+     TOBN(0x0ef49da0, 0xd11188cb), TOBN(0xc0478138, 0x51146cc0),
+     TOBN(0x4ba42323, 0x46621921), TOBN(0x8836dd44, 0x47dfa4eb),
+     TOBN(0xdb6a0100, 0x8ec16442), TOBN(0xabdd9b81, 0x9cdd2e87),
+     TOBN(0x205ee262, 0x502e26d1), TOBN(0xb961ef9c, 0x3294e240),
+     TOBN(0x7178f1fb, 0x6da7733d), TOBN(0x989b69fb, 0x232ecf73),
+     TOBN(0xb7278a35, 0x9a9bccae), TOBN(0xb1c81a0b, 0x400a01f3),
+     TOBN(0x0781855a, 0xa6b213ba), TOBN(0x8acc1b78, 0x3429817e),
+     TOBN(0x527e3a9f, 0xfb4e1aae), TOBN(0xc18c1cfd, 0x4c0b0f4c),
+     TOBN(0x0676c365, 0x1fa7d9f0), TOBN(0x3314509f, 0x4454cc7c),
+     TOBN(0xb0f45371, 0xc7c48245), TOBN(0x913fe759, 0x695ef470),
+     TOBN(0xbb676070, 0xc8d3e0ad), TOBN(0x0db98fcc, 0x902e1638),
+     TOBN(0x42874e9c, 0xfc4dfaa8), TOBN(0xcbf89462, 0x7084b2cb),
+     TOBN(0xd6d46f77, 0x8a846ab8), TOBN(0x9e4506ca, 0x14c183b1),
+     TOBN(0xc2d0f9b7, 0xc53b7631), TOBN(0xe47c3d8f, 0x294d6c34),
+     TOBN(0x04e3c868, 0xc05d3f1c), TOBN(0xbacec4f3, 0xa5957fef),
+     TOBN(0x4f4530ba, 0x3b77893e), TOBN(0x4c234f54, 0x69a18bd9),
+     TOBN(0xb45aadd8, 0x5071f5e3), TOBN(0x73e4160a, 0xd1bd0b86),
+     TOBN(0x43fcb30d, 0x1c474f64), TOBN(0xedef0769, 0x617d1612),
+     TOBN(0x92076734, 0x0eec330e), TOBN(0xd7767770, 0x5b0a21b5),
+     TOBN(0x4b7dea31, 0x183e26f4), TOBN(0x59d6ff20, 0xc9fd2e70),
+     TOBN(0x7bdea00f, 0xd5d914f5), TOBN(0xc736dd0d, 0x56376640),
+     TOBN(0x593ae6ef, 0x38ae8300), TOBN(0xdafe49f1, 0xdf0355bf),
+     TOBN(0x094ccd86, 0x0db4491f), TOBN(0x32295701, 0xfe4271ab),
+     TOBN(0x2b7690e4, 0x5db7014e), TOBN(0x1bbc9c36, 0xd7766bfb),
+     TOBN(0xc52249f0, 0x7d986d0c), TOBN(0xc7eec37b, 0x324f20ae),
+     TOBN(0xd376afa3, 0x0e912329), TOBN(0xbc35e949, 0x04268fa3),
+     TOBN(0x617bf765, 0x9e91a4ac), TOBN(0xb1e932ed, 0x1d483ecc),
+     TOBN(0xd4e31672, 0xac493266), TOBN(0x1c779fe2, 0xecdafb85),
+     TOBN(0xed09eb4a, 0x06280499), TOBN(0x3dd8d965, 0xcd4e1f33),
+     TOBN(0x0fb4308d, 0xf34576dc), TOBN(0xa8ccbf5e, 0x85781a43),
+     TOBN(0x8dbf488a, 0xce623a24), TOBN(0xb0e71d30, 0x6118cfd4),
+     TOBN(0xfc68da68, 0x8cc9d957), TOBN(0x7e5e6b65, 0x83815670),
+     TOBN(0x2c16f5ef, 0x3f185dfe), TOBN(0x23a4098b, 0x98952b33),
+     TOBN(0x15a80298, 0xd515f551), TOBN(0x71a2e7fc, 0xa7f8f341),
+     TOBN(0xed42b1b6, 0x8cf4f7b6), TOBN(0x02743db2, 0x1504d390),
+     TOBN(0x2bded3a8, 0x3016e513), TOBN(0xa3c508af, 0xfb0f7bfb),
+     TOBN(0xa6a490de, 0xaa2be716), TOBN(0x5a04d9e5, 0xf4485b9f),
+     TOBN(0xd07b99d1, 0x6ad25b5d), TOBN(0xa1840109, 0x65a72cb4),
+     TOBN(0xc8e2b32d, 0x14c45a95), TOBN(0x0fae6e86, 0xe4f2ecff),
+     TOBN(0xd09f454b, 0xd94b6fe7), TOBN(0xa776a633, 0x23006b62),
+     TOBN(0x6c700a1c, 0xd332b4b9), TOBN(0x50c3fb34, 0xce016225),
+     TOBN(0x4b805bc3, 0x8af71463), TOBN(0x049143e2, 0x5f1fb3b7),
+     TOBN(0xbcaf4b61, 0x5a6d1dd3), TOBN(0x02093dd7, 0x4733abac),
+     TOBN(0x1a23c3f6, 0xdf59f061), TOBN(0x87a6c141, 0x80c4efb7),
+     TOBN(0x47635ae4, 0xd88e4363), TOBN(0x75e2089f, 0xbf8d2072),
+     TOBN(0xa2bc1b27, 0xac83803b), TOBN(0x8ae61522, 0xe2aafecf),
+     TOBN(0x4b459205, 0xd0010193), TOBN(0x900f6a31, 0x9205f876),
+     TOBN(0x49cddbc9, 0xf808f044), TOBN(0x94637692, 0x95094ead),
+     TOBN(0x3c9c7c0c, 0xb87c9bbf), TOBN(0x1699670a, 0x4e1844d1),
+     TOBN(0xd8a978f2, 0xcbcf85c3), TOBN(0x83e7b806, 0x6a36e1c9),
+     TOBN(0x6f28a73f, 0xfaff9c52), TOBN(0x51341222, 0xb71eaa80),
+     TOBN(0x195461da, 0x9328a676), TOBN(0xefcc93e5, 0x21766180),
+     TOBN(0xed82c930, 0x771a5485), TOBN(0x34f15ce0, 0x205a8bff),
+     TOBN(0x88ab72cb, 0xb8b3bfd8), TOBN(0xbb59a5be, 0x8110fe55),
+     TOBN(0x9ce8a082, 0xc7d61a31), TOBN(0xfe81d072, 0x5b1c63d2),
+     TOBN(0x9fae0be1, 0xe9ff8421), TOBN(0x4254f89d, 0x967e13a6),
+     TOBN(0x1c094620, 0x35da926f), TOBN(0x84eda272, 0x4a76583d),
+     TOBN(0xa4033064, 0xe0e0ffb8), TOBN(0x47951945, 0xabc72d0c),
+     TOBN(0x0af6bb4c, 0xb72c32e7), TOBN(0x6c73357b, 0xda797f9e),
+     TOBN(0xd7a726c9, 0x2ac2e99d), TOBN(0xf44b4731, 0xcd62e7cc),
+     TOBN(0xf89f8e29, 0xe6225822), TOBN(0xa44bb9b0, 0x8d713d92),
+     TOBN(0x3291e8d3, 0x9404f6c6), TOBN(0x50b7a4ff, 0x37bdb22d),
+     TOBN(0xe008662e, 0x216a0f13), TOBN(0x150fa2d6, 0xcf382547),
+     TOBN(0xe5e47c55, 0x3138acbc), TOBN(0x595cf1e2, 0x40d7f3db),
+     TOBN(0x2872392d, 0x2ee1949d), TOBN(0xdbd15bf8, 0x8a4fb721),
+     TOBN(0x30e78cdc, 0x183351dc), TOBN(0xa39b8efb, 0x6b294729),
+     TOBN(0x0df4d23e, 0xc7b553e8), TOBN(0x434f38fa, 0x659d3ffc),
+     TOBN(0x1764115e, 0x55a0c931), TOBN(0x34ea18b9, 0xa5c920a4),
+     TOBN(0x6a099ddc, 0xaf903710), TOBN(0x4b937dc1, 0xe49f2c7a),
+     TOBN(0xacfc4a1a, 0x430f0a7e), TOBN(0x8f106a58, 0x421dbe96),
+     TOBN(0x48ac7026, 0x1811d3fe), TOBN(0x5484226a, 0xb80f13c5),
+     TOBN(0xf692e17b, 0x8da7ca79), TOBN(0x4827aaa2, 0x718691b9),
+     TOBN(0x881f1c38, 0x5c5ea68c), TOBN(0x1620f5d6, 0x88bdf643),
+     TOBN(0xe5703cb2, 0x0b9a5add), TOBN(0x392e6ea5, 0xbe925061),
+     TOBN(0x2a66ce20, 0xb0bab0d5), TOBN(0x83a8e0e5, 0xf98e8dad),
+     TOBN(0x53532223, 0xdeec2329), TOBN(0x6a740238, 0x346eea96),
+     TOBN(0xa54afbdf, 0x1dde2a6a), TOBN(0x0e6ca8c1, 0xf2b5b190),
+     TOBN(0xcccaa3c6, 0xf3cd4e46), TOBN(0x168d66bd, 0x0eb7bb3c),
+     TOBN(0xf1275144, 0x08d4f4e9), TOBN(0x2ae8c946, 0x139811fc),
+     TOBN(0x4973c726, 0xc870713a), TOBN(0x298465ee, 0xba54b13f),
+     TOBN(0x9f901403, 0x940f224f), TOBN(0x5cd6a07b, 0xb9950a40),
+     TOBN(0x9d4095e6, 0x069a8484), TOBN(0xe6bf3181, 0xd4f8831f),
+     TOBN(0x37ceb29a, 0x39243da8), TOBN(0xb3887f31, 0x2693653c),
+     TOBN(0x685d2172, 0x42c98a56), TOBN(0x350fbab8, 0x3969dd9a),
+     TOBN(0x728edca9, 0xe8ac84ec), TOBN(0xf42beab3, 0x59bbb0c4),
+     TOBN(0x9793e746, 0x27d3c3fd), TOBN(0xbf6016de, 0xc732b37e),
+     TOBN(0x3688173a, 0xdf0f248f), TOBN(0x84fbd040, 0x7ed59dfa),
+     TOBN(0x2bad638f, 0xa6731b1b), TOBN(0x1c7b4b13, 0xb7355979),
+     TOBN(0xf21550e0, 0xb8e77093), TOBN(0x14d0bc9d, 0x53efc63c),
+     TOBN(0x119ae9fb, 0xd56e1f29), TOBN(0x3511309c, 0x4d60bc5a),
+     TOBN(0xec654f06, 0xe3574e43), TOBN(0x2d6695df, 0xbef6aea2),
+     TOBN(0x27ece611, 0x5d6abff7), TOBN(0xa706d42d, 0x640c9ab8),
+     TOBN(0x7a7252d9, 0x5a6f8fa6), TOBN(0x32be7195, 0x349aaf8c),
+     TOBN(0xffb48a3d, 0xff734e23), TOBN(0xa9b36c82, 0x7d27b99c),
+     TOBN(0x85b7a57e, 0x0ccaedbc), TOBN(0xb93b14fd, 0xc04f2394),
+     TOBN(0x3a3a78c5, 0x160700e0), TOBN(0xbd7ae60a, 0x961e4af8),
+     TOBN(0xe1deb736, 0xd9472cd7), TOBN(0x276b51b7, 0x3880bbbe),
+     TOBN(0xcf0c4b9a, 0x1aa99bfb), TOBN(0xaf949d5f, 0x689d7f58),
+     TOBN(0x00878488, 0x65f33328), TOBN(0x0f1a178c, 0xe7d7b484),
+     TOBN(0xd44550f8, 0x849e6d32), TOBN(0xe7bc29d4, 0xfe16485e),
+     TOBN(0x29bbfec6, 0x2f343924), TOBN(0xeeb802f2, 0x40f2b5ce),
+     TOBN(0x2b337542, 0xbbb64f33), TOBN(0x4c1d3a36, 0x9f9bdb3c),
+     TOBN(0x1067cf3b, 0xc7a1cb88), TOBN(0x3f12a31d, 0x4601fb6e)},
+    {TOBN(0xb720a78f, 0x1f8a4a91), TOBN(0x59e22211, 0x753dbe73),
+     TOBN(0x9f5ad99c, 0xadd0991a), TOBN(0x3a0db802, 0x7380726f),
+     TOBN(0x37f0761c, 0x7dfb4f1c), TOBN(0x68e7098a, 0x5ac819cd),
+     TOBN(0x9683d610, 0x37ffe348), TOBN(0x5bf205e5, 0x2b7b5140),
+     TOBN(0x9846b5f6, 0x61a97262), TOBN(0xedf2cacb, 0x974a82f7),
+     TOBN(0x3dfab85f, 0xaf439654), TOBN(0x43fb0ef9, 0xc724ee09),
+     TOBN(0xd0d5016f, 0x53b0119a), TOBN(0x68445363, 0x5bc8fc81),
+     TOBN(0x6d10b649, 0x1f65d298), TOBN(0x0f3c88c6, 0x21a4e64f),
+     TOBN(0x320372a1, 0x7f34c517), TOBN(0x5602bd16, 0x2378bc27),
+     TOBN(0x666a592d, 0x91aae024), TOBN(0x716886ab, 0x317bbdaa),
+     TOBN(0xce55fe68, 0xe3045103), TOBN(0xf2c4b0b2, 0x7de1d701),
+     TOBN(0x8da35885, 0x7d724cb6), TOBN(0x9aac623c, 0x9ec47314),
+     TOBN(0x824cff46, 0xb8529a01), TOBN(0x6e4d82a2, 0x4856b95c),
+     TOBN(0x58c6b833, 0xc65af7f7), TOBN(0x8a6c4125, 0xae110e53),
+     TOBN(0x38207c30, 0x4f083340), TOBN(0x71aa384b, 0x176cdb31),
+     TOBN(0x1ada2941, 0x42882de1), TOBN(0x38b1ad2e, 0xc16a2e4a),
+     TOBN(0xbdda2720, 0x142bcb30), TOBN(0x56175263, 0xfaf604d1),
+     TOBN(0x086189c1, 0xe6796314), TOBN(0xdab01c68, 0x5b04dd19),
+     TOBN(0xce54e4b0, 0xba8ed3c1), TOBN(0xf616513b, 0xe281acfb),
+     TOBN(0xaf179629, 0x5e0a6319), TOBN(0x85e79ac9, 0x328b587b),
+     TOBN(0x11d84588, 0xc9fd7da0), TOBN(0xa78682d0, 0x1238d0c4),
+     TOBN(0x333ddde0, 0x829d6475), TOBN(0x80c88440, 0x69de9e18),
+     TOBN(0x5d15f21a, 0xc6d8176f), TOBN(0xdaff9434, 0xa509d470),
+     TOBN(0x0191bb0a, 0x8bbbfcd5), TOBN(0xff7732b8, 0x08fc2688),
+     TOBN(0x02fe772d, 0x5ab3d89e), TOBN(0xf1580ec9, 0x9a786c91),
+     TOBN(0x8fd83417, 0x5a323866), TOBN(0x93711d49, 0xbadec96f),
+     TOBN(0x2020c34a, 0x6b9b4a30), TOBN(0xbf10e000, 0xb8b0de24),
+     TOBN(0x2a5f298d, 0x28de3ce5), TOBN(0x807a398e, 0xfe1a1c63),
+     TOBN(0x9fb640cd, 0x73f7c45c), TOBN(0xeb1f87ad, 0x0afe059c),
+     TOBN(0xa3c3979a, 0x52b168d4), TOBN(0x6eef460c, 0x7b1e403f),
+     TOBN(0x6d943e50, 0x2724bb3f), TOBN(0x53f3f1bb, 0xf9d922d1),
+     TOBN(0x547e7a03, 0xcd538b4a), TOBN(0x37631e20, 0xd2c4145f),
+     TOBN(0xe7e49922, 0xb1f810bf), TOBN(0xacafdb0f, 0xf2645825),
+     TOBN(0x0f22216a, 0x15f35bda), TOBN(0x6f2b4d95, 0xd85bd0b7),
+     TOBN(0x2f203db8, 0xbedc9ecd), TOBN(0x26639ff6, 0xb91e090d),
+     TOBN(0x94cd6596, 0x3486eb84), TOBN(0x32747db3, 0x42c05747),
+     TOBN(0xcd3e7a52, 0xcebfa9f1), TOBN(0x5e792d76, 0xfb2b3007),
+     TOBN(0x9669523d, 0xb9ecce81), TOBN(0x9263cc85, 0x04f191e1),
+     TOBN(0x192019c0, 0x69655fe1), TOBN(0x1c5cc5eb, 0x4d984e59),
+     TOBN(0x9ad10ed6, 0xdf33f336), TOBN(0x0ca48387, 0x41d94897),
+     TOBN(0xbd1ddf67, 0xf222476c), TOBN(0xb4ad7126, 0x12d6dc4d),
+     TOBN(0x5c327b18, 0x93ed702a), TOBN(0x7e3a27b1, 0xfa70cd9f),
+     TOBN(0xdca750bd, 0xc0c4f415), TOBN(0x98197c90, 0x213a5d61),
+     TOBN(0x9bbd014a, 0x6f10fcc7), TOBN(0xb06061e1, 0x2ceed4fb),
+     TOBN(0xaf6dbbe2, 0xa8ad25f9), TOBN(0xe70e9f40, 0x7ade697d),
+     TOBN(0xb829e016, 0x6eb872d7), TOBN(0xc330e15c, 0x1b04173f),
+     TOBN(0xd4868e29, 0x0d4763d8), TOBN(0x37867f72, 0x4c18c9fb),
+     TOBN(0x5fd2f47f, 0x28019486), TOBN(0xe6bfdf81, 0xb16e9bdd),
+     TOBN(0xace2a977, 0x783e43c5), TOBN(0xe1791288, 0x76eed46a),
+     TOBN(0x3884a5b2, 0xd1767739), TOBN(0x14eddddb, 0x427c50a3),
+     TOBN(0xbeeed5ac, 0x1c9b1fcc), TOBN(0x50b1cb44, 0x4ecdb47a),
+     TOBN(0xcbf69555, 0x0dcb78d5), TOBN(0xe60bf9c7, 0xf2b17a99),
+     TOBN(0x0edae6b0, 0x9e9ade95), TOBN(0xb5c6e13d, 0xcb78b1e1),
+     TOBN(0x32860fba, 0x1c257848), TOBN(0xfc9aa9f4, 0xef7f5080),
+     TOBN(0xccef8508, 0x32aac870), TOBN(0x4b237704, 0xfb5310a0),
+     TOBN(0x4c3cf970, 0xfeebb972), TOBN(0x5dd3c7a0, 0x763d5f67),
+     TOBN(0xa656797e, 0xccbf29c6), TOBN(0x6d77f211, 0x5a76a56b),
+     TOBN(0xc627156b, 0x0e3daff3), TOBN(0xa4bd37f5, 0x7646fb1c),
+     TOBN(0x5fd7e286, 0xa8cd3e5a), TOBN(0x3889951a, 0x2f5fed51),
+     TOBN(0xf8186fc5, 0xe48c49be), TOBN(0x0d3d308a, 0xc662ee38),
+     TOBN(0xb7c9bf06, 0x970e164d), TOBN(0xc27a88d8, 0xbd3d3087),
+     TOBN(0x8a37c9cd, 0xf4e7c899), TOBN(0x18494d5a, 0xab411371),
+     TOBN(0x06532375, 0xd9d8b29c), TOBN(0xb92dd45c, 0x915a2f74),
+     TOBN(0x8a23f6bf, 0x515acb02), TOBN(0x0e69248c, 0x435bfa89),
+     TOBN(0x8bf41ec3, 0x6866c5e4), TOBN(0xf059e652, 0x0999159d),
+     TOBN(0xf906838f, 0xd29d7cd8), TOBN(0xc30100f6, 0x3a269735),
+     TOBN(0xb7742bc8, 0x6280e70b), TOBN(0x0067d971, 0x867b54e1),
+     TOBN(0xafe9032b, 0xf544622a), TOBN(0x6b441e39, 0x118a2042),
+     TOBN(0x905c8655, 0xcdd66b70), TOBN(0xe88cce1b, 0xc1e2110d),
+     TOBN(0x8cc23c0c, 0xee674093), TOBN(0x55ded4d9, 0xb2ea3fc3),
+     TOBN(0xdd14502b, 0xb58dfbed), TOBN(0x523a4dd9, 0x49f698f8),
+     TOBN(0xf843a501, 0x01c83e5a), TOBN(0xf11fd4c1, 0xfe71ee1e),
+     TOBN(0xeedd7229, 0x162d7c0b), TOBN(0xd42d6a9e, 0x4ccad713),
+     TOBN(0xa082fffd, 0x2b0c7b93), TOBN(0xee3abd48, 0x2a5016b9),
+     TOBN(0x5079c95f, 0xc117e22b), TOBN(0x5d4b9169, 0x814b8666),
+     TOBN(0x9e0f5e87, 0x9bf90a6d), TOBN(0x4346bd29, 0x744bf7ab),
+     TOBN(0x4d85af0e, 0xbfb551b6), TOBN(0xb48e3da8, 0x31f7a958),
+     TOBN(0x3b474ce6, 0x6f5bc50d), TOBN(0x9fdb47bc, 0xe7c8dced),
+     TOBN(0x2064450e, 0x53003272), TOBN(0x6bb230f3, 0x839e69da),
+     TOBN(0xb6941512, 0x4d822be5), TOBN(0xb51bc6aa, 0xf11a9dc1),
+     TOBN(0x866447f8, 0xb23047dc), TOBN(0xe02dbd63, 0xe5f52c2d),
+     TOBN(0xe6ea43cb, 0x02770a76), TOBN(0x853f5fe3, 0x56fa6c25),
+     TOBN(0xfe9615f0, 0x960de6d5), TOBN(0x37c8b0c8, 0xf4b1b945),
+     TOBN(0xa6e83805, 0x4618629d), TOBN(0x38fb5264, 0x23a2ac61),
+     TOBN(0x5dfd7005, 0x01751c20), TOBN(0x7e100245, 0xce72773a),
+     TOBN(0xdf09f92a, 0x0776794a), TOBN(0xc4a8de81, 0x1b730fdc),
+     TOBN(0x72c302ab, 0xf0c7b031), TOBN(0xdddff68e, 0x1283913b),
+     TOBN(0x24889098, 0xe32517b5), TOBN(0x2483a0f5, 0x856a2934),
+     TOBN(0xdf6d7dcc, 0xa1c3d56d), TOBN(0x07f9c00b, 0x09afb797),
+     TOBN(0xe90da23d, 0x083d9557), TOBN(0x80ae6e53, 0xcbc03826),
+     TOBN(0x1fd6ff6d, 0x7c0e1b23), TOBN(0x1e90f3c8, 0xb1100226),
+     TOBN(0xf179e00e, 0x05a24e23), TOBN(0xe5361efe, 0x946f16bd),
+     TOBN(0x50f12e4a, 0x4c662091), TOBN(0xdad2c7a3, 0x28608585),
+     TOBN(0x55c66749, 0xf7429473), TOBN(0x440b77de, 0x045ea1b4),
+     TOBN(0x9f707b49, 0x91229927), TOBN(0x3501e29e, 0xc6725715),
+     TOBN(0x5626fabb, 0x1225a8e6), TOBN(0x270a9c2b, 0x9507e709),
+     TOBN(0xe0d629da, 0xbdcb9039), TOBN(0xb4d7cd22, 0x20255b7c),
+     TOBN(0x10c8614b, 0x5ed874a6), TOBN(0x36891e70, 0x4e67d406),
+     TOBN(0x020da834, 0x1dce66fe), TOBN(0xae69e1e7, 0xabd64dea),
+     TOBN(0x9cf153a1, 0xcc71b37b), TOBN(0xa6e9d024, 0x44771c7e),
+     TOBN(0xb15e31c7, 0x8840fc17), TOBN(0x57853112, 0x349124a4),
+     TOBN(0x78a9d807, 0xbac542ee), TOBN(0xe7b4d812, 0x38fe1188),
+     TOBN(0x874adc70, 0xb3a3b801), TOBN(0x80c0e02a, 0x4694cec2),
+     TOBN(0xd05c8c0e, 0xe97805e1), TOBN(0x8eaebceb, 0x89d8cd40),
+     TOBN(0x888c777b, 0x378d055f), TOBN(0x6956795e, 0xb104a132),
+     TOBN(0xe4bce719, 0xbe8472d7), TOBN(0x23c9f0bf, 0x5f51729e),
+     TOBN(0xfe7f7e19, 0x36a3bf3e), TOBN(0xf8f5d2ca, 0x20a32d37),
+     TOBN(0xf383b467, 0x93b8a344), TOBN(0x7eab76f5, 0x27a6e2c5),
+     TOBN(0x86c31b0e, 0x93b54bc1), TOBN(0xb9405ea9, 0xfc4ecab2),
+     TOBN(0x09485578, 0xa0f6d341), TOBN(0x88053bb8, 0x4b77e8e7),
+     TOBN(0xcde9b777, 0x29a07ddd), TOBN(0xec8ea63f, 0x97649102),
+     TOBN(0xf74d082a, 0xc516777a), TOBN(0xf4e26d89, 0xbacf0dd3),
+     TOBN(0x6a919da8, 0xd0b3b578), TOBN(0x0bcc3b29, 0xa0b5f7d8),
+     TOBN(0xbf4565e5, 0x9e55924b), TOBN(0x13b36187, 0x7889dbb6),
+     TOBN(0xad0e59c6, 0x533981bd), TOBN(0xea941b62, 0x0bd0cb7a),
+     TOBN(0xe5e35e9a, 0xa9e7aa7c), TOBN(0x27f61727, 0x088bfd7d),
+     TOBN(0xda2a5a20, 0x8b3c7fbc), TOBN(0x33cdd403, 0xba55cb48),
+     TOBN(0xb72b51cf, 0x90e7ff36), TOBN(0x8cc4b553, 0x6f215840),
+     TOBN(0xf7b80ad9, 0xd2671224), TOBN(0x560b4387, 0x6a45436b),
+     TOBN(0xdca90694, 0xff9e8fae), TOBN(0x2e7e9546, 0xf97aa84e),
+     TOBN(0x71e9ff45, 0xf37cd717), TOBN(0x6edf335e, 0x0d73e98f),
+     TOBN(0xf355690c, 0x9f715170), TOBN(0xf74df40b, 0x3f5a82bd),
+     TOBN(0x28b6d931, 0x95e5b105), TOBN(0x8827f47c, 0x2841a54c),
+     TOBN(0x159cb943, 0x62b4312d), TOBN(0x277943d7, 0x8db37edb),
+     TOBN(0x561454fd, 0x6113a9f8), TOBN(0x78ebe733, 0xe70e67e6),
+     TOBN(0x8764360b, 0x903f2feb), TOBN(0x2ba3b3d8, 0x97902f36),
+     TOBN(0x28808cef, 0x87490b8a), TOBN(0xb1175954, 0xf05f31b3),
+     TOBN(0xbd5d6005, 0x6c9b4f4d), TOBN(0x12b13fca, 0xdd254e60),
+     TOBN(0x38d4e812, 0x14959566), TOBN(0xe253b750, 0x36fe9a6c),
+     TOBN(0x24b2c81a, 0x809450c1), TOBN(0x0aa89966, 0x8fec36b1),
+     TOBN(0x9a99deb5, 0x053e97e7), TOBN(0x5e57321c, 0xe31d3a6e),
+     TOBN(0xcd7a4f33, 0x8dbe78a2), TOBN(0x9f809d4f, 0x3299e070),
+     TOBN(0xd6de8cfa, 0xa26a9eca), TOBN(0x33d5705b, 0xa158a735),
+     TOBN(0x08dd3fcc, 0xc2293743), TOBN(0x1f8d0a46, 0x68bbbaea),
+     TOBN(0x53ff76f9, 0x61bc4105), TOBN(0x6445e88d, 0x7c4a8fc9),
+     TOBN(0xfd9a8d04, 0xc285d0e6), TOBN(0xf08d0d6b, 0xfe62b449),
+     TOBN(0x08c27292, 0xc062810c), TOBN(0x955629f6, 0x6663fa28),
+     TOBN(0xbaf96c0e, 0x9d86fee8), TOBN(0x1dbc5406, 0x46bb9894),
+     TOBN(0x8d6b6207, 0x93dd45c7), TOBN(0xaf3baef6, 0x3ee989fc),
+     TOBN(0xf66cfdb1, 0x59b7b2f7), TOBN(0x287fc2bf, 0xda16c637),
+     TOBN(0xa44ca8fa, 0x2d71f863), TOBN(0xa1161962, 0x84d5dee5),
+     TOBN(0x5a5c8ce3, 0x3957b610), TOBN(0xdbb32253, 0x17f50b57),
+     TOBN(0xc6a4eb7d, 0x76056358), TOBN(0xff9eb424, 0xc359d90f),
+     TOBN(0xdf4afe23, 0xa88cb38c), TOBN(0x2ae727cb, 0xa696b75d),
+     TOBN(0x47cc63ef, 0xd20a58c8), TOBN(0xd319dc3a, 0xc492ab36),
+     TOBN(0x887a7d83, 0x36c7f76e), TOBN(0x65ed5e3e, 0xfcd4cf49),
+     TOBN(0x0e6f2f34, 0xda301d39), TOBN(0xf2f7c102, 0x38ad4533),
+     TOBN(0x8a3a003b, 0xae834622), TOBN(0x94084169, 0xa060a0d4),
+     TOBN(0xb673168b, 0x13c8a1eb), TOBN(0x80109609, 0x459f8da1),
+     TOBN(0x68003fa1, 0x5c82007b), TOBN(0x9f634159, 0x248e0430),
+     TOBN(0x188156ab, 0xfb9b6510), TOBN(0xc35be1cc, 0xe62844de),
+     TOBN(0x21e8f908, 0xb0c84d39), TOBN(0xa886d3eb, 0xdad3ae53),
+     TOBN(0x9e20cd56, 0x82b0f5fd), TOBN(0xc0c12f0b, 0xc465c721),
+     TOBN(0xfeeb1051, 0x6f913a6e), TOBN(0x9e7c76b9, 0xaa32d6fe),
+     TOBN(0x820b49a0, 0xb8637b5f), TOBN(0xe9ae172a, 0xf4abccf0),
+     TOBN(0xccc050b1, 0xfb270e67), TOBN(0x0b51d7e3, 0x2269d1de),
+     TOBN(0xca772ec1, 0x678c8d8b), TOBN(0x74eea3f8, 0x77ae7c7b),
+     TOBN(0x51550df1, 0x1e1bcbd3), TOBN(0xa931c17c, 0x3458b249),
+     TOBN(0x192c3a45, 0xf204aed5), TOBN(0x93abf63d, 0xc993c881),
+     TOBN(0xc60aa2cb, 0x83421891), TOBN(0x11ce6735, 0xf6b70284),
+     TOBN(0x53e8a3ee, 0x69e152e4), TOBN(0x6889ece0, 0x0033da23),
+     TOBN(0xada56904, 0x7d585418), TOBN(0xaf81a877, 0xf5e5abb9),
+     TOBN(0x36e0267d, 0xdf515727), TOBN(0xe04b532d, 0x3daad2a9),
+     TOBN(0x290e3ee7, 0x1a11ced6), TOBN(0x5be7c429, 0x65e7a651),
+     TOBN(0xc0662cd3, 0x8ef9b498), TOBN(0x0ec5fbf0, 0x6c4dcbf9),
+     TOBN(0x26694c70, 0xce4d7e3a), TOBN(0xc1699a93, 0xfa52de99),
+     TOBN(0x2e0d394b, 0x6dae3e97), TOBN(0xe3af28cf, 0x4c66e572),
+     TOBN(0x9caf7bf8, 0xba1e27e4), TOBN(0xd5c39337, 0xd5a4bdaa),
+     TOBN(0xbb5d9551, 0x9ec8ad6d), TOBN(0xfb3bc1f1, 0x609fc2e1),
+     TOBN(0x0d95ad2a, 0x95fe12b5), TOBN(0xf6fd6e89, 0x5341dc74),
+     TOBN(0x1532991e, 0x7537b803), TOBN(0x77772fd3, 0xeaf96f9c),
+     TOBN(0x4ed09840, 0xf832749a), TOBN(0x69a194ce, 0x95f19d25),
+     TOBN(0x5464471a, 0x041cc340), TOBN(0x26f7e550, 0x1c442289),
+     TOBN(0x38f2c20e, 0xb5ce9706), TOBN(0xcf73f8f2, 0x8a44efd3),
+     TOBN(0x5176eda5, 0x586e8f77), TOBN(0x47e33844, 0x63ece447),
+     TOBN(0x83826e8f, 0x86b00be2), TOBN(0x49cffcdb, 0x539807b7),
+     TOBN(0x543d1fad, 0x414d3fb1), TOBN(0xd56aac6a, 0x38b1ef44),
+     TOBN(0x9980bb64, 0x96c89050), TOBN(0xc300cb46, 0xb169b8a9),
+     TOBN(0x5ab01a6b, 0x83413df4), TOBN(0x179b8922, 0xf3c91eda),
+     TOBN(0x4060b943, 0x43cccc06), TOBN(0x4f6adeb5, 0x9458ec1e),
+     TOBN(0x0a4c6437, 0xe339e40e), TOBN(0x9cb6c532, 0x02aefe83),
+     TOBN(0xb072d02b, 0x23dce7ea), TOBN(0x2cd7b117, 0x59a9032f),
+     TOBN(0x01220cea, 0x81dbfaef), TOBN(0xffe0026c, 0x0905332d),
+     TOBN(0x95ec2cb2, 0x0197adff), TOBN(0x853bf6f5, 0x4c3d0e49),
+     TOBN(0x04ed54fb, 0x25d78f7c), TOBN(0x45aae3e1, 0xbb68cb9f),
+     TOBN(0xf4f1a2c6, 0xe32d7421), TOBN(0x646ade65, 0x45a05771),
+     TOBN(0xab241cfa, 0x91eab45e), TOBN(0xb1cf204c, 0x7b214af0),
+     TOBN(0x92dfb3e3, 0x851d311c), TOBN(0x56479ffb, 0x144ae0da),
+     TOBN(0xbf847444, 0x9a7a4ede), TOBN(0xb26b1f15, 0xf5cfd20f),
+     TOBN(0xf380ed7d, 0x83b33b64), TOBN(0xa21f9564, 0x3d1998c9),
+     TOBN(0xd985c7d3, 0xa720e347), TOBN(0x98078974, 0x8bdf09d5),
+     TOBN(0xa1f34ce2, 0xce947692), TOBN(0xf69e6144, 0xf419c385),
+     TOBN(0xe1926526, 0x8c3adcc6), TOBN(0x848974fb, 0x42746263),
+     TOBN(0xa731261f, 0x97791569), TOBN(0xfed39da2, 0x065b721b),
+     TOBN(0x8369b04c, 0x836a7e20), TOBN(0x5758a761, 0x53c19f62),
+     TOBN(0x45746383, 0x0ebea868), TOBN(0x20179927, 0x3b7d71a8),
+     TOBN(0xb466ed4f, 0x57632243), TOBN(0xc8d918cb, 0x120577c9),
+     TOBN(0xbab307e5, 0xeda40e9c), TOBN(0xe6dbc7d4, 0xd5f65d1b),
+     TOBN(0xcae0c649, 0x60619e10), TOBN(0xffddf6d1, 0x6b0df67c),
+     TOBN(0x60488755, 0xb32ee5d1), TOBN(0xcb278aaf, 0x47164a55),
+     TOBN(0x354c3392, 0x0bfb732d), TOBN(0xcd4fc821, 0x649bc125),
+     TOBN(0xa8e1253f, 0x770ffdb8), TOBN(0xf7eec595, 0x0ff0c37e),
+     TOBN(0xe5a65279, 0x7149b102), TOBN(0x1cbbb56b, 0xd0528224),
+     TOBN(0x40b1a8d9, 0xb51c5df4), TOBN(0xccb43d26, 0x39e1ca25),
+     TOBN(0x48f74dc2, 0xfdcfe8c5), TOBN(0x3ccb31b6, 0xfa5b8daf),
+     TOBN(0x6f8dc5bc, 0x7de6300f), TOBN(0x2a373fd3, 0xf247bc0b),
+     TOBN(0xefe13539, 0x17825306), TOBN(0xeb253484, 0xc50c47b4),
+     TOBN(0x4a7f2af3, 0x3c739f02), TOBN(0x3a3eb385, 0x9a3c6746),
+     TOBN(0xa90afa2a, 0x588978e2), TOBN(0x501fcebf, 0x8d80894f),
+     TOBN(0x1de1d06d, 0x6bf1a4cb), TOBN(0xb0f4a61d, 0x6cc42a07),
+     TOBN(0x975cb8de, 0x78d406f0), TOBN(0x560b0d7b, 0xe3d293e3),
+     TOBN(0x5746227c, 0x32e686ca), TOBN(0xd12854f5, 0x3fcb0205),
+     TOBN(0x8c0eaba8, 0x499512e3), TOBN(0x8d97c229, 0xade99108),
+     TOBN(0xd80da38e, 0xff2b5782), TOBN(0xf8c30ba1, 0xaef08107),
+     TOBN(0x9068d7d0, 0x076b97c3), TOBN(0x851d1cb9, 0xb1b7eba5),
+     TOBN(0x02bb728c, 0x318e4675), TOBN(0x0efe9707, 0x76ddc683),
+     TOBN(0x6985d358, 0x6a248b04), TOBN(0x75eb6019, 0xf8969ed1),
+     TOBN(0xecb66a20, 0x606a0c64), TOBN(0xd1252f64, 0xfe39b5e5),
+     TOBN(0x93d5d61c, 0x2aa222a9), TOBN(0x16c0d6f9, 0x1ffff8ec),
+     TOBN(0x0f1f962d, 0x5dfab0fe), TOBN(0x88776fe1, 0xcedcccb0),
+     TOBN(0x410333c6, 0xa32cbff1), TOBN(0xca13ce28, 0x093bcbda),
+     TOBN(0xd97b0684, 0x0e479259), TOBN(0x8b2b3ad8, 0xbf505c93),
+     TOBN(0x42092d64, 0x71761412), TOBN(0x9d0c842d, 0x918acf33),
+     TOBN(0x904d3add, 0xac9ade57), TOBN(0x025e4177, 0xe0d5ef6a),
+     TOBN(0xce406ec0, 0x0b33d4ed), TOBN(0xf73ac4da, 0x57b5c958),
+     TOBN(0x5f96cb8c, 0x6ef70849), TOBN(0x702ccc6f, 0x77b32d5d),
+     TOBN(0x75bda8d8, 0xcea6885c), TOBN(0xbfc3e62e, 0xc0c0432e),
+     TOBN(0x46db9cc6, 0x54631c9a), TOBN(0x1669075b, 0xba1d1550),
+     TOBN(0x5ccc4e34, 0x2d227656), TOBN(0x0724e41b, 0x02cb0644),
+     TOBN(0xc5e2077d, 0x435601fb), TOBN(0x356155c5, 0x68d6aee2),
+     TOBN(0x0ea00013, 0xfde58906), TOBN(0x79fa13c3, 0x37a9eda4),
+     TOBN(0x7d09479d, 0x8f51a6a6), TOBN(0x86e955b7, 0x1f979fed),
+     TOBN(0x9cb22960, 0xe39ab804), TOBN(0x6aeae783, 0x03535a39),
+     TOBN(0xeb4741de, 0xb9909be6), TOBN(0xb957c5da, 0x1a5f4139),
+     TOBN(0xafdb3e8b, 0xedc1819f), TOBN(0x33545722, 0xe7caa690),
+     TOBN(0x0ef33e28, 0x8bb66ed0), TOBN(0x59073742, 0x70e667b5),
+     TOBN(0x0390fb3c, 0x5c7773b8), TOBN(0xb80b4a2f, 0x286a809d),
+     TOBN(0xd17d6103, 0xfac46467), TOBN(0x9a09a0d6, 0x91a48972),
+     TOBN(0xa2124b62, 0x39e44585), TOBN(0x14c8a671, 0x174d241a),
+     TOBN(0x99abfa37, 0xada8ba26), TOBN(0x847f3040, 0xfbb457ae),
+     TOBN(0x0587aaa4, 0x7529a18c), TOBN(0x23b3f724, 0x9bb45ee6),
+     TOBN(0x4d7f5712, 0x2aa81155), TOBN(0xa9185804, 0xa4f16d09),
+     TOBN(0xab638141, 0x3fc992d1), TOBN(0xb6c326fa, 0x0cad0bb0),
+     TOBN(0xe21c3625, 0x60f2cb10), TOBN(0x6c7af09e, 0x2fac20a9),
+     TOBN(0x31e892fa, 0xdc6f72ab), TOBN(0x71d5c6a3, 0x21b81f7b),
+     TOBN(0xc3e2d70d, 0x298a0dd2), TOBN(0xbc0c37e2, 0x13ecdc80),
+     TOBN(0xd3191146, 0xe6496ba4), TOBN(0x15f81541, 0x35115466),
+     TOBN(0x162be77d, 0x07d1937f), TOBN(0x38b4d194, 0x7b176367),
+     TOBN(0x4485966d, 0xb8cafbc9), TOBN(0x7cfc0d67, 0xf44c2a81),
+     TOBN(0xe9e7ec4d, 0xe624cefe), TOBN(0x4db8bec3, 0x581d4e48),
+     TOBN(0xe76edf00, 0x7fc8615a), TOBN(0x1b62c4a5, 0x9a02cdb8),
+     TOBN(0x8b565749, 0x83938a6d), TOBN(0xd813864e, 0x50c86c19),
+     TOBN(0x7fc071ef, 0x16f55d40), TOBN(0x70195438, 0x9bb45ea5),
+     TOBN(0x83cf09f2, 0xa35543ca), TOBN(0x07e91a84, 0x20554c19),
+     TOBN(0x51ecd701, 0x62a9d06e), TOBN(0x00e14c62, 0x2044a663),
+     TOBN(0xb1317c13, 0x00423dd9), TOBN(0xf49431bc, 0xa46eab4c)},
+    {TOBN(0x35118434, 0xd0614aa1), TOBN(0x8bae9779, 0xd1418434),
+     TOBN(0xf5641d82, 0xb8c15b89), TOBN(0x2383af56, 0x416432eb),
+     TOBN(0xa552d3f0, 0x2c73f990), TOBN(0x8df82e9e, 0xa6bbdc7d),
+     TOBN(0x0f336aa8, 0xd75ec634), TOBN(0xc42e3b2d, 0x1603e53f),
+     TOBN(0x4b33e020, 0xbad830d2), TOBN(0x5c101f9e, 0x590dffb3),
+     TOBN(0xcd0e0498, 0xbc80ecb0), TOBN(0x302787f8, 0x52aa293e),
+     TOBN(0xbfd64ced, 0x220f8fc8), TOBN(0xcf5cebe0, 0xbe0ee377),
+     TOBN(0xdc03a038, 0x8913b128), TOBN(0x4b096971, 0xfde23279),
+     TOBN(0xb0f8c0de, 0xd2d638ad), TOBN(0x47fc8c77, 0x4f299d5f),
+     TOBN(0xd1720a92, 0x9b68d48e), TOBN(0xf944e708, 0xa1c6f103),
+     TOBN(0x36e34e04, 0xa146889b), TOBN(0xb0aad2d6, 0xe74a2a28),
+     TOBN(0xedbb034b, 0xca52f53c), TOBN(0xe987a8e1, 0x87fb2713),
+     TOBN(0x6c5389af, 0xf727ef3a), TOBN(0x95ffeb95, 0x33db88fb),
+     TOBN(0x27cb7042, 0x9dae0777), TOBN(0xd20afe81, 0x616dbf02),
+     TOBN(0x0fab8e18, 0x914bf706), TOBN(0x3b1e66f3, 0x0517cd09),
+     TOBN(0x24b46dce, 0x12e40644), TOBN(0x0ff10168, 0x08f2d8fa),
+     TOBN(0xe08a10df, 0xea2d8d84), TOBN(0xe31f05e7, 0xe97dda79),
+     TOBN(0xfe95f84a, 0x4e9ab132), TOBN(0xacd6f7fc, 0x927e216f),
+     TOBN(0x025e27bd, 0x83c5a3ea), TOBN(0xed010c0d, 0x50f120fc),
+     TOBN(0x443b3b8a, 0xb828101f), TOBN(0xd8384819, 0x8cfc0dea),
+     TOBN(0xe55f34c8, 0x83dc5447), TOBN(0xbe76243b, 0x04e4e9a0),
+     TOBN(0x78fb4cbc, 0x819166a2), TOBN(0x0bdfb703, 0xae37f80a),
+     TOBN(0xf869288e, 0xc217cda8), TOBN(0x2662bb71, 0x62af4156),
+     TOBN(0xce64f291, 0x50ae9d30), TOBN(0xee0d4440, 0xdc0353c9),
+     TOBN(0x3e61a9ea, 0xbd25609c), TOBN(0x4ccaea93, 0xb3839c8b),
+     TOBN(0x721cefa3, 0xe43736e2), TOBN(0x229cb244, 0xd0035908),
+     TOBN(0x936bc1dc, 0x7f10aebb), TOBN(0xc93a1002, 0xb67332e7),
+     TOBN(0xf4b53dd4, 0xf98d1132), TOBN(0x7b99a196, 0xd5a75030),
+     TOBN(0xb13caadd, 0xca9a9526), TOBN(0x701c63fa, 0x69a303e9),
+     TOBN(0xb97d667a, 0xb0a50f3c), TOBN(0x27c03d7c, 0x68e6557f),
+     TOBN(0xab24e712, 0xeb105607), TOBN(0x4936aedd, 0x8dd86ccb),
+     TOBN(0x32196f8a, 0x0a986d68), TOBN(0x0307b826, 0x248f5a65),
+     TOBN(0x20e14b4c, 0xfcadb2ad), TOBN(0x4cb4a092, 0x8c3b8c23),
+     TOBN(0x50fe3c1a, 0x1caa9db1), TOBN(0x23cc56e8, 0x81c0a4e9),
+     TOBN(0x5ab09199, 0x0867753f), TOBN(0x5a253d19, 0xf9d47c55),
+     TOBN(0x422b4e03, 0x1a9bcc88), TOBN(0x4e1ce22b, 0x671e4f36),
+     TOBN(0x588f58b5, 0xebbe949f), TOBN(0xb7762296, 0x6982215b),
+     TOBN(0x3cc83dd6, 0xcff863c0), TOBN(0x81ec094d, 0x01098f51),
+     TOBN(0x214d69aa, 0xbe0432d0), TOBN(0xe4e52a9c, 0x6455957d),
+     TOBN(0x94743ba8, 0xfadc1eab), TOBN(0x2c395d97, 0x8176316f),
+     TOBN(0xeab6400c, 0xe6bb4d34), TOBN(0x7364dc55, 0xc0d49bf2),
+     TOBN(0xd6fa6e40, 0xe6959c7e), TOBN(0x7960a997, 0x7eaae61c),
+     TOBN(0x918b3c63, 0x94ea77c2), TOBN(0x2cf4997f, 0x76866dd1),
+     TOBN(0xc4214abf, 0xbcbba8ca), TOBN(0x349a6133, 0x7aa4aab2),
+     TOBN(0xd64bab77, 0x99458b24), TOBN(0x6fe19e25, 0x2eba3064),
+     TOBN(0x9aabd83d, 0x74068f03), TOBN(0xaef81218, 0x6fdf8655),
+     TOBN(0xf506d27b, 0x65593fef), TOBN(0x0a1ad85d, 0xfaa457b2),
+     TOBN(0x266d0f06, 0xa303dff4), TOBN(0xe8114f4e, 0xabb416e3),
+     TOBN(0xe743f617, 0x6aa5a1b8), TOBN(0xaf84652d, 0x1b5b2bd6),
+     TOBN(0x8b1beab1, 0x092e2c46), TOBN(0x7e857549, 0xe2518383),
+     TOBN(0x6be2ece1, 0xa9383124), TOBN(0x8309442a, 0x7fc20081),
+     TOBN(0x1f00eb8b, 0xc3046cab), TOBN(0x959f3155, 0x26f39f8c),
+     TOBN(0xaacfe2d3, 0x8fc2ed93), TOBN(0x83446645, 0x78f0f858),
+     TOBN(0x58de6f09, 0xdda35ec4), TOBN(0x891e5ecd, 0xf78c69b1),
+     TOBN(0xff4a4ba9, 0x91c13d67), TOBN(0x6e78063d, 0x487d5575),
+     TOBN(0x226b621e, 0x8d303a7e), TOBN(0x5c9bc103, 0xc95987ed),
+     TOBN(0x28980108, 0x5e3be13e), TOBN(0x5e8c0ac5, 0x414af955),
+     TOBN(0x0f08e93b, 0xeaaa71a5), TOBN(0x1bc50407, 0xce4524f0),
+     TOBN(0x6a6a2e6a, 0x921be66b), TOBN(0x37113baa, 0xc27da9f2),
+     TOBN(0xc7b3c636, 0x52e90e29), TOBN(0xc075d178, 0xc8558307),
+     TOBN(0x605f581a, 0x88a45b65), TOBN(0xcb789200, 0x68e58c1c),
+     TOBN(0x14cbed65, 0xbc5bfe1c), TOBN(0xd1af7dc7, 0xf02b11d7),
+     TOBN(0xb8341bc0, 0xcd3a7cc8), TOBN(0x8e9aefe8, 0xa01a77b7),
+     TOBN(0x8eeafe87, 0x5ae2a402), TOBN(0x27a0698f, 0xc11f3859),
+     TOBN(0xc5e49f07, 0xf7af9756), TOBN(0xffd65bcc, 0x9e5b871f),
+     TOBN(0x62a95357, 0x423eed7b), TOBN(0x93cf64d5, 0xb2ec687c),
+     TOBN(0x04b87dd7, 0xbe5da479), TOBN(0xdcceabd7, 0x1a134c0b),
+     TOBN(0xa4875091, 0xc5c6925c), TOBN(0x3bf947df, 0x8e9c098d),
+     TOBN(0xb2617271, 0x11d1323b), TOBN(0x7769247c, 0xe4c6046d),
+     TOBN(0xf9c1aaab, 0xcfa6aac3), TOBN(0xf7f13317, 0x354492e2),
+     TOBN(0x4bd65afd, 0xe91befb6), TOBN(0x3e78cd8c, 0xf25b8f8d),
+     TOBN(0x2adf53ed, 0xe60ff4d9), TOBN(0x81ec3853, 0x3d288d4c),
+     TOBN(0xda852a71, 0xee3bf44a), TOBN(0x39b4ef6c, 0xd7b5c6da),
+     TOBN(0x472e6996, 0x44f4e720), TOBN(0xbbd19d38, 0x9191614b),
+     TOBN(0xa2bcc2ec, 0x30c0e99d), TOBN(0x29318d7b, 0x57ba0582),
+     TOBN(0x322faf40, 0xd315963a), TOBN(0x49ba5570, 0x0c0619d1),
+     TOBN(0xc28c1f81, 0xe5dcd066), TOBN(0x64d1268d, 0xff9e3493),
+     TOBN(0xab0db38e, 0xbdf8992c), TOBN(0xe3790c26, 0x320cce30),
+     TOBN(0x59b408a0, 0x26e3e4b0), TOBN(0xe9e5fe29, 0x6ab8504e),
+     TOBN(0x45c827bd, 0x83c9eaf3), TOBN(0xc298e236, 0x89518edb),
+     TOBN(0xb79a8b15, 0x8d3ab381), TOBN(0x6bb951e8, 0xdb0bb7c0),
+     TOBN(0x5ebd3854, 0xbe4b3353), TOBN(0x107ba27d, 0x2eb3b0fe),
+     TOBN(0x9d01654d, 0x46786cb4), TOBN(0xf46d8352, 0xcf3a1aa2),
+     TOBN(0xa8f669a0, 0xa1662f72), TOBN(0xc979209f, 0x68a1d3e1),
+     TOBN(0xc64975fa, 0x65471473), TOBN(0x1f8eec02, 0xff1f2aad),
+     TOBN(0x1b520fcc, 0x8d0dd401), TOBN(0xcd732092, 0x15e14346),
+     TOBN(0x616478d8, 0x8f878a76), TOBN(0x3579d49c, 0x7423e0f5),
+     TOBN(0x119f6d6e, 0x1b2af15f), TOBN(0xbbe33d81, 0xb08c2c8c),
+     TOBN(0x051d99c9, 0x8534a355), TOBN(0xe3f3ddd3, 0x458b764b),
+     TOBN(0xbd7e51aa, 0xbc8c03bd), TOBN(0xcd7abf4a, 0xe8d42e38),
+     TOBN(0xf0d97428, 0x3160e63f), TOBN(0x258bba07, 0x34d13871),
+     TOBN(0x4fedb647, 0x3dcb885e), TOBN(0x009fca27, 0x50f0a645),
+     TOBN(0x3f06c146, 0x99775c4e), TOBN(0xb10a4ed3, 0xf66e7d05),
+     TOBN(0x9300e3ca, 0x3a3ab903), TOBN(0x0a5610e0, 0xde3c3e1f),
+     TOBN(0xe2827312, 0x1af56fb7), TOBN(0x7e2a2365, 0xd75d9a9c),
+     TOBN(0x9c3bb05a, 0xf11f8963), TOBN(0xdf94cac7, 0x30c80488),
+     TOBN(0xaff1682f, 0x2d1143f5), TOBN(0x5837e83a, 0xb4d6ed7f),
+     TOBN(0xf3e179be, 0xb4bce662), TOBN(0xfa8d7862, 0x8caa5fbb),
+     TOBN(0xbdde016f, 0x59ea54c1), TOBN(0xc488c829, 0x3c1ac962),
+     TOBN(0xabe8b367, 0x14b46863), TOBN(0xbcfde363, 0x82897d1a),
+     TOBN(0x87ddf0ec, 0x8c152354), TOBN(0xdec85db7, 0x7a953398),
+     TOBN(0x927a8b10, 0x0b57108f), TOBN(0xb38b732f, 0x525f78f2),
+     TOBN(0x7e696084, 0xeb306d56), TOBN(0x9befefef, 0x50269227),
+     TOBN(0xfa86e376, 0xcaddfa11), TOBN(0xd50a08da, 0x404be227),
+     TOBN(0xb7408e33, 0x03bb523c), TOBN(0x6d21aa4a, 0xc093aaf1),
+     TOBN(0x52aae4c9, 0xa85d6fcf), TOBN(0xf5d057c9, 0xb726afa9),
+     TOBN(0x7979bb5c, 0xf92ca5b2), TOBN(0x4b1f7936, 0xc4e3e4f3),
+     TOBN(0x2c534200, 0x071ec517), TOBN(0x47b52ffe, 0x67d3f86a),
+     TOBN(0x4a0b581d, 0x84d1c5b2), TOBN(0xfc825a4a, 0x0dfa90cb),
+     TOBN(0x2df2ec98, 0x11c72996), TOBN(0x82077a6e, 0x7dde922e),
+     TOBN(0x89acda10, 0x9f28b584), TOBN(0x54578eb8, 0xe49fe66f),
+     TOBN(0x90a5f700, 0x4a1c29d7), TOBN(0x2de4719c, 0xb3b44748),
+     TOBN(0x6944fe14, 0x18d85e6b), TOBN(0x90bd8208, 0xde7b904f),
+     TOBN(0x5811f3b6, 0xa4597137), TOBN(0x7ea43767, 0xd4ab5433),
+     TOBN(0x7ec39109, 0xa204a36f), TOBN(0xa43a4a57, 0xa30fb76e),
+     TOBN(0x4fd514f8, 0xe090f2be), TOBN(0x3918138e, 0xda1c97f8),
+     TOBN(0x2b466ae2, 0x15145a20), TOBN(0x28ccb2ce, 0xfbac86b7),
+     TOBN(0xb891b707, 0x04106b98), TOBN(0xe40a2310, 0x29696a08),
+     TOBN(0x1210fed0, 0x636d9e11), TOBN(0xdaea218d, 0x2043caa1),
+     TOBN(0x10c2ed0f, 0x0aef7dcd), TOBN(0x926be98a, 0xffa5db7b),
+     TOBN(0xe762191c, 0x36abac30), TOBN(0xe21acfaa, 0x8b75b5cb),
+     TOBN(0x4f5e6b9f, 0xd180cc32), TOBN(0x01358309, 0x55deffdd),
+     TOBN(0x1b1ab943, 0x992a66f3), TOBN(0x1ebe0246, 0xceef1a9c),
+     TOBN(0xa24c9e25, 0x7a01dcb9), TOBN(0x3d45c4e3, 0x326505f5),
+     TOBN(0x9b805759, 0xc8544885), TOBN(0xbe9b99ca, 0x7bfcad78),
+     TOBN(0xd1db36e1, 0x2b8fe78e), TOBN(0x37255a2d, 0xd5387bcf),
+     TOBN(0x044b3a3e, 0xa150ad32), TOBN(0xc65bc2a3, 0x6671ae59),
+     TOBN(0x41ce078e, 0x1d52384b), TOBN(0x3115f1b1, 0x9e72c300),
+     TOBN(0x487ff9da, 0xd0a358a0), TOBN(0x4b20c369, 0x9c242aec),
+     TOBN(0x7813a44c, 0x1c7b145f), TOBN(0x87c6bede, 0xd6f2d3ee),
+     TOBN(0x34d2a89b, 0x47d393b1), TOBN(0x1e9f97c6, 0x73f78679),
+     TOBN(0xcb614fe0, 0x2edce91c), TOBN(0x62b96009, 0x7e9a5fa9),
+     TOBN(0x7eb2aeb5, 0x58c34b85), TOBN(0xa256a478, 0xcf5074fc),
+     TOBN(0x73f23a56, 0x98c1de9b), TOBN(0xeffd490e, 0x61ce6535),
+     TOBN(0x2569df2a, 0x4a6c15c8), TOBN(0x91e202a0, 0xfffc97a5),
+     TOBN(0xd83c428e, 0x28dc7a57), TOBN(0x03bc53c7, 0x9fc8dca8),
+     TOBN(0xed394cfa, 0x9b60487b), TOBN(0xa4259f91, 0xb483a686),
+     TOBN(0x11f51779, 0x179a5cca), TOBN(0x00b00ef0, 0x86c1d1c7),
+     TOBN(0x6e596d2a, 0xf1231aed), TOBN(0x6c1a702b, 0xd80eaa89),
+     TOBN(0xd28f8c15, 0xd23f1d64), TOBN(0x93e85bea, 0x6d01728f),
+     TOBN(0xd4288fb5, 0x1c704922), TOBN(0xaadd1968, 0x8c1363c5),
+     TOBN(0x9b5c42d7, 0x52f2cc4e), TOBN(0xf9e4bc96, 0xc298e794),
+     TOBN(0xd604f076, 0xaf0804ac), TOBN(0xa441140a, 0xb3bb2628),
+     TOBN(0x761eabca, 0xd37bf6bd), TOBN(0x7d192922, 0xbe1cf79c),
+     TOBN(0x2365739e, 0x3da7073d), TOBN(0xfb7423ea, 0x8e2c078f),
+     TOBN(0x08f5132e, 0x3adfb6f3), TOBN(0x470a4205, 0x710a26fe),
+     TOBN(0xbe0afeb4, 0x2b6c9b33), TOBN(0x94d9edc8, 0x3cd813bf),
+     TOBN(0xa2c7a7a0, 0x440a1699), TOBN(0xbdc4ea3b, 0x4eaf0c10),
+     TOBN(0x5a5455db, 0x52fdc8d3), TOBN(0x60485f39, 0xb2945868),
+     TOBN(0x54ce9567, 0x00af0abe), TOBN(0x17bff77b, 0xe8d15f54),
+     TOBN(0x0021c531, 0x0e14a7ec), TOBN(0x3efdb22d, 0xdc9c800a),
+     TOBN(0x9a9e2747, 0x4d947ada), TOBN(0x19417bc4, 0xb37fc947),
+     TOBN(0x71ca8da8, 0x8f02c551), TOBN(0x782d5da4, 0x074cebc0),
+     TOBN(0x99094980, 0xc1a43a2d), TOBN(0xe1b02ff0, 0x24890d9b),
+     TOBN(0x4eedaddb, 0x45d82f7c), TOBN(0x7ae170a5, 0x5061c943),
+     TOBN(0xaf8c7ea0, 0x4d47c578), TOBN(0xcad17044, 0xad3a6eae),
+     TOBN(0x51383e61, 0x4f4c9c8b), TOBN(0x78d17182, 0x9182fc81),
+     TOBN(0xbed6f0d4, 0x90d72cb4), TOBN(0x98761291, 0x7bea62f0),
+     TOBN(0x27594570, 0xef3cd3fc), TOBN(0xf4759534, 0x91a8c364),
+     TOBN(0xf5c607c5, 0x2744eb2d), TOBN(0x0d6264eb, 0xd8d8f337),
+     TOBN(0xb54867a6, 0xa8701750), TOBN(0x1387e940, 0x87691191),
+     TOBN(0xc451f178, 0xbd2f75dc), TOBN(0x31a099d3, 0xd1da6080),
+     TOBN(0x0d0fcf97, 0x49f87f03), TOBN(0x0b7585f8, 0x0af6273d),
+     TOBN(0x3619cf2c, 0x1142265d), TOBN(0xf84d3f96, 0x05c559a4),
+     TOBN(0xc3d3c80e, 0xb83f2cb9), TOBN(0xf4ef0b54, 0x8f602141),
+     TOBN(0x3afb343d, 0xb9612928), TOBN(0x7abe5620, 0x8db5c907),
+     TOBN(0xcd692215, 0xcf019b08), TOBN(0x98d70b38, 0x9ae12255),
+     TOBN(0xb459e256, 0x8dfda5f2), TOBN(0x066a445e, 0x8f3f403e),
+     TOBN(0x5663e123, 0x423fbbb6), TOBN(0xcc55ce36, 0x5424d48f),
+     TOBN(0x8bca99b9, 0x3b6d5467), TOBN(0x299ff0ea, 0x316fc956),
+     TOBN(0xd973a8d8, 0xa0ceb256), TOBN(0x443ecdb9, 0x6d9956b9),
+     TOBN(0x8c16a75d, 0x2f64f912), TOBN(0x89e490c2, 0xbbf7ab50),
+     TOBN(0x4bd00db0, 0xb8dbf031), TOBN(0x866e0bbe, 0x7d2cb92d),
+     TOBN(0xad36406e, 0x1dd3db2c), TOBN(0x969dc881, 0xe4e3f194),
+     TOBN(0xcb3ac9e4, 0x2a115bc8), TOBN(0xb45efd5d, 0xe0a5ab75),
+     TOBN(0x1709c293, 0x55377d5c), TOBN(0x06d11ba4, 0xde6bc25d),
+     TOBN(0x84a09347, 0xccf2d10b), TOBN(0x571cd4d9, 0x08ee5aef),
+     TOBN(0x1379ac02, 0xa450dd82), TOBN(0x5b7f02f5, 0xae404542),
+     TOBN(0x17366e7f, 0x2a7df4ce), TOBN(0x5bb3560c, 0x9830ebec),
+     TOBN(0x5c582580, 0x7c254726), TOBN(0xea13f8fd, 0x70ab7b3d),
+     TOBN(0x868c0f8d, 0x314e2a25), TOBN(0x4b3dad3a, 0x0be90b12),
+     TOBN(0x09970da4, 0x32aaffcf), TOBN(0xe711e9cf, 0x8a6d894d),
+     TOBN(0x511521af, 0x0a80d07a), TOBN(0xe3814716, 0x8a2a2851),
+     TOBN(0xde76d41b, 0x1de9183e), TOBN(0x8a9fc79a, 0xaac779e5),
+     TOBN(0xd7d1f235, 0x26879f8b), TOBN(0xcc849c85, 0xe37d5f9f),
+     TOBN(0x26b5488a, 0x6b9cd82f), TOBN(0x1b068e8d, 0x91099141),
+     TOBN(0x040dc00f, 0x35ee636f), TOBN(0xab40f94b, 0xd84a9cbb),
+     TOBN(0x2e4cf65c, 0xdb303776), TOBN(0x42eaa12e, 0x78e8affb),
+     TOBN(0x7835e4e9, 0x876f8f38), TOBN(0xcd421d77, 0x090ca6b6),
+     TOBN(0x71a1d12d, 0xad0604f7), TOBN(0x51c2d158, 0x1a22e872),
+     TOBN(0xfe7dfcc8, 0x429e45e9), TOBN(0x20028f5c, 0x48224b6f),
+     TOBN(0xf7afed37, 0x50abf907), TOBN(0x92183692, 0xc4ce1a69),
+     TOBN(0x0b93365c, 0x2d128add), TOBN(0x883f43c3, 0x13200221),
+     TOBN(0x9d3b5a53, 0x4d309b2d), TOBN(0x60f0db16, 0xcf91a023),
+     TOBN(0x20f0ebbd, 0x5b0e47be), TOBN(0xcc20dde8, 0x317d8b4b),
+     TOBN(0xab033b48, 0x5303dd7c), TOBN(0x6703eac7, 0x7a9c1974),
+     TOBN(0x92f0b738, 0x351c8f26), TOBN(0xadd39ac8, 0x08569159),
+     TOBN(0x80866e5e, 0x61098dd5), TOBN(0x7d0c1c6f, 0xcae578f6),
+     TOBN(0x13d89cee, 0x975f59e4), TOBN(0x86006ed4, 0x0092de2c),
+     TOBN(0xda825b0a, 0x819adda4), TOBN(0x74fefb46, 0xde710934),
+     TOBN(0x7c2ec289, 0xd3dc8683), TOBN(0x25898cd8, 0x690e5d08),
+     TOBN(0x9bed0f32, 0xbcc67531), TOBN(0x356ba80c, 0xac762453),
+     TOBN(0xd3224c57, 0x7680da5e), TOBN(0xaae2597b, 0x3399d679),
+     TOBN(0xb2a2a1e5, 0x68df6e74), TOBN(0x49d23e8c, 0x2301b373),
+     TOBN(0xcb89b484, 0x170dd677), TOBN(0x36b1d3d1, 0x6b3ee110),
+     TOBN(0xe50ada4f, 0x0d7b51b4), TOBN(0xa2f4fb57, 0xfd9afdbc),
+     TOBN(0xb1b9b81d, 0xaa6dd8e8), TOBN(0x616056a0, 0x0be328aa),
+     TOBN(0x8f6dd943, 0xe12b07c8), TOBN(0x4bb551c6, 0x325abaf6),
+     TOBN(0xa5460380, 0x68fbed5f), TOBN(0xa65d059f, 0x87ed0d37),
+     TOBN(0xff60beda, 0x208aa8cc), TOBN(0xc91ff11b, 0x33d2d65e),
+     TOBN(0x078c4e5e, 0xf65f65d2), TOBN(0xa92ed905, 0xf347dccf),
+     TOBN(0x261ad25d, 0xf59e3be9), TOBN(0x95903d91, 0x3b69facc),
+     TOBN(0xcf0a2f94, 0xe789d854), TOBN(0x9d39cd51, 0x10fbf531),
+     TOBN(0x980ed5d4, 0x6de44e3c), TOBN(0xaedbae37, 0x78425caa),
+     TOBN(0x35804bc1, 0x7bd278b8), TOBN(0xf4bee96a, 0x6a2d7bee),
+     TOBN(0xc6c553a6, 0xa605671c), TOBN(0x182c9238, 0x86f010d2),
+     TOBN(0x94343b7a, 0x9cd6f37a), TOBN(0xa71e3853, 0x237190a9),
+     TOBN(0xfcbebde7, 0xa8a28451), TOBN(0xfa928367, 0xd711d2be),
+     TOBN(0xba8fd2ea, 0xc3668951), TOBN(0x00fad1ed, 0x2d241329),
+     TOBN(0x61b82e19, 0x5dbdffd1), TOBN(0x0e5e5782, 0x5a181dfe),
+     TOBN(0x1c1bf593, 0xc60f1799), TOBN(0x388d6950, 0x64ef800f),
+     TOBN(0xf78ef00f, 0xce927a87), TOBN(0x2a010419, 0x6abfff9f),
+     TOBN(0x13a7b08e, 0xb0b7ffe2), TOBN(0x4619da3e, 0x6da4cc8f),
+     TOBN(0x8ac19190, 0x7937e0bd), TOBN(0xf97d3fcb, 0x1af4f84c),
+     TOBN(0xaea2abd0, 0x8ac425a1), TOBN(0xc619c17d, 0x4a02e136),
+     TOBN(0xf09a57d3, 0x1b2c4acb), TOBN(0xc6fce6fc, 0x87b4eb40),
+     TOBN(0xa161bb70, 0xb21b02f7), TOBN(0x075301fb, 0x95bcb925),
+     TOBN(0x1d408003, 0xe1b440ce), TOBN(0xb42a47af, 0x606b3142),
+     TOBN(0xd4ad09c7, 0x1c832c35), TOBN(0x5bebe913, 0x0e17fb8f),
+     TOBN(0xbf8efbcd, 0x8b45b250), TOBN(0xbef3cafe, 0xe5ca21e4),
+     TOBN(0x08a18be7, 0x688076f1), TOBN(0xabbb3fc5, 0x0c3a2648),
+     TOBN(0xa77086e8, 0xfb54720e), TOBN(0x84277757, 0x19c29e8e),
+     TOBN(0x551768ca, 0x5b95b36d), TOBN(0x8850a9b0, 0xc7df6d3f),
+     TOBN(0xe5a2737f, 0x5008c00a), TOBN(0x9a577c0d, 0xad076e3c),
+     TOBN(0xbe7c611c, 0x2afa6a8a), TOBN(0x5dd9142a, 0x04259dac),
+     TOBN(0xd14253bb, 0x422bf3d1), TOBN(0x8c9dc4c6, 0x6805c78b),
+     TOBN(0xb9837258, 0xd430488c), TOBN(0xf9fc178b, 0x7abc184b),
+     TOBN(0x035d3079, 0x0c5e6a11), TOBN(0x20cbe540, 0xfbc2182b),
+     TOBN(0x849994e2, 0x9d76812f), TOBN(0x166a9279, 0xf7a85553),
+     TOBN(0x15ff0643, 0x19d70aff), TOBN(0x3c58e0b0, 0x4bc6a829),
+     TOBN(0x3809904b, 0x84df75ff), TOBN(0x454c63fd, 0x67a7c214),
+     TOBN(0x79e0ffde, 0x2d873c09), TOBN(0x620a3293, 0xcef301bf),
+     TOBN(0x8f38c8e8, 0x237c2bdf), TOBN(0x61cf96de, 0x13203c2c),
+     TOBN(0xdff401d6, 0xd0bef848), TOBN(0x3c8ed7ce, 0xee4bcbb6),
+     TOBN(0x3e128e2d, 0x07ff8f9a), TOBN(0x0653c0b2, 0xad7e8d5e),
+     TOBN(0x7bb30bb5, 0xb1930408), TOBN(0x91d18705, 0x4c158386),
+     TOBN(0xc4cf843c, 0x80c21fb4), TOBN(0x97a72d75, 0x8a04133a),
+     TOBN(0x6b7c49f3, 0x4218755a), TOBN(0xc1a5a447, 0x68a40f68),
+     TOBN(0x0ab9650e, 0x15ca3037), TOBN(0x16b1fa71, 0xac06feb0),
+     TOBN(0x50179660, 0x0faa3dca), TOBN(0x368b2d89, 0x1c1aaeae),
+     TOBN(0xf6fa652a, 0xb46f0310), TOBN(0x86a4d627, 0x79fcbc59),
+     TOBN(0x78169b8e, 0x6106a132), TOBN(0x40a741eb, 0x9e387d16),
+     TOBN(0x14a45174, 0x80eed542), TOBN(0xadd64561, 0x3362ef7f),
+     TOBN(0x39228bfc, 0xc5dd0396), TOBN(0xe9fdf903, 0xea0c538b),
+     TOBN(0x6bfd91ec, 0x74d235de), TOBN(0x96ec2378, 0x24aa0a47),
+     TOBN(0xf5699241, 0xaf8d6168), TOBN(0x0a7b9be3, 0xc548a60b)},
+    {TOBN(0xe5255c30, 0x2ade9556), TOBN(0xe328af1b, 0x75ba2e9b),
+     TOBN(0x9d3391ef, 0x41ce9e47), TOBN(0xb74cd668, 0xfb0ffcc9),
+     TOBN(0xc67103e4, 0xe3226acf), TOBN(0xa65ad22c, 0xd2959e42),
+     TOBN(0x3aaa8406, 0x99d490fc), TOBN(0x3e26a1c2, 0x9ecc6356),
+     TOBN(0x71c975de, 0x4e92defc), TOBN(0x81aeb173, 0xd0089883),
+     TOBN(0x8a30ce4a, 0x2ec09190), TOBN(0x426e7838, 0x69a36d64),
+     TOBN(0x5899a0b6, 0x309bd2d7), TOBN(0x3b1c24af, 0x3cc1a4af),
+     TOBN(0xb2aa8142, 0x345163b3), TOBN(0xd2ad9a69, 0x2c78c86d),
+     TOBN(0xde59fe5d, 0x8e7a4174), TOBN(0xaedff2d2, 0xab3b0f3d),
+     TOBN(0x4688e9e0, 0x1f053470), TOBN(0x29ff3fb1, 0x97c95c7c),
+     TOBN(0xffb930cc, 0x85e6a8df), TOBN(0xaa4d3175, 0x623b6068),
+     TOBN(0x682101dd, 0xf9716623), TOBN(0xa3bc9f5f, 0x402db696),
+     TOBN(0xf67233c6, 0xba4e4651), TOBN(0x8cf95660, 0x0714d4ac),
+     TOBN(0xd70decc3, 0x71f1f8da), TOBN(0xb674732a, 0x7078370e),
+     TOBN(0x4270416d, 0x4ccc773b), TOBN(0xc848ff35, 0xde87951e),
+     TOBN(0xa61506a8, 0x493dfb56), TOBN(0xd8371ea9, 0x767eb110),
+     TOBN(0xb468c382, 0x9e6b1d70), TOBN(0x1a901978, 0x4cd025fb),
+     TOBN(0x4bf50c7e, 0x5e6879e8), TOBN(0x6b862c0f, 0x71cf7119),
+     TOBN(0x6a53ce89, 0x06240e95), TOBN(0x3ddfaa0a, 0x04107ff4),
+     TOBN(0x317093cc, 0x65532b51), TOBN(0xf1e0f859, 0x0e27b5fc),
+     TOBN(0x96a97a12, 0xfe4674b4), TOBN(0x2a132ae6, 0xf7c97b12),
+     TOBN(0x5afcd087, 0xa5f5ae91), TOBN(0xfd1d3a32, 0xd4805ddb),
+     TOBN(0x0a989dc0, 0xd7b5c8bd), TOBN(0x35d186e4, 0x4429af19),
+     TOBN(0x65623ad2, 0x42935fba), TOBN(0x4e274314, 0xe79b867d),
+     TOBN(0x47d92016, 0x08aaba2a), TOBN(0x12b62343, 0xf3f4c812),
+     TOBN(0xb35bf043, 0x464f4b4c), TOBN(0xdc9391c0, 0xd8e8ba16),
+     TOBN(0xcc0f8c4a, 0x5d460c0d), TOBN(0x04ce64bf, 0xe20fc6ad),
+     TOBN(0xd0289df5, 0xaa4b7db5), TOBN(0xe0ea15c5, 0xe5299815),
+     TOBN(0xc066ee2f, 0xda3adfe0), TOBN(0xce6a9bdc, 0x0c964e7d),
+     TOBN(0x04a0115b, 0x0c859476), TOBN(0xb5e02dc9, 0x9c95699c),
+     TOBN(0xf8301f62, 0x11377eb9), TOBN(0x57b245a2, 0x172bca2e),
+     TOBN(0xa7d9b470, 0x7b47cf1f), TOBN(0x1b469bab, 0x1774b1c1),
+     TOBN(0xbb9ec3e9, 0xda2dce70), TOBN(0x02d5353e, 0xd29bcdda),
+     TOBN(0xc193244a, 0xb215233c), TOBN(0xb8d5727f, 0xd27a4e2a),
+     TOBN(0x79e56194, 0xb6c5b114), TOBN(0xe2c20e71, 0x5ce727f0),
+     TOBN(0xc92f34a5, 0x236cbfea), TOBN(0xcc47dfd1, 0x56a02b8f),
+     TOBN(0x5cdbda39, 0xe983ba13), TOBN(0x20f3de57, 0x6e96c8b2),
+     TOBN(0x2ff05aa7, 0x66b76faa), TOBN(0xa876bc62, 0xd7f84b47),
+     TOBN(0x962ef8a9, 0x0d677d1f), TOBN(0xabc7bb1e, 0x801d3001),
+     TOBN(0xdb5f0b1a, 0x7d13a23f), TOBN(0x2664f3ab, 0x20b819e4),
+     TOBN(0x96be66c5, 0xdc45375a), TOBN(0x780ee062, 0x4a6c24e8),
+     TOBN(0xc6fbfd1a, 0x013a13ee), TOBN(0x6ce1496c, 0x21fc4f9c),
+     TOBN(0x03130c09, 0x81f272c5), TOBN(0x06e59457, 0xa26609cd),
+     TOBN(0xf4c5e564, 0xee5363b4), TOBN(0x1cd19a11, 0x7df0775d),
+     TOBN(0xcdfcfa67, 0xdfd6586e), TOBN(0x358953e5, 0x1ba23faa),
+     TOBN(0x0f467275, 0xaeec5d6f), TOBN(0xb815967a, 0x5b0e6b2a),
+     TOBN(0xb01bf133, 0x012b89b4), TOBN(0xdd924bbc, 0x6839cc04),
+     TOBN(0xa5cd2180, 0x120dfd73), TOBN(0x1abb11ef, 0x19bf8098),
+     TOBN(0xd56c11ce, 0x6a281d1d), TOBN(0xfb01f455, 0x70daeb19),
+     TOBN(0xbb442a0d, 0x8f29fcc1), TOBN(0x9aa60157, 0xe9b2f829),
+     TOBN(0x1f3f6e61, 0x90ae8113), TOBN(0xc701a185, 0x6c946c0d),
+     TOBN(0xb4b89268, 0x52ba7caa), TOBN(0xd657c679, 0xb0a5c77f),
+     TOBN(0x0f14eb11, 0x0dd26330), TOBN(0xff622296, 0x9b036325),
+     TOBN(0xaf833fb8, 0x186e735a), TOBN(0x7801b02f, 0xc7e710f5),
+     TOBN(0xa0bf821f, 0x5c948f43), TOBN(0x3be31aea, 0x86225c71),
+     TOBN(0xe98f4f7b, 0xe60b1c88), TOBN(0x6306588d, 0x73c5281b),
+     TOBN(0xd6178277, 0x83c9f829), TOBN(0x67b20e6c, 0xc06675f1),
+     TOBN(0x8a63fb89, 0xcb2d5b9d), TOBN(0xcb28128c, 0x038c00fe),
+     TOBN(0x070a5141, 0x8c7c6c6e), TOBN(0xc05e18c3, 0x8789c3b7),
+     TOBN(0x09fd03c2, 0xd5c67731), TOBN(0xc59e2abb, 0xf54010ec),
+     TOBN(0x03977889, 0xf1ef2232), TOBN(0xbe2c82f1, 0x9c7409a5),
+     TOBN(0x35ac44f9, 0x32004e03), TOBN(0x048bb359, 0x856823a3),
+     TOBN(0x2e108d6c, 0xec1cf253), TOBN(0xe98e74d7, 0x703eb1d2),
+     TOBN(0xcaf64f60, 0x570ac34d), TOBN(0xff814e7d, 0x4d7797fa),
+     TOBN(0x93b6abc3, 0x70818472), TOBN(0x0e984be6, 0x888357af),
+     TOBN(0x2a7ca1b0, 0x3fe0c135), TOBN(0x0c6c4a11, 0x94a82d67),
+     TOBN(0x0c90c359, 0xbb83ae74), TOBN(0x49b25e5e, 0x328b8af1),
+     TOBN(0x26a36032, 0x798ff0a6), TOBN(0xbbf89c99, 0x1fc28ca3),
+     TOBN(0x4ce174e2, 0xe679eb71), TOBN(0x17c76176, 0xd1c183bd),
+     TOBN(0x4bf67be8, 0x03a69f58), TOBN(0x937a391c, 0xc0ee530c),
+     TOBN(0x2daa9d90, 0x1f7daaff), TOBN(0xa47e99b2, 0xc54f14d0),
+     TOBN(0x6be357e7, 0xc57feeca), TOBN(0x3753fad2, 0xcfdfd5dd),
+     TOBN(0x74e1457a, 0x48f90174), TOBN(0xb8092642, 0x9b4734da),
+     TOBN(0x291e75ba, 0x5800ea72), TOBN(0x25a21b38, 0xc72c28f7),
+     TOBN(0x2193e0c9, 0x505aa4d2), TOBN(0x2f6829e3, 0xada9d3f8),
+     TOBN(0x66cd5a1d, 0x92900e29), TOBN(0x1360d287, 0x7414dc1d),
+     TOBN(0x5deeb2eb, 0x0d1b96aa), TOBN(0x25783ce3, 0x3e52ccf1),
+     TOBN(0xe4e251f4, 0x29d534ef), TOBN(0x9fe9693d, 0x55797dad),
+     TOBN(0x6a173d69, 0xc6ab9935), TOBN(0x23991318, 0x7721ca8e),
+     TOBN(0x38cbcd30, 0xc393eb26), TOBN(0xe3627ab9, 0x71d95a9e),
+     TOBN(0xdf1218be, 0x7f6fe2d4), TOBN(0x850c8598, 0xfabd8326),
+     TOBN(0x1214d3d7, 0xb0f7cf49), TOBN(0xeaf60d31, 0x1805345b),
+     TOBN(0xc5caf65b, 0xbfee2c5f), TOBN(0x70127979, 0x45e23043),
+     TOBN(0xda36e794, 0x500fbad2), TOBN(0x38fa60b0, 0x4156e3a6),
+     TOBN(0x45934bdd, 0x3cbab88a), TOBN(0x72821e74, 0x1b19dce4),
+     TOBN(0x532f706d, 0x8661e32d), TOBN(0x3dbfc225, 0x73a9930e),
+     TOBN(0x72d1cb2a, 0x3cbeb0f1), TOBN(0x795b0696, 0xe20f5613),
+     TOBN(0x6e3469e8, 0x9fc88717), TOBN(0xf4bf0531, 0x483864d2),
+     TOBN(0xc92e6a8c, 0xfa19ddd9), TOBN(0x7db7e2ee, 0x3528e628),
+     TOBN(0x997a00eb, 0xf321fc88), TOBN(0x7605a2c9, 0xacdf205f),
+     TOBN(0x9fca58cf, 0xea9c3ed0), TOBN(0x833078cb, 0x56ff0e98),
+     TOBN(0x75159b8f, 0x662a1695), TOBN(0x186560b7, 0x1919f51f),
+     TOBN(0xe9b60e57, 0x5ef764b4), TOBN(0x61ad29fc, 0xbe73c698),
+     TOBN(0x18489017, 0xdd2be1ee), TOBN(0xac95e3b6, 0x7febda71),
+     TOBN(0xa6985346, 0x5ac96092), TOBN(0x906265c3, 0xbfc83566),
+     TOBN(0x1692c812, 0x5972fa4a), TOBN(0x4e76f879, 0x00773540),
+     TOBN(0xba9a6268, 0x542b137e), TOBN(0x43a52b90, 0x4c7926e2),
+     TOBN(0x28785bf5, 0xfeae554e), TOBN(0xc023b688, 0x0ab61576),
+     TOBN(0xb3ec8181, 0x10933a55), TOBN(0x75634459, 0x6331678e),
+     TOBN(0xe0dfa141, 0x17c50b5d), TOBN(0x4cbe7fda, 0xe2151f25),
+     TOBN(0x3f3072ac, 0xce81fbaf), TOBN(0xa387bb20, 0x0ff56a32),
+     TOBN(0x2b08a811, 0x99865968), TOBN(0x7279f913, 0x084cb1f2),
+     TOBN(0x78cca6c9, 0xdad70f5a), TOBN(0x72469f6a, 0xff47647d),
+     TOBN(0x2505c7ff, 0xe358b597), TOBN(0x7c5268a8, 0x998ff0dc),
+     TOBN(0x32d70129, 0x99d5b1c1), TOBN(0x72727c15, 0x24a90c34),
+     TOBN(0x57dad21c, 0x715662b1), TOBN(0x76b4b6ec, 0x132f3294),
+     TOBN(0xd03b46b1, 0x267d246e), TOBN(0xc7c848ec, 0x29b47516),
+     TOBN(0x5eab3dbc, 0x1660af51), TOBN(0x818894c4, 0x04c66383),
+     TOBN(0x26a45c3e, 0xa7b82f5c), TOBN(0x494694de, 0xea98adfb),
+     TOBN(0x44a06ec3, 0x134b182c), TOBN(0x5570befa, 0x75b82b41),
+     TOBN(0x819f6808, 0x129f952e), TOBN(0xa6fad25f, 0x914f87c4),
+     TOBN(0x831e5668, 0x7c7be905), TOBN(0x93107f38, 0xe623a5c2),
+     TOBN(0xa9d88469, 0x5e40c5f4), TOBN(0x4314d233, 0xaa5993c5),
+     TOBN(0x5eab88d0, 0x9c19bbc5), TOBN(0x795e1c21, 0xb385d3cd),
+     TOBN(0x532a1871, 0xce163fbe), TOBN(0x727cb126, 0xb867aea4),
+     TOBN(0xfc7047eb, 0xf7f30476), TOBN(0x18031271, 0xfcc4fe35),
+     TOBN(0x4b84fa4a, 0x884a4c6d), TOBN(0x82cb9aee, 0x55c830ab),
+     TOBN(0xd4cfdf04, 0x0cc927cc), TOBN(0x787efdde, 0xa16bef30),
+     TOBN(0xd1fb2dd6, 0x32e3c763), TOBN(0x8739566f, 0x16737272),
+     TOBN(0xf9ae4f46, 0x03a1055a), TOBN(0x199970cd, 0xf9a7472b),
+     TOBN(0xf9893cfb, 0x1d33ac50), TOBN(0x74cf7dd4, 0x1e5ff4e5),
+     TOBN(0x72ec32e5, 0xf7165331), TOBN(0xa082c59a, 0xbb4679cf),
+     TOBN(0x3cd0a467, 0x5c75461a), TOBN(0xd2872d68, 0x40f06206),
+     TOBN(0x08271eef, 0xb5122795), TOBN(0x7006d350, 0x1475e22b),
+     TOBN(0xf7cd1bcc, 0x89e35108), TOBN(0x924efa43, 0x93f1cbaf),
+     TOBN(0xe3716559, 0xf35b13ac), TOBN(0xa0a88e87, 0x60370a1d),
+     TOBN(0x1203be0a, 0x8c286ea3), TOBN(0x97fc5ab6, 0x6ebd50c7),
+     TOBN(0x2b5b3602, 0x74284d08), TOBN(0x3055716f, 0x694a20e0),
+     TOBN(0x793c8a89, 0x193520c0), TOBN(0x356402d0, 0x655f5ff2),
+     TOBN(0x0cf889ee, 0x1af5ddd6), TOBN(0x3eb7eb35, 0xb3f149b2),
+     TOBN(0x5254b57c, 0x68e07e0e), TOBN(0xb1971de2, 0x9c5bbfa7),
+     TOBN(0xcc85a53a, 0x0ad81e7e), TOBN(0xbaaa4d2b, 0xed3cbb10),
+     TOBN(0xbdf9941c, 0x8f3a7eec), TOBN(0x6e1b7dab, 0xa1f26666),
+     TOBN(0xe7a0dfa4, 0x2d79a58f), TOBN(0x25e0ddb5, 0x1f2b9667),
+     TOBN(0x4b3b5105, 0x5fd96351), TOBN(0x12325832, 0x8874abd1),
+     TOBN(0x56e90310, 0x795d91a5), TOBN(0x376a79d2, 0x2c32eec8),
+     TOBN(0xd9dd8817, 0xa8a16445), TOBN(0xd61f6aec, 0x0e00fa92),
+     TOBN(0x594a620d, 0x17d95f07), TOBN(0xa1534fda, 0xf4b15001),
+     TOBN(0xe9402601, 0x0974f4a3), TOBN(0x4c3fc130, 0x8f671f13),
+     TOBN(0x8eaab35a, 0xc5f35bfb), TOBN(0x13b98472, 0x4626baca),
+     TOBN(0xf48703ad, 0xcdee6f8d), TOBN(0xf1ba0309, 0x12d39694),
+     TOBN(0xeb2d4d92, 0x9fcda52c), TOBN(0x984f5111, 0x5507b401),
+     TOBN(0xe3aa26ae, 0xf6bab9ec), TOBN(0x557b5e3f, 0x6b2e077d),
+     TOBN(0x7185ab4f, 0x2f9c5f35), TOBN(0x96f21a33, 0x1680bcbc),
+     TOBN(0x2e7f6e07, 0x2ddb1173), TOBN(0xa704416e, 0x816ffc8d),
+     TOBN(0x55acfaa3, 0x52e26265), TOBN(0x9c244253, 0x8b758c94),
+     TOBN(0x4012e0a6, 0x0479936d), TOBN(0x12749e93, 0x6d8541d8),
+     TOBN(0x374f420d, 0xce56a2a1), TOBN(0x6a8e3614, 0xc79da17f),
+     TOBN(0x3602ad09, 0x157cc9e1), TOBN(0xf3c4a54c, 0x13603196),
+     TOBN(0x354fc6ed, 0x8473ae27), TOBN(0xb4cf4251, 0x651b8003),
+     TOBN(0x456b1b9b, 0x3415b5f0), TOBN(0xe078a858, 0xc4c71507),
+     TOBN(0xf4210409, 0x9a0a11fb), TOBN(0x76de42a0, 0xf930ec45),
+     TOBN(0x82ecd0af, 0xcfa869a1), TOBN(0xa637938a, 0xdccf2e47),
+     TOBN(0x1d2858f2, 0xc041648a), TOBN(0xcf9abfe8, 0xc0dfacd2),
+     TOBN(0x3af77e19, 0xbdddebe1), TOBN(0x15f6b0bb, 0x180b535f),
+     TOBN(0x497de678, 0x549d34c1), TOBN(0x31495c9e, 0x3dba7d6f),
+     TOBN(0x47b9368b, 0x393ab61c), TOBN(0xdb8ee3a8, 0x27441f92),
+     TOBN(0x214a6a5f, 0xfb0b0117), TOBN(0x429e61ad, 0x43759430),
+     TOBN(0x78116e88, 0x77316c0e), TOBN(0x59c82616, 0xa6a29e98),
+     TOBN(0xbfed454f, 0xaaef4619), TOBN(0x673327c4, 0x35926335),
+     TOBN(0xaa66d8c5, 0x18c616a7), TOBN(0xa93946a6, 0x6d28fb98),
+     TOBN(0x4fc30de5, 0x133336dd), TOBN(0x7e000a34, 0x7f0c805e),
+     TOBN(0xa82dcf54, 0xcf7eab23), TOBN(0x679e67a8, 0x8dc24371),
+     TOBN(0x26b2dffc, 0x1af582d8), TOBN(0x4c1d692a, 0xd3fe2155),
+     TOBN(0x2475b110, 0x2d024923), TOBN(0x0cc9245d, 0xc303c1e7),
+     TOBN(0x290b7a77, 0x03667a7a), TOBN(0x2ab8eb6d, 0xd87dbd9c),
+     TOBN(0x7089e481, 0xc098719e), TOBN(0x17dd6d74, 0x12c022c8),
+     TOBN(0x90efa01f, 0x8b7aca14), TOBN(0x8b601fba, 0xf55fbe83),
+     TOBN(0xf800bd76, 0x415aa7a5), TOBN(0x015573d3, 0x3aa74349),
+     TOBN(0xd5143779, 0xaf5ec789), TOBN(0x32330b4b, 0xd76dd2dd),
+     TOBN(0xec6caa4d, 0x82331ef1), TOBN(0x92cc8865, 0x25ad1965),
+     TOBN(0xf8209a40, 0x134370b0), TOBN(0x320a37b9, 0xb883cf95),
+     TOBN(0x94237ba2, 0x5d39731d), TOBN(0x6359d195, 0x8532a968),
+     TOBN(0x8bca94c9, 0xf86b8b75), TOBN(0xdb5c6a9c, 0xde316226),
+     TOBN(0xdf300c59, 0xa2fa0c26), TOBN(0x6dbf6082, 0x48af4357),
+     TOBN(0x25066c6c, 0x06535fc9), TOBN(0xba2e774e, 0xa29b2477),
+     TOBN(0x5157e93d, 0x1931299b), TOBN(0xd6249c10, 0x3a8035a4),
+     TOBN(0xcb18fcf1, 0x81245740), TOBN(0xb4d84c9d, 0xad5ebe1f),
+     TOBN(0x95050bec, 0x8df0d59d), TOBN(0x190a4860, 0xac2a2e0c),
+     TOBN(0x29029e0f, 0xfd1bbb11), TOBN(0x341f73de, 0xb075b432),
+     TOBN(0xa825c3c5, 0x74836028), TOBN(0xec4fd74b, 0x8f55343a),
+     TOBN(0x009bcab5, 0x60a683b3), TOBN(0x29877303, 0xcd3adea6),
+     TOBN(0x9f264bf2, 0x684a33ac), TOBN(0xc8bf19e6, 0x84b3c379),
+     TOBN(0x8ac35fb8, 0xa1215470), TOBN(0x2919d9da, 0x405386d6),
+     TOBN(0xb4e4aa30, 0x19780b2a), TOBN(0x639b8fcb, 0x356ddd4e),
+     TOBN(0x6ed7b10c, 0x9322c245), TOBN(0x84ec0bc6, 0x57f39c76),
+     TOBN(0x6a1be66c, 0x879176fb), TOBN(0x4cab3151, 0xe10e0f77),
+     TOBN(0x01c6321f, 0xe2ae0777), TOBN(0x04d6a04c, 0x65e57ff1),
+     TOBN(0x8c1725ed, 0x142596dc), TOBN(0xd321d49a, 0xb2d413a6),
+     TOBN(0x19c25fc3, 0x2b5e8ae7), TOBN(0xfc32cbeb, 0xbd3c7dc6),
+     TOBN(0xf3ec98b8, 0x57b98ff5), TOBN(0x52e5f1ad, 0xf75b1a00),
+     TOBN(0x16812bb4, 0x8f8ad463), TOBN(0x9d67cb11, 0xa274f0c3),
+     TOBN(0xdec72055, 0x80064047), TOBN(0x3f828c01, 0x4319f87b),
+     TOBN(0xffcad5c3, 0xff4d6c4a), TOBN(0xee6659b2, 0x67a6e030),
+     TOBN(0x9cb5c729, 0x0478715f), TOBN(0xc63fc281, 0x5a1c926e),
+     TOBN(0x1b8788ca, 0xdeb11155), TOBN(0xbe2eebf1, 0x4f0c00b2),
+     TOBN(0x9b72ffd0, 0xa6af09d1), TOBN(0xcbac42bd, 0xa9a459f3),
+     TOBN(0x150806c0, 0xf560dc93), TOBN(0x71c636e4, 0xc57787ee),
+     TOBN(0xe4f3acb8, 0x2a951b0d), TOBN(0x510dc771, 0x3b18d294),
+     TOBN(0xfbb3fb53, 0xb060e782), TOBN(0x0659cadd, 0x0358210e),
+     TOBN(0x23638245, 0xecde1629), TOBN(0xee6e9a65, 0xcc09daa5),
+     TOBN(0xf440bb81, 0xee18f9cf), TOBN(0x99e4d6e8, 0x955200e0),
+     TOBN(0x34555b58, 0x93e69354), TOBN(0xa6080e13, 0xfb29b19b),
+     TOBN(0x3bfa4796, 0x5100ab06), TOBN(0xf5db4b13, 0x22eec8fc),
+     TOBN(0x2c1a229e, 0xe5aaa980), TOBN(0x446cd46b, 0xd29eb83e),
+     TOBN(0xe0c044da, 0x7f5aa015), TOBN(0xa55d5f23, 0xa18f23f7),
+     TOBN(0xd71e58c1, 0xb6b70f51), TOBN(0x77c72d10, 0xb5862c51),
+     TOBN(0x01db731a, 0xfce94ceb), TOBN(0x877703a8, 0x13a47553),
+     TOBN(0x4878b0b1, 0x3b75e6d9), TOBN(0xbe8421f0, 0xfe60f98a),
+     TOBN(0x6312821b, 0xc69d6820), TOBN(0x4c019374, 0x00d2db20),
+     TOBN(0xb1bd5175, 0x2a1d8b74), TOBN(0xa0a24ad2, 0xef7fdad6),
+     TOBN(0xf29fd27d, 0x929fc488), TOBN(0x8e28b4ed, 0x162a02de),
+     TOBN(0x434cbdb3, 0xc166afcf), TOBN(0x7b79e808, 0xbf663e65),
+     TOBN(0xd445f1b0, 0xa3c3b159), TOBN(0xdf9f92b7, 0xb35b2be9),
+     TOBN(0x815b57f3, 0x788a9bbc), TOBN(0x9e03e357, 0xabbba2e0),
+     TOBN(0x3fc574d5, 0x91a658d8), TOBN(0x83b35d8a, 0xadf4e250),
+     TOBN(0xa0e15175, 0xacd1e4f0), TOBN(0xeca899a4, 0x868b4e04),
+     TOBN(0x713b4e9e, 0x782b7ee7), TOBN(0xed177e1e, 0xb7d58c1a),
+     TOBN(0x4778df76, 0xac8364b2), TOBN(0x6898fb31, 0x2e8f7ef7),
+     TOBN(0xfccf4c53, 0xa03975b0), TOBN(0x0f908d14, 0x8597436f),
+     TOBN(0xbeaf1a16, 0x96671c53), TOBN(0x9be64329, 0x6bc4cbbf),
+     TOBN(0xc8f66f63, 0x80017bf3), TOBN(0x92d700f2, 0x8836ff35),
+     TOBN(0x9ddd7a81, 0x13a4daf1), TOBN(0xb3c42723, 0x9b72664b),
+     TOBN(0x3d96f79a, 0x81babf43), TOBN(0xa46c9c0c, 0x7ce5830d),
+     TOBN(0x54dfec97, 0xf5999a71), TOBN(0xdb5be461, 0xe586a578),
+     TOBN(0xf9bc3f04, 0xcfb4e7ad), TOBN(0x6e5448a9, 0xb11f07aa),
+     TOBN(0x29ef7791, 0x70132d5a), TOBN(0x4fe486c3, 0x28ba851a),
+     TOBN(0x6743fecd, 0xb62f7f8a), TOBN(0xeb264387, 0x44d24d01),
+     TOBN(0xf93c05bc, 0x72ebb976), TOBN(0xe65b30c0, 0xaaae099e),
+     TOBN(0x4194721a, 0xc8427104), TOBN(0x3af3487f, 0x3025853e),
+     TOBN(0xb33a2893, 0xdbf48435), TOBN(0x2c5ac639, 0x2d79334e),
+     TOBN(0x8fc199f8, 0xb16b05a6), TOBN(0xc145358e, 0x7661a77b),
+     TOBN(0x15b580b6, 0x1841f719), TOBN(0x24f5fadb, 0xd7045528),
+     TOBN(0xe443c257, 0x98df2c22), TOBN(0x48acf5a7, 0xd7eed58b),
+     TOBN(0xe24e6571, 0xedeb9e4b), TOBN(0xcd047b81, 0x562533fd),
+     TOBN(0x618ddd86, 0xd1566e36), TOBN(0x09a77b70, 0xdba1eced),
+     TOBN(0x0e9de410, 0x6968ddb9), TOBN(0x10f0f429, 0x12985b32),
+     TOBN(0xbe21b10f, 0x8ca7d2fa), TOBN(0x0844d8e8, 0xc610ae2b),
+     TOBN(0x58a08694, 0xd57107d5), TOBN(0x45f44bd5, 0xc34441f3),
+     TOBN(0xe8b3b3df, 0x79a54186), TOBN(0x6496d668, 0xb8b5f26b),
+     TOBN(0xd69cefb8, 0x192503be), TOBN(0xb692128d, 0x40f928fc),
+     TOBN(0x13b11dfd, 0xa7ed8c47), TOBN(0x90bd279f, 0x5a196756),
+     TOBN(0x78f2e8c6, 0x17ff33eb), TOBN(0xa7b233d4, 0xaaf6c182),
+     TOBN(0x63d62503, 0x76a31f46), TOBN(0x53143dc3, 0x1449dc97),
+     TOBN(0x5bb86802, 0x94922922), TOBN(0x2f45a7dc, 0x89181334),
+     TOBN(0xf7c466d5, 0x1ec5cce4), TOBN(0x52d15eed, 0xbb3bd5f3),
+     TOBN(0x150bd5f6, 0xe6eacf86), TOBN(0x7fecaf3a, 0x0ba66988),
+     TOBN(0xcdd7fadb, 0x11f6f528), TOBN(0x60f64c68, 0x55042faf),
+     TOBN(0x1615919d, 0x961ddf76), TOBN(0xdba095cb, 0x53f2f514),
+     TOBN(0xf04960ba, 0x1e6c076c), TOBN(0xe5276722, 0x4c9f17d5),
+     TOBN(0x93ff80f9, 0x61c186a9), TOBN(0xd17378b0, 0x3c58ab92),
+     TOBN(0xc67f9ae1, 0x769492e8), TOBN(0xaccfc868, 0x0c3d023b),
+     TOBN(0x7d67a63d, 0x5b99708d), TOBN(0xfb29bef7, 0x4b80189a),
+     TOBN(0x3cb7eeaa, 0x241c402e), TOBN(0x328cb6de, 0x2c5c2767),
+     TOBN(0x0d24a7b4, 0x9cec231d), TOBN(0x725955fc, 0x0e2e6a7f),
+     TOBN(0xa2040cfa, 0xb7f17b13), TOBN(0x215eff8d, 0xa25c71cf)},
+    {TOBN(0xe4d9cab1, 0xc0d41a94), TOBN(0xc38b202a, 0x9e60f7d4),
+     TOBN(0x2bbf6b17, 0x9336116c), TOBN(0x2f9aa877, 0x2e068f13),
+     TOBN(0xf8820627, 0xa4bac9fd), TOBN(0x2209cb9e, 0x8a593cb4),
+     TOBN(0xaa78ec63, 0xc7417931), TOBN(0x42d21251, 0x7cfccfbf),
+     TOBN(0x40cee5ae, 0x3e611940), TOBN(0x4e2d9ea9, 0x0aa090ec),
+     TOBN(0x73d167ef, 0x1b926e42), TOBN(0x7fff36df, 0x5d5112a3),
+     TOBN(0x25587745, 0xcaffa3fb), TOBN(0x224f7f4e, 0xc5a83504),
+     TOBN(0x5ceff018, 0x3b47bf2a), TOBN(0xed9bfa73, 0xecfab5c6),
+     TOBN(0xf3d570b8, 0xd9b429c9), TOBN(0x69460116, 0xc5ad81cb),
+     TOBN(0x30833a08, 0x2f6825bd), TOBN(0xa297122a, 0x7c99f36a),
+     TOBN(0x6fc9b848, 0x05c3abdf), TOBN(0xefe95298, 0x5f2e24b2),
+     TOBN(0xf045275a, 0x8915d922), TOBN(0x79146aab, 0x298a9726),
+     TOBN(0x0c7d5905, 0x4f831d0b), TOBN(0xfaaaa26c, 0x2d47d4fe),
+     TOBN(0x5ac28599, 0x85042e12), TOBN(0x7eda370b, 0x7796977d),
+     TOBN(0x9f0bd71d, 0x95c0be63), TOBN(0x7c4601bc, 0x8e821005),
+     TOBN(0xf1ecbc60, 0x4c2ffae9), TOBN(0x7e3efc57, 0x9b688173),
+     TOBN(0x868c672b, 0xf4ea7641), TOBN(0x4fa90a82, 0xd94243dc),
+     TOBN(0xbd82913e, 0xf5eab489), TOBN(0xceebc159, 0xe966b39d),
+     TOBN(0x31fe4f5f, 0x35c51e2b), TOBN(0x2fea6ab1, 0xc79c1725),
+     TOBN(0x5856cd85, 0x83afad40), TOBN(0x7f960988, 0x4ca89b88),
+     TOBN(0x9d237c2d, 0x1ed8fed0), TOBN(0x69b4ec80, 0x4e0c6f10),
+     TOBN(0x11f83283, 0xe4648395), TOBN(0x6f4636a7, 0x306e152a),
+     TOBN(0xf70fd23a, 0x804539b3), TOBN(0x4db0903a, 0xb3cdb981),
+     TOBN(0xe506ae6f, 0x6691eb18), TOBN(0xaa69c7aa, 0x1d8e9d9d),
+     TOBN(0x540af950, 0x3e4e2088), TOBN(0x8fab01d5, 0x95f04e57),
+     TOBN(0x51bf909a, 0xa8c51a67), TOBN(0x01299f5e, 0xfd19beb7),
+     TOBN(0xdf703400, 0xb8f15aeb), TOBN(0x19c70987, 0x2d890394),
+     TOBN(0xf5fcc675, 0x203d2d99), TOBN(0xabbf3f21, 0xc3d4ddea),
+     TOBN(0x8348ca15, 0x587feffa), TOBN(0x585d0740, 0x7d69e4ad),
+     TOBN(0x6fbe5619, 0x885a0745), TOBN(0x04ee9eba, 0xb10b24dd),
+     TOBN(0x5c27075c, 0x0f4c12d7), TOBN(0xacf4acdc, 0x3c51c605),
+     TOBN(0x782fa52b, 0xfce336d0), TOBN(0x6e1d078f, 0x483621d2),
+     TOBN(0xa2253bfb, 0xd4dc3277), TOBN(0x3a014307, 0x4691bc12),
+     TOBN(0x415aa5b2, 0xebdef616), TOBN(0x1008a44a, 0x16fe065b),
+     TOBN(0x4004a90a, 0x16dfa94d), TOBN(0x0e24f541, 0x8464785b),
+     TOBN(0xd2715c89, 0x88d30ea8), TOBN(0xaf81a9ff, 0x1f05a312),
+     TOBN(0x958da470, 0x3e8d5eef), TOBN(0x09561898, 0xd3c80414),
+     TOBN(0xba6b731c, 0x8bb74691), TOBN(0x6b7355cd, 0x577f2ef9),
+     TOBN(0xd1f416ed, 0xb8a98efa), TOBN(0xd4a1293a, 0x11590271),
+     TOBN(0x2c4d5934, 0x4658e9eb), TOBN(0x51803651, 0xd1f15d39),
+     TOBN(0x9b9f0c05, 0x3c95fffe), TOBN(0x8f021451, 0x31acd6ca),
+     TOBN(0x5fee2961, 0xf9dba549), TOBN(0x05217975, 0x17ea0456),
+     TOBN(0xc0591906, 0xd13a6a4a), TOBN(0xa7f5ed02, 0x90daf370),
+     TOBN(0x1f8b7158, 0xfc4c304d), TOBN(0x77016c29, 0x1b7f0246),
+     TOBN(0xc27d1847, 0x2ea265d2), TOBN(0xec0789c6, 0x2862781e),
+     TOBN(0x0a79ac1f, 0x5d86a60e), TOBN(0xe325b563, 0x130670a5),
+     TOBN(0xf4794460, 0x6d33bfee), TOBN(0x126e703e, 0xec25bb10),
+     TOBN(0xeae22fd3, 0xa7bf902f), TOBN(0x8b2fb282, 0x28eef62e),
+     TOBN(0xb68de35b, 0x059138b4), TOBN(0xfc44bf56, 0xd46e68e3),
+     TOBN(0x71567daa, 0xff11f76a), TOBN(0x9110e849, 0x6b17cd2a),
+     TOBN(0x7c4027e3, 0x69573b93), TOBN(0x84ee945a, 0x1eb9bf01),
+     TOBN(0xa3fadc6d, 0x28c26cdb), TOBN(0x7037a74d, 0x575dfc1b),
+     TOBN(0x58c96a91, 0x9b2223dd), TOBN(0x912fc795, 0x51461b94),
+     TOBN(0xc18ced63, 0x2df3329a), TOBN(0x79d6f75f, 0x88a002d0),
+     TOBN(0x73d7a089, 0xf44d3d84), TOBN(0x98c78aa7, 0x8c058073),
+     TOBN(0x0ab8b3c7, 0x333ae8ff), TOBN(0xf5a8f5ec, 0xebd4e536),
+     TOBN(0x2c7df9fd, 0x83a5f52b), TOBN(0x314fc7c3, 0xcc062097),
+     TOBN(0x6c3195f8, 0xc5a3113c), TOBN(0xf130cef9, 0x2c25a629),
+     TOBN(0x10c8cc5b, 0x70c8dd70), TOBN(0xecb7a35f, 0x01cd40d3),
+     TOBN(0xfbee538f, 0x6fe21c93), TOBN(0x57ec1959, 0x2ba12ee8),
+     TOBN(0x74387a1b, 0xb2b806a8), TOBN(0x14efa300, 0xbad5d0f4),
+     TOBN(0xee7e4421, 0x23a0e9e4), TOBN(0x504ae428, 0x3b6abdec),
+     TOBN(0xb8c06fcb, 0x927b1aac), TOBN(0x55e1c85c, 0x323b71d3),
+     TOBN(0xf47e180f, 0x48d6dae1), TOBN(0x6d80dd63, 0xa84cb0b8),
+     TOBN(0xf8e07d53, 0xd75d7785), TOBN(0x3edf19b7, 0x37614325),
+     TOBN(0xf03709b0, 0x357946ed), TOBN(0x567d8c0d, 0xd12105e7),
+     TOBN(0xecf6abc0, 0xa9383b49), TOBN(0xfe9c760b, 0xcab329a7),
+     TOBN(0x425e62fa, 0x43928852), TOBN(0x27945ae0, 0x6194b51f),
+     TOBN(0x756f0f54, 0x3ee4f7cd), TOBN(0x4337ac7b, 0x26e4c865),
+     TOBN(0xf94596c3, 0x35b9c3ae), TOBN(0x066fd3da, 0x4d6aa5d2),
+     TOBN(0xce1a5b7e, 0x43c8d94c), TOBN(0xaed496a8, 0x614c0fc2),
+     TOBN(0x355e16f5, 0x2a6d5481), TOBN(0x8f934639, 0xa09d3afe),
+     TOBN(0xd170daef, 0x2bf2a099), TOBN(0x3920d87a, 0xae6ee507),
+     TOBN(0xbdac1c8e, 0x248158e3), TOBN(0x99033a9a, 0x05c54e69),
+     TOBN(0x4513bdf0, 0x41872197), TOBN(0x15634020, 0xd3f0f889),
+     TOBN(0x76c1855a, 0x05d42aa8), TOBN(0x23079179, 0xe8ba47cc),
+     TOBN(0xf80b787b, 0x728429e6), TOBN(0x896b6ea5, 0x3dd8c4f8),
+     TOBN(0x711eef39, 0xc7d9fe06), TOBN(0xfff28d03, 0xebced829),
+     TOBN(0x5d7823b8, 0x4ad40c88), TOBN(0x40a5a166, 0x3b112bd4),
+     TOBN(0x84230bfa, 0x63bce926), TOBN(0x39d2e6bd, 0xbe17e7cd),
+     TOBN(0xa772e242, 0xef03ee6c), TOBN(0x888bc969, 0xfa009e67),
+     TOBN(0x0f06ee83, 0x4893e1f0), TOBN(0xf28f0d3c, 0x6b89e124),
+     TOBN(0xb3e70ef8, 0x71f5cbc5), TOBN(0xff0f7e62, 0x6cad191e),
+     TOBN(0x990697be, 0xf028d276), TOBN(0x144c101c, 0x4ad8f830),
+     TOBN(0xbcaafb45, 0x3556d74f), TOBN(0xbc216224, 0xeb4c7ea0),
+     TOBN(0x73ad1043, 0x234a62c8), TOBN(0xa644eb6a, 0x2d95ff46),
+     TOBN(0xd545b60a, 0x0a3373f8), TOBN(0xf7a0572c, 0xd4edaa10),
+     TOBN(0xa7177049, 0xa97a85b4), TOBN(0x529dbadd, 0x7d3ec769),
+     TOBN(0xc45610f6, 0x7822dd37), TOBN(0xfad07fab, 0x98258666),
+     TOBN(0xac27001f, 0x87259c1b), TOBN(0xa9bdc6a9, 0x1b849745),
+     TOBN(0xc7ee7216, 0x04c862b1), TOBN(0x32c1541e, 0x0012f591),
+     TOBN(0x8198aadd, 0x5a366d79), TOBN(0x03cd312e, 0x68866e1b),
+     TOBN(0xa0dbc381, 0x9ec64698), TOBN(0x770e4d11, 0x1ef36dd2),
+     TOBN(0x01d17915, 0x8d56bdfd), TOBN(0xb48153cd, 0x75eb9947),
+     TOBN(0xc1d17a54, 0xfde98390), TOBN(0x0817eaf7, 0x0fe2d6fc),
+     TOBN(0x44a63591, 0xa6a704f1), TOBN(0x9423465f, 0x7f554182),
+     TOBN(0xc7c23cbd, 0x13e0574e), TOBN(0x6e06e2cb, 0x439941b6),
+     TOBN(0xa8aebd2c, 0xafa39c79), TOBN(0x1b859e2b, 0xedede735),
+     TOBN(0x2f485781, 0x6b4f5465), TOBN(0xec3093f0, 0x624c81e8),
+     TOBN(0xc1f027c1, 0xc282644c), TOBN(0x2f6e990b, 0x2b74ab51),
+     TOBN(0x9a988d1c, 0xed2ea3df), TOBN(0xa3f50efd, 0xff39d3df),
+     TOBN(0x418a3627, 0xec1d7614), TOBN(0xafc1520c, 0x3d4fa3e8),
+     TOBN(0x741305af, 0x891a9c69), TOBN(0xe87064d4, 0x5d6f8296),
+     TOBN(0x47c9394c, 0x12307b05), TOBN(0x6b038acb, 0xc35f0f40),
+     TOBN(0xa6e77647, 0x1ccca008), TOBN(0x58e4cfb6, 0x9dd71746),
+     TOBN(0xdf649c98, 0xc1fe84ae), TOBN(0x2e308ddc, 0x90db4388),
+     TOBN(0xc2641332, 0xe9362400), TOBN(0x92dd9842, 0x42d265e5),
+     TOBN(0xe0e4ed9b, 0x31eb91bd), TOBN(0x62ec7dd1, 0x145535c5),
+     TOBN(0x1ff29a09, 0xf810812f), TOBN(0x56b64acb, 0x15e9b102),
+     TOBN(0xb5f6d4d4, 0x5b353184), TOBN(0xc3c9292c, 0x1c593774),
+     TOBN(0x16781036, 0x2c700292), TOBN(0xf0948fc9, 0x3ae2f0c6),
+     TOBN(0x40e353cc, 0x4da778ea), TOBN(0x07febf09, 0xa34df03a),
+     TOBN(0x349812ae, 0x9ec397ff), TOBN(0x7c78812f, 0x330f02d0),
+     TOBN(0xf956700b, 0x7d241ea2), TOBN(0x864b1809, 0xebed08be),
+     TOBN(0xe4cec3df, 0xb9eb1635), TOBN(0x7dd65ad6, 0xab49fb60),
+     TOBN(0x06551163, 0x86788a28), TOBN(0xda8792d5, 0x11fb4214),
+     TOBN(0x82140df3, 0xcec09c3e), TOBN(0xcd34ca30, 0x539db03f),
+     TOBN(0xf07cf030, 0xe7dd0e09), TOBN(0x7b08a242, 0x56ae3487),
+     TOBN(0x9c0fd607, 0xbf5a6549), TOBN(0x0b1fc745, 0xd189d68e),
+     TOBN(0x0d91be74, 0x9cf52022), TOBN(0x6013f31f, 0x43ff7fc3),
+     TOBN(0x3bf90bd5, 0xb5654233), TOBN(0xd0a17969, 0x202bf534),
+     TOBN(0xff373b8b, 0xc97e02ba), TOBN(0x4606de54, 0xd31dba07),
+     TOBN(0xb045c50a, 0x8114562a), TOBN(0xc123acac, 0x7b8d8915),
+     TOBN(0xa8f7cd87, 0xb60aa324), TOBN(0x077cab67, 0xabc48200),
+     TOBN(0x88a68643, 0x0d7fff59), TOBN(0x82b92193, 0x67bfe743),
+     TOBN(0x1a8b86cf, 0xc2ce06f9), TOBN(0xa38414a0, 0xf9ad6134),
+     TOBN(0x7f102610, 0x28e2c39f), TOBN(0x34805c20, 0x480856a0),
+     TOBN(0x1b3f9302, 0x18c3034d), TOBN(0x1713f457, 0x574c0c9d),
+     TOBN(0xd84fa26f, 0x690ce2a5), TOBN(0xd4cfa19f, 0xe01a4637),
+     TOBN(0x4807fb82, 0xcc6fad47), TOBN(0xc9d84b48, 0xf933226a),
+     TOBN(0x9b7c530e, 0x7cd2c9dd), TOBN(0x6436a001, 0xf44818e3),
+     TOBN(0xbae0ceed, 0xdfb00461), TOBN(0xed6a7c5f, 0x51c8c8a3),
+     TOBN(0xa6e7fa54, 0x0463ac73), TOBN(0xa0deed89, 0xc77b19e5),
+     TOBN(0x4e0a3396, 0xff218725), TOBN(0x7cfbbd57, 0x2edf2704),
+     TOBN(0x8114d0ca, 0x4e8608c5), TOBN(0xceae65b9, 0x38c935b7),
+     TOBN(0x052b1407, 0x330af8fd), TOBN(0x02e189a1, 0x723c422b),
+     TOBN(0xf1cd6216, 0x657560c8), TOBN(0x099eec2f, 0xe5068361),
+     TOBN(0x68ef58fb, 0x3de78037), TOBN(0x83e0d34e, 0xf3e399e9),
+     TOBN(0x3a2a14c8, 0xf9a17095), TOBN(0xc7a360be, 0xaaf9f08a),
+     TOBN(0x6420155f, 0x30e99527), TOBN(0x8f610960, 0x9f180405),
+     TOBN(0x871a832f, 0x02bc97fe), TOBN(0xa14b3326, 0x8dc7f1f2),
+     TOBN(0xc9bd8b41, 0x87f78ad1), TOBN(0xd378d02a, 0x0b59b9c5),
+     TOBN(0x418a32a5, 0x35c0dc14), TOBN(0x4c96979d, 0xf53d85af),
+     TOBN(0xb6f40e97, 0x08eb4b26), TOBN(0xa21349ca, 0xcaa6252f),
+     TOBN(0xb13d8062, 0x5de38e2d), TOBN(0x54ea3684, 0x9b43c5d6),
+     TOBN(0xc0ad58d7, 0xb1d6521d), TOBN(0x182f8823, 0x22085236),
+     TOBN(0x9d50cecc, 0x2a08449e), TOBN(0xeb85e785, 0x17ab0b68),
+     TOBN(0xb8a22ab7, 0x8d74e26b), TOBN(0x77515524, 0x77d03987),
+     TOBN(0x117a63f2, 0x77ad71de), TOBN(0x1cca30d0, 0xc94c8c82),
+     TOBN(0xe5fefba9, 0x2f05382d), TOBN(0xcc9e8916, 0x9b4b42f1),
+     TOBN(0xbe939e13, 0x9fe716c1), TOBN(0xbf2b9c80, 0x95e38cc2),
+     TOBN(0xf60c4491, 0x37adde62), TOBN(0x3eb3338a, 0xf4df75a3),
+     TOBN(0x16398af3, 0xfe4d84df), TOBN(0xed752cf8, 0xfaf3e5f2),
+     TOBN(0x746a4339, 0xb4cf0e1c), TOBN(0xb8bd479a, 0x39fb6018),
+     TOBN(0x3a9a045b, 0x57dffed3), TOBN(0x2b46ea98, 0xa5ae3c78),
+     TOBN(0x74b5163f, 0xde6b0399), TOBN(0x069628a0, 0x80e511c5),
+     TOBN(0x19cfc882, 0x1b96672b), TOBN(0x2759c76b, 0x379d1f57),
+     TOBN(0xa6cc7a98, 0x2269a514), TOBN(0x1bc2015b, 0x683b1413),
+     TOBN(0xc43b1178, 0x1bf4be62), TOBN(0xd2941975, 0x7bf2b0be),
+     TOBN(0x1eac3587, 0xc4591cfd), TOBN(0x283169e6, 0x0e66d495),
+     TOBN(0xd39bedb7, 0x052352e1), TOBN(0xb04af7f2, 0xd719cd43),
+     TOBN(0x702143d4, 0xe92956d7), TOBN(0x53498722, 0xa0e5b847),
+     TOBN(0xf0e8edc5, 0x574885fb), TOBN(0x4d9418ac, 0x8b5187c6),
+     TOBN(0x70e99cb3, 0xd2a00019), TOBN(0xf0da5be4, 0xe7f8a61b),
+     TOBN(0x52704cbe, 0x7dd34fde), TOBN(0x0fb7224a, 0x2926bb6a),
+     TOBN(0x0d58bddd, 0xf2b0af92), TOBN(0x2f986a07, 0x0e9cad36),
+     TOBN(0xc85549d4, 0x80e3a6f9), TOBN(0xa013e913, 0x322cb14c),
+     TOBN(0x8a19cf30, 0xf25ac201), TOBN(0x130e4ce0, 0xffb8f2e4),
+     TOBN(0x21ad2c8c, 0x0ce56c13), TOBN(0x13ed2106, 0xb15f6a2f),
+     TOBN(0xa217b5f6, 0x9453ce96), TOBN(0x93b1cdc7, 0x64e0bf9c),
+     TOBN(0x753d894d, 0xc4fe8e72), TOBN(0x46c6cea3, 0xf3a3916a),
+     TOBN(0xc1fb78e1, 0x383dd581), TOBN(0x1b7ba1a9, 0x17376a3e),
+     TOBN(0xa1411287, 0x5df66852), TOBN(0x4e9d333c, 0xa30445d3),
+     TOBN(0xb5a26c14, 0x917568a9), TOBN(0x885f1857, 0xe857a6ac),
+     TOBN(0x05fbd3ee, 0x84b1f8cf), TOBN(0x5c1f4097, 0x1e81e4e1),
+     TOBN(0x43999be4, 0x011f30e6), TOBN(0xa8aab3bd, 0xa890719d),
+     TOBN(0x49d598ce, 0xc7088eb2), TOBN(0x7a892468, 0xe341047c),
+     TOBN(0x8e69b5c4, 0x07cb6075), TOBN(0x83d066fd, 0x8c37dc04),
+     TOBN(0x4fcc6d02, 0x6ffff7ac), TOBN(0x1afaaf74, 0x7edfb968),
+     TOBN(0x2972b753, 0x70d529de), TOBN(0xf65bff0d, 0x08218b2e),
+     TOBN(0x119b3c4b, 0x4182b9fc), TOBN(0xcab66591, 0x27b5e101),
+     TOBN(0xfff2e939, 0x2ab87a02), TOBN(0x1c10c40d, 0xeec5949b),
+     TOBN(0x98366224, 0x30aa1242), TOBN(0x833e9dee, 0xf225a4e7),
+     TOBN(0x07f1cfec, 0x992e8475), TOBN(0x377a9d79, 0x1ef83a8a),
+     TOBN(0xaf1d0863, 0xc6715544), TOBN(0x34dd65c1, 0x1fd71505),
+     TOBN(0x74d55c22, 0x04fed293), TOBN(0x31b1e50e, 0x86d2f3be),
+     TOBN(0x876148b9, 0xc09594ac), TOBN(0x73aace3b, 0x8900b56e),
+     TOBN(0x4617258a, 0xa2cf4c37), TOBN(0x554e8f16, 0xc6f38a92),
+     TOBN(0xd8594800, 0xda0723bc), TOBN(0x524452df, 0xf3c8381d),
+     TOBN(0x846dfa02, 0x138ca980), TOBN(0xaa77a80c, 0xe2d32e56),
+     TOBN(0x27573fbc, 0x419c86b5), TOBN(0xe7486807, 0xb70216c3),
+     TOBN(0x8b7a685a, 0xc72036e6), TOBN(0xa1764627, 0x15fae3d8),
+     TOBN(0x0a1f2361, 0x815f379c), TOBN(0x9811607e, 0x01ab64d2),
+     TOBN(0x31841038, 0xff2c75cd), TOBN(0x8751674e, 0x474982aa),
+     TOBN(0x2f32b55b, 0x52a2523f), TOBN(0x6ff8d2a7, 0xe85f2025),
+     TOBN(0xd2ec31ee, 0x707b2dcb), TOBN(0xdac81e59, 0x6e277971),
+     TOBN(0x5445e3a2, 0x0e78191b), TOBN(0x134dba0b, 0x8c80db2f),
+     TOBN(0xe9925a87, 0x94002b55), TOBN(0xe56fa2be, 0x4293c71d),
+     TOBN(0x72aca4d2, 0xa9d009c2), TOBN(0x0c1219dd, 0x02fb0741),
+     TOBN(0x689fbc66, 0x208fd227), TOBN(0x8266f2f7, 0xe4bb09d8),
+     TOBN(0x1a791f9b, 0x2a61b8bb), TOBN(0xb29b31b7, 0x3eff4f21),
+     TOBN(0x2f97803a, 0xab7812db), TOBN(0xdbf27bae, 0x880ceb4c),
+     TOBN(0xecb84887, 0x45e9db5b), TOBN(0x3dfd84e1, 0x5cb7d0ec),
+     TOBN(0xc89f61c2, 0x77c0b1e0), TOBN(0x7ada1d37, 0xb7656544),
+     TOBN(0x0bca9585, 0x910a966c), TOBN(0x80385b47, 0x6f12c20c),
+     TOBN(0xf63a1605, 0xa4b30374), TOBN(0x2f91b24c, 0x104b4783),
+     TOBN(0x9210f5b9, 0xb3ab423f), TOBN(0xb9aa656d, 0x2fd424a6),
+     TOBN(0x63c615d5, 0xf7e8d640), TOBN(0xd567ff98, 0xbb59cfec),
+     TOBN(0x78121697, 0xf7692947), TOBN(0xb9166739, 0xbd9f5ed5),
+     TOBN(0x58d9a4f4, 0xb64b20e2), TOBN(0x291898d9, 0xc9fcc93c),
+     TOBN(0xbce6509e, 0xd6c6065a), TOBN(0x39af658f, 0xb84834a4),
+     TOBN(0x0f919d44, 0x94b49185), TOBN(0x3b80fc51, 0x5dbe7308),
+     TOBN(0xb9fd8ae4, 0xe321c228), TOBN(0x4a46bd2d, 0x360692ba),
+     TOBN(0x91d5396e, 0xd05b84b0), TOBN(0x266e89fd, 0xd6b058d0),
+     TOBN(0x6fb142d7, 0xb2c42e38), TOBN(0x93c9fe18, 0x994ebc2f),
+     TOBN(0x90e17885, 0x104b04a3), TOBN(0x6a5fa420, 0x654eb6ac),
+     TOBN(0x26c8a9b4, 0x3f349b26), TOBN(0x39387f7e, 0xb4e528ae),
+     TOBN(0xa74bea43, 0x5eb46726), TOBN(0x0b3e82dc, 0x9150b043),
+     TOBN(0xc69ffac9, 0xe2fc799f), TOBN(0xd0479697, 0x48921338),
+     TOBN(0x91a68264, 0x0a4e061b), TOBN(0x93a6c41e, 0x3f410bcc),
+     TOBN(0xaea8d055, 0x6b1fb104), TOBN(0x2ff339a4, 0x31fe146f),
+     TOBN(0x3d7ef85b, 0xcf63c413), TOBN(0x1f0f57c5, 0x289a097b),
+     TOBN(0x82f2f83b, 0x5bda1160), TOBN(0x433eea4d, 0x6fea66e8),
+     TOBN(0x1f3fff4f, 0xcae11651), TOBN(0xfa71c3fd, 0x6b1c243b),
+     TOBN(0x59f36add, 0x674832a4), TOBN(0x7b6d3802, 0x2891e4e6),
+     TOBN(0x47b313bc, 0x084fa3c6), TOBN(0x90003ac6, 0x6584c9c0),
+     TOBN(0x9718c2dd, 0xbc802849), TOBN(0x9a5a2698, 0x2870ca08),
+     TOBN(0xb5cfe625, 0xcf68f352), TOBN(0x90d0e2ed, 0x6e6b0caa),
+     TOBN(0xb30780c3, 0xba64d50b), TOBN(0x16328345, 0x7acb4fca),
+     TOBN(0xf64e01fd, 0x84b258de), TOBN(0x2a25873e, 0x35dcd2f1),
+     TOBN(0x36606813, 0xce4b39da), TOBN(0x5285c91e, 0xa69a93e3),
+     TOBN(0x4da13aaa, 0xdcb501d6), TOBN(0xb90d0a52, 0x52e3dc24),
+     TOBN(0x6882d15e, 0x60a57d0f), TOBN(0x52142caf, 0x167612fe),
+     TOBN(0x532ccfb1, 0x463d39cc), TOBN(0xcdecde85, 0xe5a969f3),
+     TOBN(0xa89c1d1d, 0xd1bc4480), TOBN(0x9373f362, 0x83f32199),
+     TOBN(0x42f3493d, 0x6d653c44), TOBN(0xa867e4db, 0x6c80e27e),
+     TOBN(0x954fbd83, 0x5cb7623d), TOBN(0xba8b3007, 0x0b83d55c),
+     TOBN(0x71946b92, 0xe2b23256), TOBN(0xe0a2a7bf, 0xfaf95492),
+     TOBN(0x32ed3d91, 0x4e0c81ef), TOBN(0xb8c8b14c, 0x46f058d6),
+     TOBN(0xc76c917f, 0x67221924), TOBN(0xd26c1d51, 0x2ddf3cd4),
+     TOBN(0x184e1395, 0x4fc9b14a), TOBN(0x651a0c29, 0xc1969b8b),
+     TOBN(0x05687179, 0xc9d5bf9c), TOBN(0xb2f18ed1, 0xebcd85b6),
+     TOBN(0x8b662764, 0xe446f1ef), TOBN(0x6c0e051e, 0x71699f5a),
+     TOBN(0xf94a1151, 0x27d93da8), TOBN(0x751235c6, 0xa05fe7a4),
+     TOBN(0x40aaf88f, 0x624e9ae2), TOBN(0x6499b3f5, 0xf5f6e5c5),
+     TOBN(0x01fb0b8e, 0x98157f61), TOBN(0x070438f3, 0x33827220),
+     TOBN(0x7409012f, 0x50ab0b43), TOBN(0xdbbba563, 0x63c50e65),
+     TOBN(0x6b572ca3, 0xc0d084ad), TOBN(0xf10f6684, 0x7b76cd6c),
+     TOBN(0x32bcca97, 0x0c34363b), TOBN(0x7a9cef10, 0xb40e8157),
+     TOBN(0x3d5ffc51, 0x6eaec234), TOBN(0x7d7b41a5, 0x5f23d481),
+     TOBN(0xe5276c22, 0xeecdfe73), TOBN(0xa9b2725b, 0x8ac8c30d),
+     TOBN(0xee449588, 0xed0c743b), TOBN(0x6d3b82a3, 0x48df73b7),
+     TOBN(0xcb52edc2, 0x023cb0df), TOBN(0x08773a4d, 0xd5a24591),
+     TOBN(0x0d9a6aaa, 0xe12a9072), TOBN(0x4261f56f, 0x5bf5586e),
+     TOBN(0x184b0402, 0x60a08106), TOBN(0x1b398053, 0xb09cfa61),
+     TOBN(0xdf7f55b1, 0xd5dae483), TOBN(0x9554210e, 0x86ef2cde)},
+    {TOBN(0x564d6e85, 0x9204db30), TOBN(0x139bb928, 0x2aa84cdf),
+     TOBN(0x9413d7ea, 0x88476456), TOBN(0x5c554483, 0x5a1ffa66),
+     TOBN(0x7b863089, 0x2ed18080), TOBN(0x589aaf20, 0xd14e5daf),
+     TOBN(0xeee4f96f, 0x7b5f81ca), TOBN(0x88d47007, 0x1bb0b415),
+     TOBN(0x1bb400d3, 0x55c9bd11), TOBN(0x8402465c, 0x06fc2851),
+     TOBN(0xa81ba22d, 0x65063b3e), TOBN(0xbab2dcbc, 0x6e1aa0c6),
+     TOBN(0xe5f43f1a, 0xbe645e25), TOBN(0x62320533, 0x4df84be1),
+     TOBN(0x14ac7080, 0x21a2eaf4), TOBN(0x3f946464, 0x58beb26f),
+     TOBN(0x5f2a3e9a, 0x7a82d20f), TOBN(0x399e015c, 0x191011f2),
+     TOBN(0xfbec312a, 0x886ac8e6), TOBN(0x0dd5140a, 0xeda47f96),
+     TOBN(0x0d4df313, 0x26b47318), TOBN(0xe2c9ec78, 0xe6685ec8),
+     TOBN(0x4df119ae, 0xcd8442cd), TOBN(0xdb1ca955, 0x7b32a1cf),
+     TOBN(0x7e2c5852, 0x126506cc), TOBN(0xba94aac7, 0x08b3567d),
+     TOBN(0x6905cdf4, 0xc05a3f24), TOBN(0xbf5f559b, 0x3547f8b3),
+     TOBN(0x9e4b4e62, 0xaade7a1d), TOBN(0x56b8b9d6, 0x1fda3088),
+     TOBN(0xea3eb4c6, 0x4c43d89f), TOBN(0xfb7e537c, 0x9c69e047),
+     TOBN(0xc23d9491, 0xdfe5f6ab), TOBN(0x42fc362d, 0xc1a9c0af),
+     TOBN(0x04170b01, 0x127d2b35), TOBN(0x4f0f17bc, 0x04116aeb),
+     TOBN(0x716c01df, 0xc9184cf6), TOBN(0x914dc877, 0x895ceae7),
+     TOBN(0x696b2ae8, 0x390bff2e), TOBN(0xf6ccd628, 0xf88af5db),
+     TOBN(0xdada9bb9, 0x0f88095a), TOBN(0x7155c28f, 0x919ce305),
+     TOBN(0x32a01e47, 0x6d78b266), TOBN(0x6da94459, 0xb652c4f8),
+     TOBN(0xa31783a6, 0x827ea8ef), TOBN(0x4d69b7c6, 0xbdb1af2b),
+     TOBN(0x2874eb38, 0xaf31dab9), TOBN(0xa0ed9910, 0xafd9bace),
+     TOBN(0x7d892e3a, 0x4037f17e), TOBN(0x81fa9841, 0x5f91a4fa),
+     TOBN(0x17c7292d, 0x961cf02f), TOBN(0x35af0c0e, 0x388bcc75),
+     TOBN(0x340bec90, 0x127a29b0), TOBN(0x955714a4, 0x3d087445),
+     TOBN(0xfd430880, 0xa587c273), TOBN(0x715ecd50, 0xd24dfda2),
+     TOBN(0x4ade066d, 0xaafd6cef), TOBN(0xce59c8de, 0xf8c1decc),
+     TOBN(0x3e12a24a, 0x77b96ece), TOBN(0xee7c32fc, 0x44cc710c),
+     TOBN(0x70700e4f, 0x240e9bb7), TOBN(0x837ada54, 0x6a63b06e),
+     TOBN(0xa58ce980, 0xd19644ee), TOBN(0xcaa5d14d, 0x27e7451c),
+     TOBN(0x8e78d2ed, 0x387272fc), TOBN(0x9163a377, 0xfd8a0f13),
+     TOBN(0x858436bd, 0x635c55f0), TOBN(0x0a414f9b, 0x5ba5b0eb),
+     TOBN(0x2b58373a, 0x7d7383b1), TOBN(0x5e7b9d36, 0x6030a376),
+     TOBN(0x9c69af86, 0x543514ef), TOBN(0x044698cc, 0x26080ff3),
+     TOBN(0x76f54954, 0xa2e23074), TOBN(0x90393264, 0x17526081),
+     TOBN(0x0d095055, 0xf3b78a50), TOBN(0x1f3a3776, 0x69d8b26d),
+     TOBN(0x0575e3bb, 0xf5e7c8fb), TOBN(0xee7dd406, 0xee40b0c5),
+     TOBN(0xe6522e5d, 0x55dab556), TOBN(0x2d1b5709, 0xb61cd918),
+     TOBN(0x0ea9278e, 0x01400b8d), TOBN(0x9552e745, 0x6464f584),
+     TOBN(0x67f5645b, 0x12fc094f), TOBN(0x77c40f3c, 0xde303128),
+     TOBN(0x16d7e9a5, 0x0e3f3381), TOBN(0x017795ab, 0x59947693),
+     TOBN(0xb69b5708, 0x9222eaf5), TOBN(0x61b213e0, 0x1b77f122),
+     TOBN(0xa7cc8bbf, 0xdc8db00e), TOBN(0x1c51f5e4, 0x3aa7fc1f),
+     TOBN(0xb85b782e, 0xb4ac2d0c), TOBN(0x32fde94b, 0x0468e5ea),
+     TOBN(0x8ad5b9a2, 0x7f7ff0a9), TOBN(0xcd26f418, 0x8fdbb3f9),
+     TOBN(0x853bc95d, 0x6ebf89db), TOBN(0x1da0a323, 0xa066b849),
+     TOBN(0xc4cc7aab, 0x4bce0fa7), TOBN(0xd4a05b69, 0x6bc940f1),
+     TOBN(0xc77300e6, 0x392dbd11), TOBN(0x0dc2eac6, 0x21f70aae),
+     TOBN(0x9d4b513b, 0x4b2ad7e0), TOBN(0x19822167, 0xa6daee1d),
+     TOBN(0x7d71d202, 0x69b98eee), TOBN(0xdfd435dc, 0x35f3f150),
+     TOBN(0x66d46ad3, 0xddfd45ed), TOBN(0xf0325189, 0xe50a2f01),
+     TOBN(0xe19b9500, 0x3ec5683d), TOBN(0xc46ab0a2, 0x91dd97e9),
+     TOBN(0x74c971d7, 0xed682c4a), TOBN(0xafedac2d, 0xa14da289),
+     TOBN(0xd17838fe, 0xe39ba740), TOBN(0xeb497bca, 0x053536bc),
+     TOBN(0x551ba4ca, 0xde6d4c38), TOBN(0xa67be247, 0x4f52298b),
+     TOBN(0x98413188, 0x9a5b40a8), TOBN(0x083a26aa, 0xbb0acfb5),
+     TOBN(0x4929ff5e, 0x11d16ebb), TOBN(0x91f08b63, 0xa942ae7e),
+     TOBN(0xaa428ef3, 0x876663ec), TOBN(0xfaabd309, 0x1e97cbb2),
+     TOBN(0xca0ed50c, 0xf1edd62f), TOBN(0xc3c7ae6f, 0xd29f48d9),
+     TOBN(0xff47bf28, 0x8a72ae88), TOBN(0x584ddfe5, 0x348c6666),
+     TOBN(0x271137e9, 0x36731fdf), TOBN(0x714bc7db, 0x88d98bc8),
+     TOBN(0xcea912c1, 0x0da6be30), TOBN(0x91cb844d, 0xbe62d6a5),
+     TOBN(0xe16ca42a, 0xec027bfa), TOBN(0x0c88f701, 0x17603e76),
+     TOBN(0x799418e3, 0x63d5a31a), TOBN(0x033bb53b, 0xebb063f6),
+     TOBN(0xbcd05461, 0x625d3909), TOBN(0x2d7b7868, 0x85f23129),
+     TOBN(0x23b07887, 0x95090997), TOBN(0x216c08ae, 0x18d2c218),
+     TOBN(0xe1ccb6c1, 0xeebdbcf9), TOBN(0x89ca4552, 0xe873842e),
+     TOBN(0x4837f137, 0x3c2fcdd5), TOBN(0x805874e8, 0x108a8c0a),
+     TOBN(0xe7e524f4, 0x3d442fa7), TOBN(0x580d82be, 0xf8131f8a),
+     TOBN(0x6dcb7d27, 0x93d3d50f), TOBN(0x51207d3e, 0xb5b39168),
+     TOBN(0x9a3ce117, 0x09110fe9), TOBN(0x8f3c6e4f, 0x48721d93),
+     TOBN(0x60a62b48, 0x87bdfa61), TOBN(0x086dac65, 0x7c01d84a),
+     TOBN(0x4af7878c, 0x53841493), TOBN(0x3b1a8935, 0xb3bd5aa1),
+     TOBN(0x65c8445b, 0x902e5686), TOBN(0xde16cfa5, 0x2e3b1822),
+     TOBN(0x19879e78, 0x0a3e3684), TOBN(0xec553912, 0xee249180),
+     TOBN(0x8eb73fae, 0xf8f4c1ee), TOBN(0xdee59877, 0xb81fd20d),
+     TOBN(0x2452e63f, 0x20b5ece3), TOBN(0x17be9422, 0xb632dddb),
+     TOBN(0x01f89220, 0x94311e6d), TOBN(0x8f0fe052, 0xa332f84f),
+     TOBN(0x59657aab, 0x1b9784d5), TOBN(0x6f2ce032, 0xd8a7f347),
+     TOBN(0x84247793, 0x6b95e6e9), TOBN(0x34301cf4, 0x4395b044),
+     TOBN(0x98ebfd98, 0xf7fb5401), TOBN(0x14fd494b, 0xfcdb31a4),
+     TOBN(0x042f89d8, 0xf90e0481), TOBN(0x6b90a008, 0x4134ab52),
+     TOBN(0x8fa22555, 0x7fe2ffec), TOBN(0xc6dc3d32, 0xa778448f),
+     TOBN(0x4886fedb, 0x85f45aad), TOBN(0x5bdef90e, 0x51704d0c),
+     TOBN(0x46ad596d, 0xe2d1fdaf), TOBN(0x914e0090, 0x04126f0d),
+     TOBN(0x71aaeb18, 0xaef960a6), TOBN(0x8f4601e5, 0xac77472c),
+     TOBN(0x42e5a186, 0xd8d9768c), TOBN(0x8cbf3a6c, 0x00f6004f),
+     TOBN(0x9d4bf5ac, 0xc1ddebdc), TOBN(0x13354792, 0xa9c066fb),
+     TOBN(0x72e0b81c, 0x923fe808), TOBN(0x1e73b868, 0xc526d6e4),
+     TOBN(0x3f7bedc6, 0xa81f1e24), TOBN(0xed1ff363, 0xe920ba24),
+     TOBN(0x58234c89, 0x659604c5), TOBN(0xa6a421ad, 0xce4b0872),
+     TOBN(0x5dc8848a, 0xcc19578f), TOBN(0xfcb418d0, 0x4f28bdfc),
+     TOBN(0xf2e74820, 0x8d6442f5), TOBN(0x0c481d85, 0x4dcf6378),
+     TOBN(0x4987d1a6, 0x4556438b), TOBN(0x76359363, 0x3157c6be),
+     TOBN(0x29bbf3b7, 0x1c1dceef), TOBN(0x0995c340, 0x576f1dbd),
+     TOBN(0x0405db3d, 0x8fa61304), TOBN(0x63438f3d, 0xcc7d345e),
+     TOBN(0x688174dd, 0x942120e5), TOBN(0xc7dd05bd, 0xcd70c93c),
+     TOBN(0xdc8a32dc, 0x5e871ae0), TOBN(0x1a7896b9, 0x6178647a),
+     TOBN(0x1fc3f7a2, 0x59c437e3), TOBN(0x737de2e3, 0x24235e5e),
+     TOBN(0x589a56e3, 0x7a5eaabd), TOBN(0x5a79da8e, 0xcca140f3),
+     TOBN(0x3d8b0d82, 0xa12463fa), TOBN(0x63fc83d8, 0x0875daf5),
+     TOBN(0x42a30803, 0xbd9211f7), TOBN(0x62f6167f, 0x32d3935f),
+     TOBN(0x70cd6467, 0x6f269922), TOBN(0xf694ca21, 0x96163b47),
+     TOBN(0xf3bafb2d, 0x5f5ba669), TOBN(0xcf7cf341, 0xb8ed8333),
+     TOBN(0x34b2022d, 0x9997edc2), TOBN(0x57e6f4b5, 0x309c6508),
+     TOBN(0xf6fbf864, 0x64841008), TOBN(0xbc9821f5, 0xed075d44),
+     TOBN(0x78c80f73, 0xf37cc6b7), TOBN(0x41d28626, 0x6ab88fc2),
+     TOBN(0x2126981c, 0x58ca26fc), TOBN(0x7a956c64, 0xbe3dbf87),
+     TOBN(0x2f41e27d, 0xce0ce9f3), TOBN(0x0cb49ae0, 0xf4c98e5b),
+     TOBN(0xba6224a6, 0xcace473e), TOBN(0x25dddbc0, 0x393e092f),
+     TOBN(0x747daf46, 0xa4fb974d), TOBN(0xfb775fe7, 0xc76dbe2e),
+     TOBN(0xb7b3ad6d, 0x9670c22e), TOBN(0xc6580b23, 0x10a380bc),
+     TOBN(0x4ea226f5, 0x92087c3d), TOBN(0xe67c379f, 0xb53aa3c7),
+     TOBN(0x4133f831, 0x991c3c9b), TOBN(0x80f9e5bd, 0x4fa0dd18),
+     TOBN(0x0094e7c6, 0xc6f80fb4), TOBN(0x16e99ebc, 0x351bebd3),
+     TOBN(0xc555ed44, 0xaae16a6f), TOBN(0xe9d2846f, 0x2f6367eb),
+     TOBN(0xb34c93d0, 0x83d46d0f), TOBN(0xc0cb137a, 0x894fadc6),
+     TOBN(0x21e289f8, 0xab31f937), TOBN(0xac5e0516, 0x1bc72a35),
+     TOBN(0x6221871b, 0xf3d4db0d), TOBN(0x72d1fdce, 0xa039826c),
+     TOBN(0x69d9cc8b, 0x668c8022), TOBN(0x0bf359ce, 0xfee064ff),
+     TOBN(0xb8e636b7, 0xe8d16f19), TOBN(0xde88f403, 0x443160ac),
+     TOBN(0x4228177a, 0x032836ee), TOBN(0xee8fac37, 0xe9801d86),
+     TOBN(0x496c9363, 0x4626e343), TOBN(0xf6999578, 0xf4e4c8fa),
+     TOBN(0xce7306f6, 0xb8648a06), TOBN(0xe2775c8c, 0xae7996e5),
+     TOBN(0x7b47e678, 0xbf09d221), TOBN(0xf5251e1e, 0x515c2ace),
+     TOBN(0x087f9121, 0x77b48b41), TOBN(0xc40e7725, 0xeb38d74b),
+     TOBN(0x1d559f4a, 0xce95134a), TOBN(0x1048a1bc, 0x320c8bc6),
+     TOBN(0xad2ddaf8, 0xe3085f1b), TOBN(0xf1cfc4cb, 0x0ad35636),
+     TOBN(0x2bd8d4fb, 0x57db1e96), TOBN(0xd1813026, 0xe1976ab7),
+     TOBN(0xa80e501c, 0x15867022), TOBN(0xecaf1497, 0x01f68017),
+     TOBN(0xd82c5e79, 0x48ab68b7), TOBN(0xa0f117e4, 0x204d2962),
+     TOBN(0x99b3bda1, 0x7dedbf05), TOBN(0xb872dbff, 0x52786ecd),
+     TOBN(0x56253c32, 0x57592d3c), TOBN(0x495fbb05, 0x4d570c07),
+     TOBN(0x073c49cb, 0xfaecad3e), TOBN(0xec8c1f57, 0xb46bad46),
+     TOBN(0x13800a76, 0xce3b07c7), TOBN(0x9bbf87d7, 0x0ffaec55),
+     TOBN(0xf69a9ee3, 0xaf2426c3), TOBN(0x2d0c201f, 0x2fd70c22),
+     TOBN(0x957e5be1, 0xc42bb661), TOBN(0x3e6ae19d, 0x1dc771df),
+     TOBN(0x60af970d, 0xe3cfafa7), TOBN(0x721ce869, 0x5ebd1883),
+     TOBN(0xab0a80a5, 0xb87d0ede), TOBN(0x33576f02, 0x2954a3e3),
+     TOBN(0xcc2fe8c0, 0xc413fc00), TOBN(0x5ae762bd, 0xeb86a18b),
+     TOBN(0xbc309dde, 0x3fe6c6dc), TOBN(0xb4f9d001, 0xbf0d1eb5),
+     TOBN(0xf3f3c5b9, 0xd4fa748c), TOBN(0x78e8867f, 0x2ca78fdd),
+     TOBN(0x8f85f872, 0xcdf1624b), TOBN(0xfdce003b, 0xa7db0248),
+     TOBN(0x0ad33ef7, 0x1ad9866b), TOBN(0x27d12937, 0x296248a4),
+     TOBN(0x23bf35eb, 0xc99c656a), TOBN(0xcfb64da2, 0x17753ace),
+     TOBN(0x8bc0e741, 0x6fbf7969), TOBN(0x131018ef, 0xe719cff9),
+     TOBN(0x98f4ef66, 0xd1c02b67), TOBN(0xe8aa6cdb, 0x1f81f578),
+     TOBN(0xa6f97fb3, 0x159469de), TOBN(0xf8e834cd, 0xe3906d9e),
+     TOBN(0x33ccda6d, 0x71bbd3d1), TOBN(0xeac76a4a, 0xf952c038),
+     TOBN(0x2891eaa0, 0xe5b53383), TOBN(0xd629dbdd, 0xedcf6de7),
+     TOBN(0x4af093cd, 0xa3fb0fa1), TOBN(0x130fd057, 0x0d1ea294),
+     TOBN(0xb553cb13, 0xb57747bf), TOBN(0x107c0f0e, 0x024e856b),
+     TOBN(0xfd63a2ff, 0xbd631fef), TOBN(0x8df62ec2, 0x12c01222),
+     TOBN(0xacbce197, 0xc0af11a9), TOBN(0x35fa3e80, 0x5c4922b5),
+     TOBN(0xbc257ccf, 0xc3de57ba), TOBN(0xb481ca1c, 0x293ad2df),
+     TOBN(0xb123f3bb, 0x2058e222), TOBN(0x219cde82, 0xefe46989),
+     TOBN(0x58ac87b8, 0xe9a316da), TOBN(0xa8294237, 0xd4d25c91),
+     TOBN(0xb54dad88, 0x62d14158), TOBN(0x9250885f, 0xb3da2a84),
+     TOBN(0xb4e3bedf, 0xd54776bd), TOBN(0x81a4c582, 0x78043ee5),
+     TOBN(0x279a0963, 0x4eb87133), TOBN(0x827d333c, 0xf2bfdb52),
+     TOBN(0x3601c6d1, 0xed71e119), TOBN(0x3d9b1772, 0x0d64df1d),
+     TOBN(0x2f5bcc09, 0x3fa3c40e), TOBN(0x74b7b30d, 0x8e26aef5),
+     TOBN(0x98fd949b, 0x3d3ac848), TOBN(0xd99e99d0, 0x92e259f1),
+     TOBN(0x34404265, 0x8d353c77), TOBN(0xffc05a7d, 0x4d8dfb1f),
+     TOBN(0xbaf2f471, 0x4e9d92c9), TOBN(0xf354f8b2, 0x5ea9cef3),
+     TOBN(0xf2be0fea, 0xb8b2c8a0), TOBN(0xa392d3e3, 0xfbce308f),
+     TOBN(0x58cd793d, 0x02619258), TOBN(0x16a8c9e7, 0xfea6eacc),
+     TOBN(0x3fcae1ed, 0xb90f9cb5), TOBN(0x1df76d07, 0xd59bc4ce),
+     TOBN(0x39248217, 0x8574a3ce), TOBN(0x9d0df2b7, 0x03b6e82e),
+     TOBN(0x64227c0f, 0x33206733), TOBN(0xb909614f, 0xb342da7d),
+     TOBN(0xe46e977f, 0xb8e15a20), TOBN(0xdf2aa89d, 0x744eaa18),
+     TOBN(0xa40b36b7, 0x7ff12f89), TOBN(0xbf7ed788, 0x86b0e7d4),
+     TOBN(0x35930c5c, 0x9e044a5b), TOBN(0x599cfa2b, 0x4ac6b8a0),
+     TOBN(0x68f5f40d, 0xa8f06839), TOBN(0xe838649b, 0xe8a1b9d5),
+     TOBN(0x2e3c91a9, 0xdd45feda), TOBN(0x5f73aa38, 0x58de0625),
+     TOBN(0xcc2b2397, 0x7535cddc), TOBN(0x60e69d0b, 0xca7825fa),
+     TOBN(0x8f1a95c4, 0x62424bd7), TOBN(0x5e175a13, 0xf6f21e23),
+     TOBN(0x594e5b82, 0x4fa48b20), TOBN(0x2bfed204, 0x9b14fed3),
+     TOBN(0x87c925fc, 0x74484bc3), TOBN(0x052b634f, 0x5639abc5),
+     TOBN(0x169549b6, 0x290426dc), TOBN(0xfe515a22, 0xdaaefd38),
+     TOBN(0x8a63a39c, 0xb4d87ccb), TOBN(0x3dec5f62, 0x4034acdc),
+     TOBN(0x59969d81, 0x61090db0), TOBN(0xb089b8f7, 0xf157248d),
+     TOBN(0x42b0ca54, 0x9d59a29f), TOBN(0x522b3e3e, 0x9be7ee82),
+     TOBN(0x894aade2, 0xac166a7e), TOBN(0x57aaf19a, 0x9184ec33),
+     TOBN(0x84406a11, 0x5e50711a), TOBN(0x0cafd148, 0x1614f8d3),
+     TOBN(0xc6174fdc, 0x3f7d19f8), TOBN(0xca5bed9a, 0xff4958be),
+     TOBN(0x8dc18aaa, 0xe4fdd396), TOBN(0xf6e8a9ee, 0xd371c3f4),
+     TOBN(0xc6b58042, 0xa5dfefde), TOBN(0xccc3bbb6, 0xfc4f3577),
+     TOBN(0x9f583e4a, 0xdedfdd55), TOBN(0x9ea45133, 0xb48c5fb2),
+     TOBN(0xca2b3229, 0x232d61e0), TOBN(0x642101a8, 0xb0b5cb38),
+     TOBN(0x0cfac5fc, 0xa9ebda1a), TOBN(0x02398bd6, 0xd2dc9c7c),
+     TOBN(0xd95511d9, 0x80591234), TOBN(0x0e5cc99c, 0xe8230901),
+     TOBN(0x943350f6, 0x140eaba1), TOBN(0x9fe19108, 0xe0623c93),
+     TOBN(0x052bf5d9, 0xd74e189b), TOBN(0x3e341bff, 0x40cd7173),
+     TOBN(0x89b5b355, 0xcb7d384d), TOBN(0xedee32da, 0x50b76f18),
+     TOBN(0x6a9cfb19, 0x5804d9df), TOBN(0xccf638f8, 0x376fc2d8),
+     TOBN(0xebdce7a5, 0xe14de014), TOBN(0x0135085f, 0x7f606fa5),
+     TOBN(0xf8a3de5f, 0x69b58c3b), TOBN(0xbaa80445, 0x59ca19d1),
+     TOBN(0x3252147d, 0x0ce7238d), TOBN(0xd446960b, 0xd57bc36f),
+     TOBN(0x9b1743ce, 0xb275f5ca), TOBN(0xda048c48, 0x27629de8),
+     TOBN(0x005354db, 0xd3bbac67), TOBN(0x62c392fb, 0x1ba1facc),
+     TOBN(0xb066bfae, 0xa18da892), TOBN(0xdb090711, 0x367a8320),
+     TOBN(0xbb7092e2, 0x6f90249a), TOBN(0x6de14155, 0xe22da86b),
+     TOBN(0xe16136d3, 0xb38d4ad8), TOBN(0x9deaa5c9, 0xd0fbb940),
+     TOBN(0x54a54ba3, 0xaacf50e3), TOBN(0x66e5645a, 0xb9ba4570),
+     TOBN(0x77e28d94, 0x48cb742a), TOBN(0xc795b138, 0xed98a2c9),
+     TOBN(0x899331f6, 0x1daa17ee), TOBN(0xac950653, 0x4a77734f),
+     TOBN(0xd7f6304f, 0x71f3e3b6), TOBN(0xe7256955, 0x65fc119c),
+     TOBN(0x3e60a04c, 0xbe527794), TOBN(0xdaf53be4, 0x7c578fb0),
+     TOBN(0xf785a4f8, 0xebc0754b), TOBN(0x8b21b116, 0xde1b78b4),
+     TOBN(0xfe47e04f, 0x62fb1c56), TOBN(0x8a92f9e6, 0x229f1017),
+     TOBN(0x2d73dd23, 0x68b7842c), TOBN(0x3b43f7dc, 0xa56dbc4f),
+     TOBN(0x9435defe, 0xd0f3f4ca), TOBN(0xdabfb1ba, 0x500594e3),
+     TOBN(0x70e929e8, 0x428f5ead), TOBN(0x44adf585, 0xbdc7716e),
+     TOBN(0x7b7ff077, 0x02204867), TOBN(0xf2f306be, 0x0c78476c),
+     TOBN(0x48849fd5, 0x7e783793), TOBN(0xc2dc3c7d, 0xaf77e3c7),
+     TOBN(0x5eb2b691, 0xa980cdf6), TOBN(0x7ca7b7a4, 0x204e25df),
+     TOBN(0x1e7c2f82, 0xc5070eab), TOBN(0x32ca4b36, 0x4eb7cd3b),
+     TOBN(0x38ffde8f, 0xf94ad1ab), TOBN(0xb4757ae1, 0x59921b25),
+     TOBN(0x856cd3f3, 0xb4d2f624), TOBN(0x90593929, 0x1eb40708),
+     TOBN(0xffc4b89a, 0x1193b3e4), TOBN(0x6afba7a8, 0xbd2f804f),
+     TOBN(0x72aabbaa, 0x69dc21ed), TOBN(0x5d1da32e, 0xe7fb6de1),
+     TOBN(0x56c0f440, 0x98d1e26b), TOBN(0x9456a6c3, 0xf7cc7d6c),
+     TOBN(0x9eb0aebb, 0x14f2f24d), TOBN(0x51d7c699, 0x7dd788a5),
+     TOBN(0x053b8098, 0x46a22e97), TOBN(0x27d8ea2a, 0x8c025be8),
+     TOBN(0xe0bd464a, 0x10d5afaa), TOBN(0x137c452d, 0xe7cf120c),
+     TOBN(0xd06bd227, 0xd091397b), TOBN(0x4b307bf3, 0x21bc796f),
+     TOBN(0x701eaf3a, 0x7f5a37b0), TOBN(0x8d5a0f61, 0xac7d4718),
+     TOBN(0x0cf9eea3, 0xed8b1a37), TOBN(0x10854f10, 0x2aa9061c),
+     TOBN(0x0aaf430c, 0xa30eb4e6), TOBN(0xb74342f5, 0x2a050dfb),
+     TOBN(0x2feee9d7, 0x20e1899f), TOBN(0x49464a8e, 0xf2a1dbfc),
+     TOBN(0x4d7cf25e, 0x5762d68e), TOBN(0xe7b6e759, 0x7bf43462),
+     TOBN(0x71fce284, 0x79daf6e0), TOBN(0x2d3ff71f, 0x03858705),
+     TOBN(0x07d8d288, 0xbc4af4e6), TOBN(0x6777d197, 0x18f1c7d4),
+     TOBN(0xb5770041, 0x0e85f036), TOBN(0xe1bb263e, 0x4c8d9768),
+     TOBN(0x4fcc1d44, 0xe3917798), TOBN(0x274d1d90, 0x07abcde4),
+     TOBN(0xc9b8ae9f, 0xb7a10472), TOBN(0x6632e3be, 0x8d10e8ec),
+     TOBN(0xb6876fb0, 0x50f3a172), TOBN(0x753692d4, 0xb4cf4867),
+     TOBN(0xfe3624e6, 0x58e598f7), TOBN(0x15f90418, 0x6d81fb40),
+     TOBN(0xae762f7b, 0x9bea3649), TOBN(0xc48d2262, 0x161e85cb),
+     TOBN(0x8e8726a1, 0xcf5a21f0), TOBN(0x536c441f, 0xa1f6653b),
+     TOBN(0x0716bad0, 0x67ec5b86), TOBN(0xa423a957, 0xb2147d1f),
+     TOBN(0x8eec96c8, 0xdca2e393), TOBN(0x3619e36d, 0x2843ef12),
+     TOBN(0xdc16fe2d, 0x2ef695e1), TOBN(0x04ed2cad, 0xffea8124),
+     TOBN(0x5018a0ce, 0x180ce636), TOBN(0xc34b0bbf, 0xdce7b2f8),
+     TOBN(0x645a02a9, 0x0c54fc30), TOBN(0x6ee6772b, 0xf3f819d9),
+     TOBN(0xe2bbbdcd, 0x7cecded6), TOBN(0x9ae4fd55, 0x3f038851),
+     TOBN(0xc30664ab, 0xa2f316c7), TOBN(0x3cccf4a1, 0x63ffb50a),
+     TOBN(0xc37ee6ca, 0xd00fb8f2), TOBN(0x593db6d5, 0xad906eb1),
+     TOBN(0x8f75b594, 0x4aa84505), TOBN(0xeff39d82, 0x9e5939f0),
+     TOBN(0x4b7fab3c, 0xc064f530), TOBN(0x731153ae, 0xde175892),
+     TOBN(0x335e6503, 0x3d4c4e60), TOBN(0xb0876a8a, 0x776ce13a),
+     TOBN(0xa8a566ee, 0x22241ecd), TOBN(0xb7456b3e, 0x011e861c),
+     TOBN(0xa9aff4eb, 0x177dd490), TOBN(0x189b1ed9, 0xc8f77c40)},
+    {TOBN(0x624de687, 0x2857a1fc), TOBN(0xbd0a0d9c, 0x2ff8f505),
+     TOBN(0xeecb4fad, 0xc381bc9a), TOBN(0x72386292, 0xfa94e41b),
+     TOBN(0x354d3f83, 0xe75fc753), TOBN(0x06afc753, 0xa7a5a6bf),
+     TOBN(0x1ce792ee, 0xb2f568dc), TOBN(0xc5faaee3, 0xbd2f9647),
+     TOBN(0x175fbeb0, 0xf912b74f), TOBN(0x45fbe8e1, 0x6e0ceedd),
+     TOBN(0xf0e1aa68, 0xd9233ee7), TOBN(0xe55fc1ce, 0x406a626e),
+     TOBN(0x20efa1b9, 0xe08712e7), TOBN(0x5fd108b5, 0xbcfd6360),
+     TOBN(0xea431df6, 0xeec1edac), TOBN(0xae1c0521, 0x940803f1),
+     TOBN(0x584a16d0, 0x15407ffe), TOBN(0xa977f702, 0x08a82a69),
+     TOBN(0x52eefecf, 0x67f8a198), TOBN(0xec213738, 0x19f7a7e0),
+     TOBN(0x6795cfef, 0x35987b9a), TOBN(0xb243403b, 0x97028480),
+     TOBN(0xac24b12b, 0x9c1b9124), TOBN(0x1f379501, 0xa90f8aeb),
+     TOBN(0xa8e97fb6, 0x64bc0f09), TOBN(0x0b913991, 0xc953cd08),
+     TOBN(0x8385a1b3, 0x7fc3bf00), TOBN(0xb6e74dec, 0xb09ccd8f),
+     TOBN(0x6e1df026, 0xec473ea7), TOBN(0xf2f7fbbe, 0x530766bd),
+     TOBN(0xf18cb47a, 0x3292052b), TOBN(0x7f8d4592, 0x9114866a),
+     TOBN(0xf0a1c565, 0x8bfa2c22), TOBN(0xc28518c3, 0x2b326c0e),
+     TOBN(0xabafc6f0, 0xec107d66), TOBN(0xbc7a6abf, 0x8478907a),
+     TOBN(0x8c1c8f6a, 0xa2920288), TOBN(0x6c87579d, 0x930c043e),
+     TOBN(0x25ee808d, 0xb309696d), TOBN(0x433bbbda, 0xb7a71041),
+     TOBN(0x48d6d957, 0xb3086691), TOBN(0x9946a29b, 0x26640916),
+     TOBN(0x932ca93c, 0x43db59a9), TOBN(0xaa61a0c5, 0xe4fe91ba),
+     TOBN(0x9e22e112, 0x815bf003), TOBN(0xa9ed1b18, 0xc86ba8d3),
+     TOBN(0x1b5d3c14, 0x1069f434), TOBN(0x3cd2ebd0, 0x1cc01754),
+     TOBN(0x5c06b244, 0x3350f670), TOBN(0x7557dc9d, 0xf6f9c751),
+     TOBN(0xa7ebd3b8, 0xde66fd97), TOBN(0xc126dbaa, 0x2befe6fe),
+     TOBN(0x312f4897, 0x396f434a), TOBN(0xe05cfcd6, 0x61a4124d),
+     TOBN(0xc83b8688, 0x1525c05e), TOBN(0x4646dbf2, 0x11899f64),
+     TOBN(0x2b7507cb, 0x8e419e08), TOBN(0x785328d7, 0xaf855eec),
+     TOBN(0x875db0c7, 0x7b8683a5), TOBN(0x3d1bc968, 0x90a597e9),
+     TOBN(0x7d4afa10, 0x47eeeab4), TOBN(0x2668dd43, 0xd680ca71),
+     TOBN(0xc3210d1f, 0x17365023), TOBN(0xd5bb2ee4, 0x17fb31cc),
+     TOBN(0xbefb6a4f, 0x08e9ba09), TOBN(0xc6beedb8, 0xb0c1b6e1),
+     TOBN(0x59daf057, 0x3510ef35), TOBN(0x604047cf, 0xdbbabc65),
+     TOBN(0xfabc80a8, 0xa06b7340), TOBN(0x7433dee7, 0xdf765977),
+     TOBN(0x149a2c4a, 0xfd807cfb), TOBN(0x14e8ad3b, 0x3480a086),
+     TOBN(0xb0c3156f, 0xb22c5f89), TOBN(0xd10ece4a, 0xbf78675a),
+     TOBN(0xe270e317, 0x80b8ad9f), TOBN(0xfe7a6210, 0xb0c2b420),
+     TOBN(0xf091d738, 0x125ef635), TOBN(0xf1f277d6, 0xc1a6f202),
+     TOBN(0xe2727e7b, 0x3587d9bb), TOBN(0x83b209a9, 0xb3e2b84b),
+     TOBN(0xc9eb445d, 0x7a13effa), TOBN(0x89b856f1, 0x0d697480),
+     TOBN(0x834bbae2, 0x25c03cb7), TOBN(0x0d8adb85, 0xe0b4a7b2),
+     TOBN(0x7b6884af, 0xc7fbc240), TOBN(0x6b485409, 0xaa4f9097),
+     TOBN(0x4d0a367f, 0x290c106f), TOBN(0xab87d218, 0x3f0efdfd),
+     TOBN(0x15b9bab7, 0x50f2b65b), TOBN(0xa7403d4b, 0x5e5d53e4),
+     TOBN(0x2e23e376, 0x28529212), TOBN(0x6fe903a2, 0x6e050767),
+     TOBN(0x4c5291a1, 0x6cf570fb), TOBN(0x4bfb8607, 0x7a30b326),
+     TOBN(0xec4905f8, 0x27c572a9), TOBN(0x72eeb8c9, 0x0f381c31),
+     TOBN(0x33346cec, 0x460adca0), TOBN(0xd4d5bba8, 0x7b34756a),
+     TOBN(0x02b2e2d4, 0xeac84add), TOBN(0xa129845b, 0xdc1053b5),
+     TOBN(0x53f067e0, 0xdca6f9ce), TOBN(0x6e9998ed, 0x3526aba6),
+     TOBN(0xa4aef9e2, 0x1c0982da), TOBN(0xfe5b606e, 0x93f5d96f),
+     TOBN(0x26b8502e, 0x9c14b699), TOBN(0xf1bcdca6, 0x0948a291),
+     TOBN(0x73e43a32, 0x2aefd415), TOBN(0x7f523357, 0xd1e2cfb5),
+     TOBN(0xa60151c0, 0x97d3fa94), TOBN(0x820c0d58, 0x72129630),
+     TOBN(0xb8f2e1ed, 0x5854acf5), TOBN(0x86d6646c, 0x3c656ac3),
+     TOBN(0x2284a612, 0xbef1d0da), TOBN(0x2e7c5f4e, 0xa8c8faba),
+     TOBN(0xfd441ae7, 0x70303ea3), TOBN(0x9613f329, 0x5161cf82),
+     TOBN(0x65a3cc65, 0x2e19531f), TOBN(0x177a2775, 0x34281f69),
+     TOBN(0x0cc692a4, 0x7c82e094), TOBN(0x9d62a55b, 0xb6f377f0),
+     TOBN(0xa24cf6ac, 0xf96ec2b8), TOBN(0xd06747c3, 0xa961cc16),
+     TOBN(0x57c7001c, 0xbd17f0a2), TOBN(0x5f298db0, 0x34afe2d6),
+     TOBN(0x51b01ef2, 0xdf12f671), TOBN(0xc01c5066, 0x5ce712fe),
+     TOBN(0xac0f4034, 0x92a74776), TOBN(0xa3e9934f, 0x08d696bd),
+     TOBN(0xafb6981a, 0xe7daaff8), TOBN(0x5f8998d9, 0x73bdcafc),
+     TOBN(0x23ec39e1, 0xbaf9906c), TOBN(0x5e248410, 0xc999c9c0),
+     TOBN(0xd14c7a89, 0x17dad895), TOBN(0xfde9d01a, 0xcbb3f6b9),
+     TOBN(0x1d6b26ef, 0x5f698f1b), TOBN(0xc6495cd1, 0xf0baff97),
+     TOBN(0x5a72dc07, 0x587674ec), TOBN(0x100f9ff0, 0xdb09cd65),
+     TOBN(0xec0fb71f, 0xb30cf6e6), TOBN(0xf54cb597, 0x81066143),
+     TOBN(0x0090e997, 0x633857c4), TOBN(0x7326ed15, 0xda92c5d2),
+     TOBN(0x794cd8af, 0x47c56e86), TOBN(0xb272112f, 0xf89214c9),
+     TOBN(0x37960861, 0x3445879d), TOBN(0xc5e496b0, 0xf2fcfc55),
+     TOBN(0xfe74e95f, 0x6559e153), TOBN(0x1e18b2b5, 0x54a772af),
+     TOBN(0xd146980c, 0x157c157c), TOBN(0x31ee3f25, 0xa11d77b5),
+     TOBN(0x7762a07d, 0x5707db6d), TOBN(0x00804bcb, 0xbd2022b8),
+     TOBN(0xdf3f4658, 0xd571c59e), TOBN(0xc49e7a34, 0xcf45c1ee),
+     TOBN(0xf401ba3d, 0x43972cff), TOBN(0x146d989c, 0xe509c2b6),
+     TOBN(0x7c68d6c8, 0xeb72392f), TOBN(0xdd048de5, 0x0658b8e6),
+     TOBN(0xc9dc61b7, 0x9a0aeb72), TOBN(0x98b080e0, 0xb741d644),
+     TOBN(0xa6ec0eed, 0xb1c5982a), TOBN(0x58d28317, 0x5ebbc26f),
+     TOBN(0xac8f1e1e, 0x33e5b7dc), TOBN(0x31e4f65e, 0x9d8f9fed),
+     TOBN(0x6c9af383, 0x904ad76d), TOBN(0xfc38c53c, 0x9bdb0517),
+     TOBN(0x9ae278ee, 0x0e69f85e), TOBN(0x18b362b7, 0xefd9d887),
+     TOBN(0x65a5f74b, 0x5bbbd3ac), TOBN(0x41eb4593, 0x077bfb4f),
+     TOBN(0xb642934b, 0x83b38100), TOBN(0x643ceed7, 0xac1a99bb),
+     TOBN(0x9c27e66d, 0xee7cd5f7), TOBN(0x2ccf87d5, 0x6ddbaa6b),
+     TOBN(0xd51ca739, 0x447b1192), TOBN(0x78471053, 0x95f5f142),
+     TOBN(0x915f50cd, 0x3a650829), TOBN(0xe032bdc5, 0x898a6a1c),
+     TOBN(0xde8fb4f1, 0x2d15959f), TOBN(0x1fc5fc73, 0xbad56140),
+     TOBN(0xdafbf206, 0x8e60c3c3), TOBN(0x4963dc95, 0xe428adb5),
+     TOBN(0x1538e081, 0xd49584fb), TOBN(0xb34add66, 0xbc0e5fa9),
+     TOBN(0x404ecf12, 0xa7f28b2f), TOBN(0x6ddc3ce1, 0x7fa9c435),
+     TOBN(0xda887e3f, 0x61ee755e), TOBN(0x4b5da661, 0x8f71280a),
+     TOBN(0xee5a86df, 0xdc79a4cd), TOBN(0xd8514b8a, 0x99be4d36),
+     TOBN(0x674793ea, 0xcc82c751), TOBN(0xf3a2123a, 0x437aedcd),
+     TOBN(0xf825ff37, 0xfcd6f027), TOBN(0x60a056d8, 0xa681a001),
+     TOBN(0x92a39248, 0xaa92c135), TOBN(0x61884e23, 0xdcd190a7),
+     TOBN(0xec0d1420, 0x24cc911c), TOBN(0xbdb0baae, 0x5aa16ad7),
+     TOBN(0xf12726b5, 0x8a1694d7), TOBN(0x8c7cf113, 0xc93673f9),
+     TOBN(0x02fb6c69, 0x7f2edc38), TOBN(0xcc4d4304, 0x2fbe8690),
+     TOBN(0x405b2491, 0xe89c80d5), TOBN(0xdef46c76, 0x3d938bc1),
+     TOBN(0xd92ec0fa, 0x2520e3b0), TOBN(0x2501cfa3, 0x1fe2dfda),
+     TOBN(0xe7c5753d, 0x1d5c8474), TOBN(0xc059abc0, 0xe6226dcf),
+     TOBN(0x2dceefe6, 0x55a9011d), TOBN(0x8799064a, 0xbbbbef00),
+     TOBN(0x7fe944c2, 0x0b49b5ef), TOBN(0x722bbef0, 0x225b21dc),
+     TOBN(0x84687cbb, 0xd2bb14af), TOBN(0xfc4ab4f0, 0x9b6f6caf),
+     TOBN(0xb7b7bb59, 0x2c146a52), TOBN(0xb90d67f2, 0x1dfea10b),
+     TOBN(0xca4ca8c8, 0x713e1d30), TOBN(0x50cbb994, 0xf8a13db8),
+     TOBN(0x2bee12b2, 0xa5b0e3e5), TOBN(0xa7c5d6d1, 0xe71e19fb),
+     TOBN(0x28442423, 0x9e0314cd), TOBN(0xc95c2746, 0x66cda5c0),
+     TOBN(0xfe52a79a, 0x1c5ffd19), TOBN(0xb93875cc, 0x38a0339f),
+     TOBN(0x6a94196c, 0xb49fb049), TOBN(0xbeb1eb4b, 0xcc12a38d),
+     TOBN(0xbc136771, 0xf5e8d167), TOBN(0xa91e1232, 0xd5f8ae87),
+     TOBN(0xb2e812c7, 0x95172460), TOBN(0xc699d376, 0xb8f81870),
+     TOBN(0x9e4a3b70, 0xa8900827), TOBN(0xe0d4b2f4, 0x506c0b29),
+     TOBN(0x13b4d1c7, 0x7246fd96), TOBN(0x84ea2158, 0x33965581),
+     TOBN(0x9b9f071b, 0x2e53c024), TOBN(0xcb005908, 0x864a1b78),
+     TOBN(0x03daddf5, 0x3f742c2f), TOBN(0xd29230e5, 0xdf595911),
+     TOBN(0x3f7d4e6b, 0xca0406a1), TOBN(0xeb646f66, 0xb1db7e47),
+     TOBN(0xb896003e, 0x590e3107), TOBN(0x7a0dc361, 0xf754ac01),
+     TOBN(0xe877a6f3, 0xe63ab0ac), TOBN(0xd43b54f3, 0xdf60d307),
+     TOBN(0x65ef91ba, 0x59cf0add), TOBN(0x35e99393, 0x18990eb4),
+     TOBN(0xc186ab16, 0x8e46fbf6), TOBN(0x4c0eb22f, 0x8c1eaa91),
+     TOBN(0x4599b894, 0x1abd31f0), TOBN(0xdb34198d, 0x9a1da7d3),
+     TOBN(0xa8b89523, 0xa0f0217d), TOBN(0x2014cc43, 0xe56b884e),
+     TOBN(0x6fb94f88, 0x49efd4ee), TOBN(0xf1b81710, 0x287f4ae0),
+     TOBN(0x89d38a9a, 0x99fd2deb), TOBN(0x8179277a, 0x72b67a53),
+     TOBN(0x0ef6ce56, 0x1a03755b), TOBN(0x8dc768f2, 0xfcdb3469),
+     TOBN(0x0be58a91, 0xa21d959d), TOBN(0xea44861a, 0x9b103cd0),
+     TOBN(0x332e86e7, 0x808b8a46), TOBN(0x9882015c, 0x8772c3f8),
+     TOBN(0xe6b272fe, 0x9f4b5d29), TOBN(0x0e183a28, 0xa29b023b),
+     TOBN(0xf2fab88f, 0x2286ebf3), TOBN(0xb7532ced, 0xfce83e6f),
+     TOBN(0x17999d7c, 0xe0cde4fc), TOBN(0x7230fd85, 0xc1b7668a),
+     TOBN(0x97a57d39, 0xef588309), TOBN(0x7e175f28, 0xf906f6e7),
+     TOBN(0x51f67413, 0x72b70bfe), TOBN(0x2132f595, 0x2f82218c),
+     TOBN(0x9cc0746e, 0x9d8727cb), TOBN(0xa2af77fb, 0xbba1ec8e),
+     TOBN(0xc75aee60, 0x31a67cc9), TOBN(0xaeab9e0f, 0x57408325),
+     TOBN(0xf24de697, 0xec34bb89), TOBN(0x06b90039, 0x5d958bdf),
+     TOBN(0x6f55222e, 0x0603d6cc), TOBN(0x496537b5, 0x2eb0b239),
+     TOBN(0x083e5889, 0x8be08323), TOBN(0xc573596e, 0xf8dc0a78),
+     TOBN(0xc3e988fa, 0xe8901eca), TOBN(0x7f7b48f6, 0x6e350257),
+     TOBN(0xed820567, 0xa216e329), TOBN(0x55f46737, 0x8ce989c1),
+     TOBN(0x7f48c5f1, 0xeeab9441), TOBN(0x1d3cac11, 0x86fe0831),
+     TOBN(0xe0364bae, 0x408a0306), TOBN(0xe8d8aba0, 0x7a4eb2cb),
+     TOBN(0xe548725e, 0x1fd7d5da), TOBN(0x8de04491, 0xed5ed958),
+     TOBN(0x3e75eba2, 0x61d73977), TOBN(0x4f580400, 0x55420386),
+     TOBN(0x54642fa4, 0xd859a690), TOBN(0x2c905f7e, 0x296e336e),
+     TOBN(0x4e287e66, 0x22e260bc), TOBN(0x71a2ec99, 0x4a28d5bd),
+     TOBN(0x5528da21, 0xa7c5c3e3), TOBN(0xae9f6856, 0xa49471e0),
+     TOBN(0xdcd8e66b, 0x587cd94f), TOBN(0x91afbd79, 0x6c7b7db8),
+     TOBN(0xdf2e6625, 0x067e3cdd), TOBN(0x15b5a329, 0xa6375f59),
+     TOBN(0x3b8b3b1d, 0xb6586c5f), TOBN(0xe4d50a77, 0xd34f10fb),
+     TOBN(0x26cb86f5, 0x7c3c01f7), TOBN(0x36e9d3cc, 0x8c57e6f7),
+     TOBN(0xaa8e7ce1, 0x62c6dbae), TOBN(0x7f6b7689, 0x60d7fae5),
+     TOBN(0x519a7659, 0xc797ee16), TOBN(0xa1c7b30e, 0xb36a6b1b),
+     TOBN(0x8da05ba6, 0x74dff201), TOBN(0xd2eac07f, 0x40d0a835),
+     TOBN(0x2701eb31, 0x610a7d6f), TOBN(0x5c17a91e, 0xbf893c4f),
+     TOBN(0x68b92e88, 0x6bc8b161), TOBN(0xa312fd5b, 0xf52e6ec0),
+     TOBN(0xf7daf460, 0x6b7952cf), TOBN(0x847f0cf3, 0x18aeb57a),
+     TOBN(0x27b178ed, 0xb0146708), TOBN(0x85a23554, 0x54ca2aa5),
+     TOBN(0x80dd123c, 0x395a7b16), TOBN(0x64a9337b, 0x0058bfce),
+     TOBN(0xf6ae9380, 0xf4addc4a), TOBN(0x0f84385a, 0x464536f1),
+     TOBN(0x41fc2270, 0x16534f6c), TOBN(0x13d8976f, 0xb8795ec3),
+     TOBN(0x2e90b3e4, 0x8e12c560), TOBN(0x242a86ec, 0x239b2c58),
+     TOBN(0x6fb42ecc, 0x0768275c), TOBN(0xee341cd0, 0xbd96de9e),
+     TOBN(0xfd1833ac, 0x84355d11), TOBN(0xf062392c, 0x5f55ec6c),
+     TOBN(0x6ee7b59b, 0xfee33fba), TOBN(0x8113f0ca, 0xabf86e0f),
+     TOBN(0x2285aaaf, 0xcc68033c), TOBN(0x850b732b, 0x78430646),
+     TOBN(0x50fa4b61, 0x2b3fa03d), TOBN(0x4d893ecc, 0x3caf050d),
+     TOBN(0x454764e6, 0x988df419), TOBN(0x055d8a4b, 0xfb61f1a4),
+     TOBN(0x3b7c5f4b, 0x8475e07a), TOBN(0xf93a198b, 0xa6a228e4),
+     TOBN(0xe0a8ce61, 0xec8d566a), TOBN(0xe41397d6, 0xc55f4bd6),
+     TOBN(0x4cc18d48, 0x654bdf55), TOBN(0xe1b49f9e, 0x9325ac25),
+     TOBN(0x79840752, 0x72c68871), TOBN(0x8930d8b5, 0x6d806fe8),
+     TOBN(0x11c8b5a8, 0x0bd5f65e), TOBN(0xe931c025, 0xbf37d7a8),
+     TOBN(0x25b17fd9, 0xae8af083), TOBN(0xd589fd8b, 0xde4215ed),
+     TOBN(0x56378f04, 0x4b3f61fd), TOBN(0xf0f39213, 0x6bfb4f9a),
+     TOBN(0x6b0f9596, 0xe906cc6a), TOBN(0x441f13da, 0x096f8296),
+     TOBN(0x08f933d4, 0x1e4940e0), TOBN(0x6c35391c, 0x5a53e7ee),
+     TOBN(0x5f41c4d3, 0x19c3d18e), TOBN(0xc0804e09, 0x1d389d95),
+     TOBN(0x7323a9ab, 0x18a5a3f2), TOBN(0x7b7c2475, 0x410a6381),
+     TOBN(0xd362eb9a, 0xb02cfe18), TOBN(0x79ef3d0a, 0x553b2970),
+     TOBN(0x371f7760, 0x3d2acdab), TOBN(0x6cd37890, 0x7f241dfd),
+     TOBN(0x592a242e, 0xdf4a28e4), TOBN(0x1e623cdc, 0x1bb45217),
+     TOBN(0x5a9633a6, 0x494074d3), TOBN(0x81b74307, 0xd52fbfd8),
+     TOBN(0x98292651, 0xdec4c5ff), TOBN(0xe1b7bc86, 0x3e0f6edf),
+     TOBN(0x3d5fd86a, 0x6bb8fb31), TOBN(0xa830e9a2, 0x1cf29f19),
+     TOBN(0xfffc5482, 0xcf69c747), TOBN(0x7748a0f4, 0xa83549fd),
+     TOBN(0xba1c8a0d, 0xe7ccf4a6), TOBN(0x6cd1399a, 0xa2ede6b7),
+     TOBN(0x8fb634e6, 0x87bb90d9), TOBN(0xfa8e659b, 0xc59a5304),
+     TOBN(0xcd6bfc75, 0xa9122d95), TOBN(0xdb107def, 0xdfa6d75a),
+     TOBN(0xb0ec4cfc, 0xcc27760a), TOBN(0xf24c1e22, 0xbed3a1a1),
+     TOBN(0x4f8522a1, 0x819bffc7), TOBN(0x263c7b5b, 0xa93d97e1),
+     TOBN(0xab1d31e0, 0xa4b4de49), TOBN(0x374e968b, 0xebbfe8f5),
+     TOBN(0xe82e9756, 0x51ca0d08), TOBN(0xc05715a2, 0x7df3f2df),
+     TOBN(0x941f02c5, 0x038004ad), TOBN(0xc136a2a5, 0xa0fd46d4),
+     TOBN(0x85db7d24, 0x3d31d26c), TOBN(0x05bba6af, 0xbfefeecc),
+     TOBN(0xf803b539, 0x5a60aebf), TOBN(0x9bb8a479, 0x813d0e6d),
+     TOBN(0xb689c813, 0x066abdfb), TOBN(0xd93b3f4b, 0x0072e530),
+     TOBN(0x242140a4, 0x987446ad), TOBN(0x40b3f709, 0x06a02f0c),
+     TOBN(0x33f9bf20, 0xa0fd6018), TOBN(0x58517c18, 0xf21abfdc),
+     TOBN(0xa33dc5db, 0xc1f80f3f), TOBN(0xbb7dfe27, 0x7ec91c80),
+     TOBN(0xd2cf9338, 0x8ca97dd8), TOBN(0x5761f871, 0x32e43d44),
+     TOBN(0x3c8ffb0e, 0xe513ea90), TOBN(0x91ecda36, 0x79bcdecc),
+     TOBN(0xdad3fdd5, 0x9b1a5514), TOBN(0x8fb630f9, 0x640d3af0),
+     TOBN(0x82949b09, 0xf9d2e0be), TOBN(0x079ca0ff, 0xeba23663),
+     TOBN(0x51e62c53, 0x135238d4), TOBN(0xf5fa0c61, 0xc446bd67),
+     TOBN(0x19dcdd2f, 0xe8da43d6), TOBN(0x46fbf7ea, 0x95f29b5b),
+     TOBN(0x7f3eaa05, 0x635e8388), TOBN(0x5ef817c3, 0x5369750b),
+     TOBN(0x06025893, 0xc860c4aa), TOBN(0xa2f6684d, 0x5551c9ef),
+     TOBN(0xd6af67dc, 0xfbc0c667), TOBN(0xfd8d7394, 0xcd2fe44b),
+     TOBN(0x011968ae, 0x302a17cc), TOBN(0x2206ff24, 0xc3e5a5cb),
+     TOBN(0x4c7f0df3, 0xa20dbfb7), TOBN(0x59566376, 0xa395dd6f),
+     TOBN(0x68ff3d9f, 0x373ea76b), TOBN(0x2394f93a, 0xf6cf8ada),
+     TOBN(0x3acc5dba, 0xe7514a94), TOBN(0x0340da7a, 0x5ddfa11b),
+     TOBN(0xc3f03022, 0x1a05155d), TOBN(0x6cbbdc6b, 0x4f7656c0),
+     TOBN(0x6e30dbdd, 0x0b0875f5), TOBN(0x5e7c2883, 0x3471b0d5),
+     TOBN(0x49cfd71c, 0x408b4bc8), TOBN(0xd29a184e, 0xf01c002b),
+     TOBN(0x308be85c, 0xff415b0f), TOBN(0x1b4176f0, 0x01a8fe7d),
+     TOBN(0xb850acc7, 0x0c33bed3), TOBN(0x76aac640, 0x23af7af0),
+     TOBN(0x049187ee, 0x21d5853f), TOBN(0x44fbf6e5, 0x6620195c),
+     TOBN(0xf0abf14b, 0x36158178), TOBN(0x9866ffca, 0x90e419c2),
+     TOBN(0x7522e277, 0x9e8523a8), TOBN(0x2f2590f3, 0x08e90f1d),
+     TOBN(0xde1c0c52, 0x66d3f75b), TOBN(0x47dc9ceb, 0x6c299b57),
+     TOBN(0x4ad12847, 0x51f7f2b5), TOBN(0xeedf9d8d, 0x452b07a5),
+     TOBN(0x207b0627, 0x3dad76c6), TOBN(0xccbb5201, 0x5d4c0280),
+     TOBN(0x0bdca05b, 0xb019ae8d), TOBN(0xb5f8d088, 0xf2da7eb4),
+     TOBN(0x4e79a0be, 0x4626c00c), TOBN(0xf6fdd64f, 0x5af82c0f),
+     TOBN(0x7a828224, 0x5f7cba0f), TOBN(0xc2214834, 0xb0765493),
+     TOBN(0x5b0d0d1a, 0xabd53ccf), TOBN(0x3b03a22d, 0xf4a1b517),
+     TOBN(0xb235c862, 0x6ece453e), TOBN(0xf43ac344, 0xf66471c7),
+     TOBN(0xeaff93dd, 0xa1552fa5), TOBN(0xef1b40dc, 0xcf3ae702),
+     TOBN(0x35ced3fd, 0x9ca613a4), TOBN(0x90e350ab, 0xa2f33a0d),
+     TOBN(0x47bb89aa, 0x002b5738), TOBN(0xafc01bba, 0x032b8b08),
+     TOBN(0x688ae119, 0x61588b4b), TOBN(0xdb7d820a, 0xcf66ef14),
+     TOBN(0x83b654db, 0x084910bf), TOBN(0xbb581f8b, 0x60ea75a1),
+     TOBN(0x6917f282, 0x1cdae7c4), TOBN(0xb719f931, 0xa40a07c3),
+     TOBN(0xf8efb8b9, 0x31297b3b), TOBN(0x74246ded, 0x4d6fc5c6),
+     TOBN(0x5a111754, 0xd2c61503), TOBN(0xf64d2b88, 0x71654764),
+     TOBN(0x4b452692, 0x6ad8f168), TOBN(0x907beb21, 0x0cc6fc91),
+     TOBN(0xe876d523, 0xbf13c18b), TOBN(0x4d28e457, 0x4cf37ca1),
+     TOBN(0x4c0dc22d, 0x6d3d1172), TOBN(0x7935a8d2, 0x5a753137),
+     TOBN(0x03484e3d, 0xda44d652), TOBN(0x05a3d80f, 0xc50025a9),
+     TOBN(0x6d43c503, 0xff477c6d), TOBN(0x35f4c4cf, 0x1ccd416a),
+     TOBN(0x7070f471, 0xd5088349), TOBN(0x678460ca, 0x281d30c8),
+     TOBN(0x8923cd9a, 0xc6defb33), TOBN(0x44930f56, 0xe2557cab),
+     TOBN(0x33b020bb, 0xad156c4a), TOBN(0xfdab31e3, 0xbcaf4805),
+     TOBN(0xffe79bec, 0x864b5564), TOBN(0x0510e352, 0x10c60d52),
+     TOBN(0x66203aaf, 0x328a652e), TOBN(0x9d5403bf, 0x54fea042),
+     TOBN(0xb3fe6743, 0x6e5e5c7c), TOBN(0x6deef667, 0xecc66e02),
+     TOBN(0x199ee152, 0x44eacacb), TOBN(0x9f49fcd4, 0xd8803fd9),
+     TOBN(0xdd5fee9e, 0x2d3a6e28), TOBN(0x8eed56d4, 0x686d8ca3),
+     TOBN(0x36889a27, 0x78083491), TOBN(0xea1a6555, 0xbef20457),
+     TOBN(0xe7e6b609, 0xa501e2a3), TOBN(0x1ea0ae29, 0xfb23de2f),
+     TOBN(0x5f537d07, 0x632c9a6b), TOBN(0x61770d1f, 0x9a3db961)},
+    {TOBN(0x325c60db, 0x7497e8a5), TOBN(0x05d8eab8, 0x8c6949a9),
+     TOBN(0x3169e466, 0xc7bd5898), TOBN(0xadc06264, 0x192d8e3f),
+     TOBN(0x1ff468f4, 0xd55959fe), TOBN(0x97b33ee0, 0x202dba19),
+     TOBN(0xaa0c3fe2, 0x21cf84bb), TOBN(0x48cdc0af, 0x04a8d176),
+     TOBN(0x53d8c448, 0x9c0d4009), TOBN(0xd3714617, 0x2e24dbaa),
+     TOBN(0xdd92e730, 0x9b62e5f1), TOBN(0x97b344d7, 0x9922cc8a),
+     TOBN(0x416b009b, 0x0bfe3e8f), TOBN(0x56873834, 0xf3c82269),
+     TOBN(0xf82a980f, 0xe6623555), TOBN(0xb027ecaa, 0x5ce68e54),
+     TOBN(0x005a4b24, 0xfe87680d), TOBN(0xd92532dc, 0x4cf6ee32),
+     TOBN(0xfcd27c8c, 0x4bd3e01f), TOBN(0xda7d9949, 0xe1b59ffa),
+     TOBN(0xe3d5f31f, 0x2735d373), TOBN(0x7e139ca5, 0x288e71fb),
+     TOBN(0xe474bc80, 0x93979cb4), TOBN(0x7f4f6017, 0xf6fcc665),
+     TOBN(0xe6982c86, 0xfbd613c3), TOBN(0xf4af69d5, 0xc366f17a),
+     TOBN(0x8683eed6, 0xb85c2343), TOBN(0xf5bb244a, 0x24bc2116),
+     TOBN(0x997a74bc, 0xc9fc77d4), TOBN(0xe202eb91, 0x6f44b54b),
+     TOBN(0x77886412, 0xa6997e76), TOBN(0x6996c8fb, 0x02c8837e),
+     TOBN(0x0986df8a, 0x2c61382c), TOBN(0x90607b92, 0x667c8ee9),
+     TOBN(0x051fcbf7, 0x084eacde), TOBN(0x84e3dba4, 0x6e685877),
+     TOBN(0x35861a82, 0xe458da50), TOBN(0xd036823f, 0xcf392b51),
+     TOBN(0x43181481, 0x3dd86e74), TOBN(0x8dcfe17d, 0x3741a385),
+     TOBN(0x8e1a77cf, 0x40f56786), TOBN(0xc5bca7f6, 0x6d4b7774),
+     TOBN(0x86b588a0, 0xc81ec077), TOBN(0x88952a01, 0x9206354f),
+     TOBN(0x5444a989, 0x43a8519a), TOBN(0xe29dd68c, 0x2857b210),
+     TOBN(0x36658903, 0x9a144624), TOBN(0x8c4dedb0, 0xe423e899),
+     TOBN(0x482040c5, 0xea886e5c), TOBN(0x42fe5a56, 0x1cdd50f7),
+     TOBN(0xf034f132, 0x453b6e7f), TOBN(0xba3fa97d, 0xb3c69762),
+     TOBN(0x34262560, 0xcadb598e), TOBN(0x7ed74b51, 0x07afe0a8),
+     TOBN(0x2261d849, 0xebe0e8bb), TOBN(0x23747e55, 0x608cea1c),
+     TOBN(0xb2e9371c, 0x902c343d), TOBN(0xf57b2de8, 0xda4fdba1),
+     TOBN(0x43f9afa4, 0xb67703a1), TOBN(0xeafafb41, 0xf79fe203),
+     TOBN(0xfec99dc9, 0xf649a494), TOBN(0x14799ef9, 0xfe378232),
+     TOBN(0xba3f8114, 0x7184e31e), TOBN(0x0abbb815, 0xdc0e987f),
+     TOBN(0x1dc7221f, 0x6fb5d02c), TOBN(0xa0dfb113, 0x40f1607c),
+     TOBN(0xd217f238, 0xdbe8db86), TOBN(0xc02547eb, 0xe91f2859),
+     TOBN(0x41df6bcb, 0xa98d0875), TOBN(0xf51a8077, 0x78f6be54),
+     TOBN(0x3ebdf28d, 0xba66bef5), TOBN(0xc65c7b38, 0x9175ec20),
+     TOBN(0x2302981d, 0x475589d5), TOBN(0xbd479708, 0x199d8ad4),
+     TOBN(0xcb508be9, 0x8db46795), TOBN(0xba1e066e, 0x6b224eb4),
+     TOBN(0xae909633, 0x1326ab8a), TOBN(0xac989728, 0xf5bbe5e6),
+     TOBN(0x1de663f5, 0xb1729b41), TOBN(0x2018f58c, 0x00c3d293),
+     TOBN(0xe647c0e6, 0x71efe25b), TOBN(0xaa30f871, 0x6104ebd6),
+     TOBN(0x1003eebe, 0x3c166de6), TOBN(0x0c308538, 0x1cbc42d3),
+     TOBN(0x98b6c312, 0x56cba120), TOBN(0x9065ae66, 0x860d2916),
+     TOBN(0x2162062b, 0xa7dabb6b), TOBN(0x1422386b, 0x8e011036),
+     TOBN(0xd2589ad6, 0xe069de1c), TOBN(0x3fe8e67a, 0x7ee09300),
+     TOBN(0x5b881860, 0x2f8ae49b), TOBN(0x186a1482, 0x263a6a90),
+     TOBN(0xc6079b39, 0x9b35b33a), TOBN(0x6c38d789, 0x53d3411d),
+     TOBN(0x743c4462, 0x720b2f99), TOBN(0x4d903dd7, 0x29e14d08),
+     TOBN(0x625dfce0, 0x7b963913), TOBN(0x60a83daf, 0xcc65e41f),
+     TOBN(0x9e88c26c, 0x93e185a2), TOBN(0x6d950e92, 0x13707ac3),
+     TOBN(0xbd7df2dc, 0xa0a23dd0), TOBN(0x5fad27f2, 0xc2116cc8),
+     TOBN(0x0703b868, 0xda4430be), TOBN(0x5ebf0e2f, 0x83cc41df),
+     TOBN(0xebb91900, 0xf9e83fc8), TOBN(0xf9539591, 0x6d60bb8a),
+     TOBN(0x3bdd7a8b, 0xb604935a), TOBN(0x2cae8c67, 0x64e5eec0),
+     TOBN(0x30cf58bb, 0x60aaf21d), TOBN(0x5e0f6f5d, 0x359f63cc),
+     TOBN(0xda245055, 0x0547e03a), TOBN(0xa83fd8bb, 0xb9e143ce),
+     TOBN(0xa564435a, 0x1b0215aa), TOBN(0xecffccec, 0x354ba769),
+     TOBN(0xd846149a, 0xbdbbd594), TOBN(0x9137df36, 0x65dd1597),
+     TOBN(0xc4f39f37, 0xa9f3ac33), TOBN(0xf594bb74, 0x961d7e8d),
+     TOBN(0x41fa4b58, 0x835befbc), TOBN(0xa983eae9, 0xed79139e),
+     TOBN(0xd4085efc, 0xb4e31aa4), TOBN(0xc760aec0, 0x18b26adf),
+     TOBN(0x14c1f78e, 0x76a7400d), TOBN(0x87b8aced, 0x317fe128),
+     TOBN(0x4433582e, 0xcbd85bb4), TOBN(0x58f01426, 0x86adc041),
+     TOBN(0x3596dd50, 0x8f0d5781), TOBN(0x2e7f3b80, 0x1a31a82f),
+     TOBN(0xcac7ccc8, 0x2d1ede3e), TOBN(0xc9b9a8f3, 0xe89573db),
+     TOBN(0xbf744f69, 0x54b40df9), TOBN(0x88eb2281, 0xa85ecb47),
+     TOBN(0x6b115026, 0x426ec49d), TOBN(0xebda4660, 0xc8c41110),
+     TOBN(0x0a4a32ac, 0xdf392aae), TOBN(0x2a28f9b3, 0x37cb7080),
+     TOBN(0xfed99d1a, 0x6bd9414d), TOBN(0x15f59c41, 0x5715620e),
+     TOBN(0x93edd9fc, 0xac431919), TOBN(0xed1d43ae, 0xe1ccc47f),
+     TOBN(0xafed2acd, 0x556d1ab5), TOBN(0x817b967d, 0x02e039c0),
+     TOBN(0x335d15da, 0xe02a68bb), TOBN(0x4fa75ea0, 0x67df767c),
+     TOBN(0x384704b3, 0x44833943), TOBN(0x7809ed3c, 0x4084ef35),
+     TOBN(0x2abab3c4, 0x79c7ff41), TOBN(0x2b7ef5b2, 0xa833fb73),
+     TOBN(0x12b0335b, 0x4901a4ff), TOBN(0x3eea607b, 0x44d58617),
+     TOBN(0x7161b669, 0xd7f57746), TOBN(0xee17e43f, 0xb1e93442),
+     TOBN(0x95c9bd80, 0xd6d7878c), TOBN(0xe1ef20ee, 0x34ff7c75),
+     TOBN(0x3fab197a, 0xd2ccd599), TOBN(0x9e480593, 0x952ef4f9),
+     TOBN(0x69777fd2, 0x06ea3410), TOBN(0xb0280454, 0x74fa7dd5),
+     TOBN(0x641b6860, 0xc43bb5fc), TOBN(0x9f359d5b, 0xecd7b8a8),
+     TOBN(0x4431d4ed, 0x70be68cd), TOBN(0x712117f4, 0x08b55f8f),
+     TOBN(0x449e1319, 0x23d0b6ca), TOBN(0x658323cc, 0xfdee5357),
+     TOBN(0xa1ef8114, 0x62879a95), TOBN(0xc21257e5, 0x69963eeb),
+     TOBN(0x1016ab74, 0xc5bbee13), TOBN(0x99bb310a, 0x43d81a86),
+     TOBN(0xdef03c44, 0x1d33a15a), TOBN(0x3e78cf18, 0x49127148),
+     TOBN(0xe8d93368, 0x30b0cc00), TOBN(0xb05458fb, 0xbd7ccd85),
+     TOBN(0x8c2896dd, 0xdbaa76b0), TOBN(0x0d826600, 0x79e4cacb),
+     TOBN(0x50a45b23, 0xff730ed0), TOBN(0x4a0e079c, 0xeba9030e),
+     TOBN(0x3ead3fdc, 0xe3129aa0), TOBN(0xa93b39f3, 0x48aac890),
+     TOBN(0x0fd73860, 0xf362465e), TOBN(0x69177f2c, 0xf8df2764),
+     TOBN(0x4cd58c50, 0x824ebddf), TOBN(0x1478981f, 0x2fcef01d),
+     TOBN(0x511bd380, 0x980524b3), TOBN(0xc95252b1, 0x4d23e8e9),
+     TOBN(0x7ff12c37, 0x9ce08452), TOBN(0x3dd8dd09, 0xa3a87024),
+     TOBN(0x61ff0d39, 0xb849dcb6), TOBN(0x3f5eab86, 0xfefad6de),
+     TOBN(0xb6146886, 0x251523f9), TOBN(0x45ac1d52, 0x5be2135b),
+     TOBN(0x63507995, 0x41d2c5d4), TOBN(0x7f19f799, 0xb3064e72),
+     TOBN(0x7280ad9b, 0xa2efb9be), TOBN(0xbc8fbb60, 0xba9659de),
+     TOBN(0xa4861c12, 0x875a8062), TOBN(0x78c920c8, 0x2f2387ca),
+     TOBN(0xfe0a6ea7, 0x03b7da99), TOBN(0x936a44b8, 0x48e3afa3),
+     TOBN(0x618a0ecf, 0x89fd127b), TOBN(0xa35614cd, 0x06f24bc5),
+     TOBN(0x21a1002e, 0x8d49c05f), TOBN(0xceeacfd1, 0x2fd7989d),
+     TOBN(0x8c058f4b, 0x8f5f4ea5), TOBN(0xf31bd38e, 0x563e214b),
+     TOBN(0xbe47bd98, 0x245c7585), TOBN(0x70d1a05c, 0x6bc2a404),
+     TOBN(0x830d7f30, 0xc68257f7), TOBN(0x1abbbfbb, 0x8136c932),
+     TOBN(0x6fbc43b7, 0x6e03597b), TOBN(0xc18fddb6, 0x5fca14a2),
+     TOBN(0xd3c4ca78, 0xe8f506e2), TOBN(0x6b8711dd, 0xa47e27de),
+     TOBN(0xc308c189, 0x16382b5b), TOBN(0xe9d3145b, 0xcf96bd7a),
+     TOBN(0x5c290ec1, 0xafb26629), TOBN(0xb4eb8130, 0x209438ff),
+     TOBN(0x7335044a, 0xe1118539), TOBN(0xed6d43fc, 0x5192a007),
+     TOBN(0x1a8bf622, 0xa43a2bd4), TOBN(0xefec3fb6, 0xefa9f3a5),
+     TOBN(0x6d224bbc, 0x6d834bde), TOBN(0xaaebfcb8, 0xb0fbc744),
+     TOBN(0x383b2bfc, 0xc4ea1652), TOBN(0x9cd26d90, 0x751ae816),
+     TOBN(0xae614386, 0xf47f0f9a), TOBN(0x99873787, 0x73c6ecd0),
+     TOBN(0x0b56c1ad, 0xe5414fc7), TOBN(0x9b85e6b5, 0xfd40286c),
+     TOBN(0x7117aacd, 0xd64687dc), TOBN(0x85d148e7, 0xad8a8c4d),
+     TOBN(0xf62f8eb5, 0x7962655c), TOBN(0x8386b37e, 0x7f0c6a2c),
+     TOBN(0x6b4715a3, 0x90c47d7f), TOBN(0x1fc4ced1, 0x458a54e4),
+     TOBN(0x01853943, 0x0ed97b0a), TOBN(0x58a280be, 0x5b370e0e),
+     TOBN(0x8d488cb6, 0x344f3960), TOBN(0x9050c599, 0x0741604b),
+     TOBN(0x0878fb1b, 0x07954771), TOBN(0xd927ea8c, 0xdbb3c82b),
+     TOBN(0x2fe71d59, 0x384f01fa), TOBN(0x66d2b790, 0x238bb66b),
+     TOBN(0xceaec11f, 0xb8fd803b), TOBN(0xbb919914, 0x6dd09c0c),
+     TOBN(0xab5992e6, 0x2ccb2f67), TOBN(0x2421878f, 0xcca50326),
+     TOBN(0x363d933d, 0x9ee6dc73), TOBN(0xa374ab0b, 0x084b1fa3),
+     TOBN(0x2d832a29, 0x161f6475), TOBN(0x435b8d78, 0xfc8797eb),
+     TOBN(0x66bc156d, 0xd71b609c), TOBN(0xb3dca798, 0xfe0c2004),
+     TOBN(0x445d47bf, 0x02fd92d7), TOBN(0x1d1c9798, 0xc8b03083),
+     TOBN(0xca46d98d, 0x079a7c51), TOBN(0xb93f286c, 0x1afeb89a),
+     TOBN(0x1c174510, 0xeeb6665d), TOBN(0x65874b6a, 0x7479a932),
+     TOBN(0x28d16a85, 0x2335e3b8), TOBN(0x5e22bd3b, 0xc747eae6),
+     TOBN(0xa770e0a7, 0x04be16b4), TOBN(0x9f5f9ca9, 0x40b3ff57),
+     TOBN(0x3f39e529, 0x845ec39f), TOBN(0x5d5f4d60, 0xebe697ce),
+     TOBN(0xea2a262f, 0xbd90d4f4), TOBN(0xa1ce74ac, 0xfe1b6494),
+     TOBN(0x4e419004, 0xfa0fc472), TOBN(0xdef0e440, 0x4e691060),
+     TOBN(0x57195a3a, 0xa9f4baf3), TOBN(0xf14e108b, 0x5e758c53),
+     TOBN(0x10a34f9d, 0x920895e0), TOBN(0xc3f18af9, 0xfeb57a63),
+     TOBN(0x4b1c988c, 0xda1bef0d), TOBN(0x8b328cd9, 0x3df6915b),
+     TOBN(0x5ddc5ecc, 0xf45586d5), TOBN(0x426468b9, 0x040322fc),
+     TOBN(0xf7f44765, 0xbe981558), TOBN(0x25093991, 0x1855504a),
+     TOBN(0x72c51f2e, 0xf7d6df43), TOBN(0x858637fb, 0x849c99e5),
+     TOBN(0x68b84dfd, 0x0ee9f78b), TOBN(0xff42fc9b, 0xf2ee390e),
+     TOBN(0xaca71e10, 0x531e1dcf), TOBN(0x391620e2, 0x7feaedfa),
+     TOBN(0x7b2d6a02, 0xacf3e5da), TOBN(0x261823d2, 0xd20a16d3),
+     TOBN(0xf9afa5d6, 0xbb00cd30), TOBN(0xba151f4a, 0x1084580d),
+     TOBN(0xb5f4b3a9, 0x26a3fcc3), TOBN(0x5d84a823, 0x6729f4da),
+     TOBN(0x51540c41, 0xfc35f732), TOBN(0x81b0cb58, 0xa6ae5bf7),
+     TOBN(0x91c7ae07, 0xbd81bd27), TOBN(0x0868980e, 0x1d56ff5d),
+     TOBN(0xaef85a31, 0x65224df6), TOBN(0x112eba3b, 0x17a69e35),
+     TOBN(0x07c34677, 0xc3a9d932), TOBN(0x3b6b7cce, 0x8ac45e37),
+     TOBN(0x5e0e2b6e, 0x31b6248a), TOBN(0x14ee5b66, 0x453d9685),
+     TOBN(0x4c5e2be7, 0xbd4d807a), TOBN(0xc03f37f8, 0xc121fea8),
+     TOBN(0xcf34911e, 0x8df7b5e7), TOBN(0x00e7f18e, 0x5f754191),
+     TOBN(0x89a8c9e1, 0x2dcea4aa), TOBN(0xcc1cc31a, 0x50f6db55),
+     TOBN(0x4a6f542c, 0x9046955f), TOBN(0x85fed580, 0xda2485d4),
+     TOBN(0xa70f62d1, 0x9ac53748), TOBN(0xc2fbb850, 0x655870a7),
+     TOBN(0xaeb2d438, 0x8c859aef), TOBN(0xe3cc5ae5, 0xcc9ff51e),
+     TOBN(0xf8d8c55d, 0x0a3ebbfc), TOBN(0xdcd838d5, 0xed48f61a),
+     TOBN(0x032f91ea, 0xd4cba7ab), TOBN(0xeb0ed88d, 0x2f70235e),
+     TOBN(0xd4498170, 0x000ef325), TOBN(0xfd34e07f, 0x4b923c4a),
+     TOBN(0xf71c07a9, 0xb19b84cb), TOBN(0x000a669c, 0xed9690a3),
+     TOBN(0xf45eb0ef, 0xb5705e16), TOBN(0x8cfd6a62, 0x7d9ce007),
+     TOBN(0x76ba9a5f, 0xd9e52885), TOBN(0x13f72881, 0x8aa9ffd6),
+     TOBN(0x0a11e8dd, 0x85528e4a), TOBN(0x58f1993d, 0xcee8d663),
+     TOBN(0xb49d750b, 0xa1c81fd3), TOBN(0xaae29861, 0xe7de2e6b),
+     TOBN(0x9a40644e, 0x5dd7de70), TOBN(0x67fbae1c, 0x937a5546),
+     TOBN(0xb3e02907, 0x956c2fa8), TOBN(0xaf785374, 0x21b4aede),
+     TOBN(0xf42a1e96, 0x9c0a8bfe), TOBN(0x3f6690e6, 0x78957181),
+     TOBN(0x1b1c9575, 0xa6c5e0a7), TOBN(0x6def8124, 0xf9cfb9bd),
+     TOBN(0xde552cf9, 0x72faa1b0), TOBN(0xfac2f4ad, 0x9b5ebbbc),
+     TOBN(0x4b60a5a5, 0x8ef89ba1), TOBN(0xb6d9be57, 0x8012f3b1),
+     TOBN(0x3992a6f7, 0x9b2b083d), TOBN(0xe79ec527, 0xac640f77),
+     TOBN(0xf6cca775, 0x3f1e632e), TOBN(0x5dae8413, 0x8fb80790),
+     TOBN(0xf0d4146c, 0xb572407c), TOBN(0x829cfb38, 0x3f84cc39),
+     TOBN(0xd7c9fed4, 0xe31f007e), TOBN(0x93b2a5bc, 0x09e68ce9),
+     TOBN(0x073fb24a, 0xd01482b9), TOBN(0xfe494244, 0xb8d44e62),
+     TOBN(0xe59a1649, 0x3dc49858), TOBN(0x071776f7, 0xf005b31f),
+     TOBN(0xaa368f59, 0x285439af), TOBN(0xb0821574, 0xe27e783d),
+     TOBN(0xe16903f6, 0x098746ba), TOBN(0x436a95ae, 0x69dc00d0),
+     TOBN(0x9ae5a91a, 0x877bfcec), TOBN(0x5d8758d9, 0x1416ad3a),
+     TOBN(0xa420ce40, 0x25fd9a9a), TOBN(0x99610fdf, 0x39b0fbfa),
+     TOBN(0x782af222, 0x41cc1e9b), TOBN(0x346a4a92, 0x86ff4cf6),
+     TOBN(0x9dc4c6cd, 0xabc900c1), TOBN(0x7ed2476c, 0xe7fade51),
+     TOBN(0x68a72185, 0x4f1dd24b), TOBN(0xcefcf0fd, 0xb08260cb),
+     TOBN(0x0199a147, 0x8a6f61b6), TOBN(0x176b6079, 0xcb5769c5),
+     TOBN(0x6dbcceb0, 0x347d5a63), TOBN(0x26433ebc, 0x9c4dc505),
+     TOBN(0x52570318, 0x05d5e74d), TOBN(0x692f1d81, 0x057ca464),
+     TOBN(0xa09554a0, 0x477f424e), TOBN(0xbd3f9bbd, 0x176a695d),
+     TOBN(0x8c7f52f3, 0x5972db27), TOBN(0xacee8234, 0xf28b2aa4),
+     TOBN(0xb853465a, 0x3a4a0217), TOBN(0x74a2534f, 0x66f3a4d5),
+     TOBN(0xae1a7ff3, 0xeff0423b), TOBN(0xd2a01a09, 0xbb126028),
+     TOBN(0xff84c6f0, 0x4963e855), TOBN(0x63db264c, 0x6bc18d50),
+     TOBN(0x39792dca, 0xcc6a5e25), TOBN(0xf20cdf3e, 0xedb37a25),
+     TOBN(0x6a460f3d, 0x8730f2c4), TOBN(0xe9b786c4, 0x6a0ab6bb),
+     TOBN(0xa9720a6b, 0x084015c2), TOBN(0x28add2e2, 0x0dbe6f0f),
+     TOBN(0x90fb0ba7, 0x26be7de7), TOBN(0xfae8b5d4, 0xe40f15fd),
+     TOBN(0x007363a1, 0xceb9c856), TOBN(0x6d8bfe14, 0x586b770e),
+     TOBN(0x63e7d78e, 0xb7bcc0e0), TOBN(0x56c569f8, 0x3ed4ab62),
+     TOBN(0x76c6a5bb, 0x9e103abb), TOBN(0xeb24afeb, 0x638fc44d),
+     TOBN(0x15e00239, 0xf0be16f1), TOBN(0x7db92f67, 0x8778f084),
+     TOBN(0x5198680e, 0x63de2bef), TOBN(0x69031d0e, 0xe0510421),
+     TOBN(0x8058f8aa, 0xb94753c1), TOBN(0x412d4c97, 0x454bf609),
+     TOBN(0xb8dbfe8a, 0x95f9fd19), TOBN(0x6cd3221a, 0x68b43233),
+     TOBN(0x384a9f15, 0xa5adaaff), TOBN(0x60c70f90, 0x42b2ef95),
+     TOBN(0x085b2f3b, 0x2c7da919), TOBN(0x1e5d23d1, 0xbc8407e1),
+     TOBN(0x9ea95bc9, 0xadb45b3e), TOBN(0xb5a28fec, 0xed06ec67),
+     TOBN(0xd678df46, 0x62a3c143), TOBN(0x80f0bc9d, 0x6793284a),
+     TOBN(0xeb7865a9, 0x07d4afc7), TOBN(0x0fc5eafe, 0xc1301d87),
+     TOBN(0x50a8e7f5, 0x4823349b), TOBN(0x97800fa2, 0x2d019e96),
+     TOBN(0xfeff2579, 0x1bdd1d9c), TOBN(0x4d938c5d, 0x23886156),
+     TOBN(0x25e3a806, 0x6979b9f6), TOBN(0xeeef8fa0, 0x37bb6199),
+     TOBN(0x4d917977, 0xd7d308b8), TOBN(0x60ca7ff9, 0x4ae672cc),
+     TOBN(0xb24ec154, 0x2a68db6e), TOBN(0x7b0604ec, 0x9e9942f5),
+     TOBN(0xfdf4794f, 0xca4fad9e), TOBN(0x086020f8, 0x3df5de22),
+     TOBN(0x653da6ca, 0xd601533c), TOBN(0xf97c1865, 0x735709f3),
+     TOBN(0x2457ffd0, 0x7cbd6ab6), TOBN(0xce05a482, 0xd003a502),
+     TOBN(0x5c0c0cba, 0x33ee2740), TOBN(0x8146ca00, 0xf37174aa),
+     TOBN(0xec118827, 0x587262bb), TOBN(0x8468c029, 0x7e2a402c),
+     TOBN(0xe1c3a9e3, 0xbd6eb2aa), TOBN(0x77d09b4d, 0xb496bde8),
+     TOBN(0x454e767a, 0x854693bf), TOBN(0x6bbcc22e, 0xa4de85bc),
+     TOBN(0x66452f10, 0xb180f206), TOBN(0x110c5a05, 0x0f5b1744),
+     TOBN(0xb7be75d8, 0xa6b3f6e4), TOBN(0xf64bb3fd, 0x2c0d2e1d),
+     TOBN(0xad17a039, 0x935ae640), TOBN(0x7304ad63, 0x8f243748),
+     TOBN(0x04316bb4, 0xd278caa9), TOBN(0x19b89c62, 0x1e84f91d),
+     TOBN(0xdf4a47e9, 0x6e7a2511), TOBN(0xdef32df9, 0x998b6bc0),
+     TOBN(0xf1253ce0, 0xcee95a1f), TOBN(0xbacf5206, 0x0ae96e31),
+     TOBN(0x4ba2e24a, 0x0b343e63), TOBN(0xca64d07f, 0x79929dc6),
+     TOBN(0xf2823ac8, 0x9424ce75), TOBN(0x2d4add37, 0x0207ee9f),
+     TOBN(0x44d9ecd0, 0x387cde5f), TOBN(0xa5095ccb, 0xe180a21f),
+     TOBN(0x901cec8a, 0x7c0cedf8), TOBN(0xf291dc78, 0x3b8c759c),
+     TOBN(0x98b8efdc, 0x49401234), TOBN(0x8f2b16e3, 0x058e9d9e),
+     TOBN(0x16ce8007, 0x27dba00f), TOBN(0x5bb8fca9, 0x6d66d2f1),
+     TOBN(0x092eda98, 0x7b85a96b), TOBN(0xec53f4bc, 0x973eae20),
+     TOBN(0xe6e0df59, 0x1b93a60f), TOBN(0x65e06ecf, 0x2f6b0abf),
+     TOBN(0xb8c2ec3e, 0x569a9e1d), TOBN(0x27f9fe72, 0xaa8c1cc3),
+     TOBN(0x9cf3908f, 0xccd4d5e2), TOBN(0x5a40e0a9, 0x725c8528),
+     TOBN(0x27b15a1e, 0xd470b0b0), TOBN(0x50a09ec1, 0x33d81bff),
+     TOBN(0xba976a58, 0xda99fcf5), TOBN(0x3881ef1e, 0xc3536b7c),
+     TOBN(0xec65a069, 0xfbc931b1), TOBN(0xab7f57b4, 0xfc929a0e),
+     TOBN(0xc7c63491, 0xbc61f452), TOBN(0x5c1aa935, 0xc1750dbc),
+     TOBN(0x35b8789b, 0x9ff0465c), TOBN(0x8ff8589b, 0x727647b7),
+     TOBN(0x2b56fe50, 0xa95022b6), TOBN(0x24220569, 0x2adbdbbd),
+     TOBN(0x2370d94f, 0xd2b80ea8), TOBN(0xe5d47b73, 0x71d9e6f7),
+     TOBN(0x2fe84b72, 0x8d858032), TOBN(0x0411034b, 0x4ffd7cfe),
+     TOBN(0x0819a9f3, 0x7c2c84e0), TOBN(0xf8248dfd, 0x30228f9e),
+     TOBN(0x75c77f0a, 0x4fdf6c79), TOBN(0x195b4b59, 0x15579cc7),
+     TOBN(0x274c7c81, 0xf8d3705c), TOBN(0x45a2209f, 0x70ee9be1),
+     TOBN(0x4a4fce69, 0x0b1e818b), TOBN(0x74d05e5f, 0xbb9926b1),
+     TOBN(0xb64639ce, 0x3f2a796b), TOBN(0x2d168d5b, 0xae957d59),
+     TOBN(0x067c2270, 0x16171846), TOBN(0x7bb71d15, 0x1a03f8d1),
+     TOBN(0x2badd196, 0x495a09a1), TOBN(0x024db163, 0x51b990c4),
+     TOBN(0xc19edc61, 0xe79dcaac), TOBN(0xf17f54bd, 0x60df81e9),
+     TOBN(0x4560262e, 0x9ae347e4), TOBN(0x1d2c2542, 0x59eb711d),
+     TOBN(0x40372d2d, 0x4919affe), TOBN(0x2d4a2ea3, 0xa009bd16),
+     TOBN(0x48f1e7f8, 0xc1a62eb1), TOBN(0xce083725, 0x587a1124),
+     TOBN(0xe874261b, 0xe7ebadd3), TOBN(0x7ca5c156, 0x057b93e9),
+     TOBN(0xe8b381e5, 0xfe39e6ff), TOBN(0x2d16b32f, 0xd30815c3)},
+    {TOBN(0xdfd30b28, 0xad2e996a), TOBN(0x64d4eeec, 0x9df0fc37),
+     TOBN(0x8e049e3d, 0xddc39763), TOBN(0x9f55e0ce, 0x37ea2e8e),
+     TOBN(0xf3fcba4e, 0x4bf01984), TOBN(0x764d5c3d, 0x9d55bc4b),
+     TOBN(0x98cb92a1, 0xcfda895f), TOBN(0x27dfe795, 0x5c7bca69),
+     TOBN(0x86dfdecf, 0x23a86e2c), TOBN(0x02ac466b, 0x3387f712),
+     TOBN(0xc30a1ac2, 0xd63509d1), TOBN(0xd3913422, 0x63aebbd1),
+     TOBN(0xdc7b789f, 0x068ae34f), TOBN(0x499f2d01, 0x487dcd10),
+     TOBN(0x68e2a3bc, 0xa3e8a4b4), TOBN(0xdf87ba71, 0x14d2a26c),
+     TOBN(0x9e3ab999, 0x34479e7b), TOBN(0x9d5f2dc3, 0xb026e780),
+     TOBN(0x131374fd, 0x4f1bd429), TOBN(0x92e2e738, 0x9be1379a),
+     TOBN(0x6cc32f80, 0xd13bc111), TOBN(0x6fbfc350, 0x86f81c92),
+     TOBN(0x12ca1b30, 0x9263913a), TOBN(0x6f7da1ff, 0xe06ab75c),
+     TOBN(0x4780f12a, 0x19301b16), TOBN(0x233bc231, 0xbc368a20),
+     TOBN(0xd9650892, 0xcbadb344), TOBN(0x38a0d964, 0xad9425a1),
+     TOBN(0x277abcf2, 0x4a8d4d7e), TOBN(0x4ccd16b1, 0xb806ce9e),
+     TOBN(0x82ff40f0, 0x7570d473), TOBN(0x57491414, 0xdf130780),
+     TOBN(0x9f1f39f2, 0xa96ef42b), TOBN(0x1fd967ed, 0x107f1321),
+     TOBN(0x93832497, 0x29d4767e), TOBN(0x7761a38b, 0x3fa9e796),
+     TOBN(0x3e408c59, 0x66318df2), TOBN(0x9283ca44, 0x41745f03),
+     TOBN(0xfedf8fa3, 0x2cce1a86), TOBN(0x8363860d, 0xb44600b4),
+     TOBN(0x3dbfde55, 0x45f45a89), TOBN(0x8800c860, 0x26ce399c),
+     TOBN(0xfb25e8da, 0xc25e9479), TOBN(0x6ff0d6cb, 0xf7d367a2),
+     TOBN(0x70b0ba36, 0xa93f9890), TOBN(0xc07ca403, 0x49bd5a80),
+     TOBN(0x5f4feda6, 0xed54d1aa), TOBN(0xfa1e2efd, 0x671ad0b4),
+     TOBN(0xda465467, 0x8c56e7aa), TOBN(0x39d04cdc, 0x25e45bc0),
+     TOBN(0x26661bd6, 0xaf21c637), TOBN(0xf757ff5c, 0xb55ddfa5),
+     TOBN(0x07318fd1, 0x4394eb20), TOBN(0xe010b19d, 0x2bcf3ad1),
+     TOBN(0x71e2031c, 0x8e5c7e7f), TOBN(0xee35f346, 0xedbfda69),
+     TOBN(0x8d8d4120, 0x5d8f6fab), TOBN(0x5e420839, 0xabed09c8),
+     TOBN(0x5120e079, 0x4aacbb1e), TOBN(0xf7e840f8, 0xec1bc996),
+     TOBN(0xd921d63b, 0x9707c3bb), TOBN(0x3ab4b8b8, 0xae891a71),
+     TOBN(0xbe465756, 0x73bb2278), TOBN(0x776ce040, 0x553ee91c),
+     TOBN(0x86f07c2e, 0x88222e0a), TOBN(0x3f3688f1, 0xdf97816e),
+     TOBN(0x20d2d944, 0xa6df9d3a), TOBN(0xff399057, 0xb2cb925a),
+     TOBN(0x010c747e, 0x27f1de19), TOBN(0xbe940669, 0x7fc1fbc3),
+     TOBN(0x3ab94600, 0x877ef709), TOBN(0x9af40a6b, 0x8f4c8a8e),
+     TOBN(0xf7c0f202, 0x713f023a), TOBN(0xbe0bf3db, 0xd0a8dc63),
+     TOBN(0x09789926, 0x64a41337), TOBN(0xbb4a8964, 0x2c2823cf),
+     TOBN(0x9279cb27, 0xb90e45c6), TOBN(0x80283fd3, 0x382564ac),
+     TOBN(0x3a746b01, 0xfa5f0bcd), TOBN(0x28667a8e, 0x0afaf10a),
+     TOBN(0xeccfd0ee, 0x015d5295), TOBN(0xbd6678a5, 0x73ce8e21),
+     TOBN(0x132a87f2, 0x336ecb65), TOBN(0x09de4efc, 0xbe7dc659),
+     TOBN(0xbedadd10, 0x6f69b3bd), TOBN(0x357c61e2, 0xe8303650),
+     TOBN(0x6b3c613a, 0xa45777e6), TOBN(0x51dd30ad, 0x08d41179),
+     TOBN(0xa7b53f3f, 0xf98feac3), TOBN(0xe8e00328, 0xf9497319),
+     TOBN(0x1f3b080d, 0x0ca20b40), TOBN(0x06dc5456, 0xe19b088e),
+     TOBN(0x1f3f18d7, 0x0dce02cb), TOBN(0x2d215544, 0x6fd1ade9),
+     TOBN(0x4c6de38c, 0x055550d0), TOBN(0x5d535e6f, 0xf33f4973),
+     TOBN(0xdcfd4163, 0x744c033d), TOBN(0x0706a490, 0x76fc420a),
+     TOBN(0xdc9db55c, 0x394f5b6d), TOBN(0x1a050a62, 0xe040a093),
+     TOBN(0x60367ebb, 0xd0ab26f3), TOBN(0xb9c07239, 0xc3d91820),
+     TOBN(0x14a8bed5, 0xa3e32db2), TOBN(0x23b19cd3, 0xd49f37dd),
+     TOBN(0xd048c64f, 0xea6c85ce), TOBN(0x8aefff19, 0xd5716cfe),
+     TOBN(0x199fddb1, 0xab85bdcf), TOBN(0x3f592e7e, 0xbaea49d0),
+     TOBN(0x8c8decb6, 0xf1d58ff6), TOBN(0x02598a99, 0x7fe8f425),
+     TOBN(0xe4c73ae2, 0x64a93fd6), TOBN(0x208a0f61, 0x878db06b),
+     TOBN(0xff0272fe, 0x27c4a266), TOBN(0xccfc96ae, 0x69e7c6a2),
+     TOBN(0xbd7e715f, 0x8e78d74a), TOBN(0xd04ae9a4, 0x32ed35bc),
+     TOBN(0x302af413, 0x05614c5f), TOBN(0x98176637, 0x33943b5a),
+     TOBN(0xa4d1c9b2, 0x8a58cfd8), TOBN(0xf0ebd5f4, 0xac2f3f79),
+     TOBN(0xebadb010, 0xfdc7945f), TOBN(0x62c9cff0, 0x03750a4b),
+     TOBN(0x75192383, 0xa0c85b9d), TOBN(0x2aba7b53, 0x16eb0bf9),
+     TOBN(0x93d4adaa, 0xa4c06f9a), TOBN(0x573a86a2, 0x5f8e482c),
+     TOBN(0x109c6fdc, 0xe791a79f), TOBN(0xd9ed02ce, 0xb37eeec2),
+     TOBN(0x7b1fb4b4, 0x7dd63c8b), TOBN(0xae6e2767, 0x22493b49),
+     TOBN(0x5ef6beb7, 0x6a411bc9), TOBN(0x4d88918d, 0xe1bf4242),
+     TOBN(0x7ba26f8c, 0x02a97fbc), TOBN(0xf45b2a50, 0x7f41c518),
+     TOBN(0x6c35fb69, 0x83249e23), TOBN(0xc4a95134, 0x7a5778cc),
+     TOBN(0x6173f860, 0x08287cf7), TOBN(0xdcfc71d9, 0xfac3a444),
+     TOBN(0x894f3b33, 0x079ce3c9), TOBN(0x842bf7da, 0x916b661c),
+     TOBN(0x94299d6f, 0xa758a243), TOBN(0x0e23f984, 0xb242389a),
+     TOBN(0x653050f0, 0xc03a7aa2), TOBN(0x2ec3041b, 0x9559ad9c),
+     TOBN(0xa61dd499, 0x97cf6e9b), TOBN(0xfd090f38, 0x448fa6c6),
+     TOBN(0x4f1b75ac, 0x39b126bf), TOBN(0xb48d0372, 0x1ef1a280),
+     TOBN(0xe40c310d, 0xf2b2941f), TOBN(0x5b9a7369, 0x8d9d5ace),
+     TOBN(0xbe0415c1, 0x7ad9ad95), TOBN(0xffd864b6, 0xa8510622),
+     TOBN(0x2aceddcd, 0x898f28e8), TOBN(0xa0cfc30a, 0xba89a51f),
+     TOBN(0xd87db983, 0xe105e448), TOBN(0x16ba795e, 0x5e5ea6fb),
+     TOBN(0x5f48e45a, 0x352ad094), TOBN(0x1971a10f, 0x55fd75e7),
+     TOBN(0xfb0f1767, 0xfd1c8d68), TOBN(0x904229d9, 0x86df0665),
+     TOBN(0xc2c88671, 0xe87ab22b), TOBN(0xcbe384a1, 0x33611a50),
+     TOBN(0x38eec58e, 0xad2eb708), TOBN(0xaa19b174, 0x86d7bdee),
+     TOBN(0xa9f416d7, 0x51832b61), TOBN(0x10b751ff, 0x355e7b6d),
+     TOBN(0x6dd52063, 0x4ff07a5a), TOBN(0x6a6090c1, 0x4e3505c1),
+     TOBN(0x53addd1c, 0xd4c80f29), TOBN(0xe76d668b, 0x0d3d793e),
+     TOBN(0xbdcdc4c9, 0x191eedd9), TOBN(0x80675320, 0x0f8e4877),
+     TOBN(0xc41426dd, 0x32f5661b), TOBN(0x9fcbe1ac, 0x06199185),
+     TOBN(0x62fa2198, 0x404a1207), TOBN(0xc742fdc2, 0x33c8190e),
+     TOBN(0x16ec1b96, 0x778ee765), TOBN(0xda656f58, 0xe29d992d),
+     TOBN(0x5393775b, 0xb4369e7f), TOBN(0x512f5c7b, 0x0674fc45),
+     TOBN(0x55b8bd38, 0x60efa8e0), TOBN(0x1ab6d2df, 0x155b57ab),
+     TOBN(0xed0aa777, 0xe26ad439), TOBN(0x5b16333e, 0xd9b04376),
+     TOBN(0x321119d3, 0x8fc7ea72), TOBN(0x390b4ef5, 0x7211ef45),
+     TOBN(0x289f3945, 0x1feda1a2), TOBN(0xcee9cb33, 0x605c8596),
+     TOBN(0x91109e96, 0x971b6897), TOBN(0xdf70c173, 0x19701ea7),
+     TOBN(0xa07d0ecd, 0xa92c6b2b), TOBN(0xf8eb97fe, 0xa9eab766),
+     TOBN(0xbb2cf63b, 0x0e3cf9e8), TOBN(0xffa6c503, 0xdda02b26),
+     TOBN(0x42c1ec1a, 0x9cb18efd), TOBN(0x13cdda9c, 0xc45d5b22),
+     TOBN(0x6b3baf33, 0xc820cdf5), TOBN(0xa337bc5e, 0x610c8bfc),
+     TOBN(0x88186818, 0x06a9ca6b), TOBN(0x382a34ee, 0xa0c455af),
+     TOBN(0x725006c9, 0xe8fc59df), TOBN(0x0d46b697, 0xf929c670),
+     TOBN(0x7bd6eceb, 0x893a9f6e), TOBN(0xf25aa637, 0x1cd04e5a),
+     TOBN(0xf1563d79, 0xf6612d4a), TOBN(0x8c9372cf, 0x5efc49d8),
+     TOBN(0x09cc0513, 0x96c5bdc5), TOBN(0x70f19d46, 0xd3cc34d8),
+     TOBN(0xe62f6891, 0xfdfbe16c), TOBN(0x8b7db2fd, 0xdc60110b),
+     TOBN(0x3557bff8, 0xf7868674), TOBN(0x2b414c8e, 0x95a638d6),
+     TOBN(0x3b6610ac, 0x6d19ac65), TOBN(0x20864204, 0xd641b0ea),
+     TOBN(0xee372a46, 0x892161fb), TOBN(0xc7c5bd87, 0x4125868a),
+     TOBN(0x5edc6afc, 0xa61ee957), TOBN(0xa4374ba1, 0xd37faed4),
+     TOBN(0xf0684f46, 0x1e52b0ab), TOBN(0x0812cbca, 0x2a007b66),
+     TOBN(0xf3442afd, 0xe68c4893), TOBN(0xb02ac6df, 0x2d9dd9a2),
+     TOBN(0xa4fe98dc, 0x068c08bb), TOBN(0xfcd5dc05, 0x7795e2e9),
+     TOBN(0x28983aee, 0xa0f55cd8), TOBN(0xb390daf4, 0xe96cf557),
+     TOBN(0xbfd2f5ab, 0x3f119098), TOBN(0xed114587, 0x6386c0ad),
+     TOBN(0x578995b9, 0x69539392), TOBN(0xc8a77948, 0x36b880ab),
+     TOBN(0x7e03cfb6, 0xe4c8b560), TOBN(0x018cd4db, 0x06cdcbe0),
+     TOBN(0xbd7f2e3a, 0xb006f8d5), TOBN(0xf25d1718, 0xd6d9f30e),
+     TOBN(0x9ef6e2ee, 0x1b22ae3d), TOBN(0x89a2695d, 0x416154ab),
+     TOBN(0x1975e0c8, 0xda261e39), TOBN(0x8fe66aed, 0xda2c2031),
+     TOBN(0x6f93f839, 0x97e1e00c), TOBN(0xcba9a773, 0xa742b328),
+     TOBN(0x9529fec1, 0x3417df8b), TOBN(0x37a27cd9, 0x54e314b1),
+     TOBN(0x93feb0f8, 0x65f94a63), TOBN(0x65978b84, 0xb5e029c1),
+     TOBN(0x576fd830, 0x81b705f1), TOBN(0x37d07a37, 0x688e8c52),
+     TOBN(0x3b91d360, 0x332838dc), TOBN(0xcca9cbf8, 0xb0b14a94),
+     TOBN(0x86f18c44, 0x8b63b669), TOBN(0x53c6eba6, 0x6972d2d1),
+     TOBN(0x2a522d8c, 0x8cff59bc), TOBN(0xbc181d15, 0x6ed25ce5),
+     TOBN(0x913f173d, 0x5feb0eca), TOBN(0x34273f8d, 0xa207bd71),
+     TOBN(0x41b7572e, 0xfa1715ae), TOBN(0x8a8ffea2, 0x7f16f4ae),
+     TOBN(0x2b852908, 0xf95bdf78), TOBN(0xa75adbb3, 0xa26328b9),
+     TOBN(0x992ac179, 0xdae21d25), TOBN(0x8c99927a, 0x78e14467),
+     TOBN(0x23fb2fee, 0x0c16e0c2), TOBN(0x58e797bb, 0xdbcb5f4e),
+     TOBN(0x33d6956e, 0xa07bd7de), TOBN(0xc921fdb3, 0x7172d36a),
+     TOBN(0x035f1744, 0x158267b5), TOBN(0xc7495f33, 0xa291374d),
+     TOBN(0xe07db2f5, 0x4a41a6a0), TOBN(0xfdb2987e, 0xd1238792),
+     TOBN(0x616df624, 0x49741ce6), TOBN(0x90ecd21b, 0x8a693880),
+     TOBN(0x447c729d, 0x341fe21b), TOBN(0x06ad3c90, 0xc012a8ab),
+     TOBN(0x13dc4fa9, 0xddfd6b5a), TOBN(0x238a1add, 0x64cfc0f3),
+     TOBN(0x874a3c2f, 0xc34a2b1e), TOBN(0x427b6e3c, 0x0deb1dd4),
+     TOBN(0x78a1ad1d, 0x876f2621), TOBN(0x34f9207c, 0x252f6837),
+     TOBN(0x1c812fbb, 0x047d667b), TOBN(0xc3512ea3, 0x3ee03ba7),
+     TOBN(0x762de5f0, 0x527a1b55), TOBN(0x7873d692, 0xae3221af),
+     TOBN(0xa8ac73c7, 0xb112d35f), TOBN(0x1d118c30, 0x815414f6),
+     TOBN(0xbc686118, 0x865ab6f6), TOBN(0x01e75348, 0xecf8c02d),
+     TOBN(0x9b131840, 0xe6220bf9), TOBN(0x3d72dac4, 0xa67512b5),
+     TOBN(0xd9e49ecc, 0xaf95e16e), TOBN(0x1297c560, 0x1e2aa105),
+     TOBN(0x925301ac, 0xa1a5e8c2), TOBN(0x3b0ea863, 0x990ab503),
+     TOBN(0x7860b660, 0x15f258c4), TOBN(0xa4497040, 0x397253e4),
+     TOBN(0x88562ed0, 0x14a4774d), TOBN(0x325d8b0d, 0x7adbd093),
+     TOBN(0xd4df8df2, 0x41e24010), TOBN(0xe7cb8663, 0x580031be),
+     TOBN(0xd653593a, 0xd7fc7e5f), TOBN(0x429a8863, 0xe9f1fe9d),
+     TOBN(0x18a0a709, 0x63e71ced), TOBN(0x39d9316d, 0xa498140e),
+     TOBN(0x44466cff, 0x40f40117), TOBN(0x58d27cd6, 0x64602832),
+     TOBN(0xf4a4c22b, 0x86018a70), TOBN(0x7a4d4102, 0x6d703f04),
+     TOBN(0x4f5a0037, 0xb424b0fb), TOBN(0xfb591cfd, 0x322b1876),
+     TOBN(0xb45798b0, 0x632e0f56), TOBN(0x83ef9feb, 0xfdcbcf20),
+     TOBN(0x0a23b09c, 0x115749ac), TOBN(0x3b950273, 0x946248f8),
+     TOBN(0x5ed75e68, 0x1e13eaee), TOBN(0xbebd4744, 0x09dafdb9),
+     TOBN(0x8b46621f, 0x69941fc4), TOBN(0x1fd3c13f, 0x91129bc0),
+     TOBN(0x371448d0, 0xb7b9da22), TOBN(0xd452ccea, 0xd87a4742),
+     TOBN(0xe2f04778, 0xf91c38b9), TOBN(0xfb443a5d, 0xbd516bfe),
+     TOBN(0xd7bd4056, 0x044d666b), TOBN(0xb4546ffd, 0x2a9b17c4),
+     TOBN(0xf66765ae, 0x818fe55a), TOBN(0xc375126c, 0x1b5dc7a0),
+     TOBN(0xe9a7ed20, 0xc1a81c63), TOBN(0xaef2e23d, 0xf8cf06b9),
+     TOBN(0xf4536865, 0x3e67b95b), TOBN(0x25cbb5a6, 0x24309537),
+     TOBN(0x8a230e68, 0x3256c020), TOBN(0x4a33e462, 0x215dca7b),
+     TOBN(0xefef4936, 0x2935b6d1), TOBN(0xb383df4e, 0x852c39f4),
+     TOBN(0x197ddd77, 0x57c21e90), TOBN(0x236f98dd, 0x2164127f),
+     TOBN(0x464b86ec, 0xbbd61847), TOBN(0x107a387c, 0xfb89d515),
+     TOBN(0xe01e50b7, 0x400d66d5), TOBN(0x4377af2b, 0x5f864426),
+     TOBN(0xde21c49a, 0xf8fe847a), TOBN(0xc133e58f, 0x887c0674),
+     TOBN(0xda5b4c3b, 0xd2fda17c), TOBN(0x24157f13, 0xfed8fe68),
+     TOBN(0x1c4483f3, 0x8b6bb6bf), TOBN(0x940fab9e, 0xcf1bed73),
+     TOBN(0xce3fca79, 0x3c15c7e5), TOBN(0xb83fce10, 0x066de109),
+     TOBN(0xbd42ed01, 0x0cd5a04a), TOBN(0xba5446b8, 0x407fcb03),
+     TOBN(0x4a8cb929, 0xe5d35bda), TOBN(0x6338fd7e, 0xbff8631f),
+     TOBN(0xc85d4ee4, 0x4656a8cd), TOBN(0x83b1f39a, 0x92c99820),
+     TOBN(0x153fa4d4, 0x7e90c823), TOBN(0xc15809ba, 0x15326196),
+     TOBN(0x320b8fe9, 0x6eb4b379), TOBN(0x27cc07c0, 0x58704d9e),
+     TOBN(0x301840b2, 0xf13d6ee7), TOBN(0xf1f6530f, 0xc6d8c930),
+     TOBN(0x3e9254ea, 0x96a22034), TOBN(0xf8c0ee68, 0xaf5b8a2e),
+     TOBN(0x88e9e44e, 0xb8207fde), TOBN(0xdea11cbd, 0x29bc1310),
+     TOBN(0xa20c2f17, 0x9c9d7df7), TOBN(0x2a954927, 0xbceac495),
+     TOBN(0x3f405f5c, 0x2a58d6ba), TOBN(0x64df5364, 0x2ac9aeaa),
+     TOBN(0xb618f6db, 0xe8aa74a5), TOBN(0x22dadc7f, 0x74ef61e3),
+     TOBN(0x306ee832, 0x9cfdc4cd), TOBN(0xaff53321, 0x40698a5b),
+     TOBN(0x98893443, 0x89567341), TOBN(0xdfefbdd4, 0xac7c68ec),
+     TOBN(0xd3da7094, 0x3261a582), TOBN(0xd23e3fa5, 0x62ce96e7),
+     TOBN(0x62c060c0, 0xd773337e), TOBN(0x5cb2beca, 0xa041f910),
+     TOBN(0xe21ab479, 0x7e8215d8), TOBN(0x84384686, 0x923b4b27),
+     TOBN(0xa93c08fe, 0x6a3d21ef), TOBN(0x7bd96248, 0x2fa6de1c),
+     TOBN(0xb858ecd7, 0xca6de3e0), TOBN(0x466a48c8, 0x47c9fced),
+     TOBN(0x23ca9b75, 0xc708239e), TOBN(0x860d553d, 0xb5bbe833),
+     TOBN(0x45804f1a, 0x9e76e71d), TOBN(0x9fdb8b8d, 0x51e59be2),
+     TOBN(0xa76db4b7, 0x3bbc2a19), TOBN(0xaebb47ee, 0x96f82cd0),
+     TOBN(0x7a9b95b5, 0x97b1dd04), TOBN(0xcc149a8d, 0x5f0b1d7c),
+     TOBN(0xbba40e4d, 0x47a50eec), TOBN(0x4e635d70, 0x56b72539),
+     TOBN(0x31c40e90, 0xb18659c4), TOBN(0x08026224, 0x6f694b35),
+     TOBN(0x8ed3d7b8, 0xe0cd6e15), TOBN(0x157e2a9d, 0x9293cb36),
+     TOBN(0x7b457bb1, 0x96e54583), TOBN(0x75647498, 0x2609c44d),
+     TOBN(0x54667671, 0x970a8cf2), TOBN(0x3b7da9c8, 0x3af72572),
+     TOBN(0x8fbba977, 0x4d63473a), TOBN(0x7af5af43, 0x23001221),
+     TOBN(0x99093197, 0xea29d97e), TOBN(0x4409f6a9, 0xfa564089),
+     TOBN(0x64fd1cda, 0x2f70e06f), TOBN(0x8b7c83a6, 0x2e9d55ea),
+     TOBN(0x0dffbe4b, 0x6385fcef), TOBN(0x4513f584, 0x7a6fe72d),
+     TOBN(0x6a64f166, 0xba1de4ae), TOBN(0x1f8550a9, 0x89069fbd),
+     TOBN(0x72b411fd, 0xda7ef7fc), TOBN(0xa185d2c3, 0x829ea712),
+     TOBN(0x82f5ffb8, 0xccc1868d), TOBN(0xb484473a, 0xff9fafa9),
+     TOBN(0xe1857f3c, 0x089132ed), TOBN(0xdad885a9, 0x08ef378f),
+     TOBN(0xbdbdfc0e, 0x7af9e2aa), TOBN(0x366c07bb, 0x95486202),
+     TOBN(0x37040d45, 0xfc9d979f), TOBN(0xf279ed10, 0xa0f80630),
+     TOBN(0x27855261, 0x8f31b39c), TOBN(0xea0c3b1c, 0xf26f91cb),
+     TOBN(0x90b4e8c2, 0xb38c050f), TOBN(0x7acb26b1, 0x1623ab47),
+     TOBN(0xb6cc3cd9, 0xa4a064d2), TOBN(0xa410880c, 0x97245482),
+     TOBN(0xfb470e11, 0x3a6e6a1f), TOBN(0xf19080b1, 0x93f347e4),
+     TOBN(0x23253dcf, 0xb75a53d9), TOBN(0x55047049, 0x9c95d567),
+     TOBN(0x8c75631e, 0x7b20202a), TOBN(0x58fccf32, 0x834b8380),
+     TOBN(0xaf6bdbd8, 0x243dddde), TOBN(0xa3ca3e2c, 0xcf38f705),
+     TOBN(0xa2357b4b, 0xca38c9a2), TOBN(0x8bf0d270, 0x6eba095b),
+     TOBN(0xe4a43b7c, 0x9d998070), TOBN(0xdf412faa, 0x8469214c),
+     TOBN(0xd2578cc4, 0x000f1802), TOBN(0x2feb563f, 0xf8515863),
+     TOBN(0xe66ce02a, 0x5022112c), TOBN(0x8415df81, 0x1461b1c6),
+     TOBN(0xc2546e6a, 0xad247c38), TOBN(0x4b9788e6, 0x9a9c74d6),
+     TOBN(0x9d0cb2e0, 0xa22be3e8), TOBN(0x15db086c, 0x295f76ad),
+     TOBN(0x9758f99b, 0xa2337670), TOBN(0x61ae09bb, 0x9ab57f54),
+     TOBN(0x7af4d4aa, 0x93926a37), TOBN(0xa895f386, 0xf25cadb4),
+     TOBN(0x90e13821, 0xc6f4f514), TOBN(0x46738d95, 0x4eef97ab),
+     TOBN(0x66f559f3, 0xf0b479a2), TOBN(0x9ea62dcd, 0x3262fb2b),
+     TOBN(0x91a39a5e, 0x6a857025), TOBN(0x11bdd19a, 0xbb3e6e11),
+     TOBN(0xfa411fd6, 0x9353cc19), TOBN(0x275d094c, 0x94cd2276),
+     TOBN(0xe2069b22, 0x25243d1b), TOBN(0x9f02f1e2, 0x630c8cbc),
+     TOBN(0x85c942fd, 0x379b6b63), TOBN(0x293dcf87, 0xbdcc9307),
+     TOBN(0x56856d8e, 0xdc212ca8), TOBN(0x1927e931, 0x23a0c56d),
+     TOBN(0xacfed288, 0x9c2f8b66), TOBN(0x20f6b94e, 0x386ad1e3),
+     TOBN(0x0e622304, 0xdcbeff77), TOBN(0x67e895fa, 0x5978f2f6),
+     TOBN(0x12a63bde, 0x20029bfe), TOBN(0x0ed75b6c, 0x8d968b8c),
+     TOBN(0x611739ee, 0x57cec33e), TOBN(0xeffaae72, 0x42b9fc44),
+     TOBN(0xa7de79ce, 0x971a90a9), TOBN(0x529bd8a2, 0x4fead0d5),
+     TOBN(0x78434c30, 0x9a1a43ef), TOBN(0x904d1db2, 0x4f3c848c),
+     TOBN(0xedb3c11e, 0x6d4234ad), TOBN(0x4e0c9ec4, 0x5975e9a0),
+     TOBN(0xc51236db, 0xff16ec74), TOBN(0xde652cff, 0x36d09231),
+     TOBN(0x0d7c18b7, 0xe60a0bc5), TOBN(0xaf041383, 0x9d7df012),
+     TOBN(0x9c0ff3f4, 0x47d4cfd0), TOBN(0x64c7e6c2, 0x3d97bac7),
+     TOBN(0x239d2500, 0x8cb44d50), TOBN(0x47189764, 0xbba96026),
+     TOBN(0x22449328, 0x31ddca37), TOBN(0xa53a1886, 0xfb7c29ef),
+     TOBN(0x2515b665, 0x97a3789b), TOBN(0x825c5031, 0x540ea258),
+     TOBN(0x76680656, 0x09a5b24b), TOBN(0x833c240f, 0x60fb8bcc),
+     TOBN(0x758e0b10, 0x01e55cc7), TOBN(0x8b799c48, 0x8d260572),
+     TOBN(0x0981a802, 0x6c5dd0cd), TOBN(0x6f6da55d, 0x1b9c6cc9),
+     TOBN(0x3457b685, 0x8c4d503a), TOBN(0xc537730f, 0x009a7a94),
+     TOBN(0x334d46b4, 0xd01dfdff), TOBN(0x3e5dc6a8, 0x15e20bc7),
+     TOBN(0x1833b0bf, 0x6ce8b8ab), TOBN(0xe21b99ae, 0xc57a4292),
+     TOBN(0x743cb595, 0x1713ba15), TOBN(0x550e41bc, 0xe0bb44a7),
+     TOBN(0xf356917a, 0x2f8ebcf5), TOBN(0x6f2c400b, 0x953f056c),
+     TOBN(0x09d9ac41, 0xdd84bb48), TOBN(0x50dc7a8e, 0xa61e98e3),
+     TOBN(0x1179a9d3, 0x3d3a6776), TOBN(0xdda312e7, 0x16de8b3e),
+     TOBN(0x62a8b7c3, 0xce6e2bea), TOBN(0x2b00036c, 0x645e4ca0)},
+    {TOBN(0x9ad2cbd7, 0xab6cf0b4), TOBN(0x7a1e67f4, 0xf13d1ddf),
+     TOBN(0xa58f0c73, 0x746003ba), TOBN(0x8263e888, 0xa64a8fcc),
+     TOBN(0x535cbe37, 0xbe2452f7), TOBN(0x93125766, 0x6ae81a76),
+     TOBN(0x7d2ed0ab, 0x3a553701), TOBN(0x93d7e7df, 0xb0717d78),
+     TOBN(0x61bc013c, 0xf9cf03ba), TOBN(0x36223b88, 0xfeee3a78),
+     TOBN(0x86efc923, 0x3d7e4c95), TOBN(0xaf3801be, 0x965625e4),
+     TOBN(0xa7bba141, 0x3f32fd9d), TOBN(0x70724dec, 0x4e564acb),
+     TOBN(0x52587f32, 0xb7edcac1), TOBN(0x0b1cd94c, 0xb3969985),
+     TOBN(0x9f08407a, 0x661fbdab), TOBN(0xc4d7c536, 0x58e52151),
+     TOBN(0xa3765bce, 0x63dfe954), TOBN(0xc6829bfb, 0xac2dddd1),
+     TOBN(0x97393f65, 0xdc6e4487), TOBN(0x9ba29422, 0xbf04c930),
+     TOBN(0x493c6914, 0x18838c0a), TOBN(0x41b137ff, 0x4b2f35cd),
+     TOBN(0xc9e4aa24, 0x4e1c5e60), TOBN(0x54bb5289, 0x13253d51),
+     TOBN(0xf4a86ab3, 0x9bbabe53), TOBN(0xd561feae, 0x6ac0aa64),
+     TOBN(0x27a896ab, 0x1911bad7), TOBN(0x9cb22b98, 0x64337303),
+     TOBN(0xf14262fb, 0x161f6928), TOBN(0x1661885c, 0x59ba6c9f),
+     TOBN(0x4666ebd3, 0xb82574db), TOBN(0xc5e86672, 0x8d8af3f6),
+     TOBN(0xcc645205, 0x209319bf), TOBN(0xc183c12e, 0x3834d1a8),
+     TOBN(0x533d73da, 0x49eb0f40), TOBN(0x3bcab0bc, 0x6aca649e),
+     TOBN(0xa02f4c41, 0xe39e8361), TOBN(0x2391e7ae, 0xa89bdc85),
+     TOBN(0x88067c5e, 0x608cbe2f), TOBN(0xcdec82f6, 0xf16c22f2),
+     TOBN(0x80aa719a, 0xf1faf9dc), TOBN(0x261fe951, 0x2340185c),
+     TOBN(0xcb411366, 0x9713e72e), TOBN(0xdb1e405e, 0x6d8a2a46),
+     TOBN(0xed174757, 0x11106ce0), TOBN(0x6d70cf6e, 0xf71c0e69),
+     TOBN(0xb5310322, 0xcf707c76), TOBN(0x3a1eb2ff, 0x40b4b7d7),
+     TOBN(0xb83259fb, 0xb1a2d26d), TOBN(0xa83ffb0f, 0x799720c0),
+     TOBN(0xeecb1928, 0x0bedb326), TOBN(0x4473e820, 0xe9271715),
+     TOBN(0x506e6d20, 0x2f2d71a9), TOBN(0xe7b253b1, 0x4319756d),
+     TOBN(0x27e19335, 0xf576cb3c), TOBN(0xe16e4573, 0xdfb3b78f),
+     TOBN(0xaf96d785, 0x63da0001), TOBN(0xb38deafd, 0xf7444c5e),
+     TOBN(0xaca6b38c, 0xc0eb0e28), TOBN(0xa6ca3541, 0x7fe41b98),
+     TOBN(0xfeb37b47, 0x18965b31), TOBN(0x739cc322, 0x597d5bc6),
+     TOBN(0x82776041, 0x4cb1fbc3), TOBN(0xcdaa873d, 0x8e2a3ad1),
+     TOBN(0xb5f87b34, 0xc01318bf), TOBN(0x0c692268, 0x229cb81e),
+     TOBN(0xb0724016, 0xa53089f5), TOBN(0xb2976a53, 0x05415313),
+     TOBN(0x436eab75, 0xcee8fdf2), TOBN(0x8794e1a6, 0xd82b13e5),
+     TOBN(0x0d51a072, 0xd5516e3d), TOBN(0x7bae61ce, 0x4b2fdb3c),
+     TOBN(0x0d987e89, 0x550728ee), TOBN(0xfd5a656e, 0xee6778db),
+     TOBN(0x942ee623, 0xbb4d9d7a), TOBN(0xfc06d64b, 0x2dc1baf8),
+     TOBN(0x5244fcd8, 0x47c3dc8e), TOBN(0x5e37e156, 0x8568653e),
+     TOBN(0xe5c2c6ff, 0x048c8355), TOBN(0x480872ec, 0xa0474046),
+     TOBN(0x67e3089d, 0x7ff92484), TOBN(0xdc071893, 0x29971b3e),
+     TOBN(0x3857db2b, 0x5a63e8ad), TOBN(0xf617d94e, 0x5f2e0a09),
+     TOBN(0x267e9818, 0x5844de79), TOBN(0xfdb103b2, 0x861f5f92),
+     TOBN(0xb969bd3c, 0x1570d6e9), TOBN(0x7350b9db, 0xe0fb517e),
+     TOBN(0x083b142e, 0x55aa543b), TOBN(0x424757be, 0xaa2bc581),
+     TOBN(0x4bd50f64, 0x69ea3302), TOBN(0x053dcf83, 0xed4c8288),
+     TOBN(0xac2b3074, 0xc118ac52), TOBN(0x57f066a8, 0xe76ca88b),
+     TOBN(0xb9ac28fd, 0x0a3207cb), TOBN(0x0ec2ad13, 0x205829b0),
+     TOBN(0x76216e56, 0x4f403b64), TOBN(0x7eaef662, 0x6621dd5c),
+     TOBN(0x9e0cc836, 0x4b06ac54), TOBN(0x16ac3c6c, 0x9648523c),
+     TOBN(0xe1208a1a, 0x08eec1d8), TOBN(0x1e90b3a2, 0xbe054a54),
+     TOBN(0xdfab7f92, 0x23a836cb), TOBN(0x624d6bd2, 0x6f7674c8),
+     TOBN(0xc34a914c, 0xea06210a), TOBN(0xba5314ec, 0xf26c4f23),
+     TOBN(0xd440b196, 0xa33a11cd), TOBN(0xf81ab63e, 0x75eb951f),
+     TOBN(0x05ebb91a, 0x39350f0c), TOBN(0x3f3c08ec, 0x92e9528f),
+     TOBN(0x54ff8844, 0x4fe6f4e6), TOBN(0x217c0e02, 0x79b7ba49),
+     TOBN(0x13c4372b, 0xbf3a4179), TOBN(0x6e5ad10b, 0xa1434264),
+     TOBN(0xc8426540, 0x62bd8ff2), TOBN(0x7c3dd284, 0x85fe6ef1),
+     TOBN(0x2c59b300, 0x05da0e84), TOBN(0xf303ed94, 0x17468e18),
+     TOBN(0xe19fac99, 0xa211ffd3), TOBN(0x408f9424, 0x3f1f6bca),
+     TOBN(0x1f5b76d1, 0xa5648244), TOBN(0xef3942e8, 0x95b2bd67),
+     TOBN(0x1b9dee7f, 0xb538f1d7), TOBN(0x1cb78620, 0x444b8f85),
+     TOBN(0x9f8ecd63, 0xcb8ea6a3), TOBN(0xca111b2e, 0xb9d3b71f),
+     TOBN(0xff83d71e, 0xbdc4e8e2), TOBN(0x43745ddb, 0x3f76a9d5),
+     TOBN(0x72db22a9, 0xa25856ee), TOBN(0xf34d5aa2, 0x5e9a9ff7),
+     TOBN(0x01f6b5f3, 0xbc529902), TOBN(0xadf5d31e, 0x086f4867),
+     TOBN(0xbd88674f, 0xca556b56), TOBN(0xfd00120d, 0xfdc81625),
+     TOBN(0x90fbaba0, 0xfdde77f6), TOBN(0x266d3bfe, 0x559ec6e7),
+     TOBN(0x372acf54, 0xc8094357), TOBN(0x772bd8e4, 0x6c61bb78),
+     TOBN(0xcb2ac592, 0x1af9aefc), TOBN(0xacc3dc9b, 0x5b178386),
+     TOBN(0x09963084, 0x23438463), TOBN(0xae84f973, 0x8359f1e6),
+     TOBN(0xc3b19aa0, 0xa4cee642), TOBN(0xcd5ca5c8, 0xb19a918f),
+     TOBN(0x46ac0d2e, 0xe67cb207), TOBN(0x2ae45e10, 0x73ffebf2),
+     TOBN(0xf84aad8e, 0x10ef065c), TOBN(0xa0af57fa, 0x32a7e903),
+     TOBN(0x42295904, 0x43d346dc), TOBN(0x8d6f711d, 0x7f170965),
+     TOBN(0x11aa7070, 0xb110cffe), TOBN(0x091a100d, 0x9755605d),
+     TOBN(0xc5a0c654, 0xd27d86a6), TOBN(0x1031a244, 0xdb30feaa),
+     TOBN(0x36804045, 0xc02228d9), TOBN(0x1877fc67, 0x8b746039),
+     TOBN(0xba554015, 0xe09bb238), TOBN(0xc50d8f92, 0x1de9b40d),
+     TOBN(0x29e40d88, 0x032f7a2c), TOBN(0x514b56dd, 0x1d315ec2),
+     TOBN(0x9052652e, 0x61778f04), TOBN(0x0d2bc606, 0xe1a1c195),
+     TOBN(0x375fd7ec, 0xb05043ae), TOBN(0x03b82577, 0x6eba4d1b),
+     TOBN(0x8e61b567, 0xc349b39a), TOBN(0xa670973a, 0xb35fc43b),
+     TOBN(0x80c05ca7, 0x5571b4a7), TOBN(0x95d14f49, 0x8a4af0ba),
+     TOBN(0x96767cdb, 0x67bf4290), TOBN(0xb293372f, 0x46870ef1),
+     TOBN(0xc6494405, 0x1afe1027), TOBN(0x9f027a1c, 0x9019c4c2),
+     TOBN(0xa392ac59, 0x188a593a), TOBN(0x68acca2f, 0xfcb6e1ca),
+     TOBN(0xd8f86cbe, 0x68ed921b), TOBN(0x24679ac2, 0x712d2c07),
+     TOBN(0x18fbdb21, 0x4e672cd9), TOBN(0x401bb718, 0x51d1f8e1),
+     TOBN(0x688792e1, 0xaa8da4a1), TOBN(0xedf9266f, 0x3ca93d06),
+     TOBN(0x5ddba14a, 0xaed484df), TOBN(0xa5dab102, 0xb0ea10a5),
+     TOBN(0xd397edcd, 0x833396ea), TOBN(0x78a75693, 0xed5e6747),
+     TOBN(0xf2c844ba, 0x1a5f8260), TOBN(0xbcafe59d, 0x5fb9fec5),
+     TOBN(0xa2413d5f, 0xd3147e7e), TOBN(0x130dd9e3, 0xafdf26cd),
+     TOBN(0x44be87ec, 0x9ad1abde), TOBN(0xe925c495, 0x6e77fbe8),
+     TOBN(0x07ce8d96, 0xf26ced16), TOBN(0x36c85643, 0x86ef7306),
+     TOBN(0x62545902, 0xc7e3d409), TOBN(0x1747bf4a, 0x2ed4d38e),
+     TOBN(0x6fe6fc3d, 0x55adc839), TOBN(0x20a3cc09, 0x8eaf64a8),
+     TOBN(0xc1e9b766, 0x622887b1), TOBN(0x7b9d2f96, 0xc41ac659),
+     TOBN(0xfdb897ce, 0xf2a65e45), TOBN(0x0c09c905, 0x97889eb8),
+     TOBN(0xa15df10f, 0xe4becf5b), TOBN(0x14a3d4fe, 0xccef7e40),
+     TOBN(0xedaa11f6, 0xa8fc67bd), TOBN(0x7bf6fe9b, 0x5d185b42),
+     TOBN(0x7bb9f1f5, 0x6f9cb5c9), TOBN(0x1b4ab74e, 0xf97ea9cd),
+     TOBN(0xe9ebf11d, 0x07638d62), TOBN(0x413a4a87, 0xa78cf538),
+     TOBN(0x93785f86, 0x570dd371), TOBN(0xba431a91, 0xfb48063c),
+     TOBN(0xf1f2ea5b, 0x4ed4e5fa), TOBN(0x91a72c47, 0x5308325a),
+     TOBN(0x4e6518e7, 0xc9ea6acb), TOBN(0xfeaf4c3c, 0x208f67e3),
+     TOBN(0x98c5d768, 0x2c16bb1a), TOBN(0xbf91b62d, 0xee31dc08),
+     TOBN(0xe9ad408d, 0x33a54959), TOBN(0x9d754a64, 0x38b7170b),
+     TOBN(0x106db7bc, 0xd9d6da2b), TOBN(0xf556cbb4, 0xadd533af),
+     TOBN(0x62db0de0, 0xf16d3b58), TOBN(0x78a1b0be, 0x1fa579ba),
+     TOBN(0xda96740b, 0x7b552058), TOBN(0x0c689cc6, 0x626c4d93),
+     TOBN(0xee3dd5c9, 0xaf68e53b), TOBN(0x78653a9f, 0x134d763b),
+     TOBN(0xec9c1b72, 0x3ca5aa67), TOBN(0x67471dac, 0x7d56992e),
+     TOBN(0x0a97dffe, 0xad1d8580), TOBN(0x11c7d93d, 0x0063c040),
+     TOBN(0xb79e355c, 0x6e90b157), TOBN(0x2c06edcb, 0xd9c894c4),
+     TOBN(0x9b931897, 0x71a75ed7), TOBN(0xd7f00247, 0x8e95ad91),
+     TOBN(0xfce1b489, 0xb85bf054), TOBN(0xa3ffb8fd, 0x503b38bf),
+     TOBN(0xe7ea3ad4, 0xe0fe2ec9), TOBN(0x0f32f520, 0x0049865d),
+     TOBN(0x33afa324, 0xcff21b51), TOBN(0x3d6847d7, 0x62a1cd24),
+     TOBN(0xf534e159, 0x0b06ce2f), TOBN(0x24d27b3d, 0xae7cdae0),
+     TOBN(0xb727db29, 0x4ad68ab5), TOBN(0x7e8e47e3, 0xb63c0bc9),
+     TOBN(0xe81f3122, 0x02389039), TOBN(0x0c281f52, 0x88e6a17c),
+     TOBN(0x3cc00e21, 0x091e1c4c), TOBN(0xd500db44, 0x867ccc75),
+     TOBN(0xa8e2e84b, 0xf5ebbbe4), TOBN(0xc3266881, 0xc4279ac0),
+     TOBN(0x2e8fb4de, 0x7a170658), TOBN(0x219c5ec1, 0x51da4a2e),
+     TOBN(0xda69a3fd, 0xeeacee19), TOBN(0x9d4c6fbd, 0x30462243),
+     TOBN(0x43673fe8, 0xa978c29e), TOBN(0x6e825c95, 0x5861bbc1),
+     TOBN(0xb41d1435, 0xdba8e7ba), TOBN(0x0f286f78, 0xb885d004),
+     TOBN(0xea42b7fd, 0xee57436f), TOBN(0xcdae14bc, 0xef7e29c7),
+     TOBN(0x50cff3f0, 0x24251056), TOBN(0xf60809fe, 0x6f6e8cb1),
+     TOBN(0xee9f1d15, 0x12932e53), TOBN(0xa6e55cd6, 0x167d5097),
+     TOBN(0x5df8816d, 0x9d926359), TOBN(0x108e2117, 0x797b7eca),
+     TOBN(0x7ba20319, 0x91921587), TOBN(0x304138e4, 0xad23652e),
+     TOBN(0x73d0ed57, 0x51ebc32f), TOBN(0xe0c10a38, 0xf01d0fc3),
+     TOBN(0x14c6b72f, 0x78c49b19), TOBN(0x4f952b7e, 0x3b7c7418),
+     TOBN(0x3fe75d21, 0xa2d019bf), TOBN(0x4837bfd2, 0x7ca33e87),
+     TOBN(0x4597729b, 0x3946e7ea), TOBN(0xbe22c14a, 0x4c37ea10),
+     TOBN(0x91106c7c, 0xd7909474), TOBN(0xfbf1e7db, 0xbf5551a1),
+     TOBN(0x8e06336c, 0x55ffea13), TOBN(0x0deaeda0, 0x0a1f99f5),
+     TOBN(0x9b738c4b, 0xfda98fc9), TOBN(0x061cc613, 0xa59c98ba),
+     TOBN(0x5ceb5b83, 0xb477692c), TOBN(0x5db77559, 0x1fcc473b),
+     TOBN(0x77214b62, 0x83df476c), TOBN(0x2ffac971, 0x427ea01d),
+     TOBN(0xf29f600b, 0x49fd0ba7), TOBN(0x1106f8b2, 0x7233ef79),
+     TOBN(0x706bc171, 0xe8a0ca35), TOBN(0x4da7a9e6, 0xacbff08b),
+     TOBN(0x17c2fa4e, 0x7725f97c), TOBN(0xab459314, 0xe84a5095),
+     TOBN(0x01556f14, 0x6b24d47e), TOBN(0x01399059, 0xb016dc1a),
+     TOBN(0x154b84c7, 0x28eca6c6), TOBN(0x88ed8612, 0xd9084e68),
+     TOBN(0x4dfd5080, 0x00bf9b5b), TOBN(0x853cd8ab, 0xba9a0cca),
+     TOBN(0x8cbf9bd8, 0x8af0e94b), TOBN(0x50782b73, 0x83035d16),
+     TOBN(0x694d3e65, 0x4f44533c), TOBN(0x155d4bf4, 0xa6e534eb),
+     TOBN(0x9028e2ab, 0xee908b6b), TOBN(0x36e5aac0, 0xa6743060),
+     TOBN(0xd26f5a51, 0x3c37d6f1), TOBN(0x8483703e, 0x33729b9e),
+     TOBN(0xf27a6603, 0x2e5f82a5), TOBN(0x33bf2bdc, 0xca55d187),
+     TOBN(0x894c415c, 0x7724a85f), TOBN(0x9255d416, 0xa2ea178d),
+     TOBN(0x35ecb4e2, 0x0a6dc5b9), TOBN(0x8b3fc2c8, 0x51c54ed2),
+     TOBN(0x059f86eb, 0x9eede13d), TOBN(0xa796c750, 0x791dd5eb),
+     TOBN(0xb2f33680, 0xea88555b), TOBN(0x92730950, 0x1245348c),
+     TOBN(0x1a5545f8, 0xd1e63bfb), TOBN(0xfebc9a14, 0xbebb7858),
+     TOBN(0x13cce767, 0x6bdf0c84), TOBN(0x1aa9dc07, 0xa1d341fa),
+     TOBN(0xd46e8ff6, 0x1ee6fa43), TOBN(0x4198e5d6, 0x4b1dda64),
+     TOBN(0xe82a8134, 0x2782abd1), TOBN(0xe6f7b1b4, 0xb6d64830),
+     TOBN(0xabe00274, 0x7f0fb374), TOBN(0xf1a8e2b7, 0x7494d7d3),
+     TOBN(0xd16b0d9e, 0xf274f296), TOBN(0x3c94a7ac, 0x65246ee9),
+     TOBN(0xd32c32da, 0x91ec2262), TOBN(0x04c7bb90, 0x83116ec1),
+     TOBN(0x70fa0406, 0x78524a06), TOBN(0x8d2d5176, 0x07df8064),
+     TOBN(0x13e589f2, 0xe2c8d48a), TOBN(0x3b110ac4, 0x122aed4e),
+     TOBN(0xe8e0eb52, 0x34e972cf), TOBN(0xc082944a, 0xfb3a77fe),
+     TOBN(0xcdaff7a3, 0x6a32c23b), TOBN(0x88cc568d, 0xc37b4a2c),
+     TOBN(0xc9979a9c, 0xe27b2552), TOBN(0x8612ae7d, 0xd6ef51f9),
+     TOBN(0x7bf0f937, 0xef4e8f85), TOBN(0x2f360a58, 0x3f12d45c),
+     TOBN(0x3ec9d0e3, 0x9b336663), TOBN(0x5ac2df38, 0xb1438d2b),
+     TOBN(0x7f2de910, 0xff93fde4), TOBN(0xbbc460da, 0xd92534ba),
+     TOBN(0x74de3159, 0x59a94ab9), TOBN(0xd51cfd32, 0xc45b80dc),
+     TOBN(0x9f1f349c, 0x6e5b2397), TOBN(0xbdbd16ed, 0x995f7271),
+     TOBN(0x4a7efc1c, 0xf59709a6), TOBN(0x74e2760d, 0x4b3db99a),
+     TOBN(0xa7238e9e, 0x7726a2e1), TOBN(0x47764208, 0x1a376013),
+     TOBN(0xbc96f396, 0x7e33ebc0), TOBN(0x31e159e6, 0xc9e4ec0d),
+     TOBN(0x26a5aef2, 0x6a2ab9f6), TOBN(0x23add07c, 0x320eeea7),
+     TOBN(0xa79a97c9, 0x833b45b6), TOBN(0xb08da907, 0xc51885e6),
+     TOBN(0x23f5e651, 0xae8d5659), TOBN(0x1eb0be48, 0x1faff2f2),
+     TOBN(0xe414ee3d, 0xa1e090da), TOBN(0x16e4f8fa, 0x7fcb664f),
+     TOBN(0x7a15a7e4, 0x98c36865), TOBN(0xea60e8fd, 0xaf89dacf),
+     TOBN(0x4e009f45, 0x86c1a4b4), TOBN(0x78c1bebf, 0x769644ad),
+     TOBN(0xa41b480f, 0x0b4b3501), TOBN(0x98be5037, 0x57f0a0e9),
+     TOBN(0x06934887, 0x3af24657), TOBN(0xe2503ddb, 0x2b6260f9),
+     TOBN(0x37c936c2, 0xd1d0caaa), TOBN(0xd371e991, 0x16431f50),
+     TOBN(0xd9621d16, 0x6087c5e5), TOBN(0xae49c2ce, 0xc53a8bc5),
+     TOBN(0xd7868882, 0xcad314cd), TOBN(0xfde10dc7, 0xaa57af18),
+     TOBN(0x3fa8a60d, 0x3800f397), TOBN(0xcec8ae7b, 0x388b333c),
+     TOBN(0xefd8d692, 0x85fa8129), TOBN(0x33d5685b, 0x90776c32),
+     TOBN(0x47ecec0a, 0x65971a6e), TOBN(0xe8a20bbe, 0xad7c5755),
+     TOBN(0xbeed0a4d, 0x87372016), TOBN(0xd0d499bb, 0x1d9b8dc0),
+     TOBN(0xf4ce27cd, 0x2800907d), TOBN(0x07a30b77, 0x8622bbb7),
+     TOBN(0x7532f435, 0x77e264db), TOBN(0xfdd1a9c3, 0xd64f0710),
+     TOBN(0x92ca210f, 0xa6543720), TOBN(0x2f19ed66, 0x5bb6985a),
+     TOBN(0x08a4ac61, 0xf9399b43), TOBN(0x0b7bac5d, 0x757f241d),
+     TOBN(0x93ef27cc, 0x3763c20d), TOBN(0xda3b206e, 0xa86b1f05),
+     TOBN(0x8f19c74a, 0xd62467c0), TOBN(0x3ec5ef6d, 0x6a3ad263),
+     TOBN(0x249aa636, 0x2bc8b9f0), TOBN(0x0fca7318, 0x7f70990c),
+     TOBN(0x6d4aabc5, 0x6f038497), TOBN(0x4647f72b, 0x5afaaaef),
+     TOBN(0xc7cbe03a, 0x7bf90444), TOBN(0x6beb69ac, 0xcac2efb0),
+     TOBN(0x58544eba, 0xbb3c6dc0), TOBN(0x569cdcd6, 0x96aefc2f),
+     TOBN(0x2e8a4c57, 0x5e4c950d), TOBN(0x6f5341d7, 0x4dd32002),
+     TOBN(0xd0345db6, 0x6efa5908), TOBN(0x4b043197, 0xf1d2bbe6),
+     TOBN(0xde8a4cb6, 0xe8730bae), TOBN(0x9a89231f, 0xa485cb62),
+     TOBN(0xb24ace89, 0xfcd9bcd4), TOBN(0x01892cc0, 0x3ed5801d),
+     TOBN(0x80ce2f30, 0x413408f9), TOBN(0xaf67343a, 0xf8773b6a),
+     TOBN(0x91acc6d2, 0xdd6ade17), TOBN(0x9d2ffeca, 0xe5eb3def),
+     TOBN(0x72f8af06, 0x50b029fd), TOBN(0x339c802c, 0x79c0aabd),
+     TOBN(0x46161fff, 0xafc0a6ad), TOBN(0x1046d9f8, 0xbac9a2d4),
+     TOBN(0x2f12eb06, 0xab920e51), TOBN(0xfc004900, 0x2892e552),
+     TOBN(0x9aadf93e, 0x13e61154), TOBN(0x4468da94, 0xabcfd127),
+     TOBN(0x6a5d3ffe, 0x152f220e), TOBN(0xe6260c23, 0x4737fe79),
+     TOBN(0x8b5dd1c9, 0x5e6b4251), TOBN(0x044f0656, 0x9af02b98),
+     TOBN(0x434d475c, 0xa97ff366), TOBN(0xbae8db8e, 0x2c4bcc46),
+     TOBN(0x2ba43a8b, 0xf9777251), TOBN(0x7ff430a5, 0xdd019f1a),
+     TOBN(0x65e9f290, 0x630064ba), TOBN(0xfc57a54e, 0x7e871c0e),
+     TOBN(0x54107bbb, 0x5791ae48), TOBN(0xdfce137f, 0x5c334de0),
+     TOBN(0xab65c8f6, 0xaed5be73), TOBN(0x838c3958, 0x174bf00b),
+     TOBN(0x27c57199, 0xf1c7e594), TOBN(0x62643d81, 0x0d02fae6),
+     TOBN(0xc1e70c12, 0x5f4431fa), TOBN(0xfac86124, 0xb2b41f7e),
+     TOBN(0x062ac35a, 0xf0108e3c), TOBN(0xd7d34dfc, 0xa43d3a28),
+     TOBN(0xc40fb44a, 0x3143de4d), TOBN(0x06eac4ed, 0xd2e0f9ae),
+     TOBN(0x998f3211, 0x95d9a69a), TOBN(0xb268f6a0, 0xe950bd2e),
+     TOBN(0xadfab210, 0x1e9d4e40), TOBN(0xc453a68c, 0x73ce9324),
+     TOBN(0x5e2f2544, 0x80881171), TOBN(0xe4f596db, 0xee7e543e),
+     TOBN(0x77f48e4e, 0x76b6698e), TOBN(0x47b5165f, 0x227365c6),
+     TOBN(0xf56ec8d4, 0x14ef39e6), TOBN(0x1638d647, 0x74ce46fa),
+     TOBN(0x244d0fac, 0x08aa8b9a), TOBN(0x98ccc4d0, 0x298326c9),
+     TOBN(0x492d7661, 0xce0d2983), TOBN(0x728b3e3f, 0x73158cda),
+     TOBN(0x7959ca67, 0xc4948011), TOBN(0x32044ae9, 0x08425a38),
+     TOBN(0x05a7a6a7, 0xb1070c2b), TOBN(0x34ed541f, 0xcc129ba5),
+     TOBN(0x4b6bf65c, 0xb2f1c3e2), TOBN(0x6f090ce6, 0xd0d8aec8),
+     TOBN(0x11ade23a, 0xd4fe39c1), TOBN(0x50510c08, 0xa5a35528),
+     TOBN(0xb7e2a5de, 0xad6fd7c6), TOBN(0x9d691939, 0x2745dca8),
+     TOBN(0xff669c38, 0xad053184), TOBN(0x394ca6b7, 0xecd0703e),
+     TOBN(0x59e32e80, 0x60b15e75), TOBN(0x82dde889, 0x13c14864),
+     TOBN(0x0fd1624c, 0x64d4f086), TOBN(0x7fb502a7, 0xc9893d7f),
+     TOBN(0x59b86bcf, 0x711479a1), TOBN(0xfd4bc4d8, 0xc40b44bc),
+     TOBN(0x2fae18f5, 0x988100c3), TOBN(0xe4af2f4f, 0x615867d7),
+     TOBN(0x7d45e1e8, 0xbe479e28), TOBN(0x547accbd, 0xa04798a5),
+     TOBN(0xe88a85b1, 0x1c458b5e), TOBN(0xe144f7f2, 0x6032f0cc),
+     TOBN(0xad5276d3, 0x3f807365), TOBN(0x5b6519e7, 0xb318a6ea),
+     TOBN(0x5889cbb5, 0x2d0fcf50), TOBN(0xdce91cab, 0x2bdab4e0),
+     TOBN(0x17b6249f, 0x41b78954), TOBN(0xc9320b65, 0x6f10449b),
+     TOBN(0xe38a7cc0, 0xf264ae8f), TOBN(0xaab8803e, 0x52b85829),
+     TOBN(0x63668621, 0xdd97973c), TOBN(0x5aaedce7, 0xd04138c7),
+     TOBN(0x8e8e6614, 0x1762874c), TOBN(0xd0cefcf4, 0x163fc862),
+     TOBN(0x0ebe0048, 0xffed1ace), TOBN(0x070c3348, 0x7a8c2673),
+     TOBN(0xb801d159, 0x9b0d3fd7), TOBN(0xf1d55911, 0x922d4842),
+     TOBN(0xf0acf768, 0x680dcbf9), TOBN(0x5072b825, 0x4f0a51df),
+     TOBN(0x3a74751c, 0xd88df9c5), TOBN(0x9d20f989, 0x1cc1a332),
+     TOBN(0x4e90042b, 0x6926c34a), TOBN(0x5c728b1e, 0x00766880),
+     TOBN(0xf2e3bfe8, 0xf76e9dcb), TOBN(0xd9822f0a, 0x15a125ae)},
+    {TOBN(0xbf84db58, 0xf51b14b0), TOBN(0xdf73ccf5, 0xa39a79f0),
+     TOBN(0x0ce1e584, 0x2b5a1f11), TOBN(0x841fa6a3, 0x185fc400),
+     TOBN(0x94b09c68, 0x2455c32a), TOBN(0x383c9bde, 0xbfa71cc3),
+     TOBN(0xb6381486, 0x1e797929), TOBN(0x33036faf, 0x623d0a5d),
+     TOBN(0x41b6cf7c, 0x90f17cba), TOBN(0x5d655ff4, 0x30c7c5f4),
+     TOBN(0xc64f29d5, 0x4ccc7f38), TOBN(0xf28e8531, 0x6124a79e),
+     TOBN(0x1efa8d51, 0x67bf1e98), TOBN(0x8610027f, 0x5d7a33b0),
+     TOBN(0x35fe2bb2, 0xcb9a40a4), TOBN(0xc5cc1bf1, 0x43d50a0b),
+     TOBN(0x84dbc605, 0x46e33870), TOBN(0x23d8d2e5, 0x843c4e1e),
+     TOBN(0x69964b5e, 0x4cf8b569), TOBN(0x2a5228e8, 0xe0c546a5),
+     TOBN(0x4c0467ed, 0x96d6e111), TOBN(0x25764cdf, 0xa12bd298),
+     TOBN(0x92a3e7fa, 0xfbaaad46), TOBN(0x08ac1d36, 0xd12fa469),
+     TOBN(0x60ae2bbf, 0xa32106c2), TOBN(0xef155b2a, 0x3e917750),
+     TOBN(0x5567c3c7, 0x13853a30), TOBN(0xa6be8290, 0xeddb305b),
+     TOBN(0x2db58c21, 0xade26eec), TOBN(0xfa3c895c, 0x003c17ed),
+     TOBN(0x96ab0de1, 0x6293f8a2), TOBN(0xbd2365ec, 0xac3710c6),
+     TOBN(0x93ea8553, 0x6aa24f73), TOBN(0xf75140d0, 0xe0410c40),
+     TOBN(0x760cfa2f, 0xaff0f7f2), TOBN(0xc6dfb3c7, 0x3e580d68),
+     TOBN(0x25fc2091, 0xc16d39e2), TOBN(0xa05b0c81, 0x19e1d5e2),
+     TOBN(0xd4d223d8, 0x62bbec7a), TOBN(0x11a93775, 0xf293f34a),
+     TOBN(0x9ab03e73, 0xe194c642), TOBN(0x607b7106, 0x789e3c85),
+     TOBN(0x952aab02, 0x4bdacd55), TOBN(0x31ca3ee2, 0x21cc6084),
+     TOBN(0xd3149b2b, 0x1c6b93f9), TOBN(0xcbc5ef3b, 0xead930f8),
+     TOBN(0xed04984f, 0x22872630), TOBN(0xef5d052d, 0x6c4b6fe2),
+     TOBN(0x808ae6c0, 0x6010ffa2), TOBN(0x88b6fcd8, 0x1143166a),
+     TOBN(0xa2780263, 0x5ab945ec), TOBN(0x4777b4aa, 0x36db5012),
+     TOBN(0x2156bf83, 0x059aa3c7), TOBN(0xcbef6fb7, 0x2a660260),
+     TOBN(0x189fa221, 0x8b366ce5), TOBN(0xd6f5bdaa, 0x08290914),
+     TOBN(0xd2028d05, 0x57028677), TOBN(0x90eebeeb, 0xce9aabdf),
+     TOBN(0xab977aee, 0x06d4e5d0), TOBN(0x7a98c527, 0xf9361873),
+     TOBN(0xe49b1251, 0xb7c2474d), TOBN(0xcdaf2a36, 0x5f3e7b02),
+     TOBN(0x638bcaf4, 0x6fe54af1), TOBN(0xfec42624, 0x1dac06b7),
+     TOBN(0x422be225, 0x3741a88b), TOBN(0x1f3b82c3, 0x5304f139),
+     TOBN(0x101eab8e, 0x181c2fc2), TOBN(0x8522738e, 0x5898163c),
+     TOBN(0x0372d05f, 0x2d2bac1b), TOBN(0xb65c786c, 0x1d1f3c42),
+     TOBN(0xbd59694b, 0x64e2f5b3), TOBN(0xf1c424bf, 0x24c5671b),
+     TOBN(0xda738cf5, 0x1eafe37b), TOBN(0x503eac24, 0x30dd7c2b),
+     TOBN(0xf9b7b7a5, 0x11dd77af), TOBN(0x0ade03af, 0xe9dcfe7c),
+     TOBN(0x489bd34a, 0xf479e3b5), TOBN(0x993ab403, 0x030a33f3),
+     TOBN(0xaef322bf, 0x9fb64068), TOBN(0xa47cc71b, 0x0e27f110),
+     TOBN(0x1c445554, 0xefab99c8), TOBN(0x7c3c51e7, 0xa7f10e58),
+     TOBN(0xaa8b43ee, 0x78a87474), TOBN(0x037d6397, 0x2418475a),
+     TOBN(0xc9c751fe, 0x10324911), TOBN(0x3d65d9e0, 0x3e0797d4),
+     TOBN(0x98b68d2b, 0x7dea2a63), TOBN(0xa211ed3b, 0xf4afca19),
+     TOBN(0xe19ff8f8, 0xc63b9e75), TOBN(0x43f6b4fc, 0x0d7d130a),
+     TOBN(0xdba3385d, 0x7c8490b7), TOBN(0x97889df7, 0x0252c14a),
+     TOBN(0xfccfca86, 0xb2f18b9f), TOBN(0xf092ff9e, 0xc3a87422),
+     TOBN(0xf96dd675, 0x67474838), TOBN(0x039e8287, 0x5bad2e9f),
+     TOBN(0x7ed85e70, 0x52e041f6), TOBN(0x3d6ef1e7, 0xcfdeb19f),
+     TOBN(0x9f9fe399, 0x0d9ac66e), TOBN(0x5825e7bf, 0x16cb8554),
+     TOBN(0xecffdf90, 0xd954a4d5), TOBN(0x8617ffdd, 0x20678fc5),
+     TOBN(0x3e974054, 0x666df77b), TOBN(0x748379d1, 0xb5d92788),
+     TOBN(0x46a60911, 0x2da32c0a), TOBN(0xb2e1ac32, 0xb2676ca3),
+     TOBN(0xfb74093f, 0x17614dc6), TOBN(0xf44939e4, 0x3f27f965),
+     TOBN(0x4656a402, 0xc922422b), TOBN(0xd60a55ba, 0x3ff5c56f),
+     TOBN(0x0d061b41, 0xab9aa62e), TOBN(0xc9ceacfe, 0xaca3acd2),
+     TOBN(0x056d5718, 0xd946003b), TOBN(0xf8530d6d, 0x2c7815f3),
+     TOBN(0xbae14342, 0x706536b8), TOBN(0x45c96dda, 0x2b901188),
+     TOBN(0x386d88b6, 0xc64ed946), TOBN(0xb7017022, 0x6c00f1c2),
+     TOBN(0x28519811, 0xec8988df), TOBN(0x3b011fe2, 0x5a05cffc),
+     TOBN(0x4f581d47, 0x515f954c), TOBN(0x145f925b, 0x7f470a40),
+     TOBN(0xfee6b6b0, 0x736feaaf), TOBN(0xf90744af, 0x2ea5743b),
+     TOBN(0x4d8e8cea, 0xa2f36f56), TOBN(0x4239a6ce, 0xe3ed4007),
+     TOBN(0x0906b5bd, 0xd515e6db), TOBN(0x53622990, 0x8ac973d1),
+     TOBN(0x472ceb94, 0xeb2fe229), TOBN(0x0775ed41, 0x6a121363),
+     TOBN(0xc0492e07, 0x761ddb38), TOBN(0x80c24d51, 0xaef9be2f),
+     TOBN(0xa2a3982b, 0xdcba73a1), TOBN(0xe0d83978, 0x4e26d062),
+     TOBN(0x794959a8, 0xcd41c930), TOBN(0x7d2a88d7, 0x70131161),
+     TOBN(0x48f93fc3, 0xf4f966da), TOBN(0xf92691a0, 0xed5b6487),
+     TOBN(0xc5a93e5d, 0xada2c1fc), TOBN(0x4a7aca52, 0x4b7d9243),
+     TOBN(0x810aba93, 0xd7c5598b), TOBN(0x98f9ead2, 0x25109638),
+     TOBN(0xe8c6e893, 0xa388481a), TOBN(0x56e96b9b, 0xe91ce74b),
+     TOBN(0xfa1e5dc3, 0xd935f591), TOBN(0x985bb06c, 0x555eb816),
+     TOBN(0x6478c518, 0xc4d14e69), TOBN(0x48afbdbc, 0xc7f47349),
+     TOBN(0xbde90933, 0x26fed96c), TOBN(0xf9b96f41, 0xcd468186),
+     TOBN(0x22de6a29, 0x730e8518), TOBN(0x7a3dc912, 0x915db842),
+     TOBN(0x8d13b665, 0xfc1f9449), TOBN(0x6e9932a9, 0xdd4bba75),
+     TOBN(0xa90ce8e5, 0x564083da), TOBN(0x8a7cf362, 0xbbf7989d),
+     TOBN(0x652eccb7, 0x1b07ee2f), TOBN(0x0c0dcf1a, 0x6857a141),
+     TOBN(0xa87ec410, 0xb7bfb43e), TOBN(0xaebdb7e7, 0x82b8d179),
+     TOBN(0xeb3bc468, 0x625a24dd), TOBN(0x7e45e47b, 0x463b1f89),
+     TOBN(0xc3013535, 0x00c75a48), TOBN(0xafea920d, 0x13778807),
+     TOBN(0x0d1e9277, 0x22dcef16), TOBN(0xa2a10f67, 0x86cecfd6),
+     TOBN(0xad40e29c, 0xd7160bf2), TOBN(0xe78e6589, 0xeac1265e),
+     TOBN(0xd3a24310, 0x0c62c041), TOBN(0x4d27344a, 0x6c03c747),
+     TOBN(0x0b19e4a6, 0x7d3ee9d1), TOBN(0x9cf2eccd, 0xcd90de33),
+     TOBN(0x673a9d1f, 0xfda636a9), TOBN(0xb7349981, 0xa86ee501),
+     TOBN(0x11ca1e49, 0xe43766ed), TOBN(0x0806af6f, 0xe3ff3b08),
+     TOBN(0x21304338, 0x8a01f119), TOBN(0x58a6d3be, 0xf3cb268f),
+     TOBN(0x40ceacca, 0xe37d7851), TOBN(0x18694595, 0xef5b81e8),
+     TOBN(0x35678ed7, 0x84bad32a), TOBN(0x4f280f92, 0xd1624256),
+     TOBN(0xdecb1f1e, 0xfb28709c), TOBN(0x2a7f3048, 0x164911d7),
+     TOBN(0x32551d31, 0x579d8a41), TOBN(0x754c7c24, 0x60a5ee33),
+     TOBN(0x2c53fbff, 0x6a88f85f), TOBN(0x6ad0bda7, 0x2c7a36a0),
+     TOBN(0x8b3674f8, 0x15724d6c), TOBN(0x614727ce, 0xb9b7b34a),
+     TOBN(0x384fba98, 0x82ca9cd7), TOBN(0x8ef4343c, 0x0c566025),
+     TOBN(0x5645fefb, 0x64886c98), TOBN(0x702befb3, 0x0f5c29e8),
+     TOBN(0x6d74a7e0, 0x46de1523), TOBN(0xcb2bcdb9, 0xb1302163),
+     TOBN(0xe65cff39, 0xab4ca69b), TOBN(0xeacb7103, 0xf2d4f6ec),
+     TOBN(0x15826c2d, 0x1770d3ef), TOBN(0x38b008f1, 0x3f710600),
+     TOBN(0xc68450cb, 0x4bc7dccb), TOBN(0xb5f11b26, 0x9e5f2400),
+     TOBN(0x2af58e9e, 0x9c3a833b), TOBN(0xb60e2672, 0xa058abaa),
+     TOBN(0xe891bf8c, 0x75b080c0), TOBN(0x5b09b276, 0x2434bf38),
+     TOBN(0x0d90a040, 0x700b8739), TOBN(0x995cb042, 0xe69f4a0b),
+     TOBN(0xe30df0a1, 0x44a56b84), TOBN(0xbaf92d16, 0x1ead5a62),
+     TOBN(0xe214a062, 0x6e0193a4), TOBN(0xd41de5bc, 0xe9758b9e),
+     TOBN(0xcf214213, 0x732d82d5), TOBN(0xaa1421f6, 0xf949f07b),
+     TOBN(0x5f38c91e, 0xf7fb101c), TOBN(0x47ce2ec2, 0x2a3e41e4),
+     TOBN(0x6bb34768, 0x240c7897), TOBN(0x80ff54ea, 0x7b45473e),
+     TOBN(0x16acd40f, 0x82fe5aac), TOBN(0xa3e76f52, 0x4350449f),
+     TOBN(0xf7a3579e, 0xacacbeb9), TOBN(0x9791e0e0, 0x7bc40732),
+     TOBN(0xb26da7b5, 0xbc58cb9d), TOBN(0x11d9fc80, 0x987e18f4),
+     TOBN(0xc3c189a8, 0x1d8e0d34), TOBN(0x3011097c, 0x2d42e0b5),
+     TOBN(0x4e385932, 0x94ab9371), TOBN(0x79e0c2ce, 0x0c237147),
+     TOBN(0xc9f17122, 0x7172e6ce), TOBN(0xf8d73b1d, 0x9b89a008),
+     TOBN(0x91690c6b, 0xa945995d), TOBN(0x089eb941, 0xc15306c6),
+     TOBN(0xee5f526d, 0x12ac8df5), TOBN(0xf1dd23f7, 0x3bf94c65),
+     TOBN(0x594ceaac, 0x81a3cb0e), TOBN(0x07d41d3b, 0x9757cc8b),
+     TOBN(0x9eb0081d, 0xfc5603d5), TOBN(0xfb5d3298, 0x57bd230c),
+     TOBN(0xf2c0402e, 0xcde3f845), TOBN(0xa2defd67, 0x41e8aba6),
+     TOBN(0xb300802a, 0x2dd9573d), TOBN(0x64e401a5, 0x60c1ded3),
+     TOBN(0x19d4a677, 0x8ab1d3d8), TOBN(0x3c2092f2, 0xcca04f74),
+     TOBN(0xf4827ba5, 0xac40056a), TOBN(0x49d4cf22, 0x9c09ddc2),
+     TOBN(0xb2b00f6b, 0xdbf20277), TOBN(0xc9ac48d4, 0x5b281e9b),
+     TOBN(0x648d6674, 0x32efbbce), TOBN(0x64a6c2b3, 0xe9639719),
+     TOBN(0x38c04657, 0x30662e7d), TOBN(0x15d1d7ca, 0x352c9184),
+     TOBN(0x70e8630c, 0xcc3020cc), TOBN(0xe4b56c9c, 0xb09f038f),
+     TOBN(0xdb9cb5ed, 0xfe76a744), TOBN(0x4c85f020, 0x6947b988),
+     TOBN(0x7e500126, 0x29d8add4), TOBN(0xdbcfd295, 0xbfaf6d7e),
+     TOBN(0xc1a1c228, 0x38df80be), TOBN(0xcfa6272a, 0xf606ce3d),
+     TOBN(0xbf2a5720, 0x8e0af540), TOBN(0xb9c544fd, 0x5b599ab0),
+     TOBN(0xd6dc994d, 0xd0a22c9a), TOBN(0xa8a12acf, 0xd23e4c0e),
+     TOBN(0x41f7ac85, 0xba588a5e), TOBN(0x5425fa00, 0xccdb9687),
+     TOBN(0x12fbce76, 0xec9398f0), TOBN(0x2ad69251, 0x4f550b9b),
+     TOBN(0x120ff0f2, 0xbb318636), TOBN(0x9378346c, 0x01ecd90b),
+     TOBN(0x1b98fe99, 0xd0ba149b), TOBN(0xd69d5462, 0xc9c481c8),
+     TOBN(0x11c79184, 0x959e428e), TOBN(0x9de61a8d, 0xcff227cc),
+     TOBN(0x144dfdcd, 0x1e09b860), TOBN(0x110c3a47, 0xf8ebe350),
+     TOBN(0x59e574dc, 0xfadf86b0), TOBN(0xe6ff6e12, 0xcf3b8d30),
+     TOBN(0xe2d512fc, 0x19c77143), TOBN(0x63461543, 0x60279af1),
+     TOBN(0xff65189c, 0x32b4d371), TOBN(0x022fecca, 0x0faf5ba7),
+     TOBN(0xd08fe9bf, 0x414707b4), TOBN(0x0ef8af2b, 0x722d5fd2),
+     TOBN(0xbef06063, 0x4e6fa14a), TOBN(0x1c41f752, 0xcca29177),
+     TOBN(0x17dc7e18, 0x65091fe1), TOBN(0x693d72d2, 0x23f13c18),
+     TOBN(0xce88eb02, 0xce8e2d30), TOBN(0x7071f98a, 0xe972faca),
+     TOBN(0xb7388d61, 0x549c38ee), TOBN(0x7cfccee2, 0x0b788b8c),
+     TOBN(0xdc470705, 0xcb93b5e8), TOBN(0xea053c18, 0xab96d485),
+     TOBN(0x70e96456, 0xd634c9b3), TOBN(0x2c58c20b, 0xd5999cf2),
+     TOBN(0xcd392b3c, 0xa77c1767), TOBN(0x14471fab, 0x7c4e6bd9),
+     TOBN(0x312e1547, 0x75c905ff), TOBN(0x45764654, 0xace47038),
+     TOBN(0xa34a0b0e, 0x8fc3d697), TOBN(0x5d9ad31a, 0xd309ed3a),
+     TOBN(0xbba340c0, 0x0918f957), TOBN(0x768e06e8, 0x31fd72a1),
+     TOBN(0x77e5dd92, 0x3e1a4a54), TOBN(0x0970719f, 0x3fdbc1e1),
+     TOBN(0xd4f1da6f, 0xb0371fe2), TOBN(0x3635f433, 0xfd7f895a),
+     TOBN(0x0e8e40e6, 0x411c8e6f), TOBN(0x31d126bd, 0xec18103c),
+     TOBN(0x415a0cc1, 0xc299d7cc), TOBN(0xdf528e7b, 0x3a8e97f1),
+     TOBN(0x4551a8c7, 0xeed95e91), TOBN(0x8de89888, 0x32bcfb03),
+     TOBN(0x25da4f5f, 0x2eac5c3a), TOBN(0x6d0b2e25, 0x5f88d63f),
+     TOBN(0x8d158d14, 0x575d6145), TOBN(0xe5601a6b, 0x345f62b0),
+     TOBN(0x6f951699, 0x113c6895), TOBN(0x79e29fd5, 0xb87e50ef),
+     TOBN(0xf1ab215c, 0xd5fa51ff), TOBN(0x4fc5c4ea, 0xaf2c3094),
+     TOBN(0x1baeda40, 0x2c006042), TOBN(0xcdfcc37c, 0x3e30e75f),
+     TOBN(0xdd64e5dd, 0x467f57eb), TOBN(0xa5b13731, 0x22902d21),
+     TOBN(0x856866dd, 0x1c52cb7b), TOBN(0x05cf0f7a, 0x16a08caa),
+     TOBN(0xa46e8a55, 0x533b4d09), TOBN(0xfc803998, 0x4e073af1),
+     TOBN(0x8e3825c8, 0xe0d589c3), TOBN(0x505e8e5d, 0x4c1daef3),
+     TOBN(0x9f8363b1, 0xc5f3db12), TOBN(0xe7d46700, 0x74f569e2),
+     TOBN(0x551fd2ed, 0x4d68461a), TOBN(0x26248da5, 0xa8bbe83d),
+     TOBN(0x8d90c47f, 0x65681dbd), TOBN(0xe726d25e, 0x2200ba6b),
+     TOBN(0xa2fe408f, 0x65a3bc9b), TOBN(0x94a80457, 0x9c443b57),
+     TOBN(0x95f7f024, 0x07364677), TOBN(0xe9d9bc87, 0xdaf0fb34),
+     TOBN(0xe9082548, 0x5588e979), TOBN(0xede1f94d, 0xa0e61ff2),
+     TOBN(0xcb89a1e8, 0x45e1c230), TOBN(0xee014c23, 0x50a15304),
+     TOBN(0xf25d8ffa, 0x2bab57e1), TOBN(0x8a920680, 0x26223c6e),
+     TOBN(0xc5abb7af, 0xaadf7e6a), TOBN(0xcb57c893, 0x9e7d8da5),
+     TOBN(0x839bcda0, 0x7d589a91), TOBN(0x1fa774c0, 0x77e82027),
+     TOBN(0xeca669cf, 0xba6504d7), TOBN(0x7bf09544, 0x6845e47d),
+     TOBN(0x5eb6c33e, 0x607b3641), TOBN(0xf445556e, 0x64bab450),
+     TOBN(0xed0b1c02, 0x86096fde), TOBN(0x2c5ba666, 0x8ea41693),
+     TOBN(0xe578b315, 0x37ec248d), TOBN(0x97ef44fe, 0xf64ed28f),
+     TOBN(0xfa5a6c46, 0xce419462), TOBN(0x29336dc9, 0x9cce80e9),
+     TOBN(0x9e9054b9, 0xeee7617f), TOBN(0xcea9a100, 0xf3d51cba),
+     TOBN(0xc3cce5e8, 0x13267ec6), TOBN(0x650c8383, 0xa4e807e7),
+     TOBN(0x1338e22e, 0x9b2726dc), TOBN(0x220c50b2, 0xbf79b47a),
+     TOBN(0xe160d496, 0xa0e0962a), TOBN(0xe1a26460, 0xe1ed5cdc),
+     TOBN(0x9a1ed8c3, 0x31427c62), TOBN(0x65ef5300, 0xe99a096a),
+     TOBN(0x38abea5f, 0x4e3ad558), TOBN(0x03bb15e9, 0x0880ba0c),
+     TOBN(0x1e6dda7e, 0x0141b036), TOBN(0xd31b08bf, 0x5bf37669),
+     TOBN(0x948e0366, 0x68da20d2), TOBN(0x36998a24, 0x4108fe36),
+     TOBN(0x7606e6ed, 0xf9d6563b), TOBN(0xcf7cbdd3, 0xe42172ba),
+     TOBN(0x2335a9a4, 0xa1265b99), TOBN(0x64776cdc, 0x30ac3f69),
+     TOBN(0x04040362, 0xa59b595e), TOBN(0x82df96b9, 0x2cbc03cd),
+     TOBN(0xe9d18c7f, 0x6cea2796), TOBN(0x3112c4f6, 0xe1ea7e35),
+     TOBN(0xf9cbc205, 0x5f8a786d), TOBN(0x36cc6d42, 0x2097da0d),
+     TOBN(0x54093350, 0x2153e665), TOBN(0xebe9db0f, 0xce937bb9),
+     TOBN(0x9d1a5972, 0xd95942f8), TOBN(0x81c1f94a, 0xd4bd5c74),
+     TOBN(0x61dc7318, 0xaa04152e), TOBN(0xdf636db1, 0x95e5ec9f),
+     TOBN(0x64a80d46, 0x48090850), TOBN(0x2b37679e, 0xce890a30),
+     TOBN(0x9f46d5b9, 0xff6025e3), TOBN(0x6eed5a44, 0xf24534dd),
+     TOBN(0xc56b5cb1, 0xf740a84b), TOBN(0xb4641c28, 0x228cc826),
+     TOBN(0x676289be, 0xaf62b943), TOBN(0xe3f3810c, 0x1eae5409),
+     TOBN(0x73613f32, 0x04b5be78), TOBN(0xe6359179, 0x398b556c),
+     TOBN(0x6a342b12, 0xc0263f77), TOBN(0x6b093bbd, 0xc10a6db5),
+     TOBN(0x8f3fc90d, 0x29832fb9), TOBN(0xb3f2d8fc, 0xff03b2ff),
+     TOBN(0x1de7bd1c, 0x64457331), TOBN(0x0a03a06b, 0x43bb1380),
+     TOBN(0x6720cc3d, 0x8bf17419), TOBN(0x2627c7da, 0x33938d5a),
+     TOBN(0x204da058, 0x8d98f34c), TOBN(0x80e29f46, 0x51cbd284),
+     TOBN(0x11b22dd4, 0xa46f93d5), TOBN(0xd7341655, 0xe971a61a),
+     TOBN(0x36a748b7, 0xee69f782), TOBN(0xa3740020, 0x94f08ac0),
+     TOBN(0x383fb245, 0xc36099f3), TOBN(0xa7cb0ef9, 0x00137fdc),
+     TOBN(0x5371052f, 0x6e1dd2e5), TOBN(0xed3ab7b5, 0x7976a1d3),
+     TOBN(0xb0119c0d, 0x9df822e6), TOBN(0xafd2a477, 0x358685d1),
+     TOBN(0x82879cb0, 0x4ae1103c), TOBN(0x61cd6ca8, 0x94385be6),
+     TOBN(0x7c551809, 0xd85d4a62), TOBN(0x9632ac5f, 0xb318d965),
+     TOBN(0x67baad2c, 0xe1340605), TOBN(0x39c2c8c7, 0xac6ed4f7),
+     TOBN(0x42c4a7b1, 0x71211c2f), TOBN(0x43c778bb, 0x9bf758f6),
+     TOBN(0x2dc8fc39, 0xf519acb2), TOBN(0xd3c30a6d, 0x08eff177),
+     TOBN(0xf889c021, 0x5144484b), TOBN(0x01b82327, 0xca376af3),
+     TOBN(0x168a0b2f, 0xd3e71253), TOBN(0x5e92c6ba, 0x3f9ff89d),
+     TOBN(0x8c74c132, 0x5b4c6844), TOBN(0x707c4a40, 0x33de6858),
+     TOBN(0xb13f6abd, 0x9c36dd9e), TOBN(0x4baaef52, 0x9b3aa9f5),
+     TOBN(0x0a4fa929, 0xcd156392), TOBN(0xde0f1956, 0x6506f42f),
+     TOBN(0xe43dd7f0, 0x150d4ee7), TOBN(0xf7afe7db, 0x7247f552),
+     TOBN(0x9abc8d1c, 0x9072b450), TOBN(0x5d0645d5, 0xc9a8e159),
+     TOBN(0x863d3e8f, 0x01c6f17a), TOBN(0x3a0575ac, 0xdf080690),
+     TOBN(0xcad62d87, 0x2b0fb150), TOBN(0xa1f54744, 0x625c35c6),
+     TOBN(0x7d3bcec3, 0x41fe59ec), TOBN(0x0fd3e40e, 0x169f1e04),
+     TOBN(0xbde8c827, 0x2ed9aa4b), TOBN(0x71562ee6, 0x13046c6e),
+     TOBN(0xaf049c5c, 0xe9acac7a), TOBN(0x7efec06c, 0x261dd422),
+     TOBN(0xa530fbfd, 0x095564c4), TOBN(0x000c0c82, 0x2a57af79),
+     TOBN(0x9f79868f, 0x2ce1315c), TOBN(0x0dd99453, 0x1b5d575e),
+     TOBN(0xf1a49419, 0x1e534cfd), TOBN(0xc7de8756, 0xed7e8b39),
+     TOBN(0xef61f5c8, 0x3ed2ccb2), TOBN(0x032ee766, 0x34af2a15),
+     TOBN(0xe0692ed5, 0x9f69ae9d), TOBN(0xd34fc2d5, 0xf64900df),
+     TOBN(0x1c51c950, 0xaca6d51b), TOBN(0x10ae0fb2, 0xa7717dfb),
+     TOBN(0x9fa305f7, 0xa7ec7ca8), TOBN(0xb215a8ab, 0xb5728214),
+     TOBN(0x62628fdf, 0x8819505b), TOBN(0x3cefd86c, 0x004ba54e),
+     TOBN(0xa17bed74, 0xc571da3d), TOBN(0x362dfef6, 0x93a5faa5),
+     TOBN(0x1bee6899, 0xf8aeea05), TOBN(0xd7bf7e31, 0x16f18b7a),
+     TOBN(0x3f3cf39d, 0x1cb7685c), TOBN(0x1df41f23, 0xe2e57c8e),
+     TOBN(0x8f62ecb8, 0xe2fd94f1), TOBN(0x652099c9, 0x4c30a178),
+     TOBN(0xaa2454e1, 0x4262e9e6), TOBN(0x7f0d440f, 0x2015d4a9),
+     TOBN(0xa2c76313, 0xbb5b39fa), TOBN(0x46e57ab2, 0x1ab47bb3),
+     TOBN(0xd181f444, 0x8697e682), TOBN(0x55db129e, 0x33273dfe),
+     TOBN(0xda188361, 0xe71d029f), TOBN(0x3e3e19da, 0xb5def631),
+     TOBN(0x7431f513, 0x087ad30b), TOBN(0x2537887e, 0x9f27c84e),
+     TOBN(0x0c228c62, 0xac9df89d), TOBN(0xdcd2c5e9, 0x10031289),
+     TOBN(0x5cc76782, 0x0321d1b6), TOBN(0x4e460bdf, 0x6cb3d600),
+     TOBN(0x6f356aab, 0x9a870166), TOBN(0x21aecb3b, 0x497d4ac0),
+     TOBN(0xd981a4b0, 0xf0495ef1), TOBN(0x615e8bff, 0x0fb7704b),
+     TOBN(0xc148e8ea, 0x8478bf12), TOBN(0x7011ec5b, 0x364eee52),
+     TOBN(0xd9075965, 0xf692bc12), TOBN(0x3019c824, 0xe622ad51),
+     TOBN(0x349e4873, 0xec83c953), TOBN(0xb4f59fb3, 0x3a21ef0a),
+     TOBN(0x3872d314, 0x40f7d93e), TOBN(0x479e1d02, 0xc2568c82),
+     TOBN(0xd7e4dc9a, 0x65d43d22), TOBN(0xcc068e81, 0xe775efa8),
+     TOBN(0xb78ccae9, 0x326defa6), TOBN(0x8f92b296, 0x2da64956)},
+    {TOBN(0xb721f8d5, 0xdea227ee), TOBN(0xf48c766c, 0x3dda8ba0),
+     TOBN(0x0583d94b, 0xe43e3520), TOBN(0xebda36c9, 0xe1d898b6),
+     TOBN(0x1808286a, 0x6627adaa), TOBN(0x19c4c620, 0x9938368e),
+     TOBN(0xe0dbd707, 0xf750949f), TOBN(0xcadf4bea, 0x0cf356d9),
+     TOBN(0xf5de2126, 0x2dc890a7), TOBN(0x76b7b675, 0x95aa75a3),
+     TOBN(0x475fc143, 0x2a070b32), TOBN(0x7429a646, 0x8e31d68f),
+     TOBN(0xec3a9aaa, 0x09be3dca), TOBN(0x07e119a9, 0xaf780ed7),
+     TOBN(0x62125625, 0x64fd96c4), TOBN(0xb571494f, 0xe8e80577),
+     TOBN(0x955ee349, 0x5228d735), TOBN(0xa04ef2bb, 0x8fc5d4b6),
+     TOBN(0x0c532891, 0x3600814f), TOBN(0x41f1f637, 0x59f85bd4),
+     TOBN(0x72f1d731, 0xe3dcdfb4), TOBN(0x28a4ddb9, 0x3aa5edb3),
+     TOBN(0x116a68e1, 0xf702dcdb), TOBN(0x1975bc42, 0x3bde657e),
+     TOBN(0x7b9f561a, 0x8a914b50), TOBN(0x2bf7130e, 0x9154d377),
+     TOBN(0x6800f696, 0x519b4c35), TOBN(0xc9e65040, 0x568b4c56),
+     TOBN(0x30706e00, 0x6d98a331), TOBN(0x781a12f6, 0xe211ce1e),
+     TOBN(0x1fff9e3d, 0x40562e5f), TOBN(0x6356cf46, 0x8c166747),
+     TOBN(0x80e87329, 0x429945a7), TOBN(0xc619fe17, 0xb7ab06ad),
+     TOBN(0x9116bc2e, 0x6fd86b17), TOBN(0x64a41877, 0xb9116aac),
+     TOBN(0xe3ed867e, 0x32ba4f3b), TOBN(0x013e263b, 0x68b4ebe6),
+     TOBN(0x305ebfe7, 0xe779e4ec), TOBN(0x5536d45d, 0x50178251),
+     TOBN(0x5abb939f, 0x8873a93d), TOBN(0x0263ba48, 0x8c4c9cb1),
+     TOBN(0x36764b8d, 0x6b78a4b5), TOBN(0x205bb45d, 0x28bebc1e),
+     TOBN(0x16df4bb0, 0xae89dcd5), TOBN(0x85994670, 0x316fadb7),
+     TOBN(0x71f75664, 0x3af3c724), TOBN(0x43e30313, 0xe8520c9c),
+     TOBN(0x3ab9ec54, 0x29e91921), TOBN(0xd931436e, 0xe3299f47),
+     TOBN(0xb56da7bf, 0xb89cd49f), TOBN(0x90623412, 0xcff7f637),
+     TOBN(0x751e7944, 0x714022de), TOBN(0x86bcc342, 0x2c338262),
+     TOBN(0x85f6a9bc, 0x314c23bb), TOBN(0xedbe8e74, 0x1f0a3991),
+     TOBN(0x7a748d63, 0x003b40dd), TOBN(0x8a682402, 0x3951b7ae),
+     TOBN(0x41e92dd9, 0x704a91b0), TOBN(0x2dfb3eb9, 0x858cd3ea),
+     TOBN(0xc3c2af35, 0xf5094667), TOBN(0xffa287dc, 0x7435aa2d),
+     TOBN(0xd03f3979, 0x7462714f), TOBN(0xdb550f67, 0x203e5b0e),
+     TOBN(0x6df7801b, 0xe241ed0c), TOBN(0xb52c0a3f, 0xb642fd3a),
+     TOBN(0xdd35e1cf, 0x1977a29d), TOBN(0x8e793d60, 0xa661404c),
+     TOBN(0x393e2b87, 0x6b9442ae), TOBN(0x123b893a, 0x2aa6b707),
+     TOBN(0xeec88682, 0xdb8d306a), TOBN(0x92c2d93d, 0xce847879),
+     TOBN(0x725f1e7d, 0x80ec63b4), TOBN(0xcb8f53d9, 0x74113de0),
+     TOBN(0x2132a072, 0xb819f730), TOBN(0xfabf3c47, 0xb4c61f06),
+     TOBN(0x79c1bc86, 0x2cb243d8), TOBN(0x442833c5, 0x757e3600),
+     TOBN(0xfa4f69ad, 0x4e918b8a), TOBN(0x5816f3f3, 0x73bc193e),
+     TOBN(0xc671c7a4, 0x30f40e93), TOBN(0x6041aa03, 0x5c51cfa4),
+     TOBN(0x3a713549, 0x2fac25d7), TOBN(0xf5053237, 0x24a7df01),
+     TOBN(0x99efb34a, 0xd29f4ec5), TOBN(0x74810523, 0x71d2cb1b),
+     TOBN(0xacefaf8f, 0xf3a029ab), TOBN(0xc82e4f5a, 0x069d9545),
+     TOBN(0xd759549d, 0xd3341d80), TOBN(0x079e9fa7, 0x31a2a0a4),
+     TOBN(0x75da56c7, 0x2a164f75), TOBN(0x9313ef5a, 0xbeefc182),
+     TOBN(0x0aa365b6, 0xbde130ad), TOBN(0x44265977, 0x98411180),
+     TOBN(0xa65373f7, 0xaa26466a), TOBN(0x1a43bee6, 0x2e2cf404),
+     TOBN(0xe029ed6d, 0xb37a9390), TOBN(0x5c2351ca, 0x34970065),
+     TOBN(0x7c4f3c30, 0x1c46d72c), TOBN(0x09ce770a, 0x7262ce20),
+     TOBN(0x0cfeefad, 0xdd58a9f8), TOBN(0x06797d79, 0x408addaa),
+     TOBN(0x76a87c06, 0x05aed325), TOBN(0xe002b672, 0x8a46d0c6),
+     TOBN(0xcf77ea31, 0x05b6e1a4), TOBN(0x3bf900bc, 0xa5d92b00),
+     TOBN(0x05996d8c, 0xdccfe144), TOBN(0x73d4dfd7, 0x951a602c),
+     TOBN(0x033f3959, 0x0ed8885d), TOBN(0x8332dc73, 0x36400817),
+     TOBN(0x96372295, 0x2d8ebda7), TOBN(0x3fb32cf6, 0xb5da0c67),
+     TOBN(0xcb521d65, 0x3e36defc), TOBN(0xc293d170, 0xa67f00f0),
+     TOBN(0x6a3a2fd4, 0xfb35bd06), TOBN(0x537937dd, 0x0bd490a5),
+     TOBN(0x898d94bc, 0xc274ee5a), TOBN(0xdc70f9bd, 0x7515b5e7),
+     TOBN(0xa94673db, 0x3749900f), TOBN(0x3e6e2af0, 0x49ad3b04),
+     TOBN(0xb9dae1b8, 0x207eecd9), TOBN(0xd3f50d63, 0xec07b47c),
+     TOBN(0x02b4d909, 0x364292da), TOBN(0x919a6df3, 0xfc35975b),
+     TOBN(0xb41ed4aa, 0xb616452e), TOBN(0xe58689cd, 0x5cfc6abb),
+     TOBN(0xeac325d9, 0xf389b025), TOBN(0x45ceb1e6, 0x8f255de5),
+     TOBN(0xda4a0715, 0x5e46cdff), TOBN(0x8a860a55, 0x0f6c761c),
+     TOBN(0xe1395274, 0x5fe1eef1), TOBN(0x256e296a, 0xf7bc535f),
+     TOBN(0xf3d4b06c, 0x2755dd27), TOBN(0x3ced6ee5, 0xbb530c26),
+     TOBN(0x73249ad7, 0x96ba599d), TOBN(0x5de8dab3, 0xe8a66027),
+     TOBN(0xa4892840, 0xc2f97e01), TOBN(0xbe0dbe49, 0x427945be),
+     TOBN(0x6fd86a7b, 0xa57d4e4f), TOBN(0x7f56c3e0, 0x04a2e778),
+     TOBN(0x734708cc, 0xffc13d49), TOBN(0x3c1d9413, 0x788d31fe),
+     TOBN(0xfe85545b, 0x8d3e4c36), TOBN(0xcca441fc, 0x8815129c),
+     TOBN(0x2e2095e2, 0x15e3d172), TOBN(0xc0c8d3c4, 0x64b43e81),
+     TOBN(0x084557ab, 0xc68e802e), TOBN(0xa6b73590, 0x30d239b9),
+     TOBN(0x61ec00a9, 0xb67b0548), TOBN(0x630059de, 0xb8ab138d),
+     TOBN(0x800abf01, 0x36ca9888), TOBN(0xe26d644a, 0x9517149e),
+     TOBN(0x775d5a98, 0x58bf21d9), TOBN(0x00eb6846, 0xdbeab706),
+     TOBN(0x9d714c9f, 0x8232d477), TOBN(0x7cde2c3e, 0xb70f91c2),
+     TOBN(0xe6d0a8ce, 0xe9871f0c), TOBN(0x902bc60b, 0x19e8444a),
+     TOBN(0x8651ed57, 0xff0cd43a), TOBN(0x4418cc07, 0xd480d222),
+     TOBN(0xb5e0c7e3, 0xf3cbe01d), TOBN(0xbf4a899f, 0xe43adcdf),
+     TOBN(0xb89b022c, 0x78f8f79d), TOBN(0x79cbbf97, 0xf42c797c),
+     TOBN(0x46d73cc5, 0x59d53cc1), TOBN(0x99f683e6, 0x4ffca67c),
+     TOBN(0x527c16ec, 0x98865e5b), TOBN(0xc844b70f, 0xf68f8ee0),
+     TOBN(0xcffcccc0, 0xc9854994), TOBN(0x4aafcc15, 0x74926d5d),
+     TOBN(0xeb084832, 0x835aea59), TOBN(0xcb317b5f, 0x20df21cf),
+     TOBN(0x3c45b084, 0xe43d1853), TOBN(0xd12c9411, 0xb93b9167),
+     TOBN(0xb0901982, 0x19316bdf), TOBN(0x76bfa2ac, 0xd11ab5e2),
+     TOBN(0x22bf23cb, 0x4e84d3e9), TOBN(0x96ec9f8e, 0xd1572d4a),
+     TOBN(0x31594ae4, 0x080ba39a), TOBN(0x105b5677, 0xadc6bae4),
+     TOBN(0x501e45dd, 0xa644e230), TOBN(0xeb571f27, 0x64573126),
+     TOBN(0x1fc3d478, 0xa36ac1ef), TOBN(0xbd5fcee8, 0x327c7da7),
+     TOBN(0x1b2b1885, 0x34a70bfe), TOBN(0xcfa421f7, 0xa36345c5),
+     TOBN(0x2f33f4cc, 0x6f322ae9), TOBN(0xdac0bb75, 0x4dabb7a0),
+     TOBN(0xfba35536, 0x923cea0a), TOBN(0xc16f73e5, 0x6d9cb50c),
+     TOBN(0x23216dc6, 0x25812c96), TOBN(0x82945e67, 0x3d7ab424),
+     TOBN(0x829577b2, 0x0796605d), TOBN(0x47fa0978, 0x5026907f),
+     TOBN(0x99701169, 0x2d0f68b2), TOBN(0xa0d24be4, 0xbc1e46db),
+     TOBN(0xcf409c2e, 0x2eb2ac98), TOBN(0x7b59c3c5, 0x97f3ff5c),
+     TOBN(0x2f4576bd, 0x81ed7f02), TOBN(0xe41339e5, 0x10399c22),
+     TOBN(0x562d7744, 0x2ecce0e6), TOBN(0x1afc3869, 0x9a1656c2),
+     TOBN(0x5714820e, 0x86200621), TOBN(0xee36f7b6, 0x566da805),
+     TOBN(0xe6694104, 0x6e5a2a06), TOBN(0xd4390b74, 0x8caabaab),
+     TOBN(0x9db20998, 0x93b0d142), TOBN(0xe1811b81, 0x7926baf3),
+     TOBN(0xd578f2ed, 0x08bc1965), TOBN(0x9a7e31e2, 0x35f00d5d),
+     TOBN(0x3725b65c, 0xc9007327), TOBN(0x157cfe95, 0x29c36f38),
+     TOBN(0xb1c3d0f1, 0x23a521d7), TOBN(0x3e65fb7c, 0xb8a9ae08),
+     TOBN(0xed48bcf9, 0x690b8f78), TOBN(0xe5f46b2c, 0x90d5dfde),
+     TOBN(0x14aebb35, 0x0b6da2b6), TOBN(0x91fef336, 0x7b65ee55),
+     TOBN(0xdb77b57b, 0x1a0a004d), TOBN(0x1c59b628, 0x23aef1f7),
+     TOBN(0xa79c8c89, 0x3ec88d18), TOBN(0x52cca38a, 0x4fde31f1),
+     TOBN(0xe2f64a94, 0xcf4e30b6), TOBN(0x2b4cdbd7, 0x37ff1cbb),
+     TOBN(0xcb542f68, 0x0b566632), TOBN(0xedab69a6, 0x676fae9f),
+     TOBN(0xc4531e0b, 0xc45cb6f0), TOBN(0xf967ec6e, 0xb88fe4a5),
+     TOBN(0x4ab4e645, 0x2919785d), TOBN(0x2dcaefca, 0x7a17b20f),
+     TOBN(0x65c89c05, 0xda7afaa0), TOBN(0x59ea00e9, 0x4dafc6a2),
+     TOBN(0xa6362bf8, 0x8eb43733), TOBN(0xae2dddc1, 0x12011803),
+     TOBN(0xbbf516b1, 0x0bb2aaf8), TOBN(0x9f2627e9, 0xd8de21a3),
+     TOBN(0xaf30439a, 0x43a20b74), TOBN(0xac7e07b0, 0x4ce86408),
+     TOBN(0xc54cdff2, 0x7c10566b), TOBN(0xe3ee0622, 0x6279af0a),
+     TOBN(0x57d09708, 0xf7770f95), TOBN(0x6f0ba223, 0x123e020b),
+     TOBN(0x6c123fb9, 0x6cd41559), TOBN(0xc54f5c65, 0x6fb30f58),
+     TOBN(0x5e168af3, 0xbbf7101c), TOBN(0xf6d6dbdb, 0xce974455),
+     TOBN(0xa001f3b9, 0x88313516), TOBN(0xe6e4a26d, 0xdfb4ac20),
+     TOBN(0x74e7b7fc, 0x506f7dcd), TOBN(0x985e8546, 0x5d037d69),
+     TOBN(0xff00a4da, 0x1ec8d374), TOBN(0x8c339ae3, 0x505b4180),
+     TOBN(0x78bcd4f2, 0x3a5f71c4), TOBN(0x2fb4d99f, 0x67ac3e9f),
+     TOBN(0x7dd25aa6, 0xee65dad1), TOBN(0x2fd63fc2, 0xb62c34dc),
+     TOBN(0xdee42663, 0xf7700192), TOBN(0x9925a206, 0x2c3248e9),
+     TOBN(0x4a55a55d, 0x2ea9f052), TOBN(0xe1d6efcd, 0x16ac67fe),
+     TOBN(0x7f82246d, 0x9bb02415), TOBN(0x2fadbb9b, 0x72cd7a6c),
+     TOBN(0xe977a037, 0x712004dc), TOBN(0xe8c449b2, 0xb3c9f4b9),
+     TOBN(0xa2cb838a, 0x861ea138), TOBN(0xfcbe219a, 0x356ae003),
+     TOBN(0x15c02496, 0x1838504f), TOBN(0x58cef52c, 0x0769d5dc),
+     TOBN(0x7e94ff7d, 0xb3fef999), TOBN(0xf55501e0, 0x04e4fc87),
+     TOBN(0xcdb5fd36, 0xc05430dc), TOBN(0x49872453, 0x778c5cd4),
+     TOBN(0x4c4855ff, 0x1b5e7ace), TOBN(0x89fc6309, 0xb159fe74),
+     TOBN(0xaca00404, 0x3c9ebbe2), TOBN(0x4c030591, 0x866bf867),
+     TOBN(0xa7e8f599, 0x9b18a535), TOBN(0x9203ebfc, 0x5c0a0a44),
+     TOBN(0xbf1b30cc, 0x463207c9), TOBN(0x90b59001, 0x9d135aeb),
+     TOBN(0xedc44d04, 0x794cb3ab), TOBN(0xb3baa475, 0x0ad7be70),
+     TOBN(0xb7d8c7c5, 0x6c09fc91), TOBN(0x2a362d71, 0xf45a5bd6),
+     TOBN(0x36e308c3, 0x8cf3e5a6), TOBN(0x4caf2cd1, 0x0a649c31),
+     TOBN(0xbae328f5, 0xb3c501c7), TOBN(0x2efeca03, 0x83a0eeb3),
+     TOBN(0xc3a27585, 0x7086093a), TOBN(0x78e86515, 0x6d686d83),
+     TOBN(0x18cf3ac1, 0xedf0def6), TOBN(0x2f6a56da, 0x5a1d6cf4),
+     TOBN(0x350c822e, 0x30084873), TOBN(0x82d48087, 0x65843610),
+     TOBN(0xa4e752c1, 0xf393ecd1), TOBN(0xe3034d6d, 0xeeb74f25),
+     TOBN(0x1793727c, 0xb8b0c5c7), TOBN(0xde561ca6, 0x7ec9ce37),
+     TOBN(0xd9eddc50, 0x6190f612), TOBN(0xb52dc77c, 0xca89a191),
+     TOBN(0x990010b2, 0x4bf1e87a), TOBN(0x073136b2, 0x15b91691),
+     TOBN(0x50111261, 0x15546011), TOBN(0x17d48864, 0x0196cb8d),
+     TOBN(0x7ec44104, 0xfd61d824), TOBN(0x213550ef, 0xf088d3db),
+     TOBN(0x5e8d321f, 0xacbbb608), TOBN(0xc317c1f8, 0x39312b64),
+     TOBN(0x7a4a1cd0, 0x27de4329), TOBN(0xbfb33f07, 0xf9b135e4),
+     TOBN(0xcf82b639, 0x59b94480), TOBN(0xca62d957, 0x70b118e6),
+     TOBN(0x95b2ff03, 0x2b1d45fb), TOBN(0x472dd56c, 0x2570686c),
+     TOBN(0x4fbae8a0, 0xd3d50e32), TOBN(0xa31c65dd, 0x65796a08),
+     TOBN(0xe261f6f8, 0x037ce5bb), TOBN(0x3b7816bf, 0xd042073b),
+     TOBN(0x6d0ebbee, 0xbfba45f8), TOBN(0xf2d99979, 0xc9522e36),
+     TOBN(0x707f2a18, 0x77cb5b0c), TOBN(0x954b5a91, 0xdfc02b82),
+     TOBN(0x246b9a55, 0xc20ae04b), TOBN(0xa1486775, 0x9dd79f93),
+     TOBN(0xd4092830, 0xc11f6d8e), TOBN(0x74ca482f, 0x267a4dab),
+     TOBN(0xe3c80bb6, 0x9c58706f), TOBN(0x245f04b7, 0x099154c1),
+     TOBN(0x3a4b25b5, 0xf149259f), TOBN(0xeac735f8, 0x65ccbe91),
+     TOBN(0x260e749f, 0x572788a4), TOBN(0x30b9c736, 0xe34d40cb),
+     TOBN(0x65981d50, 0xf524a17f), TOBN(0x6c462f5d, 0xcddbbefc),
+     TOBN(0x245bfa18, 0xa1e57312), TOBN(0x3b4b003c, 0x46dc8ae0),
+     TOBN(0xb1958797, 0x5d262a35), TOBN(0x83f6e604, 0xffafd8c5),
+     TOBN(0x60843f9c, 0xbc2e0801), TOBN(0x11d85ac1, 0xc783ad3d),
+     TOBN(0x1ce477dd, 0x2e016e43), TOBN(0x2b628f06, 0xfb4a0201),
+     TOBN(0x897b7f62, 0xbf4f77d7), TOBN(0x52e04f22, 0x10277d8a),
+     TOBN(0x17132351, 0x5f3f0d6a), TOBN(0x13c9e064, 0x59a96c4d),
+     TOBN(0xc73892b0, 0x86f05ae8), TOBN(0x94545c8a, 0x4212ad65),
+     TOBN(0x0591b091, 0x3dc4984c), TOBN(0x06845698, 0xf2ec1ca9),
+     TOBN(0xb0e1e1d0, 0xb3ac894b), TOBN(0x962ca1da, 0xa7c915cd),
+     TOBN(0xb0640de8, 0x95331bd5), TOBN(0x2544348a, 0x478c1b6d),
+     TOBN(0x3c3bd415, 0x5647a67e), TOBN(0xd7970ef8, 0x5b20e5fb),
+     TOBN(0xd6e6f6be, 0xe06b4fa6), TOBN(0x5ae29e5e, 0x871390ff),
+     TOBN(0xc7924188, 0x7256daa1), TOBN(0xfae5e501, 0x59f61750),
+     TOBN(0xfac83ece, 0xd1ef1d2b), TOBN(0xa567060c, 0x554736da),
+     TOBN(0x697571f4, 0x1dba8bc7), TOBN(0xd3fc5aeb, 0x553fbcfc),
+     TOBN(0xe665970a, 0x9755fab0), TOBN(0x30fbe8d9, 0xb5537da8),
+     TOBN(0x7a7d0013, 0x97c2b5f0), TOBN(0x9fea5c9c, 0x1b700a02),
+     TOBN(0xcfc0166e, 0xe9a377da), TOBN(0xcc78f3d8, 0xac502375),
+     TOBN(0x803fbbda, 0xba64c3b7), TOBN(0xe53c7d6b, 0x4d70cc42),
+     TOBN(0x6b927bba, 0x5189b7da), TOBN(0x2c86253b, 0x8b05322a),
+     TOBN(0x333e7491, 0xf3869873), TOBN(0x9308348a, 0x4b492879),
+     TOBN(0x39bfa2a8, 0xb9ab0a36), TOBN(0x560f80a6, 0x18f71ac7),
+     TOBN(0xca9b265a, 0x45e24412), TOBN(0x6796bece, 0x8e2ddac3),
+     TOBN(0x87f1eee5, 0x17bfcabb), TOBN(0x624db4d9, 0x195c9bb2),
+     TOBN(0xf7110fcf, 0x2b4db6d2), TOBN(0x41d3fb0d, 0xb432d19d),
+     TOBN(0x3344ea7d, 0x73554a3c), TOBN(0x4c968dad, 0x830a3881),
+     TOBN(0x5df71ad2, 0x687f71ec), TOBN(0x4c4df41f, 0x259cbc07),
+     TOBN(0x8d12d2e0, 0xeb541d72), TOBN(0x94c0dab6, 0xa20fb162),
+     TOBN(0x9bbc2524, 0x1eda0516), TOBN(0x696c924e, 0xdd7871ff),
+     TOBN(0x97efb495, 0x1db84dc1), TOBN(0x7d293ce5, 0x03cbfbf8),
+     TOBN(0x79e25d3e, 0xbc48d007), TOBN(0xc900a580, 0x8591a1ea),
+     TOBN(0xf0277a09, 0xd37508c3), TOBN(0xbf583aa4, 0xe84557bf),
+     TOBN(0x2e258d60, 0xd8228591), TOBN(0xb037e17c, 0x117da3a9),
+     TOBN(0x4b35355e, 0x243d588d), TOBN(0xbe6dfa36, 0xcce2539e),
+     TOBN(0xa57d5823, 0x4843c9da), TOBN(0xe3d91511, 0xf59348fa),
+     TOBN(0xb5d1395c, 0x2791c08f), TOBN(0x04129e5d, 0xf6fdcc93),
+     TOBN(0x635a63ba, 0x0f53087b), TOBN(0x66da6bec, 0xf237612e),
+     TOBN(0xc3d052e5, 0x22755420), TOBN(0xc37a9b47, 0xd7a1bd35),
+     TOBN(0xf19613f3, 0x9b347e02), TOBN(0xee84dbac, 0xbbda7ae0),
+     TOBN(0x603be21d, 0x3a85f2e5), TOBN(0x5f0927c2, 0xff679451),
+     TOBN(0x799013ad, 0x8674f8d7), TOBN(0x17b248d3, 0x00f465e5),
+     TOBN(0x2a29135f, 0x96ca19de), TOBN(0xc8e56e32, 0x957d1844),
+     TOBN(0x935e7eaf, 0xa11a4349), TOBN(0x717308e1, 0x741b73d3),
+     TOBN(0x40477acb, 0x7233a9df), TOBN(0x7a78dac2, 0xd2c83b72),
+     TOBN(0xfb882461, 0x2c5d79d2), TOBN(0x984505fb, 0x76f44fa0),
+     TOBN(0x5cdded16, 0xdfdc4a9d), TOBN(0x4cbea135, 0x3f0ff597),
+     TOBN(0x38daf27a, 0x8a79078e), TOBN(0xb4b0085d, 0xce1bbf0e),
+     TOBN(0xb6b0d8d7, 0x86f19fd0), TOBN(0xe0fdcdae, 0x1778ca6a),
+     TOBN(0x257c7df9, 0x0b26b9b5), TOBN(0x4b82422c, 0x141dcafc),
+     TOBN(0xcf8a2dad, 0x4d3cf148), TOBN(0xf1a4e292, 0x5f17e914),
+     TOBN(0xc40755bb, 0x60de8f64), TOBN(0x412449f8, 0x8718f49d),
+     TOBN(0xdabb9968, 0x8737b6cb), TOBN(0xdd94ae81, 0x6236ea05),
+     TOBN(0xb5223cd0, 0x05c5aca2), TOBN(0x6b81bd33, 0x762210ed),
+     TOBN(0x1f0921db, 0x5d4164df), TOBN(0xf6fdb08f, 0x8d4a35df),
+     TOBN(0x1efcf3c7, 0xc602d4d8), TOBN(0xa2ecd9e6, 0x057f3aa0),
+     TOBN(0x13a6c576, 0xeb4fcba2), TOBN(0x16425bd4, 0x13130559),
+     TOBN(0xa9eac848, 0x416b4968), TOBN(0x617c32a9, 0x2119600e),
+     TOBN(0x1a84eca5, 0x0bb49e40), TOBN(0x2ed98d25, 0xbc2310b3),
+     TOBN(0xad191f88, 0x5edbc719), TOBN(0xd8d667d5, 0x0376ae08),
+     TOBN(0xb855a8ee, 0xf0b4fe29), TOBN(0xc3fe79fb, 0xe75354f7),
+     TOBN(0x1ee9b9e6, 0x403b651e), TOBN(0x99ddbb3c, 0x2baa2c6e),
+     TOBN(0xc6a84c47, 0xeccce37d), TOBN(0x71a05a24, 0x038c9821),
+     TOBN(0x8d32194c, 0x9a6353d8), TOBN(0x14cd3ea6, 0xcf0a1462),
+     TOBN(0x40d70aa2, 0x7bdbe521), TOBN(0x200f0b21, 0x95c80cd8),
+     TOBN(0x4c79dab9, 0x3efdf656), TOBN(0xafa44e4c, 0xa981d8b5),
+     TOBN(0x811b9387, 0xa7111315), TOBN(0x0255a234, 0x7590c35d),
+     TOBN(0xb18e87c0, 0xf1af875c), TOBN(0x0a930b41, 0xced5cc1f),
+     TOBN(0x6ff4fca4, 0x96094a55), TOBN(0x74095b88, 0x6a9dc519),
+     TOBN(0x44492273, 0xafa4894a), TOBN(0x54f16f88, 0xa2e6f56e),
+     TOBN(0xd613fbb4, 0x34485e31), TOBN(0xc716c370, 0xd2464242),
+     TOBN(0x21535837, 0x1644f2e1), TOBN(0x7719474b, 0xbe417c3a),
+     TOBN(0x31bfb158, 0x2045d2be), TOBN(0x10855524, 0xf50e6828),
+     TOBN(0xdb9490ad, 0x98a67af1), TOBN(0x41a34aa6, 0x1c281ff3),
+     TOBN(0x87109ba8, 0xa8bf2580), TOBN(0x70c2e936, 0x2d7eb52d),
+     TOBN(0xefe9fe2c, 0xfb3fc109), TOBN(0xfd3f4d7b, 0x780526bf),
+     TOBN(0x6f9a48d8, 0x9ed0c3bc), TOBN(0x0aec850f, 0x5d8205b2),
+     TOBN(0xa378f8c6, 0x1c6a13ef), TOBN(0xac02f367, 0x9d10e11b),
+     TOBN(0x79c6b396, 0x3b9bbf54), TOBN(0xfb586d71, 0x42779c58),
+     TOBN(0x5d975728, 0x889eecb3), TOBN(0xda2ec867, 0x434537d8),
+     TOBN(0x15a3c9c3, 0x62f31813), TOBN(0xc4b357c8, 0x3c30433e),
+     TOBN(0xf26d281f, 0xc464e972), TOBN(0x99fa49e7, 0x4512ffcf),
+     TOBN(0x456db1b2, 0x725b9753), TOBN(0xec501760, 0xb42941c5),
+     TOBN(0xd822a9d5, 0x7d6d406f), TOBN(0x4bb7a820, 0x7bbcd4d6),
+     TOBN(0x079b1fe0, 0xcc96a5b7), TOBN(0xf83e5755, 0x24aa4901),
+     TOBN(0x317cdd1d, 0x20da7fcb), TOBN(0x487fd706, 0x93b04a81),
+     TOBN(0x43e0671f, 0xe43332ef), TOBN(0x71c5dd5b, 0x441c2218),
+     TOBN(0x4c1d2c1f, 0xe922ba18), TOBN(0x558e9c2f, 0xd619cb67),
+     TOBN(0xd04acde0, 0x1ec51255), TOBN(0x824b3740, 0xaf824507),
+     TOBN(0x62d1b9de, 0x744c6afe), TOBN(0xb99616db, 0xab0d52e3)},
+    {TOBN(0x5ec9c084, 0x7f6a1cda), TOBN(0x68839c14, 0x823d6350),
+     TOBN(0xcbbb678b, 0x03bad007), TOBN(0x6a727255, 0x4788854e),
+     TOBN(0xc747fea2, 0xef5c7294), TOBN(0x74852778, 0x4875e775),
+     TOBN(0xad7b8e8b, 0xaa61a893), TOBN(0x18ff3335, 0x40da98b1),
+     TOBN(0xa51e9f4f, 0x5529ec80), TOBN(0x0420274a, 0x6fd146d1),
+     TOBN(0xbbf1ab66, 0x8e300c2c), TOBN(0x2d0b3a9d, 0x41653fea),
+     TOBN(0x2be2180f, 0x23a495b9), TOBN(0x6ef3c374, 0x5415d73b),
+     TOBN(0x1d3e1ec8, 0xc67ae4fc), TOBN(0xa5839e9c, 0x98d31f5f),
+     TOBN(0xf54114d6, 0x37d77c01), TOBN(0xc2e18a4b, 0x41023c87),
+     TOBN(0x6fa6c3d3, 0x9e6e1221), TOBN(0x9a6cf4e2, 0x410e48f9),
+     TOBN(0xe0881140, 0xb181828f), TOBN(0x17c6df29, 0x78cb7833),
+     TOBN(0xc1eb8df1, 0xa7cd2367), TOBN(0xb78f1c8d, 0xca89f922),
+     TOBN(0xf25d4777, 0xd0d42887), TOBN(0x4b489218, 0x2b7a2707),
+     TOBN(0x1b4dbf9b, 0x2d3966fe), TOBN(0x4bac5f48, 0x41ae2bec),
+     TOBN(0x68db2733, 0x1733964e), TOBN(0xa10c5dff, 0x6a814a69),
+     TOBN(0x84ebdaf0, 0xa9898348), TOBN(0x60e46823, 0xa74da3f4),
+     TOBN(0x452b6b1d, 0x93420649), TOBN(0x9dd6452b, 0x6ed5d7f6),
+     TOBN(0x4a9b8fa1, 0xe687b577), TOBN(0x1e203166, 0x854c49d7),
+     TOBN(0xf523667e, 0xa45feba8), TOBN(0x9ecb4d44, 0x5f9f4a56),
+     TOBN(0xb8655a5f, 0x7fb1c641), TOBN(0x5516401a, 0x87c26201),
+     TOBN(0x24677754, 0x0d2face6), TOBN(0xd9f7da7f, 0xa8ade59c),
+     TOBN(0x27e3ad77, 0x7fa7df06), TOBN(0x35a4caf0, 0xf60395ad),
+     TOBN(0xfaef231c, 0xe4e701ac), TOBN(0x9e135976, 0x23755489),
+     TOBN(0x7caa73ab, 0x43554ad3), TOBN(0x9d8554d9, 0x94f0d878),
+     TOBN(0xe42040ce, 0xa85b81d5), TOBN(0x4d28aca7, 0x40fa9631),
+     TOBN(0x076fed3d, 0x7e04b755), TOBN(0xdde3d347, 0x1129ce4c),
+     TOBN(0x77f785d7, 0x1179af95), TOBN(0x4782f842, 0xf74e0672),
+     TOBN(0xbd068cc1, 0x0b4597cb), TOBN(0x3d6d4b2a, 0x8f4c65b7),
+     TOBN(0xe0642d18, 0xf9066d73), TOBN(0xbe1d2ec3, 0xa098b3bf),
+     TOBN(0xefee860c, 0x21b4954c), TOBN(0x4d7c4e6d, 0x27b629bb),
+     TOBN(0xcd8f1e03, 0x8e8b81b0), TOBN(0x4a80168e, 0x7fe77eb0),
+     TOBN(0x4d977591, 0xce247c73), TOBN(0x9b30c9f2, 0x857e0356),
+     TOBN(0xc02495ba, 0x2940e9de), TOBN(0x357299f5, 0xb6d2b72c),
+     TOBN(0x132b4c63, 0x06a9c2e4), TOBN(0xe90a90c5, 0x084d8c67),
+     TOBN(0x0f0c9e94, 0xace1b471), TOBN(0x769457e1, 0xf1e3d8f6),
+     TOBN(0xc4c30ce3, 0xd71118c6), TOBN(0xdb5fd8d6, 0x6b652a3d),
+     TOBN(0x090df107, 0x4def5978), TOBN(0x1abcfa32, 0x2d8a5f3a),
+     TOBN(0x2976b012, 0xa34b70db), TOBN(0x90f541d4, 0xfa5e75b9),
+     TOBN(0x50c991a9, 0x37a6e9a0), TOBN(0xf51e8693, 0x903bffda),
+     TOBN(0xa2697ab4, 0x8d344776), TOBN(0x77134fe8, 0xe34a7850),
+     TOBN(0x723e5d3d, 0xa72597ac), TOBN(0x4a49847a, 0x4269aff7),
+     TOBN(0x75ad9088, 0x443b8db6), TOBN(0x9b7d00d5, 0xa51d80a1),
+     TOBN(0xce1c7049, 0xe5e04ac2), TOBN(0xb8c2793c, 0x2a792bde),
+     TOBN(0xde9220a0, 0xe410e175), TOBN(0x4b3a9b85, 0x9401bc2a),
+     TOBN(0xc7eaf2c5, 0xf037d15f), TOBN(0x410b627e, 0xc7afbf8b),
+     TOBN(0x243cdb79, 0xd7bedf50), TOBN(0x04813b51, 0xbe6512d0),
+     TOBN(0x2fb77cab, 0x26beca2f), TOBN(0xbb601975, 0x7baa3099),
+     TOBN(0x8c327e59, 0x40bda4d0), TOBN(0x85b9c764, 0x13c23444),
+     TOBN(0x26960d9c, 0x08ed59d8), TOBN(0x9b76dced, 0x4a72854d),
+     TOBN(0xca2f579a, 0xfdc3b7f5), TOBN(0xac27028a, 0x6cae8b4f),
+     TOBN(0x48fd1a49, 0x42326aa5), TOBN(0xb95fdb4f, 0x5759c63f),
+     TOBN(0x27655358, 0xe0a96abf), TOBN(0x26d38b64, 0x36ed53b0),
+     TOBN(0x03cfdd49, 0xfc6d1f3e), TOBN(0x20af5886, 0x15adaba0),
+     TOBN(0x74c6c943, 0x754dd268), TOBN(0xe7d52cdf, 0x7977717e),
+     TOBN(0x9a81d440, 0x3b414dd2), TOBN(0x697c7b4a, 0xd790a4c7),
+     TOBN(0xb1b7735f, 0xedbce1f2), TOBN(0xbd90e63f, 0xbefa7210),
+     TOBN(0x2e2b0dad, 0x7ab207d1), TOBN(0x89abbd83, 0x9b373211),
+     TOBN(0x45d34ebc, 0x8e35e2bb), TOBN(0x67ba3ac5, 0x064856f6),
+     TOBN(0xb5527dbe, 0xa52c7676), TOBN(0x906fb217, 0x71294012),
+     TOBN(0x65fca552, 0xab305260), TOBN(0x89ac52a3, 0x14ee193b),
+     TOBN(0x673aead4, 0x88c06b1c), TOBN(0xea8af420, 0x49d9d4e8),
+     TOBN(0xa7b4409a, 0xcb9e86bf), TOBN(0x49f76f71, 0x5414aa56),
+     TOBN(0x6603c801, 0x8c13857a), TOBN(0x7c26f1c2, 0xce742384),
+     TOBN(0x042fb224, 0x2a665719), TOBN(0x2619f254, 0xe175b0c6),
+     TOBN(0x5b3b71ea, 0x7c092397), TOBN(0xd9087023, 0xf18c29ae),
+     TOBN(0x48dbecbd, 0x2008841d), TOBN(0x658c998e, 0x22622bba),
+     TOBN(0x38a2cc6d, 0x578e463f), TOBN(0x7002380f, 0xcbb88796),
+     TOBN(0xc545baff, 0x71695101), TOBN(0x064a0500, 0xce65b49c),
+     TOBN(0x3651d926, 0xb1ae0398), TOBN(0x33c9ea8f, 0x4ace0e86),
+     TOBN(0x481fab1b, 0x1a6debd7), TOBN(0x65b58a79, 0x4d365031),
+     TOBN(0xb73ec84b, 0x811e8f01), TOBN(0xb6aa3955, 0x51342ef2),
+     TOBN(0xdbce3d9f, 0x9efcdbcc), TOBN(0x5791b35f, 0xcfbf2a4f),
+     TOBN(0x67024158, 0x6eaad1f0), TOBN(0xe8dbaa88, 0x0063ae25),
+     TOBN(0x6d2051cc, 0x9fedc144), TOBN(0x136c2ab1, 0x18b5e86d),
+     TOBN(0x3b2d3d63, 0xc89241d4), TOBN(0x843cfa3d, 0x4a82dec6),
+     TOBN(0x64fa5860, 0xf0a5f163), TOBN(0x2d9b6095, 0x1ae3be83),
+     TOBN(0x75f97753, 0xb01a91e5), TOBN(0xd374dfa2, 0xcd0d8cac),
+     TOBN(0xe5dbffef, 0x8eb72ba0), TOBN(0x61049807, 0xd7b8a624),
+     TOBN(0x9c8b5e93, 0xa39277d3), TOBN(0x6e5ba593, 0x3b1cc635),
+     TOBN(0x8bd0a69e, 0x21cde059), TOBN(0xd0a19b53, 0x071ec0c8),
+     TOBN(0x8c87785a, 0xd1bb088d), TOBN(0xd801d5a6, 0x7e249c39),
+     TOBN(0x002ee598, 0x8688914f), TOBN(0x52b014fc, 0x6b68413d),
+     TOBN(0xaf1d7e88, 0x507946df), TOBN(0xa38e436f, 0x84ccebf1),
+     TOBN(0x37d9b946, 0xaa86a4b6), TOBN(0x55da0db6, 0xc506a394),
+     TOBN(0x856928c3, 0x02b900bd), TOBN(0x9eb926a3, 0x7bc6a67b),
+     TOBN(0x2f4d392d, 0xd0f39446), TOBN(0xb12f2761, 0x01c49daa),
+     TOBN(0x07b8d23f, 0x13874ac7), TOBN(0xa473ef4c, 0x1efaa157),
+     TOBN(0x550765f6, 0xdf8cf2ab), TOBN(0xeba88504, 0xd23d3750),
+     TOBN(0xf05791d4, 0x2434fa2e), TOBN(0x8c0899c3, 0x4e2a05ea),
+     TOBN(0x40a53bdd, 0x898bc9b0), TOBN(0x6c255f6f, 0x40c8bf7c),
+     TOBN(0x203db8c5, 0xe164b910), TOBN(0x070baaee, 0xc1c4de69),
+     TOBN(0x89660629, 0x5df5c0a7), TOBN(0x0b9c2f4b, 0xdb364b99),
+     TOBN(0x012c6994, 0x44bb5a79), TOBN(0xf5928e0c, 0x9bd1fdc0),
+     TOBN(0xd30b8a97, 0x3ce49191), TOBN(0x52792b85, 0xe3a05dd3),
+     TOBN(0x0da08916, 0x1d3d69c3), TOBN(0x931759e8, 0xed59a28d),
+     TOBN(0x412148d9, 0x6ca05485), TOBN(0xb1517aa0, 0x3d6e9964),
+     TOBN(0x15204ba9, 0xde75812d), TOBN(0x49e377e0, 0x5698b03f),
+     TOBN(0xe7790d41, 0x05c9072e), TOBN(0xf79adbed, 0xdba28e80),
+     TOBN(0x6aad9f96, 0x4644840d), TOBN(0xc3f3d032, 0x2e0a695b),
+     TOBN(0x3eb739d2, 0xaa4aa737), TOBN(0x45c6b665, 0x37d8d520),
+     TOBN(0xc3ba2408, 0x9917cb85), TOBN(0x1c729ffb, 0xd7bf6304),
+     TOBN(0x56b9935e, 0xcc160245), TOBN(0x42379567, 0xe03cb227),
+     TOBN(0x2dc20028, 0xb66bfc5d), TOBN(0xfaf7d224, 0x95de8ed3),
+     TOBN(0xa7541158, 0x3214024e), TOBN(0x2f7755d8, 0x50aabdb6),
+     TOBN(0xb74ac27b, 0x7ea9b93a), TOBN(0xc1c5a8fe, 0xa2e0516c),
+     TOBN(0xe9f4f222, 0x6b64f56f), TOBN(0xf3c0c7fb, 0x8fbc4a64),
+     TOBN(0x43ac0ac2, 0xa16edc23), TOBN(0x0e26e4ad, 0x6d086e9e),
+     TOBN(0x5b8ef949, 0x5bc0961f), TOBN(0xa0d16d39, 0xd2b77c29),
+     TOBN(0x50b43efa, 0x78845d09), TOBN(0x3899e1be, 0xcb3acdd9),
+     TOBN(0xa93a28e3, 0x18d4ec31), TOBN(0x18a4eeed, 0x0a66fe47),
+     TOBN(0xd7a7bf46, 0x87333831), TOBN(0xbbf5c1a8, 0xdbe14699),
+     TOBN(0xf2a3da73, 0x80b9c9d0), TOBN(0x133c138a, 0x82bceb4e),
+     TOBN(0xcfd4b885, 0x335a923a), TOBN(0xf9b69b3f, 0x8fc82f3b),
+     TOBN(0x08908b60, 0x8784c35c), TOBN(0x76bf1082, 0xd843b66e),
+     TOBN(0x1ba730bf, 0xbb57a641), TOBN(0x3bb4a8d7, 0x34e9f095),
+     TOBN(0x0342d32b, 0xc28d5414), TOBN(0x8fb13cbf, 0xcfd99e1a),
+     TOBN(0x3845e507, 0x1d02f47c), TOBN(0x4d77af89, 0x14ef0b26),
+     TOBN(0x93454480, 0x5ef578d9), TOBN(0x23138c57, 0xbdc408ec),
+     TOBN(0xdac833ed, 0x47cf528a), TOBN(0xd18e9865, 0x29d7cf20),
+     TOBN(0x93208743, 0xcdc8e55a), TOBN(0xbfe570c8, 0x724025a0),
+     TOBN(0xb75c3de0, 0x3aee838e), TOBN(0x29304886, 0xe0f21f23),
+     TOBN(0xe46792ab, 0x82791daf), TOBN(0x3d798d92, 0x3f124394),
+     TOBN(0x2446dc81, 0x29a6fb5e), TOBN(0x2446e5b3, 0xbd68c23a),
+     TOBN(0xe1b5c76d, 0x689b1176), TOBN(0x3fb66661, 0x9a852082),
+     TOBN(0x8d6fbcc7, 0xd9b45206), TOBN(0x00ab735d, 0xeabc4640),
+     TOBN(0x428c7017, 0x810e37d1), TOBN(0xa4365872, 0x27af5718),
+     TOBN(0x8f195823, 0x0a910146), TOBN(0xc13ccdd7, 0x0ff76704),
+     TOBN(0x59d34ad6, 0x44d6f1c8), TOBN(0xd3dfa6b2, 0x795b61b4),
+     TOBN(0x1ec08010, 0x12eea439), TOBN(0xafbbea32, 0x7b2cd52a),
+     TOBN(0x99428f9a, 0x68cfe98b), TOBN(0x4ff9a5bc, 0x95628fe7),
+     TOBN(0x212baeb7, 0x7ac41e9a), TOBN(0x595cf03f, 0x29206e86),
+     TOBN(0x4b62a429, 0x733f37c4), TOBN(0xa1fac4ae, 0x4d3cb6a6),
+     TOBN(0x2d6cb0e6, 0x1aed3c45), TOBN(0xf6703493, 0x4e6da48d),
+     TOBN(0xa0036fb4, 0x2d13f9c1), TOBN(0x7db5078a, 0x7fe3ea2e),
+     TOBN(0x152a1fc0, 0xd5992163), TOBN(0xd63270e9, 0x744b44ff),
+     TOBN(0x56730292, 0xf177c075), TOBN(0x470f5e72, 0x17c3e08c),
+     TOBN(0xbf53d223, 0xecb927f5), TOBN(0xc80fbc1b, 0x629e8aa1),
+     TOBN(0xed59f186, 0x24d72477), TOBN(0xc266f5a6, 0x38811583),
+     TOBN(0xc6f37bc1, 0x7c404560), TOBN(0xd58c10e5, 0x0c5b68e9),
+     TOBN(0x696de793, 0x916e8f3c), TOBN(0x7298af8e, 0x56a7781f),
+     TOBN(0xaf063553, 0xb16679d5), TOBN(0xa509f449, 0x4316ed7e),
+     TOBN(0xe3d6ec43, 0xb53cc0e2), TOBN(0x9e957ce0, 0x16ba34cd),
+     TOBN(0x2b0c7fbc, 0x7857d80d), TOBN(0xc2c671fe, 0x3daffbf3),
+     TOBN(0xebcbf012, 0x0d251d41), TOBN(0xedcfe7f7, 0xffef45f5),
+     TOBN(0xf5b66555, 0x334a1734), TOBN(0x4354ccfa, 0xe505f4bb),
+     TOBN(0x6ee0b5b9, 0x52a59260), TOBN(0xb7bb64c1, 0x5a699a93),
+     TOBN(0x85e34c0e, 0x6de84422), TOBN(0xca9bacfe, 0x8bbe0560),
+     TOBN(0xa08c780f, 0x952a52d2), TOBN(0x0e794b05, 0x3919176b),
+     TOBN(0x8a496598, 0x154d282d), TOBN(0xb2999dc4, 0xdc34508c),
+     TOBN(0xfc304fe3, 0x9db4410a), TOBN(0xbc09aee4, 0xe1bc07c8),
+     TOBN(0x1d2f0147, 0xef6d497d), TOBN(0x3b9e06e0, 0x96488fc1),
+     TOBN(0x37635d04, 0x34cb97a7), TOBN(0x9a294b89, 0x8757f955),
+     TOBN(0x38c568ac, 0x59508819), TOBN(0x854370fc, 0x46e15b82),
+     TOBN(0x9f676404, 0xee57f0b4), TOBN(0x268854cc, 0x8f45319c),
+     TOBN(0x4256d25c, 0x63746274), TOBN(0x0a553821, 0x0496cf9c),
+     TOBN(0xb6bf27de, 0x15e2fc17), TOBN(0x6848f83a, 0x99bd538a),
+     TOBN(0x00e15d0a, 0x1685e460), TOBN(0x6fae8b37, 0x155d00b6),
+     TOBN(0x277126d8, 0xdc561456), TOBN(0x331c02e5, 0x6bf70c63),
+     TOBN(0xc9b7da4e, 0x515f39b7), TOBN(0xb7e0d135, 0x966c2060),
+     TOBN(0x9a801457, 0xc401f926), TOBN(0xcc560825, 0xffb0137e),
+     TOBN(0xbcfac5f8, 0x5c7e38fc), TOBN(0xd542c1a4, 0x174e97ba),
+     TOBN(0xbea67b1e, 0x0bb507b8), TOBN(0xf008cc2c, 0x3b782fd8),
+     TOBN(0x865834da, 0x0aa329bc), TOBN(0x0fd746f2, 0x2b6db70a),
+     TOBN(0x8e72e5f7, 0x65fbe439), TOBN(0xac23881d, 0x005295ee),
+     TOBN(0xc2c45fef, 0xad9d013c), TOBN(0x0df74277, 0x71c311f9),
+     TOBN(0x69caf967, 0x6bb32b66), TOBN(0x9fbd32ff, 0xb8e4a3e5),
+     TOBN(0x39d94e31, 0x78c0c439), TOBN(0x7489a8f0, 0xffa4b625),
+     TOBN(0x59af0ec3, 0x8aac717c), TOBN(0xdd3b470e, 0xa12d996f),
+     TOBN(0x6d60cb97, 0x8da3fef0), TOBN(0x5164d722, 0x044d64fc),
+     TOBN(0xefe06ead, 0xfc21305b), TOBN(0x72b4c45e, 0xceed89c1),
+     TOBN(0x072cf1dc, 0x8cabf0df), TOBN(0x0a0d7c0c, 0xa5371d3e),
+     TOBN(0xb13ba707, 0x2ae831d5), TOBN(0x7702c3c5, 0x269f189e),
+     TOBN(0xfb8e903e, 0xc8239fe7), TOBN(0x5805c2ef, 0x524f213c),
+     TOBN(0xdf056e45, 0x70645f7f), TOBN(0xfe10ecfb, 0x454c4577),
+     TOBN(0x422126da, 0x990dc567), TOBN(0x95a5d753, 0xbf55cd81),
+     TOBN(0x2705a00c, 0x8c2688ed), TOBN(0xd079ecb4, 0x2f8f91af),
+     TOBN(0x8cd13fa0, 0x2b69a2c8), TOBN(0x7b0f310a, 0x36b657b8),
+     TOBN(0xa7247cfd, 0x251c595b), TOBN(0xda352dc8, 0x5a36e4b1),
+     TOBN(0x588d2e88, 0xf43312de), TOBN(0xef80a48f, 0xdb9f6dec),
+     TOBN(0x39583634, 0x3fb2d6e3), TOBN(0x0fbfa769, 0x5a46bc46),
+     TOBN(0x3570a3f2, 0xfe701598), TOBN(0xd1d0d091, 0xac815fbb),
+     TOBN(0x4d7bfadd, 0xd7f2b1b2), TOBN(0x509298d4, 0x66496326),
+     TOBN(0xb7accafc, 0xcad9fb50), TOBN(0xcdbcb762, 0x9c592dee),
+     TOBN(0xfe47a3b1, 0x6888482a), TOBN(0x312be210, 0xe8b8c133),
+     TOBN(0xc474b07f, 0x00167f93), TOBN(0x19457000, 0xa637f35e),
+     TOBN(0x3eafa14e, 0x5005d8a1), TOBN(0x2a84723a, 0xadf25f29),
+     TOBN(0x2c9d7ebb, 0xa741cf9e), TOBN(0x94024dc2, 0xc3913acf),
+     TOBN(0xac2db91d, 0x97b98f1f), TOBN(0xfb9a0502, 0x46a7bf92),
+     TOBN(0x8874ffb5, 0x6487a5d4), TOBN(0xc02a12b5, 0x2f53e25f),
+     TOBN(0x38654a57, 0x416ba8fc), TOBN(0x226356f2, 0x0c0b25d6),
+     TOBN(0x34f2eaa6, 0x6030f2ac), TOBN(0xb788baa1, 0x9cea9176),
+     TOBN(0x66fbe9f7, 0x4e912104), TOBN(0x982ef71d, 0x39a69e3d),
+     TOBN(0x9f361d17, 0xbbe5733a), TOBN(0xc79569a0, 0x1988f31e),
+     TOBN(0xf2b96ecb, 0x9e0f52fe), TOBN(0xc78e44dc, 0x80235136),
+     TOBN(0x96053ab5, 0x8462ef4f), TOBN(0xf83c1f6d, 0x81506701),
+     TOBN(0xc7313eb1, 0xa65c09e9), TOBN(0xf5dfaa4a, 0x4efcf558),
+     TOBN(0x8b4819e4, 0xe65ede91), TOBN(0x5a5824ba, 0x6dc0a533),
+     TOBN(0x89d18b20, 0xb4c930f8), TOBN(0xaad7a5d8, 0xfcefa378),
+     TOBN(0x2ef790c2, 0x298dba63), TOBN(0x3e4b31b6, 0xe90c322f),
+     TOBN(0xa257bb81, 0x52ce2ee4), TOBN(0xb8c2966e, 0xd39c36bb),
+     TOBN(0x13954df8, 0x487719c7), TOBN(0xcb0f7ae5, 0x791b00e7),
+     TOBN(0x367a1cad, 0xc8d21faf), TOBN(0x44dd204d, 0x3fbd8a7c),
+     TOBN(0x778fdb56, 0x5f67ec30), TOBN(0xfb288790, 0x5de5caeb),
+     TOBN(0x310b4d56, 0xca53300c), TOBN(0x37dbb7c4, 0x325c54b1),
+     TOBN(0xc80c83a4, 0xfe771ef7), TOBN(0xe212050f, 0x1c1c1b92),
+     TOBN(0x0f12bb88, 0xf09c666f), TOBN(0x8ec5f396, 0x10a2eca2),
+     TOBN(0xdaf96996, 0x90a22eb7), TOBN(0xeb77eee5, 0x450de941),
+     TOBN(0x13823c58, 0x58fb0165), TOBN(0x2157ba6e, 0x31272111),
+     TOBN(0x110ee33e, 0x2b4f9e7e), TOBN(0x7e1b550b, 0xf682d48f),
+     TOBN(0x8fd8c6c1, 0x3e17cb9b), TOBN(0x91cfbcf7, 0xe1843894),
+     TOBN(0x5fc64346, 0x2917b1c7), TOBN(0x06f56d0f, 0xba86d14a),
+     TOBN(0xb8874d88, 0xaf219f21), TOBN(0xf8803b37, 0x11ab8b0b),
+     TOBN(0x7e63cf63, 0xbe12841e), TOBN(0x9c9cc421, 0xbc90765a),
+     TOBN(0x0264a597, 0x1084fa84), TOBN(0xce260a60, 0x252a9bbe),
+     TOBN(0xfaff225c, 0x2fefa4f2), TOBN(0x02b900ad, 0x05bd09b0),
+     TOBN(0x631e5cfb, 0x11b1b81c), TOBN(0x4d93de46, 0x0a193140),
+     TOBN(0xd92a710a, 0xe3173750), TOBN(0xd712d3a1, 0x671a3833),
+     TOBN(0xbc9caad1, 0x4116e26b), TOBN(0xeb24f658, 0xa72fbd71),
+     TOBN(0x3986a207, 0x9055f802), TOBN(0x212446f8, 0xe2707793),
+     TOBN(0x602541d6, 0x1721b395), TOBN(0x4099a2e6, 0xb07160c2),
+     TOBN(0x765390f6, 0x2369ce91), TOBN(0x2dc37639, 0x5754d219),
+     TOBN(0xbc552369, 0x7c018afb), TOBN(0xca835077, 0x35bf6b66),
+     TOBN(0x61b83e43, 0x61d4b0a6), TOBN(0x8f87f597, 0x27cf66c5),
+     TOBN(0xace57840, 0x9357cbf2), TOBN(0x24834481, 0xabe47fb7),
+     TOBN(0xa434c950, 0xdb3c6e47), TOBN(0x1f479519, 0xaa1da775),
+     TOBN(0x338c9cd2, 0xf14f9d5e), TOBN(0x4666ce7e, 0x1e75f72e),
+     TOBN(0x4fce4d95, 0xe56564e5), TOBN(0x0db55ed5, 0x89e0ff6f),
+     TOBN(0x88796e85, 0x00190b73), TOBN(0xfdf6492a, 0x454e31d0),
+     TOBN(0x30cb3fbe, 0xb9ed6e3b), TOBN(0x5c796282, 0xde8f0544),
+     TOBN(0xe11b36bd, 0xb6af89bc), TOBN(0x0a91cf73, 0xec439d95),
+     TOBN(0xbbe74a5e, 0x0a93fe1c), TOBN(0xcf1f376f, 0xa5d75083),
+     TOBN(0x6718bce5, 0xf7725460), TOBN(0x6654d7b1, 0xa316d17f),
+     TOBN(0xdaa925e5, 0x0393aa3b), TOBN(0x81217e18, 0x9446cdbd),
+     TOBN(0x07708483, 0xa7afc408), TOBN(0xa4c76c4f, 0x44709dfe),
+     TOBN(0x72557d71, 0x3a1c412b), TOBN(0xeb4c2648, 0xb49b0e1c),
+     TOBN(0xcdd24b77, 0xe4d6c002), TOBN(0x3384ea5b, 0x77113e0d),
+     TOBN(0x906fb748, 0x6a10a9ea), TOBN(0x46cda42e, 0x0a3b0e89),
+     TOBN(0x10b9096d, 0x7ae4ad43), TOBN(0xe1f23996, 0x3bf2afea),
+     TOBN(0xcb50b941, 0x0dd82d19), TOBN(0x008e593c, 0x832d93a0),
+     TOBN(0x0b1fb0e6, 0xd86a71e0), TOBN(0x75f2aa6b, 0xb1730860),
+     TOBN(0xed5d4d7c, 0x7efc480a), TOBN(0x500b9d8c, 0xc76c64de),
+     TOBN(0x28904003, 0xec4fc026), TOBN(0xe41b3f23, 0xdec8b315),
+     TOBN(0xa9b5caff, 0x70c06860), TOBN(0x5cb9a4d1, 0x28343b2d),
+     TOBN(0xec157abd, 0x9986a0c3), TOBN(0xbcad3bc6, 0xb5fc67e9),
+     TOBN(0x6e64dd26, 0x13aa9c17), TOBN(0xa347c4a2, 0x271aef54),
+     TOBN(0x47b26cb9, 0x883d90bf), TOBN(0xe84d9c6a, 0xe1c412c9),
+     TOBN(0xd2eacc10, 0x1c67439f), TOBN(0xd7797bb3, 0xc61b2b5d),
+     TOBN(0x0deda652, 0x8ebdb4be), TOBN(0x9e04455d, 0xac3fc2f4),
+     TOBN(0xbbfc6e69, 0x27c86688), TOBN(0xf7cf2947, 0xa1715a33),
+     TOBN(0xe047a3e3, 0x47bc6409), TOBN(0xefeb573a, 0x6f2a5b28),
+     TOBN(0xbf3ea3af, 0xd105ba3b), TOBN(0x5f01b4c2, 0x426c6482),
+     TOBN(0x778a5240, 0x968390b1), TOBN(0xc9c71625, 0x72bcf6a6),
+     TOBN(0x698ec2c9, 0x6fd8b309), TOBN(0x512ea17a, 0xa055809f),
+     TOBN(0x28cb44e7, 0x8822943c), TOBN(0x434dc709, 0xdeb7d3e6),
+     TOBN(0xb8b324d1, 0x1be76434), TOBN(0x7cf24ed3, 0x382ff0b1),
+     TOBN(0xda8265fe, 0x2905e726), TOBN(0xd57b3915, 0xee6c3abc)},
+    {TOBN(0xf9010095, 0xd2a819b5), TOBN(0x5291aaf9, 0x48f2f653),
+     TOBN(0xfa533907, 0xf0afe366), TOBN(0x88a58ecf, 0x8e279e27),
+     TOBN(0x0f077127, 0xfae130bc), TOBN(0xee9ccf1a, 0xf8a54c75),
+     TOBN(0x38a6783e, 0xbed82b6a), TOBN(0x9a1acb3d, 0xed414524),
+     TOBN(0xe4e53cee, 0xd9c12e2a), TOBN(0x11983fc1, 0x7fc1308f),
+     TOBN(0x3eb4d84d, 0x892c2d0f), TOBN(0xa0bfc1ca, 0x74499723),
+     TOBN(0x708344d9, 0x0145176b), TOBN(0xbb2988e0, 0x6f12e75b),
+     TOBN(0xdf73cead, 0xada67545), TOBN(0xf37069d1, 0x2bb8f989),
+     TOBN(0xa24a35e6, 0x9cc17f65), TOBN(0xc49b3e9a, 0x89d9abe0),
+     TOBN(0x82f40303, 0x2fc09ae3), TOBN(0xbffe7d4d, 0x002cc587),
+     TOBN(0x5511f4e6, 0x424ef713), TOBN(0xb86bf654, 0xa658f660),
+     TOBN(0x623388d9, 0x1c8baea2), TOBN(0x60664a71, 0x33656759),
+     TOBN(0x18996198, 0xd8447e16), TOBN(0x17195d76, 0x662171dd),
+     TOBN(0x28cfe6a1, 0xf448b8e6), TOBN(0x8a3c2823, 0x0658c923),
+     TOBN(0x0c548d89, 0x9c35e852), TOBN(0xadf1cd2f, 0x2b378157),
+     TOBN(0x999e41af, 0xf30113b6), TOBN(0xf87515a5, 0x9cf4696f),
+     TOBN(0x6c332c55, 0x9778aa8e), TOBN(0x290ae3ea, 0xd1b8d8b2),
+     TOBN(0x3e2bfa0b, 0xbf533883), TOBN(0xe48e3747, 0x1a523ee2),
+     TOBN(0x4d40f1d5, 0x50fde3ed), TOBN(0xb57e695b, 0x48710433),
+     TOBN(0xa4101258, 0x1b241f3f), TOBN(0xa0cabf7b, 0x3042cabc),
+     TOBN(0x68eb19c7, 0xedfea522), TOBN(0x68e028b8, 0xa400db7b),
+     TOBN(0x6cd97bf7, 0xa8f03a08), TOBN(0x09f4d266, 0xf442fe36),
+     TOBN(0x1ac77f91, 0x5d713a1f), TOBN(0x356e3a35, 0x2f58ccb5),
+     TOBN(0x31d657f1, 0xf8ddc47d), TOBN(0xfea7aede, 0x90092115),
+     TOBN(0x2aeba1d2, 0x4ad49f66), TOBN(0x16ff2bad, 0x9d40861b),
+     TOBN(0x25464f37, 0x7da225f5), TOBN(0xa2fe66cc, 0x1ffc3f0b),
+     TOBN(0x74074d7f, 0xac757f41), TOBN(0x5c85d3d1, 0xcd0a2c20),
+     TOBN(0xccda2a05, 0xc974b266), TOBN(0x5c2e2511, 0xcc10a04f),
+     TOBN(0x01ea2535, 0x510d515f), TOBN(0xc861c54c, 0x489e7856),
+     TOBN(0x9bc8485b, 0x680d17bc), TOBN(0x71472c11, 0x819ccc86),
+     TOBN(0xa7ef9485, 0x0e9b5d8b), TOBN(0x698c9fe8, 0xd029720d),
+     TOBN(0x6ce987d1, 0x61f50161), TOBN(0x035f6f32, 0x9d240bf6),
+     TOBN(0xe7c03c9d, 0x44ec2bed), TOBN(0x0bc4f4a2, 0x76cf95c5),
+     TOBN(0x0722d57c, 0x88f014ee), TOBN(0xae406348, 0x76fa941b),
+     TOBN(0x046424df, 0x23ee068d), TOBN(0xd30b6530, 0xe8c130c5),
+     TOBN(0x17b69098, 0x554f149d), TOBN(0x887e04f7, 0x92f95b71),
+     TOBN(0x414e7371, 0x941c1244), TOBN(0x1d48fe53, 0x94f1da50),
+     TOBN(0xc18bcd89, 0x6519802a), TOBN(0xfae7c2d8, 0x48925019),
+     TOBN(0x0f311ddf, 0xf2ece2af), TOBN(0x7e8e0e08, 0x0a779f79),
+     TOBN(0x47daa5f9, 0xb6207944), TOBN(0xf29dc331, 0xefd08d6e),
+     TOBN(0x9c096e19, 0x23e48f60), TOBN(0xbcc6fe53, 0x8dd36f0c),
+     TOBN(0x452e60f9, 0xbb86a9ca), TOBN(0xad35f732, 0xed16cf06),
+     TOBN(0xcbdd01a2, 0x2bf445f7), TOBN(0xb7848e94, 0xf60ce893),
+     TOBN(0x5e65e8ca, 0x2939a977), TOBN(0x304ebedc, 0x63cfa5e4),
+     TOBN(0x79bae721, 0x252cc655), TOBN(0xa3b9a4e5, 0xc4743792),
+     TOBN(0xf32dcfeb, 0x36fdba1c), TOBN(0xadbd0c1f, 0x7ac19885),
+     TOBN(0xefb4fb68, 0xdc42a2cd), TOBN(0x78b1ca37, 0x2289a71f),
+     TOBN(0x7e1f70fe, 0x87fc6df4), TOBN(0x8d024301, 0x90a9faec),
+     TOBN(0x37c08672, 0x46cd4141), TOBN(0x3c0fed17, 0x1a60d8e5),
+     TOBN(0xab18bf06, 0x0f56fea1), TOBN(0x879ee748, 0x372e757b),
+     TOBN(0x84b19b80, 0x1d280206), TOBN(0xa40d7ce3, 0xd96ac240),
+     TOBN(0x5d493fb1, 0xfea42ebc), TOBN(0x9a5fdafd, 0x40d79bbd),
+     TOBN(0x790c0b30, 0x383b371c), TOBN(0x6dae5df9, 0x676f8168),
+     TOBN(0x101bb4fe, 0x4c584948), TOBN(0xe3d7e99f, 0x55faafeb),
+     TOBN(0xd2c9aefa, 0x134c2e3b), TOBN(0x0aa2a71f, 0x79e27788),
+     TOBN(0x4082f7a6, 0x7ed0a606), TOBN(0x843c12bb, 0x6a1be308),
+     TOBN(0xae72ee74, 0x56e9e473), TOBN(0xcecde6c1, 0x743e16ee),
+     TOBN(0x9a06f105, 0x7c48ca04), TOBN(0x79179cd2, 0x5f822a31),
+     TOBN(0x570d3eeb, 0xe3530605), TOBN(0xbacb30c3, 0x4c7b03b0),
+     TOBN(0x0a8fe254, 0x0eea0cb4), TOBN(0xa052a555, 0x2cdf203a),
+     TOBN(0xee031587, 0x9c34971b), TOBN(0x5829eb07, 0xe76545cf),
+     TOBN(0xb7a3a6ae, 0x33a81bb9), TOBN(0xff42daff, 0x49c9f710),
+     TOBN(0x894eae85, 0xbffb951b), TOBN(0x815fe3e2, 0xce70f324),
+     TOBN(0x636564cb, 0x428b1f12), TOBN(0x722e0050, 0xa029b0bd),
+     TOBN(0xf45cb816, 0xd373a65b), TOBN(0xf2210e00, 0x6078d95e),
+     TOBN(0xf767d7a6, 0x20d2924a), TOBN(0x06d6b552, 0x25b66987),
+     TOBN(0x5c4a3999, 0x790563a1), TOBN(0xcea00a91, 0x3c85510c),
+     TOBN(0x7e37da9c, 0xd2db6297), TOBN(0xfca4735f, 0xf67303e8),
+     TOBN(0x324ca06e, 0xaf76f475), TOBN(0x3367845e, 0x76391adb),
+     TOBN(0x222aa1ce, 0xa26fe169), TOBN(0xb15a8665, 0x7ede94c7),
+     TOBN(0x5b736342, 0x6b6a1f33), TOBN(0x25db61e1, 0x8562f392),
+     TOBN(0xfd4d720d, 0xf2066206), TOBN(0x26ef773f, 0x82c555c3),
+     TOBN(0xb6e35b3a, 0xfde6caa3), TOBN(0x34eb5e13, 0x87fabf4a),
+     TOBN(0x4ad68635, 0x86236a62), TOBN(0x2651d3e6, 0x28510f8f),
+     TOBN(0x88073e34, 0xe0873ba6), TOBN(0x3becce70, 0x22f63746),
+     TOBN(0xff8f9b61, 0x7c08dac6), TOBN(0xc8b45a9c, 0x8c28aa65),
+     TOBN(0xe09c063b, 0xd87b59dc), TOBN(0xf3e4b9ef, 0xcbbdd4ec),
+     TOBN(0x1b6b1793, 0x4855a43e), TOBN(0x594d5565, 0x4ada74ac),
+     TOBN(0x10ee400f, 0xb410c5ef), TOBN(0xfc118113, 0x35695fe9),
+     TOBN(0x766cfe48, 0x8f75d723), TOBN(0xc72023eb, 0xff63aa76),
+     TOBN(0xc503a858, 0x9df9a165), TOBN(0x9b1099ef, 0x851acc4b),
+     TOBN(0x9246c61a, 0x66202ca0), TOBN(0xaba97788, 0x81390ccd),
+     TOBN(0x3309fa65, 0xba9e2785), TOBN(0xbc0388be, 0x2220f385),
+     TOBN(0x94c01a9e, 0x00ddc8ba), TOBN(0xaa54aed9, 0xbccfdec8),
+     TOBN(0x1a959c58, 0x059fc0d6), TOBN(0xd0f34c38, 0xf518e1c1),
+     TOBN(0x38aa2b1d, 0xb53be8fe), TOBN(0xd95a2a19, 0xacdc872f),
+     TOBN(0x97bde382, 0xb4140bd6), TOBN(0x4084ba9d, 0x4cfd5718),
+     TOBN(0xed016bfa, 0xfd22450c), TOBN(0xf00cdccf, 0xa5d1f5bc),
+     TOBN(0x905114cc, 0x111696ea), TOBN(0x1f58a4d3, 0x3a46e782),
+     TOBN(0x899d1856, 0xa5e57fa0), TOBN(0x25186954, 0x68c45c2f),
+     TOBN(0x806deb4a, 0xfa6e3eec), TOBN(0x3c358d48, 0x65a063a6),
+     TOBN(0xce28ed1f, 0x3feacdcd), TOBN(0xef9ee31c, 0xaaa8e601),
+     TOBN(0xddd4fe3d, 0x87c1c66b), TOBN(0xfc2b063e, 0xb3dbfac5),
+     TOBN(0x52d37cd0, 0x20c81dc5), TOBN(0xb628f163, 0x083b5f53),
+     TOBN(0xd9295094, 0x7e42860b), TOBN(0xb877a744, 0x307316ab),
+     TOBN(0xadec0d2d, 0x6b8d99b6), TOBN(0xa75183bd, 0x190bc675),
+     TOBN(0x2b1e0215, 0x4ad6bd44), TOBN(0xda01ad52, 0x9e020c66),
+     TOBN(0x65afd73d, 0x0c2913d9), TOBN(0x67024b45, 0xf0035373),
+     TOBN(0xf501bb4c, 0x4d308206), TOBN(0xfa020c88, 0x77e2e936),
+     TOBN(0x662b72bd, 0x936476a3), TOBN(0x07f76845, 0xbae57d17),
+     TOBN(0x77a43055, 0xf34ca404), TOBN(0x8e403294, 0x4eebc853),
+     TOBN(0xe19ee69a, 0x402fde89), TOBN(0x9092acd0, 0xfe00df56),
+     TOBN(0x640c035c, 0xfb225f92), TOBN(0x92d94246, 0xdce3aa84),
+     TOBN(0x7fe8d3f9, 0x971e9886), TOBN(0xc569905e, 0x014b2a74),
+     TOBN(0xbafb8c4d, 0x7b7c299b), TOBN(0x3d289c60, 0xd534cd21),
+     TOBN(0x95e7032b, 0xd311dee4), TOBN(0xac0c46dd, 0x6e8892a4),
+     TOBN(0x9fedef00, 0xe5bd6486), TOBN(0x3f4d8daa, 0x99f703aa),
+     TOBN(0x78e47925, 0xf0c0ecd2), TOBN(0x8f143c2b, 0xfdac73de),
+     TOBN(0x1f88f5a9, 0xc14bd094), TOBN(0x6cc19e43, 0x99d9532b),
+     TOBN(0x6e474499, 0x639ba66c), TOBN(0x5d9a283b, 0xf5d06b03),
+     TOBN(0xc7e8164f, 0xaa25dbb5), TOBN(0x7ab42a48, 0xf03faec8),
+     TOBN(0x4135765b, 0x647a0d72), TOBN(0x9562a676, 0xe196b571),
+     TOBN(0x62cc4c05, 0xa720cc20), TOBN(0x9ed3f637, 0x13fa1ad2),
+     TOBN(0xe5816f51, 0x7f59bac9), TOBN(0x738e1544, 0xb6884359),
+     TOBN(0x83bb2666, 0x34d0fb02), TOBN(0x0e582c6b, 0x8014c57b),
+     TOBN(0xbb4069ae, 0x145e2bff), TOBN(0xd1965cdf, 0x4f5f1d7d),
+     TOBN(0xaf77f98b, 0x3cead86d), TOBN(0x0ba278bd, 0x0e51cbd8),
+     TOBN(0xf11f20f6, 0xac2ebb7c), TOBN(0xafd2333f, 0xc9992b55),
+     TOBN(0x425dd0e4, 0x322472b6), TOBN(0x0027a74a, 0x0958215e),
+     TOBN(0xddb301e7, 0x4cf7e0e4), TOBN(0xd0656ed5, 0xcbb70c2e),
+     TOBN(0xa40f629f, 0x0e7662e8), TOBN(0xdaa85755, 0xe399a5ca),
+     TOBN(0x4c119aba, 0x7297010c), TOBN(0x4a4a6a43, 0xe5df7140),
+     TOBN(0x6d90d303, 0x474f7873), TOBN(0xc5b0e19c, 0xd1f8f867),
+     TOBN(0x188bcae6, 0x4f6dc217), TOBN(0x51ce999a, 0x6777357f),
+     TOBN(0xdfc9578b, 0x41aeb39f), TOBN(0xeeda86fe, 0x7dd55c1f),
+     TOBN(0xd4b8fc54, 0xfb814075), TOBN(0x12e32a78, 0x33a1317c),
+     TOBN(0xeb79cd2b, 0x2fd217d1), TOBN(0x5f5f20c0, 0xdbd07638),
+     TOBN(0xfc57643a, 0x53dc7d8b), TOBN(0x65126014, 0xf08350e2),
+     TOBN(0x737ef5b4, 0x871b0d3d), TOBN(0x6b7e04ce, 0xae3143a5),
+     TOBN(0x0e5ab52e, 0xb7ae12b9), TOBN(0x1a956daa, 0xdb66ee0e),
+     TOBN(0x59657e47, 0xeaa7042e), TOBN(0xbbc35318, 0xbf84a2cf),
+     TOBN(0xef55429c, 0x78679b8b), TOBN(0xef92df9d, 0x60cb7678),
+     TOBN(0x17655580, 0x1dd267d6), TOBN(0x00a3ec71, 0xeb0bc1fa),
+     TOBN(0xafa0a256, 0x50514840), TOBN(0x68c28d0c, 0xf161c685),
+     TOBN(0x069f7862, 0xb1c766dc), TOBN(0x6868a463, 0xd5ad4568),
+     TOBN(0xf9c3d670, 0x70e46d7d), TOBN(0xd2432cc9, 0x6c875260),
+     TOBN(0x534c3425, 0x088cecd9), TOBN(0x3f1818e6, 0xb4e34c6c),
+     TOBN(0x3aedf0a8, 0x028f153b), TOBN(0xe0a1cb9d, 0x50d9433a),
+     TOBN(0x9b4e225f, 0xe523b764), TOBN(0xcba6cba9, 0xe5f8542c),
+     TOBN(0x59c307e4, 0xa8f6b81e), TOBN(0x36abf4b7, 0x01bb44fc),
+     TOBN(0xf7692c14, 0xdd62528c), TOBN(0x0d4a8341, 0xdf57773e),
+     TOBN(0xece6957d, 0xc9b4f968), TOBN(0x82eda200, 0x52779586),
+     TOBN(0xb902c488, 0x2f06ec6b), TOBN(0x127dd7ba, 0x91a876f0),
+     TOBN(0x06eb96d8, 0x33ad0c13), TOBN(0xd7394080, 0xfc5985ce),
+     TOBN(0x624c8f61, 0x661aaa4d), TOBN(0x6fe10a11, 0x6717a3e1),
+     TOBN(0x6c288c53, 0x53168ad0), TOBN(0x91b8779b, 0x8b52d037),
+     TOBN(0x89e664d4, 0x1b5b0ab9), TOBN(0x9f69b44f, 0xf30d47d3),
+     TOBN(0xfe67cad5, 0x03176019), TOBN(0xb83efd48, 0xb346a205),
+     TOBN(0x63fc4863, 0xaeea0c91), TOBN(0xbabf9042, 0xdb56004b),
+     TOBN(0xdb19f2ee, 0xa9917def), TOBN(0x1d12f2dc, 0x54c3fae1),
+     TOBN(0x7bb496af, 0x55e36d40), TOBN(0x1f6c11f8, 0x6be63b27),
+     TOBN(0x96d79804, 0xcaf9a5b9), TOBN(0x03a085c4, 0x0648051c),
+     TOBN(0x3b54c223, 0xb56baf4c), TOBN(0x04af8c4c, 0x559c1fc1),
+     TOBN(0x05d55266, 0xabd3cebb), TOBN(0xd2d3ae9b, 0xf865e262),
+     TOBN(0x3bd3ca3a, 0xedfedc54), TOBN(0x30a6ff1c, 0x922776c4),
+     TOBN(0xfecd8845, 0x1616a6f2), TOBN(0x4e7bc2e8, 0x94948d8c),
+     TOBN(0x16e0d824, 0xedca784b), TOBN(0x84584f98, 0x67ea1eea),
+     TOBN(0xeceb1418, 0x8625626b), TOBN(0xa487cf9f, 0xc34fc1f3),
+     TOBN(0x4ecfedd2, 0xa57cec36), TOBN(0x08624865, 0xd24a0709),
+     TOBN(0x47bb1909, 0x6a48f3ee), TOBN(0x54c5dd0c, 0xc69bc041),
+     TOBN(0x15a291e6, 0x7527166e), TOBN(0x8a92370d, 0x4a9a8315),
+     TOBN(0xe9fe705d, 0xda584bd6), TOBN(0xed441dc3, 0x3625a669),
+     TOBN(0xa57929ce, 0x3063f2de), TOBN(0x2809fe4b, 0x6348cc31),
+     TOBN(0x92041d54, 0x04cc19c0), TOBN(0xd7c227fc, 0xb62c1f94),
+     TOBN(0xecfeee53, 0xcd0d497c), TOBN(0x8d1ea9fd, 0x128818a8),
+     TOBN(0xb5cf2c28, 0x2ae4725d), TOBN(0x7de9f967, 0xc6abad3a),
+     TOBN(0xc64a11fc, 0xb14a183c), TOBN(0x7f14d0fe, 0xd5777d77),
+     TOBN(0xbe79846c, 0x12957444), TOBN(0x4cf23abf, 0x0e3257ca),
+     TOBN(0x8da0fd8d, 0x6e01b48e), TOBN(0x63a7ff16, 0x5ee87ca4),
+     TOBN(0x90dff4d3, 0x5cc96b94), TOBN(0xff1b41c3, 0x406fc905),
+     TOBN(0xdd932925, 0x3ac71c41), TOBN(0xec57f1b8, 0xcf65e59d),
+     TOBN(0xa3116d6f, 0x3ce0512b), TOBN(0x3b46fd3c, 0xa2e28316),
+     TOBN(0x5a6c0314, 0x60156a5e), TOBN(0xfab3afe3, 0x55d46fd0),
+     TOBN(0x4617926c, 0x9846f0db), TOBN(0xc2d5a447, 0x121ef237),
+     TOBN(0x789498d1, 0xf1cda3b1), TOBN(0xa195cf03, 0xccd64aac),
+     TOBN(0xe8d1a162, 0x9440be2b), TOBN(0x7399890a, 0x3ad5373e),
+     TOBN(0x65dcea2f, 0x4fbf1899), TOBN(0x44d9c8ab, 0x44ee1a5a),
+     TOBN(0x2e94f8c8, 0x406880fb), TOBN(0x70732bad, 0x51faab7d),
+     TOBN(0xd69309dd, 0xf1e92b52), TOBN(0x25f9a675, 0x3c7685d0),
+     TOBN(0x3604f30b, 0x1dbfbaa0), TOBN(0x5ac0001b, 0x2ff28c22),
+     TOBN(0x648ec4fa, 0x52762d8d), TOBN(0x4fc248c6, 0x0cef95f8),
+     TOBN(0xfc0f7030, 0xe5fbb57d), TOBN(0x2e644729, 0x5ff2db51),
+     TOBN(0xd85877ec, 0x3775471c), TOBN(0xe2580058, 0x6076a271),
+     TOBN(0x58a4a24f, 0x09cb3873), TOBN(0xb412928b, 0xb142da8c),
+     TOBN(0x1da7964b, 0x5997987a), TOBN(0x69765ff0, 0x1825d97b),
+     TOBN(0xde8ae407, 0x4c97095c), TOBN(0xb257a968, 0xbb59316c),
+     TOBN(0x80e5240d, 0xcf2dfbd2), TOBN(0x2b3b04b0, 0x1fccd0e7),
+     TOBN(0x949f1234, 0x8ff1093e), TOBN(0xa4df3290, 0x65f62273),
+     TOBN(0x305b7479, 0xd0058ffa), TOBN(0xe459ecff, 0x180b0de6),
+     TOBN(0xfbe00c08, 0x8ca0585f), TOBN(0xc169e23a, 0xc3dd4fa0),
+     TOBN(0x65d9009a, 0x44026f6e), TOBN(0xbbc258c3, 0x1d96fe58),
+     TOBN(0xd7ed379c, 0x328ed1e0), TOBN(0xe8b45744, 0x23970884),
+     TOBN(0x2f44c8ce, 0xed1095b5), TOBN(0x25725b0d, 0xc59404aa),
+     TOBN(0xea926278, 0xa273e09f), TOBN(0x102b120b, 0x529143d5),
+     TOBN(0xbd2c012d, 0x81174d10), TOBN(0x0bf5cf89, 0x4e8333ad),
+     TOBN(0x6b93e3b0, 0xb2f60645), TOBN(0x040298b8, 0xf38df3ce),
+     TOBN(0x6433b6fc, 0xb89e18fd), TOBN(0x48d6584a, 0x6bd6af88),
+     TOBN(0x46c8a061, 0x0e1747a5), TOBN(0xe225d3cd, 0x1ed79faa),
+     TOBN(0x6c579abb, 0x5c28a48b), TOBN(0xc7a5ff4d, 0xda3889d6),
+     TOBN(0x037ebc4b, 0x008febdf), TOBN(0x03b60593, 0xa7c5cbc9),
+     TOBN(0x0840804d, 0xdcaa3319), TOBN(0x38b0f084, 0xb7481f45),
+     TOBN(0xfdb059c9, 0x112e794e), TOBN(0xb62bce05, 0xe1afb614),
+     TOBN(0xc15035b6, 0x53be7c02), TOBN(0x66fc7106, 0x153ee8e5),
+     TOBN(0x27fd2ea4, 0x8258727f), TOBN(0x8e012416, 0xb470105e),
+     TOBN(0x3d24685b, 0xd7711aee), TOBN(0x66a83c3b, 0x021bab69),
+     TOBN(0x6e1112a7, 0x5501d69d), TOBN(0x2219fe0b, 0x068b0504),
+     TOBN(0xaaa553c1, 0xa926ab1b), TOBN(0x1c81af95, 0x56d6ca58),
+     TOBN(0x0a997380, 0x221ef447), TOBN(0x881a62fa, 0xf5f55487),
+     TOBN(0xf88fa0bd, 0x4f1b618a), TOBN(0xb20e161c, 0xcbac98e8),
+     TOBN(0x443352b5, 0x3bc6a7ad), TOBN(0xbc8e03ff, 0x0fd5748a),
+     TOBN(0x64006aff, 0x0ca427fc), TOBN(0x1a477593, 0x7cbbda99),
+     TOBN(0x21ef1afd, 0x1a347c47), TOBN(0xfe056287, 0xdee162b6),
+     TOBN(0x9d4eb7da, 0x797a0b14), TOBN(0xe4e01a46, 0x951c4bd0),
+     TOBN(0xaf8fa17f, 0x7fe354a6), TOBN(0xd71f160c, 0xc430b12b),
+     TOBN(0x5bb68437, 0x83d46be0), TOBN(0x99d10d82, 0x619bba86),
+     TOBN(0x95c2219d, 0xf4327042), TOBN(0xdace2322, 0x9c19ab57),
+     TOBN(0x88abbc67, 0xc8750fe7), TOBN(0x81ab300a, 0xd3abe7d2),
+     TOBN(0x62a6d8d5, 0x45aa8948), TOBN(0x76175bbd, 0x5d4ce8c3),
+     TOBN(0x095cb181, 0x8ea70976), TOBN(0x785de3fc, 0xf7e62a19),
+     TOBN(0xc478bce8, 0xed11a7fe), TOBN(0xb7e5993b, 0x1528aee2),
+     TOBN(0xb9ec58d7, 0x76c32e4b), TOBN(0xef815613, 0x2dbc9a61),
+     TOBN(0x372c3856, 0x5e07410d), TOBN(0xa1b16510, 0x033276d0),
+     TOBN(0xd8589581, 0x82640d26), TOBN(0x1cb98180, 0x9053fff0),
+     TOBN(0x41519ce7, 0xc1ff11f1), TOBN(0x2f21a48f, 0x666431e4),
+     TOBN(0x2c223ed1, 0xe83ee840), TOBN(0x833ae708, 0x1e7cf4dc),
+     TOBN(0xec8853d8, 0xacd13385), TOBN(0x559115ab, 0x6a7a8cb1),
+     TOBN(0xe2f4ab2a, 0xeb184e71), TOBN(0x679abbce, 0xc10194df),
+     TOBN(0x10199c84, 0x3aca0828), TOBN(0x7474e113, 0x978cc1d6),
+     TOBN(0xa4460ef1, 0x44e8eb9a), TOBN(0x4cde5260, 0x828aa4bf),
+     TOBN(0xd3d23790, 0x249bff50), TOBN(0x2e6660da, 0x6bc7fbbc),
+     TOBN(0x3e3cc146, 0x61494df0), TOBN(0x6e9a1571, 0x0bcda8ba),
+     TOBN(0x68ce233e, 0x096e00b7), TOBN(0x247a5c49, 0x5106c85b),
+     TOBN(0xe6f0cb5c, 0x55fc5757), TOBN(0x452682b9, 0xb7585799),
+     TOBN(0x84509dfe, 0x869e747e), TOBN(0x904366e5, 0x8d23be04),
+     TOBN(0x7324a14d, 0xb0f72c6d), TOBN(0x9fbe3116, 0x1913a9ff),
+     TOBN(0x2f9fa62a, 0x428a6b5d), TOBN(0x8039270f, 0xf8a34d9e),
+     TOBN(0x0e3ce7ae, 0x407aec78), TOBN(0x4d935d3d, 0x826458cd),
+     TOBN(0xf75db7db, 0xfc6f46d4), TOBN(0x3ab7ba68, 0x88586874),
+     TOBN(0xec92749f, 0x9a198b50), TOBN(0x0ffc7681, 0xefc51cdb),
+     TOBN(0x951406d5, 0xe17bc0e3), TOBN(0x39cd2d07, 0xc898a018),
+     TOBN(0x9dc3803c, 0xf2f79af6), TOBN(0x292f3164, 0x0a56cd68),
+     TOBN(0xdcac21f9, 0xf6fbdbdf), TOBN(0x6f9ce2a4, 0x23e9e959),
+     TOBN(0x2011d221, 0x970f6c34), TOBN(0xd2e63711, 0x9e2decfb),
+     TOBN(0x19c7a489, 0x118ff327), TOBN(0xe19d7e83, 0xbb6e534e),
+     TOBN(0xc685389a, 0xbd1a426b), TOBN(0x432ff7b0, 0x8c679952),
+     TOBN(0x516cbdfa, 0xc5e2687f), TOBN(0x8242405d, 0xba1eac8f),
+     TOBN(0x63af3152, 0x0b09854e), TOBN(0xcecd0faa, 0x231ec979),
+     TOBN(0x4746733f, 0x7273f0b2), TOBN(0x69b28d87, 0x8f001365),
+     TOBN(0x0d87d506, 0xc6f2623c), TOBN(0xd209a9c6, 0x86c40ed2),
+     TOBN(0xa5b7fde2, 0x0fa20f3b), TOBN(0x54550dc5, 0x4f5b2129),
+     TOBN(0x36884047, 0xfeddaa1b), TOBN(0x51398fa0, 0xd899a29f),
+     TOBN(0x14a416be, 0xcdf11867), TOBN(0x86351ac6, 0x3e466b62),
+     TOBN(0xd63e91e1, 0x39bb481a), TOBN(0xdcdc072a, 0x99984155),
+     TOBN(0x9fce6e38, 0xd2d8e622), TOBN(0xbf6978b6, 0x8e8c8034),
+     TOBN(0xaa1ae874, 0x8c37990a), TOBN(0xd1f0e068, 0x0e749b86),
+     TOBN(0x5aa303b1, 0xcbdc7c12), TOBN(0x9a78baaf, 0xc9130211)},
+    {TOBN(0x5eeba910, 0xb3e2087b), TOBN(0xbd016dd3, 0x44a61a33),
+     TOBN(0xffd1f081, 0x48cd5c0f), TOBN(0x041c6aa0, 0x2e6a8e94),
+     TOBN(0xe09c35c5, 0xc4ac3d91), TOBN(0x58298105, 0x634767a4),
+     TOBN(0x6120e7cb, 0x1040c2b5), TOBN(0x32a661ef, 0xa713589f),
+     TOBN(0x5a056a90, 0xbd74c70e), TOBN(0x44f7d00d, 0x8af672f3),
+     TOBN(0xdc25ab68, 0xef4e9a48), TOBN(0xadd15cc3, 0xfdfb1069),
+     TOBN(0xb1f4fd28, 0x9f3033bf), TOBN(0x088a49bb, 0xebb8b8a7),
+     TOBN(0xea485869, 0xa8d2861c), TOBN(0x46dbfdaf, 0x6b977fb5),
+     TOBN(0x04e6461e, 0xd88ae888), TOBN(0x112d204a, 0x9be2d7ad),
+     TOBN(0x952dc813, 0xdb558427), TOBN(0x39b01652, 0x27e35200),
+     TOBN(0x8b89bfce, 0xff02cdbb), TOBN(0x1381a99b, 0x3e854e4c),
+     TOBN(0x68185218, 0x999efd2b), TOBN(0xeb41e1bb, 0x86dc62e1),
+     TOBN(0xa264ef40, 0x02d0aaff), TOBN(0xa678c07d, 0x6e679fe2),
+     TOBN(0xcff13be7, 0xfd88bdce), TOBN(0x9a8efe8d, 0x617badb8),
+     TOBN(0x1388a815, 0xad5a22f4), TOBN(0x8f821400, 0xfec398b3),
+     TOBN(0x85a6a565, 0xff4fc2da), TOBN(0x681f0181, 0x858dd4f3),
+     TOBN(0xdc870745, 0x91ee75bc), TOBN(0xbadbf940, 0x64f20e50),
+     TOBN(0xf3ea437f, 0x49d3d417), TOBN(0x7bebd868, 0xc02109d0),
+     TOBN(0xe6c8d93c, 0xd16bb240), TOBN(0x2087141a, 0xfdab9bbd),
+     TOBN(0x8dba80ff, 0x20a3b470), TOBN(0x960a0c7b, 0x29d3a8d7),
+     TOBN(0xae61b637, 0xf8ec1151), TOBN(0x415dd36b, 0xaadc8545),
+     TOBN(0xed21d176, 0x69d0985a), TOBN(0xc4d062af, 0x97893f50),
+     TOBN(0x4d93ba1a, 0x337b81f9), TOBN(0xb995fe9e, 0xb7c163a2),
+     TOBN(0x447eff3b, 0x5416e4ed), TOBN(0xd7660300, 0x0bf4a8e7),
+     TOBN(0x9e14c6a2, 0x56d9e00f), TOBN(0xa228491c, 0xfa1f60e0),
+     TOBN(0xd540713e, 0x8782a9be), TOBN(0x5d3fcce8, 0xdcd55e21),
+     TOBN(0xa176c34e, 0x35c87b90), TOBN(0xc1d80aa1, 0xf9508f35),
+     TOBN(0x14f7e7fc, 0x92302d47), TOBN(0x459372ba, 0x2b076e72),
+     TOBN(0x44168fbc, 0x4e933b19), TOBN(0xaf2db74c, 0xe54ea969),
+     TOBN(0x36fade13, 0xaeacbb56), TOBN(0x29708665, 0x84e6cd1d),
+     TOBN(0x6f7ff1e1, 0xb692df97), TOBN(0x5a68c1a2, 0x6ae66307),
+     TOBN(0x85bc544c, 0xe7685f20), TOBN(0xb3f42e6d, 0x0f65eeec),
+     TOBN(0xef209f44, 0x5b91b644), TOBN(0x808b930a, 0x50cb02b6),
+     TOBN(0xc5da5e86, 0x099f684f), TOBN(0xd8f1dbcc, 0x4330c2d8),
+     TOBN(0x52e8cab5, 0xd8608776), TOBN(0x13c89771, 0x16e56f5d),
+     TOBN(0x7d7d802a, 0xb135282b), TOBN(0x69762c39, 0xe9be8a20),
+     TOBN(0x13f6bbad, 0x2a08a1dc), TOBN(0xa7131e4a, 0x7f2dba7a),
+     TOBN(0x751dce48, 0x7864f5a3), TOBN(0xc5af1b45, 0x08135109),
+     TOBN(0x3c4d75f7, 0x4f08636e), TOBN(0x9949b2f5, 0x2e251e48),
+     TOBN(0xd0497977, 0x9bd98853), TOBN(0x09d8e627, 0x909b0e84),
+     TOBN(0x505753ee, 0x4ceff1c9), TOBN(0x03ca4571, 0x460710ca),
+     TOBN(0x0cf72dee, 0x5480abc0), TOBN(0x55d5a30e, 0xc19c8ef3),
+     TOBN(0x9e47641b, 0x86541f6f), TOBN(0x89b2e48f, 0x10c9d6fb),
+     TOBN(0x9d16382b, 0x0860915c), TOBN(0x770ac417, 0xf54b337f),
+     TOBN(0x366d0781, 0x77ef7f67), TOBN(0xfefec947, 0x2b6340c9),
+     TOBN(0x7ce3a056, 0x097acf63), TOBN(0x26538c7c, 0xaf306dec),
+     TOBN(0x8a8bb55e, 0x287dc8d1), TOBN(0x9431095b, 0x448823ae),
+     TOBN(0x8358087a, 0x7970fc51), TOBN(0x95299959, 0x413509ac),
+     TOBN(0xb165f92a, 0x8b0911d4), TOBN(0xdde855ee, 0xbfb37459),
+     TOBN(0xe672eed4, 0x3d9ce36e), TOBN(0xf7da91e5, 0x74bae261),
+     TOBN(0x1f67323c, 0xb741c8e6), TOBN(0x8efd4661, 0xc92c91ce),
+     TOBN(0x556f0b1a, 0x78e73c42), TOBN(0x7d326b7f, 0x16101f96),
+     TOBN(0x8814ef0b, 0xfb48bd3a), TOBN(0x1bbbe13e, 0xc508309e),
+     TOBN(0x7ddaf061, 0x67709c10), TOBN(0x82b67847, 0x6436f655),
+     TOBN(0x2a5601c6, 0x03712e64), TOBN(0xac1f0362, 0x3e3f9b2e),
+     TOBN(0xcc7e6a09, 0x09184b5d), TOBN(0x1258b265, 0xb4625149),
+     TOBN(0xd9f21461, 0x384a6b54), TOBN(0xde483161, 0x6cfe9311),
+     TOBN(0x593dae45, 0x889f43cc), TOBN(0x8454335b, 0xedee221b),
+     TOBN(0x90f3fb43, 0x3a2cbced), TOBN(0x895ed692, 0xcc8dcb75),
+     TOBN(0x9857d719, 0x14233aa7), TOBN(0x91b1a2ab, 0x48166d5f),
+     TOBN(0xfbf7033a, 0x675b47a0), TOBN(0xcb3669c4, 0x6542378f),
+     TOBN(0x96abb0f7, 0x125ec248), TOBN(0x6d5d2047, 0x795fc346),
+     TOBN(0xa6c6c9e8, 0x8f5cffb6), TOBN(0xb968f2c7, 0xbea5ee09),
+     TOBN(0x2f2ce735, 0x844ffd6f), TOBN(0x7931b877, 0x27e40ac8),
+     TOBN(0xe1f62dcf, 0x2b63d538), TOBN(0x395681dd, 0xf44d7bf9),
+     TOBN(0xf02eedf7, 0x54aec359), TOBN(0xc64b6233, 0xa0ad5eb7),
+     TOBN(0xc65093c7, 0x346b086a), TOBN(0xfcf8ecc9, 0xe957b243),
+     TOBN(0xe1accffa, 0x1ca48020), TOBN(0xe1f29792, 0x4047bbeb),
+     TOBN(0xb1097d40, 0x9fc6be25), TOBN(0x02d33d19, 0x923eb7b4),
+     TOBN(0x9e25200c, 0x1f58f545), TOBN(0x2ffae306, 0xda51efcb),
+     TOBN(0x7e6d76c1, 0xc0b011f2), TOBN(0xedbd8398, 0xf680676b),
+     TOBN(0x38517fc2, 0x8d7fc8c2), TOBN(0x55a7fcf9, 0x5c3ab05c),
+     TOBN(0x047e2422, 0x8e6dd02d), TOBN(0x7b3bf0e6, 0x1f290d6a),
+     TOBN(0xbcf326fc, 0x6a99a6d0), TOBN(0x1e3f38fa, 0x2eef8232),
+     TOBN(0x9890780e, 0x15bac529), TOBN(0x94202e0e, 0x9f143ba0),
+     TOBN(0xbd574712, 0x885e4ed5), TOBN(0x2404c223, 0x396f938d),
+     TOBN(0xd54d401c, 0xacde8286), TOBN(0x80397794, 0xe7af01fd),
+     TOBN(0x94457d07, 0xf615a8eb), TOBN(0x34680480, 0xd22d9ef7),
+     TOBN(0x04d4b302, 0x2c489ccf), TOBN(0x11dea4bd, 0xc3673dae),
+     TOBN(0x8fbb4df5, 0x58cdfe41), TOBN(0x49425184, 0x0f10a70e),
+     TOBN(0x831b977a, 0x077a59ce), TOBN(0xee08fb0c, 0x894627f3),
+     TOBN(0x21360507, 0x2f8553f0), TOBN(0xca77ccd1, 0x0487171b),
+     TOBN(0xc17d20c2, 0x07e11059), TOBN(0xcf74be6b, 0xbe613256),
+     TOBN(0x06f185e6, 0xa5fe18c1), TOBN(0x8d2cf4f5, 0x2b57ce3e),
+     TOBN(0x7179273c, 0xc9c983e7), TOBN(0xc7d27357, 0x153f58d8),
+     TOBN(0xc0273069, 0x4f400bd4), TOBN(0x23309c7f, 0x26262553),
+     TOBN(0xf26b6e11, 0x712d0314), TOBN(0xb925cebf, 0xf96ee39a),
+     TOBN(0x6df57108, 0x73944251), TOBN(0x95419b24, 0x589d90aa),
+     TOBN(0x57a1bcc5, 0x796a8ee2), TOBN(0x22a22530, 0x2acee09d),
+     TOBN(0xa4c2cc03, 0x66fa2911), TOBN(0x9cc2b7fa, 0xd85f13dc),
+     TOBN(0xf2498b8a, 0xce152790), TOBN(0xd8406007, 0x1caf39d1),
+     TOBN(0x7ff50064, 0x84c0822f), TOBN(0xaf14ca4b, 0x155f1280),
+     TOBN(0x113f094b, 0x89b781c2), TOBN(0x996bf893, 0x013833a5),
+     TOBN(0x26bc6210, 0xc0b9cf6d), TOBN(0x18e2d3ac, 0x6a88f1cf),
+     TOBN(0xc0ff2b3c, 0xa21a2d35), TOBN(0x409c2598, 0xa79e918e),
+     TOBN(0xffcf65a0, 0xb6917e22), TOBN(0x8036897f, 0xbb4f8f3c),
+     TOBN(0xac660365, 0x9ec27fd7), TOBN(0x3c5ca1a9, 0x0c56cbb1),
+     TOBN(0x01c5dce1, 0xbe9e9ec7), TOBN(0xdc21b01a, 0x386edb4a),
+     TOBN(0x47e02a92, 0x4b1dde01), TOBN(0x0613b7ca, 0x44af3e0b),
+     TOBN(0x644ac708, 0x1c445b6f), TOBN(0xb5566f0f, 0x87243e2a),
+     TOBN(0x5b244172, 0xba9f354a), TOBN(0xaca4e9d3, 0xeb653a5e),
+     TOBN(0x6ff6904a, 0x514809f2), TOBN(0xf87a329b, 0x96595230),
+     TOBN(0x39ebe6eb, 0x8d4bd051), TOBN(0x66f05f5c, 0x07d17d59),
+     TOBN(0xfa1ee673, 0xe0f81731), TOBN(0xf41c1042, 0xd12804a9),
+     TOBN(0x1c4a655a, 0xacd14cf5), TOBN(0xdc72f5bc, 0xef47548f),
+     TOBN(0xab07ceff, 0x0b3ee6c7), TOBN(0xcfa88319, 0xbb501a28),
+     TOBN(0xcec9c2e2, 0xd8f03f7c), TOBN(0x3098d752, 0xe0c98d62),
+     TOBN(0xa41a0794, 0x0a8681b3), TOBN(0x0e588076, 0x23587932),
+     TOBN(0x4617dc66, 0x5ef86f7c), TOBN(0x51de8430, 0xcedb5377),
+     TOBN(0x0dda704a, 0x737381b6), TOBN(0x83a44653, 0x008f4671),
+     TOBN(0x71bbb73e, 0x38401c11), TOBN(0x879fe49c, 0x4894d378),
+     TOBN(0x8875eef9, 0xeab186a2), TOBN(0xedefe278, 0x12a382a9),
+     TOBN(0x95ef41b8, 0x13b897fd), TOBN(0xfefd495f, 0x2a98ddd9),
+     TOBN(0x09cbccfc, 0x680b12e8), TOBN(0xc1888a21, 0x167da5dc),
+     TOBN(0x2a204912, 0x3bb290b4), TOBN(0xdcac95fc, 0xd9613190),
+     TOBN(0x4df94f62, 0x709c76f7), TOBN(0xc8c3a8ab, 0xa5cea926),
+     TOBN(0x15c876b2, 0x37a2b813), TOBN(0x9b52803e, 0x9c3c821c),
+     TOBN(0x40f2268c, 0xcb3d6ff1), TOBN(0x689f1696, 0xa1573601),
+     TOBN(0x8d7566dd, 0x8e921f56), TOBN(0x5d8a990c, 0xd992335a),
+     TOBN(0x6339153a, 0x20dc4f4b), TOBN(0x0b07419c, 0xdc5d06ab),
+     TOBN(0xe9cc014d, 0x97c201f9), TOBN(0xec04a52e, 0xa635f472),
+     TOBN(0x6aac504a, 0xa538a84f), TOBN(0x4d0288e3, 0x5762fe7c),
+     TOBN(0xaa8539f0, 0x34cbd09a), TOBN(0x6f7e0e94, 0x2619bcf7),
+     TOBN(0x178303dd, 0x0dd338d0), TOBN(0x6b58c2b1, 0x8326f40e),
+     TOBN(0x98bb15ec, 0xfe73e699), TOBN(0x7533abdc, 0x47526489),
+     TOBN(0x4b269607, 0x491dcc6d), TOBN(0x325ec2a0, 0x77187363),
+     TOBN(0x766faa19, 0x7e9ab865), TOBN(0x1c105b4a, 0xc25a9448),
+     TOBN(0x0b6b8963, 0x0531b5ba), TOBN(0x32691f11, 0x2db1a579),
+     TOBN(0x24d90a57, 0x643e479c), TOBN(0x048b27cb, 0xb98578df),
+     TOBN(0x0600f93f, 0xe53bed53), TOBN(0x1fd57dfc, 0x0aac585f),
+     TOBN(0xc3d72121, 0x71d0e4e0), TOBN(0x5ff10dfb, 0xf612fc4e),
+     TOBN(0x9edf4b23, 0xb5a7ec79), TOBN(0x975165c7, 0xd87706ab),
+     TOBN(0x8b99db04, 0x7095c3c4), TOBN(0x65196441, 0x897faf50),
+     TOBN(0x5d23d7d9, 0xdd5b64cb), TOBN(0xec734b06, 0xe95fe601),
+     TOBN(0x03a5f53f, 0x0b5fcde9), TOBN(0x0186ad22, 0xebe35310),
+     TOBN(0xe9a65eef, 0x84846603), TOBN(0xe99e5188, 0xa7c6e5be),
+     TOBN(0xa917327d, 0xf0887da6), TOBN(0x49965f78, 0xe3f9fa70),
+     TOBN(0x02ed227d, 0x4f10b31d), TOBN(0x535b4386, 0xb6120be5),
+     TOBN(0xdff21a8a, 0xcc1bf98a), TOBN(0x5b52a09a, 0xeb1634bc),
+     TOBN(0x60f8690d, 0xa3f61fa2), TOBN(0x58a02566, 0xb863c790),
+     TOBN(0xf9b90a9e, 0x5c6b2929), TOBN(0xd552e84c, 0x22fca36e),
+     TOBN(0x6b23da4f, 0x9eabcb58), TOBN(0x01111d07, 0x5d4136dc),
+     TOBN(0xfaa80059, 0xb3642a09), TOBN(0x1de667f4, 0x5f49d533),
+     TOBN(0xb3268776, 0x17525176), TOBN(0x75b0b102, 0xda729fde),
+     TOBN(0x4ec7f678, 0x6e9fe6ed), TOBN(0x28d29578, 0x2717f8b0),
+     TOBN(0x6a713c37, 0xd4cc149f), TOBN(0x4804e04f, 0x7dfdf8c6),
+     TOBN(0xe7c6daab, 0x5c931aa6), TOBN(0x793e411d, 0xa0394f29),
+     TOBN(0xc0741c0d, 0x79ed9819), TOBN(0x3f2ba70b, 0x24d5d992),
+     TOBN(0xa61dc03f, 0xca9c987a), TOBN(0x78201cb8, 0xe64b50c1),
+     TOBN(0x45a23c25, 0x1861f4e4), TOBN(0x10f19f4f, 0xc4ee5d82),
+     TOBN(0xf1520547, 0xf3f055f4), TOBN(0x69ae26b3, 0x006ccf49),
+     TOBN(0xe96eec0b, 0x33d8d4ad), TOBN(0x00765f0c, 0x48a4fc2c),
+     TOBN(0xad47e14e, 0xa3976c07), TOBN(0x82b1f882, 0xd905b6b4),
+     TOBN(0x7a1b9d73, 0x91382bac), TOBN(0xcc84a820, 0x18178290),
+     TOBN(0x1123c6f6, 0xb4e845ab), TOBN(0x63216635, 0xb92e3b08),
+     TOBN(0x748be745, 0x183879fb), TOBN(0x7f20e1f0, 0xa73e9ada),
+     TOBN(0x05de3e11, 0x9224c152), TOBN(0x2fa9a474, 0xea8fda4e),
+     TOBN(0xf5c8df05, 0xf48055ec), TOBN(0x48bbf43a, 0x9e23a599),
+     TOBN(0xf593f034, 0x148086db), TOBN(0x0173a87a, 0xef0a2b62),
+     TOBN(0x90ef0132, 0x3fbabb6f), TOBN(0x56ced09a, 0x21ade107),
+     TOBN(0xcf1ce892, 0x73f1d3e0), TOBN(0x765236c6, 0x22424580),
+     TOBN(0x0d223937, 0xd939d063), TOBN(0x9a21beda, 0x7cb2fe2f),
+     TOBN(0xa559a571, 0x1ce3a7fc), TOBN(0x7fd6b255, 0x1b060dd5),
+     TOBN(0x4dfbd210, 0xc5afdf1a), TOBN(0xa74751ce, 0x1239368a),
+     TOBN(0x93acdd06, 0x6d9a3eec), TOBN(0x7d97f794, 0x9832dcfd),
+     TOBN(0xdafa9a44, 0x0cc645ca), TOBN(0x1da27ddf, 0xcfee0817),
+     TOBN(0x0c1e6319, 0x01b8dd49), TOBN(0x8267e508, 0xd91aeace),
+     TOBN(0x86a2cedc, 0x87f43f20), TOBN(0x7dd0e670, 0x07db2f24),
+     TOBN(0x8ea1e973, 0x9db25177), TOBN(0x659cccb8, 0xab8802df),
+     TOBN(0x2bd39c65, 0x004940ab), TOBN(0x57676876, 0xd9419db5),
+     TOBN(0xd52058a3, 0x6d6f237c), TOBN(0xd9812dcd, 0xfb4a9a7b),
+     TOBN(0x879890d1, 0x53bec56e), TOBN(0x17b7f151, 0x7ac5d9d9),
+     TOBN(0x2db3f5df, 0x1ec6db6c), TOBN(0xe9a3b18f, 0xafdf29b0),
+     TOBN(0xda633d62, 0xe63a9ae9), TOBN(0x0922b16d, 0x38d13c8c),
+     TOBN(0xaeb7e270, 0x7462c8e6), TOBN(0xa98c96d8, 0xa01b6984),
+     TOBN(0x5586e0d3, 0x297c242f), TOBN(0xbeddd1ab, 0xff587596),
+     TOBN(0x79ac33ce, 0xc02ea084), TOBN(0xe7d06753, 0x8e02ae2f),
+     TOBN(0x05fffd7d, 0x94d526b8), TOBN(0x4590d655, 0x5ebc46d0),
+     TOBN(0xfb79c066, 0x855f85e6), TOBN(0xbb3f0a6d, 0x7400ed08),
+     TOBN(0x46f4c3cd, 0x67fb3683), TOBN(0x62fc1931, 0xd19804cf),
+     TOBN(0x0480e772, 0xd1b6f356), TOBN(0xa5810f25, 0x56320242),
+     TOBN(0x6cf6c9c3, 0x64073c03), TOBN(0x7dfe137b, 0x46a6bfbc),
+     TOBN(0xa5633fa0, 0xba59baf8), TOBN(0xb703e5db, 0x5fd4929a),
+     TOBN(0x09eef835, 0xd7515518), TOBN(0x2e596aa8, 0xa0e3b067),
+     TOBN(0x793831fc, 0x8649bb99), TOBN(0x91cb0057, 0x5ba4c1b6),
+     TOBN(0x44e93dbd, 0x270ec9e8), TOBN(0xbf2ed01a, 0xd139d219),
+     TOBN(0x39697e05, 0xc9d68198), TOBN(0xf04439cf, 0xde2b6894),
+     TOBN(0x65b7a04a, 0x1e6b8e6d), TOBN(0xce3e9425, 0xce35ae6d),
+     TOBN(0x041e0aff, 0x9f102fb3), TOBN(0x91b3a87c, 0x106ae748),
+     TOBN(0xfd969804, 0xc426fa5d), TOBN(0xe624f1cd, 0x28f95b76),
+     TOBN(0x6fe28cce, 0x34f2ea56), TOBN(0xdea55947, 0xd230f37c),
+     TOBN(0xd5e336f2, 0xf92f2742), TOBN(0x86852e3c, 0x1899c751),
+     TOBN(0x5ef2a63b, 0xa5d1bd04), TOBN(0x5f4721a2, 0xb6ca2b79),
+     TOBN(0xbdb27b7c, 0x9f484f78), TOBN(0x2b07bf5b, 0xb085b4ed),
+     TOBN(0x96b8ae73, 0x501b62ab), TOBN(0x0b1e003a, 0x3ba64e23),
+     TOBN(0x43f9ec00, 0x93024347), TOBN(0x3c8c0c7e, 0xae180a03),
+     TOBN(0x58c72237, 0x8c0b21d4), TOBN(0x9d51a996, 0x2b15a1fa),
+     TOBN(0xf5201743, 0xec755eda), TOBN(0x0c845fa3, 0x933800fb),
+     TOBN(0xb6b66cdb, 0x0e82418e), TOBN(0x875258e5, 0x3ae3eeb7),
+     TOBN(0xf2c30b1e, 0x1a8f2b3e), TOBN(0xa10b3843, 0x250f3328),
+     TOBN(0x9f449967, 0xc47c53f8), TOBN(0x5dfe8c76, 0x8775e16e),
+     TOBN(0xb02813a1, 0x336f2194), TOBN(0x90ad3ad5, 0x5636498b),
+     TOBN(0x095acf96, 0xc7c647e0), TOBN(0xc90ef12b, 0x1f57c069),
+     TOBN(0x52f51878, 0x1fb85cc1), TOBN(0x582cfd67, 0x25a125ad),
+     TOBN(0x53b4bfc7, 0x0d43ffad), TOBN(0x143b0b48, 0x04dcf047),
+     TOBN(0x65d16216, 0xd4500bf4), TOBN(0x960c7910, 0x9ab1e4cd),
+     TOBN(0x38b7ef7e, 0xe1d08c70), TOBN(0x64ae69e1, 0x9806e01e),
+     TOBN(0x07468184, 0x6796b923), TOBN(0x6480887a, 0x70af1e64),
+     TOBN(0x4eb2d6fb, 0x02384b34), TOBN(0xb29337a8, 0x05be47f3),
+     TOBN(0xfec96fc0, 0x6b744f9d), TOBN(0xc3de2fb0, 0xc8c9afc3),
+     TOBN(0xe8ccc3eb, 0xcc6dd0a5), TOBN(0x0329a9b9, 0x71d7de7a),
+     TOBN(0x459fbc8c, 0xe357c4f9), TOBN(0x80287f50, 0x025fdc97),
+     TOBN(0xedf1b0aa, 0xa089583d), TOBN(0xb1ad1a57, 0xfb08add3),
+     TOBN(0xd6826d03, 0xe1ae76c1), TOBN(0x3070cd2e, 0x541462c8),
+     TOBN(0x7b03c859, 0x83e6f4da), TOBN(0x5b39a809, 0x24bdb487),
+     TOBN(0x70017570, 0x453bebb7), TOBN(0xfe4e6206, 0xb8ebbfc6),
+     TOBN(0xbb8a1899, 0x106defe3), TOBN(0x6f23dc7a, 0x8683287a),
+     TOBN(0x2cf01995, 0x65d96aed), TOBN(0x4e4cf7e9, 0xdda4ea18),
+     TOBN(0x72ad201f, 0xd2d0316b), TOBN(0xd6451150, 0x61de6cd4),
+     TOBN(0x12432dbf, 0xc84856be), TOBN(0xdd4dca98, 0xd2a8378a),
+     TOBN(0xe70af958, 0xbf881f9e), TOBN(0xd4cd35ad, 0xc4e58ec4),
+     TOBN(0x3889d3d9, 0x5a531924), TOBN(0xac657424, 0xb4ce15ec),
+     TOBN(0xdbe384ca, 0xf41e1344), TOBN(0x9a1aed23, 0x5ab8bb08),
+     TOBN(0x375a041f, 0x8561df1d), TOBN(0x19f7a238, 0xb7685c1c),
+     TOBN(0x8ba59933, 0xa4ba6317), TOBN(0x0c44b6df, 0x271f4aa0),
+     TOBN(0x51f4e88f, 0xbd64e922), TOBN(0x7279df94, 0x9095769f),
+     TOBN(0x098c17b6, 0xeaf8c8d3), TOBN(0xe602ff2c, 0x1aa841d1),
+     TOBN(0xbe4e4926, 0x8b63ce81), TOBN(0x85de277a, 0xfcc79573),
+     TOBN(0x38253d40, 0x5b8304db), TOBN(0x58c50c3b, 0xe422af76),
+     TOBN(0x7f7ec0d1, 0xbf95c27a), TOBN(0xcb7c3a8c, 0x6041df33),
+     TOBN(0xc55595c0, 0x35364c89), TOBN(0xd1a72aa7, 0x2a6eb1e6),
+     TOBN(0x1fa941de, 0xdeb98a3d), TOBN(0x1e9607ab, 0xeff46690),
+     TOBN(0x6633e398, 0xad46a05a), TOBN(0xb99e5784, 0xb585e241),
+     TOBN(0xd63106a4, 0xea558424), TOBN(0xf0a5f939, 0x5df0e501),
+     TOBN(0xba17aaef, 0x59dacce3), TOBN(0x03dc5a07, 0xe907c457),
+     TOBN(0xa59f6d63, 0xa9800bc3), TOBN(0x294a3827, 0x364e1ef7),
+     TOBN(0x741bbab9, 0xdd191356), TOBN(0xe8fe9161, 0xc43954a4),
+     TOBN(0x6a711fa9, 0x65341d90), TOBN(0x09bd0faa, 0xadef2d82),
+     TOBN(0x2112f27e, 0x21ffc303), TOBN(0xcd2214dd, 0x395b69e2),
+     TOBN(0xe4b503c9, 0x8670b06f), TOBN(0x219a678a, 0xc4e13ef4),
+     TOBN(0xc4020eff, 0x4a993816), TOBN(0x00a9f5de, 0x1bac14d5),
+     TOBN(0xd00fce1f, 0xeba7c3a4), TOBN(0x2c6d4993, 0x14b537ab),
+     TOBN(0xe9b2b540, 0x6b898739), TOBN(0xae53e6e3, 0x29dbf826),
+     TOBN(0x634606c7, 0xc8438b2c), TOBN(0x268a9ee4, 0xfabfd429),
+     TOBN(0xb0486aae, 0x173b5583), TOBN(0xf88a2f80, 0xbf222673),
+     TOBN(0x49c56f76, 0x0b3178c8), TOBN(0xeab47059, 0xd77d1406),
+     TOBN(0x95035846, 0x993b1a7a), TOBN(0xd6446e94, 0xa9b83efa),
+     TOBN(0x1d1a71ce, 0xc4424fa8), TOBN(0x8d814c4d, 0x3d08b8d2),
+     TOBN(0xbc3ed8d2, 0x7b9374ac), TOBN(0x8dd2d56d, 0x77a3c020),
+     TOBN(0x93ada735, 0x97efca8d), TOBN(0x072bb2d0, 0x37974cd3),
+     TOBN(0xa7c86e7e, 0x7bd74e40), TOBN(0x7bff5613, 0x5b52e0ed),
+     TOBN(0xc8d0bb30, 0x053af1f1), TOBN(0xc5bdb8f9, 0x840bcb7d),
+     TOBN(0xabdf5f73, 0x41690d1c), TOBN(0x0e857a78, 0xf0edac8c),
+     TOBN(0x59f40fcf, 0x8238cfb0), TOBN(0xdcb54f67, 0x511d41d2),
+     TOBN(0x3f036ac8, 0x0e645117), TOBN(0xdc4e833e, 0x7af5fdcc),
+     TOBN(0x67d859b2, 0x3d7bab2c), TOBN(0x92489b23, 0x5f8b32bd)},
+    {TOBN(0xe412aaf7, 0xb9e2f9f8), TOBN(0x0484c1aa, 0x0ff419ac),
+     TOBN(0x9d944989, 0x417bcb90), TOBN(0x2b73dbe3, 0xfe7318ca),
+     TOBN(0xb91b71e5, 0x52dd7b0a), TOBN(0xd61f8eea, 0x3954afeb),
+     TOBN(0xaaeab13c, 0xa07e3958), TOBN(0xde442032, 0x02a1ff49),
+     TOBN(0x8292d96d, 0x0b054a0f), TOBN(0xa978af88, 0x74b9077a),
+     TOBN(0x70bd185b, 0xfff1d49f), TOBN(0xbe6d0844, 0x0279eab1),
+     TOBN(0xa8fffe45, 0xb8ed07e9), TOBN(0x714824a1, 0xcb920e55),
+     TOBN(0xcd5c628a, 0xaf1bb143), TOBN(0xd151afcd, 0x7637dbb7),
+     TOBN(0x83fb0f37, 0x62d7ee7c), TOBN(0x58c2282f, 0x9a3bcb7e),
+     TOBN(0x79f77476, 0xeac2ca5a), TOBN(0x7e80c351, 0x579a262b),
+     TOBN(0x19e67272, 0xedb4f0fc), TOBN(0xe142bb31, 0x1fbbe9fe),
+     TOBN(0x5c7d7cce, 0x95ea6cc1), TOBN(0x6465a380, 0xabfdcf7f),
+     TOBN(0xa433bd2e, 0x5a26a1d4), TOBN(0x1148bb1d, 0xd1c2d78c),
+     TOBN(0x4aae419e, 0x64102515), TOBN(0xd03b9939, 0x66489384),
+     TOBN(0xe21d58b1, 0xd61a9919), TOBN(0x17618c36, 0x4a0ef3d4),
+     TOBN(0x2519020d, 0x6fe8c0dd), TOBN(0x48d837d6, 0x00b87a75),
+     TOBN(0xe6e067ab, 0x426c1aa6), TOBN(0x431579d2, 0xb11d1280),
+     TOBN(0xb926943f, 0x2ead6552), TOBN(0x8fd692bf, 0x057fed1f),
+     TOBN(0xed11c0ed, 0xe9a98fae), TOBN(0xe2bc967a, 0x9bcb2abd),
+     TOBN(0x1b388d66, 0x68729b8e), TOBN(0x2144d67c, 0x6f74563d),
+     TOBN(0xbe519757, 0x03fcd3bf), TOBN(0x3f9dbd8d, 0xc8c7b62f),
+     TOBN(0xce91fce6, 0xfc476e0e), TOBN(0x2f140c73, 0x2715393a),
+     TOBN(0x8a149a94, 0xf11da35b), TOBN(0xf6a2be5e, 0x5367030d),
+     TOBN(0xb68c0d82, 0x0269def3), TOBN(0x32d58819, 0x8eecb775),
+     TOBN(0xccea6f53, 0x32845ab0), TOBN(0x792bc041, 0x2541c834),
+     TOBN(0xd726425f, 0xb1336aa7), TOBN(0x85b1d21e, 0x3ddd6256),
+     TOBN(0xd575bfa8, 0xd9b1ba0b), TOBN(0xd23084e2, 0xb778b77a),
+     TOBN(0xd44e7399, 0x44bb1010), TOBN(0x3d665388, 0xa91623fc),
+     TOBN(0x5cfd3a69, 0x3f11fc00), TOBN(0x1f2b5d01, 0x8bc8eade),
+     TOBN(0x5160359b, 0xa6b9f7ae), TOBN(0x1e2601dc, 0xfa696463),
+     TOBN(0x7f5ac6d2, 0x915f6084), TOBN(0x6e387789, 0x679176d5),
+     TOBN(0x7fb99f4b, 0xae26abee), TOBN(0x4798a2fc, 0xaa409d22),
+     TOBN(0x582164f7, 0x5965615c), TOBN(0x2c9dfb60, 0x0472cbeb),
+     TOBN(0x36eacc3f, 0x2266724f), TOBN(0x253eb08c, 0x5fcb8868),
+     TOBN(0x749a0577, 0x760c15b3), TOBN(0x71e4ce1e, 0x5686b036),
+     TOBN(0x47893a8f, 0xb710196a), TOBN(0xe27dfbac, 0xdf51c4e8),
+     TOBN(0xc9536d6b, 0xffb3df08), TOBN(0xc95169ce, 0x6dde9e09),
+     TOBN(0xcb050de7, 0xcc085766), TOBN(0x92fce77e, 0x0df088dc),
+     TOBN(0x10c124ca, 0x88781592), TOBN(0x6429d30b, 0xc81030f3),
+     TOBN(0x2e37721d, 0x09e20c50), TOBN(0x43e7f9ca, 0xf3e3d604),
+     TOBN(0xa277a87e, 0x5b095e01), TOBN(0x968bc951, 0x83a51a95),
+     TOBN(0x3b375d45, 0x53aff355), TOBN(0xb79d7cce, 0xe1ebac06),
+     TOBN(0xd929e1a6, 0x022995b4), TOBN(0x228cf7f4, 0x28164ff7),
+     TOBN(0x7bd12900, 0x5d3e4608), TOBN(0xc57ac873, 0x2f97ebd8),
+     TOBN(0xc192342d, 0x86b383b5), TOBN(0xe85f303f, 0x706b01d5),
+     TOBN(0x19e19213, 0x88cdcb89), TOBN(0xe88f1943, 0x2ce0de2a),
+     TOBN(0xf6fcf8cf, 0xe453aecc), TOBN(0x0dcd10b8, 0x9a67b49f),
+     TOBN(0xb93d5b4d, 0xafece961), TOBN(0xe232f34a, 0xc39d0b53),
+     TOBN(0x1b8f6cc3, 0x30735384), TOBN(0xc35c5a82, 0xe4f26c08),
+     TOBN(0x9e0c933b, 0xba98f626), TOBN(0x49868100, 0x4c70aed7),
+     TOBN(0x711a3aad, 0xb7f26c66), TOBN(0x786ea28d, 0x7dac506b),
+     TOBN(0xd3a7ab1e, 0x43935657), TOBN(0xda7f5c1f, 0xd1b69e9e),
+     TOBN(0xc08c85e5, 0x0e6c8579), TOBN(0x29d04ad4, 0x8d991759),
+     TOBN(0xbae8f163, 0x3a8ccd69), TOBN(0xade66539, 0x1790a49c),
+     TOBN(0xf9f5bc8c, 0x45915cc1), TOBN(0x63461cf0, 0x4f2b18c3),
+     TOBN(0xceb75a9c, 0xd236e848), TOBN(0xac653e3b, 0x847ce6c2),
+     TOBN(0xb93b3032, 0xdb088764), TOBN(0x567fe1c3, 0xa78e5943),
+     TOBN(0xba7a7acf, 0xe359cb34), TOBN(0x38f4fbfd, 0xe2c3827e),
+     TOBN(0x761c36d4, 0xc90abad2), TOBN(0xac1af4e7, 0x75027c02),
+     TOBN(0x95e6d01c, 0xd4715572), TOBN(0x5b06cf39, 0xd621145d),
+     TOBN(0x799acd7c, 0x64ca2efc), TOBN(0x3397a15b, 0x4e0bcb6c),
+     TOBN(0xb9b10ced, 0x0358a26c), TOBN(0x0a30dbbe, 0x4b8ddfaa),
+     TOBN(0xa70e9712, 0xe20f6fac), TOBN(0x87c7f732, 0xd11451b0),
+     TOBN(0xf0c967b1, 0xd5eece8f), TOBN(0xbc62882a, 0xab370e2d),
+     TOBN(0x134fb08e, 0x59ddb7cb), TOBN(0xe937c663, 0x3ae8f816),
+     TOBN(0x083f73a7, 0x802ed184), TOBN(0xd4badd85, 0x8cd69f8d),
+     TOBN(0x2d8bfaf5, 0x987f389e), TOBN(0x5338c056, 0x4454b1f2),
+     TOBN(0xdce38439, 0x2f104468), TOBN(0xffd94d27, 0x83c5278b),
+     TOBN(0x8740af50, 0x5628ad08), TOBN(0x30a233db, 0x8b1284e8),
+     TOBN(0xb3982d73, 0x57acc8cd), TOBN(0x211d53d3, 0x37c5ff03),
+     TOBN(0xb6371f1b, 0xf6578d40), TOBN(0x7f749bea, 0xa80dec53),
+     TOBN(0xe6b3f730, 0xa9816ec0), TOBN(0xd26832fd, 0xf5423ec6),
+     TOBN(0x80127368, 0x63e27b64), TOBN(0x17b7a4b2, 0xd2d21879),
+     TOBN(0x7dcced37, 0x43cf40d4), TOBN(0x999bbb80, 0x97cf7c4c),
+     TOBN(0x191c84e5, 0x6bafa0b0), TOBN(0x1d08c049, 0x917f6b17),
+     TOBN(0x02e5fe53, 0xf4715c99), TOBN(0xa92c6085, 0x0658f1de),
+     TOBN(0xe9c0ba85, 0x16a010bc), TOBN(0x2fd90fba, 0xea4f3e8e),
+     TOBN(0x8af18371, 0x4570a1e5), TOBN(0xe869e8f7, 0x7cca9004),
+     TOBN(0xe2c8afb7, 0x2dd83019), TOBN(0xb877995d, 0xfd99b386),
+     TOBN(0x1e3efc16, 0xf5adab87), TOBN(0x93105fe4, 0xaa3b191a),
+     TOBN(0x21690dca, 0xae504c31), TOBN(0x2d51ead4, 0x698f629d),
+     TOBN(0x2af3eef1, 0x724c9cbf), TOBN(0xa6181e60, 0x81a0d4aa),
+     TOBN(0x580982c7, 0xa94f6b05), TOBN(0xe8bea903, 0x48653ad7),
+     TOBN(0x0270614c, 0xa608598d), TOBN(0xa7cae0f0, 0x3d0d5360),
+     TOBN(0x81407687, 0x96067f64), TOBN(0xab2c2706, 0x77a62d7d),
+     TOBN(0xbe9c1edf, 0xae19786b), TOBN(0xa313f2b2, 0x887814eb),
+     TOBN(0xe2bc4c1f, 0x08fd3c04), TOBN(0x25387129, 0xe5a9d032),
+     TOBN(0x7b3ced22, 0x8fbc5030), TOBN(0xc22bea3b, 0xadbf1bdc),
+     TOBN(0x4f6b6b6d, 0x7b1308da), TOBN(0x0f2faaaf, 0xd0e33069),
+     TOBN(0xb461990f, 0x0d3677c4), TOBN(0x55c9df43, 0x0e6a876b),
+     TOBN(0x5ce9aaa4, 0x316d252a), TOBN(0x7d98a813, 0x0e8e5097),
+     TOBN(0x047ecd13, 0x9aa3343e), TOBN(0x15cc7072, 0x939277e1),
+     TOBN(0x305165d1, 0x0a020be7), TOBN(0x48560411, 0xf66eaf8b),
+     TOBN(0x5ff898dd, 0xffd2380e), TOBN(0x7da35f08, 0x784b4b11),
+     TOBN(0x50f53e2c, 0x38fd05c7), TOBN(0x64b3ee82, 0x47ada3a5),
+     TOBN(0x672ae316, 0x678995de), TOBN(0x74707460, 0xdfe96605),
+     TOBN(0xb346dc71, 0x441e7150), TOBN(0xd9505e7a, 0x55fd483c),
+     TOBN(0xca96e59f, 0x94302331), TOBN(0xcfde701c, 0x801930cf),
+     TOBN(0x02fc9936, 0x73c31e5d), TOBN(0x4ef53a55, 0x8cda0b51),
+     TOBN(0xa934e268, 0xa269a1f3), TOBN(0x7ba4e5e0, 0x7cca8542),
+     TOBN(0x4c6408f9, 0xa2ae339c), TOBN(0xf9ea4cb2, 0x5a70ba33),
+     TOBN(0x3eaa9364, 0x5cac2af4), TOBN(0x62686d46, 0x95eaea09),
+     TOBN(0x5196e88f, 0x3e771722), TOBN(0x749518e8, 0x7108b198),
+     TOBN(0x394107c4, 0x29b25254), TOBN(0xf9945ac1, 0x3a315aad),
+     TOBN(0xce15c84d, 0xaab9dbe5), TOBN(0xebb54d52, 0x3940eb15),
+     TOBN(0x69b649c7, 0xa2fdd11d), TOBN(0x4e2d1782, 0x3f6ade80),
+     TOBN(0x0f53ac9c, 0x2327f7d8), TOBN(0xf6158d6e, 0xc79eb564),
+     TOBN(0x2903bfc0, 0x4536f5c1), TOBN(0x0a25518b, 0xfb9e9e07),
+     TOBN(0x70cbce8b, 0x62a0b0ed), TOBN(0x92f5dc33, 0x0abbc9be),
+     TOBN(0xbb92b7d3, 0xf369c2d6), TOBN(0x70dd90c8, 0x79ef83e1),
+     TOBN(0xe0b33153, 0x7937ab45), TOBN(0x3a8d1f74, 0xc054af6d),
+     TOBN(0x35cf7380, 0xb05ebfc4), TOBN(0xefb8dac2, 0x58c2cd0c),
+     TOBN(0xe7316f99, 0x7d665d26), TOBN(0x59a7ead9, 0x800fba6f),
+     TOBN(0xfa4d2a2a, 0x08a2cb88), TOBN(0x2e7d3bab, 0xb441995d),
+     TOBN(0x390988c9, 0x93046f2b), TOBN(0xfd95b86e, 0x08869cf5),
+     TOBN(0x0185b6be, 0x9a76537b), TOBN(0xa89563bd, 0xb6cd3d59),
+     TOBN(0xe79a4f63, 0xecb1ad25), TOBN(0x1857cec7, 0x6948504d),
+     TOBN(0x03b7b3ad, 0xa497922f), TOBN(0x9df2f2e4, 0x38930f36),
+     TOBN(0x355e4a7a, 0x4bb5927c), TOBN(0x5ad3fd47, 0x636ec349),
+     TOBN(0x5400730d, 0xc41b19ca), TOBN(0xbfeabac1, 0x555afa93),
+     TOBN(0xb6232083, 0x6cca58b7), TOBN(0x55faae6b, 0x76d0c53e),
+     TOBN(0x64ef60e2, 0x40a8eb5a), TOBN(0xc68bc678, 0xe8f22c94),
+     TOBN(0x5156dc1c, 0x10a0416e), TOBN(0xac779644, 0x5c2037e4),
+     TOBN(0xd2e30925, 0xc7162aaa), TOBN(0x7bb5275f, 0x2cf21e2f),
+     TOBN(0x7722cb40, 0x0c11e65a), TOBN(0xc94a7f52, 0x68ff2be5),
+     TOBN(0x420085cc, 0x8d9f9352), TOBN(0x4addb986, 0xca4b2544),
+     TOBN(0x3c6ceac0, 0x06264a47), TOBN(0xebc01a03, 0xe2b48ccc),
+     TOBN(0xc430e7ab, 0xea94fef2), TOBN(0x973bb6f0, 0xbd94aa8a),
+     TOBN(0xd60e5feb, 0x3225b585), TOBN(0x6cbab39c, 0x01b56ad1),
+     TOBN(0xcb55a9cc, 0x37d6d1b4), TOBN(0xd7288c1e, 0xfbce1d89),
+     TOBN(0xcb516843, 0x162d4b46), TOBN(0xf0aca3a6, 0x15edb910),
+     TOBN(0xdb998b55, 0x08a6685a), TOBN(0x16b442e6, 0x07811873),
+     TOBN(0xa9badd09, 0xa1a7e0c2), TOBN(0x0a9a339b, 0x9f813289),
+     TOBN(0xabf1793f, 0xd4cda45b), TOBN(0xa9830a12, 0xc7378a84),
+     TOBN(0x1ae11c32, 0xd28165b1), TOBN(0xbfd49ace, 0xf71bca14),
+     TOBN(0x9a3990df, 0xfc035476), TOBN(0x0fd2b153, 0x6c32b72a),
+     TOBN(0xceece835, 0x3541b5ae), TOBN(0x2f7429f5, 0x8256c750),
+     TOBN(0x456c3478, 0x88104f8c), TOBN(0x8a435588, 0x8b23da06),
+     TOBN(0x6b6c14f2, 0xd817ce6a), TOBN(0x83bf0acb, 0xf35ab86a),
+     TOBN(0xdadb89ba, 0x364b83fd), TOBN(0x2c8fcf90, 0x5cfecaf3),
+     TOBN(0xa90f77ca, 0x20d12c92), TOBN(0x2e278e0e, 0x69d1739c),
+     TOBN(0x29d24b44, 0x5c1f9e82), TOBN(0xbf4fb4cb, 0x647c59b1),
+     TOBN(0x9c8ea39d, 0x90ffd733), TOBN(0xe37a1352, 0xf14db3fc),
+     TOBN(0x3c9164a2, 0x8f3e1dca), TOBN(0x515c16f2, 0xaec86440),
+     TOBN(0x736fee4c, 0x5c483906), TOBN(0x2325cabb, 0xa3f651c7),
+     TOBN(0x582324df, 0x35b94e45), TOBN(0xeacedb3a, 0x45598c64),
+     TOBN(0x674e1740, 0xde9ea8cd), TOBN(0x30f2f423, 0x89d2b975),
+     TOBN(0x330bd76d, 0x9c8abe45), TOBN(0xb97e89f6, 0x5371c0c4),
+     TOBN(0xb1769248, 0xb7569543), TOBN(0xd29cc9d2, 0xd85f4d72),
+     TOBN(0x89e1fd0c, 0x10a5b6dd), TOBN(0x501be0ae, 0xa693a796),
+     TOBN(0xc70965b6, 0xe490e600), TOBN(0xf518f8af, 0x1bb6c5cd),
+     TOBN(0xf51d40bb, 0x76f6daa2), TOBN(0x83a83b67, 0x5ec7849c),
+     TOBN(0x0fe0d975, 0x6d8aa314), TOBN(0x9bf9aed5, 0xea664a8c),
+     TOBN(0xef8bb989, 0x96fad9aa), TOBN(0xd07dce35, 0x04a0e441),
+     TOBN(0x53bd2a16, 0xb3c5eb81), TOBN(0x49e29fe2, 0xaf178b66),
+     TOBN(0x62cf7a62, 0x24dced32), TOBN(0xcc111fba, 0x0f541e36),
+     TOBN(0xc93cd7c1, 0xda9dd111), TOBN(0x56b625ab, 0x28c9c1b4),
+     TOBN(0xeff436ae, 0x3769f3a2), TOBN(0xa0d8d46b, 0xcbd31a17),
+     TOBN(0x241693fa, 0xc80dc873), TOBN(0x56083f64, 0x3cd579ab),
+     TOBN(0x12ee753b, 0x33fbd431), TOBN(0x1bde60ad, 0xd66c283a),
+     TOBN(0x0db508dd, 0x0243cd83), TOBN(0x3b12c134, 0x1349307c),
+     TOBN(0x8296aa6d, 0x61d86bda), TOBN(0x1d5c8a4f, 0x630adc96),
+     TOBN(0x9d01dc28, 0xa30a8ae6), TOBN(0xc555a743, 0x1dab8168),
+     TOBN(0x61fe0d14, 0x7abe577a), TOBN(0xe26aa4d8, 0xc8c93bb7),
+     TOBN(0xfb4b03bf, 0xda2bab5b), TOBN(0xfbd49089, 0x79b4e6c0),
+     TOBN(0xda1a0108, 0x86806aa4), TOBN(0x281f76ae, 0xdc078112),
+     TOBN(0x9f662594, 0xe0fbd693), TOBN(0x1da897b0, 0x49ec4ee0),
+     TOBN(0x20d52a97, 0xfc7d1578), TOBN(0xdbf8d157, 0x6b1f4ab4),
+     TOBN(0xfc0a5936, 0x3b97d1e3), TOBN(0x00f0f283, 0x1aa091b6),
+     TOBN(0x505e183e, 0x13aadeb0), TOBN(0xe28041ad, 0xa55b3f8a),
+     TOBN(0x2e0f76da, 0x086c2d23), TOBN(0x815b147d, 0xf2c5eceb),
+     TOBN(0x02066c02, 0x673ba5f2), TOBN(0xb85d6a8a, 0xce043d4d),
+     TOBN(0xd5f023a3, 0x113890f6), TOBN(0xaa4f9058, 0xa9d2491b),
+     TOBN(0x6d82393e, 0x16d175a3), TOBN(0x1d1e00b2, 0x671e2aed),
+     TOBN(0xd47c4f28, 0x40018bae), TOBN(0xd08eac83, 0x7b30838f),
+     TOBN(0xa0fde631, 0x5dfe910d), TOBN(0xfc16adf7, 0x5c66d5c6),
+     TOBN(0x0ed2a8a2, 0x18d8c6b1), TOBN(0x67ee6037, 0x632b5b07),
+     TOBN(0x7eed42e5, 0x21a89b8d), TOBN(0xd99942cf, 0x33e6da02),
+     TOBN(0x759ec79e, 0x39971405), TOBN(0x669a92c7, 0x174dca4c),
+     TOBN(0x85935ed7, 0x9d1e7c55), TOBN(0x5f3f9e68, 0xa82055c0),
+     TOBN(0xab0507c8, 0x56aa5af3), TOBN(0x354cac5d, 0x1bd2726f),
+     TOBN(0x46e85e16, 0xb864816f), TOBN(0xef2548f6, 0xd1840add),
+     TOBN(0xe494ea07, 0xc3842f43), TOBN(0xa6169c4a, 0xedf6c13a),
+     TOBN(0x65d9cca3, 0xa460e30b), TOBN(0xa6848e4f, 0x31e7dfc3),
+     TOBN(0x4309f315, 0x5c8109dd), TOBN(0x7a4ec14e, 0xc5799833),
+     TOBN(0xcb768a63, 0xa8132b78), TOBN(0x229106d1, 0xb416c77c),
+     TOBN(0x1ca71df6, 0xded02f41), TOBN(0xb6365d3e, 0xc1a1fc66),
+     TOBN(0xf7c432a1, 0x1431d1fa), TOBN(0x30364500, 0xa5654387),
+     TOBN(0xc9ed0cf8, 0xd5b13b2e), TOBN(0xdbd541bb, 0xd18d5a28),
+     TOBN(0x6b78c887, 0x754de9d2), TOBN(0x7d32fedb, 0x54651568),
+     TOBN(0x7f319680, 0x0d37c339), TOBN(0x22304d1f, 0x37d70b76),
+     TOBN(0x01b2709e, 0x6fb5e555), TOBN(0x978b0d3e, 0xfd5d1708),
+     TOBN(0x83206b9d, 0x96bc118d), TOBN(0xb1a4d7bf, 0xec7bfc1c),
+     TOBN(0x753f98a6, 0xb6b41502), TOBN(0x41139110, 0x4c5187ce),
+     TOBN(0x56e9e218, 0x587a8213), TOBN(0x3b39955b, 0xad9aefd0),
+     TOBN(0x7428b03f, 0xb9947ceb), TOBN(0xbbe82668, 0xbe8bda29),
+     TOBN(0x5142e8ba, 0x5c4b4c63), TOBN(0x90c3e2e3, 0xe92ee291),
+     TOBN(0x6947a55a, 0x8f6a076d), TOBN(0x9acdeec1, 0x61964435),
+     TOBN(0x56bc8e4c, 0x181dac35), TOBN(0x4f4f2c0a, 0x7a824372),
+     TOBN(0xd1958b99, 0xc1033f6b), TOBN(0xeeaa6604, 0xc83ecf98),
+     TOBN(0xe43c0b44, 0xaca52cb3), TOBN(0x12446426, 0x75443f14),
+     TOBN(0x0d14e885, 0xddcc00b4), TOBN(0xb0f5f11d, 0x6cfe5734),
+     TOBN(0x0e160164, 0x1013afcb), TOBN(0x4f570ca9, 0xed9f4535),
+     TOBN(0xe5162a12, 0x73a307ad), TOBN(0x6a431695, 0x3321ae54),
+     TOBN(0xa6c7b0c5, 0x5ae301b4), TOBN(0x6f5d42b1, 0xbd2d3f1d),
+     TOBN(0x4eb12c09, 0x15c0c94b), TOBN(0xf1c40386, 0x28618c41),
+     TOBN(0x30302333, 0xc0f55c25), TOBN(0xa5e41426, 0xbd1c19f0),
+     TOBN(0xd5d4d4d7, 0xcfcc66f8), TOBN(0xcfdf3039, 0x449253c5),
+     TOBN(0x17b0eb72, 0xb30ec0ff), TOBN(0xbce593e2, 0x5e6424f9),
+     TOBN(0xa5d82937, 0x2a73184e), TOBN(0x23d2857a, 0xebe58773),
+     TOBN(0xe3f0f676, 0x067e1eac), TOBN(0x073ded2d, 0x50509d7f),
+     TOBN(0xc22af8f0, 0xca405a7e), TOBN(0x7a4ef592, 0x6df6a46c),
+     TOBN(0xf9cb0178, 0x97067006), TOBN(0x9ae132af, 0x489d2a39),
+     TOBN(0xc7c46b35, 0x6a2da1c1), TOBN(0x0993353b, 0xd95850c9),
+     TOBN(0x6c313a57, 0xa25d52ef), TOBN(0xa6bdb2b2, 0x93c852c3),
+     TOBN(0x27ed916b, 0x7e9e296d), TOBN(0x10b58337, 0xc7aeb09b),
+     TOBN(0x78800c35, 0xecebe36e), TOBN(0xd93e2423, 0x2234ce8a),
+     TOBN(0xe4cf5cee, 0xfa95019f), TOBN(0x21396d37, 0x71e13748),
+     TOBN(0xeb028350, 0x0c32fdad), TOBN(0x31645697, 0x61f1652b),
+     TOBN(0x9e1c6e0b, 0xf6677491), TOBN(0x4d18f2e5, 0x74176c12),
+     TOBN(0x78d559bf, 0x3832d713), TOBN(0x04f0b57b, 0xb6e00e15),
+     TOBN(0xd6c9cb16, 0xe80add3a), TOBN(0xeabfabc5, 0x5c7b1d70),
+     TOBN(0x40570866, 0x98a62cc3), TOBN(0x39ef8ff1, 0x4abb2b1a),
+     TOBN(0xadb40548, 0x0c19959c), TOBN(0xd61632d7, 0x388b1f7c),
+     TOBN(0xd1f9b736, 0xd73b7d50), TOBN(0x652ed78e, 0x560bf0aa),
+     TOBN(0x58e71e33, 0x50e3fc4f), TOBN(0xbfaf5f44, 0x55df1ad1),
+     TOBN(0xefe8893b, 0x9106744f), TOBN(0xabfbd51e, 0x356d1fe9),
+     TOBN(0xab03570b, 0x9eb1cbaf), TOBN(0x92cfe2e4, 0x3919012c),
+     TOBN(0x7671e5fb, 0xb6f7c64d), TOBN(0xf040c039, 0x6e0a44b7),
+     TOBN(0xf430f593, 0x62b36088), TOBN(0xa85b4bc9, 0x94c7c0ac),
+     TOBN(0x07d5c40c, 0x16b54fff), TOBN(0x47aa73ee, 0xc53a3788),
+     TOBN(0xa63c5b36, 0x7000d61e), TOBN(0x04e8f53d, 0x91b9f09f),
+     TOBN(0x7e48021d, 0x87dc6a3d), TOBN(0xa2b5516b, 0x28ae0f74),
+     TOBN(0x84412003, 0x705132e2), TOBN(0xc55f69cf, 0xe243d1fa),
+     TOBN(0x758c0f71, 0x6a8f80bd), TOBN(0x69ecf887, 0xd09b719d),
+     TOBN(0x51b100f0, 0xa9b45194), TOBN(0x1fb9ef66, 0x90ae0769),
+     TOBN(0xfee82fab, 0x30fcdfd2), TOBN(0xf36185be, 0x36a6990b),
+     TOBN(0x88f343f6, 0x3d33027b), TOBN(0xb775dcbb, 0x38ae16c6),
+     TOBN(0xa107b9f0, 0x85a82e45), TOBN(0xaff8b0ae, 0xde6b9806),
+     TOBN(0x3cd3980f, 0x0392fad0), TOBN(0xdd829fc6, 0xf3cf7650),
+     TOBN(0x177190cc, 0x0dc8d031), TOBN(0x3e21cd25, 0x7fc491eb),
+     TOBN(0xea0cc90e, 0x0d929039), TOBN(0x5f7e6292, 0x1dfc37b3),
+     TOBN(0x66dd6dde, 0xe23bdd04), TOBN(0x70e7a317, 0x64fa490a),
+     TOBN(0x59c90f81, 0x10a03dd8), TOBN(0x425ee6ce, 0x96d58314),
+     TOBN(0x868001eb, 0x5f896ed1), TOBN(0xc4c003f5, 0x91dad4fd),
+     TOBN(0xfb4782b2, 0xd9ef80b4), TOBN(0xb9edb975, 0x323e4fc5),
+     TOBN(0xa2ec9b6c, 0x53ef4ccc), TOBN(0x4af8b2ca, 0xa77922b6),
+     TOBN(0x73850e89, 0x6697874b), TOBN(0x76e0fd72, 0x3568523f),
+     TOBN(0x64799f46, 0xe9c400a6), TOBN(0x6c5176e7, 0xa9c245de),
+     TOBN(0xbd97c80c, 0x93503700), TOBN(0xa92d9ee5, 0xffbe539f),
+     TOBN(0x76003d14, 0x8376bb3b), TOBN(0x2e75cc77, 0xac564679),
+     TOBN(0x126af6c7, 0x3a333970), TOBN(0xdbfd0133, 0x6b6604bd),
+     TOBN(0x11cf4c2e, 0x24424a48), TOBN(0x843c73ee, 0x37d4471c),
+     TOBN(0xb3047fc5, 0x617a488b), TOBN(0xf2a91709, 0xe3cf861c),
+     TOBN(0x84444421, 0x1c3a60f7), TOBN(0x74787a36, 0x26679148),
+     TOBN(0x115fbd06, 0x53d9404b), TOBN(0x70fd3365, 0x6244cef0)},
+    {TOBN(0x76695c9b, 0x2b574b7f), TOBN(0xcca80405, 0xc369b6be),
+     TOBN(0x1f4bae99, 0xe3108ded), TOBN(0x9e715ce2, 0xea133fce),
+     TOBN(0x60d52055, 0x54c2ee1c), TOBN(0x56bab301, 0x1680742e),
+     TOBN(0xa409b5f6, 0x3fe438b9), TOBN(0xe3a8e4d0, 0x8036f7ce),
+     TOBN(0xe1d7ec0f, 0x247fdfdf), TOBN(0xfb9d90e7, 0x4a23d1dc),
+     TOBN(0x7012eb2c, 0x190fdc41), TOBN(0x5c2bbff6, 0xddced48c),
+     TOBN(0x8a93426a, 0x68cd7feb), TOBN(0xb5963962, 0x6b4854e1),
+     TOBN(0x8ac72b8e, 0xe772bbd8), TOBN(0xc10d24d2, 0xa6b3040a),
+     TOBN(0x8fdfef16, 0x94d5f347), TOBN(0xf3189490, 0x2b04af0a),
+     TOBN(0x30e3da7a, 0x6d2ca633), TOBN(0x8d002aea, 0x4803814a),
+     TOBN(0xc15e311f, 0x95a0bfe9), TOBN(0x2891ec7e, 0x4b4cc50c),
+     TOBN(0x0936fed8, 0x8834df25), TOBN(0x7e5d7dbf, 0x78e00289),
+     TOBN(0xb9a92d78, 0xfbfcf1b5), TOBN(0x17ce4fab, 0xe8427d74),
+     TOBN(0xbae98ffd, 0xac66e74e), TOBN(0x6d548304, 0x145bb5e5),
+     TOBN(0xbf3dc603, 0x0992abe1), TOBN(0x318cfbda, 0xbefdc5c5),
+     TOBN(0xbb5fa37d, 0x59f8efb8), TOBN(0x347874a0, 0x4ef5bef8),
+     TOBN(0xdf552b01, 0xbf68688b), TOBN(0x2fc542cb, 0x8f96a57a),
+     TOBN(0x5a731b61, 0x4edb340e), TOBN(0x5143d103, 0x181cf578),
+     TOBN(0x749ab511, 0x2cc936b6), TOBN(0xbc94c053, 0x0dd355c2),
+     TOBN(0xa825eff5, 0xa3900fa2), TOBN(0x60a909a3, 0xc1dc2b31),
+     TOBN(0x59b33c78, 0xaf5bcab5), TOBN(0x0053d789, 0x496fbcdf),
+     TOBN(0x5a5afe02, 0xd7883bc1), TOBN(0xec9afe78, 0xfa66951d),
+     TOBN(0x38f28b83, 0x728e56a6), TOBN(0x21d0b6ac, 0x78cafb9d),
+     TOBN(0xd43996bc, 0x7042e327), TOBN(0x60686637, 0x7c31c145),
+     TOBN(0xe1f8d2e6, 0x3d919304), TOBN(0x09cf437c, 0x456be82a),
+     TOBN(0x6a01dae8, 0xf0c21973), TOBN(0x8bffcda8, 0x246d9ef8),
+     TOBN(0x7e03a0d4, 0x5d853975), TOBN(0xc3800ca8, 0x32533ba3),
+     TOBN(0xd77152cc, 0xf02ce43c), TOBN(0xb8bc17a6, 0x6392089a),
+     TOBN(0x6f5fcb61, 0x4b4558fb), TOBN(0x9602597b, 0x1f2545aa),
+     TOBN(0xfd89ab3f, 0xabe5e469), TOBN(0xf1daeea2, 0xfb2e16bc),
+     TOBN(0xe699acd7, 0x3a12940f), TOBN(0x24980f6c, 0x4d7c7311),
+     TOBN(0x4a5cf975, 0x336c8ec6), TOBN(0x8e180e32, 0x8c27d3dc),
+     TOBN(0xafb66269, 0xd36cb503), TOBN(0xe98b07d2, 0x754fdd67),
+     TOBN(0x1e0b425b, 0x5a1fe9bf), TOBN(0xb4ac13e9, 0x24fc4a85),
+     TOBN(0xef693781, 0xc05a9c3f), TOBN(0x266c1216, 0x5c0124dc),
+     TOBN(0x7f3184c4, 0x64ee22e2), TOBN(0x3f985fb3, 0xcdb5f1a9),
+     TOBN(0xb258cd5f, 0xfc01efaa), TOBN(0x861688b1, 0x0775588e),
+     TOBN(0x72184b18, 0xfa46eae0), TOBN(0xd17c9dea, 0x5003404a),
+     TOBN(0xa8791966, 0x92e7bf9e), TOBN(0x049c63cb, 0x7891ac50),
+     TOBN(0x2ed32928, 0x5d46b33d), TOBN(0x49d1bfbf, 0x0623595a),
+     TOBN(0x9f871470, 0x36c8e3e9), TOBN(0xdec7eb98, 0xb20d610d),
+     TOBN(0x15b9326f, 0x7b151f4e), TOBN(0xa624c23e, 0x04005d02),
+     TOBN(0x89fc2a8e, 0xd9cacded), TOBN(0x9eb8defa, 0x9a2c3a00),
+     TOBN(0x7c5dc2d6, 0xe8d7eab7), TOBN(0x48fa5403, 0xeb0a77cf),
+     TOBN(0xcc4c31d0, 0xbf033733), TOBN(0xf37d0072, 0xef211c17),
+     TOBN(0x8967fe49, 0xae35b246), TOBN(0x8c4cbd66, 0x5cb1aa9b),
+     TOBN(0xab0097db, 0x04840da3), TOBN(0x3946faec, 0x5828733e),
+     TOBN(0x96c6531e, 0x87d64045), TOBN(0x893d3780, 0x83bc0d0e),
+     TOBN(0xf833e355, 0x53bec0dc), TOBN(0xc9ff7280, 0x2803a655),
+     TOBN(0x300ff7aa, 0x42b99b53), TOBN(0x3b48a8db, 0x6a7c3f2c),
+     TOBN(0xf78c21d9, 0xf617f8aa), TOBN(0x23684cb7, 0xcbe4d565),
+     TOBN(0xf64ae9c8, 0x7514e9a0), TOBN(0x4ff5483c, 0x8429d8ba),
+     TOBN(0xdedab351, 0x5cb18391), TOBN(0xd3126ffc, 0x769ae948),
+     TOBN(0x6c2f9ba8, 0xd3546ad9), TOBN(0x4567e48a, 0x69aabfb7),
+     TOBN(0x6fbe29b0, 0xaa284747), TOBN(0x3185f0db, 0x98af4f2f),
+     TOBN(0xf2a958a2, 0x5b4c14e3), TOBN(0x106150c5, 0x27d04855),
+     TOBN(0x60a3b4fb, 0x68a19ca9), TOBN(0x65c5719a, 0xfac47c70),
+     TOBN(0xe228e088, 0x973e4cfd), TOBN(0x122a2429, 0xcb63c89f),
+     TOBN(0x39fda97e, 0xbaea08f7), TOBN(0xe7da5324, 0x621c12cb),
+     TOBN(0x569c8a51, 0xff9b3c84), TOBN(0x5ab8bb6d, 0x4c3b8d54),
+     TOBN(0x4f02ece4, 0x00e25a95), TOBN(0xef947402, 0x7ac1732e),
+     TOBN(0xecdb65ac, 0x51149260), TOBN(0x6043aa29, 0xa9180d51),
+     TOBN(0x07fc92bd, 0x852deca0), TOBN(0xf3338297, 0x15237c8d),
+     TOBN(0xecfb0e76, 0xe84b3f38), TOBN(0x21f2f5c5, 0x6b89af17),
+     TOBN(0xf7aec268, 0x9659963f), TOBN(0x67fb5260, 0xa0cb213c),
+     TOBN(0x5daa0fef, 0x66d931b7), TOBN(0x95457a7e, 0x34d309ff),
+     TOBN(0xe7cf1a56, 0xc21285b6), TOBN(0xcbff9b08, 0x244e11b4),
+     TOBN(0xd79ee62d, 0xc0ecce3d), TOBN(0xe3f20739, 0x8267c254),
+     TOBN(0xee06dd39, 0x037ef2d3), TOBN(0x790d1b0f, 0xd522f762),
+     TOBN(0xf0659106, 0xf30c47d0), TOBN(0xcd83214b, 0xb5fdc6b5),
+     TOBN(0xc8621660, 0x6593b717), TOBN(0xb10a6d99, 0xfe3fa381),
+     TOBN(0xa5c3224c, 0xab254244), TOBN(0xd15287e6, 0x5854b18e),
+     TOBN(0x6bf9594c, 0x225806ae), TOBN(0x75a97e21, 0x57e554f2),
+     TOBN(0x0ea199f3, 0x82b00b16), TOBN(0xde81a726, 0x5389c90f),
+     TOBN(0x8503609e, 0x86922afe), TOBN(0x6778ad88, 0x254b75c3),
+     TOBN(0x6bc2ac1b, 0xf3e660ba), TOBN(0x7efc1550, 0x209c04a4),
+     TOBN(0x6e90b6a5, 0x2528ec51), TOBN(0x9196a7c9, 0x0548389e),
+     TOBN(0xf7e285c1, 0x7b5b5dde), TOBN(0x6335a624, 0x223d4837),
+     TOBN(0x8acef5af, 0x412d19c4), TOBN(0xb22808a5, 0x9783256b),
+     TOBN(0x6ea3daaa, 0xf53e4b62), TOBN(0x7ca4c51b, 0xfa7bada4),
+     TOBN(0x3e40461e, 0xe4d3115e), TOBN(0x24889b50, 0x3646fc40),
+     TOBN(0x39e0eb1e, 0xfa26ccf7), TOBN(0xfcad5d47, 0xa82af350),
+     TOBN(0x90037503, 0x4862b1fd), TOBN(0x88e937e8, 0x1a79283c),
+     TOBN(0x16dd07c0, 0x9a0127fb), TOBN(0xac62a168, 0x39fca31a),
+     TOBN(0x26542e2a, 0xa294dac9), TOBN(0xefab45af, 0x2a5dcfe8),
+     TOBN(0x6166857d, 0xe642bbe8), TOBN(0x3f3ad480, 0xff6290a8),
+     TOBN(0x435d4c2b, 0x5f50633f), TOBN(0x36da60a7, 0x84451c8b),
+     TOBN(0x00f5e2e4, 0x261612e4), TOBN(0xe4318273, 0x2d04786a),
+     TOBN(0x192bcda5, 0x2c175edb), TOBN(0x74681e0a, 0x59a6f637),
+     TOBN(0x696df08b, 0x2d244985), TOBN(0xde61a87c, 0xfcf577c6),
+     TOBN(0xcbd2ceab, 0xf2c9de81), TOBN(0x878f06ce, 0xd36162e8),
+     TOBN(0xc4f312e0, 0xb3d22955), TOBN(0x736ed43f, 0xe903efee),
+     TOBN(0x2c687134, 0xca9bf60f), TOBN(0x2473ea8f, 0xbc7da3a5),
+     TOBN(0xf54ef685, 0xb45fb57e), TOBN(0x594e8445, 0x3383cadb),
+     TOBN(0xe1edd3fb, 0x4a7df4bb), TOBN(0xa783d987, 0xc17c2c92),
+     TOBN(0x0d498637, 0xcf8fcba8), TOBN(0xdebd801d, 0x3acd6e4c),
+     TOBN(0x2ade8a7c, 0x34d3761e), TOBN(0xc591c889, 0xd825cd19),
+     TOBN(0x3ffd60ba, 0x39b42dec), TOBN(0x136d4902, 0xfd9674dc),
+     TOBN(0x373a70f8, 0xda4842c4), TOBN(0x3208c485, 0x3f078bfd),
+     TOBN(0x3587f871, 0xef608639), TOBN(0xf990ab0f, 0xf04e46ed),
+     TOBN(0x39d542ab, 0xa83a8450), TOBN(0x634b9198, 0xdacb7c65),
+     TOBN(0x680cef78, 0x82486a05), TOBN(0xab1d4d77, 0x16eaf88b),
+     TOBN(0x5e605279, 0x699c7aa5), TOBN(0x7e37906f, 0x3c40a07f),
+     TOBN(0x4ae84ad8, 0xfb6926e3), TOBN(0x236b5f07, 0xe2ebc73b),
+     TOBN(0xa94e50ab, 0x9e0939a5), TOBN(0xabeed810, 0x2d9e10e2),
+     TOBN(0xea8190fb, 0x4e6423d3), TOBN(0xc739d209, 0x17acb62c),
+     TOBN(0xae38106e, 0x6fdbe8dc), TOBN(0x1c6532d7, 0x63204138),
+     TOBN(0x03af879d, 0xbb7d0510), TOBN(0x1d76faf0, 0x8cd2b1a4),
+     TOBN(0x2fcdaf9b, 0xd77386cc), TOBN(0x30f9f5a4, 0xe32d2633),
+     TOBN(0xa4fc8189, 0x382e7298), TOBN(0x946923a1, 0x588af205),
+     TOBN(0x2c527a79, 0x114f2beb), TOBN(0xa2ca55d3, 0x077762eb),
+     TOBN(0xe4b2eb7c, 0xcc85e41e), TOBN(0x4b5938d2, 0x89346ada),
+     TOBN(0x8e94e741, 0x4c2084cf), TOBN(0x4ef32d29, 0xa839ecb4),
+     TOBN(0xc5371755, 0x802f0897), TOBN(0xb0274ff1, 0xc49ae8a1),
+     TOBN(0xf7716d1c, 0x417bff62), TOBN(0x6efb0748, 0x918f9555),
+     TOBN(0x7d3bb9c8, 0x7aeb1e8d), TOBN(0xee9bd5e1, 0x20d51e18),
+     TOBN(0xfaf0a1a5, 0xd52033b1), TOBN(0x7967d3f4, 0xb8626432),
+     TOBN(0xe837ca4b, 0x5574dc0e), TOBN(0xf7eae237, 0x2c11d8ff),
+     TOBN(0xc0f2f1fa, 0x87dc4007), TOBN(0xf5f1f153, 0x8dfb51f7),
+     TOBN(0xa64b10ae, 0x5bd9ac7f), TOBN(0xb3c2ba37, 0xa2198841),
+     TOBN(0x5a7ebac5, 0x66c1ee7b), TOBN(0x59e06f4c, 0xdba62ea8),
+     TOBN(0xa2ea165e, 0x30944ef3), TOBN(0xfd5c7dfa, 0x3e21385b),
+     TOBN(0x4a012c73, 0xe3bb110d), TOBN(0x16d85219, 0x4fb2fdf3),
+     TOBN(0x1aac7f11, 0x7cad0594), TOBN(0xea7f7dbf, 0x4b098d9f),
+     TOBN(0x88abaa5c, 0x7fd181e7), TOBN(0x136a0c9f, 0xca3ad1eb),
+     TOBN(0xe6e5e6c2, 0xf394aab5), TOBN(0x84d697d4, 0x9349e4a5),
+     TOBN(0x8215578b, 0xf76f4b3b), TOBN(0x81a1cec6, 0x12feeb5f),
+     TOBN(0x5d336eb7, 0x3e876bc3), TOBN(0xe8afdcb5, 0x071892ca),
+     TOBN(0x22f16f6b, 0x3da8d94c), TOBN(0x28b276c5, 0x2d150069),
+     TOBN(0x49d20441, 0x643d3e58), TOBN(0x3450c84a, 0x3da3a7fb),
+     TOBN(0x8f5bf388, 0x442ca3e3), TOBN(0xca31411c, 0x9e615382),
+     TOBN(0xbe63e34d, 0x7798675f), TOBN(0x551eb64d, 0xd1ea01e1),
+     TOBN(0x1738a83b, 0x34a00e27), TOBN(0xe7591d15, 0xbf58ce70),
+     TOBN(0xde2ace5a, 0x57d806d8), TOBN(0xe89e8110, 0xd0338020),
+     TOBN(0x935ed5de, 0x4e25756c), TOBN(0x07ef8c2f, 0x46d0f00b),
+     TOBN(0xa28e5fb4, 0xa659592a), TOBN(0xcb45c622, 0x7fa4986a),
+     TOBN(0x6b7df066, 0x74de493c), TOBN(0x4d6bdaef, 0x79aa5258),
+     TOBN(0xe9709c34, 0xe2b255ed), TOBN(0xdba2653a, 0x7d0e7443),
+     TOBN(0xeb8da5c8, 0xa00eb3e4), TOBN(0xe978228e, 0x7ab0e45c),
+     TOBN(0x3a31bafd, 0x9d551a51), TOBN(0x1de0e9cf, 0x403352f5),
+     TOBN(0xb94d5478, 0x23ddd51c), TOBN(0x7c215c91, 0x130e78e3),
+     TOBN(0x556b92e0, 0xed547bce), TOBN(0x0072da6b, 0x909f5c6f),
+     TOBN(0x4ec71b11, 0xf0dc846b), TOBN(0xd0f3b3b4, 0xbf7baaa1),
+     TOBN(0x896391c5, 0x47770705), TOBN(0x41fe5736, 0x66732587),
+     TOBN(0x02a7e3e3, 0x4acd3c51), TOBN(0x217df736, 0xd30407b3),
+     TOBN(0x503a31ae, 0xe47c33cb), TOBN(0xe3186392, 0x4912bbb0),
+     TOBN(0x2491a08a, 0x75a5df9a), TOBN(0x2882f937, 0xc09294ad),
+     TOBN(0xe2576b69, 0x979ad9f9), TOBN(0xf44ddc15, 0x26dc1ffc),
+     TOBN(0x7dad21d4, 0x968268ae), TOBN(0x07378e90, 0xbe9c6fc0),
+     TOBN(0x9406a872, 0x2b329579), TOBN(0xb27b5c51, 0x761f10ae),
+     TOBN(0xf5dad2f9, 0xd04cf60b), TOBN(0x3154dff5, 0xdf950997),
+     TOBN(0xaaec9d30, 0xd8534a9a), TOBN(0x4ac722f5, 0xac43f212),
+     TOBN(0x722882f4, 0x46464c70), TOBN(0x9b9b5226, 0x6c3c702e),
+     TOBN(0x4e3974bb, 0x8325964e), TOBN(0xd3ceff9d, 0xaa0c5227),
+     TOBN(0xd530c8f9, 0x9534dba5), TOBN(0xd26e547b, 0xbc751878),
+     TOBN(0x184a3527, 0xea79b19a), TOBN(0x8dab9214, 0x74f1cdc4),
+     TOBN(0x708abc8c, 0xc051e9f6), TOBN(0x75194e9f, 0x4be2d9ca),
+     TOBN(0x031d69c1, 0xd6ab5348), TOBN(0x1785990e, 0x78b0e490),
+     TOBN(0xd825f125, 0xf6c41f8e), TOBN(0x429924ea, 0x0fbf2fe6),
+     TOBN(0x53c044be, 0xfb87161e), TOBN(0xa3bbdf1b, 0x0651d153),
+     TOBN(0xda660697, 0xec6ecb9c), TOBN(0x51b4a5fd, 0xddb8c619),
+     TOBN(0x80b87520, 0x230fbffb), TOBN(0xa0587430, 0x8848da9d),
+     TOBN(0x98715939, 0x864c2502), TOBN(0x2b10cbfb, 0xaf973396),
+     TOBN(0x28675184, 0x09572b5f), TOBN(0x0a40cdef, 0x39adf777),
+     TOBN(0x2efa3bb4, 0x3ead6eef), TOBN(0xbd76b425, 0xd1b9fe65),
+     TOBN(0x95f006cd, 0x5e527201), TOBN(0x00890f3b, 0x38a7dc3f),
+     TOBN(0x84ffa014, 0x3a7ce6be), TOBN(0x3406aaa0, 0x89541c2e),
+     TOBN(0x430542b6, 0x9559d989), TOBN(0x9b427b08, 0xb53bddd8),
+     TOBN(0x2182bd91, 0x49639170), TOBN(0xb9fb2b42, 0x3299ae83),
+     TOBN(0xbc993d59, 0x423b7ea2), TOBN(0x03e416ac, 0xc110039e),
+     TOBN(0x90c2269a, 0x3ffe24aa), TOBN(0x421ea02d, 0x1c322c49),
+     TOBN(0x40677b1c, 0x0ef8fa01), TOBN(0xa1acd239, 0xc59407d4),
+     TOBN(0xb8cd4f40, 0x8f14decc), TOBN(0x95e90d87, 0x69e16a6b),
+     TOBN(0x85dcf163, 0xc3c38fd3), TOBN(0xf4fb87ba, 0x0c01f90a),
+     TOBN(0x8274f825, 0xdcd0f994), TOBN(0x4c685fa5, 0x2e6bf7d8),
+     TOBN(0xc87d8847, 0x3d928011), TOBN(0x9add0105, 0xf9efa96a),
+     TOBN(0xed39152b, 0x50db3113), TOBN(0x6b523496, 0xb794e6b4),
+     TOBN(0x6bb241b6, 0x84630b17), TOBN(0x6e9f8ae0, 0x1de3ae08),
+     TOBN(0x97bd7c09, 0xd94ce4fe), TOBN(0xe887b02c, 0x9e61057a),
+     TOBN(0x853e8feb, 0xc62c27fa), TOBN(0x3f9d951a, 0x01600ed6),
+     TOBN(0x3e957b36, 0xb57b9742), TOBN(0x92bfd61e, 0x82b72110),
+     TOBN(0x108b450b, 0xfdce7ec4), TOBN(0xd8af107a, 0xcc29c494),
+     TOBN(0x8d67ff70, 0x47688c92), TOBN(0x57f42933, 0x28b9b681),
+     TOBN(0xbbc98ef3, 0xaaf8a48d), TOBN(0x14113b1a, 0xe2d549b6),
+     TOBN(0x1172b259, 0x0b412b3c), TOBN(0xaf86ca6f, 0x1d42a63e),
+     TOBN(0x5f893135, 0x83660d24), TOBN(0xe7bfe9a8, 0x5a21a441),
+     TOBN(0xecd0aa5b, 0x4ee5122e), TOBN(0xbb68654c, 0x5e4df46e),
+     TOBN(0x0c3e820b, 0x5e243845), TOBN(0x042b1895, 0x5c46bfa5),
+     TOBN(0x791b2085, 0x894f7f16), TOBN(0x42eb80f2, 0xb5c353fb),
+     TOBN(0x377777f7, 0xdf8db0d4), TOBN(0x023c0963, 0x34c42ef2),
+     TOBN(0xba05eb5e, 0xa34cb6d0), TOBN(0xffb8b01e, 0x55cd1242),
+     TOBN(0xeab6ff7d, 0x87cd9f24), TOBN(0x175e94c9, 0xab3c09fc),
+     TOBN(0x6dc68140, 0x7075fd9d), TOBN(0x63851566, 0x4b203c44),
+     TOBN(0x3071e924, 0x871d1be7), TOBN(0xe6285b56, 0x85ee9cd9),
+     TOBN(0x738dd629, 0x4bcf8edc), TOBN(0xf3a36813, 0x4ace75f5),
+     TOBN(0x37a09e34, 0x3cf6feb4), TOBN(0x4c2eaef7, 0x2cd0c8af),
+     TOBN(0xd945a28b, 0x16205f2a), TOBN(0xfe9112a7, 0xabadde7a),
+     TOBN(0x7db6c5ee, 0x2bbf97c2), TOBN(0x3eb84a8f, 0xb5b54833),
+     TOBN(0x9732a49f, 0x273007d9), TOBN(0xe61431c0, 0xc6a2e3ef),
+     TOBN(0x88aa1a06, 0x10a101da), TOBN(0x64b94de3, 0xb972cc61),
+     TOBN(0xe79eb6aa, 0xf8402027), TOBN(0xbb1fa5e3, 0xea6e7157),
+     TOBN(0x457f33a2, 0x4ebdbe4b), TOBN(0xf4e955e0, 0x7a61b393),
+     TOBN(0x578e2e64, 0x698d37cf), TOBN(0xbb139e23, 0x82ecbb69),
+     TOBN(0x268d0291, 0xcfe8d05f), TOBN(0x7dcfef41, 0x625fa854),
+     TOBN(0xe21d5b8f, 0x9c4da5e3), TOBN(0xb5e22209, 0x10bf3df1),
+     TOBN(0xb04dd106, 0x437bf2c6), TOBN(0x807c5d04, 0x1d055404),
+     TOBN(0x6e983206, 0x2c06fd15), TOBN(0x773450af, 0xed63ea25),
+     TOBN(0xc2dae106, 0x95c8dca3), TOBN(0x5323f6ba, 0xd82229e8),
+     TOBN(0x647fabee, 0x57c062bb), TOBN(0xcd6adee7, 0xcd5210ac),
+     TOBN(0x11b4df3b, 0x181f674f), TOBN(0x4e23bf4e, 0xf2a92b48),
+     TOBN(0xeea34e2e, 0x84a83d6f), TOBN(0xeaa09d51, 0x9cb197e5),
+     TOBN(0x7f36a278, 0x845e5008), TOBN(0x41fa9b52, 0x1581c0ab),
+     TOBN(0x58917f67, 0x23d1206a), TOBN(0xc04601ce, 0x11062b8d),
+     TOBN(0xdcc60fb6, 0xf31f7326), TOBN(0xc5aeef46, 0x4b071708),
+     TOBN(0x5364069e, 0xdc6939eb), TOBN(0x44bd15a2, 0x034a1052),
+     TOBN(0x8177eeb1, 0x62a307fe), TOBN(0x451ae4e7, 0x1907ad16),
+     TOBN(0x80e49544, 0x27eb3193), TOBN(0xd788e57a, 0xaf88f4c9),
+     TOBN(0xf062c60f, 0xd944e00a), TOBN(0x504463e6, 0xeb4a609f),
+     TOBN(0x3593ad20, 0x74f13c8b), TOBN(0xdc7c5a35, 0xc50bce88),
+     TOBN(0xa6336115, 0xb657d1f9), TOBN(0x18d14e5d, 0x591425ef),
+     TOBN(0x73896725, 0x1454f76e), TOBN(0x52772de4, 0x425c87a9),
+     TOBN(0xe59e4516, 0xc6efb7d6), TOBN(0xdddb8bf3, 0xd76bbc11),
+     TOBN(0x1acbebd9, 0xc6fd2066), TOBN(0x88c3b525, 0x1d7082ea),
+     TOBN(0x6a3b3d62, 0x6d69cea3), TOBN(0xdbf73dfa, 0x8d065405),
+     TOBN(0xd659c8d6, 0x4a7bd06e), TOBN(0x67867520, 0x7bd10bb0),
+     TOBN(0x7c4e3be5, 0x97838647), TOBN(0x545c7144, 0xc5891864),
+     TOBN(0xf64e1031, 0xfa78d62c), TOBN(0x1f046593, 0xfa71692b),
+     TOBN(0xd35a9cb7, 0x71310c47), TOBN(0x10911b96, 0x0ea84922),
+     TOBN(0x5647310d, 0x93a9f5ac), TOBN(0xa6785861, 0x6c05eedb),
+     TOBN(0x2f5aa7c8, 0x43950b68), TOBN(0x57580907, 0xa9d03b3a),
+     TOBN(0xd581049b, 0x42e15fe3), TOBN(0x55dcf9d2, 0x916c4e88),
+     TOBN(0x87ebfd13, 0x27d1a183), TOBN(0x13aee909, 0xf5aaa51e),
+     TOBN(0xa651959d, 0x3b9fc03e), TOBN(0x05c28772, 0x98997a74),
+     TOBN(0x73e047f4, 0xae2e4a65), TOBN(0x359e6c45, 0x783aa072),
+     TOBN(0x1124e9f0, 0x7a04b710), TOBN(0xd35094de, 0x6d2053f2),
+     TOBN(0x0d57d976, 0x2575dab0), TOBN(0x822256fc, 0x69171229),
+     TOBN(0xbd46937a, 0x3d19de1c), TOBN(0x71feede4, 0x6f0be84d),
+     TOBN(0xca205366, 0x7c4dc4b3), TOBN(0xfbb97d0d, 0xe3e851cb),
+     TOBN(0x0270b5ea, 0x2066e9a4), TOBN(0xeade87ff, 0x42ae150b),
+     TOBN(0x9a7f9e81, 0x8eb1bafa), TOBN(0xcb374aaf, 0x0eb5f68e),
+     TOBN(0xa5841c9a, 0xd5525ab2), TOBN(0x3eed9ba8, 0x03e02cd0),
+     TOBN(0x29449bca, 0x279fca98), TOBN(0x4990ec0f, 0x3f450c92),
+     TOBN(0xa241a8e3, 0xbecbba58), TOBN(0xd0e2487c, 0x2eb47817),
+     TOBN(0x6db7d420, 0x8300837d), TOBN(0x78872895, 0x2d7f59ef),
+     TOBN(0x1b3d5033, 0x1314fc73), TOBN(0x2cf4cd42, 0xe710aded),
+     TOBN(0x9159bc5d, 0x6f4026b7), TOBN(0x403f947b, 0x2e62cc45),
+     TOBN(0x18d6ac70, 0x47d97843), TOBN(0x69d5faaa, 0x0694f7eb),
+     TOBN(0x7711535c, 0x6932e0f0), TOBN(0xc85c9616, 0x6ebd1488),
+     TOBN(0x558e3750, 0xd3542212), TOBN(0x21fe02d7, 0x02921066),
+     TOBN(0x1636a1a2, 0x46b90554), TOBN(0x8acf01ed, 0x0108cc04),
+     TOBN(0x57a2b16a, 0xb4d60d37), TOBN(0x3301a33b, 0x91f4fdb4),
+     TOBN(0x70dc3d3a, 0x8e09b548), TOBN(0x35ae7d07, 0x079c0c2f),
+     TOBN(0x95792f06, 0x978f92cc), TOBN(0xb11574d3, 0x23196752),
+     TOBN(0xc3249711, 0xb8cfcac1), TOBN(0x2061c767, 0xcf93af67),
+     TOBN(0xeff09a1b, 0x2f63dbe7), TOBN(0x527776b6, 0x48091edd),
+     TOBN(0xf0fa985e, 0x19bba5a9), TOBN(0xc54f89f3, 0x66ae3221)},
+    {TOBN(0xbc5a6284, 0x6a436476), TOBN(0x6fcc2313, 0x35dbb9cb),
+     TOBN(0xa77d2d9f, 0x5012ffbf), TOBN(0xcc25e9f4, 0x4ae4bd14),
+     TOBN(0xd17fcfc4, 0x1a5e40c6), TOBN(0x7d716a5f, 0xff085322),
+     TOBN(0x9dcbc50b, 0xee3077c4), TOBN(0xebfe953c, 0xdb4a6e61),
+     TOBN(0xe7e66f2f, 0xd3d777d7), TOBN(0x3519dc64, 0xcf1a6b09),
+     TOBN(0x0df07beb, 0xdbf88dcf), TOBN(0x17b09654, 0xacd4e105),
+     TOBN(0xcbd7acd0, 0x4e70c783), TOBN(0xda66e747, 0x96b9d577),
+     TOBN(0x6d0488a1, 0xe3e52f8a), TOBN(0x3ec0fd11, 0x6ff71c1b),
+     TOBN(0x75474cb6, 0xbe4f2782), TOBN(0x10ef5e6b, 0x41c2c0cd),
+     TOBN(0x592c6b06, 0x6a65e29c), TOBN(0x4d424662, 0xd12d0608),
+     TOBN(0xf5280949, 0xb1a714fe), TOBN(0x52697bcc, 0x1199f802),
+     TOBN(0xc68ba4f8, 0xe6a4ff3a), TOBN(0x25a5380f, 0x351849ce),
+     TOBN(0x33207f69, 0x573ec6f5), TOBN(0x7ecc4bbe, 0x67bd2e8b),
+     TOBN(0xa07acd34, 0x8ffe2420), TOBN(0x0a957eb8, 0xa13f9cdd),
+     TOBN(0x0bc7f95b, 0x9ec9c0c5), TOBN(0xd82147cc, 0x6a8578cd),
+     TOBN(0x07a2e7c5, 0x9e61923c), TOBN(0x591eb066, 0x32e83f25),
+     TOBN(0xaaa61588, 0x957c94fa), TOBN(0x6a2bc707, 0x364911fb),
+     TOBN(0x09771450, 0xc4907b19), TOBN(0x4cc48773, 0x9694ccc4),
+     TOBN(0x9db6216e, 0x50c878ac), TOBN(0x6e89210c, 0x6f3031f1),
+     TOBN(0xb711dcbf, 0xced0d41e), TOBN(0xe39bfe3e, 0x0fbf9751),
+     TOBN(0x18fd7a45, 0x764636b5), TOBN(0xe437ee86, 0xb75d48f3),
+     TOBN(0xe323bb18, 0x60a80177), TOBN(0xedc3c8f3, 0xbc94c0ea),
+     TOBN(0xd8351164, 0xec8cb0cf), TOBN(0xccdd8829, 0x2472936d),
+     TOBN(0xa8db1b85, 0x58059756), TOBN(0x4eda8cf8, 0xd55c184a),
+     TOBN(0xdfb5727d, 0x2923b8cb), TOBN(0x6e793e5c, 0xe6773d5e),
+     TOBN(0x8ecc901b, 0xa0641165), TOBN(0x6077ab26, 0xd6da5095),
+     TOBN(0x00669b0c, 0x6b127d9d), TOBN(0x8140e4e0, 0xd63e2e1f),
+     TOBN(0x1ad5b03c, 0x9641b6a2), TOBN(0x44299f88, 0x9baed7b0),
+     TOBN(0x1736296d, 0x1ea4a056), TOBN(0x6f74702c, 0xd77811ba),
+     TOBN(0x5c927548, 0x432dd74b), TOBN(0x9cc73271, 0xe7a194ab),
+     TOBN(0x0f035ede, 0xd6328dca), TOBN(0x5292aa39, 0x28db755e),
+     TOBN(0xb5488385, 0xa0192a4a), TOBN(0x6e7d2fa8, 0xdfc6895c),
+     TOBN(0xfa912a0a, 0x5d8bbec9), TOBN(0x7051140a, 0x0087edb3),
+     TOBN(0x5293672b, 0x64865e5b), TOBN(0x6e8448c9, 0xc82c48d5),
+     TOBN(0xeece41cb, 0xa2c437b3), TOBN(0x148967d2, 0x21ce1ef4),
+     TOBN(0xf14391fa, 0x6b05c2a5), TOBN(0x15ff5fc9, 0x8fed2f1f),
+     TOBN(0x18ae5e74, 0x4557b49f), TOBN(0xe33760c6, 0x3db266b2),
+     TOBN(0xd5d830c7, 0xb1b249b5), TOBN(0x24c665b9, 0xc5fff531),
+     TOBN(0x6b304406, 0xc57df7c0), TOBN(0x59706667, 0xc3958e89),
+     TOBN(0xbf590ff2, 0x790a5483), TOBN(0xbcaea5a5, 0x5ce77aaa),
+     TOBN(0x8578a002, 0x80ceb559), TOBN(0x3639aadf, 0xd8d61946),
+     TOBN(0x3fd52d94, 0xadd3bb00), TOBN(0x16c27846, 0xe09a8ce3),
+     TOBN(0x75cfd6c6, 0x294c7967), TOBN(0xfb9b7f37, 0x59195034),
+     TOBN(0xae687a99, 0xaa972a86), TOBN(0x04bdefdb, 0xebd2394e),
+     TOBN(0x8e245a19, 0x2f96144d), TOBN(0xc740d348, 0x3b61e5ab),
+     TOBN(0x8703710e, 0x293ddb25), TOBN(0xf4bb6ac0, 0x2bbf8f63),
+     TOBN(0x86396457, 0xde3b5805), TOBN(0x607022db, 0x65d29e63),
+     TOBN(0xad0a0cdc, 0xcc930fe3), TOBN(0xd9997ebb, 0x1626abf6),
+     TOBN(0x2d872d17, 0x2a510565), TOBN(0x3e682079, 0x0357ba07),
+     TOBN(0x49edd962, 0xebfaf203), TOBN(0x3a13edfb, 0xf81eda20),
+     TOBN(0x87b5b5e1, 0x7a75f2d5), TOBN(0xf04de2b8, 0xddfd9511),
+     TOBN(0xf29a1569, 0xcfc5c5ff), TOBN(0xa3995532, 0x07160ed3),
+     TOBN(0xb6247469, 0xcb2b061b), TOBN(0xe75c5351, 0x2f10fe1e),
+     TOBN(0xbaf44963, 0xd20e1bf7), TOBN(0x216cb6ab, 0x2d93babf),
+     TOBN(0x7e0b655c, 0xf5109e45), TOBN(0xdcc712fc, 0x6657450d),
+     TOBN(0xe06c408e, 0xd51fc733), TOBN(0x85b11f96, 0xed9c0912),
+     TOBN(0x954cb91c, 0x37365c9b), TOBN(0xe0eaa047, 0xb2f74fe7),
+     TOBN(0x9af74b86, 0x15716541), TOBN(0x4da06207, 0xf73dc7bd),
+     TOBN(0xdb0d089e, 0xe07890a1), TOBN(0x5bf09681, 0x73902f91),
+     TOBN(0x14e1710c, 0xa897f0fe), TOBN(0x191ec9a1, 0x3605b1c2),
+     TOBN(0x271b2e2a, 0x0133903b), TOBN(0x5b3686f2, 0xe495ee32),
+     TOBN(0x89bcc974, 0x0c991f28), TOBN(0xadd20cce, 0x34f93b8a),
+     TOBN(0x5f5a1768, 0x680b65b6), TOBN(0x0c453ab8, 0xaad41c40),
+     TOBN(0xd479630f, 0xa7fb4269), TOBN(0x60039d01, 0x52c4e929),
+     TOBN(0x0d8d112c, 0xff860883), TOBN(0xe1dce5c9, 0x723c6e29),
+     TOBN(0xc19eadae, 0x191ad70e), TOBN(0x4af8194d, 0x62ce0e64),
+     TOBN(0xf207bfb0, 0xcc81415c), TOBN(0x3ab92f3b, 0x008495c8),
+     TOBN(0xe7250e17, 0xfdb9534b), TOBN(0xba67e9b8, 0x6c0c1d1c),
+     TOBN(0x117ae3ff, 0x072c793f), TOBN(0x5243e6ea, 0x9fb3091e),
+     TOBN(0xf93ad514, 0x31a59e39), TOBN(0x8ce9cfb0, 0xc93c1891),
+     TOBN(0xbfcbf901, 0x1ed08b0e), TOBN(0x4d13cf2a, 0xb53d687d),
+     TOBN(0x25aa82db, 0x5d81e4ad), TOBN(0xd12f01f5, 0x63c3cb41),
+     TOBN(0x1e799084, 0xf8d1333a), TOBN(0x30c96c55, 0x653bcd0a),
+     TOBN(0x9cf130fd, 0x44b5195c), TOBN(0x4cffc531, 0x13c77763),
+     TOBN(0x082287f8, 0x9430619f), TOBN(0x78bb037d, 0xb08ce0d9),
+     TOBN(0x2e69d512, 0x3affe8e8), TOBN(0xe9dbb263, 0xba9ec693),
+     TOBN(0x67b66ad8, 0x62f132b5), TOBN(0x70318d2b, 0xbeb47184),
+     TOBN(0x46c429ea, 0xf50a0e98), TOBN(0xd7e32eba, 0xe2b3542c),
+     TOBN(0x625c1ce9, 0xe096b4b7), TOBN(0x09221351, 0x389fd4dd),
+     TOBN(0x08dc02d2, 0xfb0ee85a), TOBN(0x98c0ba7d, 0x853cd901),
+     TOBN(0x88a0cd6d, 0x0deb1d99), TOBN(0x989e4962, 0x79a6b90c),
+     TOBN(0xf5d19b95, 0x24dd89d5), TOBN(0x189e5230, 0xb37cf19e),
+     TOBN(0x84a607b8, 0xb0c5fefa), TOBN(0xe48450c9, 0xd8c7fbd1),
+     TOBN(0x178f9b56, 0x46479ad7), TOBN(0x7d6a36c6, 0xcbcd2ae5),
+     TOBN(0x95a4d51f, 0x71ae6516), TOBN(0x0363349f, 0x566e2171),
+     TOBN(0x4d4bb4b0, 0xed1f2fc7), TOBN(0xde435aaf, 0xf10fa10c),
+     TOBN(0x711258a9, 0xb76e3b6e), TOBN(0x9a640eeb, 0x2792e0b3),
+     TOBN(0x7953ead8, 0x5fab8617), TOBN(0xd4b6d248, 0xdd64702a),
+     TOBN(0x95bbe528, 0x2d672209), TOBN(0xfcc53cfc, 0xb6926b8a),
+     TOBN(0x05814190, 0x57659f87), TOBN(0x4836e93b, 0x08d25069),
+     TOBN(0xd1eb2006, 0x6a5ad81e), TOBN(0x4bee145a, 0xaf0d37f8),
+     TOBN(0xd44362ad, 0xd31ce6cb), TOBN(0xdc03e581, 0x936c1060),
+     TOBN(0x13cffce9, 0x16fcb889), TOBN(0xed7e6683, 0xac7e709a),
+     TOBN(0xb655d098, 0x5896e541), TOBN(0x07124356, 0xb92a6204),
+     TOBN(0xa2ae43c8, 0xa8f50043), TOBN(0xeb39255c, 0x68731891),
+     TOBN(0xe07be0ad, 0x3d9c408b), TOBN(0x0db7904f, 0x0b4f5c3a),
+     TOBN(0x7ddc0235, 0x4d70bb81), TOBN(0xe3b323c3, 0x5347797a),
+     TOBN(0x3536cd9d, 0x3536deee), TOBN(0x579b6894, 0x001bfd25),
+     TOBN(0x58ad5301, 0xebe2922e), TOBN(0xe0aa2cae, 0x92a88d43),
+     TOBN(0x24567a3b, 0x4409e205), TOBN(0x3cece61a, 0x2258f0cb),
+     TOBN(0x8da5cf46, 0x3babf4f6), TOBN(0xb37428d9, 0x81fff8e6),
+     TOBN(0xcda1ff77, 0x48495d23), TOBN(0x98f9208f, 0x34f392ad),
+     TOBN(0x931f5b37, 0x5bc88514), TOBN(0xd49971be, 0xcb375921),
+     TOBN(0x9dcd4986, 0xb5c01fab), TOBN(0xcc26ec02, 0xc1ab1c94),
+     TOBN(0x34e8087d, 0xb4b874d6), TOBN(0x224fc277, 0x9d0a3761),
+     TOBN(0xacc1f258, 0x3f7e5159), TOBN(0xc82d71ec, 0x8966d593),
+     TOBN(0x5b1f9f40, 0x7dcd691a), TOBN(0xd8fafdae, 0xba28f416),
+     TOBN(0xe8622ae6, 0x43b6d90f), TOBN(0xec13fce7, 0x9ec71d5b),
+     TOBN(0x07b6aeb8, 0xfd2e8214), TOBN(0x813e718e, 0x4cbc297a),
+     TOBN(0xfac0dfab, 0x81fd6931), TOBN(0xa1fe8821, 0x3c48ffd7),
+     TOBN(0xd2715c18, 0x85e03c08), TOBN(0xb6e4418a, 0x977c57f0),
+     TOBN(0xfaa79ea4, 0x73418cde), TOBN(0x6ab8c25b, 0x171e2a89),
+     TOBN(0x2800445c, 0x4ec7cf05), TOBN(0x8e74a7b0, 0xb66c6200),
+     TOBN(0x081b1177, 0x481db950), TOBN(0x526d051c, 0xb89f7c02),
+     TOBN(0x3c830942, 0x5c29c905), TOBN(0xbfbd9e3e, 0x44c15ce5),
+     TOBN(0x6055c949, 0xa29472e6), TOBN(0xab0010c7, 0xa37c4912),
+     TOBN(0xeb8492be, 0x5b7d3647), TOBN(0x0b4cfd7b, 0x1ee31caf),
+     TOBN(0x81cfcde2, 0x4b46304b), TOBN(0x968df75d, 0xc554a5bc),
+     TOBN(0x7ce78806, 0x8d0e043c), TOBN(0x1e896819, 0x345ea27c),
+     TOBN(0xe040c19c, 0x6e287603), TOBN(0xa581856f, 0x138e8ece),
+     TOBN(0xe49f6558, 0xc354a9d6), TOBN(0xc4ad763a, 0xc0cfb2d3),
+     TOBN(0x4be2143b, 0x1b76b8f3), TOBN(0xa8caae14, 0xd0ad0247),
+     TOBN(0xcfe96bd5, 0x928b0ae5), TOBN(0xcf5051f7, 0x7724f8e4),
+     TOBN(0x9128916f, 0xec4af64a), TOBN(0xc211ff4b, 0xcb437bfb),
+     TOBN(0xee6e8134, 0xbce59c0f), TOBN(0x3d068b4c, 0xd59f7f86),
+     TOBN(0xafa2753c, 0x96283457), TOBN(0x453fe33c, 0x1aedcbf0),
+     TOBN(0x781294c8, 0x483c0b1a), TOBN(0x9e6f5133, 0x5c2ad1ee),
+     TOBN(0x2a77b6ce, 0x69383e0b), TOBN(0xcb5a83ab, 0xfa9f0142),
+     TOBN(0x2318aa98, 0x3b0e027f), TOBN(0xdea716a3, 0xc2c68dd5),
+     TOBN(0x3f75c46d, 0x9f548eb3), TOBN(0x71642513, 0x96120de9),
+     TOBN(0xf733614c, 0xdbee488e), TOBN(0xdf940026, 0xaad077f4),
+     TOBN(0xeda9c098, 0x94a840cb), TOBN(0x5108bf0b, 0x393be3b9),
+     TOBN(0x137c08b0, 0x39980cee), TOBN(0x2e31bba0, 0x0839112b),
+     TOBN(0x9ec73de2, 0xba614ea3), TOBN(0xd0bca8d4, 0xd17822c0),
+     TOBN(0x5d9f7482, 0x50b7805d), TOBN(0x16035a80, 0x298becf6),
+     TOBN(0x46571500, 0xd7c318e7), TOBN(0x6bd30919, 0xd0ee6956),
+     TOBN(0x5c0ad747, 0xb2e13320), TOBN(0xe7f7f71e, 0xda47666d),
+     TOBN(0xce322037, 0x318a8e8e), TOBN(0xf15232ae, 0xe9f84dd6),
+     TOBN(0xc59709c5, 0x915a03b7), TOBN(0x2e2000f7, 0x9a3040b4),
+     TOBN(0x41955f77, 0x8398a5a9), TOBN(0xa8e6620e, 0x7086b69e),
+     TOBN(0x63acd70e, 0x8344224b), TOBN(0x966efefc, 0xc3145159),
+     TOBN(0x406619ec, 0xf5e0f955), TOBN(0xedd0efc9, 0xec6de618),
+     TOBN(0x6fe3e34e, 0xb2580ed4), TOBN(0x9d8875b5, 0x4139b95e),
+     TOBN(0x85baf0c1, 0x8e5be187), TOBN(0x549cefca, 0x09553886),
+     TOBN(0xc965b2a2, 0xae9ef2cc), TOBN(0xd43079fb, 0x15afee63),
+     TOBN(0x02b8794a, 0x076cdb05), TOBN(0xd0ae7321, 0xa0d1a953),
+     TOBN(0x5a8b5281, 0x2ac5fff0), TOBN(0x73437d67, 0xcdda362d),
+     TOBN(0x1866b2b9, 0x1a95ff87), TOBN(0x5ff11398, 0x0420b3e1),
+     TOBN(0x0d43b92c, 0x92284adf), TOBN(0x81425367, 0x4da4c4a7),
+     TOBN(0xc8093c56, 0xdf17641a), TOBN(0xc418f19d, 0xb5ccd14d),
+     TOBN(0xaad98608, 0x506762ed), TOBN(0xb6f45297, 0xddb2c829),
+     TOBN(0xd0e49176, 0xd395692a), TOBN(0xc05b4e27, 0x3b1073d3),
+     TOBN(0xe8ca133b, 0xe5808e53), TOBN(0x6105cd0e, 0x06a64b56),
+     TOBN(0x89a64669, 0x53cf6d7e), TOBN(0xe281ca2d, 0x1bebfea5),
+     TOBN(0x98ee67ac, 0x324b25d8), TOBN(0x2227631f, 0xdca154ec),
+     TOBN(0xa242c5a1, 0x4406e8ba), TOBN(0xced39f05, 0x49250026),
+     TOBN(0xd256dd83, 0xdd77d731), TOBN(0x2faa6a0e, 0x7414d0c0),
+     TOBN(0xa2e0f928, 0x3b90f004), TOBN(0x019bb3ef, 0x8719bfd4),
+     TOBN(0x3f4f6109, 0xe2d515c2), TOBN(0xb50a9907, 0xbf88d7a6),
+     TOBN(0x8e5fbc2d, 0x015ac4de), TOBN(0x96992421, 0xe78a2117),
+     TOBN(0x321e6086, 0x26e53df3), TOBN(0x07eb1d15, 0xf42b2508),
+     TOBN(0x7b552108, 0x0ef22bc2), TOBN(0x9eedb828, 0x00f3e571),
+     TOBN(0x556abbaf, 0x6f0e883c), TOBN(0x8025770b, 0x40473ead),
+     TOBN(0x2fdab965, 0x6ece1cc8), TOBN(0xba07cf89, 0x00ec1adc),
+     TOBN(0xefec4deb, 0x4be5ad18), TOBN(0x16625be8, 0xd59fa732),
+     TOBN(0xffee542e, 0x6808cdf7), TOBN(0x85c19ef3, 0xd7a9f29b),
+     TOBN(0xca4ac1f9, 0x82dc1ae3), TOBN(0xa6c726d1, 0xca5e8f58),
+     TOBN(0x0bcc3d58, 0x66960edd), TOBN(0x8e8445d0, 0x56f94ea8),
+     TOBN(0xd4d0177b, 0x938e64c9), TOBN(0x8d0199f1, 0xf9a0288f),
+     TOBN(0x9176d559, 0x14a226c0), TOBN(0x13b373ee, 0xa00aea02),
+     TOBN(0xc63b2d79, 0x6b629fea), TOBN(0x36df7c09, 0xa7e0cc42),
+     TOBN(0x4628ba4f, 0x40bdbc8e), TOBN(0x7f5b0228, 0x0de296f2),
+     TOBN(0xb0598130, 0x3c63d73f), TOBN(0x55e59f61, 0x0431550e),
+     TOBN(0x6f2e109d, 0x6693eb8c), TOBN(0x3602ba82, 0x470b10fe),
+     TOBN(0x3acd0af4, 0x5ec7f357), TOBN(0xfa7479f4, 0xb071c758),
+     TOBN(0xbf47caa0, 0xe13652c9), TOBN(0x6fa139bb, 0xf5f5eca9),
+     TOBN(0xfa149b84, 0x8c0e197e), TOBN(0xca31714c, 0x60ae7755),
+     TOBN(0x934ed1af, 0x8ccc4241), TOBN(0x39772769, 0x781a024e),
+     TOBN(0x9f07dfb1, 0xbe24eb34), TOBN(0xfa8a9c60, 0x0a3dac06),
+     TOBN(0x08fbbe21, 0x8e410ce7), TOBN(0xea55fb96, 0x396a9702),
+     TOBN(0x4422bc58, 0xf18882bb), TOBN(0x1ccb7b47, 0x0ddd0dd7),
+     TOBN(0x828580a8, 0xf40ea941), TOBN(0xf9ec9728, 0x0db78350),
+     TOBN(0x2823b4fd, 0x1612f28a), TOBN(0x96dc3e29, 0x82b26487),
+     TOBN(0x1740fdae, 0x2497420a), TOBN(0x3bb39dfa, 0x322f1c6f),
+     TOBN(0xf32a21e6, 0x4cb19878), TOBN(0xeac04097, 0x9277c80b),
+     TOBN(0x67178d8f, 0x13380801), TOBN(0xfe5e2694, 0x34bf8872),
+     TOBN(0x8278bad4, 0x327129d3), TOBN(0xb42a3f9b, 0x941c4e5c),
+     TOBN(0x04eefb7d, 0x39de36f0), TOBN(0xed2aab7f, 0x8d967703),
+     TOBN(0xa3283a2c, 0x72aa1c89), TOBN(0x1969613e, 0x2a4d513e),
+     TOBN(0x0d4c0347, 0xddd5ea18), TOBN(0xbbad9ce4, 0x43cee5fe),
+     TOBN(0xe8c050a8, 0x57313b49), TOBN(0x3b91c3cc, 0xff09bf31),
+     TOBN(0xe6e5ab6d, 0x610395cb), TOBN(0xfc36cde0, 0xdeb31bef),
+     TOBN(0x76f806f2, 0x5d43c8a7), TOBN(0x08a64cb2, 0x63b7c746),
+     TOBN(0xb6cdcdab, 0x45256a2a), TOBN(0x640f67ea, 0x9bebae90),
+     TOBN(0x682eeeb6, 0xcf016971), TOBN(0x4d16d566, 0x50f59261),
+     TOBN(0xdaca66bb, 0xf41db99d), TOBN(0xccdb3da0, 0xf8f04d96),
+     TOBN(0x7c228cae, 0xcf41b164), TOBN(0x40bef27f, 0xedbefa7c),
+     TOBN(0x4efdd6c2, 0xecb43685), TOBN(0x4d0fa367, 0xa834a50b),
+     TOBN(0x2ec9c445, 0xb87f7ec7), TOBN(0xc3663ced, 0x23170d0f),
+     TOBN(0x189872e4, 0xc5b47b29), TOBN(0xf8047387, 0x746d6a13),
+     TOBN(0x753837d3, 0xb75ac898), TOBN(0xaee88a60, 0x91959a78),
+     TOBN(0xf46b0f6e, 0xe6f59621), TOBN(0x0e92e271, 0x10d981c8),
+     TOBN(0x610d0f80, 0x8d578b6d), TOBN(0x962bd7bb, 0xb4d9b9de),
+     TOBN(0xbe26960d, 0x84a0c394), TOBN(0x142a0c75, 0x3b5bd996),
+     TOBN(0x442bb39a, 0x0be95497), TOBN(0xce5d2c60, 0x0f33c9de),
+     TOBN(0x1ce0d08c, 0x283dc751), TOBN(0x106ed588, 0x79b3c1a8),
+     TOBN(0x4b2e29c6, 0x7f8ee4d7), TOBN(0x7d61e3bb, 0x08bbd660),
+     TOBN(0x11504dc5, 0x1e964a3e), TOBN(0x31544a52, 0xc77a957a),
+     TOBN(0x1fc4161e, 0xcd7d0dac), TOBN(0x83733f27, 0x370c15c9),
+     TOBN(0x224976de, 0x853758cc), TOBN(0x1bbb7730, 0x47c1ab78),
+     TOBN(0x94a3b697, 0x19c89029), TOBN(0x031432f0, 0x37dfc44f),
+     TOBN(0xf84593ac, 0xd88090cb), TOBN(0x381b51bc, 0x65bcfee8),
+     TOBN(0x38dac75b, 0x10b412b7), TOBN(0x6df5c9a1, 0xc7e06d08),
+     TOBN(0x9c6d8068, 0x0e08c41c), TOBN(0x1544e3c5, 0xc3600f4f),
+     TOBN(0xf827a48d, 0x9c83e0a1), TOBN(0xd8539228, 0x06bcb3c4),
+     TOBN(0x149862b3, 0x6268cf12), TOBN(0x4829ee56, 0x6ec4e354),
+     TOBN(0x44b2c3bf, 0xb712a1f9), TOBN(0xe556b78a, 0xc90852af),
+     TOBN(0x50f6de2e, 0x906a13b6), TOBN(0x1744efd5, 0x568a1293),
+     TOBN(0x942ad99e, 0x2b5745a1), TOBN(0x0f100bd9, 0xca362913),
+     TOBN(0xd9b6ad51, 0x91e96cde), TOBN(0x4aa440bc, 0x5a2f88e9),
+     TOBN(0x53c4c956, 0x57a10070), TOBN(0x7d1be72e, 0xae6e4872),
+     TOBN(0xb704009c, 0xd427eda4), TOBN(0x3e0aa93f, 0x5f39b7d8),
+     TOBN(0xdea1ab48, 0x3153a757), TOBN(0x10a070e7, 0x9ee60ead),
+     TOBN(0xd6a6e92d, 0xe6c916bf), TOBN(0x02b1e0e6, 0xbd7bb216),
+     TOBN(0x6efb5f1b, 0xb49138a3), TOBN(0x11f7a9be, 0xe88d2db0),
+     TOBN(0x0b9a2b11, 0x3233df5b), TOBN(0x0688afda, 0x1824fcc5),
+     TOBN(0xcf1ea2a5, 0x5ff97f9a), TOBN(0xe8ad7b15, 0x4998e602),
+     TOBN(0xdb4ae67e, 0xa455aad1), TOBN(0x823ac090, 0x74a27ff3),
+     TOBN(0x5c431060, 0x2573443f), TOBN(0x92f9f9ab, 0x94258714),
+     TOBN(0x1548fe21, 0xb1283d2e), TOBN(0xf86fe50b, 0x5c5be5f9),
+     TOBN(0xd20dfc8a, 0x520c5fc6), TOBN(0x6e721dd9, 0x53b5e7c5),
+     TOBN(0x8ef7eee5, 0x8f2a8969), TOBN(0xe894859f, 0x62d07bdf),
+     TOBN(0xaf279176, 0x1cfc6627), TOBN(0x94b8cff4, 0x483755e9),
+     TOBN(0xa5916f70, 0x0fda4bcb), TOBN(0x9c5318d0, 0x47ba65f3),
+     TOBN(0x9e9c8e54, 0x636cd7e3), TOBN(0x5c64a261, 0x54c49da3),
+     TOBN(0x04d7ff61, 0x690e932c), TOBN(0x92a357b3, 0xc84b0b78),
+     TOBN(0x47f6144c, 0xc6f3bd8d), TOBN(0xdf7b1ee4, 0x71c19265),
+     TOBN(0xa7ea37f1, 0x3fd5c30f), TOBN(0xdc2d890b, 0x79fa08cf),
+     TOBN(0x9813bced, 0x2fd40236), TOBN(0xa8a1055f, 0x432dde17),
+     TOBN(0x70011f47, 0x7772c727), TOBN(0x965c130a, 0x2e2e802f),
+     TOBN(0x31a6aca7, 0xf5bd4ac5), TOBN(0x83995bde, 0xd825db6f),
+     TOBN(0xcbf20325, 0xfe521833), TOBN(0x8dcd25a1, 0x0278f4a0),
+     TOBN(0xf1e83d97, 0x5f2293ea), TOBN(0x1717876b, 0x52317ad3),
+     TOBN(0x0df62167, 0x14181928), TOBN(0x24adfd6e, 0x2fe203ce),
+     TOBN(0x1d264af0, 0x797f25ff), TOBN(0x2cb7cc17, 0xd22e3da1),
+     TOBN(0x10c4b51a, 0xe0016a19), TOBN(0x5956ce8f, 0xd82b2a86),
+     TOBN(0xdef0fefc, 0xa3d4780e), TOBN(0x97e693ab, 0x6e92b93a),
+     TOBN(0x8fa3f4fa, 0x20bcc98f), TOBN(0x4fc004f1, 0xf9182867),
+     TOBN(0x1a206da3, 0x93e73961), TOBN(0x37d75a90, 0x1e7db32c),
+     TOBN(0xa39f0db1, 0x0455b815), TOBN(0x841646e0, 0xb69ee770),
+     TOBN(0xadb0aaaa, 0x0939f065), TOBN(0x5608613b, 0x0b147d7a),
+     TOBN(0x84ce1a4c, 0x470f6875), TOBN(0x501de5fe, 0x7983050e),
+     TOBN(0x19915b26, 0xc3d8ed98), TOBN(0xf451e57a, 0x9a66a6e5),
+     TOBN(0x29843607, 0x30dab6a3), TOBN(0x1710267c, 0x3d1a1ebb),
+     TOBN(0xce4ecfd4, 0xe11d88c0), TOBN(0x12fc2787, 0x11ce026a),
+     TOBN(0x9801cecd, 0x691227de), TOBN(0x517a92f3, 0x76ce6dae)},
+    {TOBN(0x821b0fdf, 0x648c48e5), TOBN(0x689e6d56, 0x9f45a433),
+     TOBN(0xa5a9dca8, 0x2e572855), TOBN(0xb0f07eb7, 0x8adfb547),
+     TOBN(0x48ecb166, 0x552c8d55), TOBN(0xfe3fc268, 0xce854171),
+     TOBN(0x323af5eb, 0xeeee9bc0), TOBN(0x0666a2a3, 0x41ae1c80),
+     TOBN(0xa06d20bc, 0x9ff262fb), TOBN(0xcba032fd, 0xd075868b),
+     TOBN(0x70376026, 0x943fd973), TOBN(0x81c57cba, 0xe35c5e02),
+     TOBN(0x1964e700, 0xba871f1b), TOBN(0xf03a8c04, 0x6b265f57),
+     TOBN(0xc8ebc912, 0x0b950259), TOBN(0xd2b0ee30, 0xad32ca8b),
+     TOBN(0xe01bf0c2, 0x89c8e719), TOBN(0xbce1e20f, 0xb2f4cdb0),
+     TOBN(0x8c38eeaf, 0xa1053ca5), TOBN(0x8c2d85ef, 0x7cd633a5),
+     TOBN(0x75695364, 0x9b53cdb1), TOBN(0x5e999741, 0x447eb1a5),
+     TOBN(0x6d6b2d88, 0xdbd88626), TOBN(0x87eaf045, 0x21876357),
+     TOBN(0x2c88f1ff, 0xdeec441e), TOBN(0xab52096b, 0xd01b2157),
+     TOBN(0x37eee275, 0x6c45cf5c), TOBN(0xa070d24e, 0x0520ecaa),
+     TOBN(0x61d15bd1, 0x546b9fd3), TOBN(0x3276fb74, 0x2c96db1c),
+     TOBN(0xc5c1b041, 0xb95b29b7), TOBN(0xe18008db, 0xbd7d3254),
+     TOBN(0xd56ae44f, 0x98dfb69a), TOBN(0xd5f66b0b, 0x609d941c),
+     TOBN(0xca6b6d35, 0xb91b5245), TOBN(0x98e3a4e3, 0x7b3f98a6),
+     TOBN(0x0715dfa6, 0xf358c56a), TOBN(0x3b02ff21, 0x36a66c64),
+     TOBN(0x737b1401, 0xcb22cbd3), TOBN(0x9dd15f5b, 0x6b8e9624),
+     TOBN(0x25f5a71d, 0xd360d017), TOBN(0x4c0779b5, 0x29b0ed73),
+     TOBN(0xc662fedc, 0x9825a018), TOBN(0xeee89125, 0x61d4add0),
+     TOBN(0x1543814d, 0x92163d14), TOBN(0x79f2376f, 0x27370d3c),
+     TOBN(0xf80c6963, 0xcbe1af7a), TOBN(0xf2d521bc, 0xeb9e41f7),
+     TOBN(0xe241619f, 0xc1805864), TOBN(0x6f1d6166, 0xb2de204a),
+     TOBN(0x13c3f912, 0x50e68d0b), TOBN(0x32eb021d, 0xc4a24f5a),
+     TOBN(0x3f1452f5, 0x0e78c588), TOBN(0xa267bf19, 0xc9971e98),
+     TOBN(0x77a231a7, 0xe801c021), TOBN(0xf363c9b3, 0xc2666e80),
+     TOBN(0xb8eb0bf0, 0xae309a0a), TOBN(0xa9f52f58, 0x375b8fbc),
+     TOBN(0xb8e4f948, 0x1a4993b7), TOBN(0x50ce578e, 0x8f73c292),
+     TOBN(0x2437a4a6, 0x02e503d6), TOBN(0x20cdfc50, 0xe4c68ea3),
+     TOBN(0xfec5993b, 0x3616f348), TOBN(0x5d96b4c5, 0xc0c420df),
+     TOBN(0x6b71cdf0, 0xcca0c48a), TOBN(0x00e71b54, 0xc1aea033),
+     TOBN(0x247f5baa, 0x69f6d107), TOBN(0x4e3ec504, 0x050c3704),
+     TOBN(0xf2b2be8a, 0x7a438e93), TOBN(0x240b632d, 0xa331e01e),
+     TOBN(0x61e66557, 0x91150675), TOBN(0x32364134, 0x95a99a28),
+     TOBN(0x5e5de136, 0xd3399e1e), TOBN(0xe38bab00, 0xfe2f8b75),
+     TOBN(0x736126de, 0x3a77db29), TOBN(0x7b0d1865, 0xf2aa121e),
+     TOBN(0x5545e45e, 0xdecf9cde), TOBN(0x9608ebce, 0x2318be70),
+     TOBN(0xe6596006, 0xfa55b0e5), TOBN(0x0c8c2f41, 0xbc4b6ca0),
+     TOBN(0xda1c5c7a, 0x92025945), TOBN(0xb114ba22, 0x5d3b0775),
+     TOBN(0x11cc6888, 0xcedb69a0), TOBN(0x4365bea8, 0x0f83c772),
+     TOBN(0x006fe80b, 0xbda8dbe3), TOBN(0x334adcb6, 0xc2d3d266),
+     TOBN(0x8c92c084, 0x1521de1c), TOBN(0x57873ef9, 0x78d8f72c),
+     TOBN(0xcfb0a7d0, 0x3b64dcd7), TOBN(0xf4c2f1fc, 0x558c9d55),
+     TOBN(0x110c2db2, 0xa0fbc656), TOBN(0x3cad85ca, 0xef5b6bea),
+     TOBN(0x7099dd0e, 0x4e0b1230), TOBN(0xc769b937, 0x098a2fcd),
+     TOBN(0x9209f550, 0x1e1e7407), TOBN(0x1b47255d, 0x1ba7cb47),
+     TOBN(0xd8aed0cd, 0x2c01b596), TOBN(0x1a1a2e11, 0x30efcda3),
+     TOBN(0xf771f93b, 0x36b1a5b5), TOBN(0x2ea34e3d, 0x14fcd251),
+     TOBN(0x6895cb31, 0xfd893979), TOBN(0x10b1d2c9, 0x14f556b4),
+     TOBN(0x835fdf7e, 0x6430bfa8), TOBN(0x1f4bbef5, 0x24bf4ba5),
+     TOBN(0xbc805aa5, 0xd562b5f1), TOBN(0x7101b9da, 0x35dac658),
+     TOBN(0x5b7f211d, 0xddc28e5a), TOBN(0xea89f24c, 0xd3d1cd0a),
+     TOBN(0xbaaa9ef5, 0x7567c80d), TOBN(0xe0d1f26d, 0x9a60c5ee),
+     TOBN(0xc88a044c, 0xab36cd64), TOBN(0xb8e03d02, 0x1b125de6),
+     TOBN(0xda0c1047, 0x3a707a66), TOBN(0x76ddb98f, 0x0c692d44),
+     TOBN(0xeccae586, 0xb15b7254), TOBN(0xeadc1b51, 0xe7e82423),
+     TOBN(0xd6779ff2, 0x7c3cb698), TOBN(0x0e271cb4, 0xdf6e7da6),
+     TOBN(0xeacf34c3, 0x45900023), TOBN(0xafd017ad, 0x03da2ba5),
+     TOBN(0x49266998, 0x27c7e6eb), TOBN(0x84ffa372, 0x6625bc7f),
+     TOBN(0xedec9247, 0x05c9cb15), TOBN(0xcfad0b90, 0x8075b84e),
+     TOBN(0x94bed316, 0xbc0898d3), TOBN(0x02481eec, 0x11f92525),
+     TOBN(0x19896e1b, 0x0d7e59d7), TOBN(0xa06adb6c, 0xf2bb3129),
+     TOBN(0x1539228e, 0x62a0a690), TOBN(0x98ac50b9, 0x8ae02bda),
+     TOBN(0xaf233c85, 0xe5cf21b9), TOBN(0x943348d3, 0xd6a9f599),
+     TOBN(0xf5a2f2d1, 0xdb363eaa), TOBN(0xe917e2c5, 0x7a8ea96b),
+     TOBN(0xc80b56c8, 0xbf5c8293), TOBN(0xcfc1c24f, 0xcdbb5c4f),
+     TOBN(0x7812dce2, 0xfbddf07b), TOBN(0xd4af2f9b, 0x0186013a),
+     TOBN(0x1fadcd16, 0x6fe8d485), TOBN(0xc3c2cd95, 0xc968f0b7),
+     TOBN(0xdbdd2ef0, 0x778bff58), TOBN(0x67369204, 0x8706da34),
+     TOBN(0x31cf3a66, 0xb8e70e35), TOBN(0x0b9e5cc5, 0xd333801f),
+     TOBN(0x1212a811, 0xf7177c4a), TOBN(0x9e266ec3, 0x2d379e12),
+     TOBN(0xc7382848, 0x2e8bbbf7), TOBN(0x3f3f1dc1, 0xa973be5f),
+     TOBN(0x534d04de, 0x786e727e), TOBN(0xfd7a5fbb, 0x225497dc),
+     TOBN(0x3c03a7fd, 0xb63b6320), TOBN(0xe77f8985, 0x5dc76e05),
+     TOBN(0xe8d14f32, 0x265f8b8f), TOBN(0xfeaab021, 0xb90549c9),
+     TOBN(0x7cd36751, 0x081ccea6), TOBN(0x7a001441, 0x1f1e8f7a),
+     TOBN(0x2e87b8a2, 0x1fdfd622), TOBN(0xe76138ce, 0x8bb4f812),
+     TOBN(0x9a5e8722, 0x71e03be4), TOBN(0x795e60f3, 0x153e0a5f),
+     TOBN(0x11d28438, 0xd0eb7d4c), TOBN(0x147884e1, 0x4254a845),
+     TOBN(0x6795f20f, 0x2a8693fb), TOBN(0x5a10d535, 0xee01bd1a),
+     TOBN(0xe39982c9, 0x218c0513), TOBN(0x6c23e5be, 0x1d4e6ab5),
+     TOBN(0x20a8c27f, 0x0f424e7c), TOBN(0x74ae9998, 0x3bbb486f),
+     TOBN(0x3fae61be, 0xb90ce3a1), TOBN(0xf0f5a1e4, 0x571c968b),
+     TOBN(0x6b9dded8, 0x7780d91b), TOBN(0x10f60ce2, 0x7597e866),
+     TOBN(0xf268ed02, 0xf1eb7d1c), TOBN(0xa49b5a46, 0x6030bf9b),
+     TOBN(0xc939c4e7, 0x251f8676), TOBN(0xbdfe5036, 0xe2b9928f),
+     TOBN(0x5abfbcc2, 0xbccf7f43), TOBN(0xb22067b6, 0x28c560af),
+     TOBN(0xecf07771, 0x04c6a2da), TOBN(0xa2bf88db, 0x8c4ae7dc),
+     TOBN(0x172396f2, 0x616675e8), TOBN(0x9abbb19c, 0x8bfcfbc2),
+     TOBN(0x52e26c06, 0xe85edd21), TOBN(0xfca4c4e0, 0xa65de52f),
+     TOBN(0x255e2d10, 0x281d58be), TOBN(0x93ec2934, 0x3614ed6c),
+     TOBN(0x36d6cc15, 0x6dc71abe), TOBN(0xaa2ad1ef, 0xf592ae78),
+     TOBN(0x39a82740, 0xcc9291fb), TOBN(0x6812b80f, 0x102600d8),
+     TOBN(0x64f4843c, 0x50c511d5), TOBN(0x28f5795e, 0x03445793),
+     TOBN(0x2c566372, 0x29f20b0c), TOBN(0xb168ca7a, 0x9e24474c),
+     TOBN(0xfadd8f80, 0xabe37949), TOBN(0xafa1bea2, 0x4cd69856),
+     TOBN(0x5ce6ed80, 0x46713b88), TOBN(0xaf8b5fb3, 0x4b3bb84d),
+     TOBN(0x134e5120, 0x29d53349), TOBN(0x1214f4f0, 0xcdcedefa),
+     TOBN(0xc346821b, 0x4bb405b9), TOBN(0x753afa86, 0xddd624d6),
+     TOBN(0x15fe543c, 0xc7c014e3), TOBN(0x6b3c0c5d, 0x43d08964),
+     TOBN(0xc77c8fb0, 0x745221aa), TOBN(0x3e144fce, 0x152995c9),
+     TOBN(0x57089907, 0xa61b96bc), TOBN(0xd19a912c, 0x5e05c1ee),
+     TOBN(0x7bcdc697, 0xa6ddd20b), TOBN(0xcb07e229, 0x2d5090f3),
+     TOBN(0x76afc803, 0xf089607e), TOBN(0x9f7a88b9, 0x637dae27),
+     TOBN(0x1352d8bd, 0x3bd20d78), TOBN(0xede1a780, 0x5ea79d4c),
+     TOBN(0x59a8222b, 0xf389e31d), TOBN(0xed066aa6, 0x5c09f3d4),
+     TOBN(0xade16197, 0x684529d3), TOBN(0x97bed904, 0x96a2a159),
+     TOBN(0xdd3da765, 0x1b695d68), TOBN(0xb8fa37e8, 0x02fecb9e),
+     TOBN(0x1af4311c, 0xbc0f7b99), TOBN(0x600bdd46, 0x2a492a7e),
+     TOBN(0x6aa9cb30, 0x45dc9d16), TOBN(0xaa494815, 0xc0b93019),
+     TOBN(0x1211834b, 0xba052dd8), TOBN(0xcdc0208e, 0x86822bf1),
+     TOBN(0x515eebd4, 0x8c8362a0), TOBN(0x9ea7b9f5, 0x9b90cf96),
+     TOBN(0x8418fe34, 0x3a0a5a48), TOBN(0x654d3c32, 0x331a2db1),
+     TOBN(0x22362ddf, 0xafde743c), TOBN(0x617a89e8, 0x6f6ee3ba),
+     TOBN(0xed5f3d04, 0xb7deb988), TOBN(0x31c2c9e6, 0xbbc8a6b2),
+     TOBN(0x8faa80e1, 0x81a3f184), TOBN(0xa7183488, 0x51ecc548),
+     TOBN(0xe67512d0, 0xa3780d0a), TOBN(0x9f868036, 0x822db54d),
+     TOBN(0x6c74490a, 0xe555beab), TOBN(0xe747e666, 0xd989d6be),
+     TOBN(0xf8346dd6, 0xdf8cd308), TOBN(0xe7ca105f, 0x4745cd8e),
+     TOBN(0xee059c58, 0x31055db8), TOBN(0x90f4053a, 0x18b38aa0),
+     TOBN(0xbb2e7fc3, 0x41081a21), TOBN(0x3602525e, 0x45b33a71),
+     TOBN(0xff21f2aa, 0x2b411945), TOBN(0xbeaadbd3, 0x064ccb11),
+     TOBN(0xc35f6950, 0xfe94629d), TOBN(0x1cbaa935, 0x9f860b15),
+     TOBN(0x29b4bcd3, 0xf24f8f15), TOBN(0x0ae5b06a, 0xd29c8458),
+     TOBN(0xa645c31d, 0x1b6c2df1), TOBN(0x640b0990, 0xd804facc),
+     TOBN(0x7a4a7f59, 0x122b33e6), TOBN(0x94bb0b2b, 0x7479b828),
+     TOBN(0x0567272a, 0xc4cd4887), TOBN(0x676d6962, 0xfc8e4b0b),
+     TOBN(0xa712b020, 0x8661c0c2), TOBN(0x660e6aff, 0x279454a7),
+     TOBN(0xe1295106, 0x1cd25bfd), TOBN(0x7096885c, 0x077496a8),
+     TOBN(0xdbc47c92, 0x3006ab7b), TOBN(0x498761fa, 0x509205f3),
+     TOBN(0x5d1eaeca, 0xe85ecfee), TOBN(0x9fcddeed, 0x534f38f5),
+     TOBN(0x4d34ec80, 0x8af32f70), TOBN(0x476dffc9, 0x24b3b4e3),
+     TOBN(0xb45cd869, 0x8bbcda9f), TOBN(0x3b0079e7, 0xdf684c2d),
+     TOBN(0xcaf3eeb5, 0x765cd483), TOBN(0x0b9e25e6, 0x63945b62),
+     TOBN(0xfd73833e, 0x06492e0a), TOBN(0x4d2937e1, 0x9507ea57),
+     TOBN(0x3e532c2e, 0xcf562953), TOBN(0xe4baa2d4, 0x81ca80c3),
+     TOBN(0x4699e5c4, 0x28d22139), TOBN(0x69aab900, 0x6b1c665a),
+     TOBN(0xf6a37330, 0x641016ac), TOBN(0x335f14cb, 0x5f3b7c71),
+     TOBN(0x94a6c868, 0xfacd904f), TOBN(0xb1127cc4, 0x2ec2bf99),
+     TOBN(0x0ccfceb3, 0xa4b72d69), TOBN(0x16b786a3, 0x55172f5b),
+     TOBN(0x51ebe029, 0xe093a729), TOBN(0xf57f4a1e, 0xc40c4487),
+     TOBN(0x8aaf0dd6, 0xa8ed5a3d), TOBN(0x617c51f7, 0x811f35d6),
+     TOBN(0x18c7ac62, 0x11e98d29), TOBN(0x71c578c4, 0x2c904ea8),
+     TOBN(0x4626b0ad, 0x3c4ef8bd), TOBN(0x121eb676, 0xa390be8b),
+     TOBN(0xcb7249f5, 0x154e297d), TOBN(0x678ad966, 0xc2288ba0),
+     TOBN(0x3c2ab066, 0x57cc9cbc), TOBN(0xe32c1d45, 0x80c8fbda),
+     TOBN(0xd2f152cb, 0xf0b35526), TOBN(0xc7f75fd4, 0x13877dfb),
+     TOBN(0x8603feff, 0xe83ca4a2), TOBN(0x6be89bb3, 0xcd680589),
+     TOBN(0x5650549e, 0x45e1f141), TOBN(0x7dab03b8, 0xa55ffadc),
+     TOBN(0x342edda4, 0x2dc5d31f), TOBN(0xa97451ac, 0x9af8105a),
+     TOBN(0x796e1fe3, 0x705b8fd7), TOBN(0x6252a7ba, 0x02d131b8),
+     TOBN(0x3db2ab14, 0x086c3099), TOBN(0xeb763df5, 0x9db0ce72),
+     TOBN(0xe7b57bab, 0x52b62fa5), TOBN(0x6076d449, 0x88b820bd),
+     TOBN(0xc43e1f61, 0x1b660123), TOBN(0xc802d40b, 0x189eace5),
+     TOBN(0x1f2a2a91, 0x341309a1), TOBN(0x8680be67, 0x414db96b),
+     TOBN(0x65dd0396, 0xc846e288), TOBN(0x8a1d871e, 0xb0bbea85),
+     TOBN(0x623e2408, 0x8ff931c6), TOBN(0x4933ffda, 0xe14c5941),
+     TOBN(0x72688986, 0xb2cbff67), TOBN(0xe51504d8, 0x8cf79450),
+     TOBN(0x50cd0a3f, 0xfeba1168), TOBN(0x08d2e0fe, 0xcd833df8),
+     TOBN(0xdbd60827, 0x0a4370ed), TOBN(0x010cf800, 0x66f4f58d),
+     TOBN(0xffa29252, 0x144e9656), TOBN(0x90b896a2, 0x9d1e9d61),
+     TOBN(0x1802257c, 0x81f7b4d3), TOBN(0xd7758e8b, 0x595612a5),
+     TOBN(0x751882d8, 0x241b4dd2), TOBN(0x7dae3003, 0xfe177abe),
+     TOBN(0x8f4d5dc4, 0xee6fe1cd), TOBN(0x93a9cd5b, 0xb08f625d),
+     TOBN(0xa4d6ee1a, 0xf91cc442), TOBN(0xe05976cd, 0x594d172f),
+     TOBN(0xfb4064c6, 0x6e762b2e), TOBN(0xb2068ad9, 0x51a0156d),
+     TOBN(0x0d2d5b26, 0x24f06e82), TOBN(0xad70f276, 0x8c85a9a9),
+     TOBN(0x00ede5d5, 0x0ed413cb), TOBN(0x245be28b, 0x927064d2),
+     TOBN(0x06eb2825, 0x2af70d77), TOBN(0x472af630, 0x52b0592b),
+     TOBN(0x493afd98, 0xd881d50e), TOBN(0x56fa76a8, 0x1189c989),
+     TOBN(0x775665d2, 0xfaa974f7), TOBN(0xe395ccdb, 0xc3f54eff),
+     TOBN(0xf0a40e4e, 0x3fc83a7f), TOBN(0xc3b11d22, 0x4c00087a),
+     TOBN(0xef8d2f06, 0xddb50678), TOBN(0x6e41f315, 0x6cd5f681),
+     TOBN(0x7c9d7a3d, 0xa1b97891), TOBN(0x8b297d75, 0xa0a41260),
+     TOBN(0xca44b65c, 0x3806a30a), TOBN(0x125c5702, 0x61a6206e),
+     TOBN(0x311842a2, 0x87003e1e), TOBN(0xe049a7d0, 0x4513d726),
+     TOBN(0x8022c2d0, 0x7b123469), TOBN(0x76533934, 0x86294393),
+     TOBN(0x6a6e84e7, 0x892e7bc4), TOBN(0x7daf8b11, 0xdb2007fe),
+     TOBN(0x092d1914, 0x923e185c), TOBN(0x5ec11237, 0x3def87c2),
+     TOBN(0x38019e96, 0x18742a51), TOBN(0xe05ea79e, 0x4808ca10),
+     TOBN(0x1fc8ae26, 0x134cbf9b), TOBN(0x14054672, 0x01b4c1c4),
+     TOBN(0x32abf912, 0x64051972), TOBN(0x0edaa925, 0x1af62fca),
+     TOBN(0x58fa82e2, 0x3c47d01a), TOBN(0xdb12a452, 0x780762c6),
+     TOBN(0x16d5a733, 0xfdbf4683), TOBN(0x1d7e8507, 0x2f798deb),
+     TOBN(0x259aa9b9, 0x9eab12f7), TOBN(0xb13e6e41, 0x91261397),
+     TOBN(0x564706fa, 0x32602f2e), TOBN(0x50daef9c, 0x9c2283ef),
+     TOBN(0x9275f219, 0xf07a196e), TOBN(0xfc58ebea, 0xbb8fcd35),
+     TOBN(0x5d1025f1, 0xbad69c11), TOBN(0xcf364154, 0x1605c11b),
+     TOBN(0x427bd117, 0x2992276c), TOBN(0x5545bec5, 0x6a73cbb3),
+     TOBN(0x86855c2f, 0x133f3266), TOBN(0xb3d753d1, 0x67d9e5b2),
+     TOBN(0x2134b384, 0xc9fb343b), TOBN(0xb572f5d6, 0xb0e12b7a),
+     TOBN(0x7ee5852f, 0x392d24fe), TOBN(0x73559fae, 0xc4f285f9),
+     TOBN(0x269cb9e7, 0x7711c525), TOBN(0x4badfc52, 0xf00d5606),
+     TOBN(0xef66d726, 0xb465df15), TOBN(0x83eb59a3, 0xaa4a301b),
+     TOBN(0xdb406469, 0xed329b12), TOBN(0x6eb95cc9, 0xd933eb45),
+     TOBN(0xe2dabfa4, 0x6b638bdd), TOBN(0x7a5d0098, 0x031df114),
+     TOBN(0xe22d8f3e, 0x38dbfaaf), TOBN(0x2306fd54, 0xd79d1ce1),
+     TOBN(0xda324535, 0x7acb7cce), TOBN(0xde6fcc16, 0x88f61a1e),
+     TOBN(0xaf3e4894, 0xb730fe5c), TOBN(0x7a3e4a7d, 0x28adf897),
+     TOBN(0x352c0069, 0xb160ae0e), TOBN(0x225cfb67, 0xee52c58a),
+     TOBN(0x12391b71, 0x96b2505f), TOBN(0x8d811bee, 0x3758141d),
+     TOBN(0xc941524d, 0x8cd82e11), TOBN(0x0feb26a5, 0xbb83a251),
+     TOBN(0x60ad0665, 0x76da8411), TOBN(0xe3c033d9, 0x88d4a968),
+     TOBN(0x767b3c05, 0xde120078), TOBN(0xab7da95a, 0x9f31e1e8),
+     TOBN(0x7ad9b263, 0xb93e7cb7), TOBN(0x280f6bc3, 0xfd626ea3),
+     TOBN(0x746c3945, 0x62713cad), TOBN(0xfa2b4599, 0x3a4edce8),
+     TOBN(0x8792d0cb, 0x10ab7f93), TOBN(0xfa38d031, 0xc25a2a86),
+     TOBN(0x6914db0b, 0x08b028e8), TOBN(0x75a98aa0, 0x383cab40),
+     TOBN(0x462e6b6d, 0x6da884bf), TOBN(0x2b0f682b, 0xd3aa74b1),
+     TOBN(0xb3b7995e, 0x5cee0a83), TOBN(0xe99fca2b, 0x3cce609a),
+     TOBN(0x342c41c9, 0x45451744), TOBN(0xb00d3c24, 0xc81be29f),
+     TOBN(0xd1e64d86, 0x022e8d27), TOBN(0x404550be, 0xbcf67326),
+     TOBN(0xc7c510f0, 0xc8aab829), TOBN(0xb61ae647, 0xa90c605d),
+     TOBN(0x582ad9c9, 0x02db8602), TOBN(0x732b19ed, 0x71cb4397),
+     TOBN(0xea097c35, 0x265e5369), TOBN(0xea7c368f, 0x9d5ea687),
+     TOBN(0x7fc3b213, 0x8fcae7f1), TOBN(0x641daa3f, 0x49c54942),
+     TOBN(0x0696372b, 0x404c39a6), TOBN(0x56815716, 0x87b4b181),
+     TOBN(0xa6e156b3, 0xfca24eb8), TOBN(0xf278eeae, 0xd078a39c),
+     TOBN(0x046566d1, 0xac762dbe), TOBN(0x662ef0f6, 0x625ed2e8),
+     TOBN(0x15499e72, 0x650e4764), TOBN(0x361ccef0, 0x84edf50e),
+     TOBN(0x2441f6f4, 0x1f4a2200), TOBN(0xf36fff06, 0xdb730d58),
+     TOBN(0xcc18624d, 0x3c01edc7), TOBN(0x4889078f, 0x8a77e5bb),
+     TOBN(0x02294e3b, 0x75f8dd8a), TOBN(0x5f6f6057, 0xfc4113c5),
+     TOBN(0xb5300e0d, 0x6f699f18), TOBN(0x52cce358, 0x639dc977),
+     TOBN(0x5dbe59b8, 0x328fd50b), TOBN(0x81500be6, 0x39d73c2f),
+     TOBN(0x409ac4d7, 0x96ae313d), TOBN(0x15205b7b, 0x5b16c316),
+     TOBN(0xe272300c, 0xfc688c09), TOBN(0xb412cf39, 0xbdf71f2d),
+     TOBN(0xe3ab9c44, 0xf85b23d4), TOBN(0x5c14085c, 0x7b662694),
+     TOBN(0x24b0b385, 0x9956d07b), TOBN(0xfa8ea968, 0x30b2c82d),
+     TOBN(0xd443b2aa, 0x6d403b58), TOBN(0x6da53ecb, 0xe7fc8d57),
+     TOBN(0x29655314, 0xdfdf488f), TOBN(0xb418943d, 0xadc57e2b),
+     TOBN(0xbaf090f1, 0x6395a287), TOBN(0x8fdb4fc8, 0xd62f5b38),
+     TOBN(0x115653c0, 0x371c9db1), TOBN(0x6f5e1f39, 0x96463359),
+     TOBN(0x106aaf1e, 0x825e6273), TOBN(0xba22b7db, 0x398cbe1b),
+     TOBN(0x3b545300, 0x62b6bf7e), TOBN(0x495d7d27, 0x5bb6f993),
+     TOBN(0xf558fc5d, 0x3f00290b), TOBN(0xdddbeb3e, 0x2cfc2381),
+     TOBN(0xca402179, 0x65c79326), TOBN(0x376ce4ac, 0x33b1973c),
+     TOBN(0xd6e65ae4, 0x9b30749a), TOBN(0xdf68ee04, 0x5f54bf5a),
+     TOBN(0xa982948d, 0x4cfdb41a), TOBN(0xddd1d3ba, 0xf2a7b4b3),
+     TOBN(0xf52a6b33, 0x581aaba1), TOBN(0xc3258264, 0x894ebf68),
+     TOBN(0x26c32c27, 0x84665ac1), TOBN(0xda0190eb, 0x20119b0e),
+     TOBN(0x4a599db7, 0xb86745c1), TOBN(0xf9570f50, 0x58964b41),
+     TOBN(0xb34d039b, 0xe0648365), TOBN(0x2cd7fde0, 0x5c5f61e1),
+     TOBN(0x76f514a3, 0xbc6b08cc), TOBN(0xc957b50d, 0x18a3cabf),
+     TOBN(0x775fc56a, 0x2334cd1f), TOBN(0x7bfe3864, 0x67ec91c6),
+     TOBN(0x99037daa, 0x35ad3a9a), TOBN(0x17ffe391, 0xb7ca5657),
+     TOBN(0x19f6d369, 0xfef04aef), TOBN(0x8030b467, 0xd1876f8c),
+     TOBN(0xa014be02, 0x3cd7878f), TOBN(0x03c22a58, 0x3358c943),
+     TOBN(0x3c77f083, 0x2a257094), TOBN(0x47386957, 0xd962a04f),
+     TOBN(0x768da40c, 0x82da3329), TOBN(0x1507350d, 0x458219cf),
+     TOBN(0xf460aed3, 0x4397ee7c), TOBN(0xf249e4cc, 0x36fbc7fe),
+     TOBN(0xc42d9da8, 0xaab03dfe), TOBN(0xa3d73ce3, 0x435ab9f3),
+     TOBN(0x86dddbc3, 0x3813a3f3), TOBN(0x86d5779a, 0xb79c32a3),
+     TOBN(0x7c3d9aff, 0x028a2c3f), TOBN(0xc687e71b, 0xb1add2bf)},
+    {TOBN(0x4612a562, 0x09b3fed3), TOBN(0xf296c17a, 0x3579966a),
+     TOBN(0xa124a36f, 0x07960971), TOBN(0x6d03b214, 0x380c4a05),
+     TOBN(0xcb0746e2, 0x70f1f268), TOBN(0xcc9b47ff, 0x9341aea4),
+     TOBN(0x1b3662d5, 0x6d2f59cc), TOBN(0xa6c65b2d, 0xd4b1a15d),
+     TOBN(0xf96c113a, 0xcccb0a4b), TOBN(0x24c26bba, 0x3615f016),
+     TOBN(0x52fe115a, 0xeead2f5b), TOBN(0x85623d26, 0x0d7aaabb),
+     TOBN(0x50791fd0, 0x31a2564f), TOBN(0x3659974d, 0xcd0d59a4),
+     TOBN(0x2cffdb74, 0x7a8b7466), TOBN(0xcf6b36e5, 0x514787b0),
+     TOBN(0x8afccd36, 0x4ab1ccd2), TOBN(0x67314635, 0x1c03ab29),
+     TOBN(0x458f36bf, 0xd7ff3a32), TOBN(0x70e9e789, 0xfcf71648),
+     TOBN(0xf3764534, 0xa6e904cf), TOBN(0x2d6130b1, 0xf4bdd378),
+     TOBN(0xc61c98fb, 0x1ca5ce34), TOBN(0xda11f502, 0xa4a684f5),
+     TOBN(0x8d9daa41, 0xb6223f04), TOBN(0x803c9c0e, 0x841c3fab),
+     TOBN(0x60eee3f9, 0xc50b42cf), TOBN(0xaf4a7a5a, 0x77298193),
+     TOBN(0xd379c2e1, 0xbf809ad6), TOBN(0x903ab4b1, 0xf67c0ff2),
+     TOBN(0xc779d7ed, 0x90f8e637), TOBN(0x968b0cc0, 0x2cf3d363),
+     TOBN(0xaadfa857, 0xacf51940), TOBN(0x0c789d1e, 0x50156581),
+     TOBN(0x5e79cef7, 0x62cff8f4), TOBN(0x54cdaba9, 0x65eb0d49),
+     TOBN(0xdf7a5828, 0x3321c57e), TOBN(0x8571e6e2, 0xa21a51a6),
+     TOBN(0x0b9b482b, 0xc3726e69), TOBN(0x3bc201e3, 0x1d92b657),
+     TOBN(0x271c58bb, 0x8a3b4cf8), TOBN(0x269fc422, 0x717eb539),
+     TOBN(0xe82644e9, 0x5b381fe1), TOBN(0x27fb0822, 0xcb62982f),
+     TOBN(0xb0acd51c, 0x5b5ec726), TOBN(0xfd01053d, 0xea4eff73),
+     TOBN(0x465311dd, 0x00b11c80), TOBN(0xe50a8615, 0x2ed8460c),
+     TOBN(0x3eade5eb, 0x7b2243a0), TOBN(0xa59ec933, 0x77424d11),
+     TOBN(0x65a8e1aa, 0xf5c7c3b7), TOBN(0x008399fa, 0x0c1db536),
+     TOBN(0x80b20e97, 0xfb194a74), TOBN(0x2316fb9b, 0x43be90dc),
+     TOBN(0xb2773b23, 0x0da4d913), TOBN(0x945d0671, 0xce973d27),
+     TOBN(0x64ca871c, 0xb79f82af), TOBN(0x31304b02, 0x2dab52f6),
+     TOBN(0x1825ab54, 0x928239a7), TOBN(0x740413b2, 0x8e4ad736),
+     TOBN(0xc5c5d3fa, 0x44071d19), TOBN(0x83e438f1, 0x3f0b2da8),
+     TOBN(0xfd759448, 0xc70a1981), TOBN(0x13e0c7ee, 0x565ebae3),
+     TOBN(0x31b74b0a, 0x26bd7c0a), TOBN(0x66e0e8e8, 0xd280cb56),
+     TOBN(0x086795e6, 0x3d1c83d2), TOBN(0x59e678da, 0x396ecf25),
+     TOBN(0xab3c8d74, 0xf015a36e), TOBN(0x0d19aed3, 0xadc03171),
+     TOBN(0xc83b787f, 0x5a263686), TOBN(0x46b94ad0, 0x9057ed63),
+     TOBN(0xfbf783a7, 0x90979da2), TOBN(0xf04dd6a0, 0xa335c784),
+     TOBN(0x6e3c2554, 0x87d93c4c), TOBN(0xe3e6b289, 0x47994eb3),
+     TOBN(0x473c0684, 0x1b74ba16), TOBN(0x4e959eb4, 0xabe84e1c),
+     TOBN(0xdc3bfd51, 0x7c4a67b7), TOBN(0xb4e3cb85, 0x5095bd6e),
+     TOBN(0x96fc11f0, 0x3229fb05), TOBN(0x598227e4, 0x4b36c83a),
+     TOBN(0xdc69ad06, 0xd46fca66), TOBN(0x14cc98e5, 0x703ad6be),
+     TOBN(0xf0fdd142, 0x6b22cd50), TOBN(0x9b821fe2, 0xf89c1a5d),
+     TOBN(0xa3762dca, 0x829f9a74), TOBN(0xf65a584a, 0xf0c320cc),
+     TOBN(0x58f4eaba, 0x5568f242), TOBN(0x83b0c37b, 0x029afc1f),
+     TOBN(0x93de2d27, 0x994d7dfc), TOBN(0x0d9a6edb, 0xb1679532),
+     TOBN(0x3b834279, 0x95f085b0), TOBN(0x46ebac98, 0xa299355f),
+     TOBN(0x0212e489, 0x044427f8), TOBN(0xf9e4ce34, 0xa2f37d0e),
+     TOBN(0x0fa328d6, 0xfdc9e233), TOBN(0xd5c8afab, 0x51ae732f),
+     TOBN(0x85e59553, 0x83c00cee), TOBN(0x9fce31f9, 0x87505db4),
+     TOBN(0x33ea5eb6, 0x7069d066), TOBN(0x10e32a39, 0xf01c0ce9),
+     TOBN(0xf170233c, 0x0c4f1a2e), TOBN(0x8a907760, 0xbd4cb366),
+     TOBN(0xda593421, 0x79bf05e3), TOBN(0x7730907a, 0xce49a5bd),
+     TOBN(0x0dfb8a97, 0x09be5c7b), TOBN(0x6f50c692, 0x23eb936e),
+     TOBN(0xc6160551, 0xcb18ff1a), TOBN(0xfa1d23fd, 0x661cc384),
+     TOBN(0xfef12307, 0x7ddec262), TOBN(0xd1aca960, 0xb15af580),
+     TOBN(0x7eab8a59, 0x2ee50fbd), TOBN(0xe7f71845, 0xbe1e7a42),
+     TOBN(0x5f46a511, 0x6121e573), TOBN(0xa25dacbf, 0x38ff7eba),
+     TOBN(0xe8aefcc7, 0xf58f047c), TOBN(0xc343aaa7, 0xb538aace),
+     TOBN(0x3e58cdda, 0x3c340b1f), TOBN(0xb0e9867c, 0x1fb98ccb),
+     TOBN(0x034dd314, 0xef7750f0), TOBN(0x2ceaa705, 0x22da84d7),
+     TOBN(0x4561a254, 0xfc0d647b), TOBN(0x81cf0915, 0xbbe01157),
+     TOBN(0x547a3d4e, 0x34b798eb), TOBN(0xbb5dd625, 0x8b1c7544),
+     TOBN(0x94fee01b, 0xc8194168), TOBN(0xdb4c25ff, 0xfaeb010b),
+     TOBN(0x1ff217fa, 0xe4d4a176), TOBN(0x8b46e6c2, 0xaf87f4f5),
+     TOBN(0xcf658775, 0x89734273), TOBN(0x73c4390d, 0x52746de9),
+     TOBN(0xb5c84899, 0xb01c7a06), TOBN(0xfa5ffe4d, 0xedd9ef63),
+     TOBN(0x28a313c5, 0xa1a8b2d4), TOBN(0xadd45f47, 0xdaf5a33f),
+     TOBN(0xc2dc9d13, 0x1fdb8694), TOBN(0xaa5e026c, 0x9a90b4d1),
+     TOBN(0x5edffd39, 0x208cbfa5), TOBN(0xf095b3fb, 0x72a4d6cc),
+     TOBN(0xbfca4e10, 0x6645fcc1), TOBN(0x14b872ac, 0x92408c6a),
+     TOBN(0x3d9261e1, 0xd0b82d2d), TOBN(0x13e4ecb6, 0x0294e75b),
+     TOBN(0xabd4541c, 0x3ac2ab9d), TOBN(0x025355b2, 0x4d5d1531),
+     TOBN(0x3d85f67c, 0xfb726ab8), TOBN(0x56e26c82, 0x6d6fc6bc),
+     TOBN(0xb24608bb, 0x495e05a0), TOBN(0x840e0978, 0xe5afdc5d),
+     TOBN(0x2cc543b5, 0x248727e2), TOBN(0xe48146da, 0x3bc8c021),
+     TOBN(0xa1b36baf, 0x530c98b7), TOBN(0x04503d7b, 0x5acf023b),
+     TOBN(0x96bc4449, 0x21de1503), TOBN(0xbb8a122f, 0xd2a9c89f),
+     TOBN(0x66df99df, 0xd5d4b133), TOBN(0x1bb4a13b, 0xc97d3e52),
+     TOBN(0xdab370f3, 0x79b318d6), TOBN(0xfa6c823e, 0x9f18552e),
+     TOBN(0xe5b27e78, 0x6388a194), TOBN(0x13270523, 0xc88ba441),
+     TOBN(0x9f309fbf, 0x4fecfef5), TOBN(0x72cd374b, 0x10afee60),
+     TOBN(0x16bd0e2e, 0x93dfe3af), TOBN(0x7e92096a, 0x24bc7e8e),
+     TOBN(0x144fdf82, 0xfec7f0bb), TOBN(0x5d1d4598, 0xe1f765f7),
+     TOBN(0xb6b91efc, 0x72c67697), TOBN(0xc7a2ceaf, 0xb2487905),
+     TOBN(0x4a4c9e63, 0x7fb24d99), TOBN(0x7ed373ac, 0x4d742089),
+     TOBN(0x3f9e6ae1, 0x9149ac54), TOBN(0x64fd7fef, 0x0611efc8),
+     TOBN(0x1c38da32, 0x3d779af6), TOBN(0x6893691b, 0x0a1681f5),
+     TOBN(0xbac29978, 0x50a0fa72), TOBN(0x98d5c82e, 0xba55c665),
+     TOBN(0xf3e5b58e, 0x2d4b76bc), TOBN(0xfae27d9a, 0x90615b32),
+     TOBN(0xb93bc327, 0xd49b2500), TOBN(0x7d9d4bff, 0xbbc213cd),
+     TOBN(0xf985fe72, 0xd1ee81c4), TOBN(0x6e2a94d1, 0x381f9e48),
+     TOBN(0x1f09b225, 0x14fb9624), TOBN(0x2eba4ff8, 0xca4229d7),
+     TOBN(0x5b159dd1, 0x21dc8c19), TOBN(0x1e1f968f, 0xb1aa553e),
+     TOBN(0x6ea25976, 0xc7674d52), TOBN(0x98e73adc, 0x7b283501),
+     TOBN(0x7cfce0e1, 0xd39468c2), TOBN(0x7aad0af9, 0x08438a62),
+     TOBN(0x2291cdd0, 0xb2a3dde2), TOBN(0x3a625d50, 0xf77a0aa4),
+     TOBN(0x3be0fba2, 0x5fbc5a0a), TOBN(0x67b7598a, 0xe794bf46),
+     TOBN(0x3673d805, 0x531ad772), TOBN(0xf9a9b392, 0x03e8479f),
+     TOBN(0x142d264c, 0x2e16a126), TOBN(0xc20409ac, 0x5a2f6f2c),
+     TOBN(0xd9d84438, 0xcd43f273), TOBN(0xfecc561d, 0xbda7be72),
+     TOBN(0xc4b113c6, 0x241b7ec2), TOBN(0xfc5bc32b, 0x40dba9e3),
+     TOBN(0x70853d39, 0xd56bca47), TOBN(0x2b9a902d, 0xa5306217),
+     TOBN(0x2bb1836d, 0x2017bfd0), TOBN(0x829ce116, 0xcd1c2768),
+     TOBN(0x42d5fcf8, 0x697097f5), TOBN(0xc1fe7be6, 0x1e936db5),
+     TOBN(0xcbc5cdcc, 0xcb6a81d4), TOBN(0xab1e4ecb, 0xafef5ffa),
+     TOBN(0x3cbbdf76, 0xb933c216), TOBN(0xdb5808da, 0x503607e2),
+     TOBN(0x5bdaab7c, 0x6bc96246), TOBN(0x91e5d17c, 0x68274629),
+     TOBN(0xa3cd09f6, 0x2eb1db21), TOBN(0xbe370485, 0x92c3e3e1),
+     TOBN(0xeb51fa29, 0x6aa43da5), TOBN(0x2c7fa809, 0xd726625e),
+     TOBN(0x90c6786f, 0xf0ec0e99), TOBN(0xd315af33, 0x08135cbf),
+     TOBN(0xc1b60172, 0x1504751b), TOBN(0x88674e2d, 0x0e28781a),
+     TOBN(0x6aa74055, 0xed74e633), TOBN(0xc44e740f, 0x7d06ce02),
+     TOBN(0x8b40bc5e, 0xa33b8d5e), TOBN(0x42d3539f, 0x20f00f14),
+     TOBN(0xd9f1f5cd, 0x3307ef15), TOBN(0xa9fe4dfb, 0xc8599bcc),
+     TOBN(0x31cb6703, 0xefa80b8d), TOBN(0x4172b46d, 0x53bb73fe),
+     TOBN(0x85a70280, 0x20e4c321), TOBN(0x999a0d07, 0x5ac075f3),
+     TOBN(0x59a62b62, 0x7bdb478c), TOBN(0x9aeb710a, 0x573c403b),
+     TOBN(0x1c099614, 0x950bb8fc), TOBN(0xc1efafab, 0x5dc09741),
+     TOBN(0x0de58ca5, 0x7296a74b), TOBN(0x657116a4, 0xf5be2ec4),
+     TOBN(0x0ce52f0f, 0xcb199b77), TOBN(0xdcdc5cb9, 0xbcd11438),
+     TOBN(0x587a68ff, 0x4777327b), TOBN(0x55d9abb7, 0x1cc6fbb3),
+     TOBN(0xf1970b82, 0x9eeb28a9), TOBN(0xe1ab4e14, 0x4ceef00f),
+     TOBN(0x184d3fb6, 0xf7462893), TOBN(0x9942a008, 0xc8ea54fd),
+     TOBN(0x1fee0f77, 0x1e33b2a3), TOBN(0xd4bed81f, 0x9f789870),
+     TOBN(0x6396feea, 0x6ef05b7e), TOBN(0x9c5d6a01, 0x2640b62a),
+     TOBN(0x170cfec9, 0x6834bea4), TOBN(0x68d16728, 0xe131feca),
+     TOBN(0x4be9c5d6, 0x00affb4d), TOBN(0xe34a423c, 0x99a6f256),
+     TOBN(0x1a254e4a, 0x09b9ed61), TOBN(0x902bc066, 0x30b10207),
+     TOBN(0xd2d5ed01, 0x62121f53), TOBN(0x0ba86811, 0x30f1b518),
+     TOBN(0x7916c132, 0xabe139c9), TOBN(0xb3a30fe0, 0x62c4f337),
+     TOBN(0x85d0a769, 0xaa5693be), TOBN(0x2d414379, 0xe3c7687b),
+     TOBN(0x92b0cb3c, 0x94958719), TOBN(0xb78aa37b, 0x4ec6575d),
+     TOBN(0xd035aae1, 0x4f1bf26a), TOBN(0x1383992d, 0xd31d5108),
+     TOBN(0x53ecc535, 0x92bdd6f5), TOBN(0xa9925ff6, 0x08c622ca),
+     TOBN(0xcaa3146e, 0x916d890c), TOBN(0x8cd0f12e, 0xb9c10220),
+     TOBN(0xcb6ad82b, 0x7e12a730), TOBN(0x3f89047c, 0xac9485db),
+     TOBN(0x6f926117, 0xfea2d970), TOBN(0x87b0cd9d, 0x46a19ecb),
+     TOBN(0x98bb5b02, 0x01e45bf6), TOBN(0xfc814620, 0x2ed7716d),
+     TOBN(0x8d6808cf, 0x4f5caa95), TOBN(0x3b57df03, 0x082f799e),
+     TOBN(0x469e1854, 0x2df84ca2), TOBN(0x00dd62eb, 0x64aac069),
+     TOBN(0x7d3ee9ce, 0x88d9efff), TOBN(0x9faed6a2, 0xbb830ffc),
+     TOBN(0xd073aac1, 0xd2d74f58), TOBN(0xf69e96b4, 0x2d44199e),
+     TOBN(0x6cb3a3b1, 0x83ed62ca), TOBN(0x472489fd, 0xd799acf8),
+     TOBN(0x5f84382d, 0xb63a36cc), TOBN(0x6ba1de87, 0x92d5b175),
+     TOBN(0x25aab130, 0x516101b7), TOBN(0x6f69c3fc, 0x5f039793),
+     TOBN(0xd28439ee, 0x89e3da4f), TOBN(0x8cb40a0e, 0x5e6b2b61),
+     TOBN(0xdfa55805, 0xe3d6650d), TOBN(0x2651f6c7, 0x0be59fd2),
+     TOBN(0x290e0044, 0x140d01c8), TOBN(0x78afa0a4, 0x62ea488f),
+     TOBN(0xc4e39971, 0x91eaa932), TOBN(0x8a9ef3a2, 0xfe2e79dc),
+     TOBN(0xdcfae315, 0x50705b7e), TOBN(0x73324dca, 0xd4be3d75),
+     TOBN(0x900bdd43, 0x03a91415), TOBN(0xc3ed02ed, 0xedfdc74d),
+     TOBN(0x509bd1d6, 0xf22b4a66), TOBN(0xfd8ed371, 0xb78d264b),
+     TOBN(0x562b2d3a, 0xa419134f), TOBN(0x80a2c274, 0x7a57a51e),
+     TOBN(0xebba5317, 0x8c662472), TOBN(0xebafedf2, 0xa0be71fb),
+     TOBN(0x0c5b9c1c, 0xb77899c8), TOBN(0x82448008, 0xc4888cb5),
+     TOBN(0xb795ea00, 0x78401c3b), TOBN(0x86776990, 0xa85ab971),
+     TOBN(0xdd81393b, 0x185739da), TOBN(0x76d0031f, 0x58136c97),
+     TOBN(0x6aceaa56, 0x641d39d1), TOBN(0x918844c7, 0x39be7ca8),
+     TOBN(0xa63993f7, 0xe18efc54), TOBN(0xb5369150, 0x4af0f30a),
+     TOBN(0x9bc2068c, 0x3d04af4f), TOBN(0xf309dff9, 0xa7796ed2),
+     TOBN(0x46e9a59d, 0x4e15b6a2), TOBN(0x617aaeba, 0xc22ef488),
+     TOBN(0xd91a8f90, 0xa15cf0cb), TOBN(0xc6ce12a4, 0xc30fb779),
+     TOBN(0xf3b80254, 0xb9d0a7ff), TOBN(0x32a63bf9, 0x6e9b6fa1),
+     TOBN(0x3e1ac837, 0x546fe4a8), TOBN(0x91ed89a5, 0x1279c7ef),
+     TOBN(0x8eb7b88e, 0xc73e9dea), TOBN(0x96d07205, 0x18238af0),
+     TOBN(0x56ebf306, 0xe96abf80), TOBN(0x5088ce24, 0x52c4b10f),
+     TOBN(0x65293176, 0xc979137f), TOBN(0x824642fb, 0x228d300a),
+     TOBN(0x968963a8, 0x7836aea5), TOBN(0x2d4c556c, 0xfabbfac1),
+     TOBN(0xa4c389bb, 0xd3f9977a), TOBN(0x2e8b2818, 0x99b4ccb6),
+     TOBN(0xc1fd8565, 0x6cb67df6), TOBN(0x0ac57d2a, 0xa72d2be8),
+     TOBN(0xa51ce6b8, 0xb8224ead), TOBN(0x33f7b468, 0xf417d744),
+     TOBN(0xcf8c80af, 0xf9f0bdf4), TOBN(0x0728f880, 0xd3222dd6),
+     TOBN(0x436188a3, 0x653afc12), TOBN(0x0f8bf160, 0x3c7940bb),
+     TOBN(0xdc18c13f, 0x424dcd2a), TOBN(0x038c1842, 0x20d3cd1f),
+     TOBN(0xed7f86a5, 0x7b12fd42), TOBN(0xa75ab77b, 0x7aaf1881),
+     TOBN(0x5c3d7612, 0xdf0574e2), TOBN(0x2eeeeb6f, 0x719414ce),
+     TOBN(0x797c5771, 0x90349fc4), TOBN(0x0d850f73, 0x2232eb33),
+     TOBN(0x0a0744f3, 0x2638c051), TOBN(0x739e6278, 0xb6e7dbfa),
+     TOBN(0xa77f286d, 0x659fc5f5), TOBN(0xb18b7cf1, 0x9654b0eb),
+     TOBN(0x5a2089ac, 0x6062e78e), TOBN(0x152f1804, 0xdfa6fb44),
+     TOBN(0xe8a404b4, 0xb61e6faa), TOBN(0x4774d30f, 0x08d06ea8),
+     TOBN(0xd7119b91, 0x3c359648), TOBN(0x850b02bd, 0x09473ff7),
+     TOBN(0x4db6f9a0, 0x936b7868), TOBN(0x84064dd5, 0xae38c3c5),
+     TOBN(0x294d6831, 0xfe448461), TOBN(0xc3c6f446, 0x42cd2105),
+     TOBN(0xa4412eb0, 0x3a2fdcae), TOBN(0x394c3774, 0x3d5a9181),
+     TOBN(0x58f19024, 0x5ca87c4b), TOBN(0xba1879db, 0x89ad5685),
+     TOBN(0x43c55c6a, 0x803c2589), TOBN(0xae1fad20, 0xa8249c65),
+     TOBN(0x4929e89f, 0xe0aff809), TOBN(0x19755ec2, 0x1769a00a),
+     TOBN(0x3b6a207b, 0xc242f335), TOBN(0xeca054ef, 0x090edab0),
+     TOBN(0x217e9c8b, 0xcd9e1c26), TOBN(0x917c2ecd, 0x35d4ac57),
+     TOBN(0xdc869d5d, 0xad33911d), TOBN(0x22d9d860, 0x2e828bd7),
+     TOBN(0x89262252, 0xf38dfaa1), TOBN(0x155c96ce, 0xeb9cd8d7),
+     TOBN(0xb0082b5d, 0xed5ebcc4), TOBN(0x7b6f9203, 0x17182086),
+     TOBN(0xaefe28aa, 0xee92aa6d), TOBN(0xbe67090c, 0x9aaaa0eb),
+     TOBN(0x88c5fbf1, 0x2f8ef18d), TOBN(0xbdc8bef1, 0xdd1fd65f),
+     TOBN(0xfb7052f5, 0xa9c7b483), TOBN(0x49634258, 0xbd6c8a99),
+     TOBN(0x1410a747, 0xc9f424f8), TOBN(0xfda0a304, 0xe9805723),
+     TOBN(0x1a438bd3, 0x0879bd30), TOBN(0xed09a9d3, 0x7f6903cb),
+     TOBN(0x920878f8, 0x57e53497), TOBN(0x87a12968, 0xa7fca0ed),
+     TOBN(0x7c8207cb, 0x38590ca1), TOBN(0x4cf52db1, 0xfae885c2),
+     TOBN(0x6cf384c4, 0xe8dc711f), TOBN(0x6fea20ff, 0x221dc698),
+     TOBN(0x6af56700, 0xa07bb79f), TOBN(0xc7da3b52, 0x33ca79c6),
+     TOBN(0x3a214691, 0xd05eb519), TOBN(0xea94c4f1, 0x93d4f089),
+     TOBN(0x734039d0, 0xba51f002), TOBN(0xc45e2042, 0xce206406),
+     TOBN(0xc0e75dbb, 0x4b3c3d53), TOBN(0x3a701272, 0x55b1b97c),
+     TOBN(0xec856e95, 0xd6addb6c), TOBN(0xb63fe8c6, 0xf283aae1),
+     TOBN(0x148fb239, 0x405788d1), TOBN(0x42e7148b, 0xe0181912),
+     TOBN(0x00bddcdd, 0x7de07978), TOBN(0xac79b657, 0x3c2e0a27),
+     TOBN(0x94024ba6, 0xdf1dd3dd), TOBN(0xcddeb357, 0x0bac41ad),
+     TOBN(0x51ec3dd7, 0x500c4f4b), TOBN(0xf00d594f, 0xd31c8fbe),
+     TOBN(0x6b8c6f43, 0x373a3e93), TOBN(0x891ba3a5, 0xfc2b6be9),
+     TOBN(0x3928225a, 0xddd72e36), TOBN(0x1e6a63bf, 0xcee362c1),
+     TOBN(0x317b78f4, 0xc5eb404c), TOBN(0xb882736b, 0x67c5e6b3),
+     TOBN(0xb1da56ce, 0x1f2f07aa), TOBN(0xab3c4fbe, 0xff83b633),
+     TOBN(0x9cc32f1c, 0x0ceeab99), TOBN(0xf1dead0d, 0x1062070e),
+     TOBN(0x49ea0d9b, 0x8a3e79c4), TOBN(0x4e7abe3f, 0xec9f16d1),
+     TOBN(0x19bda1c6, 0x5549ade0), TOBN(0xaae756a5, 0xe5885734),
+     TOBN(0xb3cff8ce, 0xcc2a1aaf), TOBN(0x812eebff, 0xf896ca47),
+     TOBN(0x0951b2bb, 0x9b2e1123), TOBN(0x7f245699, 0xdef6d6a9),
+     TOBN(0xa1331e95, 0x1be7ef41), TOBN(0xd1f0c3c3, 0x9fa1be62),
+     TOBN(0xb1d8295e, 0x4383e451), TOBN(0x658d8a84, 0x9f08bc14),
+     TOBN(0xb0587aef, 0x3ba4b85b), TOBN(0xb519c587, 0x481cbb27),
+     TOBN(0x2b975db6, 0x040d8f06), TOBN(0x399f6417, 0x1691d809),
+     TOBN(0x207a0e46, 0x7c6204fb), TOBN(0xe30f1420, 0x62c3e9d7),
+     TOBN(0x6127b782, 0x792f8208), TOBN(0x38f806ab, 0xb0d3fca9),
+     TOBN(0x38248542, 0x2ff46c64), TOBN(0xc18ffe85, 0x926ec166),
+     TOBN(0xfd268866, 0xc0c133fa), TOBN(0xb7f63f5a, 0xb93770e6),
+     TOBN(0xd8f1db26, 0xb13afb71), TOBN(0x5c5627eb, 0x32a790de),
+     TOBN(0x7f41bc1d, 0xdf50b6f8), TOBN(0x49d4ef17, 0x92d4c803),
+     TOBN(0x577f909f, 0xe8530065), TOBN(0x482cdede, 0xe630ff2d),
+     TOBN(0x682c8c6a, 0x14f54de8), TOBN(0xe6b5a504, 0xb4079343),
+     TOBN(0x00d927fc, 0xe58bde6b), TOBN(0x65d85f03, 0xf34841f4),
+     TOBN(0x265aec02, 0x2ac001d8), TOBN(0x1b785666, 0x2dfe518d),
+     TOBN(0x76142488, 0xc01e6e47), TOBN(0x8e8b2044, 0xdd5648dc),
+     TOBN(0x2c422006, 0xb3a340b3), TOBN(0xa5392113, 0x3dd67b22),
+     TOBN(0xbd08d05b, 0xa1567aaa), TOBN(0x84a55e43, 0x02acbec6),
+     TOBN(0x744ffd21, 0x5d898af0), TOBN(0x38067622, 0x6682e78a),
+     TOBN(0xf3696ff2, 0xffd08522), TOBN(0x49dd0060, 0x2bf02466),
+     TOBN(0xc9e0d1a5, 0x59c3e65d), TOBN(0x29537f56, 0x0a37fc25),
+     TOBN(0x6f6cb9eb, 0xa5f6b17a), TOBN(0xc1854320, 0x9c55857e),
+     TOBN(0x959585c6, 0x45dacc6e), TOBN(0xf4e97c94, 0xe5f4e930),
+     TOBN(0x966deb5f, 0x57d2a492), TOBN(0x98256831, 0x55d2df12),
+     TOBN(0xfdd65534, 0xaa457eca), TOBN(0x76dbb021, 0x03551474),
+     TOBN(0x0aeefee9, 0x09d9b4aa), TOBN(0x30fea11a, 0x784ca675),
+     TOBN(0x56b4b509, 0xff1d381a), TOBN(0xd1b26fea, 0x9fce40da),
+     TOBN(0x4835b911, 0x48d22911), TOBN(0x6aaac57a, 0x8bbe57e8),
+     TOBN(0xc8882792, 0x19d02037), TOBN(0x301e0aa6, 0x3ee49afa),
+     TOBN(0x1641ce6b, 0x00e6b020), TOBN(0x846b97de, 0xeac7cad8),
+     TOBN(0x9b74bfd8, 0x61aa6886), TOBN(0xdd95e765, 0xb0fa37ac),
+     TOBN(0xda0cde52, 0xf848a83b), TOBN(0xd2cc831d, 0x355b3528),
+     TOBN(0xc7fd2e03, 0x5e22238f), TOBN(0x6d5373fa, 0xab9a6c34),
+     TOBN(0x5dfc2874, 0xd8247f13), TOBN(0xc211a7a1, 0xe3c11f56),
+     TOBN(0x7512563f, 0xa2503b97), TOBN(0x124cd984, 0x5c007c82),
+     TOBN(0x4f6eb682, 0x491cd249), TOBN(0xaf4f70a3, 0xa683359d),
+     TOBN(0x2f1dfe71, 0xcc302b62), TOBN(0x83c474bb, 0xe57fbf56)},
+    {TOBN(0x43af7ab7, 0x916a8016), TOBN(0xf93d487f, 0x532bfb9c),
+     TOBN(0xa5f9af3c, 0xe2174971), TOBN(0xd1b9cf1f, 0x2d59b4d4),
+     TOBN(0x4a779418, 0x44f4eb91), TOBN(0x6a131fac, 0xc226edc5),
+     TOBN(0x472ab897, 0x80d4bb33), TOBN(0xb69687a5, 0x2f6ca1fe),
+     TOBN(0xffa73ca2, 0xfabd066a), TOBN(0x494e03a8, 0xf9c78bfd),
+     TOBN(0xe585a878, 0xff55cfef), TOBN(0x00770b1f, 0xd7053784),
+     TOBN(0xdec4da4a, 0x056fe70b), TOBN(0xe37395d8, 0x57bd444f),
+     TOBN(0x666250d4, 0x685df668), TOBN(0x0549569e, 0xbe6cc583),
+     TOBN(0x87629830, 0xab11639e), TOBN(0x869dd3ba, 0xa4488d53),
+     TOBN(0x10fe1c0b, 0xbaf06eb6), TOBN(0x99034839, 0x1687ac37),
+     TOBN(0x38418377, 0x7f1ffe7b), TOBN(0x3334a74c, 0x25bd7c57),
+     TOBN(0xc57cb7ed, 0x7008ba67), TOBN(0x384c12d0, 0xc1e4e12d),
+     TOBN(0xf48cdca6, 0xdb4bdb35), TOBN(0x6bc23aec, 0x74d913a7),
+     TOBN(0x8f0ccd9d, 0x12ed94d5), TOBN(0xe4aabd12, 0x86db09e7),
+     TOBN(0x0cbff31a, 0x1e948326), TOBN(0xcf68c47c, 0x17a479a2),
+     TOBN(0x3cced8e2, 0xca7686f1), TOBN(0x15ed1e99, 0x4eb62669),
+     TOBN(0xc373ab4b, 0xbdb0c561), TOBN(0x15082022, 0x6a9066a7),
+     TOBN(0x330a60c3, 0x62d31801), TOBN(0x53d97f09, 0xe35bea57),
+     TOBN(0xf204e006, 0x9c5dbb92), TOBN(0xfb9a8219, 0xf831262a),
+     TOBN(0x3468ae41, 0x42136174), TOBN(0x0f8fb5bc, 0x0e03218e),
+     TOBN(0x90337499, 0x4ad8bba6), TOBN(0xdb71e1fb, 0xe3ecb618),
+     TOBN(0x6955e874, 0x3cf2a8ad), TOBN(0x594501f5, 0xed691fee),
+     TOBN(0x7e2baef3, 0xd29bd364), TOBN(0x5cbd91ac, 0x6f766759),
+     TOBN(0xaba54aaa, 0xb2201a96), TOBN(0x2cfea457, 0xcfa392ab),
+     TOBN(0xa4da4162, 0x86f8f7da), TOBN(0x88d70b86, 0xcbc0b934),
+     TOBN(0x9df02795, 0xacff4f7b), TOBN(0x0fc80219, 0xc65ef81b),
+     TOBN(0x32d457de, 0xa299ca0f), TOBN(0x97081b35, 0x0896427b),
+     TOBN(0x92d6c309, 0x41bab6b4), TOBN(0x5d5e56f3, 0x73b8d601),
+     TOBN(0xfb3992a4, 0x202bde39), TOBN(0x2549f564, 0x3d6bab98),
+     TOBN(0x0b564642, 0x87712512), TOBN(0xd52442b4, 0x7fde7e50),
+     TOBN(0xa6cefd08, 0xa3d3e16e), TOBN(0x5b194f0a, 0xc83b29bd),
+     TOBN(0x6db0edd8, 0x906dec8c), TOBN(0x7a090959, 0x02570c1e),
+     TOBN(0xf6f74fcc, 0x4c41eb53), TOBN(0xd07678a9, 0x5b944a6c),
+     TOBN(0xf53bf11d, 0xb80677ea), TOBN(0x569a5761, 0xbc5900f8),
+     TOBN(0x34e5bba8, 0xd3d4de91), TOBN(0xc5774804, 0x8361f73e),
+     TOBN(0xd637d3dd, 0x59abdbd5), TOBN(0x64a81bf9, 0x8772b615),
+     TOBN(0x78bb12ea, 0x7f3d83ab), TOBN(0xca22c31c, 0x573f9b99),
+     TOBN(0x4283c173, 0x2aed4c39), TOBN(0xda054c1d, 0x39f32bdb),
+     TOBN(0x2ead717e, 0x1da2cbd7), TOBN(0x747d67cd, 0x62390b41),
+     TOBN(0x43739d9c, 0x6b9666a6), TOBN(0xb84e2f22, 0x8c827b12),
+     TOBN(0x0e4ac2b1, 0xc0312773), TOBN(0x571cfc75, 0xe53f068e),
+     TOBN(0x6c44df85, 0x42bfe41e), TOBN(0xe7d2edb9, 0x627e30bb),
+     TOBN(0x9c2e4fd6, 0x0dd5cedc), TOBN(0xe2d885ef, 0x0f7d22d7),
+     TOBN(0x44b0b5db, 0x1329bcfd), TOBN(0x006e872f, 0xba1c96f6),
+     TOBN(0xdbadab5d, 0x7e952317), TOBN(0xab849ed4, 0xc2a5bcaa),
+     TOBN(0xe3acbb74, 0x1e72dbb1), TOBN(0xbf42c3d3, 0x5d4b7cb7),
+     TOBN(0xebe967b5, 0x3d748639), TOBN(0x1fe93db5, 0xc03af7a1),
+     TOBN(0x2ab14596, 0xa944ea06), TOBN(0xfb05a759, 0x76655c09),
+     TOBN(0x5117890c, 0x6f8a532b), TOBN(0x2f57781f, 0x59430c5b),
+     TOBN(0xe70968b3, 0x79e07b84), TOBN(0x05df2305, 0xe86d7223),
+     TOBN(0x57af0dc5, 0x31e32933), TOBN(0x5473e34a, 0x84afc419),
+     TOBN(0xa7337a42, 0x03d5feb4), TOBN(0xd85c8602, 0x1b1c6bd8),
+     TOBN(0x25ca1891, 0x753008e6), TOBN(0x4338ec98, 0x5f0ff93a),
+     TOBN(0xd2ba8557, 0xddd30a7c), TOBN(0xb4b65361, 0x09c51794),
+     TOBN(0xfbb51399, 0xd1cbc66e), TOBN(0x28853781, 0xe53bca50),
+     TOBN(0x5b797232, 0xfd5a9aaa), TOBN(0x6249afd7, 0x5b88c4f3),
+     TOBN(0xcc5ab6cb, 0xba6918a0), TOBN(0x9f824ec1, 0x8fb65c7d),
+     TOBN(0x4796d80b, 0x56b18754), TOBN(0x4c83d371, 0x67721520),
+     TOBN(0xd77c373c, 0x63b03348), TOBN(0x91930e5e, 0x54f27457),
+     TOBN(0x83f97370, 0xaf40c03f), TOBN(0x65b55872, 0x34eea661),
+     TOBN(0x310695d0, 0xeb10175e), TOBN(0x79aaa6ea, 0xcd236aa1),
+     TOBN(0xf78539ff, 0x3edfff40), TOBN(0x2369c517, 0x02cd6063),
+     TOBN(0x81e43ae5, 0x5c8631ff), TOBN(0x065e8212, 0x216a60bd),
+     TOBN(0x225cb473, 0xe761a5f9), TOBN(0x695ef860, 0xab6de6fa),
+     TOBN(0x03536a46, 0x7d7d98d4), TOBN(0xa17d3a69, 0x18413673),
+     TOBN(0xa6ddcd46, 0x295ae303), TOBN(0x86de0bbd, 0x61beae2b),
+     TOBN(0xdd73dfcc, 0x7699458e), TOBN(0x827deba5, 0xb53f88dd),
+     TOBN(0x213c376b, 0x42a9a11c), TOBN(0xc854fd72, 0x12c73975),
+     TOBN(0x1fa96547, 0x15ac27ff), TOBN(0xcb0dc17b, 0xf49b6c9a),
+     TOBN(0xa3e44853, 0x709dd202), TOBN(0xd3905c5f, 0xcfe2bbea),
+     TOBN(0xb01e5799, 0x6c35ce9c), TOBN(0x0063e7ac, 0x900ef600),
+     TOBN(0x8c70b87e, 0xfffa5cc0), TOBN(0xebd76d34, 0x74230b0c),
+     TOBN(0x914eec9e, 0xed5f8529), TOBN(0x7a65ffd3, 0xe8edf477),
+     TOBN(0xf0cb206d, 0x70c74bee), TOBN(0x03445ff1, 0xd1b02e01),
+     TOBN(0x664ca356, 0xe5dbf791), TOBN(0xd678d4ae, 0x254e69c4),
+     TOBN(0x370c9f0f, 0x8617386b), TOBN(0x42af7a0c, 0xfdcd985d),
+     TOBN(0x8c4b5009, 0x83c3da54), TOBN(0x086a7ec5, 0x4c8a87c8),
+     TOBN(0x9ba0b368, 0xaa166c4c), TOBN(0xa279670f, 0xa658ac1c),
+     TOBN(0xc49f49bd, 0x5d0544da), TOBN(0x28c22323, 0x15cb0b41),
+     TOBN(0x86293dfa, 0xa4834d71), TOBN(0x283e191d, 0xd1e1d63b),
+     TOBN(0x0cad6519, 0xca188555), TOBN(0x323ce5da, 0x0cbd0c5c),
+     TOBN(0x6b7d2be1, 0x38560254), TOBN(0xb05ed385, 0x1696b9b9),
+     TOBN(0x8ce4b5a7, 0x9ae59f92), TOBN(0xabe5ff33, 0x4f7e61a3),
+     TOBN(0xae15a3cc, 0xdbfeb302), TOBN(0x691b1129, 0x837fde82),
+     TOBN(0xb60b31f3, 0x2e6d116b), TOBN(0xd49e9d11, 0xecab5aa9),
+     TOBN(0x3e95f844, 0x6787f23d), TOBN(0x2ab8834f, 0xa12f4846),
+     TOBN(0xe70e2ab1, 0x5b6359cc), TOBN(0x7a6349e9, 0x9322a047),
+     TOBN(0xc01e424c, 0x6c1e483a), TOBN(0x424b2027, 0x92bd5d1b),
+     TOBN(0x8a6e6766, 0x254e49a3), TOBN(0xb8d85d42, 0x97e70d58),
+     TOBN(0xa859082f, 0xb51b3abc), TOBN(0x2850573b, 0xe7bb828a),
+     TOBN(0x47cc95b2, 0x7bfe8021), TOBN(0x7c28fe9e, 0x5853f12c),
+     TOBN(0xe5fb0558, 0x10c0f389), TOBN(0xb99a639f, 0xdaf0a7e7),
+     TOBN(0xa6b9e6c9, 0xf60ee3e5), TOBN(0xb397af7f, 0xa236377f),
+     TOBN(0xb7a318ac, 0x7da4af71), TOBN(0xae64b613, 0x0a9d39fb),
+     TOBN(0x66ce6c74, 0x902b3411), TOBN(0xea256a70, 0x5a199e53),
+     TOBN(0x8dcddd89, 0x550fb76f), TOBN(0x9443b477, 0x03e70f9c),
+     TOBN(0x1787b8a5, 0x142113a6), TOBN(0xa58b6c61, 0x180aec95),
+     TOBN(0xcc381420, 0x947ff26d), TOBN(0x22520e8f, 0x3d8b8c36),
+     TOBN(0x192ee945, 0xef2cc6ef), TOBN(0xea52afee, 0xe9ca0c7a),
+     TOBN(0x5970d794, 0xe6e30d93), TOBN(0x0a325e42, 0x57c786ac),
+     TOBN(0x5e2dddf8, 0x33ca1226), TOBN(0x18e624b9, 0x588cb1e3),
+     TOBN(0xf3ba597a, 0x21809265), TOBN(0x90247702, 0x5d575728),
+     TOBN(0x48a5bf7b, 0xc1f918db), TOBN(0x17d1efaf, 0xd6840541),
+     TOBN(0x13dfe6fe, 0x3e2e754d), TOBN(0xc471e16a, 0x707a531f),
+     TOBN(0x79085bbd, 0x97d34b48), TOBN(0xfa5ba99d, 0xc2e9bea9),
+     TOBN(0x70b9c9fc, 0x6c5a6dc2), TOBN(0x4e042213, 0x4e94c5db),
+     TOBN(0x4a37b41f, 0x25ebb95f), TOBN(0x24691010, 0x055d79fb),
+     TOBN(0xdaff9352, 0x3f572a8f), TOBN(0xe63d55b0, 0xf327ec2a),
+     TOBN(0xc5a86d3c, 0xdebd5116), TOBN(0xd547fe08, 0xa2ddef2a),
+     TOBN(0xbabb617f, 0x6a149f12), TOBN(0x14f69a1b, 0x8a766128),
+     TOBN(0xb83a1477, 0x48236f77), TOBN(0xd0d81be1, 0x35711279),
+     TOBN(0x706f9067, 0x5eab1c3a), TOBN(0x8c4823f1, 0x16a1ffaf),
+     TOBN(0xd845c68b, 0xaff5ea89), TOBN(0xa276eaeb, 0x6b75eadb),
+     TOBN(0x2d0fc819, 0xcc230ec1), TOBN(0xdfad96e8, 0xedaaf1f2),
+     TOBN(0x0f25dcbf, 0x40868254), TOBN(0x53bbe31e, 0x5babd7f9),
+     TOBN(0x7f8afc48, 0xcf804a8d), TOBN(0x7f4922ef, 0x5f9b9a0d),
+     TOBN(0x703cbf6d, 0xd7422804), TOBN(0xe5df61f3, 0x83349bdd),
+     TOBN(0x0fa3d8cd, 0x77d285ad), TOBN(0xe990f9e5, 0x2e88e15e),
+     TOBN(0x40ec61f7, 0x8561d8a6), TOBN(0x7fc498a6, 0x16650305),
+     TOBN(0xa3bf5cb4, 0x8e5beabf), TOBN(0xfaa52008, 0x76ae0350),
+     TOBN(0x99e24318, 0xe4fc3e72), TOBN(0x9241c8ab, 0x2079c616),
+     TOBN(0xefa5bf38, 0x9584a258), TOBN(0xd7b770b5, 0x1eebb098),
+     TOBN(0x28b714a3, 0xe1fc18a7), TOBN(0xf0426bd2, 0x5b83dd9a),
+     TOBN(0x956d8972, 0x291b28ee), TOBN(0x8bb8cbde, 0x6eb553ff),
+     TOBN(0x396cfe2d, 0x95298003), TOBN(0xcaa66550, 0xad8412fc),
+     TOBN(0xf41d0215, 0x83997dd3), TOBN(0x7066e356, 0x45534587),
+     TOBN(0x0d5b5c3e, 0x5b6de0d7), TOBN(0x8ead45d0, 0xcecd5f26),
+     TOBN(0xe2f24e2c, 0xd252ae50), TOBN(0xf71e5d4f, 0x815150bf),
+     TOBN(0x3872685d, 0x54527ce5), TOBN(0x59b343ae, 0x91fd99ee),
+     TOBN(0xd621d027, 0x3462cc0c), TOBN(0xfa42481f, 0x8dbfbcf4),
+     TOBN(0xda481a9e, 0xaf7ae918), TOBN(0xfd5fd37c, 0x7c909a18),
+     TOBN(0xa5ebb7bf, 0x805fb7b7), TOBN(0xeac65687, 0x165200b1),
+     TOBN(0x56302866, 0x7cef9b97), TOBN(0x8f662dd6, 0xae3ddb64),
+     TOBN(0x90cb4e87, 0x60c1aa98), TOBN(0x33f9fc60, 0x986fb3bc),
+     TOBN(0x76f41ecc, 0x974593cd), TOBN(0xb19501f9, 0x6e0f01e8),
+     TOBN(0x587d9035, 0x25760dd5), TOBN(0xa31c971c, 0x9391032e),
+     TOBN(0x7650e3b1, 0x95c9a84f), TOBN(0xbb83ea93, 0x78c66087),
+     TOBN(0xda08a04c, 0xdfcf1365), TOBN(0xd23daeba, 0xca0b84a4),
+     TOBN(0xf89d395d, 0x2ca3bd2b), TOBN(0x779e2aaf, 0x6e53fc93),
+     TOBN(0xc0fc7dc8, 0x34216082), TOBN(0x6cd8bdf6, 0x42a66691),
+     TOBN(0x836a2cf3, 0x0fe014cf), TOBN(0xdde5fc22, 0x0c08373d),
+     TOBN(0xc4fa2387, 0xcb3b2b54), TOBN(0x96253732, 0xe2aa434a),
+     TOBN(0x4c4f5979, 0x1d502ce8), TOBN(0xf046f5a9, 0xb6df40c4),
+     TOBN(0xc7d05765, 0xac6b75b5), TOBN(0xae1cd887, 0xb69f3c34),
+     TOBN(0xafed4be6, 0x49b86680), TOBN(0x17b75fa5, 0x14f70463),
+     TOBN(0xb12e8051, 0x90b7c07f), TOBN(0xe2c8cf2b, 0x39a8e99d),
+     TOBN(0x984744c4, 0xd5fdb65b), TOBN(0xd8b1c012, 0xa28942e4),
+     TOBN(0x295d0199, 0x46693fb2), TOBN(0x5ab3a305, 0xa0a3b4fa),
+     TOBN(0x3c191023, 0x26755b3f), TOBN(0x75f35df1, 0xb6c084de),
+     TOBN(0x30640e66, 0x63e6286b), TOBN(0x3b3720ec, 0xd2c6c059),
+     TOBN(0x2c821a0f, 0x6ea837be), TOBN(0x238c4d93, 0x84f23bd0),
+     TOBN(0xbdc40703, 0x390ea4f5), TOBN(0xcb207d0a, 0xae68a2db),
+     TOBN(0x487d18bd, 0xe25f098f), TOBN(0x39018023, 0x9ab84e10),
+     TOBN(0xaa19aa62, 0x8b7ab4a2), TOBN(0xcb9cdebe, 0x89f08fbd),
+     TOBN(0x26a4c9eb, 0x2ca57917), TOBN(0xaadfd472, 0xda92ce1b),
+     TOBN(0x32b592d8, 0xdaa907db), TOBN(0x9bbebacc, 0x7d6f995e),
+     TOBN(0xa27a4735, 0xe1d88c25), TOBN(0x339905e1, 0x9bd66b67),
+     TOBN(0xa9bfa0ed, 0x62af9942), TOBN(0xd94dd9e0, 0x2e2cb83c),
+     TOBN(0x279d8fda, 0xab28e268), TOBN(0xf28ab69b, 0x51a97518),
+     TOBN(0xce9bd2ea, 0x9691f33e), TOBN(0xb9e8b2fe, 0x74be3d64),
+     TOBN(0x35072fab, 0xabefa07d), TOBN(0x1c2ba05c, 0x7b51ba8e),
+     TOBN(0x3bb1ec56, 0xd32d6bf5), TOBN(0x326bdfdc, 0x5d7bd7dc),
+     TOBN(0x33f4f4f6, 0xd95bdcb1), TOBN(0x781bfd34, 0x453ef338),
+     TOBN(0x4d210cad, 0x1ef61a66), TOBN(0x6ae7bb14, 0x2799bcc7),
+     TOBN(0xb105e5ec, 0x194f4d6a), TOBN(0x204a5480, 0x52b77f08),
+     TOBN(0x13f4e022, 0xa328ab98), TOBN(0xa56863c4, 0xb7f9a240),
+     TOBN(0x2780c9a7, 0xce4cf7bd), TOBN(0xf98e3f58, 0xc497fdf3),
+     TOBN(0x635b8bc6, 0xf52738fc), TOBN(0xc5fd89b8, 0x58937500),
+     TOBN(0x57070428, 0x75e98a64), TOBN(0x66aabaae, 0x946f094b),
+     TOBN(0x7d2376e8, 0x06d37944), TOBN(0x9b316827, 0x09319f13),
+     TOBN(0xbbde59a8, 0xa77eb79b), TOBN(0xb7f35bbb, 0xf451fde0),
+     TOBN(0xb2f7914e, 0x64aa79fd), TOBN(0x4d2944b3, 0x9f68a486),
+     TOBN(0xbd8a92de, 0xc1a7e537), TOBN(0x76695e9a, 0x4fc930a3),
+     TOBN(0x1b75f9eb, 0xbcb4153b), TOBN(0xf5a34d2d, 0xf6485404),
+     TOBN(0xe09ee965, 0x26853a8e), TOBN(0x63de8595, 0x9dbb319a),
+     TOBN(0xbbbc1b07, 0xda079d6d), TOBN(0x5956bb3d, 0xdfa71b9d),
+     TOBN(0x69709306, 0x209cbcc3), TOBN(0xbe2a08d0, 0xe3360429),
+     TOBN(0xd377a9fe, 0x92a58752), TOBN(0x37e175ea, 0x997bc322),
+     TOBN(0xfe355d4d, 0x042ff2e4), TOBN(0x4332ef31, 0x4c4babd3),
+     TOBN(0x634429c2, 0x2314b1af), TOBN(0xae6e8275, 0x91a7d5e5),
+     TOBN(0x134a39c7, 0x250a1476), TOBN(0xec9bb642, 0x08994f0c),
+     TOBN(0x2a9e0ac0, 0xd38704cd), TOBN(0x16490507, 0x536a4ad0),
+     TOBN(0xc7f747d2, 0x7c8dbfeb), TOBN(0x91e67dd2, 0xc0bb24ac),
+     TOBN(0x2dfc6c8a, 0x959eca45), TOBN(0x78bafaf0, 0xc54fefe8),
+     TOBN(0xf3eb2d1b, 0x5da056f3), TOBN(0xda14b631, 0x3b89c967),
+     TOBN(0x80923b1c, 0xcb51f621), TOBN(0xc3d5fd1f, 0x6609791c),
+     TOBN(0x68ad7bef, 0x817b1063), TOBN(0x3775b686, 0xa1f0b00c),
+     TOBN(0xb207c9a5, 0x6c7f0dc1), TOBN(0xb7c30a7d, 0xa9b91fff),
+     TOBN(0x9274c090, 0x8b9f8e8c), TOBN(0xa3757610, 0x24e94ce1),
+     TOBN(0x8f2b1f2c, 0x4f0f3ec1), TOBN(0x02e53bb2, 0x3938d26f),
+     TOBN(0x90a3da2c, 0x701e5ae8), TOBN(0x60c2eaca, 0xa271dcca),
+     TOBN(0xc9c08e39, 0x31fb2372), TOBN(0xcaa3245e, 0xb838908a),
+     TOBN(0x2e168b0b, 0xa6a6a275), TOBN(0x986a30a3, 0x0030ef6b),
+     TOBN(0x79f768f9, 0x170ab683), TOBN(0x7296fd6f, 0xff70981e),
+     TOBN(0xbab6fedf, 0x13a323cd), TOBN(0xa86ec0dd, 0x186e9813),
+     TOBN(0xd9f8db04, 0xcd56e7d5), TOBN(0x47b20676, 0xaa8b1c96),
+     TOBN(0xdff4574e, 0xf1fb3b03), TOBN(0x41a1f765, 0x1051f9fc),
+     TOBN(0x35779aee, 0x7f289a4e), TOBN(0x93bd54c9, 0x11c96180),
+     TOBN(0x1485074a, 0x37b95c67), TOBN(0x0b01af95, 0x0865b2f0),
+     TOBN(0x43033ffe, 0x90ce0b41), TOBN(0xffd6e34c, 0x71504d6f),
+     TOBN(0xb380cd60, 0x1aa946c8), TOBN(0x7f7cc73b, 0x806b2e19),
+     TOBN(0xc17df7d8, 0x2db88e6d), TOBN(0x7b767ca2, 0x072e5416),
+     TOBN(0xbb42d3ed, 0x0ad6134b), TOBN(0x5444339f, 0x640df8af),
+     TOBN(0x7e7c7e7b, 0x5bc73112), TOBN(0xe8f139b4, 0xf899dba4),
+     TOBN(0xd13b436d, 0x43a06bf3), TOBN(0xe43f8567, 0x773e4863),
+     TOBN(0x35555cd5, 0x56b814d7), TOBN(0x54af8e53, 0xd429ccc8),
+     TOBN(0xc346718f, 0x82ae0477), TOBN(0x301fb382, 0xbe02c7a8),
+     TOBN(0xcd65b3b2, 0xd2a70595), TOBN(0xcfcff499, 0x5aad01d6),
+     TOBN(0xd0fcc076, 0x589feca8), TOBN(0x7b2b93c7, 0x7c603ed8),
+     TOBN(0x2dda7a8c, 0x6ddfc3b8), TOBN(0x678d66e9, 0x74723d99),
+     TOBN(0x0f7e4215, 0x6db60b07), TOBN(0x40666848, 0xc0bfa2f9),
+     TOBN(0x70b46b5c, 0x8e116caf), TOBN(0xbd753511, 0xfba46d90),
+     TOBN(0xe48374cd, 0x019d8279), TOBN(0x7d40e6e2, 0x309b0fc6),
+     TOBN(0x226435ee, 0x9dec7a42), TOBN(0x818e79cb, 0x4243e7d0),
+     TOBN(0x3d7376d7, 0x54658634), TOBN(0xa40cafeb, 0x9f8727ac),
+     TOBN(0xdc1d09f0, 0x81f556bc), TOBN(0x32ca7367, 0x63223573),
+     TOBN(0x92e10f91, 0x5810a27d), TOBN(0x6fb34bad, 0x1fdf969f),
+     TOBN(0xe5c2b2ff, 0x657a067e), TOBN(0x173c0900, 0x382ba37a),
+     TOBN(0xdd5113c8, 0x86d87c1e), TOBN(0x56a2ca9d, 0xcaf77294),
+     TOBN(0x9f956881, 0x666a9821), TOBN(0xc4bcafc7, 0xa3b18c0f),
+     TOBN(0xb100f338, 0x2b02578b), TOBN(0x4716339e, 0x64b2c607),
+     TOBN(0x92c923ae, 0x5b161179), TOBN(0xada2e4da, 0x0df442a0),
+     TOBN(0x4d4b90c5, 0x47f85474), TOBN(0xa378bf79, 0x824e3195),
+     TOBN(0x4469339d, 0x2478a0d4), TOBN(0x0972e788, 0x0c1e69e2),
+     TOBN(0x1aedd761, 0x72edc384), TOBN(0xcabcd976, 0x9898d672),
+     TOBN(0xd370aa7a, 0xba814ca2), TOBN(0x20fa58db, 0xe88eca9c),
+     TOBN(0x1540ada9, 0x45a7ab8d), TOBN(0x8dcf9860, 0xbdca94fc),
+     TOBN(0xf0187e2c, 0xaa9df4f4), TOBN(0x9a197dc3, 0x54a49576),
+     TOBN(0xb54f5cb2, 0xb4a1f341), TOBN(0x1439caf0, 0xfe32827b),
+     TOBN(0x3c1a356d, 0xd36783f5), TOBN(0x284e2f15, 0xc56a6e47),
+     TOBN(0xc6abad59, 0x4dcfaddf), TOBN(0xe82993f7, 0x082bb2b4),
+     TOBN(0x3cb46972, 0x23655955), TOBN(0x8ab06385, 0x992551e3),
+     TOBN(0xcbd6cb99, 0xdaa13ab3), TOBN(0x01375bbd, 0x2dc1333d),
+     TOBN(0x638a7f20, 0x972c4440), TOBN(0x150665c6, 0x24dcb1cc),
+     TOBN(0x4044e12f, 0x1ea989c6), TOBN(0x204c4eba, 0x61012ea3),
+     TOBN(0x78b8edaa, 0xac2719c1), TOBN(0x6772643d, 0x2ab50d99),
+     TOBN(0x94604146, 0x606d63de), TOBN(0xa876d9b0, 0x693aadc8),
+     TOBN(0xf7401ffb, 0x667044ff), TOBN(0xab98d73e, 0xb599ecb4),
+     TOBN(0xe2b2048f, 0xda5cbee3), TOBN(0x526e3aa1, 0xa2b3da50),
+     TOBN(0x4d0885e3, 0xb4ad2073), TOBN(0x916ce3d2, 0x644a1a19),
+     TOBN(0x952b5747, 0x96930e8d), TOBN(0x2a489fd6, 0xb0cf7f5f),
+     TOBN(0xbff4b59b, 0xa8b3b538), TOBN(0xba0e03ff, 0x6aff1cbe),
+     TOBN(0xfa614adc, 0xd56b2285), TOBN(0x2305edd4, 0x50d58e62),
+     TOBN(0xb349fdce, 0xe36877e9), TOBN(0x5f808fc2, 0x43a6103b),
+     TOBN(0x66d8404b, 0x86493abe), TOBN(0x18c92d3d, 0x9b08ff7d),
+     TOBN(0x6a60ab6b, 0x89754762), TOBN(0xec69fd4c, 0x8233dee7),
+     TOBN(0x32449242, 0x06beadfa), TOBN(0x421caf1e, 0xe0df7084),
+     TOBN(0x6f89693b, 0xd7969339), TOBN(0xb9a53713, 0xfa30a7a9),
+     TOBN(0xf89d9bf5, 0x11556d9a), TOBN(0xe4e9c5f0, 0xee8cf993),
+     TOBN(0xe5b2a323, 0x17ed9a7e), TOBN(0xd4db3920, 0x93e80c9e),
+     TOBN(0xae857864, 0x1fda3726), TOBN(0xe5cb36a3, 0xa3e88485),
+     TOBN(0xa6b85205, 0xf495b9a8), TOBN(0xc1be0108, 0x38f3b180),
+     TOBN(0x79d0585b, 0x36a1f3a8), TOBN(0xa3d8f17f, 0x913ba5f2),
+     TOBN(0x1eaee5d6, 0x225acf11), TOBN(0xd4dfd0a2, 0x0d32de79),
+     TOBN(0x0cec324b, 0x6b3ceff3), TOBN(0x3acc6dec, 0xab447870),
+     TOBN(0xabbf7e6d, 0xb9c759ac), TOBN(0x0d5c1f47, 0xa5196938)},
+    {TOBN(0x781a2157, 0x45e7ea91), TOBN(0x4da3f86d, 0xacadfc40),
+     TOBN(0xc81d6c7d, 0x162cd393), TOBN(0x2c38a2a1, 0xad6e60fc),
+     TOBN(0x575b25d6, 0xf753479d), TOBN(0xc914e08e, 0xbdec6025),
+     TOBN(0xf81cea34, 0x492d5547), TOBN(0x6bbb8bb1, 0xfb1b6969),
+     TOBN(0x1ee8082c, 0x1279504c), TOBN(0xa466abb2, 0x2c92ffb7),
+     TOBN(0x4118b26a, 0x3e81c7e2), TOBN(0x1a76cc50, 0xfc60e33a),
+     TOBN(0x34998bc2, 0x5736d7ae), TOBN(0x20b39558, 0xbd1ef993),
+     TOBN(0xd669e2ae, 0x5fbf2525), TOBN(0xbf956ec6, 0x01cc7626),
+     TOBN(0xce817029, 0xb0ccbaa5), TOBN(0x57ef5bd2, 0x279b78a6),
+     TOBN(0xc9283747, 0x4df45d89), TOBN(0xe86b91a8, 0x2ec4bfd3),
+     TOBN(0xe5ab4c6d, 0xfe565915), TOBN(0xe6574716, 0x7c58a042),
+     TOBN(0xe141deda, 0x6301c4bc), TOBN(0x2f95d561, 0x8084513a),
+     TOBN(0xdc424508, 0xeecede3d), TOBN(0x11889b35, 0x386440d0),
+     TOBN(0x7b229f93, 0x98de0d77), TOBN(0x73fced8a, 0x300a7447),
+     TOBN(0xf75e1c79, 0xe31c8f88), TOBN(0x8db20bdd, 0xbb277e4f),
+     TOBN(0x8ded0a70, 0x2b87c02c), TOBN(0x166281b5, 0x4d164c1a),
+     TOBN(0x887356cf, 0xeedd8e0c), TOBN(0x8afab37f, 0xe44c012b),
+     TOBN(0x0795935f, 0xe4aa3eb6), TOBN(0x9b9efc0c, 0xda6dfa57),
+     TOBN(0x0ff0f8aa, 0xa8ab0840), TOBN(0x0f3a4b63, 0xc8561605),
+     TOBN(0x2ca911ef, 0xd5db9315), TOBN(0xef70e5ba, 0xc8ded9f8),
+     TOBN(0x443d9209, 0xa6aae58b), TOBN(0x3d0798e8, 0x274edda3),
+     TOBN(0x5c2d462c, 0xc2be3c9a), TOBN(0xb5488239, 0x439882dc),
+     TOBN(0x6391bb41, 0x977d4de4), TOBN(0x7fd91040, 0x1e8245c4),
+     TOBN(0x1a6d3c71, 0x3b093dc2), TOBN(0x423a4e3a, 0x7b22fe12),
+     TOBN(0xe3156f40, 0x3a9a04a3), TOBN(0x9b32c4e5, 0x297d9aff),
+     TOBN(0x7e0b401e, 0x62a89850), TOBN(0xffbf542e, 0xa84ef082),
+     TOBN(0x377cc0e0, 0xf990caf5), TOBN(0x02704343, 0xec88ea9b),
+     TOBN(0x846fd46c, 0x63f96a51), TOBN(0x37f5cebf, 0xe9855c47),
+     TOBN(0xbd140bd8, 0xe6ad29dc), TOBN(0x7dca4b10, 0x6a04da28),
+     TOBN(0xa84feafc, 0xade05b33), TOBN(0x44d031f8, 0x7630aacf),
+     TOBN(0x18af2fa6, 0xcdee269c), TOBN(0x1e40571b, 0x8697a40b),
+     TOBN(0xf71d44ad, 0xf0e5f826), TOBN(0x2a47ddf9, 0xa434cfe6),
+     TOBN(0x22b97078, 0xad17cc54), TOBN(0x223732dc, 0xf2c105b2),
+     TOBN(0x25168336, 0xe284fae8), TOBN(0x41b1bb94, 0xb356407b),
+     TOBN(0x299e7d7a, 0x89933a11), TOBN(0x19e13d3c, 0xff7dd9f6),
+     TOBN(0x9517bd16, 0xf23d7ca7), TOBN(0x9e5e9e34, 0x1eb978a4),
+     TOBN(0x4c222dae, 0x5fa3f92f), TOBN(0xd5e38e84, 0xed489ca7),
+     TOBN(0x3d81aca4, 0x70ea613d), TOBN(0xc7bed301, 0xbe4e88f6),
+     TOBN(0x6fd5a7bf, 0x0757d8db), TOBN(0x1472441d, 0x7a9181b0),
+     TOBN(0x78b78753, 0x5a90b66f), TOBN(0xe3fd5e91, 0xabdae620),
+     TOBN(0xea6a77d8, 0x84535653), TOBN(0x8d241deb, 0x81d7e667),
+     TOBN(0x1af73798, 0xfaf4ef1b), TOBN(0x5e1ae728, 0x3e0dae27),
+     TOBN(0x6a67088c, 0x2f7450b5), TOBN(0x7bccbe06, 0xda9cb3c6),
+     TOBN(0x520fabab, 0x5b808e05), TOBN(0x84222f68, 0x702b247b),
+     TOBN(0x2471546a, 0xe0bd7ef2), TOBN(0x27d310dc, 0x656a62a3),
+     TOBN(0xb8014eca, 0xad35da30), TOBN(0xbdfdcd82, 0x7f35cd7a),
+     TOBN(0xf1e4d51f, 0x040ae645), TOBN(0x672ffadf, 0xf42a4d9b),
+     TOBN(0x9d874370, 0x2d0be1c0), TOBN(0xcc3671c6, 0xc6e55471),
+     TOBN(0x39aa705c, 0xbb9c9667), TOBN(0x8c3e584a, 0xc51f661d),
+     TOBN(0xe5645b1d, 0xe570769c), TOBN(0x81923fda, 0xbc97abf4),
+     TOBN(0x51d64f64, 0x0caac97c), TOBN(0x45c17651, 0xff847f4a),
+     TOBN(0xc7a6eaf9, 0x8cbfa2c7), TOBN(0x6c2ab9f7, 0xba8ab893),
+     TOBN(0xbdaa2c7b, 0xf435624e), TOBN(0xc113e971, 0x1d961058),
+     TOBN(0xb230f1b0, 0xa2021a1c), TOBN(0x6b34e1ff, 0x521a4816),
+     TOBN(0x159dc24d, 0x9b874f4d), TOBN(0xeaa0f951, 0xbeaab169),
+     TOBN(0x4f38733f, 0xb56f4916), TOBN(0x4ee689db, 0xdc9d3ac7),
+     TOBN(0x720254bb, 0x7bf8d03b), TOBN(0x78b0e6d6, 0xd31d7679),
+     TOBN(0x848fb878, 0xf130d7b0), TOBN(0xe8e478ec, 0xd3ba625a),
+     TOBN(0xb0ce9168, 0x100dfefb), TOBN(0xfe1463ab, 0xe5098aa8),
+     TOBN(0xf780ac38, 0xa11ec558), TOBN(0x92f15c52, 0x8e474b9f),
+     TOBN(0x3b3892d3, 0x46410cb1), TOBN(0x72097f22, 0x03a5a136),
+     TOBN(0xdb3a1b80, 0x98de068d), TOBN(0xfb7438e4, 0x4b1a3890),
+     TOBN(0x8a10d5ea, 0x3839d3d9), TOBN(0xd9ad034d, 0xf4bd8126),
+     TOBN(0x07d108ef, 0xd4800261), TOBN(0x978d98ba, 0x9c5d6c52),
+     TOBN(0x63ae69e1, 0xecb9ce1c), TOBN(0x70d2b437, 0x51b28f39),
+     TOBN(0xc15696b6, 0x77f848a2), TOBN(0x6b6e60f4, 0xd8ab4d76),
+     TOBN(0x33a581a4, 0x030bf112), TOBN(0x9cdb1a6e, 0xc5e74a76),
+     TOBN(0x6c6f6ec4, 0x7a950053), TOBN(0xd47dc472, 0xb04ebcff),
+     TOBN(0xe85ca76a, 0x5e0970df), TOBN(0x74448d98, 0x78988af2),
+     TOBN(0x5227649b, 0x81620019), TOBN(0x47e2ac62, 0xaabc2027),
+     TOBN(0xfea15155, 0xfbffedf2), TOBN(0xa565c484, 0x3b4cb501),
+     TOBN(0x4c523be5, 0xd830cece), TOBN(0x2e2de6bc, 0xc321a440),
+     TOBN(0xa7d62771, 0x8d69887d), TOBN(0xf9d8ac67, 0x4e138de4),
+     TOBN(0xad3fbc08, 0x9fcb0a09), TOBN(0xcaabb0b0, 0xbfc3bc9a),
+     TOBN(0x84646bc3, 0xb1c20604), TOBN(0xf1059ac4, 0xd1574260),
+     TOBN(0x5c15c6a2, 0xeefff298), TOBN(0x7975ede6, 0xf3b0a393),
+     TOBN(0x0ea9d355, 0x27c2343a), TOBN(0xe21c75e4, 0x4b32e339),
+     TOBN(0x1438785e, 0xa7fc353a), TOBN(0x0b8d64ba, 0xe9a1dd56),
+     TOBN(0xcacf9b64, 0x75347c02), TOBN(0xf788c83e, 0xcaad57aa),
+     TOBN(0x90df1ab8, 0x36ecf2e0), TOBN(0x4db604a3, 0xf45070ac),
+     TOBN(0xbc76e168, 0xb4c4ed93), TOBN(0x07177b5e, 0x85b65a6c),
+     TOBN(0x41e3c275, 0x00d21309), TOBN(0xcc9678e4, 0x76a48f42),
+     TOBN(0x3a04d197, 0xb1c6256f), TOBN(0x940920a9, 0xb2cc7330),
+     TOBN(0x990e4da8, 0x2523d52f), TOBN(0x34709b24, 0x5a59d733),
+     TOBN(0x2f0da81c, 0x8e745028), TOBN(0x32b5f384, 0xcd5668ab),
+     TOBN(0x82744a5a, 0xee538e7e), TOBN(0x1b019bab, 0xf3eb2516),
+     TOBN(0xccbd28fb, 0xd79d735f), TOBN(0x0bb54a6e, 0x85f90aa2),
+     TOBN(0xacf5552f, 0x9a69ecaf), TOBN(0xbc51ee85, 0xd1f1e30b),
+     TOBN(0x12bf8b0b, 0xfa25193d), TOBN(0x3f0f51b0, 0x5ba4b3c8),
+     TOBN(0xc1b65deb, 0x66181f23), TOBN(0xfeb037f9, 0xc0156b03),
+     TOBN(0xdd7a0a8c, 0xa9dc59ed), TOBN(0x20b5c8ea, 0x7b57e018),
+     TOBN(0x0c3ebc94, 0xefaadad5), TOBN(0x146d05b6, 0x18758eba),
+     TOBN(0xcb952e41, 0x09c7b43c), TOBN(0x7f7a0ae3, 0x1c1b8fb6),
+     TOBN(0xbca8a9cf, 0x331dfb05), TOBN(0x4a1db4a1, 0xe0db9d7d),
+     TOBN(0x988d36a3, 0xe5b9c892), TOBN(0x64640e55, 0x010ad00e),
+     TOBN(0x4c33c7e8, 0xc011bffd), TOBN(0x5d7cf370, 0xa0ad217b),
+     TOBN(0xbaf8b74a, 0x71f3df52), TOBN(0x300963bc, 0xa5995b20),
+     TOBN(0x695cf7ee, 0xd6c27636), TOBN(0x74d4d3a1, 0x03ac244e),
+     TOBN(0xddba3bd6, 0xc898e5bb), TOBN(0x27573a89, 0xfe3499f7),
+     TOBN(0x666b4415, 0x4b0a6c98), TOBN(0xf4f3e8c5, 0xaa4ccfaa),
+     TOBN(0x5f136875, 0x1a5b919b), TOBN(0xed8eb5db, 0x670d4b04),
+     TOBN(0x4cd83d19, 0x0d0d73bf), TOBN(0xd2a5c62a, 0xbdf22579),
+     TOBN(0x8c41be16, 0xc2d04c2b), TOBN(0x5aa33bc4, 0xbf9ad465),
+     TOBN(0x36e20646, 0x5e00d922), TOBN(0x9df21e7c, 0x00b70e17),
+     TOBN(0x0601e630, 0xd440af4d), TOBN(0x4aab0d33, 0x963e87dc),
+     TOBN(0x2712abdb, 0x36d39000), TOBN(0x856d7e3b, 0xf9147e2a),
+     TOBN(0xadc4a96a, 0xc8e5d2f4), TOBN(0xac3e5336, 0x2e70c206),
+     TOBN(0x1ee7d838, 0x6f6f3d0e), TOBN(0x4674ef20, 0xead72426),
+     TOBN(0x3a804dd8, 0x6af5f580), TOBN(0x724a756b, 0xd74ea5ce),
+     TOBN(0x0c2968d0, 0x0432d854), TOBN(0xe3be03f3, 0xa4f262fe),
+     TOBN(0xe446692a, 0xc84c22bb), TOBN(0x156b3168, 0x9647650d),
+     TOBN(0x4e06bc39, 0xb5d3d62a), TOBN(0xf99d4fec, 0x80eea174),
+     TOBN(0x3a2b7ae8, 0xc08f1144), TOBN(0x35e65bf9, 0x12dae8d6),
+     TOBN(0xfa0af1cf, 0xae3892b5), TOBN(0xa57062dc, 0xac408112),
+     TOBN(0xef6a9ec3, 0x24bf1af9), TOBN(0xdda3b476, 0x5decd8bc),
+     TOBN(0x9314a36c, 0x7bed3775), TOBN(0x9e254b0e, 0x60aa296e),
+     TOBN(0x8be2de80, 0x65b9cf2c), TOBN(0x1b110df6, 0xcb3b96cf),
+     TOBN(0x0f647a12, 0x18957e21), TOBN(0xa1e11238, 0x4f907766),
+     TOBN(0x751a0d82, 0xc5528977), TOBN(0x958d8738, 0x9a4b1260),
+     TOBN(0x99087543, 0x773658ee), TOBN(0x18148bbe, 0xf19f74cf),
+     TOBN(0x5f50ef19, 0x0a19a374), TOBN(0xc5bc4160, 0x6bdd3392),
+     TOBN(0x1bdf5e4b, 0xb80ad74c), TOBN(0xc40ec2f7, 0xed7e68c8),
+     TOBN(0xedd7dd6a, 0xdecef5b8), TOBN(0x3d29a1cb, 0x896c95a3),
+     TOBN(0xfa84c325, 0x70ad41d4), TOBN(0x6a577072, 0xc398c177),
+     TOBN(0x4f942d01, 0x7375f2de), TOBN(0x968a7608, 0x8aa1523a),
+     TOBN(0x55dc7da6, 0x377e5c4c), TOBN(0xb75fff53, 0x282b540e),
+     TOBN(0xfee35c15, 0xfd4b6951), TOBN(0x6d1d64f6, 0xf04ddfae),
+     TOBN(0x320f1769, 0xaf7c8714), TOBN(0x2b5f86a4, 0x482ba6fd),
+     TOBN(0xcf691cb7, 0x1ab9986b), TOBN(0x42913d71, 0x7377ba6b),
+     TOBN(0x120b4601, 0x1e47bf08), TOBN(0xfb514e52, 0x764b2661),
+     TOBN(0x371c0155, 0xa140ae04), TOBN(0x94e65b70, 0x2e186763),
+     TOBN(0x5e440f7b, 0xd5764306), TOBN(0x3411dadf, 0x7b8a5eeb),
+     TOBN(0x6c25e519, 0xf0e3e158), TOBN(0x46ee66d6, 0xe8898c80),
+     TOBN(0xa0e9d4b1, 0xec4f9b03), TOBN(0xba48d97c, 0x126c1f31),
+     TOBN(0xb9f96818, 0xbdbf0928), TOBN(0x293ce87d, 0x7f51cb48),
+     TOBN(0x077a7420, 0x76f09d38), TOBN(0xc71cb875, 0xedea4c81),
+     TOBN(0xfeda750d, 0x9ddd1485), TOBN(0x987876dc, 0x51c10504),
+     TOBN(0x4d0253f8, 0x75ec7922), TOBN(0xbcc15e39, 0xc676b336),
+     TOBN(0x33d533d8, 0xb9370740), TOBN(0xc5c482db, 0xcb8c88ab),
+     TOBN(0x1ff3f223, 0xc7c08a75), TOBN(0xccfaf564, 0x401b00fd),
+     TOBN(0x6ba93d3a, 0x6ac9757c), TOBN(0xff09b546, 0xec2c92a0),
+     TOBN(0x95d3436c, 0xc5960be8), TOBN(0x90b7e8cb, 0x69029082),
+     TOBN(0xbdd1e2b9, 0xdb6b32e5), TOBN(0xf4d2e43b, 0xfd47ad85),
+     TOBN(0x8923251e, 0xcb005dbe), TOBN(0xc21368a0, 0x662912e7),
+     TOBN(0xc7ce2963, 0x062d205c), TOBN(0x1e8f812f, 0x9542b831),
+     TOBN(0x4f8a7915, 0x818c322d), TOBN(0x50073cba, 0xfb678809),
+     TOBN(0xed7b5237, 0x0cb91b3e), TOBN(0x22d1fa41, 0x60d3fe6b),
+     TOBN(0x3de39063, 0x2d690f75), TOBN(0x12b2e39e, 0xf164ec1f),
+     TOBN(0xa28a0d83, 0x332f408f), TOBN(0xe6d9406c, 0x6a054db1),
+     TOBN(0x67369b76, 0x5ddd64e0), TOBN(0x6d671707, 0x02b21c2d),
+     TOBN(0xb9ad3368, 0xac42170f), TOBN(0x5e8f5277, 0xe5802ffa),
+     TOBN(0x1b4468fb, 0xd9b4a0a9), TOBN(0x0daf8269, 0x96c24331),
+     TOBN(0x976c2f23, 0xc09ad26d), TOBN(0xd47afe88, 0x19c68d38),
+     TOBN(0x0e96c03b, 0xd3d8d84f), TOBN(0xe05b5fd8, 0x0932b2fe),
+     TOBN(0x13931043, 0x347fbbbd), TOBN(0xe0fa842f, 0xb0ccc752),
+     TOBN(0x7295ee0f, 0xc75bf745), TOBN(0xebaae0dc, 0xb0aa9d61),
+     TOBN(0xb392d49b, 0x6355564c), TOBN(0x57e2f166, 0x887c5a18),
+     TOBN(0x88b3a014, 0x230a278a), TOBN(0x088e4908, 0x4c194449),
+     TOBN(0xc6cd309f, 0x43d6af69), TOBN(0x394445e3, 0x589a7f7e),
+     TOBN(0x0610077a, 0x031e7c08), TOBN(0xd05547cc, 0xa3519f78),
+     TOBN(0x0123b543, 0x926e26ed), TOBN(0xcd430b80, 0x62d06da6),
+     TOBN(0xddb182d0, 0x0dcd6db5), TOBN(0x724c9bce, 0x8eb6e010),
+     TOBN(0x985a2f0f, 0x50a4a597), TOBN(0x35f2427f, 0x900f2a49),
+     TOBN(0xce6136fe, 0x13cbf187), TOBN(0xc893bdee, 0x1086c2aa),
+     TOBN(0xe2410ccb, 0x07eca624), TOBN(0xeda92913, 0xddf9afb0),
+     TOBN(0x8fc0cfd0, 0x5bb66033), TOBN(0x0ab7d29b, 0x0509ffc8),
+     TOBN(0xc063b004, 0xb3d4f10a), TOBN(0xed94a955, 0xeb8cf642),
+     TOBN(0xacfb2f14, 0xa272ac4d), TOBN(0x10f2c91a, 0xc4ebbf0b),
+     TOBN(0x73f6e02e, 0x06ea04eb), TOBN(0xb969e8f8, 0x8b97ea93),
+     TOBN(0xa9b27472, 0x0cd48657), TOBN(0xe1a874ec, 0x99264937),
+     TOBN(0x34e677a4, 0xf794332d), TOBN(0x5e67865e, 0x5ee2daea),
+     TOBN(0x3fe02b91, 0xe6886879), TOBN(0xe113432f, 0x0f9776ad),
+     TOBN(0x37567306, 0x6a2c47d1), TOBN(0xf66df9b8, 0x62feb54a),
+     TOBN(0xf734ee37, 0x3e07ce56), TOBN(0x50c4982d, 0x659809fd),
+     TOBN(0xe2fa768f, 0x9daf8faa), TOBN(0x66088ddc, 0x8b9fd7c3),
+     TOBN(0xb8265661, 0x333683c6), TOBN(0xe7dacf81, 0xdff2a0a7),
+     TOBN(0x1e99d6bd, 0x5e3da06c), TOBN(0xbd50e15c, 0xbae05a25),
+     TOBN(0x47a0d997, 0x802d7b40), TOBN(0x0a25b51b, 0x193ef621),
+     TOBN(0x24d3d4f4, 0x148ee5a3), TOBN(0x7012618f, 0x022a9df0),
+     TOBN(0xb3777339, 0xf68e648f), TOBN(0xcdfb557f, 0xd7544352),
+     TOBN(0x4b0b2d46, 0x1f912c5f), TOBN(0xddaf929a, 0x957515d9),
+     TOBN(0x29e4bf1f, 0x0ae46856), TOBN(0x158b4c85, 0x44e32ab0),
+     TOBN(0x17935398, 0x7c48d2d2), TOBN(0xe4ab6300, 0x6f2430bc),
+     TOBN(0x71dd7284, 0x0d8b24d4), TOBN(0xd9303af1, 0xfc21d7e4),
+     TOBN(0x816c616f, 0x450f7f6d), TOBN(0x17875d8e, 0x3306df19),
+     TOBN(0x7ce8d4a5, 0x087e86e0), TOBN(0xa53970ac, 0x36251f01),
+     TOBN(0x2037f12c, 0xfc98edaf), TOBN(0xc359a382, 0xabf72b6f),
+     TOBN(0x06acf1a6, 0x85130fa6), TOBN(0x08f45064, 0xadfe4344),
+     TOBN(0xc01e1f3b, 0xdd857b31), TOBN(0x92c2263a, 0xc9513734),
+     TOBN(0x562652d5, 0x589327b8), TOBN(0xa8edd065, 0x96a1c164),
+     TOBN(0x2cbf8f98, 0x79f8df8d), TOBN(0x3d5cf771, 0x40847dde),
+     TOBN(0x69b08ee4, 0x597c0622), TOBN(0xfff18c4d, 0x8a868f2a),
+     TOBN(0x28bca3d2, 0xf5ad0686), TOBN(0xf7992f89, 0x2d4eef7b),
+     TOBN(0xab10b9cc, 0x3977e15d), TOBN(0x47912ca1, 0x2db8ef03),
+     TOBN(0x1f3e70e6, 0xdf27884b), TOBN(0xdd9bb81e, 0x0e9d8efa),
+     TOBN(0x97a83b6f, 0x279e27f6), TOBN(0x47e259fb, 0x24daf922),
+     TOBN(0x49eb72bc, 0x124e71be), TOBN(0x01dba001, 0x3a6778ba),
+     TOBN(0x8d02baec, 0x3be03050), TOBN(0xe3571b3c, 0x6dd6c8ef),
+     TOBN(0x6e1ffbac, 0x2cc11ffe), TOBN(0x6d725c75, 0xf4e2e6f0),
+     TOBN(0x96c31b45, 0xf2b53a58), TOBN(0xa0e38dd7, 0x97f1634b),
+     TOBN(0xe8507959, 0x143ce001), TOBN(0xad9a9f52, 0x8b49cc63),
+     TOBN(0x950fd33d, 0x8438b0fa), TOBN(0x2b294c00, 0xbe0cbdf6),
+     TOBN(0xb2076b47, 0x937b00ce), TOBN(0x026153a1, 0x78041498),
+     TOBN(0xe958f12d, 0xe9e53d27), TOBN(0xf49e1124, 0xe8f8fad9),
+     TOBN(0xb78a5b74, 0x2bca0ae1), TOBN(0x35180dec, 0xcccdc3d3),
+     TOBN(0x15e4fba5, 0xa97e519f), TOBN(0xe49dac9d, 0xf5b8340e),
+     TOBN(0xdbd8ed3a, 0xe5978024), TOBN(0xd181f26a, 0xeb105505),
+     TOBN(0x38364818, 0x29f57098), TOBN(0xd674fe1f, 0x3900171a),
+     TOBN(0x5a2ff729, 0xf1bd5803), TOBN(0x53de7261, 0xeda23387),
+     TOBN(0x7f1d84c8, 0xf0dc417c), TOBN(0xa65694a7, 0x5360fa80),
+     TOBN(0x356e4518, 0x96ed36e6), TOBN(0x127a52de, 0x406bfd36),
+     TOBN(0xb575a98e, 0xde925d04), TOBN(0x35fb44be, 0xc0627c4f),
+     TOBN(0xc85f2c69, 0x471e745a), TOBN(0x1c01e1ea, 0x6213d79e),
+     TOBN(0x95ea99a1, 0x2f5081f0), TOBN(0xdb38bd3e, 0xc3367864),
+     TOBN(0x0e8cafec, 0xd8880436), TOBN(0x1d59fd74, 0xf9c63d09),
+     TOBN(0xe57b0b4f, 0x7f875dbb), TOBN(0xe266c939, 0x77084bd7),
+     TOBN(0x0e289c5a, 0x2fc1f909), TOBN(0xece9d225, 0x86c4fc40),
+     TOBN(0xe0a56fbe, 0x5d79b4b3), TOBN(0x2b96fae7, 0xd4489041),
+     TOBN(0x0f66316b, 0xe23c85e7), TOBN(0x2d1a3c78, 0xadfef0c2),
+     TOBN(0x1aece4ad, 0x9fbce9cd), TOBN(0xccd0f334, 0x6c32d32d),
+     TOBN(0x958d7a5c, 0xfb9ba6dd), TOBN(0xa0052032, 0xe673275d),
+     TOBN(0x514ffd9d, 0x7f978d07), TOBN(0x544bbce9, 0x450b76e1),
+     TOBN(0xeaa25d74, 0x6b5201b6), TOBN(0x7528a4ea, 0x74d082a5),
+     TOBN(0xa08c8d31, 0x66609e27), TOBN(0x5150d1be, 0xda7c6fd9),
+     TOBN(0x864f5b4c, 0x39930618), TOBN(0xe71e7f1a, 0xcebb516e),
+     TOBN(0xaeee7fa5, 0xebf1f8ac), TOBN(0x6efcad4a, 0x0ea827c6),
+     TOBN(0x6e0f4ecb, 0x74e21dd8), TOBN(0xc5311600, 0xf33a7939),
+     TOBN(0xdf62f3c3, 0xa4d93fc4), TOBN(0xd3b62727, 0x9a18476d),
+     TOBN(0x0b54f5e6, 0xc0e1256b), TOBN(0xe8987efb, 0x97ba9afa),
+     TOBN(0x4b6ea064, 0x41d11c15), TOBN(0xfed7017e, 0x79b79f0f),
+     TOBN(0x5a6bcf9e, 0x5bd04e40), TOBN(0xf3090153, 0x8fd3b4bd),
+     TOBN(0xa23b5acb, 0x82240648), TOBN(0x61d9a8b1, 0xb16cf033),
+     TOBN(0x2feb1706, 0xc9fbee1e), TOBN(0xfaa4cd69, 0xd7e07918),
+     TOBN(0x28562c58, 0x447cba7a), TOBN(0x727926c4, 0xa61a1064),
+     TOBN(0x1b32db7f, 0x97ac7eff), TOBN(0xfd968b22, 0x452253ce),
+     TOBN(0x69d1842f, 0x5cdd3217), TOBN(0xba7689da, 0x26f4007d),
+     TOBN(0x16445a64, 0x141c8b35), TOBN(0xc11c3101, 0x73c61779),
+     TOBN(0xa5aa0d18, 0x485300ee), TOBN(0x531b6de1, 0x1cc02bf0),
+     TOBN(0xf8b94155, 0xc4efeb2c), TOBN(0x83632663, 0xd015a9c8),
+     TOBN(0xc369b3ce, 0xcba18b7f), TOBN(0xe11b3ef6, 0xc29e0f9b),
+     TOBN(0x1a5e9bf2, 0x903ca95b), TOBN(0x2d9aefc6, 0xa50cb332),
+     TOBN(0xb5670264, 0xb29ce693), TOBN(0x806d08ac, 0xab1d7b7e),
+     TOBN(0xcbdfdf28, 0xc9107eac), TOBN(0xa8086243, 0x6cdf12ac),
+     TOBN(0xe7d9c315, 0x903d5999), TOBN(0x4379820b, 0xc079d951),
+     TOBN(0xe789ecad, 0xbf1edf4c), TOBN(0xec086811, 0x47bc7752),
+     TOBN(0xeea2eeb8, 0xc2fc8798), TOBN(0x763183e0, 0xe031a96b),
+     TOBN(0xc7daf0b2, 0xf9a6bfaf), TOBN(0x1a2a7ffb, 0x4b957cf7),
+     TOBN(0xa483c7c8, 0xbf2d2e7d), TOBN(0xf96921fc, 0x58ff7f9c),
+     TOBN(0x41386185, 0x574ee010), TOBN(0x62e6a1d8, 0x2780c649),
+     TOBN(0xdec553af, 0x60f2516e), TOBN(0x5b091537, 0x7a04eb11),
+     TOBN(0x1b53e9dd, 0x67eb90c5), TOBN(0xc390a23a, 0xddfda333),
+     TOBN(0xdd4e7c6d, 0x480568aa), TOBN(0xd6c1e8a8, 0x59ccbe61),
+     TOBN(0x1c6fd7a9, 0x9107901b), TOBN(0x5dc4a41e, 0xa211d116),
+     TOBN(0x597e94e7, 0xaf1b78a8), TOBN(0xe72da34d, 0x53afcb6a),
+     TOBN(0xbc364db7, 0x74512c24), TOBN(0xc26a8fb9, 0xb2811e91),
+     TOBN(0xfdd39d7f, 0x290469b1), TOBN(0x84515392, 0x20612535)},
+    {TOBN(0x7fe996a0, 0x1539cf31), TOBN(0x4a3f729a, 0x0ded7c6e),
+     TOBN(0x86f1f299, 0x3016f614), TOBN(0xc3d44e18, 0x86cb9163),
+     TOBN(0x96984531, 0x558fa36c), TOBN(0x58e8bf05, 0x369c89d6),
+     TOBN(0x287da114, 0xf9ee923f), TOBN(0x2032e984, 0xec271fbc),
+     TOBN(0x91b8579d, 0xd39207ad), TOBN(0x6f62c725, 0x0b1fe916),
+     TOBN(0x0f1599ac, 0xd89e01bf), TOBN(0x8d9bb86d, 0x4d1e5843),
+     TOBN(0x348b90d4, 0x726e38d1), TOBN(0xb824a1ca, 0x52a8c6b9),
+     TOBN(0x984d9309, 0xb1d2f6f4), TOBN(0xefa485b7, 0x431ec12e),
+     TOBN(0x24cafa66, 0x9d616a5c), TOBN(0xc1c7445f, 0x4c9d0ea8),
+     TOBN(0xf733e085, 0x90bee7b6), TOBN(0xa2f3ece3, 0xd251d2ba),
+     TOBN(0x6e422a45, 0x66aeba6c), TOBN(0x35e99b16, 0x37c1337f),
+     TOBN(0x52d0fdf7, 0x6d4f8d03), TOBN(0xa043420c, 0x79c92672),
+     TOBN(0x99725607, 0x76ac1925), TOBN(0x086449db, 0x3442fc58),
+     TOBN(0x8dbab920, 0x2e311e74), TOBN(0x29dee69b, 0x7ea25561),
+     TOBN(0x5a62b6ee, 0x19a7cd6c), TOBN(0xba38cc4c, 0x0d0dd5a0),
+     TOBN(0x779279e5, 0x166d0ff1), TOBN(0x0eef53cc, 0xf48b3dae),
+     TOBN(0x0463dcaa, 0x0f82c6a6), TOBN(0x75dfc96d, 0x11d7d6d8),
+     TOBN(0x61f05e7b, 0x6c100d92), TOBN(0xa118e548, 0xe13eabb4),
+     TOBN(0xcc77e3c8, 0xdcdf06b5), TOBN(0x902d37d6, 0x6ac25960),
+     TOBN(0x967d9993, 0x347d7116), TOBN(0xd2828650, 0x9ae33561),
+     TOBN(0x955b7840, 0x8c7c6d89), TOBN(0xbfa78bc8, 0x42c2555f),
+     TOBN(0x8c56ae3d, 0xa69c3165), TOBN(0x72b20e72, 0xe33bb1bc),
+     TOBN(0x686870b4, 0xd1aa6416), TOBN(0xf000040b, 0x7db03cdd),
+     TOBN(0xd25b16a9, 0xb0a0fd40), TOBN(0xeb89e932, 0x36815f1f),
+     TOBN(0xb3e5e912, 0x349b549c), TOBN(0x801f788e, 0x086c4e74),
+     TOBN(0xafb9ea4f, 0x0082ae92), TOBN(0x4e8f27a4, 0x0d740026),
+     TOBN(0xc4f8285a, 0x05f4a6ac), TOBN(0xefea5297, 0x0adcd58c),
+     TOBN(0x9d5b6ae5, 0xc52f8c21), TOBN(0x92622a7a, 0xe97af4dd),
+     TOBN(0x39b43935, 0x79f34a8a), TOBN(0x61acf55f, 0x30046435),
+     TOBN(0xf0a23fe6, 0x3f05fdb1), TOBN(0x7d6baee1, 0x0c4fa7ff),
+     TOBN(0x253f62b6, 0xe2daf735), TOBN(0xe370ead8, 0x2948637b),
+     TOBN(0xda57c16a, 0xd84e6206), TOBN(0xf19ffe09, 0x0dd22ad3),
+     TOBN(0x701acab2, 0x95bf2003), TOBN(0x50e4e10a, 0x9dff6efc),
+     TOBN(0xe637bcf0, 0x43b95430), TOBN(0xac45cd3e, 0x85050cbc),
+     TOBN(0xc2ebff64, 0x80639e4d), TOBN(0xe5af1fb5, 0x3056f603),
+     TOBN(0x302791d5, 0x08b17132), TOBN(0x87775ac4, 0xed517904),
+     TOBN(0xfe64ed1e, 0x4263a566), TOBN(0x735bbee4, 0x1d5e8f55),
+     TOBN(0x9ac61915, 0x8294342c), TOBN(0x0f522e5a, 0xd4904935),
+     TOBN(0x2ee883b5, 0x7c1e11f4), TOBN(0x0a2ce30f, 0xf0c237f4),
+     TOBN(0xf4a7157b, 0x8d955086), TOBN(0x7ec0462e, 0x022dc2db),
+     TOBN(0x562fb75b, 0xca391b0b), TOBN(0x13030aac, 0x3bb1efd6),
+     TOBN(0x305d9831, 0x347f44fe), TOBN(0x9f70c1ad, 0x94b2615b),
+     TOBN(0xaaf935f4, 0x4162ff22), TOBN(0x2b20f047, 0xa68d160e),
+     TOBN(0x30d52a97, 0x39222d1b), TOBN(0x051223b1, 0x6551642f),
+     TOBN(0xae65a5c7, 0x39620daa), TOBN(0x8ef6f93f, 0x6f7c078f),
+     TOBN(0xb06d52bc, 0xb0177db8), TOBN(0x915cdd08, 0x68fdf535),
+     TOBN(0x0070d150, 0xc5183222), TOBN(0x2b6495cd, 0x7817a2ae),
+     TOBN(0x3ce47614, 0x0b194f0b), TOBN(0x2eec6acf, 0x513bfdfb),
+     TOBN(0x725dbede, 0xf3dbd34d), TOBN(0x01c4412a, 0x3621fc75),
+     TOBN(0x17bd68de, 0x3c07f048), TOBN(0x117df57e, 0x62e735eb),
+     TOBN(0xb1596c6d, 0xb249c407), TOBN(0xa878f56a, 0xd46c55c4),
+     TOBN(0x33385670, 0xb8aa0cb4), TOBN(0xc7faa80e, 0x800ec887),
+     TOBN(0x2cd2814f, 0xd7daf836), TOBN(0x877b72b7, 0x0d616922),
+     TOBN(0xea73ca1b, 0xdb066012), TOBN(0xbe336c7b, 0xb0d4159d),
+     TOBN(0xb993b07f, 0x0f8fcd76), TOBN(0x5fdceaba, 0x8a593562),
+     TOBN(0x716595fb, 0xf691ec19), TOBN(0x51a77f61, 0x8e68e3c0),
+     TOBN(0xe9e4cdfe, 0x7a7c18db), TOBN(0x967d3575, 0x7b4f69b7),
+     TOBN(0x6dd350a1, 0xa9a434c1), TOBN(0xb92cdef9, 0x00c79ba7),
+     TOBN(0x7a762493, 0xa6bb0f93), TOBN(0x6c18cdc2, 0x8158ad36),
+     TOBN(0xa0bd83e3, 0xc529ecfd), TOBN(0x98363c59, 0x3962f96d),
+     TOBN(0xd80f45a5, 0x1d63aa7f), TOBN(0x8d5eba75, 0xb3b32da2),
+     TOBN(0x0ef233df, 0xa4708858), TOBN(0x74c3f4f7, 0x52161c61),
+     TOBN(0xfa9bfe6b, 0xe6420de4), TOBN(0x96c0c501, 0x97dd86d5),
+     TOBN(0x28e6827b, 0xcfce233b), TOBN(0x035cc9a9, 0x58e74d63),
+     TOBN(0x9ba64bf4, 0x7948782d), TOBN(0x5e5b7c72, 0x80d9ce1a),
+     TOBN(0x7b9435db, 0xf51df862), TOBN(0xe74ab6e8, 0xb4dd2421),
+     TOBN(0xb0d704db, 0x60954c75), TOBN(0xd31c5145, 0x0b59ae5b),
+     TOBN(0xe0ff4660, 0xd99ba307), TOBN(0x1a3800fd, 0x986bd82b),
+     TOBN(0xe7e06ab7, 0x509a0a50), TOBN(0xbdf63778, 0xe4539885),
+     TOBN(0xf888320f, 0x16ddb433), TOBN(0x0f108304, 0x18e18998),
+     TOBN(0x27e7ffd6, 0xfa834b14), TOBN(0x16de9a71, 0xc68b9434),
+     TOBN(0x53a12e2c, 0x4d360436), TOBN(0x5ad2c986, 0x5e110b02),
+     TOBN(0x3439443c, 0x3cf53e0c), TOBN(0xfeae29b0, 0x1d65a7a3),
+     TOBN(0x1e7774f6, 0x78ad7d78), TOBN(0x0c79fb01, 0x6fee368c),
+     TOBN(0xbec71de1, 0xe4faf3ee), TOBN(0x1a88f3e5, 0x263868e8),
+     TOBN(0x975d8381, 0x90e91a8c), TOBN(0x69c5a65d, 0x0f999c60),
+     TOBN(0xbd3360d8, 0x8b884857), TOBN(0x04190413, 0x31b7c579),
+     TOBN(0x40dd9229, 0x142cc145), TOBN(0xb5faab94, 0xdad0b2df),
+     TOBN(0x3e7d7921, 0x52df4831), TOBN(0xcf5bd1ed, 0x228bf67d),
+     TOBN(0xd8669635, 0xc4980085), TOBN(0x094b8973, 0x1c71903d),
+     TOBN(0x493a7a3d, 0xc4abb028), TOBN(0x0e1a8fac, 0xb4ab8e35),
+     TOBN(0x26094ca2, 0x017aa5f2), TOBN(0x94fcb8b1, 0x021476cb),
+     TOBN(0x57f101f9, 0x4abf3bcd), TOBN(0x1ac2c125, 0x2d7f12a8),
+     TOBN(0x575259d9, 0x2e42789c), TOBN(0xa64a4a4b, 0x22471eb3),
+     TOBN(0xcc02304d, 0xe1c00144), TOBN(0x6269dfb9, 0x754734b2),
+     TOBN(0x72e7a183, 0xf14fbc81), TOBN(0xd92a5b1c, 0x2a05caa2),
+     TOBN(0xd593492e, 0x15efc2fb), TOBN(0x1ace7dca, 0xd8dd458b),
+     TOBN(0x576b4bc8, 0xaef2ae81), TOBN(0x6de6a2db, 0x351b397e),
+     TOBN(0x73f13b48, 0x656cf9ab), TOBN(0xc18df1c9, 0xaee7e01d),
+     TOBN(0x30fb5155, 0x560355e7), TOBN(0xd2c9a0ee, 0x9ad059d5),
+     TOBN(0xd9f89936, 0x5e5e0c7c), TOBN(0x5d0a2cbd, 0xf0a6c9d7),
+     TOBN(0x3c2c497d, 0x58fa9be9), TOBN(0xe6c6fcf2, 0x6ac61a2f),
+     TOBN(0xf7ec89e3, 0x35607bc4), TOBN(0x17ca00ca, 0x9946bf52),
+     TOBN(0xee46be5b, 0x180c8bd8), TOBN(0xd29d5eb0, 0xb2873893),
+     TOBN(0x348ac939, 0x97487b3c), TOBN(0xc18f0ceb, 0xfeef78ce),
+     TOBN(0xfc648dca, 0xf797cce5), TOBN(0xe2467e0c, 0x442148d7),
+     TOBN(0x8e201ee7, 0xda6dbaf6), TOBN(0xc1a93ee4, 0xabd0490c),
+     TOBN(0xfd0007bf, 0x4de7c210), TOBN(0x02eccb8b, 0x083ffce0),
+     TOBN(0xbba82bbb, 0x97844c8d), TOBN(0xb7ff954c, 0x2747a430),
+     TOBN(0xb05f0584, 0x18fb5f29), TOBN(0x35a29cf5, 0xee7c263f),
+     TOBN(0x5fd84efd, 0x25282da8), TOBN(0xc1fc84c1, 0x7682db7c),
+     TOBN(0x8422b56a, 0x4bb291e6), TOBN(0xce379feb, 0x66a56078),
+     TOBN(0x1c3c581e, 0xe7f045a0), TOBN(0x8f42985d, 0x6b3f89ac),
+     TOBN(0x112839e9, 0xa6b2ba59), TOBN(0x3f0c7269, 0xc2a7b29a),
+     TOBN(0xecdadb6f, 0x79bd3046), TOBN(0x669f559b, 0x9617ff6e),
+     TOBN(0x242bb14d, 0x68928ca9), TOBN(0x28e2b0cb, 0xc19cafcc),
+     TOBN(0xfb7d8954, 0x81330593), TOBN(0x5c3741fd, 0x9fbf8665),
+     TOBN(0xaf49e83a, 0xc3b93e86), TOBN(0xd60ecf7d, 0x32822548),
+     TOBN(0x4bf36759, 0x7cfb37cd), TOBN(0x94b0c7f0, 0xdb7af2ed),
+     TOBN(0x2f1bebf6, 0xebf8b461), TOBN(0x90ebc9c7, 0x073e5c18),
+     TOBN(0xe431c793, 0x3774e905), TOBN(0xb8a4bc2f, 0xe03265bb),
+     TOBN(0x0bee0825, 0xfabb629e), TOBN(0xbd1481dc, 0x84557170),
+     TOBN(0xa2257b58, 0xe1a010a0), TOBN(0x43f5451c, 0x4688bb89),
+     TOBN(0xb87a5ff0, 0x91b96371), TOBN(0x445dd02f, 0xde3c7b25),
+     TOBN(0x44c0c080, 0x51a0964c), TOBN(0xb0c3190e, 0x9afdcefa),
+     TOBN(0x14cc65ad, 0x0044d258), TOBN(0x8c500b3e, 0x374fdd44),
+     TOBN(0xed8d840f, 0x51b07812), TOBN(0xd414a4a2, 0x76530691),
+     TOBN(0x9db9d138, 0x1468ef8d), TOBN(0xfc6b7434, 0x292b3870),
+     TOBN(0x80b66797, 0xc9d7ad96), TOBN(0x81e74eb6, 0x2a9c1e99),
+     TOBN(0x48657d9a, 0x9e92f64b), TOBN(0xf5c60075, 0x4c851ddd),
+     TOBN(0x08fa89be, 0xd99d5cfe), TOBN(0x78b1f26e, 0x4db4addf),
+     TOBN(0x03237177, 0x3523ead9), TOBN(0x0147af5c, 0x6a281494),
+     TOBN(0x8db3952a, 0x916836b0), TOBN(0x0632b102, 0xfd365650),
+     TOBN(0x3854a8e9, 0xccb3f2f1), TOBN(0x5048486c, 0x586ad427),
+     TOBN(0x22de9979, 0x17a86e18), TOBN(0xe2ac2321, 0xbe029111),
+     TOBN(0xbfd34397, 0x35cc5a17), TOBN(0x7a93461f, 0x525e13cf),
+     TOBN(0xd433542c, 0x5122d6f1), TOBN(0x41d2d9de, 0x833982c7),
+     TOBN(0xe9f1f29a, 0x8ec24d27), TOBN(0x4ae251f3, 0xf3b99d58),
+     TOBN(0x7234dd24, 0x10adb458), TOBN(0x0e4b6567, 0x88379ef5),
+     TOBN(0x3007df15, 0x748dba5d), TOBN(0x1485ef01, 0x35103772),
+     TOBN(0xe21a9dc9, 0x29c2382f), TOBN(0xcf7e0c24, 0x6b6c1c8d),
+     TOBN(0xf8a71820, 0x30550c0a), TOBN(0xb30e5c0f, 0xb797de2e),
+     TOBN(0xbe136119, 0x03705145), TOBN(0xe6d1f720, 0xf94aadc7),
+     TOBN(0x38ce1872, 0x255f5297), TOBN(0xbbba4793, 0xc3143f58),
+     TOBN(0xda5345fe, 0x0984e265), TOBN(0xe93989d6, 0xd895e0d7),
+     TOBN(0xb7392b18, 0xcaab40a3), TOBN(0x4a586963, 0x65e754fc),
+     TOBN(0xb3e88445, 0xa3afd381), TOBN(0xa6cbab0a, 0x693ad961),
+     TOBN(0x64d51359, 0x257d56dc), TOBN(0xf9e70fcc, 0xbbde137a),
+     TOBN(0xa33872fa, 0xadd016b1), TOBN(0xd1d263d2, 0x7344f234),
+     TOBN(0xc2d51210, 0x24ba41b2), TOBN(0x8c9c830c, 0xe4ab65cb),
+     TOBN(0x3b47563c, 0x175b4039), TOBN(0x53521dfd, 0x116b2025),
+     TOBN(0xe4f3aa89, 0x1a9f1cca), TOBN(0xcc73485c, 0xe7cb1d2b),
+     TOBN(0xa6ca61ef, 0xbf58fe30), TOBN(0x5d50e15d, 0x531a2b6a),
+     TOBN(0x71cfdb41, 0x22611c31), TOBN(0x0dc15533, 0x61e3d46a),
+     TOBN(0xb363c60b, 0x479074ba), TOBN(0x2a4d8f4c, 0x24cb405d),
+     TOBN(0x3d3bee13, 0x646b7f0a), TOBN(0xdfa9194c, 0x5571af63),
+     TOBN(0x951a61a7, 0xee76521c), TOBN(0x67466ba5, 0x65eda1f1),
+     TOBN(0xe41d33b8, 0x69ebc7ea), TOBN(0x8b6c992d, 0xd4f4848f),
+     TOBN(0x3572faac, 0xa5003eaa), TOBN(0x01e36500, 0xabf54df1),
+     TOBN(0x6622f12f, 0xac6f3af7), TOBN(0xb5d7c17f, 0x0a8bb122),
+     TOBN(0xd1fc1b99, 0x240286b1), TOBN(0x519d52ce, 0xad968ede),
+     TOBN(0xcd1e7d0c, 0xece28bb4), TOBN(0x64ffc699, 0x93f0b097),
+     TOBN(0xb18d51f8, 0x25af7d81), TOBN(0x8d0bb08f, 0x19820fb2),
+     TOBN(0xe9f45919, 0xaa344723), TOBN(0x558f18ea, 0x5f9e0501),
+     TOBN(0x56eff076, 0x07cc79dc), TOBN(0xf171e880, 0xd5fa9783),
+     TOBN(0xd5fb41f3, 0x8be7f1fe), TOBN(0x19a34620, 0xd6fe9afc),
+     TOBN(0x74c2696b, 0x7d8a042a), TOBN(0xcf4908c3, 0x54230ded),
+     TOBN(0x98a870d8, 0xdb32943b), TOBN(0x181cbe5c, 0x52f33e07),
+     TOBN(0x4d9d1172, 0x93709d8b), TOBN(0xb800c292, 0x2b2b7939),
+     TOBN(0xd5a1fb7a, 0xa8920f60), TOBN(0x8d0a7725, 0xbf7df622),
+     TOBN(0x83a370cf, 0xe9415cf4), TOBN(0x9f24d1e1, 0x62a4ff4d),
+     TOBN(0xca33914b, 0x0a6ff7cb), TOBN(0x2576f2d8, 0xda1d1aaf),
+     TOBN(0xbb2668bd, 0xb4793101), TOBN(0xb576672c, 0xca990b4f),
+     TOBN(0xfa165b5f, 0xff1d3988), TOBN(0x273d5b18, 0xba8c9e2c),
+     TOBN(0x13594ae5, 0x720a5b3f), TOBN(0x38c4e04a, 0x2e65454c),
+     TOBN(0xc5b55d98, 0x55d0d903), TOBN(0xfabeb890, 0xf72db301),
+     TOBN(0xe471f1d5, 0x2f3deaa2), TOBN(0x3f8d39f5, 0xc5ade08d),
+     TOBN(0xe08486a4, 0x6baf9d1a), TOBN(0x77c6d30e, 0xe5140d3b),
+     TOBN(0x828db96a, 0xd23d4e09), TOBN(0x2de4856d, 0x84dcac15),
+     TOBN(0x313c7f8b, 0xa6ac856d), TOBN(0x7c9f671c, 0xfe7dea98),
+     TOBN(0x4d6c14a5, 0xfebe9e72), TOBN(0x185ac4e6, 0x6014be55),
+     TOBN(0x42809988, 0x5ed64e23), TOBN(0xdc9395a1, 0xbd6440fe),
+     TOBN(0x10169080, 0x24108055), TOBN(0xfe0d9cb0, 0x38961403),
+     TOBN(0xf88e6a48, 0xceb87d29), TOBN(0x0365ca2f, 0x69618944),
+     TOBN(0x1504647e, 0x9fb59ec9), TOBN(0xb6486b3b, 0xa4aadbb7),
+     TOBN(0xfe8701af, 0x22ef3214), TOBN(0x4c895bc1, 0x5f56d985),
+     TOBN(0x6fdc6cb6, 0x2e1e68d2), TOBN(0x0689b22b, 0x13f07350),
+     TOBN(0xba94416b, 0x6d62eb1f), TOBN(0x5a2fcbba, 0x98996d72),
+     TOBN(0x2ca2a2e9, 0x04b2afed), TOBN(0x5b62c764, 0x0bf61008),
+     TOBN(0x30074e57, 0x37f4d486), TOBN(0x4e02be2a, 0x31865287),
+     TOBN(0x401cfb89, 0x6842ab16), TOBN(0x440fb52d, 0x5b2eb304),
+     TOBN(0x3245fd38, 0xd22eaa61), TOBN(0x252120e8, 0x373f201e),
+     TOBN(0x4d253f5c, 0xb2e724c9), TOBN(0x9428d6be, 0x27e5b5e4),
+     TOBN(0x00d4c598, 0x6785ee9c), TOBN(0x0b7fc5f9, 0x56208d4b),
+     TOBN(0x4426665d, 0x92310137), TOBN(0x75b96cd3, 0xfee8da95),
+     TOBN(0xaaaac6c3, 0xb561c6d8), TOBN(0x0784a3c5, 0x3f09e1d9),
+     TOBN(0xac78c064, 0xdcac620b), TOBN(0x49dd5f02, 0x119b8d90),
+     TOBN(0xf1f5ebf2, 0x57e5caf4), TOBN(0xd8a9fa2d, 0x0eb825e2),
+     TOBN(0x3553633a, 0xbfb6a2fd), TOBN(0x06533515, 0xa0c9ce9a),
+     TOBN(0x6decd9e8, 0x04c71728), TOBN(0xcbc0df55, 0x980b29bd),
+     TOBN(0x17b1b559, 0x31826d15), TOBN(0xc96ed7d7, 0x1c5cae17),
+     TOBN(0x24f58740, 0x88cda83e), TOBN(0x9e2ee1bc, 0x0c69f40f),
+     TOBN(0x138ebf0f, 0x9e5604ed), TOBN(0x0577f4c2, 0xf229f097),
+     TOBN(0x0a44f975, 0x9762825f), TOBN(0x113b8639, 0xdd085e55),
+     TOBN(0x4be02fee, 0x73acc59e), TOBN(0x7829f288, 0xada7a17d),
+     TOBN(0x086bd736, 0x84fb30d4), TOBN(0xb2f120ee, 0xe5338eca),
+     TOBN(0x21701393, 0xfb778d2f), TOBN(0xd46bc61e, 0x6441fd75),
+     TOBN(0x466671de, 0x135b55bc), TOBN(0xee1d9cbb, 0x51c0f145),
+     TOBN(0x7a7bce67, 0x6d9ce27c), TOBN(0xa8c9b1e0, 0x26d82b1d),
+     TOBN(0x250bee03, 0x4c87bd6e), TOBN(0xd6b02f71, 0xd3829702),
+     TOBN(0xf14b3748, 0x0e555d98), TOBN(0xf795e62a, 0x6f775e78),
+     TOBN(0xe9a4e4ac, 0x8f46de18), TOBN(0x773bd32a, 0xc5ab76ef),
+     TOBN(0x4f2dcc68, 0x5264cae9), TOBN(0x453b627e, 0xc63a6419),
+     TOBN(0xc3aeddd1, 0xe441c6d9), TOBN(0x669500b7, 0x3027b8f3),
+     TOBN(0x06b93413, 0x88d601e5), TOBN(0x0e996e87, 0x76c4483c),
+     TOBN(0xe2ff3a6d, 0x00eb0c21), TOBN(0x86ec3a73, 0xf4690674),
+     TOBN(0x673d123e, 0xe9f82ca7), TOBN(0x952c2765, 0xbf611d0c),
+     TOBN(0x26ed9a68, 0x3676497d), TOBN(0x2c9c0049, 0x9d29cefc),
+     TOBN(0x0b8c12fe, 0x2ae73af6), TOBN(0x555b0ab3, 0x6455c8e1),
+     TOBN(0xd2f49f03, 0x4804b006), TOBN(0x408a22bc, 0x02e829a0),
+     TOBN(0xde2a59cf, 0xf2832c53), TOBN(0x01332439, 0x96a54082),
+     TOBN(0x11dc4ab6, 0xbbd38f9f), TOBN(0x0248fd93, 0xa24764b5),
+     TOBN(0xc7774c12, 0x1374972a), TOBN(0xc7355966, 0x92764b41),
+     TOBN(0x31c10ea5, 0x23143092), TOBN(0xe89d9f88, 0x9070137f),
+     TOBN(0x7d074406, 0xa504d91e), TOBN(0xc5210379, 0x70b7aa8c),
+     TOBN(0xa67904f8, 0xea799dd8), TOBN(0x81e6516b, 0xe7b02c04),
+     TOBN(0x18daf05f, 0xb08cc6fe), TOBN(0xfbbd3061, 0xf59d49f6),
+     TOBN(0x5429b117, 0x93a78581), TOBN(0x795a4465, 0x1906df65),
+     TOBN(0x643c37e3, 0xd51a7866), TOBN(0x69b8118d, 0x663a17b1),
+     TOBN(0x5e385989, 0x3e8a2c53), TOBN(0xbc18c2ea, 0x50f007d2),
+     TOBN(0x4adec20a, 0xb616aa15), TOBN(0x99f77e49, 0xea085548),
+     TOBN(0x9108c205, 0xc01b9a33), TOBN(0x298fbeb1, 0x6ef3bcef),
+     TOBN(0xdf1a8d2e, 0xefd8ba0e), TOBN(0xf0ec9492, 0xe9756e7b),
+     TOBN(0x4fd33389, 0x7ff5fbc3), TOBN(0x122a6bfb, 0x03ac8371),
+     TOBN(0x7d053c8c, 0x90d66732), TOBN(0x83f26571, 0xf9b2909f),
+     TOBN(0x350dd6d0, 0x66cba4b6), TOBN(0x8c71c17a, 0x40d0d47d),
+     TOBN(0x3bf85053, 0x4d0be34a), TOBN(0x91ae4f59, 0xe11bd49f),
+     TOBN(0xf8a38b41, 0xa22c648f), TOBN(0xcb96620e, 0x58abaaea),
+     TOBN(0xa55cee46, 0xa7fabcf5), TOBN(0xd16a8b92, 0x79c8fbce),
+     TOBN(0x26ad700b, 0xcbf048bf), TOBN(0x83b3ce11, 0x47bb5f1d),
+     TOBN(0x31a48f46, 0x6b310318), TOBN(0x13a7f781, 0x00612ef3),
+     TOBN(0xcd840f2a, 0xa18db234), TOBN(0x3be2a7a8, 0x30611c74),
+     TOBN(0xbdf37cb2, 0x2b1c0447), TOBN(0x7f572382, 0xfe71722d),
+     TOBN(0x085b3566, 0x25535e86), TOBN(0xb5b43063, 0x3f5b9cc2),
+     TOBN(0x7c7cff51, 0xdee66228), TOBN(0xe29236ae, 0xb676fd6e),
+     TOBN(0xf0c0105e, 0xab0cdb1a), TOBN(0x0adc9d6e, 0x06b52812),
+     TOBN(0xc9e6ca97, 0x483baf0f), TOBN(0x09b063bf, 0xf9bf5055),
+     TOBN(0x8c4c6b2a, 0xfc5a407f), TOBN(0xe29cb487, 0x99a6f540),
+     TOBN(0x18b72239, 0xcb9a2758), TOBN(0xa0ae9f10, 0x8a5ed308),
+     TOBN(0x2a2cb603, 0x6e402657), TOBN(0x9c7f52cf, 0xaf6f4d14),
+     TOBN(0x0ed032e7, 0x70ca9046), TOBN(0xe4b0b1d3, 0x59cac9e9),
+     TOBN(0xd12c87b0, 0x18462dfd), TOBN(0xa25a23ee, 0xbb8860dd),
+     TOBN(0x6c9a8676, 0x507fa3d9), TOBN(0xc6bb96c4, 0x218f325f),
+     TOBN(0xe141bbb8, 0x2386b7b2), TOBN(0xf86a72d0, 0xd4183c77),
+     TOBN(0x35537f86, 0xaece96b6), TOBN(0x83aa1df9, 0x63f7e1fa),
+     TOBN(0xa39ab4aa, 0x7ac4aaf2), TOBN(0xb8d0ffa6, 0x8a202375),
+     TOBN(0xd916df09, 0x86514cd8), TOBN(0x71f905b3, 0x11902747),
+     TOBN(0x6388c2ee, 0x8c744f32), TOBN(0x6282e1f5, 0xa5431096),
+     TOBN(0x14bfa765, 0x7c388413), TOBN(0x95dd04d9, 0x7b4437aa),
+     TOBN(0xdf6ca849, 0x3c39d7c3), TOBN(0x85cb1123, 0x0c2ddf38),
+     TOBN(0xf7766d86, 0xc401529c), TOBN(0xe33416a8, 0x99a4d031),
+     TOBN(0x5c507c3f, 0xb874ace4), TOBN(0x0e3a42b6, 0xdad6fcb0),
+     TOBN(0x402da460, 0x47920742), TOBN(0xb142d6ef, 0xb45f94cc),
+     TOBN(0xc2d613e8, 0x76608dd4), TOBN(0xa2c06cdd, 0x5d75d4b5),
+     TOBN(0xa1951bc5, 0x3c564ff4), TOBN(0xe60f126b, 0xad1d5ecd),
+     TOBN(0xa634e765, 0x702135ad), TOBN(0xa5a56a6e, 0x8df44695)},
+    {TOBN(0x234b8c7a, 0x9e2207b4), TOBN(0x1f724f30, 0xf7ee9f62),
+     TOBN(0xfa908ca2, 0xc58e21b6), TOBN(0x55587744, 0xa74296ae),
+     TOBN(0x7dbe9130, 0x02911ae1), TOBN(0xc2075433, 0x9d3af02e),
+     TOBN(0x505b724b, 0x0f3955a1), TOBN(0x480e1a92, 0xcaeced66),
+     TOBN(0xb20f6128, 0x446d9f66), TOBN(0xd6e06b14, 0xc354b5a1),
+     TOBN(0xa72d287d, 0x63558aac), TOBN(0x4819be29, 0xae68a8fd),
+     TOBN(0xb024c324, 0x205fbdf2), TOBN(0x2fca94e7, 0x210927f9),
+     TOBN(0x74798be7, 0xbe658f80), TOBN(0x618e07f1, 0xef07c046),
+     TOBN(0xfba715fc, 0xb35a8c3d), TOBN(0xc2548193, 0xed1beba8),
+     TOBN(0xb956c6dd, 0x2ceb663c), TOBN(0x13d4ddbe, 0xaacafe85),
+     TOBN(0x2f8275b5, 0x30a29cc3), TOBN(0x10432e15, 0xf51b39ef),
+     TOBN(0xd6c9277c, 0x2509b2d0), TOBN(0x4ee0d4c3, 0x849b946c),
+     TOBN(0x547ba946, 0x54b01bbc), TOBN(0x7c56c36d, 0x055d4821),
+     TOBN(0x8e933620, 0x05575f20), TOBN(0xaec65be9, 0x3a621cf4),
+     TOBN(0x820b96df, 0x46287937), TOBN(0x35cea883, 0x733c67e7),
+     TOBN(0x30366a3a, 0x58cf3e05), TOBN(0x2580d565, 0x2da39773),
+     TOBN(0x7717c42f, 0xba4417ed), TOBN(0xb2d66fc7, 0x654c1086),
+     TOBN(0x07fe918e, 0x57503cd8), TOBN(0xf9385159, 0x3cacf74f),
+     TOBN(0x157d9081, 0x63063029), TOBN(0x79c84c08, 0x659034cf),
+     TOBN(0x02976610, 0xa8048cb9), TOBN(0xef822006, 0x03e81417),
+     TOBN(0x5fb5dd4d, 0x22e489c6), TOBN(0x9a06d9c2, 0x81e167e9),
+     TOBN(0x83fc248f, 0x6b974c90), TOBN(0xb78cab72, 0x7110dca6),
+     TOBN(0x73f8f311, 0x370ff66a), TOBN(0x8c5049eb, 0x3b61d20f),
+     TOBN(0xaac47edb, 0xc8516e05), TOBN(0x2ceba50d, 0x53f0201b),
+     TOBN(0x6679dc5e, 0x0b93fbc7), TOBN(0xf4457919, 0xa560bd27),
+     TOBN(0x2561bfca, 0xb1acadc9), TOBN(0x338fbb6d, 0x46708164),
+     TOBN(0x9f407621, 0x8b9cfd27), TOBN(0xe806c1e6, 0xd3123732),
+     TOBN(0xaa1eafc4, 0x7f24a161), TOBN(0xbee3f4a1, 0x68e6650b),
+     TOBN(0x453b6181, 0x5832cd6c), TOBN(0xc002e337, 0x985e90ba),
+     TOBN(0x4b33afde, 0x6414f686), TOBN(0xf9ab29e9, 0x8511fd45),
+     TOBN(0x067f0972, 0x6fb9a688), TOBN(0x7db6e14c, 0x7202a1b3),
+     TOBN(0x0c15b6e9, 0x73a881ab), TOBN(0xc8c324e0, 0xfad10660),
+     TOBN(0xa997a6d2, 0x87d9f927), TOBN(0x62307f24, 0xacd2f107),
+     TOBN(0xed7b48a5, 0x9c80a742), TOBN(0xecd33ae5, 0xa7c81e7e),
+     TOBN(0xcf05c763, 0xefa00a94), TOBN(0x38844b0d, 0xd9ee5aa7),
+     TOBN(0x02e0b05d, 0x214b293f), TOBN(0x732e776b, 0x8a8a510e),
+     TOBN(0x784cd909, 0x6c929e53), TOBN(0xe436e294, 0x56a33da2),
+     TOBN(0x68eeb727, 0xce9e06d2), TOBN(0x637890b3, 0xfce7e2f0),
+     TOBN(0xc0681a1c, 0xc3fde38c), TOBN(0x9cb729d9, 0x76dda134),
+     TOBN(0xaa69eb97, 0x5c333ece), TOBN(0xe138a680, 0x48eed8a6),
+     TOBN(0xd53cbd01, 0x505dc701), TOBN(0x413de346, 0x6a64c3d1),
+     TOBN(0x91f6cde9, 0x3170a5bf), TOBN(0x58ffdfd9, 0x8489b5fa),
+     TOBN(0xcc0b89d7, 0x5c584a48), TOBN(0x74f8ceed, 0x167f28de),
+     TOBN(0x250fa9f7, 0x8c878c91), TOBN(0xeb960a79, 0x630adfdb),
+     TOBN(0xe43ed412, 0xc9489dcb), TOBN(0xcec053a5, 0x112d084b),
+     TOBN(0x0fd4fe42, 0x664c7cd2), TOBN(0x48ee06f4, 0x82a917f7),
+     TOBN(0xc5de1970, 0x83cd65f5), TOBN(0x3a176578, 0x5569c42f),
+     TOBN(0xf24508f3, 0x4f876110), TOBN(0xf350374b, 0x0a415bc4),
+     TOBN(0x9c2b11c2, 0xc63aa8ad), TOBN(0x6ac1ae12, 0x7a51c0cc),
+     TOBN(0x75acd0d7, 0xe1db428f), TOBN(0x9e391227, 0x19800684),
+     TOBN(0x4f89e9c6, 0xb1050426), TOBN(0x099d97cc, 0xdaf99eee),
+     TOBN(0x27a19ad0, 0x1ffce97f), TOBN(0x05fad057, 0x3c038d77),
+     TOBN(0x96d6c678, 0x8597d09c), TOBN(0x38f6336c, 0x1e1d8b57),
+     TOBN(0x1f945bef, 0x6330ace7), TOBN(0x9d627bbb, 0x613f9faf),
+     TOBN(0xc0e7f21b, 0x19176cb7), TOBN(0xf0e09be3, 0xbb9db710),
+     TOBN(0x16b06011, 0xc650133c), TOBN(0x8629b975, 0xf3673d7c),
+     TOBN(0x8c8230b2, 0x67115575), TOBN(0x9bfc55b1, 0x9c9f30c0),
+     TOBN(0x132d0e07, 0xce93fd71), TOBN(0x08e4736e, 0x511c5947),
+     TOBN(0xd54a098e, 0xfe881630), TOBN(0x8ec67a85, 0x98efa501),
+     TOBN(0x72975dc7, 0x2267db00), TOBN(0x3d6fc706, 0xa338290d),
+     TOBN(0x0c891082, 0x55ade88b), TOBN(0x0525b501, 0x4b212e85),
+     TOBN(0x9ede010b, 0xb61362fa), TOBN(0x52f3d088, 0x881eecac),
+     TOBN(0x49957b6e, 0xbc6f0ae4), TOBN(0x25fe7263, 0x1659701d),
+     TOBN(0x41e9b7f5, 0x07b76f45), TOBN(0x5f2ad664, 0xbda77d42),
+     TOBN(0x5bdcb490, 0xa9c418c4), TOBN(0xd0e2c38d, 0xe500a527),
+     TOBN(0x0af29f6b, 0xca83fada), TOBN(0x1f75b1f2, 0x62273db6),
+     TOBN(0x8454f751, 0x9e857e57), TOBN(0x3fb816d1, 0xb9e79612),
+     TOBN(0xbe3040ae, 0x6412b5f3), TOBN(0x99535136, 0x843ca984),
+     TOBN(0xb26ec8a8, 0x3257f19d), TOBN(0xd32dc622, 0xe54dd785),
+     TOBN(0x0c52e874, 0xf8698ab5), TOBN(0xf9a60af5, 0x79183316),
+     TOBN(0x38575d53, 0xf7f4496a), TOBN(0x33adfd1e, 0x3d5cd0de),
+     TOBN(0x2133f4a1, 0x7f502017), TOBN(0x46c09393, 0x3e8676f8),
+     TOBN(0xca8a5a58, 0x3fb4c7fe), TOBN(0x2ad58826, 0x328ff257),
+     TOBN(0xd9264875, 0x13b8d08d), TOBN(0x661ae2b2, 0xdc5a845a),
+     TOBN(0xd2dcaa06, 0x49a408d3), TOBN(0x9ef164f8, 0x85c21e84),
+     TOBN(0x55efaf85, 0xb7819b61), TOBN(0x9488bb1c, 0xf504c32a),
+     TOBN(0xb571518c, 0x9bb777fc), TOBN(0xf369c391, 0x82415187),
+     TOBN(0x2d7c5dd9, 0x2720284b), TOBN(0x6feab634, 0x4eec41cc),
+     TOBN(0x2522d5db, 0x24ecd0be), TOBN(0x1fca0d97, 0x00338736),
+     TOBN(0x74416105, 0x20145279), TOBN(0xf4492e1e, 0x0496e925),
+     TOBN(0xa62e09fc, 0xbc33b547), TOBN(0x9434475a, 0xae063835),
+     TOBN(0x51edd69f, 0xa139b769), TOBN(0x17bbe224, 0xe5166a9d),
+     TOBN(0x6ecb0a02, 0x1b4b6c84), TOBN(0x16439490, 0x97968c70),
+     TOBN(0x75af0456, 0xbc8aa671), TOBN(0xaef056ab, 0x3b4411ff),
+     TOBN(0x686b7714, 0x05cef121), TOBN(0x5ad6bdf3, 0x078f4500),
+     TOBN(0x56df858c, 0x072e70eb), TOBN(0xa0fc5e6f, 0x254c0917),
+     TOBN(0x1a99de09, 0xc15bf9cf), TOBN(0x8aeb587a, 0xd008aacb),
+     TOBN(0xba2d8c53, 0xb900d652), TOBN(0x60eb5d0c, 0xad0f69b6),
+     TOBN(0x27098ff8, 0x10b27762), TOBN(0x33329ca9, 0x13264ed3),
+     TOBN(0xffceaf40, 0x887e3f40), TOBN(0x854b8284, 0x930df9ef),
+     TOBN(0xdda913a8, 0x7d5627be), TOBN(0x8eb94d64, 0x35e9823b),
+     TOBN(0x94c527fd, 0x2eb9e9bd), TOBN(0x18335b1b, 0xf57b9f74),
+     TOBN(0x3c44dac0, 0xd193a526), TOBN(0xd0717099, 0xe2b2d54f),
+     TOBN(0x65624fb4, 0xc4c67d11), TOBN(0x04aa7033, 0xbccedad8),
+     TOBN(0x0c522fac, 0x31470c52), TOBN(0x08eb33ca, 0x33b05d54),
+     TOBN(0x940e0693, 0xb4565e57), TOBN(0x7e2fd553, 0x7be56370),
+     TOBN(0xf722793c, 0x12e206ff), TOBN(0xb57e1f23, 0x155d3d02),
+     TOBN(0xd68be193, 0x94fc6ce3), TOBN(0xb0f3606c, 0x22d4815b),
+     TOBN(0xdaf995a9, 0xb62d5741), TOBN(0xa7d19980, 0x3e8f5df5),
+     TOBN(0x7bcdb661, 0xe4631583), TOBN(0x013193e3, 0x5a97dc7e),
+     TOBN(0x8210be46, 0xfc73494b), TOBN(0x508817ee, 0x57e10efc),
+     TOBN(0x7b6b8da2, 0x126f2466), TOBN(0x2f3b0ec6, 0x177bee35),
+     TOBN(0x5ceb71e0, 0x48db1eef), TOBN(0xd989d9c3, 0xdc62b6bc),
+     TOBN(0x2cc38cb9, 0xf78fac92), TOBN(0xcd2a009f, 0x955ba5f4),
+     TOBN(0x65a74191, 0x453b668e), TOBN(0x40e9dc38, 0xc081b447),
+     TOBN(0x48eb63bf, 0x8c3fdf2c), TOBN(0x7845cf66, 0x5763071a),
+     TOBN(0x30d9b771, 0x787754ca), TOBN(0x10b3729f, 0x8783a05a),
+     TOBN(0xf8090b3b, 0x6ab570d9), TOBN(0xc1dfbde1, 0x502b3558),
+     TOBN(0xa568f5d0, 0xbe4d36ec), TOBN(0x1e9e5393, 0x28e952fe),
+     TOBN(0x768113f9, 0xeaad6b24), TOBN(0x2bc798fc, 0xa8fbede9),
+     TOBN(0x2c787f9b, 0xaaa9010d), TOBN(0x32cbc77a, 0x761834ca),
+     TOBN(0x449e55f7, 0x032c25d8), TOBN(0xe824a5bf, 0xca6216dd),
+     TOBN(0x3beaec52, 0x17ac1130), TOBN(0xcc28c64b, 0x5e9d1aa8),
+     TOBN(0x355d68bf, 0x3af8c635), TOBN(0xcd12e443, 0xd3d1adaa),
+     TOBN(0xa456daca, 0x6c2030d8), TOBN(0x0dfe5bbb, 0x62427eff),
+     TOBN(0xae45325d, 0xf69e2484), TOBN(0xfc2a90ab, 0x7245c979),
+     TOBN(0xc34f38e9, 0xa008b446), TOBN(0x5e86163d, 0xaac355e0),
+     TOBN(0x61432646, 0xd586a2fa), TOBN(0xc68c7c8e, 0x3d92e0c3),
+     TOBN(0xbfa8c268, 0x020c1dd6), TOBN(0x25788741, 0x8bbcc223),
+     TOBN(0xbaf8c9a3, 0xef62642c), TOBN(0x6d2f1ae5, 0xa8c496d2),
+     TOBN(0x92d1c805, 0x44e57ce4), TOBN(0x34cdf4a3, 0xaacd2100),
+     TOBN(0xd5b89e4d, 0x31e9c649), TOBN(0x558a6e26, 0x232cfc85),
+     TOBN(0xb40f3e4a, 0xcea31a31), TOBN(0x346c1e07, 0x35c5c924),
+     TOBN(0x8ffedd8e, 0x3fcede81), TOBN(0x35269ba3, 0x3b55d143),
+     TOBN(0x0366065a, 0x848bdc53), TOBN(0xba2af074, 0x078554dd),
+     TOBN(0x3c755fba, 0x19ff3b4d), TOBN(0x5ea93372, 0x35a22cbb),
+     TOBN(0x0e55fe02, 0x1eb3e23b), TOBN(0x2626ecca, 0x765dede4),
+     TOBN(0x187bf094, 0x81f445da), TOBN(0xba011017, 0x9df30578),
+     TOBN(0x81148037, 0xd72507f2), TOBN(0x3a5841fc, 0x5db072d0),
+     TOBN(0xfd631862, 0xbd910aa1), TOBN(0x17b22d68, 0x23881c60),
+     TOBN(0x6fa799cb, 0xfcc13359), TOBN(0x55c40219, 0x2d39fc5a),
+     TOBN(0xd50bfff6, 0x9f1f6515), TOBN(0x575090b5, 0x2e30fa1a),
+     TOBN(0x70343a0b, 0x9ba20c27), TOBN(0xef34db86, 0x749306a5),
+     TOBN(0xd7ad61d2, 0x4ba85f8d), TOBN(0xe4d24ad8, 0x7e091a33),
+     TOBN(0xbd6b49b9, 0xfc348493), TOBN(0x4f11b543, 0x299c325d),
+     TOBN(0x4574a254, 0x55036e93), TOBN(0x534a623e, 0x676b75d9),
+     TOBN(0x54aa3d8a, 0x7d05afbd), TOBN(0x13349009, 0x7f3f2c90),
+     TOBN(0xcd03de0f, 0xa94b18aa), TOBN(0x13123c18, 0x855c050d),
+     TOBN(0x747c3cda, 0xf598b5f8), TOBN(0x0f7ed9b6, 0x8644df20),
+     TOBN(0x45e010fd, 0x08d73585), TOBN(0x3b0ff430, 0xf8cec4af),
+     TOBN(0x3745a41f, 0xb028a832), TOBN(0xcd6d2468, 0xc4106172),
+     TOBN(0x56c5a9b0, 0x1eceac6f), TOBN(0x769c1285, 0xe1e6e980),
+     TOBN(0xbd163a36, 0xfa113196), TOBN(0x206ffc36, 0x5840c242),
+     TOBN(0x12de1147, 0x9c57ef67), TOBN(0x50260273, 0x03bea885),
+     TOBN(0x3099c21b, 0x9684d63f), TOBN(0x06adb196, 0xc7c66691),
+     TOBN(0x8464492c, 0x3d63b3be), TOBN(0x86024ef4, 0x0bd38c15),
+     TOBN(0x226022a2, 0x10565cbf), TOBN(0x2ae6b298, 0xc9899033),
+     TOBN(0x5564856b, 0x262ffa14), TOBN(0x9472d0e1, 0x7e038b55),
+     TOBN(0x1b17ea07, 0xb1dd268f), TOBN(0x8340b9d5, 0x4899352e),
+     TOBN(0x4f159400, 0x75242992), TOBN(0xe4392a31, 0xe6727e9d),
+     TOBN(0x4df1ef86, 0xaef59026), TOBN(0xe40671ff, 0x950cfee6),
+     TOBN(0x7b36d1cd, 0xde4dd990), TOBN(0x25df10a6, 0x3366ff4b),
+     TOBN(0x83fb7e59, 0x584ef631), TOBN(0xf12dd400, 0x91af7b6a),
+     TOBN(0x4a5ae41e, 0xe26f11c7), TOBN(0xeb86d5dd, 0x96d90445),
+     TOBN(0x028ae37e, 0xa355d0a3), TOBN(0x3c118ef4, 0x99260127),
+     TOBN(0xb8c7538c, 0x76f51bd7), TOBN(0x66b90aae, 0x5fbadc4d),
+     TOBN(0x078de9df, 0x17dfd0cf), TOBN(0x938df6da, 0xfe44b17c),
+     TOBN(0x4a09616b, 0xc40bc950), TOBN(0x0b507845, 0xbc969aac),
+     TOBN(0x23bae091, 0x35f7fb82), TOBN(0xebc04d37, 0x9ad29b83),
+     TOBN(0x9fa48a5b, 0x26a3c5fa), TOBN(0xf67c661c, 0xf08f3d8c),
+     TOBN(0x21825747, 0xb2e9c3a1), TOBN(0x3520a82e, 0x46c3eb43),
+     TOBN(0xe309ae9f, 0x9646183d), TOBN(0xa19c31be, 0x26dac288),
+     TOBN(0x3c37018d, 0xc76623de), TOBN(0x59b9a0fa, 0x64b51087),
+     TOBN(0xa32f8357, 0xf1954f4e), TOBN(0x24251df4, 0x1f6da143),
+     TOBN(0x825c61cf, 0x01fb07d0), TOBN(0x69ae93fd, 0xf2f0243c),
+     TOBN(0xd507c99e, 0x0943f7bd), TOBN(0x5e6dfb09, 0x463ee64a),
+     TOBN(0x10a3c32a, 0x29afd00b), TOBN(0x92179b5f, 0xbe8cbada),
+     TOBN(0x7bebad0a, 0x7d89f9a6), TOBN(0x7ba9bbf6, 0xd13b3073),
+     TOBN(0xfc23c215, 0x6481cc75), TOBN(0x6a654801, 0xfeca7532),
+     TOBN(0x20785ec0, 0x0fed841f), TOBN(0xcb612be9, 0x25269b21),
+     TOBN(0xe9a9c09b, 0x414a0fab), TOBN(0x5404c7a7, 0x6b4fa0dd),
+     TOBN(0xde62dae8, 0xcb418588), TOBN(0x2d80afd4, 0xc594334e),
+     TOBN(0xfe454df1, 0x95366a44), TOBN(0xda7626c3, 0x755cf8b2),
+     TOBN(0x4446f0ab, 0x41397051), TOBN(0xd1788064, 0x70eb8b23),
+     TOBN(0xbc7737f1, 0x977b040a), TOBN(0xbfb39418, 0x57590edb),
+     TOBN(0xb094b4a8, 0x343a7333), TOBN(0xb15912ce, 0xeb91372f),
+     TOBN(0x584e1d5e, 0x0b56002c), TOBN(0x1460ce24, 0xaa0cb90f),
+     TOBN(0x58f0c144, 0x8f7ffcb6), TOBN(0x56e39f33, 0xbe0d802e),
+     TOBN(0xb02a6edb, 0x529458d0), TOBN(0xa0fbae74, 0xa730f9d5),
+     TOBN(0xd98c0ac5, 0x1bf69928), TOBN(0x5c9f888f, 0x796f12e9),
+     TOBN(0x749207b0, 0x22e065c8), TOBN(0x6e0232a4, 0x88c61143),
+     TOBN(0x27f30808, 0x837adda6), TOBN(0x0b748853, 0xd0c215d5),
+     TOBN(0x97bc4008, 0xbf076ba7), TOBN(0xadae0275, 0xf157f4d2),
+     TOBN(0x394e5d7a, 0x8bcba88b), TOBN(0xf995ec14, 0x23ef50ad),
+     TOBN(0x6b207f9c, 0xaa9b60a9), TOBN(0xcd7509c1, 0x52f9979f),
+     TOBN(0xe3e8f6dc, 0x0834e0ad), TOBN(0x6e2a4165, 0xcd5b1314),
+     TOBN(0x073a2db3, 0xfd60d975), TOBN(0x5ad92ca4, 0x2c053b7a),
+     TOBN(0xceb10220, 0xfba97ae8), TOBN(0xab82f6a0, 0xd265e913),
+     TOBN(0xc7a755ad, 0xaa68a13d), TOBN(0x56c13360, 0x10dd277a),
+     TOBN(0xbbcf6411, 0xdef56183), TOBN(0xebffe360, 0xb863a4e1),
+     TOBN(0x67ff26e5, 0x814e8aec), TOBN(0x90553561, 0xa0804732),
+     TOBN(0x407396ac, 0xad5fe672), TOBN(0x053a068b, 0x11ad53af),
+     TOBN(0xb518dd04, 0xc652cb95), TOBN(0xc818563a, 0x57e2b99f),
+     TOBN(0x217cf87d, 0xb96432a7), TOBN(0x7fdc35be, 0x8cc2fdcd),
+     TOBN(0x8c2ef271, 0x4effaebf), TOBN(0x21879369, 0xf427c7c2),
+     TOBN(0xd80ebbea, 0x5197ba08), TOBN(0x1b00db45, 0xfc6f4c66),
+     TOBN(0x99b9d2be, 0x3828a5c0), TOBN(0xa8855350, 0xd24a69e8),
+     TOBN(0x2f919695, 0x3ceaa821), TOBN(0x89390c91, 0x04296439),
+     TOBN(0xc12b3852, 0xc5cf8a0c), TOBN(0xdcf234ea, 0x73afc431),
+     TOBN(0xdddf5568, 0xf4adf01b), TOBN(0x2d04fc76, 0x1b426097),
+     TOBN(0x02a21dd5, 0xcb27c5e0), TOBN(0x01b842c3, 0xa6b2f9b3),
+     TOBN(0xefbd483e, 0xd8bd7a07), TOBN(0x0220825e, 0xd13a781e),
+     TOBN(0x8aa029a0, 0xde802c17), TOBN(0xb62fcd6e, 0x3a3f0fbf),
+     TOBN(0x80558aff, 0xe9635f48), TOBN(0xbdc6851d, 0x65dbeb2d),
+     TOBN(0x99f48286, 0xb5412271), TOBN(0xa53ef798, 0xe242a8a3),
+     TOBN(0x41d18606, 0xc0371086), TOBN(0x5df3379c, 0xfcb6d1aa),
+     TOBN(0x53f2f5a1, 0x00a7a13e), TOBN(0x3565a6eb, 0x2bf51e2a),
+     TOBN(0xa2832b52, 0x930c5a71), TOBN(0x66071ec7, 0xee2abfcb),
+     TOBN(0x75ce0a56, 0x3496a532), TOBN(0xa316dfbb, 0xbe0d69b7),
+     TOBN(0x35438d6a, 0x353e94fc), TOBN(0xf53433c1, 0x1e0ce775),
+     TOBN(0x47ea3e8f, 0x22ff3a1d), TOBN(0x60ebfba8, 0xcd7ccdb6),
+     TOBN(0x47c6b6e2, 0x33c475d0), TOBN(0xd18637e7, 0xb7959fd5),
+     TOBN(0x8d7a35ce, 0xa1ae3404), TOBN(0xf15c71d6, 0x75b832bf),
+     TOBN(0x65047419, 0x98b9d24b), TOBN(0x28625a55, 0x0dcf73f4),
+     TOBN(0x5aa9dce8, 0xc7c99478), TOBN(0x752d1625, 0x0bde8d53),
+     TOBN(0x7255ecfa, 0x93e99ee4), TOBN(0x1c53bf71, 0x22706f48),
+     TOBN(0x28335451, 0x4d478014), TOBN(0xd64b05ff, 0x3f392c0a),
+     TOBN(0x1d9ac89d, 0x4fba1661), TOBN(0x281a0ffb, 0x34828cd8),
+     TOBN(0x07abacdd, 0x577ed419), TOBN(0xa66949f5, 0x3cfb2c56),
+     TOBN(0x38e69105, 0x847ebe65), TOBN(0x8fbbba5a, 0x44d6236d),
+     TOBN(0x0c85bd64, 0x725ef820), TOBN(0x4ef91524, 0x25a152a7),
+     TOBN(0x5237ef0e, 0xb019cebf), TOBN(0x48203f41, 0xc9a7724f),
+     TOBN(0x1f61885c, 0xc55fc0d4), TOBN(0x2c4dd07a, 0xbcb3daeb),
+     TOBN(0x9855d5e7, 0x4b7dafc5), TOBN(0xd76e6fdf, 0x5f3769af),
+     TOBN(0xb834df1a, 0xbb547be6), TOBN(0x43056b12, 0x3e7a9586),
+     TOBN(0x7459e0bb, 0x4375fc7e), TOBN(0x5f5f295a, 0x9c85fc6b),
+     TOBN(0x3f2d2bb7, 0xbb23b709), TOBN(0x0b53bd8c, 0x955983ce),
+     TOBN(0x5aee93df, 0xfaf68dcc), TOBN(0x5575770c, 0x509f09dc),
+     TOBN(0x2bf23c0c, 0x40b1b744), TOBN(0x524154bb, 0x9a5bb913),
+     TOBN(0xb0e93d76, 0x296bdb2e), TOBN(0xb3c71f5b, 0xda0b2925),
+     TOBN(0x8e77ae7a, 0x0c617939), TOBN(0x2bfea97e, 0x1aca9b0a),
+     TOBN(0x8e3317c9, 0x7897c5a8), TOBN(0x850ddefb, 0x4cee2716),
+     TOBN(0x684ceee9, 0x107d9186), TOBN(0x48708423, 0x0082c312),
+     TOBN(0x5300137c, 0x6c556897), TOBN(0x6d464401, 0x7e99bc76),
+     TOBN(0x6b11e1e3, 0x8808ca2b), TOBN(0xedd30eee, 0xcca6433e),
+     TOBN(0xa9099f60, 0xaa072ff0), TOBN(0x774662ec, 0x5830f69d),
+     TOBN(0x0770355c, 0xf94547d9), TOBN(0xb5041edb, 0x42967865),
+     TOBN(0x169a6274, 0xe585a93b), TOBN(0x06cebf5e, 0xd04d6a81),
+     TOBN(0x0a59450f, 0x2ebc1791), TOBN(0x69fd006e, 0x765ac18a),
+     TOBN(0x4711ec9c, 0xa54f7e7a), TOBN(0xd72c8d58, 0x819c6af9),
+     TOBN(0x89c97c6c, 0xb5418e15), TOBN(0xd520b03c, 0xa558a854),
+     TOBN(0xe3c24aca, 0x0d76773a), TOBN(0xc4deb5ce, 0x67e5110e),
+     TOBN(0x5bb40152, 0xcbb04ba4), TOBN(0x672563b6, 0xde1b628a),
+     TOBN(0xaec916aa, 0x2e8d9e54), TOBN(0xa4e8cb47, 0x3c60ac70),
+     TOBN(0x54a03e39, 0x452d5064), TOBN(0x1e405c2d, 0x1e7bb355),
+     TOBN(0x2ab2d5df, 0x3bbd3ab0), TOBN(0x0808410e, 0xdbc9fbd8),
+     TOBN(0x4180ceea, 0x27f23f6f), TOBN(0x2b965b35, 0xba1d6beb),
+     TOBN(0x14f1f010, 0xf66d6546), TOBN(0xefdca6a8, 0xf85cfb4a),
+     TOBN(0x69e6188e, 0x6614c1c0), TOBN(0x00bd1531, 0xe07cb7f8),
+     TOBN(0x1b90f515, 0x4bb7ee68), TOBN(0x8afdf466, 0x51abb1f3),
+     TOBN(0xf59a7327, 0xb5f34316), TOBN(0x43c3c19d, 0x64c7bf22),
+     TOBN(0xb275733f, 0xcdb00a2b), TOBN(0x0160df79, 0x602915ba),
+     TOBN(0x1ae4ee9a, 0x1baea574), TOBN(0x0d922f28, 0x03ae5168),
+     TOBN(0x07df28fd, 0xca691124), TOBN(0x5aad2f31, 0x8dd457c4),
+     TOBN(0xe0d4f443, 0x137384ca), TOBN(0xd93d424a, 0x6620ea8c),
+     TOBN(0x21d544d3, 0x5067797a), TOBN(0xc8a8cc99, 0x9d8a15bc)},
+    {TOBN(0x610f0e26, 0x941d80a3), TOBN(0x30927879, 0xad36514e),
+     TOBN(0xaa2dfd48, 0x98f22601), TOBN(0xbc5b31b7, 0x88c8b0f6),
+     TOBN(0xb1281f37, 0x6c841cc8), TOBN(0xdae16719, 0x5a412b84),
+     TOBN(0x9ec1f6c8, 0x828f210d), TOBN(0x1935d576, 0xe8d92901),
+     TOBN(0x47247921, 0xaf3840f2), TOBN(0x348325d2, 0xdf3fcdfc),
+     TOBN(0xef578508, 0xc43961bd), TOBN(0x7d5e8ccd, 0x1bd98c29),
+     TOBN(0x59cdba10, 0xf8a30164), TOBN(0x0757408f, 0x7cb8c653),
+     TOBN(0xcd7ed73f, 0xc3056ef4), TOBN(0xd28e7cc1, 0xfb99cd1b),
+     TOBN(0xa8a67494, 0x6bb62286), TOBN(0x8d6ef816, 0xe7d87467),
+     TOBN(0x3529f938, 0xf673b6d5), TOBN(0xf5c0ee76, 0x8bbf101b),
+     TOBN(0x3768ed61, 0x49fdc949), TOBN(0x53b6999e, 0xcf405ee0),
+     TOBN(0xbf0108a0, 0x1718e51a), TOBN(0x38e609ec, 0x5181ebd7),
+     TOBN(0x82051640, 0xd8595159), TOBN(0x30e1c706, 0x579a3876),
+     TOBN(0x091154c6, 0x0298a67c), TOBN(0x76d9a9c9, 0x51132d27),
+     TOBN(0xe41de8b7, 0x5c661a4d), TOBN(0xf24b5e96, 0x2a6dcbaf),
+     TOBN(0x1ed4cb0c, 0xd714e045), TOBN(0x605926a4, 0x0c187c70),
+     TOBN(0x97672559, 0xf34b1c93), TOBN(0xa256be98, 0xe0b43506),
+     TOBN(0x7fcdd412, 0xe1a98eb3), TOBN(0x7fcfcd84, 0x295a061b),
+     TOBN(0xddbac22b, 0xcc2386cf), TOBN(0x7741adb7, 0x928c2556),
+     TOBN(0x3a2bb869, 0x4e6e1288), TOBN(0x53ed11da, 0x025bb4a1),
+     TOBN(0xb114bd67, 0x4108c8e2), TOBN(0x85948c6b, 0x3deb8e23),
+     TOBN(0x6a9e05d9, 0xd0e9434c), TOBN(0x395060b7, 0xb9c4fd70),
+     TOBN(0xa0ccfd16, 0x18893751), TOBN(0xa941ff60, 0xbbf65477),
+     TOBN(0x34ada238, 0x59423e35), TOBN(0x4ba7a7d1, 0x7e570058),
+     TOBN(0x3d05d455, 0x869ae596), TOBN(0x92a15400, 0x93368325),
+     TOBN(0xbd64ae0a, 0x62eb7ffa), TOBN(0x3f263a7a, 0xd34b2c59),
+     TOBN(0xe95eece3, 0xa22244e1), TOBN(0x39ccef58, 0x706fc500),
+     TOBN(0x39a88f93, 0x22f1d2e6), TOBN(0x1ec796b3, 0x6d47c670),
+     TOBN(0x1558e0f2, 0xaa1ff4af), TOBN(0x61f43487, 0x390503a4),
+     TOBN(0x66164732, 0x3c4f76f1), TOBN(0x50d0706e, 0x9e13432e),
+     TOBN(0x5f1a87ca, 0xf5eba0fb), TOBN(0x28a95c0f, 0x80bda2c5),
+     TOBN(0x10d693e0, 0x12ae6462), TOBN(0x79871340, 0xf45e6ba6),
+     TOBN(0x8abf0cad, 0x887051c0), TOBN(0xd09f571d, 0xb3c6b540),
+     TOBN(0x3fb2e16b, 0xe30ab25d), TOBN(0x12e057a7, 0x539e8bc4),
+     TOBN(0x6efe71ce, 0x733c2597), TOBN(0x72fa0df5, 0xe71058ac),
+     TOBN(0x49f14d06, 0xccc037bf), TOBN(0x9a3ceb03, 0xceb3eb6c),
+     TOBN(0x9895e908, 0x4195370a), TOBN(0xa75007e5, 0x927345e7),
+     TOBN(0x00b4c212, 0xd3850711), TOBN(0x76e4060d, 0xdfee8b34),
+     TOBN(0x15801862, 0x184c1d07), TOBN(0x234e39c0, 0x302f5711),
+     TOBN(0x4c0bd387, 0x6aa74204), TOBN(0x0515eddc, 0x6f496836),
+     TOBN(0xa9fd0cb5, 0xc849afbe), TOBN(0x041df5ba, 0xcad5c0aa),
+     TOBN(0x9a54af37, 0xddff259e), TOBN(0xa3f156bf, 0x9b550a8e),
+     TOBN(0x4df2d33d, 0x7e3298d4), TOBN(0x0957a0a0, 0x65ff0e1a),
+     TOBN(0xff7fb43d, 0x1e2b3a45), TOBN(0xb86d386a, 0x1a73285a),
+     TOBN(0x6e283c47, 0x28b18e93), TOBN(0x5458b92f, 0x4b4132ed),
+     TOBN(0x7026345e, 0xba674332), TOBN(0xc8e38151, 0x5c9fc32d),
+     TOBN(0xd6aaf8e1, 0x58e7b4fe), TOBN(0x3e77a5c9, 0x4267253a),
+     TOBN(0x6441cba2, 0xa0949607), TOBN(0xfa205185, 0xdee20b2e),
+     TOBN(0x64f3d576, 0xf5b44600), TOBN(0xf12125db, 0xef5c8446),
+     TOBN(0x1467539b, 0x487a0116), TOBN(0x3aa0fa49, 0xf380229a),
+     TOBN(0xcc6586f1, 0xd79f36dc), TOBN(0xebcf653d, 0x1b9a0b42),
+     TOBN(0x68af006d, 0x9c1df729), TOBN(0x507e055a, 0xa7903ee6),
+     TOBN(0xd1b48ef8, 0xafd8ac9b), TOBN(0xd8920af7, 0x3b5f6b51),
+     TOBN(0x9629e789, 0x983339c8), TOBN(0xbfd2d787, 0xfa9248d3),
+     TOBN(0xb50ca302, 0x9a078882), TOBN(0x1c34f848, 0xf5cb0529),
+     TOBN(0xb9b01519, 0x1646a9f8), TOBN(0xc9e3679e, 0x80d53f9d),
+     TOBN(0x5a63e822, 0x1af3e5f2), TOBN(0x05480ad8, 0xff58e3d1),
+     TOBN(0x2d241643, 0xd6b3626b), TOBN(0x33b15660, 0xc1eda15f),
+     TOBN(0x3e74f855, 0x8528e5d6), TOBN(0xafb6dc9a, 0xf63188f4),
+     TOBN(0x0cac44cb, 0xaeeb1d32), TOBN(0x50661046, 0xa627eff8),
+     TOBN(0xadc4b012, 0x64b49667), TOBN(0xa4bdafa7, 0x1e05f760),
+     TOBN(0x171b28b3, 0xf185d27a), TOBN(0x987e5163, 0x33425747),
+     TOBN(0x7c42ac4e, 0xc3864a65), TOBN(0x2dae1bb8, 0xbf449c12),
+     TOBN(0x680d9743, 0x06965832), TOBN(0x6ac1ef01, 0x7e31d9f4),
+     TOBN(0xdef57433, 0x579d6ae4), TOBN(0xe055b087, 0xd5240bf9),
+     TOBN(0xe4dbbe60, 0x90a5e069), TOBN(0x2161d5fe, 0xddb3dc15),
+     TOBN(0x7d303012, 0xda297b71), TOBN(0x04481034, 0xd468046c),
+     TOBN(0xaa94d5bb, 0x0ac93c6c), TOBN(0x95bacd45, 0xd8d8f53a),
+     TOBN(0x790a5d6f, 0x3e03e895), TOBN(0x27efd502, 0x44fa5a81),
+     TOBN(0xd9d35230, 0xe5998b32), TOBN(0xb36a0c07, 0xf22ade19),
+     TOBN(0x46ec8691, 0xf979a2fe), TOBN(0xa67ba933, 0xced8cb94),
+     TOBN(0x00d07245, 0x2f856ab3), TOBN(0xadc9ff42, 0x3c925dae),
+     TOBN(0x0e4eaa25, 0x563038a5), TOBN(0xfef7e89c, 0x8a8f6483),
+     TOBN(0x50433633, 0xace61af8), TOBN(0x8a1589e0, 0x2e1a3515),
+     TOBN(0x99f21e29, 0x5fdcb1ac), TOBN(0x8fd2d411, 0xc9a466da),
+     TOBN(0x55323c6f, 0xf56b7f13), TOBN(0xa016d64a, 0x5cff438c),
+     TOBN(0x3e3dfcbc, 0xdc05b5cc), TOBN(0xc1956ca8, 0xfc3c70ec),
+     TOBN(0x7dbbd169, 0xe63f02df), TOBN(0x95206689, 0x240b87c8),
+     TOBN(0x7bacda5e, 0x1aa6d48a), TOBN(0x51dcf19f, 0x39280f78),
+     TOBN(0x1511ae04, 0x660abac2), TOBN(0x3a95adc9, 0xd905af53),
+     TOBN(0x0c8c4330, 0xea464737), TOBN(0x989c09c4, 0x34fc4b51),
+     TOBN(0x1852120d, 0xe2cf3376), TOBN(0x5a1cb8a8, 0x25c04de3),
+     TOBN(0x50486f98, 0x75fe7596), TOBN(0x8cd78d2e, 0x223030b1),
+     TOBN(0x524cb8f8, 0xcfa1ab11), TOBN(0xa716ea3f, 0x5a15b0b9),
+     TOBN(0x7618e95e, 0xb902d114), TOBN(0x0a1a4146, 0x084ebf5d),
+     TOBN(0xdfb909e9, 0xe3f87683), TOBN(0xa0b7eee1, 0x4107410c),
+     TOBN(0xa45a551c, 0xf02b0e12), TOBN(0xceabbfd2, 0x9efccb9f),
+     TOBN(0xb0d1b6bc, 0x740f4e3a), TOBN(0xfc737250, 0x4cbfd0de),
+     TOBN(0x3fad2d9e, 0x32452b0e), TOBN(0xb4e659fe, 0xf523527d),
+     TOBN(0xf0dcd701, 0x6c0ff353), TOBN(0x28f06e2a, 0xd67b6f98),
+     TOBN(0x2d0c36ce, 0x82a789b4), TOBN(0x20e577da, 0x49c0d54e),
+     TOBN(0x8d1d5c7f, 0xae38dd0e), TOBN(0x72e01399, 0x894d9143),
+     TOBN(0xf7806856, 0x3958e055), TOBN(0xac35ee40, 0x5df44aee),
+     TOBN(0x2b478913, 0x97c18b8d), TOBN(0x5396824e, 0xfa2586cd),
+     TOBN(0x22b37b25, 0x1b23f8c4), TOBN(0xf9ced36e, 0xcdecdefa),
+     TOBN(0x28c3bee5, 0xc2fc39c0), TOBN(0xa1731fae, 0x6d9db32b),
+     TOBN(0xa0445fa7, 0xbc3e2c91), TOBN(0xa1ab6955, 0x75a4aa72),
+     TOBN(0xf0cd61c6, 0xbbe0a1c7), TOBN(0x923c3b69, 0x0123bc52),
+     TOBN(0x818ad28c, 0xafd7c4bc), TOBN(0x7c229224, 0x28b15b05),
+     TOBN(0xecde7efb, 0x1f78a4f4), TOBN(0x550d68e7, 0x03ef3ab3),
+     TOBN(0x0371021d, 0xfc5f8c35), TOBN(0x4440aa1e, 0x0ed2b06e),
+     TOBN(0x70c8ede9, 0x9ba7247d), TOBN(0x0d2b6ed3, 0x84f23fde),
+     TOBN(0xd0119d95, 0x5ff4478c), TOBN(0x66152d27, 0xf79c69d5),
+     TOBN(0x56d8bea4, 0x02afd13b), TOBN(0x035efe5f, 0x15bb938a),
+     TOBN(0xc5ca7d08, 0x2ccaa425), TOBN(0xc8c69ea6, 0xeeee9376),
+     TOBN(0xb22cfe59, 0x493a2051), TOBN(0xcb50e618, 0xdc7b90fb),
+     TOBN(0x0f6fdf2b, 0xe05a8705), TOBN(0x081f3fe7, 0x4814df31),
+     TOBN(0x6fefe18a, 0xeb1e3e76), TOBN(0x81910050, 0x03e06a50),
+     TOBN(0x8a801df1, 0xdb45bfea), TOBN(0x8c7fe1fd, 0x7a828cf6),
+     TOBN(0x1c1868b5, 0x8d173cfd), TOBN(0xe18f0a36, 0x0dbde1c8),
+     TOBN(0x3b29ed64, 0x9ac345b6), TOBN(0xd56d5956, 0x9dcd07a5),
+     TOBN(0xf4191570, 0xc6813a88), TOBN(0x39033ebc, 0xeda3af42),
+     TOBN(0xdee5591b, 0xad5d215d), TOBN(0x9cfa11c6, 0xafbe5a28),
+     TOBN(0x73d0f1e2, 0x1823c28f), TOBN(0x75d49925, 0xafab1f67),
+     TOBN(0x61c81e2c, 0x7c521448), TOBN(0xc547be6f, 0x4a96edb5),
+     TOBN(0xccb9fc59, 0x4ca368b3), TOBN(0x175ebe48, 0x04fc3303),
+     TOBN(0x507620cf, 0xfce42989), TOBN(0xf236e043, 0x9abfadb2),
+     TOBN(0x381c50c3, 0xab36ab58), TOBN(0xed4cb73e, 0xae22c6a3),
+     TOBN(0xa68a2827, 0x2158dc4c), TOBN(0x1715ac43, 0xe9fa53ff),
+     TOBN(0xb02fdf73, 0xfa266797), TOBN(0x3079f3c7, 0x7eefb203),
+     TOBN(0x0a41fb94, 0x7f7545bd), TOBN(0x6b9dd022, 0xcb923ace),
+     TOBN(0x582c7ff5, 0x3bea2541), TOBN(0x992f2379, 0x5ecdbe2d),
+     TOBN(0x821f1670, 0xfe17bdca), TOBN(0x521c06f2, 0x2626bdde),
+     TOBN(0x6292748c, 0x1864ca0b), TOBN(0x554d4ece, 0x1bc74d8b),
+     TOBN(0x745d4f74, 0xea3d4446), TOBN(0xa439f178, 0x40ad1c7f),
+     TOBN(0xc95d9510, 0x51374e92), TOBN(0x75870e9f, 0x90229008),
+     TOBN(0x3fec98c2, 0xc54e7e81), TOBN(0xef537ee9, 0x94b3860b),
+     TOBN(0x139dd834, 0x40bfc8f6), TOBN(0x20b51364, 0x0f114403),
+     TOBN(0x4752a49f, 0x30b4b4db), TOBN(0xdfbb8b17, 0x8c3c90e0),
+     TOBN(0x60c8915b, 0x70f0b16a), TOBN(0x5e395000, 0x40528319),
+     TOBN(0x8a1624c7, 0xa641f2e3), TOBN(0x3c9925c6, 0xbb4ca0dc),
+     TOBN(0x2aae6edb, 0x2c3152b5), TOBN(0x8dbac580, 0x08b896ff),
+     TOBN(0xe0516205, 0xe5a36bc8), TOBN(0xd7714332, 0x3295707b),
+     TOBN(0x61db6804, 0x51c3513f), TOBN(0xf2ee6e20, 0xab552df8),
+     TOBN(0x5ddcfa99, 0x353c17f0), TOBN(0x65687a2f, 0x046d5fd4),
+     TOBN(0xef567e9f, 0xfd1ccad4), TOBN(0x7cd5f7dd, 0xa0238b70),
+     TOBN(0x96fba79e, 0x92c01197), TOBN(0x46a9f2de, 0x83b50e70),
+     TOBN(0x7efcbbb2, 0xfe287169), TOBN(0xe30d60cb, 0x4528d67d),
+     TOBN(0x88fed0cc, 0x6cb04d3a), TOBN(0x63eb9d0d, 0x0221ceb8),
+     TOBN(0xc6954e9f, 0x748b5813), TOBN(0xceef2bd8, 0x5c96e897),
+     TOBN(0x99503ae2, 0x85648f04), TOBN(0xeee51f99, 0x923e87d7),
+     TOBN(0x90908fca, 0xb6560ceb), TOBN(0xafad5926, 0x80e0f6b3),
+     TOBN(0xa50f31f3, 0xaea32cf9), TOBN(0x7ea17064, 0xa74ae92d),
+     TOBN(0x0675ccc1, 0xcda71d1a), TOBN(0xd1e3b630, 0x1e0a464a),
+     TOBN(0xa361f2b7, 0x2442872d), TOBN(0xb21bcd39, 0x46e52c97),
+     TOBN(0x1405f89c, 0x85574630), TOBN(0x0da7bfbd, 0x8e0a96ab),
+     TOBN(0x48af06c2, 0x4220f57b), TOBN(0x772a9b12, 0x6a333e4f),
+     TOBN(0x3afc661e, 0x6f712eb8), TOBN(0x29deff6c, 0x2eba8817),
+     TOBN(0xbab680de, 0xd8c69e5a), TOBN(0xf8615abb, 0xe93daf10),
+     TOBN(0x7455ea1d, 0xcef6fae6), TOBN(0xac0a30ea, 0x868455fd),
+     TOBN(0xae967b17, 0xe47d628a), TOBN(0xa6d703e2, 0x65f1f482),
+     TOBN(0x2723a965, 0x0bfcc371), TOBN(0x9b06cc14, 0x6db4a042),
+     TOBN(0xa973d738, 0xa77c8b21), TOBN(0x9a981f80, 0xc008f2ed),
+     TOBN(0xecc7bbcb, 0xaf27cdb3), TOBN(0x514db964, 0xb5cb693a),
+     TOBN(0x24125414, 0xe75c93d1), TOBN(0xd9308c0e, 0x1f00d53c),
+     TOBN(0xdb56d155, 0x831eba6d), TOBN(0x29eefc2c, 0x672b86f1),
+     TOBN(0x332f6ab6, 0xdd13b3c9), TOBN(0x70e052f6, 0xe371f873),
+     TOBN(0x05740742, 0x125712ab), TOBN(0x4239152d, 0xb3512100),
+     TOBN(0x98355eaa, 0x80b22915), TOBN(0xd0e263ec, 0xb896f6fa),
+     TOBN(0x9378a8a6, 0x442b4c8f), TOBN(0x40c2b546, 0xf65795bb),
+     TOBN(0x0cfa46ed, 0xd572ead8), TOBN(0xb9b4abdb, 0x78361300),
+     TOBN(0x5fe63ef1, 0x8c102020), TOBN(0x1805c84e, 0x785a4b54),
+     TOBN(0x147cf487, 0x805cb642), TOBN(0x87cf50aa, 0x487e581f),
+     TOBN(0xe942fa5b, 0x9eaebcd0), TOBN(0x06d4fa96, 0xd1af71f2),
+     TOBN(0x20c1a770, 0xc4fc3823), TOBN(0xcdffd09e, 0x85140885),
+     TOBN(0x27ce78ab, 0x6b3592e9), TOBN(0xb8e8c15e, 0x8ba82008),
+     TOBN(0x5fe8f3f0, 0xfef74187), TOBN(0x8e85a3a5, 0x77ce808d),
+     TOBN(0x8447dc69, 0xc7395f64), TOBN(0xae90769f, 0x1181b854),
+     TOBN(0x54adc101, 0x456114c8), TOBN(0xe7962b76, 0x9ca6a9c1),
+     TOBN(0x3f0e77fb, 0x909410a4), TOBN(0xe18151cd, 0x9e2e44f9),
+     TOBN(0x5e510a0a, 0x2cf6e29e), TOBN(0x136896ab, 0xb1836b07),
+     TOBN(0x3ad4fdec, 0x0fe11010), TOBN(0x35b36790, 0xdbddf038),
+     TOBN(0x7c4f5a68, 0x75903df9), TOBN(0x3e9cb056, 0x2f5b7193),
+     TOBN(0x745e9452, 0x591a4524), TOBN(0xc406ad44, 0x1a056e15),
+     TOBN(0x2e93edf2, 0xa69e11ef), TOBN(0xa28b82fd, 0x73a1cb88),
+     TOBN(0xdc1c9cda, 0x1225c3d5), TOBN(0x86e9a994, 0xa5569794),
+     TOBN(0xd698506e, 0x5b092dde), TOBN(0x076a4c82, 0xd1ca8b06),
+     TOBN(0x4516033b, 0x2ef2bc6f), TOBN(0x0574c792, 0xd78fa65f),
+     TOBN(0xa3b1c3d8, 0x735bb362), TOBN(0x22fca7a4, 0x0da54317),
+     TOBN(0x3e7ae709, 0x60aaebb6), TOBN(0x42417d54, 0x937638c1),
+     TOBN(0x32f00a5d, 0x1dfe8b0e), TOBN(0x8ea5e8e1, 0x8dcdbdbc),
+     TOBN(0x38df57cb, 0x6b30ea52), TOBN(0xd325aa1c, 0xe94c30ca),
+     TOBN(0x7aa04a9d, 0xdce4d256), TOBN(0x78e98cd3, 0x74c7db6b),
+     TOBN(0x631475a8, 0x443d5c9f), TOBN(0x34e5c73a, 0x7adfbceb),
+     TOBN(0x7fb69bab, 0x9f1e8828), TOBN(0xcadc78be, 0xc84149e3),
+     TOBN(0xe9424ecc, 0x1fe86af8), TOBN(0x13160cc8, 0xbc504ea8),
+     TOBN(0xcb380078, 0x4c96a680), TOBN(0x006fb9d8, 0x845faae5),
+     TOBN(0xc6a64277, 0x1e0e66d1), TOBN(0x13f77d6e, 0x428f526d),
+     TOBN(0x9f80fe8c, 0x28474530), TOBN(0x5649a173, 0xdb7fec00),
+     TOBN(0xdeed5bf4, 0xd9cb05ca), TOBN(0x14b1a3a9, 0xd7077c41),
+     TOBN(0x4c2ed239, 0x096883ec), TOBN(0xd550edfe, 0x44ae671d),
+     TOBN(0xb233e5dc, 0xf7b7362a), TOBN(0x32c15820, 0x4fd464f2),
+     TOBN(0x0ecb18f7, 0x68880bf9), TOBN(0x53468bed, 0xaf230a34),
+     TOBN(0xe3ba97b9, 0x370cd6ef), TOBN(0xf5cdabf4, 0x3516d77e),
+     TOBN(0x08d78a56, 0x11462032), TOBN(0x1393fa93, 0xd583ccc5),
+     TOBN(0x52af7f5d, 0x0c1b3514), TOBN(0xf48cac66, 0x188ca043),
+     TOBN(0x2524c8dd, 0x5461a1d1), TOBN(0x6eee8101, 0x91b6e707),
+     TOBN(0x209fece6, 0xca2fe87e), TOBN(0x50b35727, 0x9ac56706),
+     TOBN(0x651a6701, 0xec373bb2), TOBN(0x881de85b, 0x1a4c2e84),
+     TOBN(0x4892861d, 0xcfdb47d5), TOBN(0x5ae2e653, 0x5cdc4424),
+     TOBN(0xc58f4f59, 0xa1f90dd9), TOBN(0xa5584f85, 0xfcf158a4),
+     TOBN(0xbde86fb0, 0xab072a7a), TOBN(0x7c69e25a, 0x268bae62),
+     TOBN(0xee3478f3, 0x44fc7b3e), TOBN(0xec148394, 0x6b7d3647),
+     TOBN(0x2a542ebf, 0xe1c8c0ca), TOBN(0x63d1d635, 0x161dc0c1),
+     TOBN(0x769acdbe, 0x57ab9282), TOBN(0x9c338971, 0x2a119cb9),
+     TOBN(0x049e366f, 0x125e5b4c), TOBN(0x3aec68e0, 0xf0c8fde4),
+     TOBN(0x9d95b6e5, 0x324cefda), TOBN(0x844cce33, 0x704014b5),
+     TOBN(0x03920a61, 0x6a6bb216), TOBN(0xd69d17e3, 0xf379db8e),
+     TOBN(0x1924ac16, 0xc5e386e5), TOBN(0x62373a48, 0xd64953c3),
+     TOBN(0x5b1f7d64, 0x47f4e4a4), TOBN(0xc043b5b5, 0xffa115fd),
+     TOBN(0xb2a2656e, 0x87fb16b0), TOBN(0xcac56b9b, 0xd8cd79a6),
+     TOBN(0x544971f6, 0xcc19d3af), TOBN(0xf539244b, 0x0fd63db9),
+     TOBN(0x0f052d3c, 0xfbf4d232), TOBN(0x6b3c8366, 0x7a2a7280),
+     TOBN(0xaa6579db, 0x48079b9f), TOBN(0xc5beb93d, 0xa4d9edcf),
+     TOBN(0x8ad58825, 0x0f1599a3), TOBN(0x3f3a2634, 0x5f3f640b),
+     TOBN(0xda15393a, 0x9032fd7c), TOBN(0x97c10230, 0xac0e7136),
+     TOBN(0xfa32ef9f, 0x599785ee), TOBN(0xe1ed3b28, 0x6b4c7a65),
+     TOBN(0xcee1af27, 0x2da1dcdd), TOBN(0x4e480c11, 0x6861e2c2),
+     TOBN(0x35b5ec42, 0x9c8ad8c3), TOBN(0xfd07f6a4, 0x3fc55f23),
+     TOBN(0xab18ead2, 0xea76d444), TOBN(0xcb8bde14, 0x22ba099a),
+     TOBN(0x252e6a81, 0xc61ae967), TOBN(0xaf11042c, 0x72a2e1e6),
+     TOBN(0xb353902a, 0x1a211ef8), TOBN(0x644d16e0, 0xc99a25fc),
+     TOBN(0x637fd606, 0x5b67e48a), TOBN(0xfa570963, 0x51a0b665),
+     TOBN(0xaa661c73, 0x7ee072b8), TOBN(0xde1eb4fe, 0xf2e0a727),
+     TOBN(0x56096a0c, 0x22ed7ee6), TOBN(0x31aaf403, 0x5825908b),
+     TOBN(0xfd5f6ba7, 0xbfa02db6), TOBN(0x85f4f9a9, 0xff798900),
+     TOBN(0xa0997d56, 0x4a0cd878), TOBN(0xdd76909c, 0xb1b6982e),
+     TOBN(0x874fab15, 0xeccf338e), TOBN(0x5e072b3c, 0x4ce82bb1),
+     TOBN(0x5dbe883f, 0x6dd0d997), TOBN(0xa32117f2, 0x41765fb6),
+     TOBN(0x59ca4da3, 0x7d87fc5e), TOBN(0xc91002cd, 0xb95ec918),
+     TOBN(0xd53bc123, 0x6548248f), TOBN(0xef10a373, 0x6c6d1e0e),
+     TOBN(0xafb2d760, 0x99d9893f), TOBN(0xb77c1f1b, 0xce0ba0ca),
+     TOBN(0xabce362c, 0xcfb9f6b2), TOBN(0xe6e108d2, 0x35f9be91),
+     TOBN(0xb2331290, 0x7187fa9d), TOBN(0xdcd1f4fd, 0xfc7ddce6),
+     TOBN(0x3a129991, 0x9086eb29), TOBN(0xb0730520, 0x53a56d57),
+     TOBN(0x9fcdf4cf, 0xabd421bd), TOBN(0x96271270, 0x08f3e8e0),
+     TOBN(0x951ea7e2, 0x401e0217), TOBN(0xa4d1d708, 0x733f637b),
+     TOBN(0xc75170f4, 0x4f4cd676), TOBN(0x568279ba, 0x832f0b4d),
+     TOBN(0xda4c01f7, 0x25c17ab7), TOBN(0xfcc13028, 0xfa30e1b9),
+     TOBN(0x4d1d8f71, 0xacba57ec), TOBN(0x0c7971cf, 0xef6b3913),
+     TOBN(0xdf16e73d, 0xc014f166), TOBN(0xd5796183, 0xf96f2c30),
+     TOBN(0xd13ee9f7, 0x3f70dd7c), TOBN(0x3f9aa0dd, 0xdac738c5),
+     TOBN(0xa200c7e4, 0xad021e28), TOBN(0x982abae3, 0x08414fd0),
+     TOBN(0x76d16a8c, 0xc3779882), TOBN(0x41563d33, 0xe70a6ff5),
+     TOBN(0xdbb9656e, 0x4b553a17), TOBN(0x96af21a0, 0xd9c87aa1),
+     TOBN(0x2de13a03, 0x7bd9a625), TOBN(0x29f8c49b, 0xfeb1fec2),
+     TOBN(0x84e2df47, 0x1a4ce44a), TOBN(0x83bb2965, 0x548b39ee),
+     TOBN(0x38b91cce, 0x94d996eb), TOBN(0x41e0a3cd, 0x9441ae0b),
+     TOBN(0x720d30d8, 0xdaa92f34), TOBN(0xba587579, 0x06f30fbb),
+     TOBN(0x24f74676, 0x4c96ad59), TOBN(0xf40493f7, 0x0d33bd5f),
+     TOBN(0x9068c3e9, 0x126a7267), TOBN(0xa51099df, 0x18927490),
+     TOBN(0x27452423, 0xa9cfe02f), TOBN(0xcfd035be, 0xb8749653),
+     TOBN(0x0dd9bc2a, 0xfda6a4a9), TOBN(0xdba0178a, 0x0106ae0e),
+     TOBN(0x3820c9f5, 0x4969a4bb), TOBN(0x5031e9fd, 0x99fbc715),
+     TOBN(0x642a030a, 0xc193d942), TOBN(0xdc3d6ab7, 0x454cbb39),
+     TOBN(0x507c17b9, 0x1c8fa77c), TOBN(0x8465bcc8, 0xe3642a95)},
+    {TOBN(0xe74e265b, 0xc25dfad3), TOBN(0xd03630b9, 0x493f44b6),
+     TOBN(0xb3270892, 0xbfd6d473), TOBN(0x5b2d9543, 0x1c5ee992),
+     TOBN(0xeeb94537, 0xa36f7c5f), TOBN(0x9befc01d, 0x8ab0b81d),
+     TOBN(0x483cdb08, 0x188b45e5), TOBN(0x44c753b7, 0x01e4648b),
+     TOBN(0xee43bc87, 0xb2411618), TOBN(0x08754bd2, 0xf07924c4),
+     TOBN(0xef205033, 0x4ac92557), TOBN(0x6e7e4fe6, 0xee0387f4),
+     TOBN(0x51f3e2e2, 0x76961d0e), TOBN(0x2b69d417, 0x37eac10f),
+     TOBN(0x36d0f45f, 0x73757a88), TOBN(0x38b967e5, 0x2b0c7d35),
+     TOBN(0x94ba8fc4, 0xb31fa779), TOBN(0x8024dc85, 0x0f13036e),
+     TOBN(0xfda2af63, 0x82d754b7), TOBN(0x4a784242, 0xae9ea9ae),
+     TOBN(0x67dd14ab, 0xf9887947), TOBN(0x7f2ecfc4, 0xcd555a0a),
+     TOBN(0xb37c4244, 0xf63a46aa), TOBN(0xd032cfc1, 0xff71b4b5),
+     TOBN(0x0aef84c1, 0x6b8a6a97), TOBN(0xd2e7f3de, 0x0b2bca36),
+     TOBN(0x721c6c09, 0x5b174d43), TOBN(0x5719cf31, 0xd52ccc5b),
+     TOBN(0x6c7361f0, 0x3adf9517), TOBN(0x1e264169, 0xabe20ff5),
+     TOBN(0x01f9d997, 0x69eacc0e), TOBN(0x721eba63, 0xc2e635d2),
+     TOBN(0x4225e9c8, 0x25df8bb5), TOBN(0x931f721e, 0xb5752d7e),
+     TOBN(0x3c4ed475, 0x0a3b281d), TOBN(0xcf927682, 0x4a4668be),
+     TOBN(0x1b7f358e, 0x75b7e90c), TOBN(0x06e5c24d, 0xb7a29b9a),
+     TOBN(0x0058967a, 0xa167f2c8), TOBN(0x9f1a6fb9, 0xa4ee62d3),
+     TOBN(0xca899c4f, 0x278291f1), TOBN(0x69a90324, 0xf4e64c1d),
+     TOBN(0x46cc5d42, 0x8d62916e), TOBN(0x3c802e65, 0xec1007cc),
+     TOBN(0xdadcf2aa, 0x6219cfbb), TOBN(0x942870dc, 0xd10258b2),
+     TOBN(0x77264e68, 0xa5e142af), TOBN(0xf25675e2, 0x089cc7a3),
+     TOBN(0x177e8a3b, 0x7336aa16), TOBN(0x5a92cc2d, 0xbc5c622c),
+     TOBN(0x33a35a2c, 0x1789e029), TOBN(0x6f91306e, 0x4e4d5573),
+     TOBN(0xe5a2a581, 0xda0a46f5), TOBN(0xfb532bed, 0x42640bba),
+     TOBN(0x88ff0f11, 0x4a7b3ae4), TOBN(0x2223e7b6, 0xb8ff7a71),
+     TOBN(0x75933133, 0x5d21d261), TOBN(0xa336289a, 0xcabb1fbd),
+     TOBN(0x797db2f3, 0x631b3b61), TOBN(0xc2cedb25, 0xd7e6a511),
+     TOBN(0xb8806f34, 0x10355332), TOBN(0xe5f1fb4a, 0x5d0ae37f),
+     TOBN(0x57cf26a5, 0x5d17c5c7), TOBN(0x82e8df47, 0x68c43ec3),
+     TOBN(0x70fa23eb, 0xf86bd784), TOBN(0x711a9dbb, 0x51b0ce75),
+     TOBN(0x83bb4a90, 0x82170008), TOBN(0x8f096ee9, 0x630602dc),
+     TOBN(0x7d275fc9, 0x7f15e77a), TOBN(0x63516a6a, 0xfe727ec7),
+     TOBN(0x6b06827a, 0x1dce9d38), TOBN(0xa01a5382, 0x023b31c2),
+     TOBN(0x12537433, 0x886209b8), TOBN(0xb7875fa8, 0xc5a11b32),
+     TOBN(0xfa63cb99, 0xbd61176d), TOBN(0xebb204ea, 0x33378ebb),
+     TOBN(0xf29a29a0, 0x70c135f6), TOBN(0xf53941e9, 0xfa29d69f),
+     TOBN(0xab97b39a, 0x9917da42), TOBN(0x4677cfea, 0x45947ae4),
+     TOBN(0xd4668cff, 0x0f6dd908), TOBN(0x48bb09ed, 0x987e0769),
+     TOBN(0x794ed298, 0x8d64b6fd), TOBN(0xaf89d530, 0xfac845da),
+     TOBN(0x57445649, 0x2d06e70d), TOBN(0xe2a1a8c2, 0x079e70a7),
+     TOBN(0xd2ef1779, 0xf524fc03), TOBN(0xeaccaacc, 0xb137bb1b),
+     TOBN(0x34d8ed87, 0x5d279f42), TOBN(0x4dd5344c, 0x1cd68904),
+     TOBN(0xb558b71d, 0x24abd550), TOBN(0x3728e850, 0x40df135e),
+     TOBN(0x9329e2b2, 0xcfe86519), TOBN(0x48ad17fb, 0xac74cde2),
+     TOBN(0x2ad61b22, 0x30b388b5), TOBN(0xebcbc1ad, 0xfaea71e1),
+     TOBN(0x50d7b19e, 0x35990d9d), TOBN(0xb17138e5, 0x6eb70243),
+     TOBN(0xb61618f6, 0xaa8ae7e6), TOBN(0xedee15b0, 0xabce12c6),
+     TOBN(0xa99ce250, 0xcc7205fc), TOBN(0xe438efc9, 0x69e0d75c),
+     TOBN(0x1feb6a10, 0x5084b390), TOBN(0x7b348954, 0x9c80d42d),
+     TOBN(0x67ac89d5, 0xe4b68140), TOBN(0x34afd23b, 0xc9b092af),
+     TOBN(0xad65cae9, 0xfe1ad661), TOBN(0x4f402947, 0xe02d884c),
+     TOBN(0xd0a48fcc, 0x6b1c40c1), TOBN(0xf950c9f7, 0x8961487b),
+     TOBN(0xdb1cd811, 0x206d1752), TOBN(0x863b0ded, 0xe99fd891),
+     TOBN(0xd3aad8c2, 0xbb2a4515), TOBN(0xc93c8cb8, 0x797e223c),
+     TOBN(0x0f471e49, 0x12a77d46), TOBN(0xa2ac9434, 0x600872b6),
+     TOBN(0x6fb1c7ef, 0x915f730b), TOBN(0x9fb72401, 0xd254d363),
+     TOBN(0xf521e33a, 0x6b44796a), TOBN(0xb7ed2e8d, 0x97c9fafb),
+     TOBN(0x60d41128, 0xffb5e7ce), TOBN(0xdbd8b542, 0xaecb96c2),
+     TOBN(0x029ab3dd, 0x0b5ca788), TOBN(0x8b1148a2, 0x190eb38c),
+     TOBN(0x59048db8, 0x69fb1924), TOBN(0xcd2149f0, 0xb18391a8),
+     TOBN(0x6bece5b6, 0xfed311b9), TOBN(0x5edbe9b9, 0x9ffd29b9),
+     TOBN(0x53810556, 0x1156ded2), TOBN(0xf812ce5d, 0x721f3e68),
+     TOBN(0x50504d40, 0x7ccdc8cb), TOBN(0xb559ba08, 0xc60fa4fc),
+     TOBN(0x862a83d9, 0x1d6bd879), TOBN(0x2f8f653b, 0x836e26ba),
+     TOBN(0x8587e6df, 0xeb26ca11), TOBN(0x127bd905, 0x8c8aaf7b),
+     TOBN(0xe26e690d, 0xd67d9902), TOBN(0x1a6061f4, 0xb58e7e78),
+     TOBN(0x960ef741, 0x480dd4d1), TOBN(0x7fd09736, 0x75589610),
+     TOBN(0x5a20a1a2, 0x855a8b2b), TOBN(0x3ed68662, 0x355b4e0f),
+     TOBN(0xd3786f45, 0xe76595b4), TOBN(0x72a6999d, 0x0bdedcfb),
+     TOBN(0x4e48e843, 0x6a175646), TOBN(0xde53c427, 0xe05dc02d),
+     TOBN(0x9728a4c5, 0x97d31bc6), TOBN(0x01a07129, 0x5bb3bd37),
+     TOBN(0x83c08a98, 0xa74a0fcc), TOBN(0x233e400f, 0xbc345df8),
+     TOBN(0x9578c5f2, 0xcc3e0edb), TOBN(0x0fe89df2, 0xf144a31f),
+     TOBN(0x308098a0, 0x14c5a2cc), TOBN(0xeda5a59d, 0xba40c0bc),
+     TOBN(0x0b10f7e0, 0xb718a5ae), TOBN(0xdaf7da8c, 0x5b8ad9ba),
+     TOBN(0xddc71285, 0x87394cde), TOBN(0x9bdb27cd, 0xe43458d3),
+     TOBN(0xc698d972, 0x4bd7c11c), TOBN(0x2ee97fbc, 0x3540be14),
+     TOBN(0x2c704995, 0x72f98422), TOBN(0xfc71fee2, 0xef8661c5),
+     TOBN(0x6574e022, 0xce08043e), TOBN(0x3d17162e, 0x5143733c),
+     TOBN(0x3bf0b448, 0x730e5b80), TOBN(0x56de346a, 0x7cf94b5e),
+     TOBN(0xfa87a53e, 0x6c797797), TOBN(0xe8b9edfa, 0x6487d014),
+     TOBN(0x09e74387, 0x7be60b03), TOBN(0x2277ebc3, 0xec8750db),
+     TOBN(0xf1e9d594, 0x7aeaa545), TOBN(0x41564562, 0x44c03394),
+     TOBN(0x57943adc, 0x4de9f7ec), TOBN(0x09dd58f9, 0x2a220cd5),
+     TOBN(0xdf848ec8, 0x06973808), TOBN(0xf1d5def1, 0xd3950024),
+     TOBN(0xd089eba5, 0x5a8707e5), TOBN(0x914046cb, 0xb0b90ebe),
+     TOBN(0xb01180b2, 0x63fe6bc2), TOBN(0x1ffbc968, 0x7ede9d83),
+     TOBN(0xe16d336f, 0x3c52c09f), TOBN(0x32270ecb, 0xdf40338d),
+     TOBN(0xb55ff5c6, 0x7eec7039), TOBN(0xb5ffb314, 0x38a63fab),
+     TOBN(0x3e9f284f, 0xee18ffec), TOBN(0x702d97f5, 0x1d1b4e80),
+     TOBN(0x2005ee57, 0x214c4da1), TOBN(0x1c210413, 0x2f5ea2f4),
+     TOBN(0xd24a486c, 0xa4149949), TOBN(0x3869a339, 0x23c8e201),
+     TOBN(0x00f6e410, 0x0149992e), TOBN(0x54e97b46, 0xf0a367dd),
+     TOBN(0xd967726c, 0xe169de5c), TOBN(0xa3e81f93, 0x6a0fcd03),
+     TOBN(0x171faa9d, 0xdb1b1733), TOBN(0x0bbb5e91, 0x3828e41b),
+     TOBN(0x789a7b2e, 0xf0828387), TOBN(0x9465cc16, 0xfca60b9b),
+     TOBN(0xcb58e90a, 0xab630d23), TOBN(0xe7d30293, 0xa339d4b4),
+     TOBN(0x0bcac958, 0x18e75428), TOBN(0xd2f1554a, 0x9a95900a),
+     TOBN(0xc63c2afb, 0x03846833), TOBN(0x703d0220, 0x6d1e8753),
+     TOBN(0x47f5fe57, 0x04a357a2), TOBN(0xaafba53e, 0xcdc17255),
+     TOBN(0x8f94c8eb, 0x821af8d5), TOBN(0x4d9918bc, 0x35e37920),
+     TOBN(0xc029bd84, 0xe32dd067), TOBN(0x25982357, 0xf77f8962),
+     TOBN(0x7af256ca, 0x510b7cfb), TOBN(0xca397f37, 0x446925d7),
+     TOBN(0xb3dc7be5, 0xe0614e1e), TOBN(0x3b64cd27, 0xbbc4cc93),
+     TOBN(0xbd762df5, 0xfb99bbc9), TOBN(0xc1ef0d4d, 0x04d7177f),
+     TOBN(0x77b6d3d6, 0x65e75ed6), TOBN(0xbe59c8da, 0x53053b45),
+     TOBN(0x054d089f, 0x54fe92cc), TOBN(0x2f2327e0, 0x6fa4758f),
+     TOBN(0x948cf03f, 0x5d2b5a01), TOBN(0x47544c4c, 0x9c23b83e),
+     TOBN(0x338590fa, 0x6c128d69), TOBN(0x5724008d, 0x76842160),
+     TOBN(0x4cbeb18e, 0xc4f063e6), TOBN(0x507ba094, 0x9c2f826c),
+     TOBN(0x0e877a6e, 0x6f4e49f3), TOBN(0x050c2040, 0x34f56868),
+     TOBN(0x8fd667c4, 0x0f119e25), TOBN(0x881dd34d, 0x13b47d3f),
+     TOBN(0x2a6b636d, 0xca8e9a6a), TOBN(0x67b081fb, 0x107ea18c),
+     TOBN(0xd3a46367, 0x84af55d9), TOBN(0x0e709a00, 0xd7626b67),
+     TOBN(0x135725fa, 0x4c6dfc8e), TOBN(0xbf6328d9, 0x133a6e20),
+     TOBN(0xa4b743b4, 0xa87031f2), TOBN(0x62e90e67, 0x13825d07),
+     TOBN(0x7004028e, 0xb85f3c45), TOBN(0x0465c502, 0x11751be0),
+     TOBN(0x4d5d467f, 0x8a5ab076), TOBN(0x9aa3f414, 0xf4fb8a45),
+     TOBN(0x9fa0422e, 0x5dc1fa84), TOBN(0x3205c05f, 0xd02cfd2b),
+     TOBN(0x3eac28fa, 0x078836b6), TOBN(0x53bc0189, 0xfc3ff573),
+     TOBN(0x2c45ef09, 0x00b02100), TOBN(0x61bc02ae, 0x34360ef7),
+     TOBN(0xeb5593e7, 0x532e8d6a), TOBN(0x94092904, 0xf02a1ee4),
+     TOBN(0x379b32e8, 0x200496c0), TOBN(0x46fb6e9e, 0x360a27c8),
+     TOBN(0x8a3377ba, 0x62005158), TOBN(0x1a3266c1, 0x0de3f191),
+     TOBN(0xe60fad96, 0xc94d2127), TOBN(0x41553dd1, 0x646302f3),
+     TOBN(0x88bf0bfa, 0x377e0766), TOBN(0x870a24db, 0xe75bf57b),
+     TOBN(0xc133cb49, 0x79e77976), TOBN(0x2f14924d, 0xf43b6f18),
+     TOBN(0xe561dc90, 0xaa94cd73), TOBN(0x8c420eb2, 0xd6eb695d),
+     TOBN(0x99e41ba8, 0x2f04ef79), TOBN(0x7f427bdf, 0x71e6d054),
+     TOBN(0x7304bb25, 0x10bde8ce), TOBN(0x5dbc4325, 0xe48b16f8),
+     TOBN(0x47d17ab2, 0x8796db7b), TOBN(0x83426817, 0x94c77832),
+     TOBN(0x6781850e, 0x9878ace2), TOBN(0x7f747b90, 0x019e97aa),
+     TOBN(0xa0545c85, 0x949f9b08), TOBN(0xe0a0bbf8, 0x244bc083),
+     TOBN(0x8cb53666, 0xa1f38ea6), TOBN(0x9be29ff6, 0x4989a568),
+     TOBN(0xbc5a7f87, 0x083a7fcd), TOBN(0x90d0129c, 0x44ca10f6),
+     TOBN(0x1ad274bb, 0xd724b7e2), TOBN(0xa5290cbd, 0xcad5f069),
+     TOBN(0x886b1a7c, 0x86a4e0a9), TOBN(0xd2481b5a, 0x8d8fb13f),
+     TOBN(0x80075fb2, 0x4f606ac5), TOBN(0xf984b5a2, 0xbfc10e7f),
+     TOBN(0xd3d91aea, 0xf056142f), TOBN(0x770bee0b, 0x4afdc017),
+     TOBN(0x3c42ca88, 0x6c49c827), TOBN(0xb620c4e8, 0x0aaa3139),
+     TOBN(0xac6b512d, 0xad87890c), TOBN(0xaee62df7, 0x0eb61f92),
+     TOBN(0xcf0f37fc, 0x21dad9ec), TOBN(0xd780d315, 0xc52e24c1),
+     TOBN(0x0263bcab, 0x23a2b699), TOBN(0xdc8dcd2f, 0x9714b577),
+     TOBN(0xeb16eca8, 0x55622b11), TOBN(0x94b3d649, 0x01118edf),
+     TOBN(0x6bafea64, 0xec66879d), TOBN(0xc35739c0, 0xc4ab9f48),
+     TOBN(0x082ccf53, 0xf3232370), TOBN(0x01b55dd3, 0x71407825),
+     TOBN(0x86e0fe94, 0x4f7f4038), TOBN(0x1a623675, 0xb04159e9),
+     TOBN(0xf908ca59, 0xbc4df337), TOBN(0x1b4f1ffe, 0x816162ce),
+     TOBN(0xb5128952, 0x2d60e05b), TOBN(0xb47ca0eb, 0xd38cbdf7),
+     TOBN(0xdccba22f, 0x8ee38219), TOBN(0xc9436453, 0x9fbb36ff),
+     TOBN(0x83cecbf5, 0x8ac12c9d), TOBN(0x591191b5, 0xf4cb1ebf),
+     TOBN(0x693cf383, 0xf03c1632), TOBN(0xaebd3f9b, 0xcb6abaca),
+     TOBN(0x1427c154, 0x0fa26e7a), TOBN(0x4f0de894, 0x01bf37af),
+     TOBN(0x4e497acf, 0xd88da2a6), TOBN(0x8014a215, 0xe5c86482),
+     TOBN(0xa627d78f, 0xcf94ee40), TOBN(0x7647708d, 0x9ca36aa3),
+     TOBN(0x3d4e8bb1, 0x87e108c8), TOBN(0xacdc3223, 0x516f8b28),
+     TOBN(0x74e4d436, 0x1d955038), TOBN(0x7e4a198c, 0xedd68905),
+     TOBN(0x41dc4bdb, 0xc4bfbad1), TOBN(0xfd1121b1, 0x85964942),
+     TOBN(0xe462eb9c, 0x0c0d85ff), TOBN(0xade1ccb3, 0x2b012d88),
+     TOBN(0x2eec3503, 0x318f2aa3), TOBN(0x656b44da, 0xdec8a13e),
+     TOBN(0x90b7aac8, 0xcda13a8c), TOBN(0xe7f3a5ff, 0x214a530f),
+     TOBN(0xa0c8062a, 0x159060b9), TOBN(0xc19f2608, 0xd9305873),
+     TOBN(0x0d6213c4, 0xc9609521), TOBN(0xde2b9134, 0x9aec4539),
+     TOBN(0x4a2a6476, 0xaeddf0a6), TOBN(0x89222dff, 0x5cf2e85d),
+     TOBN(0xad92a1d3, 0x084a0245), TOBN(0x29644a60, 0x2138063f),
+     TOBN(0x5b57a05b, 0xb8164832), TOBN(0xecf6620f, 0x885ce4d1),
+     TOBN(0xde28ed2f, 0x045d3b88), TOBN(0x3eb11759, 0xb4502308),
+     TOBN(0xe97f1db2, 0x4d9f94b8), TOBN(0xfa248583, 0xeb83f016),
+     TOBN(0x63a273b4, 0xcda53ba0), TOBN(0x9692973a, 0xa228b7b9),
+     TOBN(0x5968cb12, 0xb6707cbd), TOBN(0x1895ccb4, 0x5c1a2b4d),
+     TOBN(0xff309157, 0x37f0b240), TOBN(0x374d983e, 0xb90875c2),
+     TOBN(0x22fc40c6, 0xc4e815e7), TOBN(0xf2db27be, 0x98d18506),
+     TOBN(0x2854a948, 0xaa9ae62e), TOBN(0xd614a722, 0x79e39df1),
+     TOBN(0xebeec551, 0xb3501c19), TOBN(0xe2b878eb, 0xd89cefca),
+     TOBN(0xa0a34757, 0x6b4cd6bc), TOBN(0x0159129c, 0x70bfdf88),
+     TOBN(0x26fa3e53, 0x489502ca), TOBN(0x7932084f, 0x285be050),
+     TOBN(0xfe4998f4, 0x71912b0c), TOBN(0x3dce0a87, 0xc60b88b7),
+     TOBN(0x5b93edb0, 0xc718ee5c), TOBN(0xb93a225f, 0xbb075836),
+     TOBN(0x87a08c94, 0x7aa0595c), TOBN(0x401d2620, 0xc31e3249),
+     TOBN(0xbe6928b4, 0xdae2cdb9), TOBN(0x4b68e106, 0x5a226630),
+     TOBN(0xdc38c2fc, 0xc9d32e4f), TOBN(0xc51a6245, 0x26542f89),
+     TOBN(0x5fb37c1b, 0x1757f3c4), TOBN(0xa27d6c02, 0x89128aa4),
+     TOBN(0x3b74f56f, 0x5e629309), TOBN(0x24b5ad84, 0x2f7aeef2),
+     TOBN(0x54a962cc, 0xbdc89596), TOBN(0x6e8bccf8, 0xcc2f3d5d),
+     TOBN(0x4c1df22c, 0x312e9241), TOBN(0x8ffe6b0d, 0xfc30f0dc),
+     TOBN(0x670431a2, 0xa6ec0fe4), TOBN(0x49da0b42, 0x35964572),
+     TOBN(0xbb12d1b0, 0x9dda5c39), TOBN(0x64170fe1, 0x72d3de51),
+     TOBN(0xea8b2b16, 0xa4a2f5d9), TOBN(0xde1bad64, 0xe590be92),
+     TOBN(0xb7f93581, 0xf0b9b0b5), TOBN(0xb007f4dd, 0xe115d67e),
+     TOBN(0xab9d7523, 0x415732d4), TOBN(0x2951149d, 0x905ec0fe),
+     TOBN(0x94bb2c63, 0x74350478), TOBN(0xe6b63bfd, 0xe9b1ada4),
+     TOBN(0xd09b4d4b, 0x13e8528f), TOBN(0x6bed3d25, 0x685bf239),
+     TOBN(0x83023ad9, 0x1a14b7ce), TOBN(0x4bffff63, 0xd0505d6b),
+     TOBN(0x2ccc180a, 0x8bb1cfa0), TOBN(0x70c18508, 0x3a09c912),
+     TOBN(0x318c41c2, 0x5878201c), TOBN(0xb9f207b1, 0x64c01149),
+     TOBN(0x89fdd9ee, 0xc58287d9), TOBN(0xdb6fa8db, 0x05c43da0),
+     TOBN(0xc31354f0, 0x311a34a1), TOBN(0xccfbaddb, 0xf1521976),
+     TOBN(0xf4175f75, 0x0c5e8388), TOBN(0x7e090ce8, 0xa81226cf),
+     TOBN(0x5209107e, 0xeda6a1ab), TOBN(0xf0a263cb, 0x7e5ccefd),
+     TOBN(0x9fe05a36, 0x10c704a1), TOBN(0x3784d7ca, 0xcf133aee),
+     TOBN(0x066c3116, 0x37af86c8), TOBN(0xbf32ca04, 0xd7ebeb8a),
+     TOBN(0x0447a950, 0xa9b5bab4), TOBN(0x3b2f98bd, 0x41bb1f1c),
+     TOBN(0xd89bbdd7, 0x59c62f08), TOBN(0x26bab370, 0x3ded069b),
+     TOBN(0xb0db4ca5, 0x69ea63ae), TOBN(0x57b32f32, 0x9133df68),
+     TOBN(0xc79a22d0, 0x5a17efbe), TOBN(0x576976a3, 0xf8ae3c2d),
+     TOBN(0x5754198b, 0x9d02d212), TOBN(0x9cc9e61e, 0x230d0213),
+     TOBN(0x76772179, 0x92889e33), TOBN(0xb1246608, 0xf5df6cba),
+     TOBN(0x821766bc, 0x8d491280), TOBN(0xe148f470, 0x96bd3df5),
+     TOBN(0xc1e9fc70, 0xed753b73), TOBN(0x840e40ed, 0xd6cecfc5),
+     TOBN(0x03874679, 0x93e2f3a0), TOBN(0x462e5abf, 0x5b646b64),
+     TOBN(0x6fb19eda, 0xd7ae0e67), TOBN(0x01e8a27f, 0xc3d2dddf),
+     TOBN(0xc9e69639, 0x4bacfe2d), TOBN(0xbc3a134e, 0x712e8afb),
+     TOBN(0x5d943a86, 0x8af6d30f), TOBN(0x65eb5f99, 0x443c942c),
+     TOBN(0xf5000308, 0x2339e348), TOBN(0xd69b7693, 0xeb0d80e6),
+     TOBN(0x7b00b43b, 0x5b9d220b), TOBN(0xde0dfc80, 0x497bbcf9),
+     TOBN(0xcfe2e3f3, 0x0c2e851f), TOBN(0xef7793d1, 0x7e91d378),
+     TOBN(0x9e43eeac, 0x9d266a5b), TOBN(0x9c81d68b, 0x1766c5c1),
+     TOBN(0x121db320, 0xf6a4d560), TOBN(0xcd0a4f03, 0x073582a7),
+     TOBN(0xbf469f9a, 0x6e841041), TOBN(0x4314f0f6, 0x5eb2d753),
+     TOBN(0x09021001, 0x8c498414), TOBN(0xf63d00ee, 0x859275b7),
+     TOBN(0x228fa809, 0xf1c0385a), TOBN(0x44259d51, 0x694c3318),
+     TOBN(0xb0a5d5fe, 0xa2ad4eac), TOBN(0xbb950010, 0xabdedf11),
+     TOBN(0x081024ce, 0x6264c601), TOBN(0x6cc7faf2, 0xaefb4115),
+     TOBN(0x90511289, 0x8692a7a4), TOBN(0x2bef4135, 0x60596012),
+     TOBN(0xfec5209a, 0x0f0becb6), TOBN(0xad0907a6, 0xd1ceb42e),
+     TOBN(0x6cde3f21, 0xf517372c), TOBN(0x9acd4f09, 0x26131459),
+     TOBN(0xf3629a43, 0x491f59d7), TOBN(0xe944561a, 0x41a037dd),
+     TOBN(0x07beeabe, 0x826d1b5c), TOBN(0x0728a907, 0x3a1476cd),
+     TOBN(0xa91f41a0, 0x7d4a1abf), TOBN(0xdf58ed06, 0xa7a119c4),
+     TOBN(0x19990669, 0xba701704), TOBN(0x8aa3f76b, 0x47b67175),
+     TOBN(0x8bccff3e, 0xdd0a6e9a), TOBN(0x4173fcda, 0x24f49029),
+     TOBN(0x2a688911, 0x61c18233), TOBN(0xdf54b239, 0x78b9fa8f),
+     TOBN(0x714cf627, 0x37596f40), TOBN(0x2c73ddba, 0x24e6a879),
+     TOBN(0x1538fd36, 0xf2547f19), TOBN(0xd85c4730, 0x0e7e84ee),
+     TOBN(0x00799e9f, 0x306f5fc0), TOBN(0xfccc6a37, 0x49ce114c),
+     TOBN(0xf9cff5e8, 0x3fe08120), TOBN(0xdf876a1f, 0xc2be9f27),
+     TOBN(0xe817c72e, 0x6939fdb9), TOBN(0x244a1800, 0xd34d0e43),
+     TOBN(0x41e83eef, 0x78fa7f11), TOBN(0xecaa250c, 0xba6367e5),
+     TOBN(0x9c420347, 0x8def6ae6), TOBN(0x99efb3b1, 0x250b9e58),
+     TOBN(0xdaf311ee, 0x79b2298c), TOBN(0xb49200cf, 0x69b6dff3),
+     TOBN(0x5c7f17bb, 0x559e51f5), TOBN(0x117d0cbe, 0x424be7e9),
+     TOBN(0x290a35c4, 0x36e3af54), TOBN(0xd2326cd8, 0xe3a643b1),
+     TOBN(0xc208b2b3, 0x3580f9ee), TOBN(0x2419c661, 0x4464a9e0),
+     TOBN(0x87123d3a, 0xbccb2759), TOBN(0x5d36fcf3, 0x1a77d469),
+     TOBN(0x5aafd58a, 0x49b07e5a), TOBN(0xf534595b, 0x6b71e237),
+     TOBN(0x0f0d3161, 0x6705039f), TOBN(0x7282b08c, 0xca701676),
+     TOBN(0xb05e8c3e, 0x13796941), TOBN(0x5250012e, 0xfca06e08),
+     TOBN(0x7eb2341a, 0x980c5ea3), TOBN(0x92f5aeb1, 0xa41defb2),
+     TOBN(0x203244e0, 0x0e62453f), TOBN(0x74341218, 0x96181756),
+     TOBN(0x3b0cd36f, 0xe12a94ab), TOBN(0xf364b3b9, 0xb5ad7c48),
+     TOBN(0x96a7a2a7, 0x8e768469), TOBN(0xccc31c7e, 0x1bbc7cc5),
+     TOBN(0xe70ad5d0, 0x080dbb92), TOBN(0xfb201e92, 0x56fb0f1f),
+     TOBN(0xdfce7a1e, 0x29d99f57), TOBN(0xc12a02b0, 0x06457da5)},
+    {TOBN(0xdea72ba6, 0x2a80f39c), TOBN(0xcb2174b1, 0x68cbe088),
+     TOBN(0x9c73ec69, 0xd6bd1cc1), TOBN(0x6a2dbe20, 0xf20dcce6),
+     TOBN(0x20a5150b, 0xeeaae9da), TOBN(0xc935e85d, 0x9df630da),
+     TOBN(0x2147144f, 0xa1634cd8), TOBN(0x5eccb56c, 0x44f3af02),
+     TOBN(0xf77a79cf, 0xc0e2b70a), TOBN(0x2569c8bc, 0xee8cbae7),
+     TOBN(0x392a5dbe, 0xfadb18fc), TOBN(0x59bc96b4, 0x3ce6a0ff),
+     TOBN(0x287f04f4, 0x8b551005), TOBN(0x7efe3aa5, 0xa44b2bd8),
+     TOBN(0x0e9cb8ed, 0x6ac447d7), TOBN(0x9b4eb10a, 0x7783bdd0),
+     TOBN(0x793c4880, 0xb981d96f), TOBN(0xf719d828, 0xd56fb2a6),
+     TOBN(0x9fcc236f, 0x8149057e), TOBN(0x318c63ec, 0xb4d65c2b),
+     TOBN(0x5269c1d7, 0x5f95c5de), TOBN(0x33b3745f, 0xd0efd6bc),
+     TOBN(0xace344d5, 0x4ae87c64), TOBN(0x238809d6, 0xdd30ba2c),
+     TOBN(0x3cc32acc, 0x71192348), TOBN(0x545401bf, 0x3f17ef60),
+     TOBN(0xe209a493, 0xcde25b0e), TOBN(0x5c11886b, 0x663abab9),
+     TOBN(0xe61a81b1, 0x28ec7c90), TOBN(0x18b125a6, 0x75b57f5c),
+     TOBN(0x86d1b45a, 0xfad91696), TOBN(0xb31a786d, 0xa4c3f7ff),
+     TOBN(0x2fd4cd72, 0xf45831d8), TOBN(0x85978fa6, 0x8be40d9f),
+     TOBN(0x38106329, 0xa9301111), TOBN(0x1527e462, 0x9e5979ee),
+     TOBN(0x97f71c7e, 0x76c5fc8a), TOBN(0x205fa473, 0xf1f33056),
+     TOBN(0x7bb9d24e, 0xa6546a05), TOBN(0x0e282a5c, 0xf84c4d35),
+     TOBN(0x59d21896, 0x59471f1f), TOBN(0x2e613dec, 0xf6303573),
+     TOBN(0xa7995794, 0x78bf5a4b), TOBN(0x20adf6b5, 0xbf19fbe5),
+     TOBN(0x3a48c95f, 0x1574d34d), TOBN(0x95488f09, 0x09323ceb),
+     TOBN(0x450aee7f, 0x552df9cf), TOBN(0xdf016f7a, 0x53557500),
+     TOBN(0xf2acedc6, 0x2da8a2a6), TOBN(0x03fc8cf8, 0x2f4a0632),
+     TOBN(0xe7ff136b, 0x5b82f03a), TOBN(0xd5841c4d, 0x9e88c421),
+     TOBN(0x75a4d66f, 0x7eef63f0), TOBN(0x92091ade, 0x2865c14b),
+     TOBN(0x7060474c, 0x64fe7ba3), TOBN(0x4056724c, 0xfe30cb3e),
+     TOBN(0x38cf4c6f, 0x8d9fceb6), TOBN(0x11e85f78, 0xab528f38),
+     TOBN(0xe2896d25, 0x52303b2b), TOBN(0xf929675a, 0xed68c605),
+     TOBN(0xfbd22374, 0x10c708a9), TOBN(0x4682ca17, 0x40d7e5a7),
+     TOBN(0x4242b5c5, 0x9041047f), TOBN(0xaf571053, 0x0f9c6840),
+     TOBN(0x713b2bbb, 0xa56af433), TOBN(0x45aaf2ce, 0x5e82f947),
+     TOBN(0x9882571a, 0x106283c7), TOBN(0x37de12ca, 0x9b9c3c3c),
+     TOBN(0xcb463af2, 0xbef10529), TOBN(0xe18d763d, 0xd771236c),
+     TOBN(0xb47a69ca, 0x62935de3), TOBN(0x4798e91f, 0x9a41e09a),
+     TOBN(0x89696697, 0x8e93edd5), TOBN(0x35cdb8e1, 0xb7ea4f45),
+     TOBN(0x36f8305d, 0xfed33d87), TOBN(0x57623440, 0x625642d6),
+     TOBN(0xdfd9b580, 0x945dd7d6), TOBN(0x965ffcb5, 0x731739bc),
+     TOBN(0x34588e1f, 0x637bf127), TOBN(0x936c0ba0, 0x539d21c7),
+     TOBN(0x70832099, 0x71640eed), TOBN(0x916b1952, 0x3ff407e3),
+     TOBN(0x4cd58881, 0x88440bc0), TOBN(0xd9fcb83d, 0xc280e977),
+     TOBN(0x0d3df9db, 0xdf6cda83), TOBN(0xc629414e, 0x3d55047e),
+     TOBN(0xe05738a8, 0xc16b84c9), TOBN(0xf4bdc724, 0xe8783570),
+     TOBN(0x7d876a59, 0x9a93a5c9), TOBN(0x026be75c, 0xa8d12f61),
+     TOBN(0xe49900ed, 0xe9b2aa43), TOBN(0x44d6dc80, 0xb3a68dad),
+     TOBN(0xf96b116b, 0x7d23e11b), TOBN(0x12791212, 0xb6814209),
+     TOBN(0x3e2807cf, 0x6cc65956), TOBN(0xcc606ca7, 0xf405ffae),
+     TOBN(0x5484b2c5, 0x5df47226), TOBN(0xfbaf9042, 0x8802da81),
+     TOBN(0x84146315, 0x087adadc), TOBN(0x6adbcbc1, 0x58d593b3),
+     TOBN(0xc1fb3896, 0x68b97533), TOBN(0xa6919aac, 0x954cc1b7),
+     TOBN(0xf301b2e4, 0x27a4ddd0), TOBN(0xa15c16eb, 0xdf1a07b1),
+     TOBN(0xb36c017d, 0xc145a6c7), TOBN(0xcca64382, 0x968798da),
+     TOBN(0xd13b6376, 0x8d0eff5d), TOBN(0x06e39e2d, 0x2206e681),
+     TOBN(0x1d9dffa4, 0x3add517a), TOBN(0xe670e6c8, 0x10d95fef),
+     TOBN(0x0ecb51ab, 0xf1c7c7a8), TOBN(0xf17dff51, 0x74945305),
+     TOBN(0xf71b09b1, 0xb00d9c0f), TOBN(0xc719cf62, 0x9c72c80a),
+     TOBN(0x310c5aeb, 0xe00a49a1), TOBN(0xd01285e5, 0x1b33c5e6),
+     TOBN(0x7b23e7c7, 0x05aa6eb7), TOBN(0xf84188b1, 0x6bc88677),
+     TOBN(0x7e034cb5, 0x64be321a), TOBN(0x270df734, 0xe884323f),
+     TOBN(0x218e68f9, 0xe5137d20), TOBN(0x79588cba, 0x0f7e70ad),
+     TOBN(0xb6d37f52, 0x58b86b0a), TOBN(0xcb281c98, 0x7cc591fe),
+     TOBN(0x30e03fed, 0x8fe40e06), TOBN(0x394ded95, 0xed9ca793),
+     TOBN(0xf1d22cdd, 0xbcd3a3da), TOBN(0xcb88cb27, 0x0c591130),
+     TOBN(0x67786ba3, 0x8ff0cbf4), TOBN(0x85738a44, 0x0565d337),
+     TOBN(0x9d3b35ec, 0xaf9a667b), TOBN(0x45a17512, 0x8f5f540a),
+     TOBN(0xf1ae5171, 0xade5a5ba), TOBN(0x720e2823, 0x39869be4),
+     TOBN(0x6893f14a, 0x5352d84b), TOBN(0x919a4f15, 0xc784dc20),
+     TOBN(0x36136612, 0xf7ae5a67), TOBN(0x11f43d1c, 0xeaff0924),
+     TOBN(0xcfee088c, 0x39449b96), TOBN(0x3dc48359, 0x70c42ff6),
+     TOBN(0x4072683a, 0xbf208b67), TOBN(0x35a7c2be, 0xbe15d18f),
+     TOBN(0xe61d2748, 0xe2c3391b), TOBN(0x0a4109b1, 0x39921d95),
+     TOBN(0xe2cd131b, 0x05545cfc), TOBN(0xa898da2c, 0x3ae20d7f),
+     TOBN(0x501cd849, 0x50dc4c61), TOBN(0x10e287d4, 0x3374e7f0),
+     TOBN(0x90d6326f, 0x38aea879), TOBN(0xc48d9af7, 0xef43fa08),
+     TOBN(0xf8f4886a, 0x6c20f168), TOBN(0xc5d34a86, 0x23ccac4b),
+     TOBN(0x72357752, 0xb3d7004e), TOBN(0x167db0ed, 0x817bd377),
+     TOBN(0x5d45b3da, 0xdfb64d05), TOBN(0xed4b7fc4, 0xf0b414ac),
+     TOBN(0xc178941b, 0x0bf1dd64), TOBN(0x43feac17, 0x8fe835a5),
+     TOBN(0xe1c23a17, 0x6a014609), TOBN(0x63255991, 0xd5e23bd5),
+     TOBN(0xefc76468, 0xd7dfec55), TOBN(0xb1bc3fee, 0xc0831696),
+     TOBN(0x0996811b, 0x5f52433b), TOBN(0x6b8b6daa, 0x799649fc),
+     TOBN(0x6e9f7cb6, 0xab518b64), TOBN(0x6a67a009, 0x38a3a2ab),
+     TOBN(0xe55de954, 0x928209e2), TOBN(0x98b6d0a7, 0x3da81142),
+     TOBN(0xdec30331, 0xe3f832e8), TOBN(0xa9b77f3b, 0xe50fa9e3),
+     TOBN(0x20febc21, 0x5167c6a6), TOBN(0x0ce07d1a, 0x76fb0f13),
+     TOBN(0x9745dead, 0xe796f8a3), TOBN(0x2cb4eb1f, 0xd95deba6),
+     TOBN(0x062e7cac, 0x4caf2afe), TOBN(0xf50ce065, 0x16ace879),
+     TOBN(0xdec8954b, 0x1d99d3e7), TOBN(0x5287e954, 0xa48262c7),
+     TOBN(0x1c6fbd17, 0xcc3530de), TOBN(0x6bcbea50, 0x53af4211),
+     TOBN(0xe3533bca, 0x4dce058d), TOBN(0x6fe62e64, 0xfc9cdf00),
+     TOBN(0xee29fdec, 0xe8ec4cf9), TOBN(0x7361797d, 0xc8d52f80),
+     TOBN(0xb1d858da, 0xf4e36023), TOBN(0x4a1282ce, 0x73e6dee1),
+     TOBN(0x6ba8f8ba, 0xce1d71cc), TOBN(0xf5b7d6b4, 0xcbbd8eb9),
+     TOBN(0x60f8bd50, 0x5aed382b), TOBN(0x47b40519, 0x3f3a46b1),
+     TOBN(0xaed13bb9, 0x8a997d93), TOBN(0x6cc2260e, 0x4dc6e35d),
+     TOBN(0x173bfcdd, 0xccf915d9), TOBN(0xad4525e1, 0xc2d46f6e),
+     TOBN(0xb7ecec0b, 0xcdd2382b), TOBN(0x01ae8291, 0xd2b76c84),
+     TOBN(0x2d1e2a91, 0xbec6b980), TOBN(0x1b0040be, 0x7008a00c),
+     TOBN(0x6ac708d7, 0x7d555120), TOBN(0xa6017568, 0x0d745eef),
+     TOBN(0x735e3511, 0x1ed38ef4), TOBN(0x7c97f284, 0xcebe5a8c),
+     TOBN(0xd4059313, 0x24fecbac), TOBN(0xf874ca4b, 0xde18c42c),
+     TOBN(0x9ab736a8, 0xdbb829b6), TOBN(0xe914bdde, 0x82ff128d),
+     TOBN(0x6e949bab, 0xfd0f362b), TOBN(0x275824cf, 0xffea2e79),
+     TOBN(0x81f57245, 0x8cc52417), TOBN(0xed0a9079, 0x2f274090),
+     TOBN(0x98c3372e, 0xfdd0ba2f), TOBN(0x49820f41, 0x3ae99478),
+     TOBN(0x1c47e09f, 0xce373d3e), TOBN(0x875d7920, 0x6dd12846),
+     TOBN(0x7a9e7973, 0x15d5bbb1), TOBN(0x48512656, 0x6d227962),
+     TOBN(0x2c167c88, 0x199241e3), TOBN(0x98c1df6a, 0x7209ca37),
+     TOBN(0x09a1583f, 0xde89e412), TOBN(0xc19ed5b9, 0xc792de48),
+     TOBN(0xb8dd1b1d, 0x74dc0834), TOBN(0x9d458529, 0xa04456e9),
+     TOBN(0x66ef5463, 0xad0ad39d), TOBN(0x8d7df4a1, 0xe641edc5),
+     TOBN(0x97815de2, 0x6bd322e4), TOBN(0x0bf6fc83, 0xc1f77fb3),
+     TOBN(0x49378167, 0x8b4f7152), TOBN(0xfdd476ef, 0xbf0a1712),
+     TOBN(0xe87e1977, 0xf2f9883a), TOBN(0xdbb2fcbf, 0x9ad2d034),
+     TOBN(0x5afdd161, 0x64e1a4c6), TOBN(0x0e43f911, 0x3e435191),
+     TOBN(0xde2d1ee6, 0x42253804), TOBN(0x6def6ceb, 0xdaf13e57),
+     TOBN(0xae09fd4f, 0x05423bab), TOBN(0x6f6c17b8, 0xad46e409),
+     TOBN(0x966fa09d, 0x6c345cd3), TOBN(0x6c8aa1e9, 0x47abc35d),
+     TOBN(0x02991686, 0xe015a566), TOBN(0x39b3aeee, 0xcd2f925d),
+     TOBN(0xf9cda92a, 0x9119c117), TOBN(0x7b21ce82, 0xf4f833e1),
+     TOBN(0x87517bf5, 0xe4f99193), TOBN(0x1b7ddec9, 0x4eb412f9),
+     TOBN(0x7a30dd57, 0x6b077498), TOBN(0xe060625f, 0x0ec44230),
+     TOBN(0x0f355dc4, 0xb0e5446b), TOBN(0xdf324d65, 0xbbd2df28),
+     TOBN(0x28c7eb34, 0x649966a5), TOBN(0x97587f4f, 0x26639e19),
+     TOBN(0x0724cc00, 0x0bce0f38), TOBN(0x63578add, 0x4ae6280a),
+     TOBN(0xf1beaa57, 0xc7fd6a1a), TOBN(0x83b1a533, 0x7b017e35),
+     TOBN(0x01c027e3, 0xefdf2ed1), TOBN(0xf373d4ea, 0xd2d31852),
+     TOBN(0xe568acb6, 0x65b8f5d7), TOBN(0xea8ce1b8, 0x1240a545),
+     TOBN(0xb95b0db2, 0x555fac44), TOBN(0x01d18170, 0x768333dc),
+     TOBN(0xf938b55e, 0xab1798ad), TOBN(0x73a0d9dd, 0x999a7e5b),
+     TOBN(0xd2359bb5, 0x57fd9b51), TOBN(0x20f1d4fd, 0x77fb4e5e),
+     TOBN(0xf5efd71f, 0x932dc388), TOBN(0x40f86819, 0x21a37385),
+     TOBN(0x05395fb2, 0xff935ef3), TOBN(0xc2ee43ac, 0x1b615e8e),
+     TOBN(0xa3bb6518, 0xe82d509a), TOBN(0x3a87d5a2, 0x30b93347),
+     TOBN(0xac0a5ad0, 0x5b130bcc), TOBN(0x91fe8fdd, 0x9154d73a),
+     TOBN(0x677d7d48, 0xdeb203a2), TOBN(0x4d4108fe, 0x8b0168e1),
+     TOBN(0x16be4ad1, 0xddc3d24c), TOBN(0x9b0ea387, 0x9865df69),
+     TOBN(0x16daf932, 0x4c50ec70), TOBN(0xa4799bda, 0x478c96a3),
+     TOBN(0x4ef24d3f, 0x7114d3bb), TOBN(0x30a31509, 0x46e6bbdc),
+     TOBN(0x60137187, 0x97f3cb4b), TOBN(0xf2b66d8f, 0x0a29d865),
+     TOBN(0x93a4a37a, 0x60064a5c), TOBN(0x7dee9bed, 0xe8c3cf47),
+     TOBN(0x748833ce, 0x0b7ee8b8), TOBN(0xc07f2f6d, 0x56f89483),
+     TOBN(0xd71a40d8, 0xd24b406f), TOBN(0xbe3b2e8f, 0xebbb7655),
+     TOBN(0xa23c2b05, 0x4a536998), TOBN(0xdcaf45b3, 0xa9be2e14),
+     TOBN(0x515ad15f, 0xfe346ad1), TOBN(0xb9c06a18, 0xb7847640),
+     TOBN(0x8552eb06, 0xf35bff4a), TOBN(0x4fb792e7, 0x2b7a29f5),
+     TOBN(0x1cce2af5, 0xa41a38b4), TOBN(0xde68bd0d, 0x02b42414),
+     TOBN(0x8124d6e2, 0x7cd66728), TOBN(0x5906d1b4, 0x55efbadd),
+     TOBN(0x7e17855a, 0x827f2741), TOBN(0xab525dfb, 0x12c6966c),
+     TOBN(0x065ae99a, 0x758e0cd3), TOBN(0x0dcb8f5d, 0x517318a9),
+     TOBN(0x48756645, 0x42441f5e), TOBN(0x03859154, 0xd79d535e),
+     TOBN(0x99bb28cd, 0x8217e4bf), TOBN(0xd6aed2e5, 0x8291e54d),
+     TOBN(0x8f9067e3, 0x1c92a65e), TOBN(0x120890ea, 0x1540b9b5),
+     TOBN(0x227d7c86, 0xec60a215), TOBN(0xb6609e85, 0x556d8c65),
+     TOBN(0xa6a26c37, 0x47f8c8a3), TOBN(0x4c850fe3, 0xf1204bdc),
+     TOBN(0x25f7e61a, 0x42db4eb8), TOBN(0xfdf05575, 0x3d62869d),
+     TOBN(0x8b36a744, 0x52b31c23), TOBN(0x83b83c89, 0x1a5e8d4c),
+     TOBN(0x72d38dd3, 0x5d9208bf), TOBN(0xbeb8873b, 0x8cf7b6f4),
+     TOBN(0xa3ec5c36, 0xcf90bcb6), TOBN(0x35adda6f, 0x9a6d5fe7),
+     TOBN(0x7312423d, 0xf61c68d9), TOBN(0xb1c4e10f, 0x20bcaf77),
+     TOBN(0x4df2850d, 0xf168ee57), TOBN(0xed07a4de, 0x180985e1),
+     TOBN(0xcb353d6b, 0x2fba1f23), TOBN(0x00ea9094, 0x778cc15e),
+     TOBN(0x4967faaa, 0x20857170), TOBN(0x9ff70dbe, 0xd7153bc4),
+     TOBN(0x49eb7994, 0x59f62fc6), TOBN(0x5f459faf, 0x3c91862d),
+     TOBN(0x1c10f621, 0x46d8f2e0), TOBN(0x7e669c9a, 0x252954e7),
+     TOBN(0x4ccf659a, 0xa83f6c57), TOBN(0xdc2b77eb, 0xec0a0a03),
+     TOBN(0xcf09ad07, 0x2cc6b8a2), TOBN(0x231960fc, 0xa97aa2d0),
+     TOBN(0xc0609130, 0xde227de8), TOBN(0x40d2691c, 0xf1d7ddf1),
+     TOBN(0x60349cf4, 0xf9a73890), TOBN(0x3f50005d, 0xf9968132),
+     TOBN(0xb4be853e, 0xf16f44b9), TOBN(0x48bf4804, 0x799caac5),
+     TOBN(0xe6a64876, 0x3c562849), TOBN(0x2f4d487f, 0x854f283f),
+     TOBN(0x64b77e39, 0x159484c4), TOBN(0xd419d4bd, 0x523e1529),
+     TOBN(0x1bf9510c, 0x143dcf7d), TOBN(0xa85bea71, 0xed5cb4e1),
+     TOBN(0x73a4cfd2, 0xec715818), TOBN(0x88b11d0e, 0x67f475f5),
+     TOBN(0xbfe170d8, 0x4d12361c), TOBN(0x9fc48e64, 0x00a0f979),
+     TOBN(0x6a8bb2dd, 0x65682105), TOBN(0xc1362a9c, 0x00bd952a),
+     TOBN(0xef5b3d89, 0xa6013753), TOBN(0xc87bbacb, 0x8fdfa22a),
+     TOBN(0x74fbdfc0, 0x31bb19e4), TOBN(0x7d058029, 0x32bfe260),
+     TOBN(0x54a4cce4, 0xe53da990), TOBN(0x01acdff6, 0x822da672),
+     TOBN(0xd2a2d484, 0x95597766), TOBN(0x5960ac1f, 0xd43dc7fd),
+     TOBN(0xcf095b6f, 0x8d6db685), TOBN(0x87232088, 0xa85618f3),
+     TOBN(0x91497a48, 0x34753c7c), TOBN(0xf682e372, 0xd6353024),
+     TOBN(0x7889ceda, 0x0c9b271c), TOBN(0x7126504e, 0x18340951),
+     TOBN(0xf786b821, 0x967c8a60), TOBN(0xfce01b37, 0xc17f3d99),
+     TOBN(0xe23c00a1, 0x1f2a8575), TOBN(0x7f56aa1b, 0xab6ff8a0),
+     TOBN(0xdb73869d, 0xd193dfcb), TOBN(0xbec02c94, 0xd644733e),
+     TOBN(0x283117bc, 0xf7b43261), TOBN(0x920acf5d, 0xb4108e39),
+     TOBN(0x33f1ef5e, 0xe49aebb8), TOBN(0x9ead51e4, 0x0fcea2c1),
+     TOBN(0x1f800a68, 0xf8503f28), TOBN(0x78818531, 0x34a75f67),
+     TOBN(0x1aeb3760, 0xb70ffb27), TOBN(0x1cca590a, 0xcb6309e9),
+     TOBN(0x8d09f360, 0x7170d241), TOBN(0xbc970b5b, 0xa0e0d0f8),
+     TOBN(0x2ec93eea, 0x31d038a3), TOBN(0x3482a0d7, 0x5153f8a2),
+     TOBN(0xedcbe914, 0x6641b5d8), TOBN(0xc086e61b, 0xe516e387),
+     TOBN(0x03814266, 0x9b875513), TOBN(0x6d37fee3, 0x37340a4f),
+     TOBN(0xcf78515e, 0xe5d17ab7), TOBN(0x0c7cd830, 0x4119a759),
+     TOBN(0xbd49062b, 0x54924618), TOBN(0x34c44f45, 0x41e7e7a3),
+     TOBN(0x0039f3d2, 0x706bd0af), TOBN(0x146cadc6, 0x0be9a628),
+     TOBN(0x6d5d5020, 0x57d48746), TOBN(0x0ea43f7b, 0x82caf4b0),
+     TOBN(0x11a08927, 0x8a064d34), TOBN(0x30c0ef40, 0x95638fa2),
+     TOBN(0x4b950c04, 0x602a871b), TOBN(0xf50cb1ef, 0x6a731537),
+     TOBN(0xb87a1cd3, 0xcbe5e4ef), TOBN(0xb1fc4894, 0x3dd1c601),
+     TOBN(0xdf402711, 0xa516617a), TOBN(0x5bdd1d67, 0xaaf63c65),
+     TOBN(0x020d1062, 0x6e559bd9), TOBN(0x4dec26d0, 0x81ec09fc),
+     TOBN(0x7b91fafd, 0xeeeeb2bc), TOBN(0x56290f98, 0x33aaf2c4),
+     TOBN(0x57abbd27, 0x79c7bf9e), TOBN(0x568bdee6, 0x2b1e1ecf),
+     TOBN(0x58f8c80c, 0x470f1d01), TOBN(0xeecfe398, 0x1b9cb76b),
+     TOBN(0xc0ffa4de, 0x311a0634), TOBN(0x425fcd13, 0x0ae99877),
+     TOBN(0x1964c681, 0xf7bd0748), TOBN(0xebcca16f, 0x9d920471),
+     TOBN(0xa72b40cb, 0xab4aa03e), TOBN(0x4397d6af, 0xa05624fc),
+     TOBN(0x372d522c, 0xa94fca0a), TOBN(0xe1010d60, 0x3035b9fc),
+     TOBN(0x9f1f00cc, 0x4f788d44), TOBN(0xfd00ec75, 0x6a88b672),
+     TOBN(0x53706702, 0x2983aef7), TOBN(0xa5f67b0b, 0x9b458edb),
+     TOBN(0x10789b90, 0x7db93ca8), TOBN(0x885346f0, 0xfd27cd55),
+     TOBN(0x3af5b0c8, 0x2ebb5f15), TOBN(0x282e4c4a, 0x2a36b2a7),
+     TOBN(0x2f9d5d8b, 0xa6d88bd4), TOBN(0x6f016bda, 0x9856b7aa),
+     TOBN(0x990ae53e, 0xa8198c1d), TOBN(0x295beceb, 0xa07e7ac5),
+     TOBN(0x576f790f, 0x48c2d246), TOBN(0xe99ab2ae, 0xe3ea9864),
+     TOBN(0xcf4959f2, 0x43e2d400), TOBN(0xdd1d8fad, 0x7a39dfea),
+     TOBN(0xdd6ff9c2, 0xfcd7fda0), TOBN(0x61c25b3e, 0xb6ace55e),
+     TOBN(0xf94742af, 0xb4dcddad), TOBN(0xc49cfa21, 0x44601959),
+     TOBN(0x07b3f1d1, 0x30c18470), TOBN(0x2736cb99, 0x6e6afc82),
+     TOBN(0x401fb234, 0xe24a8785), TOBN(0x9af8ba40, 0x074f51ea),
+     TOBN(0xe1acc646, 0xa9faed0c), TOBN(0xd5a5f789, 0xc9667008),
+     TOBN(0xc6436514, 0x68c3ab8f), TOBN(0x6fa0d734, 0xfe8d6b46),
+     TOBN(0xe5fccbfc, 0xaf7f49c7), TOBN(0x42c88c53, 0xbebcc58c),
+     TOBN(0x7d2e2fed, 0xe2a0f7f2), TOBN(0x694eb76c, 0x36a18b26),
+     TOBN(0xf0e6ae43, 0x6b0f657b), TOBN(0x8a0f6255, 0x48f1ece7),
+     TOBN(0xd594c168, 0x8674bfee), TOBN(0xe59ad38d, 0xac7d5ebd),
+     TOBN(0x080a6b97, 0x21645a1e), TOBN(0xb900f0e1, 0xf221b37b),
+     TOBN(0x562dabce, 0x04cab97d), TOBN(0x5c308741, 0x6f472462),
+     TOBN(0xa5d87e23, 0xc7c4cba8), TOBN(0x5237fe16, 0x9b061062),
+     TOBN(0xeddfbeb4, 0x222021c1), TOBN(0xa4fe57d0, 0x4e7a2a8e),
+     TOBN(0x0fbf6bdb, 0x2de56c47), TOBN(0x819588e7, 0x6fcebc6c),
+     TOBN(0x14196961, 0xdf041e3a), TOBN(0x76a31437, 0x40cd4f23),
+     TOBN(0x44acd14d, 0x8e1a877d), TOBN(0x227a35c6, 0x37d7b7de),
+     TOBN(0xe1934f1d, 0x842a9534), TOBN(0x7a2ed2c1, 0x53ed73e2),
+     TOBN(0xcffedd58, 0x3903924b), TOBN(0x7c9dbf55, 0xb306431d),
+     TOBN(0x61a72f10, 0x56e06ab5), TOBN(0xb46cf5cc, 0x616bc5cb),
+     TOBN(0xecf07e10, 0xf7c22216), TOBN(0xa4bddad9, 0xd9364b3a),
+     TOBN(0x548b95b2, 0xda8b1c93), TOBN(0xc09a9598, 0xa1e1c0cb),
+     TOBN(0xedd80ef1, 0x21d80851), TOBN(0x4684c439, 0xc283f047),
+     TOBN(0x07ca41f3, 0x87333da3), TOBN(0x173ec4de, 0xca79a8f4),
+     TOBN(0x89ce06f2, 0xb4aec6eb), TOBN(0xfe6b0e92, 0x15aaf7f0),
+     TOBN(0xdab8876d, 0x7c1b9ed3), TOBN(0x88aba90f, 0xa2606f83),
+     TOBN(0xcd21a408, 0xbebaf9f6), TOBN(0x09da6696, 0x0042a162),
+     TOBN(0x4a9b8b21, 0x2d66ccf6), TOBN(0x34c74904, 0x44d5a648),
+     TOBN(0xf3fe98e9, 0x3b0e9564), TOBN(0xe4a8a352, 0x221aa4a5),
+     TOBN(0x6278b4b5, 0x26c2b53e), TOBN(0x4ddf26ce, 0x1b1708ea),
+     TOBN(0x704207af, 0x6eb0d845), TOBN(0x60533de3, 0x0f5862ef),
+     TOBN(0x2b5945dd, 0xe54393c0), TOBN(0x55941df2, 0x145ea298),
+     TOBN(0xe2b500b6, 0xc240f654), TOBN(0x5a49d8f1, 0xcf9f6934),
+     TOBN(0xfe8d5468, 0x27502203), TOBN(0x985039d4, 0x58ade316),
+     TOBN(0xefd373f1, 0x0a687415), TOBN(0xefccb791, 0x43526774),
+     TOBN(0xeef8d46e, 0x0f4497d9), TOBN(0x4152df71, 0x1601ab9a),
+     TOBN(0x4250cd2f, 0xe47b2ad1), TOBN(0xa2b63fa5, 0xfb048180)},
+    {TOBN(0xd8a6cb6f, 0x787d1f1c), TOBN(0x427bac94, 0x3d219a66),
+     TOBN(0x51d7d49f, 0x383146b0), TOBN(0x8164b77f, 0x7863d781),
+     TOBN(0x1646b084, 0x2f9631b8), TOBN(0xef5b3aa8, 0x849388df),
+     TOBN(0x60536422, 0xe58cd383), TOBN(0xb079d911, 0xf43ea3a0),
+     TOBN(0x504ac041, 0xcb73887e), TOBN(0xf878b618, 0xc3ce3a33),
+     TOBN(0x57ef73d5, 0x56393e75), TOBN(0xe4372d2e, 0xd276c08c),
+     TOBN(0xfd9bc894, 0x0924cf58), TOBN(0xfa2a4deb, 0xaaa317e2),
+     TOBN(0xe51edccc, 0x79608da5), TOBN(0xadcc68fa, 0x8cd4b960),
+     TOBN(0xaa66c201, 0xf8e156c7), TOBN(0x7c7cf22e, 0x1ab2e3fe),
+     TOBN(0xe479c393, 0x0a677d85), TOBN(0xc0cd340f, 0xb87c412b),
+     TOBN(0x2b2bcef4, 0xf95ff321), TOBN(0x65da11c9, 0xb8409952),
+     TOBN(0x143a2218, 0xeb67eb9c), TOBN(0x8919ff25, 0xe53508e4),
+     TOBN(0x6f154f09, 0xa9e0eeae), TOBN(0x2246e6fe, 0xab05a657),
+     TOBN(0x4d7c1c81, 0x1045b85d), TOBN(0xde99ea37, 0xd3bb7432),
+     TOBN(0x058f8187, 0x63184ff4), TOBN(0x2a223421, 0xd134bfc3),
+     TOBN(0x1560dbed, 0x23120320), TOBN(0x37243c95, 0x76a3de9c),
+     TOBN(0xb8f3851a, 0xd36a81b1), TOBN(0xfbc62bfc, 0xbdad7ad9),
+     TOBN(0xf68215c7, 0x561e0f8c), TOBN(0x894131d1, 0x1bcf765b),
+     TOBN(0x8da01f9e, 0x45c5d736), TOBN(0x025de05c, 0x7484e0c1),
+     TOBN(0x62f4c66c, 0x6858b504), TOBN(0x754b85d6, 0xd6dc5f93),
+     TOBN(0x5b37cecc, 0x822a3de0), TOBN(0x422e49b1, 0xa98a37c2),
+     TOBN(0x3ef53d89, 0xbe41e927), TOBN(0x0994dd11, 0xf4d5bffa),
+     TOBN(0xa62ea556, 0xf7eacca3), TOBN(0x37b4e230, 0x7c746025),
+     TOBN(0xb4291e37, 0xa8e14253), TOBN(0x2bfc9eaa, 0x2a2b666c),
+     TOBN(0xf604604a, 0xc26e5588), TOBN(0xf75816ff, 0xa7ec3971),
+     TOBN(0x859e9ec7, 0x26a30a6d), TOBN(0x2ce57b66, 0xa1a5b815),
+     TOBN(0xc7aa4df4, 0xd65e8ec2), TOBN(0xbab6b3bb, 0xa5d82ede),
+     TOBN(0x7a11b25d, 0x7b088314), TOBN(0x501a3891, 0xc2c636ac),
+     TOBN(0x9f116c8f, 0xe256b02b), TOBN(0x71495693, 0xfa5946e0),
+     TOBN(0xeb9696ff, 0xc335452a), TOBN(0x01ca5929, 0x4971162e),
+     TOBN(0xee0a1f50, 0xc0f28e72), TOBN(0x2baac62c, 0x70d8df1a),
+     TOBN(0xcf65d297, 0xf49110f8), TOBN(0x041dbb01, 0x9a45e16a),
+     TOBN(0x8db69426, 0x5e1410c0), TOBN(0xb21f3c6a, 0xa70d0268),
+     TOBN(0x64a3c30e, 0xbac0ddac), TOBN(0xdcebdedc, 0x66a2d33a),
+     TOBN(0xc5dcd769, 0xa519de21), TOBN(0xa692b6a0, 0x19322c69),
+     TOBN(0x454add5b, 0x154fca13), TOBN(0xd2281cf0, 0x4935eba2),
+     TOBN(0xb5f44fe7, 0xf2602323), TOBN(0x772fb6a6, 0x5d68a3db),
+     TOBN(0xf519c5d4, 0x76eec37a), TOBN(0xbc8e9a15, 0xada6c3f4),
+     TOBN(0x9cd2a2f2, 0xf18effee), TOBN(0x9601c142, 0x1808ab42),
+     TOBN(0x05d110f7, 0x0480ad18), TOBN(0x5f7e0721, 0xef6a7f33),
+     TOBN(0x1afbeaec, 0xe6409e21), TOBN(0xf6714651, 0x317f7967),
+     TOBN(0x34cd21ff, 0x80124751), TOBN(0xf85c70ec, 0x931d9639),
+     TOBN(0x4e26bef6, 0x1ca19094), TOBN(0xc513f66b, 0x0b841b9a),
+     TOBN(0xe25507bd, 0xb9b41001), TOBN(0xd77fee94, 0x94f49f7c),
+     TOBN(0x20b19223, 0xd39e1ee4), TOBN(0xc8832a2c, 0x4e3e6c2c),
+     TOBN(0x64a8f43d, 0xa3a45c34), TOBN(0x52a05eef, 0x21fb291b),
+     TOBN(0x10d3e24a, 0xe4b68e38), TOBN(0x5289120a, 0xee2d8a40),
+     TOBN(0x33836b98, 0x425b7da8), TOBN(0x5bd418f3, 0xb00c64e1),
+     TOBN(0x10e92e5a, 0xd511c3f8), TOBN(0x17f1301d, 0x18b62b7d),
+     TOBN(0xf710b02d, 0x97f0fcae), TOBN(0x8b1030f6, 0xbd394477),
+     TOBN(0x49040009, 0xe5aab897), TOBN(0xfdb23ac1, 0xce75b4d3),
+     TOBN(0x7a43d904, 0xf2b70e1b), TOBN(0xdc09e995, 0xf94fa56f),
+     TOBN(0x9f314e85, 0xd075dd65), TOBN(0xc0d39ce0, 0xb9e26b8d),
+     TOBN(0xd3f6778e, 0xfdc3b678), TOBN(0xce6573e9, 0xfc8497df),
+     TOBN(0x1f4535f8, 0x67abaf7a), TOBN(0x80706dab, 0xa47dd948),
+     TOBN(0x670ae5bc, 0xc059242b), TOBN(0x3a29bc73, 0xcf5f9308),
+     TOBN(0xd2f8e297, 0x8af2bf74), TOBN(0x98dbb443, 0x6c48bbec),
+     TOBN(0x211a3a96, 0xeb448447), TOBN(0x88ffb240, 0x5af4a2c0),
+     TOBN(0x1959dd34, 0x9cdf9e20), TOBN(0xa4d0d839, 0xf34627e0),
+     TOBN(0xa5cecad3, 0xf00057cc), TOBN(0x22f32cce, 0xc5d97b18),
+     TOBN(0x31a02241, 0xcedc2c97), TOBN(0xf0f5489b, 0x2b632641),
+     TOBN(0xb09091dd, 0xcbfb588f), TOBN(0x5ffd0f38, 0x5d9478e7),
+     TOBN(0x13f141a1, 0xdae35eda), TOBN(0xd25563a6, 0x62f0b26c),
+     TOBN(0x80014b17, 0x1b9dde18), TOBN(0x9fcf8f81, 0x7da49b36),
+     TOBN(0x68aac84a, 0x93519f31), TOBN(0xe14c35c1, 0xc0b3660a),
+     TOBN(0x29f447dd, 0x08195bc5), TOBN(0xc61fbbe6, 0x10bba62f),
+     TOBN(0xc471624c, 0x4ed8621a), TOBN(0x8005f67f, 0x0950a4c6),
+     TOBN(0xdfc3b3e5, 0x93a2a33e), TOBN(0x9c3c815e, 0x3c1d0e42),
+     TOBN(0x1ed1aedb, 0x93904766), TOBN(0xcd5e0cf6, 0x376fd0bc),
+     TOBN(0xdd4c3378, 0x90d03033), TOBN(0xde39db01, 0xd85dca30),
+     TOBN(0x49d01dc2, 0xe6fab58b), TOBN(0xd16d7940, 0x6d449f51),
+     TOBN(0x3fb6cf8e, 0xd20a95e6), TOBN(0x0b10a596, 0xbbeeccb1),
+     TOBN(0x06ceaa62, 0x0005acd3), TOBN(0x09db6b28, 0x47555053),
+     TOBN(0x45d84a85, 0x7e7d18d7), TOBN(0x33c28b02, 0x229ad33e),
+     TOBN(0x1e5a6b52, 0x72e4f34c), TOBN(0x81eefbe6, 0xb64fa831),
+     TOBN(0x4983b84a, 0x2aa209aa), TOBN(0x20777198, 0x38d6a8d6),
+     TOBN(0xbe993805, 0x40096f25), TOBN(0x900d4bdd, 0xec820131),
+     TOBN(0x2170cfd3, 0x2a993f9c), TOBN(0xa0e3d894, 0x2dfe1007),
+     TOBN(0x600d0b5a, 0x0e7df109), TOBN(0xc904985a, 0x47fde3dd),
+     TOBN(0x15597a84, 0xcb89816a), TOBN(0x8ac8b027, 0xb9dfeb9e),
+     TOBN(0x5c9211bc, 0x6450a179), TOBN(0xd448a70a, 0xf6333f95),
+     TOBN(0xe9c9a964, 0x824e1d7f), TOBN(0xc47d3f3c, 0x15750ae4),
+     TOBN(0x959f776b, 0xadcf9482), TOBN(0x00557ffe, 0xe741ceb3),
+     TOBN(0x8b69d3f6, 0x353d7898), TOBN(0x6b4d80d3, 0x45cfa492),
+     TOBN(0xc33ead78, 0x30c313da), TOBN(0x86f96c3a, 0x67eee139),
+     TOBN(0x0c6675c7, 0x08611b15), TOBN(0xf9ee695d, 0x60620c27),
+     TOBN(0xb35d438c, 0xd70c9258), TOBN(0x1bc2b1e7, 0xa5e7a4b1),
+     TOBN(0x38d257f8, 0xef92f629), TOBN(0x090af73a, 0x79fd1eb0),
+     TOBN(0x96ebd1f0, 0xf59342e5), TOBN(0xd4869362, 0x4d053375),
+     TOBN(0x7db504e2, 0x5fab54aa), TOBN(0x17c0801e, 0x6e8e43fb),
+     TOBN(0xd3904d62, 0x136b1941), TOBN(0x5932b753, 0x28a43bd1),
+     TOBN(0x551d895e, 0xacb35572), TOBN(0x3f7a8a46, 0x1a6fdfbe),
+     TOBN(0x9e3ea4fd, 0xf7a2df83), TOBN(0x8b68b26b, 0x64524d44),
+     TOBN(0x74caeeab, 0x126aee21), TOBN(0x590a00a5, 0x915d9e1c),
+     TOBN(0x5ae2a6ab, 0x49b90eff), TOBN(0x74b4cb1e, 0x2df4fe51),
+     TOBN(0x0306ed11, 0x07fcb6ed), TOBN(0x564ebe2e, 0x502f5b30),
+     TOBN(0x5a09a32e, 0x0c89e9ba), TOBN(0x967f9dfb, 0x84f2466d),
+     TOBN(0x8b27416c, 0x26a1a8a0), TOBN(0x1c21ef95, 0xc3158a18),
+     TOBN(0xa7ee1ad8, 0x2be23ae9), TOBN(0x1f312d04, 0x4daa1fcf),
+     TOBN(0x6782f843, 0x44f9c7d7), TOBN(0xb12ea2bf, 0xe19e2681),
+     TOBN(0xd2e43cbf, 0xd20578af), TOBN(0x5566460a, 0xbb5819b4),
+     TOBN(0x86f6c860, 0xb658c03c), TOBN(0xc8d90309, 0x62d42d82),
+     TOBN(0x7975a5f3, 0xcb883ceb), TOBN(0xf6f5cf0f, 0xdcded5a1),
+     TOBN(0x25554fb1, 0xd3eb810b), TOBN(0x3df7536b, 0xa596c7c6),
+     TOBN(0x255ca136, 0x83de31cd), TOBN(0x7ac532ee, 0x7795eb96),
+     TOBN(0xfa9d83a9, 0xb12bc235), TOBN(0x7df5d231, 0x4b287a83),
+     TOBN(0xb2eaaaf6, 0xb4f19fce), TOBN(0x7caabfb0, 0x1a045f6a),
+     TOBN(0x6d1b7f40, 0xb1449e6a), TOBN(0x24ae41da, 0x12d22c82),
+     TOBN(0xb0f7a0c3, 0xc0a9d128), TOBN(0x2adc34d3, 0xaed0d3bd),
+     TOBN(0x4ebf5778, 0x13e778e6), TOBN(0xd3b89bd0, 0xbb8476ba),
+     TOBN(0xe09eb528, 0x37413953), TOBN(0x952b705c, 0xd8ba3471),
+     TOBN(0xcaa81ade, 0x86a79c09), TOBN(0xc08eed3d, 0x7e0e7b2a),
+     TOBN(0x313fb103, 0xc80b4196), TOBN(0x25449ece, 0x88c7ac81),
+     TOBN(0xa6cb9ad3, 0x24f16fa2), TOBN(0x4602c441, 0x728a0c4b),
+     TOBN(0xc3366f88, 0x5a000a9c), TOBN(0x146623e3, 0xef8778bd),
+     TOBN(0x184ba0b1, 0xf0773fdc), TOBN(0xe1d115ef, 0xaecd8d63),
+     TOBN(0x420d5473, 0xae165e6c), TOBN(0xefe137cd, 0x108d8575),
+     TOBN(0x15378c57, 0x6fcff7d9), TOBN(0x49c48099, 0xc1f5b601),
+     TOBN(0x1b0e3aee, 0xf68473f1), TOBN(0xa78329bb, 0xd320720d),
+     TOBN(0x385e521b, 0xdca54cad), TOBN(0x478ce06f, 0x5c5b8d60),
+     TOBN(0x215d7d33, 0xca7c4d4b), TOBN(0x773f3ab3, 0xa095366c),
+     TOBN(0x668e0d11, 0x7afeeaa1), TOBN(0x410cd205, 0x4878d8a3),
+     TOBN(0x2748fd98, 0xb2800646), TOBN(0xf1183786, 0x73a1dbef),
+     TOBN(0xecc31bd2, 0x7567ed3a), TOBN(0x775210df, 0x0ceb3873),
+     TOBN(0x2ea0c2bc, 0x9a8f42ff), TOBN(0x62974240, 0x4a1c029a),
+     TOBN(0x5ee5f5f6, 0x9e4dd41b), TOBN(0x5b1bba80, 0x2e110249),
+     TOBN(0x5ac4eadb, 0x78da8016), TOBN(0xc2978780, 0x1809f79f),
+     TOBN(0x39d2dbce, 0xe3f8c0de), TOBN(0x7fb4b5fc, 0x064d3ba9),
+     TOBN(0x038a736d, 0xcd481ab4), TOBN(0xc4b15c5c, 0x396888eb),
+     TOBN(0x459a896d, 0xd421f36f), TOBN(0x6058b90f, 0x47f54663),
+     TOBN(0x0a5f6771, 0xafefebe5), TOBN(0x45c97ab2, 0xa5b7c2ca),
+     TOBN(0x6d547af9, 0x85139ca4), TOBN(0x6db218de, 0xa29d71cb),
+     TOBN(0xca6e0e7b, 0xfb956184), TOBN(0x6682b6e3, 0x1f660ac6),
+     TOBN(0x3959e396, 0x8b21bceb), TOBN(0x0459fd46, 0x632cf9c8),
+     TOBN(0xc741250c, 0x74f296bb), TOBN(0x29b9cacf, 0x990dbefa),
+     TOBN(0x5065d818, 0xfc35bdf7), TOBN(0xeb8e9e1b, 0xa551dc04),
+     TOBN(0x4f7d6f7d, 0x11befe9e), TOBN(0xa88f1fce, 0x7478fdee),
+     TOBN(0x39b1e053, 0xafa688e3), TOBN(0x562a0d6e, 0xe16847e0),
+     TOBN(0xf6044e4b, 0x34c26d14), TOBN(0x5ebe8727, 0x7df61b90),
+     TOBN(0xa82a4de4, 0x6b5e5a39), TOBN(0xc916b0ba, 0xfb9d296c),
+     TOBN(0x029f1cb2, 0x2e1dc01e), TOBN(0x7699d92e, 0xfc429483),
+     TOBN(0xee0e425a, 0x154560f0), TOBN(0x3f5cdfe6, 0x787b6641),
+     TOBN(0x726d87bb, 0xe5f6794e), TOBN(0x97d73588, 0x23aecad2),
+     TOBN(0x47f4f5b9, 0x09ca351c), TOBN(0xd742ef4b, 0x57dc5e3b),
+     TOBN(0xccd2209d, 0x71411a86), TOBN(0x94d57663, 0x2223e6ce),
+     TOBN(0x228a7400, 0x66c7950c), TOBN(0x2d00ef6e, 0x54dd4e37),
+     TOBN(0x9ea5daf3, 0xd60f66be), TOBN(0x743c58a5, 0x8aca724f),
+     TOBN(0x1f638406, 0x44e38446), TOBN(0x06314bb0, 0x92ef6bb0),
+     TOBN(0xa7459e7f, 0xbb05589d), TOBN(0xc3a39592, 0xbfa913d7),
+     TOBN(0x27dbabee, 0xdf07b190), TOBN(0x1c8a2f33, 0xd2ee62ff),
+     TOBN(0x60c8bcb8, 0xe31e8d63), TOBN(0xea1604d1, 0xce410061),
+     TOBN(0x55e8cfee, 0x3d7f7a98), TOBN(0x49efc316, 0xebc64102),
+     TOBN(0x04c86d8e, 0x41934914), TOBN(0x26667c76, 0xab7facd4),
+     TOBN(0x319158db, 0xa71a8916), TOBN(0xb802942d, 0x114fff43),
+     TOBN(0x5efdef7b, 0x8ce544f5), TOBN(0xf531c718, 0x70e870c1),
+     TOBN(0x4b9a5f1b, 0x4d92071d), TOBN(0xbe767cf2, 0x60cc48b6),
+     TOBN(0xbf389d37, 0x717381ea), TOBN(0xefd9e984, 0x06bc5bcb),
+     TOBN(0xcc8bc960, 0x67ff1110), TOBN(0xd3414c0b, 0xb05612e4),
+     TOBN(0x084e5f05, 0x927fad1a), TOBN(0x999bd581, 0x438e241f),
+     TOBN(0x0c917602, 0xfaa4fab8), TOBN(0xda0520d2, 0x95080657),
+     TOBN(0x3160f928, 0xce2f1af2), TOBN(0x61186d84, 0x364f56e4),
+     TOBN(0xe36a5fc0, 0x25fa68f0), TOBN(0x9e6f66bd, 0x774c584b),
+     TOBN(0x2611bba4, 0x9ecb449a), TOBN(0xb1e0b341, 0xec5a0667),
+     TOBN(0x336de76d, 0x6cddb6c3), TOBN(0x9668b5b3, 0x65a18f95),
+     TOBN(0x1ff6c81f, 0x7c3ec388), TOBN(0x53545b05, 0x40a8e2d0),
+     TOBN(0x990a3cc5, 0x14ae31d6), TOBN(0x769b4c26, 0x063a2995),
+     TOBN(0xcea238f4, 0x039e279f), TOBN(0xbfc5cfb9, 0x732fb38e),
+     TOBN(0x99f5a33c, 0x82fa05d8), TOBN(0x274dc741, 0x69c42686),
+     TOBN(0x193338ee, 0x76af2af7), TOBN(0x0488c19f, 0x6914ae66),
+     TOBN(0x8d197f4e, 0x5fc58bf4), TOBN(0x23de54df, 0xf0e61d4b),
+     TOBN(0x547dd09f, 0x44a165e1), TOBN(0x99878065, 0x1c2d5471),
+     TOBN(0xb2cabfad, 0x39b311db), TOBN(0x0aed63d9, 0x4b61a7eb),
+     TOBN(0x03713ac5, 0xbe8110ef), TOBN(0xaab1917d, 0x50f989d3),
+     TOBN(0x0d80fe98, 0x358fe8b0), TOBN(0xf6e874c5, 0xa7a1f8e3),
+     TOBN(0x05650fd8, 0xdeb42398), TOBN(0xbad3e085, 0x1c44de73),
+     TOBN(0x5369135f, 0x1c27f3c2), TOBN(0x14bc04f8, 0xa7fc74ac),
+     TOBN(0x18cbf622, 0xb5dae291), TOBN(0xce290570, 0x9356b88c),
+     TOBN(0x61bbb446, 0x39eba4e6), TOBN(0xa79c291b, 0x980fee37),
+     TOBN(0xd9f18006, 0x19960cc6), TOBN(0xb0823f41, 0x0ce98896),
+     TOBN(0xf2bc612e, 0x1377df6f), TOBN(0x1c07bded, 0xc0b0e71c),
+     TOBN(0xffbf9841, 0x37211fd5), TOBN(0xbd704a6b, 0x04a81410),
+     TOBN(0x653cd2ee, 0x6abf1c67), TOBN(0x73ab8aa1, 0x40681621),
+     TOBN(0xc0bae4fd, 0x271ada5c), TOBN(0xf567cae8, 0xc46f189d),
+     TOBN(0xd183cb27, 0xa5535334), TOBN(0xcbf133f7, 0xe53c530c),
+     TOBN(0x32e53f78, 0xedd6a17e), TOBN(0x6ce6da9a, 0xa2194fae),
+     TOBN(0xa89b8054, 0x58cd3586), TOBN(0x0037febb, 0x43b520a5),
+     TOBN(0xbe67a2cf, 0x653e2c0b), TOBN(0xc07a1ed1, 0x50301f52),
+     TOBN(0xf98b2b60, 0xf5ea954f), TOBN(0xfa6da95d, 0x7af6c499),
+     TOBN(0x44892091, 0xe3889cb1), TOBN(0x123fc555, 0xd45ae338),
+     TOBN(0x2bc4a9ef, 0x02a63128), TOBN(0xb72012c9, 0xa1dbb436),
+     TOBN(0x8c75f7b3, 0x556a0b46), TOBN(0xe4c6f46c, 0x5b7608a4),
+     TOBN(0xb36abf68, 0x38fce20f), TOBN(0xb5a8e657, 0xbf6c21e1),
+     TOBN(0x9ceaeefe, 0xcecd5963), TOBN(0xe84f200d, 0x6105fc29),
+     TOBN(0xc28981a9, 0x8591e346), TOBN(0x0be4e931, 0x207001f1),
+     TOBN(0x31399d9d, 0x88616b18), TOBN(0x3dac9f55, 0x238c626e),
+     TOBN(0x0213fca7, 0x65574274), TOBN(0xa3560244, 0x827aa853),
+     TOBN(0x3ffbfeeb, 0x1ca99134), TOBN(0x0a4b56f6, 0xd07a2dac),
+     TOBN(0x01795eca, 0x75417a6b), TOBN(0xe2a6dd9c, 0x18a5fb22),
+     TOBN(0x13c97586, 0x8aca0cd8), TOBN(0x3c2bb26e, 0x7c323c52),
+     TOBN(0xa3688cae, 0xe38319bf), TOBN(0xe04b44b4, 0x4c88726a),
+     TOBN(0xfed864d0, 0xb0a88a4c), TOBN(0x3e6cf152, 0x6b1fa305),
+     TOBN(0x8416b5f0, 0x00e18e4a), TOBN(0x3a7603ca, 0xfa4cd8f2),
+     TOBN(0x8b04d5ff, 0x7ec750ef), TOBN(0xe1867f9b, 0x1c1ced05),
+     TOBN(0x87ffd0fb, 0xdac2f8c1), TOBN(0xc9ebe420, 0x08b3cdca),
+     TOBN(0x5028a4fd, 0x029c247e), TOBN(0xd6225a43, 0xa5ae3e76),
+     TOBN(0xfb3fa71c, 0xf970817e), TOBN(0x74216809, 0x9ab4aef1),
+     TOBN(0xca81ee99, 0xa39c2f13), TOBN(0xa8336e42, 0x86a97827),
+     TOBN(0xb75aff99, 0xb6489555), TOBN(0x005b2338, 0xe565435c),
+     TOBN(0xbaee27bb, 0x524bdb34), TOBN(0xbf22e1c9, 0x82e47e71),
+     TOBN(0x6ab1d712, 0x97491139), TOBN(0xf420ce06, 0x2cf4cbff),
+     TOBN(0x9f96a2fc, 0xb2b0c86a), TOBN(0x42765dd9, 0xabeb7335),
+     TOBN(0x7c223bb7, 0x45b7e044), TOBN(0xce3f9245, 0x1794e144),
+     TOBN(0xa0a15b27, 0xf3ee5c4e), TOBN(0x1721c5bf, 0x54622215),
+     TOBN(0x0003fd16, 0xada5a99c), TOBN(0x8e96dd56, 0xdbdccc7b),
+     TOBN(0xd1abdc0b, 0x43f83748), TOBN(0x71cac4a6, 0x0f5ce74b),
+     TOBN(0xb8539aff, 0xd46717ad), TOBN(0xeb65c589, 0xb99661d9),
+     TOBN(0x66b4df3b, 0x85e89e17), TOBN(0xc94fad66, 0x6fc30672),
+     TOBN(0xfd2aa80f, 0x81d90df8), TOBN(0xed73a163, 0xbd8234c1),
+     TOBN(0xe1a2c0b9, 0x72eb45dd), TOBN(0x417e355d, 0x902b5ca9),
+     TOBN(0xa8f55aaa, 0xd5128812), TOBN(0x4826b934, 0x3c14cb79),
+     TOBN(0xeae495e3, 0x394d7a92), TOBN(0xcba23153, 0xb90faec0),
+     TOBN(0xd687c821, 0xf6d9d80c), TOBN(0x951dada2, 0x8bff3082),
+     TOBN(0x4e74f1f0, 0x701708ad), TOBN(0xa6333cd1, 0xdd2134f2),
+     TOBN(0xeea276cf, 0x04665f7c), TOBN(0x527257fc, 0xae74c17a),
+     TOBN(0xeb3fd493, 0xe51b53bd), TOBN(0xae7807db, 0x69ec567e),
+     TOBN(0xa50124aa, 0x5de15fd0), TOBN(0x781bfe70, 0x1336f055),
+     TOBN(0xb5729a74, 0xd70a0dfc), TOBN(0x89da37f3, 0x9f50c1a3),
+     TOBN(0x6e063297, 0xcd8e6c1c), TOBN(0x17eb6ec1, 0x181d0271),
+     TOBN(0x36e7251a, 0xe4e52a8c), TOBN(0x3acfe89b, 0x94705324),
+     TOBN(0xaa94f06e, 0xbc130c3b), TOBN(0x01b5e44c, 0x309ae25a),
+     TOBN(0xb72160f2, 0x0f61b55b), TOBN(0xbef61953, 0xe7bbc3f2),
+     TOBN(0x96734d7a, 0x1bf138a1), TOBN(0xdaa6186c, 0x08c25135),
+     TOBN(0xa3b031b2, 0xf34534a2), TOBN(0x44136619, 0xde46f581),
+     TOBN(0x4d0ed04b, 0x6d379647), TOBN(0x4879d90d, 0xbb2b6735),
+     TOBN(0x8f7e031a, 0x590156e0), TOBN(0x28428354, 0xf42bbc53),
+     TOBN(0x1cbed33c, 0x5c5b791e), TOBN(0x17571645, 0x4cfc5562),
+     TOBN(0x8392350a, 0x7f76462f), TOBN(0x659ce7db, 0x0c216ccb),
+     TOBN(0xe87a78b7, 0x047e35d5), TOBN(0x307c4861, 0x6e0862d6),
+     TOBN(0xd444fb86, 0xe70741bd), TOBN(0x1138a886, 0xfea1abe2),
+     TOBN(0x4695397d, 0x62b79c4f), TOBN(0x11aaf588, 0x003130ee),
+     TOBN(0x53bdda6d, 0x3a11712b), TOBN(0x30c384bd, 0x40fba3d2),
+     TOBN(0x63039585, 0x50ea38be), TOBN(0x7f110eca, 0x3da9738a),
+     TOBN(0xbd701fc6, 0x5b68c01e), TOBN(0xd23f3e8f, 0xcc48f38d),
+     TOBN(0x6e2557eb, 0xf8b9bb65), TOBN(0x29ceb4b6, 0xa3dafc8f),
+     TOBN(0x24659686, 0x4b6b7705), TOBN(0x04143a8a, 0x4aca2b43),
+     TOBN(0x3baed256, 0x975e06d8), TOBN(0x846fb3c9, 0x3e834249),
+     TOBN(0x7890761e, 0x75f6770a), TOBN(0x1187920e, 0x203c78fd),
+     TOBN(0x9b06c3a9, 0x6b26281f), TOBN(0x3fe3dccd, 0xa98215e1),
+     TOBN(0x099d7d7a, 0x4f33655e), TOBN(0x1ba571e6, 0x662fb55a),
+     TOBN(0x1a0d0147, 0xcbc497f0), TOBN(0xa94218ae, 0x2862ff38),
+     TOBN(0x1b0f919b, 0x5ce08047), TOBN(0x9a3ac37a, 0x2baf46cd),
+     TOBN(0x76b7a03a, 0x8964cc68), TOBN(0x5aed8c6d, 0x4d3e1a40),
+     TOBN(0x6607179c, 0x7f034ff4), TOBN(0xefb8fcd9, 0x3781eac2),
+     TOBN(0xfa57f8a9, 0x7b022138), TOBN(0xc5bb9f1d, 0x56ab6039),
+     TOBN(0xf9027e24, 0xe4d2ab7f), TOBN(0x3d67ad71, 0x77a9e364),
+     TOBN(0xc579e70c, 0x1f7f487d), TOBN(0x7fefc894, 0x2a7e6bd0)},
+    {TOBN(0x2cb91662, 0xa45cfd31), TOBN(0x09dd56d3, 0x16f65cfe),
+     TOBN(0x983e005d, 0x14f3de51), TOBN(0xb9dc05b0, 0x210f64fc),
+     TOBN(0x22790afd, 0x885eafe5), TOBN(0xbd5213d3, 0x7444bdec),
+     TOBN(0x289dca92, 0x8987300a), TOBN(0x69fb2ac2, 0xb3960b76),
+     TOBN(0xe3274886, 0x9ae7540f), TOBN(0xd7386631, 0x6131e921),
+     TOBN(0x2e3d4fd8, 0xf2a360c8), TOBN(0xb20a59b6, 0x3d9d41e0),
+     TOBN(0x72b67eae, 0x99082a34), TOBN(0xfad6aa7d, 0x51819470),
+     TOBN(0x7c299b9a, 0xa2d1d007), TOBN(0xc1f841e0, 0x8100bed0),
+     TOBN(0x2c1f7d4c, 0x43e90ebd), TOBN(0x58b78107, 0x1fc72b07),
+     TOBN(0xda8503e1, 0xaf94f402), TOBN(0xfbb724b7, 0x59f244b0),
+     TOBN(0x2fcd2186, 0xfcd8755a), TOBN(0x7407cdee, 0x868482b7),
+     TOBN(0x4d62f578, 0x349be3d5), TOBN(0x4a012544, 0xdcc6202c),
+     TOBN(0xb8a414d2, 0x151ffc08), TOBN(0xaa79acf0, 0x740d6b55),
+     TOBN(0xeeab0104, 0xcdf472ab), TOBN(0x5014a8c1, 0xa3aa5f1d),
+     TOBN(0x8c743405, 0x33f13425), TOBN(0x2b776b49, 0x57eb54d4),
+     TOBN(0x3a0cc4ac, 0x548a723b), TOBN(0x65aae6f3, 0xc79fe63a),
+     TOBN(0xe8b388f2, 0xee5e579c), TOBN(0x31cc9373, 0x991c03d4),
+     TOBN(0x53eed518, 0x567bfa7c), TOBN(0x267e282d, 0x67f985ed),
+     TOBN(0xc435fd22, 0xb4763ea0), TOBN(0xead83837, 0xe39b7703),
+     TOBN(0x806daad5, 0x094ba5b4), TOBN(0xa738a847, 0x45842672),
+     TOBN(0x99421b42, 0x9984c4c2), TOBN(0x1a3bce27, 0xd35c7bbd),
+     TOBN(0xe51ae6f6, 0x3563b09e), TOBN(0x8e67853b, 0x8d9c9fbf),
+     TOBN(0xca8784da, 0x6b2100b5), TOBN(0xe89a24f7, 0x98879bba),
+     TOBN(0xe901b45c, 0xe286b039), TOBN(0x23dedbb8, 0xf50384bd),
+     TOBN(0x4728cbdb, 0x5cbf7df2), TOBN(0xed274fdf, 0x6764329e),
+     TOBN(0xc2af1a07, 0x642d199a), TOBN(0x5d665659, 0x17a50e7e),
+     TOBN(0x7babf4bc, 0xfaa5eb82), TOBN(0xd3bcfc67, 0x99fe4026),
+     TOBN(0xaa5d2648, 0x607d9f41), TOBN(0x7405c071, 0x967efac1),
+     TOBN(0x79447ef9, 0xdfa782a4), TOBN(0x6dadc8e1, 0x74cd9500),
+     TOBN(0x0574020e, 0xdc38f762), TOBN(0x17596d7e, 0xe2ee7a14),
+     TOBN(0x9ef75af7, 0x9e1f8adc), TOBN(0x5ac5f216, 0xa4791da0),
+     TOBN(0x1583226b, 0x7b7b5d80), TOBN(0x59f3f053, 0xa21c26cc),
+     TOBN(0xd80e7fdc, 0xf95e30d9), TOBN(0xecf5041c, 0x0a3a3616),
+     TOBN(0x50b93b8b, 0x03043fa6), TOBN(0xa31a2aa4, 0xae262ad6),
+     TOBN(0x1468b370, 0xd63cd98d), TOBN(0xfb89cc65, 0xdc07a367),
+     TOBN(0x6cf1df6b, 0x4d47b59f), TOBN(0xab451a99, 0x1b6350fe),
+     TOBN(0xeb74554d, 0x8c124dff), TOBN(0x781a8c4d, 0x21be0be0),
+     TOBN(0xfaacc154, 0xe3510068), TOBN(0x16655d65, 0xd6238265),
+     TOBN(0xba46d27b, 0x0466134a), TOBN(0x1a3f51b9, 0x3101e283),
+     TOBN(0xc08298a9, 0x096ec237), TOBN(0x46248627, 0xc69cfb5b),
+     TOBN(0xf9e7a5a4, 0x81a0500f), TOBN(0x92db27d5, 0xbd2e03e7),
+     TOBN(0x3dcce4f6, 0x82899e3c), TOBN(0x861f1797, 0xf39a39c7),
+     TOBN(0x175b2430, 0x69dc8961), TOBN(0x93d2a88e, 0xdc67953e),
+     TOBN(0xa40f3704, 0x92d794d6), TOBN(0x607019f0, 0x3526eeaf),
+     TOBN(0xf20e163b, 0x22f37d65), TOBN(0x70fd00c8, 0x32cf180a),
+     TOBN(0xff1a97d2, 0x0b17244e), TOBN(0x9a5a141b, 0xacedb33a),
+     TOBN(0xf03dd868, 0xcc16bbb4), TOBN(0x9b15372d, 0xa40e44e9),
+     TOBN(0xd5ba6436, 0x15ac397f), TOBN(0xb1a886d4, 0xc821f6b7),
+     TOBN(0xbe3aacda, 0x4b7b4e21), TOBN(0xad9829fe, 0x66b56729),
+     TOBN(0x78965cef, 0xd541cc1a), TOBN(0x414bfea7, 0x7d17631e),
+     TOBN(0xf55835d9, 0xc64dd621), TOBN(0xa0ebf68b, 0xef644d93),
+     TOBN(0x01d15340, 0xc8a40021), TOBN(0x00ae640d, 0x42b99aa0),
+     TOBN(0x92321ee2, 0x6881e64f), TOBN(0xaccab5c8, 0x5267bdd3),
+     TOBN(0x0c1f87ea, 0x5927647b), TOBN(0x0093d07e, 0x162c6d86),
+     TOBN(0x49868df4, 0x389c711d), TOBN(0xe68d69ae, 0xc11e1f37),
+     TOBN(0xa40e7aa8, 0xb4207246), TOBN(0x4ae8d126, 0xce832395),
+     TOBN(0x5f9b128a, 0x86450cc0), TOBN(0x88f76293, 0xc8ec07e6),
+     TOBN(0x0762f293, 0x179702b8), TOBN(0xb5696102, 0x4910006d),
+     TOBN(0x3951291b, 0x35fe0505), TOBN(0x70f75a5c, 0xce8d7056),
+     TOBN(0x4541beaf, 0x2eb13369), TOBN(0x7060a749, 0xa643316c),
+     TOBN(0xee16abd0, 0x49c879a5), TOBN(0x844874a7, 0xa47ac42e),
+     TOBN(0xee3f8a20, 0x3c9c2326), TOBN(0x99a12054, 0xdeaed33b),
+     TOBN(0x4814a15b, 0x63b333ae), TOBN(0xee9f28a5, 0x9d923fa0),
+     TOBN(0x5b0cd250, 0x33b1b1ef), TOBN(0x3ccc39b9, 0x8346d928),
+     TOBN(0xf5c1000e, 0x002bec95), TOBN(0x2ba2f18c, 0xf63528c2),
+     TOBN(0x8102f6c8, 0xcdcec15a), TOBN(0xab7effcd, 0xbb13d14a),
+     TOBN(0x183e0ba2, 0xfcd3787c), TOBN(0xae70635e, 0x2f4a7fc0),
+     TOBN(0x473ed37f, 0x760bbc96), TOBN(0xf0ea0acf, 0x8a8efb39),
+     TOBN(0x63cea36c, 0x29b526a9), TOBN(0xcdb31613, 0x9d03f3db),
+     TOBN(0xa3891096, 0xd57cca8e), TOBN(0x646418a9, 0xa14a8ffc),
+     TOBN(0x10f8906b, 0x8075291f), TOBN(0x8221d941, 0x2c618bf6),
+     TOBN(0x1dc1ae7a, 0x8a5da4df), TOBN(0xb66b96e3, 0x8a8cc8bc),
+     TOBN(0xe4da7e48, 0xfe3551b4), TOBN(0xe6891cc9, 0xad9b3827),
+     TOBN(0xb266733f, 0x6b37b99f), TOBN(0xfccce911, 0xfd5d1219),
+     TOBN(0xe5a47c4b, 0x7262b8cc), TOBN(0x5d349caf, 0xe656af49),
+     TOBN(0x7a3a4a28, 0x7e04e48e), TOBN(0x7c39a68e, 0x80ea7d03),
+     TOBN(0xf35d5e32, 0xbee0d434), TOBN(0x9651f3d9, 0x0b536161),
+     TOBN(0x42634cc9, 0x72cb370c), TOBN(0xa7764026, 0x406b3457),
+     TOBN(0xec7525bd, 0x65d53d80), TOBN(0xf44a1bca, 0xadcc8b05),
+     TOBN(0x12ef8427, 0xda112ddc), TOBN(0x796a65b3, 0x20a0f78f),
+     TOBN(0x12726e24, 0x6bd5b0ab), TOBN(0x9e441467, 0x8242fe07),
+     TOBN(0x4b52e276, 0xde2bea52), TOBN(0x3a76b6b4, 0x10422c2c),
+     TOBN(0x71f14945, 0xb4e496b9), TOBN(0xd20f04b0, 0xf36dce4f),
+     TOBN(0xa0e57d8d, 0x2b310e90), TOBN(0x59eb7737, 0x32ec8f38),
+     TOBN(0x20a19834, 0xaaf6619e), TOBN(0x633b94e8, 0x691a538e),
+     TOBN(0xea1a8985, 0x92cdf395), TOBN(0xa3a01c57, 0x4349b971),
+     TOBN(0x0d65192a, 0x30822c59), TOBN(0x93a5152d, 0xa522ae8c),
+     TOBN(0x5b09a7a3, 0x0e1aa4bc), TOBN(0xdd2588f3, 0x8d3b97a9),
+     TOBN(0xafa1f62a, 0x5b62a3a5), TOBN(0xbded10e6, 0xa9ace9c5),
+     TOBN(0x9d03e061, 0xbf6e7fb2), TOBN(0x60c564a8, 0x4b87177a),
+     TOBN(0x36be1308, 0xc22c14c1), TOBN(0xeeda57e8, 0x9425b6bb),
+     TOBN(0x5ddaae14, 0x36af38c2), TOBN(0x1695464b, 0xecdc2911),
+     TOBN(0x4b795e1d, 0x161e13e7), TOBN(0x0f9abc20, 0x907e7069),
+     TOBN(0xfb3be618, 0x54522fe7), TOBN(0x9e2d0f37, 0x1938134e),
+     TOBN(0xb8dc7c36, 0xd292c6b0), TOBN(0xbafbf59c, 0xc1e77895),
+     TOBN(0x7d0132cd, 0x1b6c55f3), TOBN(0xefa02ed9, 0xf609f087),
+     TOBN(0x4bfe6aeb, 0x03519f9f), TOBN(0x248e19a0, 0xdab4c075),
+     TOBN(0x83ee803d, 0x69429f29), TOBN(0xdbbe31e2, 0x8190ce56),
+     TOBN(0x3ba735d2, 0x6b787a5d), TOBN(0xfa021185, 0x1818070c),
+     TOBN(0x9b653000, 0xa3683cee), TOBN(0xfc3c7907, 0xe9517ba2),
+     TOBN(0x6521c92f, 0x88d94f69), TOBN(0x3950e9e8, 0x7b52da8d),
+     TOBN(0xadb81700, 0x8ee64a88), TOBN(0x8ccbfa3c, 0xf73994fe),
+     TOBN(0xb780ab12, 0xb048e71e), TOBN(0x52879e7b, 0xe2aeb607),
+     TOBN(0xef04b1ed, 0x3237554f), TOBN(0xaeba6a96, 0xe1d5a5ef),
+     TOBN(0xedb58542, 0x266f7e93), TOBN(0x9a1b8057, 0x5ea02852),
+     TOBN(0x1963c6f2, 0x5beb3fbd), TOBN(0xf4183355, 0x1ad52473),
+     TOBN(0xca772e9e, 0x6faed2f4), TOBN(0x937eddd0, 0x3cf8fd1f),
+     TOBN(0xb3255376, 0xc1d49dac), TOBN(0x549c2119, 0xe670d3cc),
+     TOBN(0x10edbf39, 0x3b6cd199), TOBN(0xe9479223, 0x75644d6a),
+     TOBN(0x36cfba92, 0xd6e8cc36), TOBN(0xa37b1d91, 0xfe00d80a),
+     TOBN(0x3aadf918, 0xdeb5ef4a), TOBN(0x5bb2ca4d, 0xd3893df2),
+     TOBN(0xa776000e, 0x6569ab8b), TOBN(0x4fb2308f, 0x1cf64905),
+     TOBN(0x04da4d09, 0x273731c2), TOBN(0x1d4a61fe, 0x23c05518),
+     TOBN(0x201098a3, 0x0d5206e5), TOBN(0xd9a7ad4e, 0x06430c82),
+     TOBN(0x56df0d06, 0x36f7f462), TOBN(0x2c067f3d, 0x44c81042),
+     TOBN(0x01193bc9, 0xc453d28e), TOBN(0xcdf5af5d, 0x45ce6e64),
+     TOBN(0x9992ce1a, 0x0f7d8d12), TOBN(0xa7c46a61, 0x0e5e4542),
+     TOBN(0x3fcc0647, 0x057802ba), TOBN(0xa78f73d8, 0xc7dccbe2),
+     TOBN(0x67f37b94, 0xf138dc6d), TOBN(0x89330885, 0x650a9002),
+     TOBN(0xf661caf2, 0x68aa24c7), TOBN(0x47732bcd, 0xbf73c435),
+     TOBN(0xb9ba5f91, 0x3b04622e), TOBN(0x24265f73, 0x477d420a),
+     TOBN(0x5da6ddb0, 0x0d44cb89), TOBN(0x9f8cb8b6, 0x151fc40b),
+     TOBN(0x81b6956b, 0x9b9f2613), TOBN(0x37419206, 0xebb917df),
+     TOBN(0xdb9cfc16, 0x2bb7a709), TOBN(0x7a800aa3, 0xbacd3fb7),
+     TOBN(0xf8ea9359, 0xd93f6e1a), TOBN(0x729005d4, 0x3d41c118),
+     TOBN(0x4c293410, 0x7cb641af), TOBN(0x6b2b4671, 0x895e8e78),
+     TOBN(0x2a1251d0, 0x5958fad3), TOBN(0xb69bc2be, 0x78619fe4),
+     TOBN(0xd74df34c, 0xd911d318), TOBN(0x5def8378, 0x15102704),
+     TOBN(0xb19ea17a, 0x08268482), TOBN(0x14591196, 0x1c37e5d1),
+     TOBN(0xe0e12d2e, 0x7640df9c), TOBN(0x8fd6bd4d, 0x8c941274),
+     TOBN(0xc3f9f120, 0xdcd142b1), TOBN(0x106c49ac, 0x78dfe6b0),
+     TOBN(0x243c8e93, 0xcfd9b542), TOBN(0x6758062d, 0x0a2c5fe6),
+     TOBN(0xee5a99e8, 0x15f2f638), TOBN(0xb95b008d, 0x13979ab6),
+     TOBN(0x7fd03105, 0xacfcca6a), TOBN(0x6af914a4, 0xe4ced1b3),
+     TOBN(0x8bef3d0f, 0xa25f8627), TOBN(0x21bae309, 0xf9b2f931),
+     TOBN(0xe85dee2b, 0x2195a839), TOBN(0x46ad0ad9, 0xa3baeb25),
+     TOBN(0x6d8e40f8, 0x022b62a9), TOBN(0x4a6bbabf, 0x90b5cd33),
+     TOBN(0x53481e6b, 0xffa89bb2), TOBN(0xd674b3b3, 0x22003cc2),
+     TOBN(0xc71a0a85, 0x004a2aa6), TOBN(0x86df9697, 0xb5404657),
+     TOBN(0x407727f4, 0xc74e80cc), TOBN(0x39c13926, 0x950a7b08),
+     TOBN(0x26bee75a, 0xd74472a4), TOBN(0xbf7c4ea0, 0x2eb6f0d6),
+     TOBN(0x689a5de5, 0x608bea48), TOBN(0x5b383892, 0x29d513f8),
+     TOBN(0x49fee2c2, 0xda457cf9), TOBN(0x7fc0aee7, 0x62d523d3),
+     TOBN(0x5bf447de, 0xb636a46e), TOBN(0xda3efd98, 0x8194766e),
+     TOBN(0xa77c3ad2, 0xd382756d), TOBN(0xc0eaa9de, 0x0fa55315),
+     TOBN(0xe68d0a51, 0xb1df90e3), TOBN(0x0994e8c7, 0x01d1d8a7),
+     TOBN(0x4f898bc3, 0xa91bfed0), TOBN(0x1c2a3e46, 0xab6025df),
+     TOBN(0x37bd5c37, 0x8b269271), TOBN(0x4e07f5ca, 0x8b97f0af),
+     TOBN(0xe346b5aa, 0x97923d14), TOBN(0xa8549f61, 0x9e0bd9c4),
+     TOBN(0x78e59d6b, 0x40113a60), TOBN(0xe3015fb2, 0xed8a0fc6),
+     TOBN(0xfc56a08f, 0x8b43288a), TOBN(0xcbdb8cae, 0xcae6c18a),
+     TOBN(0xcb147c44, 0x5f4423db), TOBN(0xa6aaa6c9, 0x10f361c1),
+     TOBN(0x6be86c0c, 0x7caf702a), TOBN(0x2188e83c, 0x736f6dac),
+     TOBN(0x40b5ed25, 0x59ba2af9), TOBN(0x76211894, 0xab8018c3),
+     TOBN(0x0c1c532f, 0xf5b0b048), TOBN(0x7503aca9, 0xe3200521),
+     TOBN(0xb9325d85, 0xdfa7eb2d), TOBN(0xe6c25a00, 0x2edbb68f),
+     TOBN(0xf9ff5867, 0x8c673c89), TOBN(0x4925a046, 0x099c7bae),
+     TOBN(0x0b3bf59a, 0xdbb1e1b6), TOBN(0xc7e9d9f2, 0x30ae084f),
+     TOBN(0x70982396, 0x0fa1776f), TOBN(0xb2e1b98f, 0x624c897b),
+     TOBN(0xa9a6407d, 0x6c3534d5), TOBN(0x5e22319b, 0xa4dc3f63),
+     TOBN(0xc2f0bf3f, 0x2431dc01), TOBN(0x478f797d, 0xc2cfb315),
+     TOBN(0x6559f59c, 0x3b3ae0c5), TOBN(0x7e95aa62, 0xe18e74a8),
+     TOBN(0xf2a94006, 0xd3fce912), TOBN(0x7f1b57a2, 0xe1bd96ce),
+     TOBN(0x55028ad0, 0xa3d7b828), TOBN(0xadae7e92, 0x4f09fe92),
+     TOBN(0x2174c736, 0x757b418f), TOBN(0xd904ba43, 0x3661d54d),
+     TOBN(0x0281f912, 0x63218ecb), TOBN(0x5fd03ba0, 0xc50c8eb6),
+     TOBN(0x29626906, 0x896a5aea), TOBN(0xab4d3f27, 0xe55ee73f),
+     TOBN(0x3db1c43d, 0xedfd1991), TOBN(0x498cc31a, 0xa3f9c340),
+     TOBN(0xa43bdec1, 0x4fe75d33), TOBN(0x5b067dfb, 0x66ae5d4f),
+     TOBN(0x84581814, 0x464c8239), TOBN(0x2f10557f, 0x503a52ea),
+     TOBN(0x21c4c180, 0xa10fbb90), TOBN(0x33b191ee, 0xf79d5e02),
+     TOBN(0x6dee3881, 0xb499478e), TOBN(0x27dfef0b, 0xbfbd56fa),
+     TOBN(0x671a3dd7, 0x28be2d62), TOBN(0x06f2f4c2, 0x050897ff),
+     TOBN(0xd92bdab6, 0xb7c4587d), TOBN(0xd2253a16, 0xfd8d5160),
+     TOBN(0x64f6e4ae, 0xf1c098b1), TOBN(0x005a3939, 0x11ea7255),
+     TOBN(0x2ed4eb92, 0xdab542e5), TOBN(0x26920bc1, 0x50c5e874),
+     TOBN(0x93e8f58a, 0x5d0bc87c), TOBN(0xaa4d313e, 0xb2b29b4b),
+     TOBN(0x3e175dec, 0x01b2096f), TOBN(0x6c560972, 0x1cf31783),
+     TOBN(0x9d41aca2, 0x73b76f6b), TOBN(0xa2454cf5, 0x5f1d4b12),
+     TOBN(0xa5615196, 0x65b35eea), TOBN(0xf241e516, 0x70af4fde),
+     TOBN(0x5255e91b, 0x65061472), TOBN(0x6ef98d2d, 0x5bdbb257),
+     TOBN(0x0d1d1ab1, 0xc74c7b2c), TOBN(0x9ffb9fdf, 0x2e9febde),
+     TOBN(0x853f3b9f, 0x6c50bf24), TOBN(0x3d369594, 0x6fbd22bd),
+     TOBN(0x4d281126, 0xbcdad9a9), TOBN(0x99eb62b6, 0xdc46ddc1),
+     TOBN(0x5aa8c8b2, 0x4b10c402), TOBN(0x2e79f595, 0x473af61d),
+     TOBN(0x96153360, 0xce360f37), TOBN(0x16dffe22, 0x66bc29dd),
+     TOBN(0x35536eb1, 0x1137f9c3), TOBN(0xd636ecad, 0xe2a6a47a),
+     TOBN(0x83cdf214, 0xb499f840), TOBN(0x3642c77c, 0xd247f18c),
+     TOBN(0x4d906a2e, 0x916ef527), TOBN(0xadeb94d0, 0x293dc085),
+     TOBN(0x03a07801, 0x1491da3e), TOBN(0x177dceae, 0x0b84d2eb),
+     TOBN(0x61e5a3c1, 0x7b691e0c), TOBN(0x47d40bd7, 0xd172cea3),
+     TOBN(0x7d0646ad, 0x8ca76bce), TOBN(0x90b030a9, 0xc64d635f),
+     TOBN(0x71eca8e7, 0x97118df2), TOBN(0x2cd48f70, 0x3ac9536b),
+     TOBN(0x9ffd991d, 0x89fb4d72), TOBN(0xd49006bc, 0xebf781fb),
+     TOBN(0x688af07f, 0xd3e60da1), TOBN(0x5f74aa46, 0x619063b7),
+     TOBN(0x44fcbeb3, 0xa40d313f), TOBN(0x0ed5908b, 0x326faaa4),
+     TOBN(0xe836d537, 0xf41ec05d), TOBN(0x01eaf207, 0x221b0c32),
+     TOBN(0x1d6a0bb6, 0x72f8c904), TOBN(0xa6ef58b2, 0xdfd74641),
+     TOBN(0xbb855ceb, 0x811bd6cb), TOBN(0x7b1c8b71, 0x05408eab),
+     TOBN(0xd24d709e, 0x4187fb7f), TOBN(0x283d647d, 0x8b30a9be),
+     TOBN(0x6d9d3793, 0xf9f0d6e6), TOBN(0x02fc3ddb, 0xb1c06b19),
+     TOBN(0x8ff86793, 0x94d9abec), TOBN(0x1f20bba2, 0x24705873),
+     TOBN(0x74eebc12, 0x0021b290), TOBN(0xd859521e, 0x35b6c157),
+     TOBN(0x2201aa41, 0x431aea79), TOBN(0x79c1caaf, 0x90da1a75),
+     TOBN(0xcd6abab7, 0x6e412a6a), TOBN(0x82399139, 0xb4c58b05),
+     TOBN(0xdf416966, 0xa3b55538), TOBN(0x2b2d546f, 0x679882d3),
+     TOBN(0x17425cbc, 0xf9145657), TOBN(0x3cc6735f, 0xe1b8247e),
+     TOBN(0x13e50c56, 0x57edd04c), TOBN(0xc8723137, 0x1b85b7cb),
+     TOBN(0x907b5b02, 0xdc0ab9d5), TOBN(0x5617fb7f, 0x4ab23b78),
+     TOBN(0x7ae8ff03, 0xe8f449cd), TOBN(0x86d3ff17, 0x174e0e22),
+     TOBN(0x22cb7f69, 0xbf1e9f8d), TOBN(0x12f0abbe, 0x0b0c62f0),
+     TOBN(0xc8315981, 0x537f658c), TOBN(0x43da2770, 0xc467f2b4),
+     TOBN(0x3ef9bb81, 0x5b9e88ef), TOBN(0xb8526318, 0x3a8e51f2),
+     TOBN(0x2e47cb7f, 0xf8d744ac), TOBN(0x63d6dc16, 0x510aaa7c),
+     TOBN(0x54da7cdb, 0xb40ccc41), TOBN(0xdecbe5fd, 0x402b2ad9),
+     TOBN(0x14c6f15c, 0x34c8f225), TOBN(0x6d8b2342, 0xc6559496),
+     TOBN(0xa4b72281, 0x66fea635), TOBN(0x55f5c27f, 0x22f248a8),
+     TOBN(0x3ced1483, 0x0959cd01), TOBN(0xcc6469db, 0xb53bdf42),
+     TOBN(0x2bb2346f, 0x1e460645), TOBN(0x4d8573c6, 0x9d7535e7),
+     TOBN(0x988cddd5, 0x49cd2d68), TOBN(0x785c4a70, 0xb9835538),
+     TOBN(0xb08337b3, 0x1f6e396c), TOBN(0x6166b21e, 0x49a782f3),
+     TOBN(0x1ac6198b, 0x8ec9b974), TOBN(0xee2e3446, 0x0bb44d3d),
+     TOBN(0xdb283740, 0x35039dd9), TOBN(0x7c708f95, 0x29f5c692),
+     TOBN(0x8914cce0, 0x98ddb466), TOBN(0x8bb1b9f1, 0xd446f3cf),
+     TOBN(0xa9dea222, 0xee0933a3), TOBN(0x2538bd43, 0x4b26049e),
+     TOBN(0x18741aca, 0xbdcafae2), TOBN(0xe0f830f7, 0x16b0f4bb),
+     TOBN(0x0479ec95, 0x902caefa), TOBN(0x1f858937, 0xdcda9e64),
+     TOBN(0xe75b4f7b, 0x515c4089), TOBN(0xb78afde4, 0x2eb91b51),
+     TOBN(0x1eebe3e9, 0x18949935), TOBN(0xde8deaa9, 0xba092037),
+     TOBN(0xd43cf4ef, 0x93609411), TOBN(0xe0fdb1e4, 0xc2d7b76e),
+     TOBN(0x1d3191a5, 0x4e34b4bd), TOBN(0x106d92f1, 0x9ccc4c26),
+     TOBN(0x1a404ef6, 0x29a2a6d1), TOBN(0x3338bc9c, 0xc598f481),
+     TOBN(0x3945e39d, 0xe3fcbf71), TOBN(0x123b082c, 0x9c89ab61),
+     TOBN(0xc7477f77, 0x0f9f3c37), TOBN(0x408c0c7a, 0x7dbcc077),
+     TOBN(0x6c4d99f5, 0x3654f98c), TOBN(0x276a007a, 0x05299a1a),
+     TOBN(0xabd4b8ea, 0x23e2d7d0), TOBN(0xe05a5f3a, 0x86017545),
+     TOBN(0xde3b885c, 0xa11b03cd), TOBN(0x46ef0755, 0x8df5d64e),
+     TOBN(0x112a49d6, 0xbf3f085d), TOBN(0xf6ebf441, 0x198ff32f),
+     TOBN(0x581c00d8, 0x7feae481), TOBN(0xf2b43827, 0xcfde5b2f),
+     TOBN(0x3ceb7f8f, 0x9b7358f2), TOBN(0x95761fbd, 0x55fe7117),
+     TOBN(0x305836fa, 0xdc04773c), TOBN(0x66324504, 0xb3c4873c),
+     TOBN(0x5d878c1f, 0x55b130de), TOBN(0x96e9b28c, 0x8ad49a9b),
+     TOBN(0xd1a707b8, 0x76d70429), TOBN(0xaff33f93, 0xaa402e90),
+     TOBN(0x733d6256, 0xedbfb28f), TOBN(0x9e421a7c, 0xa75d2342),
+     TOBN(0xdf86b254, 0xc02e49c1), TOBN(0x6bb53867, 0xb56d308a),
+     TOBN(0x771dde4b, 0x73f29561), TOBN(0x96eaf73e, 0x8bf28e5f),
+     TOBN(0x9b1ee6be, 0x06fbb550), TOBN(0xe09fec77, 0x97d4a4e8),
+     TOBN(0x93bdcd60, 0xd5aa84fd), TOBN(0x3fa8d3a0, 0xd457ab9c),
+     TOBN(0x315b32b1, 0xa0a2e52c), TOBN(0xe7e50b2d, 0x3bbcb61d),
+     TOBN(0x8a55cc0e, 0x5e5c6e11), TOBN(0xc2bfa998, 0x961295ef),
+     TOBN(0x4a5ab3bb, 0x66e996d1), TOBN(0x22c42e4f, 0x4886a421),
+     TOBN(0xa0cdd364, 0x4850e0a4), TOBN(0x7682d38d, 0xc64ed713),
+     TOBN(0xe31575c2, 0xa2c539e4), TOBN(0x0bac5dcd, 0xa756daf9),
+     TOBN(0xe917cecf, 0x91f55a12), TOBN(0x1e96433b, 0xe96f6299),
+     TOBN(0xeec7c71c, 0x3700d8fb), TOBN(0x9a1d2965, 0xdc9b4444),
+     TOBN(0x3d2c6970, 0xcf74f19c), TOBN(0x3b444c48, 0xac5e0d6b)},
+    {TOBN(0xe563cefd, 0x8ccb854c), TOBN(0xf5452cdb, 0x65b0c45a),
+     TOBN(0xb3c78769, 0x9c37f743), TOBN(0x34e9d192, 0x95d444ab),
+     TOBN(0x29347946, 0x52ff26b7), TOBN(0x70d6ecfa, 0x9b94d642),
+     TOBN(0x7d201858, 0xfdaffb8f), TOBN(0xc288719d, 0x45dcdc71),
+     TOBN(0xc695469d, 0x0728a2eb), TOBN(0x7b46244e, 0xc433d11c),
+     TOBN(0x4a8b99ba, 0xf106c08e), TOBN(0x7989794f, 0x63422083),
+     TOBN(0x82218867, 0xd4fc5696), TOBN(0x6b021f28, 0x3c79cdb8),
+     TOBN(0x5ff7bbea, 0xb26d5049), TOBN(0xb78611ca, 0xa7261628),
+     TOBN(0x5a75f961, 0x531313d7), TOBN(0x85a1f4db, 0x66dcdc9e),
+     TOBN(0xae3026b9, 0x6460e991), TOBN(0x7d467bef, 0x17ecf7cc),
+     TOBN(0x8a0dbf67, 0x05118708), TOBN(0x54bfa368, 0xf3b2f1c9),
+     TOBN(0xa9fc9d5c, 0xf2c0e4e0), TOBN(0xa8c2ad11, 0x5e93611b),
+     TOBN(0x3ef1faf0, 0xaa1256bd), TOBN(0x0f224545, 0x9e4631de),
+     TOBN(0x69cb9800, 0xde9c2676), TOBN(0x26019816, 0x95782b24),
+     TOBN(0x945c172c, 0xa66c0ccd), TOBN(0x6c25f635, 0xb440719a),
+     TOBN(0x917d5dba, 0xa49f681a), TOBN(0xc0cad047, 0xb2dc5df4),
+     TOBN(0xd45bcf4c, 0x5960ef1c), TOBN(0xbabcb16d, 0x8c6979d5),
+     TOBN(0x8e3be750, 0xae9090d6), TOBN(0x9481d261, 0xac0eb728),
+     TOBN(0x46b436cd, 0x0d6a7d46), TOBN(0x6eb1a6a3, 0x1f976501),
+     TOBN(0x5984ffa2, 0xdbe1064f), TOBN(0xe6575fb1, 0xf809dc20),
+     TOBN(0xf0426d80, 0x4d974a81), TOBN(0x61304f0f, 0x97a74be6),
+     TOBN(0x2346ff98, 0xa9486531), TOBN(0xa1242cca, 0xf53d781a),
+     TOBN(0x482f03df, 0x97355f15), TOBN(0xc607ed33, 0xbd6058cf),
+     TOBN(0x03bc8cd4, 0x68aefe28), TOBN(0xa6e7de5a, 0x851307e4),
+     TOBN(0x2c07df0f, 0xc6af7d44), TOBN(0x310b251f, 0xb15a9188),
+     TOBN(0xd42661ce, 0xd3e15c2f), TOBN(0x5198fd90, 0x1b4d8313),
+     TOBN(0x7a6062cd, 0xda8368a1), TOBN(0x1a905d11, 0x5e9c2542),
+     TOBN(0x1d752b70, 0xdae37cee), TOBN(0x3ed8c1a5, 0x16bf84ca),
+     TOBN(0x5190fb0f, 0xeecc2f22), TOBN(0x3df210f3, 0x698d8e60),
+     TOBN(0xcce57d3a, 0xf5f3ce72), TOBN(0xb2fb6223, 0x312b8fc6),
+     TOBN(0x79947005, 0x71867c84), TOBN(0x141cd92c, 0xbe139ebe),
+     TOBN(0x415efc9e, 0x5de7944e), TOBN(0xae9ee919, 0x45821058),
+     TOBN(0xd696e1d9, 0x5bf363dc), TOBN(0x6a1bcfc0, 0x8251449c),
+     TOBN(0xa1b82dff, 0xa5fa53e9), TOBN(0x6c56b5be, 0xeef05378),
+     TOBN(0xaf9efe4c, 0xc0e74dc3), TOBN(0x3d9a7ae9, 0xe5c1f1a0),
+     TOBN(0x34b38577, 0x2823c3e5), TOBN(0x69f297dc, 0x41fbabac),
+     TOBN(0xf01aff98, 0xd74c5a65), TOBN(0x97993104, 0x1951a915),
+     TOBN(0x8b211915, 0x723096a6), TOBN(0xf85910c4, 0xa769ef1f),
+     TOBN(0x30cefb9e, 0x8ddc0eb4), TOBN(0xd5957eef, 0xbb09607b),
+     TOBN(0x2e139c9c, 0x2355b499), TOBN(0x5749531d, 0xc1789013),
+     TOBN(0x1603ca64, 0x5475f2d2), TOBN(0x57190e0e, 0x0a336508),
+     TOBN(0x2203b703, 0xcea7d558), TOBN(0xf16eba4d, 0xfb5503e3),
+     TOBN(0x62e2ce3d, 0xb7344a98), TOBN(0xebf5b243, 0x9a4efa7a),
+     TOBN(0x96212455, 0x1c914064), TOBN(0xd2c5e31c, 0xbe5bbc07),
+     TOBN(0x2b5f2f77, 0x06c30b28), TOBN(0x0931841d, 0xbc9823d3),
+     TOBN(0xd16fb08b, 0xadfa6fdb), TOBN(0x8892bae2, 0xd6fd441e),
+     TOBN(0x3fc64630, 0x2e576983), TOBN(0x08c60fb6, 0x07b05529),
+     TOBN(0x32b283b1, 0x7afc1d4d), TOBN(0xc9c56965, 0xa2f0e37f),
+     TOBN(0x8e719178, 0x4644e173), TOBN(0x4c2a11ec, 0xf88b43ff),
+     TOBN(0xb13644e6, 0x7d3ddbb3), TOBN(0xd4746056, 0xc3d8703c),
+     TOBN(0x6611395f, 0x55dca667), TOBN(0x63596712, 0x27c91d73),
+     TOBN(0x4ca68a87, 0xea2ff489), TOBN(0x2864a816, 0x337adc1d),
+     TOBN(0x8aa830ae, 0x224d4f21), TOBN(0xda6c122e, 0x9f7845dc),
+     TOBN(0xb0c61ffc, 0xfb240793), TOBN(0xf4df6842, 0xce8580e9),
+     TOBN(0x94372aaa, 0x0a990dc7), TOBN(0x42968cd3, 0x5ce1aa24),
+     TOBN(0x177c5ff0, 0x4df363a5), TOBN(0xa8c3f737, 0x68c4546f),
+     TOBN(0xc69750d5, 0xbd21c524), TOBN(0xbf3b4857, 0x22a6c4ae),
+     TOBN(0xcefcbb98, 0xe2883a1d), TOBN(0x6ffef743, 0xae13f22b),
+     TOBN(0x6316ba60, 0x5defea01), TOBN(0x0a89e6a7, 0x4ba63810),
+     TOBN(0x7f9af1de, 0x15ab0e11), TOBN(0x6247ca15, 0x385911c9),
+     TOBN(0x6f7b1a6a, 0x32f9eaf5), TOBN(0x2c440f94, 0xacfc13dc),
+     TOBN(0x2cf39bc5, 0x66b18adf), TOBN(0xb9939fe8, 0x9f01533f),
+     TOBN(0x031c4553, 0x383a6450), TOBN(0x16d96ad3, 0xf0102087),
+     TOBN(0xcbd6fa95, 0x501f1360), TOBN(0x667d3ea0, 0x65f96c08),
+     TOBN(0xa5a7cbfa, 0x68a1a680), TOBN(0xf131d779, 0x42041db7),
+     TOBN(0xbefee3ac, 0xd85d377f), TOBN(0x6d0ed6b7, 0x3b62dfa2),
+     TOBN(0xef683f0f, 0x1baacfbd), TOBN(0xc586c4f2, 0xc976cebd),
+     TOBN(0x3a4120dc, 0x3b163339), TOBN(0x9ac9b950, 0xc79e5c1f),
+     TOBN(0xaf1ff35f, 0xe294926a), TOBN(0x2703bab8, 0xa2103168),
+     TOBN(0xc645560a, 0x658a52bf), TOBN(0x5ff3ccd9, 0xe466fd97),
+     TOBN(0xe62fdc01, 0x54867f14), TOBN(0x435ef950, 0x9cdba39e),
+     TOBN(0x2a7bbffd, 0x92828acc), TOBN(0xe7538fdb, 0xfe763981),
+     TOBN(0xedf45173, 0x8bfe9773), TOBN(0xd187fa01, 0x471b8b9c),
+     TOBN(0x34506c35, 0x78fa54df), TOBN(0x73cab9fd, 0xc2767589),
+     TOBN(0xf8f76c65, 0x6726f305), TOBN(0xea45012d, 0x8de332b2),
+     TOBN(0xb746f40d, 0x87970e03), TOBN(0xb2b2279a, 0x1ba8fbd6),
+     TOBN(0x79cdc610, 0x21147dbc), TOBN(0x738ef680, 0x9939a3cc),
+     TOBN(0xd66d6ce6, 0x8101bd8b), TOBN(0x65612acb, 0x09323caa),
+     TOBN(0x6874b372, 0x10310a29), TOBN(0x3cf30f0a, 0x5ee9ecfa),
+     TOBN(0x4e1026ad, 0x8cfe1df8), TOBN(0x75a153f7, 0xd5989af5),
+     TOBN(0xc362ccee, 0x8b8e0c49), TOBN(0x8adfc0d2, 0xb533f3dd),
+     TOBN(0xe02ab03b, 0xa109572e), TOBN(0x06efacdc, 0xfd3066ec),
+     TOBN(0xf136a8ba, 0x3fa28700), TOBN(0x48a1e987, 0x308cceb9),
+     TOBN(0xe8ee7c03, 0x68253387), TOBN(0x47febbe8, 0xc2b463c7),
+     TOBN(0x485195f2, 0x39a5c4d3), TOBN(0xf42e000e, 0xa26241ec),
+     TOBN(0x08c64f90, 0xcd05368d), TOBN(0x46fbd381, 0x857cdbdb),
+     TOBN(0xf711df8b, 0x4c7e16ae), TOBN(0x95637e46, 0xe4edea42),
+     TOBN(0x2df8b206, 0xad171465), TOBN(0xa31ea895, 0x4bccedce),
+     TOBN(0x28dbcb77, 0x50743bb6), TOBN(0x13d12f8e, 0xf9cf84b9),
+     TOBN(0x39e3d3af, 0xc8f7d408), TOBN(0x5824117f, 0xeba591d4),
+     TOBN(0xd8ef7c9a, 0x1bead2d6), TOBN(0x9003a559, 0xcaf53dd7),
+     TOBN(0x33b2365c, 0x174cb9a9), TOBN(0x1149d080, 0xadb33afb),
+     TOBN(0x55231d00, 0xaea9bd3c), TOBN(0x07e107c9, 0xfdf3f015),
+     TOBN(0xf535947d, 0xec9d8fce), TOBN(0x8b64ed8a, 0xbba349a7),
+     TOBN(0xdd5881fd, 0x049301df), TOBN(0xefac9c43, 0xe6490fd0),
+     TOBN(0xd9902852, 0x73740a78), TOBN(0x6eef3724, 0x942c326c),
+     TOBN(0x5671a6e9, 0x5cfb3c8c), TOBN(0x040aabd2, 0x0ea29721),
+     TOBN(0x24e92ca6, 0xeac8da18), TOBN(0xc34d3d79, 0xa31170c3),
+     TOBN(0xf81dd15f, 0xb061e416), TOBN(0xff7be70e, 0x85f80af0),
+     TOBN(0xa9faba4b, 0xade45cd4), TOBN(0x42a6ab05, 0x505fddd4),
+     TOBN(0x17d5821d, 0x0a793534), TOBN(0x9e094e54, 0xce0ade43),
+     TOBN(0xa127fb6d, 0xc42cb4d2), TOBN(0x43865428, 0xdb12dc99),
+     TOBN(0xb6b1b347, 0x59e3bfc1), TOBN(0x0b0076a9, 0x1ec5b810),
+     TOBN(0xbf2dd17a, 0xa6864982), TOBN(0x0c45947f, 0x9d523c87),
+     TOBN(0x9f53372f, 0x4c5dd59e), TOBN(0x3d0ceaea, 0xca5ce09f),
+     TOBN(0xf3ff88e8, 0x7c0337fb), TOBN(0xb4fa4593, 0xfaa022c7),
+     TOBN(0x575240a7, 0xd65ea54d), TOBN(0xa4ec0a39, 0xadb92fb0),
+     TOBN(0xc20e737c, 0x79429eb1), TOBN(0xcea931d1, 0x69addec4),
+     TOBN(0x7a29011f, 0x3e09f46a), TOBN(0x9c36865e, 0x0e578a5b),
+     TOBN(0x8746ea51, 0x71d805f4), TOBN(0xf024de85, 0xe12d3024),
+     TOBN(0xc397b46c, 0x15a7f6be), TOBN(0x612db6fb, 0x1b0580d7),
+     TOBN(0xe5342f76, 0xf736d087), TOBN(0x65276853, 0x8c1e844c),
+     TOBN(0xedf48adc, 0x113841a5), TOBN(0xc21b67e1, 0xe5c482f0),
+     TOBN(0xe43b0138, 0x684a540b), TOBN(0xc4f2782b, 0xa5d4b266),
+     TOBN(0x184e240c, 0x397f3664), TOBN(0x968e89e7, 0x0d8788f8),
+     TOBN(0xec3eba1a, 0x377e18bf), TOBN(0x4d03cbbc, 0x36002652),
+     TOBN(0x21eedee7, 0x1005a953), TOBN(0xc178ddf1, 0x75ba987e),
+     TOBN(0xd0d577f6, 0xc4ba43f6), TOBN(0x9486f46c, 0x4d6f24fd),
+     TOBN(0x3d33c574, 0xc5421895), TOBN(0x5be6cb4c, 0x842e52ab),
+     TOBN(0x3809690d, 0x9debc9ff), TOBN(0xe4b1c692, 0xa84a5b6f),
+     TOBN(0x58b966ad, 0xd7e18b57), TOBN(0x7ff0b61e, 0x77c94715),
+     TOBN(0x0e295883, 0xf06add82), TOBN(0x7c3c04fd, 0x65c7f5a4),
+     TOBN(0x4ea92660, 0x60223be5), TOBN(0x5d843a57, 0x89262bfd),
+     TOBN(0x35bf4aef, 0x36da11c0), TOBN(0xa6692f14, 0xaf859eb1),
+     TOBN(0xca1fc13b, 0xa12fdf41), TOBN(0xd798c04b, 0x8224f5d2),
+     TOBN(0x22f4594e, 0x1dd5872b), TOBN(0xdee12df5, 0x1bddfda8),
+     TOBN(0x96473ff0, 0xed83420a), TOBN(0xf41cf1c7, 0x8daa27f4),
+     TOBN(0x2772cd56, 0xaecefd8a), TOBN(0xd5ddaf18, 0x4902b47f),
+     TOBN(0xff77551f, 0xc0798101), TOBN(0x8baa01d6, 0x26946bda),
+     TOBN(0xd0087e47, 0x100525f2), TOBN(0x521d6254, 0x4c0de308),
+     TOBN(0x4a0f45eb, 0x9bbce049), TOBN(0x5ee33cbe, 0xa6c6b96e),
+     TOBN(0x9a6af4b7, 0xd6a22345), TOBN(0x0d0d35e7, 0x38b1b406),
+     TOBN(0x9e71252d, 0xbbedc29b), TOBN(0x3aa70bb6, 0xcad1455e),
+     TOBN(0xa406fb7a, 0x42a1778c), TOBN(0xd94f9646, 0xf0897613),
+     TOBN(0x5256370f, 0xf57f66c8), TOBN(0x95891e35, 0x4432f679),
+     TOBN(0x75d6423a, 0xbcb6b3d3), TOBN(0x79d9ea01, 0x2367483f),
+     TOBN(0x1e36ccc6, 0x9efb0473), TOBN(0x3e64b034, 0xdfdc0cec),
+     TOBN(0x13bfd326, 0x028bb238), TOBN(0x171e9d96, 0x209edd95),
+     TOBN(0xda258380, 0x07b22424), TOBN(0xe31e97f6, 0xd41b8023),
+     TOBN(0xdd4ed390, 0x7269cecd), TOBN(0x810fb3c8, 0x12d5cec6),
+     TOBN(0x2f956519, 0xbabeec88), TOBN(0xb0350c52, 0x455baf52),
+     TOBN(0xa7fb548a, 0x48d5abf1), TOBN(0xcb81bd0c, 0xca5e2d9f),
+     TOBN(0xda5ecd39, 0xa6d17b19), TOBN(0xd2588bab, 0x508e5149),
+     TOBN(0x1a30cff5, 0xc3e23cfd), TOBN(0x2dd398b4, 0xf89f8712),
+     TOBN(0x2a911800, 0x5b304005), TOBN(0xd091be7a, 0xd9dece69),
+     TOBN(0x147e93da, 0xf6cabc89), TOBN(0x7eac2018, 0x44935824),
+     TOBN(0xd4aaf2be, 0x32f5de9b), TOBN(0xe302bc41, 0xd9396cd1),
+     TOBN(0x3c2794cf, 0x2c069d1a), TOBN(0xf9197eaa, 0xa9d433ae),
+     TOBN(0x98f822ef, 0x4445e8c2), TOBN(0xc578360e, 0x1383ece8),
+     TOBN(0xa5372c12, 0x01869457), TOBN(0x1c6ed00d, 0x787d6644),
+     TOBN(0x77fb08cd, 0x86531814), TOBN(0xeff6ee26, 0x63a70db8),
+     TOBN(0x980be153, 0x80976119), TOBN(0x534a09bd, 0xd69d60c5),
+     TOBN(0x71a58b0c, 0x759dba20), TOBN(0x34d5f06c, 0x679c0b40),
+     TOBN(0xdc0e7e5f, 0xceed2f9f), TOBN(0xaaa5996e, 0x48808edb),
+     TOBN(0x8ca96ff0, 0xbcdd88e5), TOBN(0x91b02d67, 0xc37c2b46),
+     TOBN(0xbe4f3948, 0x95526319), TOBN(0x4315c7f2, 0x89be56d1),
+     TOBN(0xa312a3c0, 0xdc85bba1), TOBN(0x3328fa8e, 0x431ca797),
+     TOBN(0x5438bf1c, 0x68fd219a), TOBN(0x98812c6f, 0x85837d74),
+     TOBN(0xe88c4913, 0xf8c96d49), TOBN(0xcc62e79c, 0xc2442aca),
+     TOBN(0x4ef3c7d4, 0x046655f1), TOBN(0x04a362ed, 0xdadab1ea),
+     TOBN(0x975e2f3c, 0x30a199cf), TOBN(0x831e04a9, 0x014a165a),
+     TOBN(0x1e1d3c53, 0xaa126719), TOBN(0xc42661e0, 0x1bf707a0),
+     TOBN(0x295b0738, 0xaa2da264), TOBN(0xb45f5ed8, 0x65d4ba34),
+     TOBN(0x27fb5a12, 0x9f3938fa), TOBN(0x25fba614, 0xcb26f86c),
+     TOBN(0x6bd41981, 0xcf3c1c4d), TOBN(0xd6f9239c, 0xa0dedafd),
+     TOBN(0x46882526, 0xae55b97f), TOBN(0x8e6fa994, 0x81b628d4),
+     TOBN(0xbdb314dd, 0xdc0aa158), TOBN(0x35343678, 0x12ba2a17),
+     TOBN(0xac018e83, 0x32e2e431), TOBN(0x43a64e35, 0xe65cc63e),
+     TOBN(0x887f3a2a, 0x0b6603ea), TOBN(0xe015426c, 0x76b2673f),
+     TOBN(0x59dc5530, 0x27edfe8a), TOBN(0xea9eacf3, 0x68d9ebf3),
+     TOBN(0x40301c8e, 0xcc3e07ca), TOBN(0xd8cb9b5b, 0x0f57a2e6),
+     TOBN(0x542e6b52, 0x60ec5864), TOBN(0xb8791dd6, 0x17f6affe),
+     TOBN(0x6735bd1c, 0x798d9993), TOBN(0x006d8b25, 0xd5da393c),
+     TOBN(0x1d675bdb, 0x49e6d0d2), TOBN(0x331d9a10, 0x8607f99e),
+     TOBN(0x4ff8ab74, 0x9dc4cd07), TOBN(0xa87d4ae1, 0x64ea3192),
+     TOBN(0xdde0d92e, 0x41196b5b), TOBN(0xa15ad47b, 0xb2e010eb),
+     TOBN(0x23e6003f, 0xa5522a75), TOBN(0xc6ef3f1b, 0x84afa749),
+     TOBN(0x9a723f75, 0x146d10a3), TOBN(0x5fa99480, 0x119106b0),
+     TOBN(0x01d500db, 0xc0013dba), TOBN(0x10b30ada, 0x548edbe0),
+     TOBN(0xb2eb046e, 0xb04ffc6b), TOBN(0xa57088f3, 0x64f25ee2),
+     TOBN(0xc0c919c3, 0x83a068a3), TOBN(0x8139559d, 0xfbde282f),
+     TOBN(0x4e2b5d13, 0x9fec9a99), TOBN(0x53bad712, 0xfbefa7e6),
+     TOBN(0xa6befe0d, 0x2860bd4f), TOBN(0x6ea0ae15, 0x0011bd15),
+     TOBN(0xc1ef3463, 0x2bce3779), TOBN(0xc09ecb30, 0x5d742dbb),
+     TOBN(0x29526afd, 0xf73db19d), TOBN(0x7c02c905, 0x6a029a40),
+     TOBN(0xa778460f, 0xde5a48ba), TOBN(0xda05993e, 0x77c105f6),
+     TOBN(0xb6d599f9, 0xc9ddece9), TOBN(0x9f9df668, 0x0cfc33ca),
+     TOBN(0xdcd8ef4f, 0xa0aa67a8), TOBN(0x31277019, 0xc3f4d178),
+     TOBN(0x98e05abf, 0x53e86ae1), TOBN(0xc1dc4d90, 0x3850830d),
+     TOBN(0xbd7fd806, 0xe06bc33c), TOBN(0x1ac330d6, 0xacf1286f),
+     TOBN(0x28ce2303, 0xe1588c1e), TOBN(0xdc25e54b, 0x1b7e9c19),
+     TOBN(0x11e51e49, 0x4b7149f2), TOBN(0x551b8391, 0xb5c7fa25),
+     TOBN(0xa2fc251c, 0x1bf69873), TOBN(0x099b7b53, 0x2aec1574),
+     TOBN(0x9ff98156, 0x7c53296a), TOBN(0xaf3f8d08, 0xa2dc60de),
+     TOBN(0x18dd295c, 0x59b72d6c), TOBN(0x165c9063, 0xe75f44fc),
+     TOBN(0x9046ee7c, 0x427a0c55), TOBN(0x317ea24d, 0xc79ffdb3),
+     TOBN(0x6835a315, 0x0ef0447d), TOBN(0xb2b9c786, 0x8068e7c7),
+     TOBN(0xe6352714, 0x0e646af5), TOBN(0xc5554a91, 0x442baaa0),
+     TOBN(0x671febc5, 0x6d0ba1ea), TOBN(0x44f9ef7b, 0x0cf649ed),
+     TOBN(0x4aa0cd61, 0x0c1dac6b), TOBN(0x865f3c23, 0x6e393e68),
+     TOBN(0xf6886bcd, 0xa71dee29), TOBN(0x934b0455, 0xda44ffae),
+     TOBN(0xda7621c4, 0x016d6039), TOBN(0xf36c41bf, 0x3ad35493),
+     TOBN(0x9063135e, 0xe5f6ab8d), TOBN(0xb0e8eaba, 0x47bdc0a8),
+     TOBN(0x62530616, 0x4c737cf3), TOBN(0x8046423e, 0x64f6b6cb),
+     TOBN(0x11e50ad7, 0x7958e3dc), TOBN(0x4dab4e16, 0xb57234ab),
+     TOBN(0x6ccfe2c6, 0xe0916210), TOBN(0x4d5dbc3b, 0x80f49d40),
+     TOBN(0x2b8ff368, 0xef1b2b1b), TOBN(0xf2afb326, 0x752fea2a),
+     TOBN(0xffa48ea7, 0x0246e36b), TOBN(0x3a4bae9b, 0x589b7444),
+     TOBN(0x80ff984a, 0x6ff3efcf), TOBN(0x7af53f30, 0x56b77b47),
+     TOBN(0x1f1c33b0, 0x9320cae6), TOBN(0xce1f1c48, 0x26fc4ad4),
+     TOBN(0x9cac662b, 0xad350ee5), TOBN(0xf4c72fff, 0xe27a7dbd),
+     TOBN(0xd766f986, 0x703184e5), TOBN(0x36d3efd5, 0x7c5b241e),
+     TOBN(0xd4d6e358, 0xf7ff5804), TOBN(0xa832b302, 0x8f5e0bf6),
+     TOBN(0x4b3d73f7, 0x453d9a22), TOBN(0xb4dae072, 0xdf938705),
+     TOBN(0x6bff7b2e, 0x92401620), TOBN(0x96b8494e, 0x9bfa61cd),
+     TOBN(0x4bcda341, 0xb74dc1e5), TOBN(0x383fe3d2, 0xc19c393d),
+     TOBN(0xa375fb70, 0x077e8821), TOBN(0xea35e04b, 0xc17eb9bc),
+     TOBN(0x941d21ba, 0x7c4dd076), TOBN(0x916c0a59, 0x3d0c3d8a),
+     TOBN(0x2c1304e3, 0x15b2cf47), TOBN(0x9233ebf3, 0xd0c955c0),
+     TOBN(0x77acdd07, 0x2b2fc935), TOBN(0xd71b6a7a, 0xc04276bf),
+     TOBN(0x789ea49b, 0xd2ee8d68), TOBN(0x89552b46, 0x0a84a920),
+     TOBN(0xe629d5de, 0x1a4ea456), TOBN(0xddfefe87, 0x22ddd405),
+     TOBN(0x3d56f697, 0x1cdb9e7b), TOBN(0x95a861b0, 0xa8bf715b),
+     TOBN(0xb01248d6, 0x7896c993), TOBN(0x3c4e3d98, 0x01a3085c),
+     TOBN(0x674939e1, 0x9085b360), TOBN(0xae67dea9, 0xb589a287),
+     TOBN(0xc563856f, 0x2bfdcfc9), TOBN(0x62fa9a80, 0x313b685d),
+     TOBN(0x36ff33d9, 0x7ad501d9), TOBN(0xf8bab4dd, 0x730ab349),
+     TOBN(0x18fd59f3, 0xc46ba69d), TOBN(0x81e08665, 0xe65278e9),
+     TOBN(0x5a5e803f, 0xeb8a1e84), TOBN(0x5b4eef35, 0x47243604),
+     TOBN(0x0ee71ee0, 0x393d6cdf), TOBN(0xde4d9dea, 0xc3a9c6db),
+     TOBN(0x0c14c376, 0x64466b53), TOBN(0xc2ce9642, 0x89e3b45e),
+     TOBN(0x6aa8012f, 0x54a2de21), TOBN(0x519759c1, 0x29b6bc2c),
+     TOBN(0x17768527, 0xe4667322), TOBN(0x09fdfe4d, 0xac83b2ea),
+     TOBN(0xd422125d, 0x04a0d5f5), TOBN(0x02e8ff96, 0x2b86b310),
+     TOBN(0xf033628d, 0xd7ee97af), TOBN(0x778a846c, 0x7d72e0e6),
+     TOBN(0x06fde613, 0x882f63d6), TOBN(0x9e258b0d, 0x8d434f14),
+     TOBN(0x5cdda529, 0xccdcd600), TOBN(0x37038b38, 0x033c4535),
+     TOBN(0xd6a1d639, 0x391c1d7d), TOBN(0x4f6489e4, 0x31d4ce6b),
+     TOBN(0xd1b82f17, 0x5754e08c), TOBN(0x7df268ee, 0x75db7bd6),
+     TOBN(0x1e4a1202, 0xad14dcfa), TOBN(0x7ab92ce2, 0xccfb9b77),
+     TOBN(0x61388e03, 0x23aef997), TOBN(0x9981f5bf, 0x06440ce3),
+     TOBN(0x8d7631da, 0xc67d0edd), TOBN(0xc6ea593f, 0xc0a93516),
+     TOBN(0x064a06e0, 0xee841b38), TOBN(0x0d1d4f57, 0x521ce83f),
+     TOBN(0xf7a0e0c3, 0x70df2613), TOBN(0x1506cccb, 0x84c071ab),
+     TOBN(0x42a138ec, 0x328565e9), TOBN(0xe16b4578, 0xb8130d16),
+     TOBN(0x0628ff22, 0x45ba251a), TOBN(0x016a84ca, 0x210e22e8),
+     TOBN(0x8ba14bb4, 0x94592d43), TOBN(0xffee4308, 0x785274a5),
+     TOBN(0x01fc21ab, 0x01354b75), TOBN(0xc37ce45f, 0x7e424674),
+     TOBN(0x71e153af, 0xa7fe2735), TOBN(0x000fcee9, 0xc307721f),
+     TOBN(0x3b189004, 0x805b56e3), TOBN(0x2f1435aa, 0x7f504d9b),
+     TOBN(0xd9aa1eba, 0xa083bd72), TOBN(0xf1145036, 0x720ccf3d),
+     TOBN(0x95b29e27, 0x4084fa32), TOBN(0x8862d213, 0x01f94f0c),
+     TOBN(0x23fc5ddf, 0x1510a406), TOBN(0x475a78f4, 0xc9f0e98d),
+     TOBN(0xb6d681c4, 0xe72843a0), TOBN(0xa90af2a4, 0x4a00c5a6),
+     TOBN(0x95fc6d45, 0xa34f4412), TOBN(0x60f9c0e2, 0xe7f5d703),
+     TOBN(0x2bc0642b, 0xad110925), TOBN(0x79abfc10, 0xbe24a4d5)}
+};
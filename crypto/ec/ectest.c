@@ -1817,6 +1817,183 @@ static void nistp_tests()
 }
 # endif
 
+# ifndef OPENSSL_NO_SM2
+/*
+ * Compare sm2p256v1, which has an optimised implementation on some
+ * platforms, with the same curve on the generic method.
+ */
+static void sm2_point_cmp(EC_GROUP *group1, const EC_POINT *P1,
+                          EC_GROUP *group2, const EC_POINT *P2, BN_CTX *ctx)
+{
+    BIGNUM *x1 = BN_new(), *y1 = BN_new(), *x2 = BN_new(), *y2 = BN_new();
+
+    if (EC_POINT_is_at_infinity(group1, P1)
+        || EC_POINT_is_at_infinity(group2, P2)) {
+        if (!EC_POINT_is_at_infinity(group1, P1)
+            || !EC_POINT_is_at_infinity(group2, P2))
+            ABORT;
+    } else {
+        if (!EC_POINT_get_affine_coordinates_GFp(group1, P1, x1, y1, ctx))
+            ABORT;
+        if (!EC_POINT_get_affine_coordinates_GFp(group2, P2, x2, y2, ctx))
+            ABORT;
+        if (BN_cmp(x1, x2) != 0 || BN_cmp(y1, y2) != 0)
+            ABORT;
+    }
+    BN_free(x1);
+    BN_free(y1);
+    BN_free(x2);
+    BN_free(y2);
+}
+
+static void sm2_curve_test(void)
+{
+    BN_CTX *ctx;
+    BIGNUM *p, *a, *b, *x, *y, *order, *n, *m;
+    EC_GROUP *SM2, *GENERIC;
+    EC_POINT *G, *P1, *P2, *Q1, *Q2;
+    EC_POINT_TABLE *T;
+    int i;
+
+    fprintf(stdout, "\nSM2 curve sm2p256v1:\n");
+    ctx = BN_CTX_new();
+    p = BN_new();
+    a = BN_new();
+    b = BN_new();
+    x = BN_new();
+    y = BN_new();
+    order = BN_new();
+    n = BN_new();
+    m = BN_new();
+
+    SM2 = EC_GROUP_new_by_curve_name(NID_sm2p256v1);
+    if (!SM2)
+        ABORT;
+    if (!EC_GROUP_get_curve_GFp(SM2, p, a, b, ctx))
+        ABORT;
+    if (!EC_GROUP_get_order(SM2, order, ctx))
+        ABORT;
+    GENERIC = EC_GROUP_new_curve_GFp(p, a, b, ctx);
+    if (!GENERIC)
+        ABORT;
+    G = EC_POINT_new(GENERIC);
+    if (!EC_POINT_get_affine_coordinates_GFp(SM2,
+                                             EC_GROUP_get0_generator(SM2),
+                                             x, y, ctx))
+        ABORT;
+    if (!EC_POINT_set_affine_coordinates_GFp(GENERIC, G, x, y, ctx))
+        ABORT;
+    if (!EC_GROUP_set_generator(GENERIC, G, order, BN_value_one()))
+        ABORT;
+
+    P1 = EC_POINT_new(SM2);
+    Q1 = EC_POINT_new(SM2);
+    P2 = EC_POINT_new(GENERIC);
+    Q2 = EC_POINT_new(GENERIC);
+
+    fprintf(stdout, "compare with the generic implementation ...");
+    fflush(stdout);
+    for (i = 0; i < 20; i++) {
+        /* the first rounds use the scalars 0, 1 and order - 1 */
+        if (i == 0)
+            BN_zero(n);
+        else if (i == 1)
+            BN_one(n);
+        else if (i == 2) {
+            if (!BN_sub(n, order, BN_value_one()))
+                ABORT;
+        } else if (!BN_rand_range(n, order))
+            ABORT;
+        if (!BN_rand_range(m, order))
+            ABORT;
+
+        /* fixed point multiplication */
+        if (!EC_POINT_mul(SM2, Q1, n, NULL, NULL, ctx))
+            ABORT;
+        if (!EC_POINT_mul(GENERIC, Q2, n, NULL, NULL, ctx))
+            ABORT;
+        sm2_point_cmp(SM2, Q1, GENERIC, Q2, ctx);
+
+        /* random point multiplication, P = m*G */
+        if (!EC_POINT_mul(SM2, P1, m, NULL, NULL, ctx))
+            ABORT;
+        if (!EC_POINT_mul(GENERIC, P2, m, NULL, NULL, ctx))
+            ABORT;
+        if (!EC_POINT_mul(SM2, Q1, NULL, P1, n, ctx))
+            ABORT;
+        if (!EC_POINT_mul(GENERIC, Q2, NULL, P2, n, ctx))
+            ABORT;
+        sm2_point_cmp(SM2, Q1, GENERIC, Q2, ctx);
+
+        /* n*G + m*P */
+        if (!EC_POINT_mul(SM2, Q1, n, P1, m, ctx))
+            ABORT;
+        if (!EC_POINT_mul(GENERIC, Q2, n, P2, m, ctx))
+            ABORT;
+        sm2_point_cmp(SM2, Q1, GENERIC, Q2, ctx);
+
+        /* the same with a table of P, and n*P alone */
+        if (!(T = EC_POINT_TABLE_new(SM2, P1, ctx)))
+            ABORT;
+        if (!EC_POINT_mul_table(SM2, Q1, n, T, m, ctx))
+            ABORT;
+        sm2_point_cmp(SM2, Q1, GENERIC, Q2, ctx);
+        if (!EC_POINT_mul_table(SM2, Q1, NULL, T, n, ctx))
+            ABORT;
+        if (!EC_POINT_mul(GENERIC, Q2, NULL, P2, n, ctx))
+            ABORT;
+        sm2_point_cmp(SM2, Q1, GENERIC, Q2, ctx);
+        EC_POINT_TABLE_free(T);
+        fprintf(stdout, ".");
+        fflush(stdout);
+    }
+    fprintf(stdout, " ok\n");
+
+    group_order_tests(SM2);
+
+    /* a table computed for another generator, P = m*G */
+    fprintf(stdout, "precomputation for another generator ...");
+    fflush(stdout);
+    if (!EC_GROUP_set_generator(SM2, P1, order, BN_value_one()))
+        ABORT;
+    if (!EC_GROUP_set_generator(GENERIC, P2, order, BN_value_one()))
+        ABORT;
+    if (!EC_GROUP_precompute_mult(SM2, ctx))
+        ABORT;
+    if (!EC_GROUP_have_precompute_mult(SM2))
+        ABORT;
+    for (i = 0; i < 4; i++) {
+        if (!BN_rand_range(n, order))
+            ABORT;
+        if (!EC_POINT_mul(SM2, Q1, n, NULL, NULL, ctx))
+            ABORT;
+        if (!EC_POINT_mul(GENERIC, Q2, n, NULL, NULL, ctx))
+            ABORT;
+        sm2_point_cmp(SM2, Q1, GENERIC, Q2, ctx);
+        fprintf(stdout, ".");
+        fflush(stdout);
+    }
+    fprintf(stdout, " ok\n");
+
+    EC_POINT_free(G);
+    EC_POINT_free(P1);
+    EC_POINT_free(Q1);
+    EC_POINT_free(P2);
+    EC_POINT_free(Q2);
+    EC_GROUP_free(SM2);
+    EC_GROUP_free(GENERIC);
+    BN_free(p);
+    BN_free(a);
+    BN_free(b);
+    BN_free(x);
+    BN_free(y);
+    BN_free(order);
+    BN_free(n);
+    BN_free(m);
+    BN_CTX_free(ctx);
+}
+# endif
+
 static const char rnd_seed[] =
     "string to make the random number generator think it has entropy";
 
@@ -1847,6 +2024,9 @@ int main(int argc, char *argv[])
 # endif
     /* test the internal curves */
     internal_curve_test();
+# ifndef OPENSSL_NO_SM2
+    sm2_curve_test();
+# endif
 
 # ifndef OPENSSL_NO_ENGINE
     ENGINE_cleanup();
@@ -171,13 +171,22 @@ void OpenSSL_add_all_ciphers(void)
     EVP_add_cipher(EVP_sms4_cfb8());
     EVP_add_cipher(EVP_sms4_ofb());
     EVP_add_cipher(EVP_sms4_ctr());
+    EVP_add_cipher(EVP_sms4_gcm());
+    EVP_add_cipher(EVP_sms4_ccm());
+    EVP_add_cipher(EVP_sms4_xts());
     EVP_add_cipher(EVP_sms4_wrap());
+# ifndef OPENSSL_NO_SM3
+    EVP_add_cipher(EVP_sms4_cbc_hmac_sm3());
+    EVP_add_cipher_alias(SN_sms4_cbc_hmac_sm3, "SM4-CBC-HMAC-SM3");
+# endif
     EVP_add_cipher_alias(SN_sms4_cbc,"SMS4");
     EVP_add_cipher_alias(SN_sms4_cbc,"sms4");
 #endif
 
 #ifndef OPENSSL_NO_ZUC
     EVP_add_cipher(EVP_zuc());
+    EVP_add_cipher(EVP_zuc_eea3());
+    EVP_add_cipher(EVP_zuc256());
 #endif
 
 #ifndef OPENSSL_NO_AES
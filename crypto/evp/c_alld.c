@@ -69,6 +69,7 @@ void OpenSSL_add_all_digests(void)
 #endif
 #ifndef OPENSSL_NO_SM3
 	EVP_add_digest(EVP_sm3());
+	EVP_add_digest(EVP_sm3_tree());
 #endif
 #ifndef OPENSSL_NO_MD5
     EVP_add_digest(EVP_md5());
@@ -116,6 +116,9 @@
 #ifndef OPENSSL_NO_ENGINE
 # include <openssl/engine.h>
 #endif
+#ifndef OPENSSL_NO_SM3
+# include <openssl/sm3.h>
+#endif
 
 #ifdef OPENSSL_FIPS
 # include <openssl/fips.h>
@@ -224,6 +227,8 @@ int EVP_DigestInit_ex(EVP_MD_CTX *ctx, const EVP_MD *type, ENGINE *impl)
                 EVPerr(EVP_F_EVP_DIGESTINIT_EX, ERR_R_MALLOC_FAILURE);
                 return 0;
             }
+            /* a digest may keep allocations in md_data, see m_sm3.c */
+            memset(ctx->md_data, 0, type->ctx_size);
         }
     }
 #ifndef OPENSSL_NO_ENGINE
@@ -252,6 +257,43 @@ int EVP_DigestInit_ex(EVP_MD_CTX *ctx, const EVP_MD *type, ENGINE *impl)
     return ctx->digest->init(ctx);
 }
 
+/*
+ * Same as EVP_DigestInit_ex(ctx, NULL, NULL) without the ENGINE lookups,
+ * the md_data of the current digest is reused.
+ */
+int EVP_MD_CTX_reinit(EVP_MD_CTX *ctx)
+{
+    if (ctx->digest == NULL) {
+        EVPerr(EVP_F_EVP_MD_CTX_REINIT, EVP_R_NO_DIGEST_SET);
+        return 0;
+    }
+    EVP_MD_CTX_clear_flags(ctx, EVP_MD_CTX_FLAG_CLEANED);
+    if (ctx->pctx) {
+        int r;
+        r = EVP_PKEY_CTX_ctrl(ctx->pctx, -1, EVP_PKEY_OP_TYPE_SIG,
+                              EVP_PKEY_CTRL_DIGESTINIT, 0, ctx);
+        if (r <= 0 && (r != -2))
+            return 0;
+    }
+    if (ctx->flags & EVP_MD_CTX_FLAG_NO_INIT)
+        return 1;
+#ifdef OPENSSL_FIPS
+    if (FIPS_mode())
+        return FIPS_digestinit(ctx, ctx->digest);
+#endif
+    return ctx->digest->init(ctx);
+}
+
+int EVP_MD_CTX_ctrl(EVP_MD_CTX *ctx, int cmd, int p1, void *p2)
+{
+    if (ctx->digest && ctx->digest->md_ctrl) {
+        if (ctx->digest->md_ctrl(ctx, cmd, p1, p2) <= 0)
+            return 0;
+        return 1;
+    }
+    return 0;
+}
+
 int EVP_DigestUpdate(EVP_MD_CTX *ctx, const void *data, size_t count)
 {
 #ifdef OPENSSL_FIPS
@@ -366,6 +408,39 @@ int EVP_Digest(const void *data, size_t count,
     return ret;
 }
 
+/*
+ * Digest |n| independent messages. Digests with a multi-buffer
+ * implementation (currently SM3) hash several messages in parallel
+ * SIMD lanes, the others fall back to one EVP_Digest() per message.
+ */
+int EVP_Digest_mb(const void *data[], const size_t count[],
+                  unsigned char *md[], size_t n, const EVP_MD *type,
+                  ENGINE *impl)
+{
+    size_t i;
+#ifndef OPENSSL_NO_SM3
+    int use_mb = (type->type == NID_sm3 && impl == NULL);
+# ifndef OPENSSL_NO_ENGINE
+    ENGINE *e;
+
+    if (use_mb && (e = ENGINE_get_digest_engine(NID_sm3)) != NULL) {
+        ENGINE_finish(e);
+        use_mb = 0;
+    }
+# endif
+    if (use_mb) {
+        sm3_mb((const unsigned char **)data, count, md, n);
+        return 1;
+    }
+#endif
+
+    for (i = 0; i < n; i++) {
+        if (!EVP_Digest(data[i], count[i], md[i], NULL, type, impl))
+            return 0;
+    }
+    return 1;
+}
+
 void EVP_MD_CTX_destroy(EVP_MD_CTX *ctx)
 {
     if (ctx) {
@@ -57,6 +57,7 @@
 #include <openssl/evp.h>
 #include <openssl/objects.h>
 #include <openssl/crypto.h>
+#include <openssl/rand.h>
 #include "evp_locl.h"
 #include "modes_lcl.h"
 #include <openssl/sms4.h>
@@ -65,11 +66,14 @@
 
 typedef struct {
 	sms4_key_t ks;
+	SMS4_KEY_CACHE *cache;
 } EVP_SMS4_KEY;
 
 static int sms4_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
 	const unsigned char *iv, int enc)
 {
+	EVP_SMS4_KEY *sms4 = (EVP_SMS4_KEY *)ctx->cipher_data;
+
 	if (!enc) {
 		if (EVP_CIPHER_CTX_mode(ctx) == EVP_CIPH_OFB_MODE)
 			enc = 1;
@@ -77,17 +81,108 @@ static int sms4_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
 			enc = 1;  //encrypt key == decrypt key
 	}
 
-	if (enc)
-                sms4_set_encrypt_key(ctx->cipher_data, key);
-	else	sms4_set_decrypt_key(ctx->cipher_data, key);
+	if (sms4->cache)
+		SMS4_KEY_CACHE_get(sms4->cache, key, enc ? &sms4->ks : NULL,
+			enc ? NULL : &sms4->ks);
+	else if (enc)
+		sms4_set_encrypt_key(&sms4->ks, key);
+	else	sms4_set_decrypt_key(&sms4->ks, key);
+
+
+	return 1;
+}
+
+/* the cache is owned by the caller and must outlive the context */
+static int sms4_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	EVP_SMS4_KEY *sms4 = (EVP_SMS4_KEY *)ctx->cipher_data;
+
+	switch (type) {
+	case EVP_CTRL_INIT:
+		sms4->cache = NULL;
+		return 1;
+	case EVP_CTRL_SMS4_SET_KEY_CACHE:
+		sms4->cache = ptr;
+		return 1;
+	default:
+		return -1;
+	}
+}
 
+/* ECB goes through the multi-block kernels instead of BLOCK_CIPHER_func_ecb */
+static int sms4_ecb_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t len)
+{
+	EVP_SMS4_KEY *sms4 = (EVP_SMS4_KEY *)ctx->cipher_data;
 
+	sms4_ecb_encrypt_blocks(in, out, len / SMS4_BLOCK_SIZE, &sms4->ks);
+	return 1;
+}
+
+BLOCK_CIPHER_func_cbc(sms4, sms4, EVP_SMS4_KEY, ks)
+BLOCK_CIPHER_func_cfb(sms4, sms4, 128, EVP_SMS4_KEY, ks)
+BLOCK_CIPHER_func_ofb(sms4, sms4, 128, EVP_SMS4_KEY, ks)
+
+/*
+ * batch CBC, the encrypting contexts with the key schedule of the first
+ * one are run as parallel chains, the others one by one
+ */
+static int sms4_cbc_cipher_mb(EVP_CIPHER_CTX *ctx[], unsigned char *out[],
+	const unsigned char *in[], const size_t len[], size_t n)
+{
+	const unsigned char *pin[SMS4_MB_LANES];
+	unsigned char *pout[SMS4_MB_LANES], *iv[SMS4_MB_LANES];
+	size_t blocks[SMS4_MB_LANES];
+	const sms4_key_t *key = NULL;
+	EVP_SMS4_KEY *sms4;
+	size_t i;
+	int lanes = 0;
+
+	for (i = 0; i < n; i++) {
+		sms4 = (EVP_SMS4_KEY *)ctx[i]->cipher_data;
+		if (!ctx[i]->encrypt || (key &&
+			CRYPTO_memcmp(&sms4->ks, key, sizeof(sms4_key_t)) != 0)) {
+			sms4_cbc_cipher(ctx[i], out[i], in[i], len[i]);
+			continue;
+		}
+		if (!key)
+			key = &sms4->ks;
+		pin[lanes] = in[i];
+		pout[lanes] = out[i];
+		iv[lanes] = ctx[i]->iv;
+		blocks[lanes++] = len[i] / SMS4_BLOCK_SIZE;
+		if (lanes == SMS4_MB_LANES) {
+			sms4_cbc_encrypt_mb(pin, pout, blocks, lanes, key, iv);
+			lanes = 0;
+		}
+	}
+	if (lanes)
+		sms4_cbc_encrypt_mb(pin, pout, blocks, lanes, key, iv);
 	return 1;
 }
 
-IMPLEMENT_BLOCK_CIPHER(sms4, ks, sms4, EVP_SMS4_KEY, NID_sms4,
-	SMS4_BLOCK_SIZE, SMS4_KEY_LENGTH, SMS4_IV_LENGTH, 128, 0,
-	sms4_init_key, NULL, NULL, NULL, NULL)
+static int sms4_cbc_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	if (type == EVP_CTRL_GET_CIPHER_MB) {
+		*(EVP_CIPHER_MB_FUNC *)ptr = sms4_cbc_cipher_mb;
+		return 1;
+	}
+	return sms4_ctrl(ctx, type, arg, ptr);
+}
+
+BLOCK_CIPHER_def_cbc(sms4, EVP_SMS4_KEY, NID_sms4, SMS4_BLOCK_SIZE,
+	SMS4_KEY_LENGTH, SMS4_IV_LENGTH,
+	EVP_CIPH_CTRL_INIT | EVP_CIPH_FLAG_MULTI_BUFFER, sms4_init_key, NULL,
+	NULL, NULL, sms4_cbc_ctrl)
+BLOCK_CIPHER_def_cfb(sms4, EVP_SMS4_KEY, NID_sms4, SMS4_KEY_LENGTH,
+	SMS4_IV_LENGTH, 128, EVP_CIPH_CTRL_INIT, sms4_init_key, NULL, NULL,
+	NULL, sms4_ctrl)
+BLOCK_CIPHER_def_ofb(sms4, EVP_SMS4_KEY, NID_sms4, SMS4_KEY_LENGTH,
+	SMS4_IV_LENGTH, 128, EVP_CIPH_CTRL_INIT, sms4_init_key, NULL, NULL,
+	NULL, sms4_ctrl)
+BLOCK_CIPHER_def_ecb(sms4, EVP_SMS4_KEY, NID_sms4, SMS4_BLOCK_SIZE,
+	SMS4_KEY_LENGTH, EVP_CIPH_CTRL_INIT, sms4_init_key, NULL, NULL, NULL,
+	sms4_ctrl)
 
 # define MAXBITCHUNK     ((size_t)1<<(sizeof(size_t)*8-4))
 
@@ -121,14 +216,14 @@ const EVP_CIPHER sms4_cfb1 = {
 	SMS4_BLOCK_SIZE,
 	SMS4_KEY_LENGTH,
 	SMS4_IV_LENGTH,
-	EVP_CIPH_CTR_MODE,
+	EVP_CIPH_CTR_MODE | EVP_CIPH_CTRL_INIT,
 	sms4_init_key,
 	sms4_cfb1_cipher,
 	NULL, /* cleanup() */
 	sizeof(EVP_SMS4_KEY),
 	NULL, /* set_asn1_parameters() */
 	NULL, /* get_asn1_parameters() */
-	NULL, /* ctrl() */
+	sms4_ctrl, /* ctrl() */
 	NULL  /* app_data */
 };
 
@@ -154,14 +249,14 @@ const EVP_CIPHER sms4_cfb8 = {
 	SMS4_BLOCK_SIZE,
 	SMS4_KEY_LENGTH,
 	SMS4_IV_LENGTH,
-	EVP_CIPH_CTR_MODE,
+	EVP_CIPH_CTR_MODE | EVP_CIPH_CTRL_INIT,
 	sms4_init_key,
 	sms4_cfb8_cipher,
 	NULL,
 	sizeof(EVP_SMS4_KEY),
 	NULL,
 	NULL,
-	NULL,
+	sms4_ctrl,
 	NULL, 
 };
 
@@ -178,7 +273,7 @@ static int sms4_ctr_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 	EVP_SMS4_KEY *sms4 = (EVP_SMS4_KEY *)ctx->cipher_data;
 
 	CRYPTO_ctr128_encrypt_ctr32(in, out, len, &sms4->ks, ctx->iv, ctx->buf,
-		&num, (ctr128_f)sms4_encrypt);
+		&num, (ctr128_f)sms4_ctr32_encrypt_blocks);
 
 	ctx->num = (size_t)num;
 	return 1;
@@ -189,14 +284,14 @@ const EVP_CIPHER sms4_ctr = {
 	SMS4_BLOCK_SIZE,
 	SMS4_KEY_LENGTH,
 	SMS4_IV_LENGTH,
-	EVP_CIPH_CTR_MODE,
+	EVP_CIPH_CTR_MODE | EVP_CIPH_CTRL_INIT,
 	sms4_init_key,
 	sms4_ctr_cipher,
 	NULL, /* cleanup() */
 	sizeof(EVP_SMS4_KEY),
 	NULL, /* set_asn1_parameters() */
 	NULL, /* get_asn1_parameters() */
-	NULL, /* ctrl() */
+	sms4_ctrl, /* ctrl() */
 	NULL  /* app_data */
 };
 
@@ -205,42 +300,577 @@ const EVP_CIPHER *EVP_sms4_ctr(void)
 	return &sms4_ctr;
 }
 
-#if 0
-
 typedef struct {
-	sms4_key_t ks;
-	int key_is_inited;
-	int iv_is_inited;
+	union {
+		double align;
+		sms4_key_t ks;
+	} ks;
+	int key_set;
+	int iv_set;
 	GCM128_CONTEXT gcm;
 	unsigned char *iv;
 	int ivlen;
 	int taglen;
 	int iv_gen;
-	ctr128_f ctr;
+	int tls_aad_len;
 } EVP_SMS4_GCM_CTX;
 
+static int sms4_gcm_cleanup(EVP_CIPHER_CTX *ctx)
+{
+	EVP_SMS4_GCM_CTX *gctx = ctx->cipher_data;
+
+	OPENSSL_cleanse(&gctx->gcm, sizeof(gctx->gcm));
+	if (gctx->iv != ctx->iv)
+		OPENSSL_free(gctx->iv);
+	return 1;
+}
+
+/* increment the 64-bit invocation field of the IV */
+static void sms4_gcm_ctr64_inc(unsigned char *counter)
+{
+	int n = 8;
+
+	do {
+		if (++counter[--n])
+			return;
+	} while (n);
+}
 
 static int sms4_gcm_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
 {
+	EVP_SMS4_GCM_CTX *gctx = ctx->cipher_data;
+	unsigned int len;
 
 	switch (type) {
 	case EVP_CTRL_INIT:
-
+		gctx->key_set = 0;
+		gctx->iv_set = 0;
+		gctx->ivlen = ctx->cipher->iv_len;
+		gctx->iv = ctx->iv;
+		gctx->taglen = -1;
+		gctx->iv_gen = 0;
+		gctx->tls_aad_len = -1;
+		return 1;
 
 	case EVP_CTRL_GCM_SET_IVLEN:
+		if (arg <= 0)
+			return 0;
+		if (arg > EVP_MAX_IV_LENGTH && arg > gctx->ivlen) {
+			if (gctx->iv != ctx->iv)
+				OPENSSL_free(gctx->iv);
+			if (!(gctx->iv = OPENSSL_malloc(arg)))
+				return 0;
+		}
+		gctx->ivlen = arg;
+		return 1;
+
 	case EVP_CTRL_GCM_SET_TAG:
+		if (arg <= 0 || arg > 16 || ctx->encrypt)
+			return 0;
+		memcpy(ctx->buf, ptr, arg);
+		gctx->taglen = arg;
+		return 1;
+
 	case EVP_CTRL_GCM_GET_TAG:
+		if (arg <= 0 || arg > 16 || !ctx->encrypt || gctx->taglen < 0)
+			return 0;
+		memcpy(ptr, ctx->buf, arg);
+		return 1;
+
 	case EVP_CTRL_GCM_SET_IV_FIXED:
+		/* -1 restores the whole IV */
+		if (arg == -1) {
+			memcpy(gctx->iv, ptr, gctx->ivlen);
+			gctx->iv_gen = 1;
+			return 1;
+		}
+		/* fixed field at least 4 bytes, invocation field at least 8 */
+		if (arg < 4 || gctx->ivlen - arg < 8)
+			return 0;
+		memcpy(gctx->iv, ptr, arg);
+		if (ctx->encrypt &&
+			RAND_bytes(gctx->iv + arg, gctx->ivlen - arg) <= 0)
+			return 0;
+		gctx->iv_gen = 1;
+		return 1;
+
 	case EVP_CTRL_GCM_IV_GEN:
+		if (!gctx->iv_gen || !gctx->key_set)
+			return 0;
+		CRYPTO_gcm128_setiv(&gctx->gcm, gctx->iv, gctx->ivlen);
+		if (arg <= 0 || arg > gctx->ivlen)
+			arg = gctx->ivlen;
+		memcpy(ptr, gctx->iv + gctx->ivlen - arg, arg);
+		sms4_gcm_ctr64_inc(gctx->iv + gctx->ivlen - 8);
+		gctx->iv_set = 1;
+		return 1;
+
 	case EVP_CTRL_GCM_SET_IV_INV:
+		if (!gctx->iv_gen || !gctx->key_set || ctx->encrypt)
+			return 0;
+		memcpy(gctx->iv + gctx->ivlen - arg, ptr, arg);
+		CRYPTO_gcm128_setiv(&gctx->gcm, gctx->iv, gctx->ivlen);
+		gctx->iv_set = 1;
+		return 1;
+
+	case EVP_CTRL_AEAD_TLS1_AAD:
+		if (arg != EVP_AEAD_TLS1_AAD_LEN)
+			return 0;
+		memcpy(ctx->buf, ptr, arg);
+		gctx->tls_aad_len = arg;
+		/* the record length without explicit IV (and tag) */
+		len = ctx->buf[arg - 2] << 8 | ctx->buf[arg - 1];
+		len -= EVP_GCM_TLS_EXPLICIT_IV_LEN;
+		if (!ctx->encrypt)
+			len -= EVP_GCM_TLS_TAG_LEN;
+		ctx->buf[arg - 2] = len >> 8;
+		ctx->buf[arg - 1] = len & 0xff;
+		return EVP_GCM_TLS_TAG_LEN;
+
 	case EVP_CTRL_COPY:
+		{
+			EVP_CIPHER_CTX *out = ptr;
+			EVP_SMS4_GCM_CTX *gctx_out = out->cipher_data;
+
+			if (gctx->gcm.key) {
+				if (gctx->gcm.key != &gctx->ks)
+					return 0;
+				gctx_out->gcm.key = &gctx_out->ks;
+			}
+			if (gctx->iv == ctx->iv)
+				gctx_out->iv = out->iv;
+			else {
+				if (!(gctx_out->iv = OPENSSL_malloc(gctx->ivlen)))
+					return 0;
+				memcpy(gctx_out->iv, gctx->iv, gctx->ivlen);
+			}
+			return 1;
+		}
+
 	default:
 		return -1;
-	}	
+	}
+}
+
+static int sms4_gcm_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+	const unsigned char *iv, int enc)
+{
+	EVP_SMS4_GCM_CTX *gctx = ctx->cipher_data;
+
+	if (!iv && !key)
+		return 1;
 
+	if (key) {
+		sms4_set_encrypt_key(&gctx->ks.ks, key);
+		CRYPTO_gcm128_init(&gctx->gcm, &gctx->ks,
+			(block128_f)sms4_encrypt);
+
+		/* use the saved IV if there is no new one */
+		if (!iv && gctx->iv_set)
+			iv = gctx->iv;
+		if (iv) {
+			CRYPTO_gcm128_setiv(&gctx->gcm, iv, gctx->ivlen);
+			gctx->iv_set = 1;
+		}
+		gctx->key_set = 1;
+	} else {
+		if (gctx->key_set)
+			CRYPTO_gcm128_setiv(&gctx->gcm, iv, gctx->ivlen);
+		else	memcpy(gctx->iv, iv, gctx->ivlen);
+		gctx->iv_set = 1;
+		gctx->iv_gen = 0;
+	}
 
+	return 1;
+}
+
+/* en/decrypt len bytes of the message, the tag is not touched */
+static int sms4_gcm_crypt(EVP_SMS4_GCM_CTX *gctx, const unsigned char *in,
+	unsigned char *out, size_t len, int enc)
+{
+	if (enc)
+		return CRYPTO_gcm128_encrypt_ctr32(&gctx->gcm, in, out, len,
+			(ctr128_f)sms4_ctr32_encrypt_blocks);
+	else	return CRYPTO_gcm128_decrypt_ctr32(&gctx->gcm, in, out, len,
+			(ctr128_f)sms4_ctr32_encrypt_blocks);
+}
+
+/*
+ * TLS records are explicit IV || payload || tag and are processed in place
+ * with the AAD set by EVP_CTRL_AEAD_TLS1_AAD.
+ */
+static int sms4_gcm_tls_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t len)
+{
+	EVP_SMS4_GCM_CTX *gctx = ctx->cipher_data;
+	int rv = -1;
+
+	if (out != in ||
+		len < EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN)
+		return -1;
+
+	if (EVP_CIPHER_CTX_ctrl(ctx, ctx->encrypt ?
+		EVP_CTRL_GCM_IV_GEN : EVP_CTRL_GCM_SET_IV_INV,
+		EVP_GCM_TLS_EXPLICIT_IV_LEN, out) <= 0)
+		goto end;
+	if (CRYPTO_gcm128_aad(&gctx->gcm, ctx->buf, gctx->tls_aad_len))
+		goto end;
+
+	in += EVP_GCM_TLS_EXPLICIT_IV_LEN;
+	out += EVP_GCM_TLS_EXPLICIT_IV_LEN;
+	len -= EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN;
+
+	if (sms4_gcm_crypt(gctx, in, out, len, ctx->encrypt))
+		goto end;
+
+	if (ctx->encrypt) {
+		CRYPTO_gcm128_tag(&gctx->gcm, out + len, EVP_GCM_TLS_TAG_LEN);
+		rv = len + EVP_GCM_TLS_EXPLICIT_IV_LEN + EVP_GCM_TLS_TAG_LEN;
+	} else {
+		CRYPTO_gcm128_tag(&gctx->gcm, ctx->buf, EVP_GCM_TLS_TAG_LEN);
+		if (CRYPTO_memcmp(ctx->buf, in + len, EVP_GCM_TLS_TAG_LEN)) {
+			OPENSSL_cleanse(out, len);
+			goto end;
+		}
+		rv = len;
+	}
+
+end:
+	gctx->iv_set = 0;
+	gctx->tls_aad_len = -1;
+	return rv;
+}
+
+static int sms4_gcm_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t len)
+{
+	EVP_SMS4_GCM_CTX *gctx = ctx->cipher_data;
+
+	if (!gctx->key_set)
+		return -1;
+
+	if (gctx->tls_aad_len >= 0)
+		return sms4_gcm_tls_cipher(ctx, out, in, len);
+
+	if (!gctx->iv_set)
+		return -1;
+
+	if (in) {
+		if (!out) {
+			if (CRYPTO_gcm128_aad(&gctx->gcm, in, len))
+				return -1;
+		} else if (sms4_gcm_crypt(gctx, in, out, len, ctx->encrypt))
+			return -1;
+		return len;
+	}
+
+	/* final */
+	if (!ctx->encrypt) {
+		if (gctx->taglen < 0)
+			return -1;
+		if (CRYPTO_gcm128_finish(&gctx->gcm, ctx->buf, gctx->taglen))
+			return -1;
+		gctx->iv_set = 0;
+		return 0;
+	}
+	CRYPTO_gcm128_tag(&gctx->gcm, ctx->buf, 16);
+	gctx->taglen = 16;
+	/* do not reuse the IV */
+	gctx->iv_set = 0;
+	return 0;
+}
+
+#define SMS4_GCM_IV_LENGTH	12
+#define SMS4_AEAD_FLAGS		(EVP_CIPH_FLAG_DEFAULT_ASN1 \
+		| EVP_CIPH_CUSTOM_IV | EVP_CIPH_FLAG_CUSTOM_CIPHER \
+		| EVP_CIPH_ALWAYS_CALL_INIT | EVP_CIPH_CTRL_INIT \
+		| EVP_CIPH_CUSTOM_COPY | EVP_CIPH_FLAG_AEAD_CIPHER)
+
+const EVP_CIPHER sms4_gcm = {
+	NID_sms4_gcm,
+	1, /* block_size */
+	SMS4_KEY_LENGTH,
+	SMS4_GCM_IV_LENGTH,
+	EVP_CIPH_GCM_MODE | SMS4_AEAD_FLAGS,
+	sms4_gcm_init_key,
+	sms4_gcm_cipher,
+	sms4_gcm_cleanup,
+	sizeof(EVP_SMS4_GCM_CTX),
+	NULL, /* set_asn1_parameters() */
+	NULL, /* get_asn1_parameters() */
+	sms4_gcm_ctrl,
+	NULL  /* app_data */
+};
+
+const EVP_CIPHER *EVP_sms4_gcm(void)
+{
+	return &sms4_gcm;
+}
+
+typedef struct {
+	union {
+		double align;
+		sms4_key_t ks;
+	} ks;
+	int key_set;
+	int iv_set;
+	int tag_set;
+	int len_set;
+	int L, M;
+	CCM128_CONTEXT ccm;
+} EVP_SMS4_CCM_CTX;
+
+static int sms4_ccm_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	EVP_SMS4_CCM_CTX *cctx = ctx->cipher_data;
+
+	switch (type) {
+	case EVP_CTRL_INIT:
+		cctx->key_set = 0;
+		cctx->iv_set = 0;
+		cctx->L = 8;
+		cctx->M = 12;
+		cctx->tag_set = 0;
+		cctx->len_set = 0;
+		return 1;
+
+	case EVP_CTRL_CCM_SET_IVLEN:
+		arg = 15 - arg;
+		/* fall through */
+	case EVP_CTRL_CCM_SET_L:
+		if (arg < 2 || arg > 8)
+			return 0;
+		cctx->L = arg;
+		return 1;
+
+	case EVP_CTRL_CCM_SET_TAG:
+		if ((arg & 1) || arg < 4 || arg > 16)
+			return 0;
+		if (ctx->encrypt && ptr)
+			return 0;
+		if (ptr) {
+			cctx->tag_set = 1;
+			memcpy(ctx->buf, ptr, arg);
+		}
+		cctx->M = arg;
+		return 1;
+
+	case EVP_CTRL_CCM_GET_TAG:
+		if (!ctx->encrypt || !cctx->tag_set)
+			return 0;
+		if (!CRYPTO_ccm128_tag(&cctx->ccm, ptr, (size_t)arg))
+			return 0;
+		cctx->tag_set = 0;
+		cctx->iv_set = 0;
+		cctx->len_set = 0;
+		return 1;
+
+	case EVP_CTRL_COPY:
+		{
+			EVP_CIPHER_CTX *out = ptr;
+			EVP_SMS4_CCM_CTX *cctx_out = out->cipher_data;
+
+			if (cctx->ccm.key) {
+				if (cctx->ccm.key != &cctx->ks)
+					return 0;
+				cctx_out->ccm.key = &cctx_out->ks;
+			}
+			return 1;
+		}
+
+	default:
+		return -1;
+	}
+}
+
+static int sms4_ccm_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+	const unsigned char *iv, int enc)
+{
+	EVP_SMS4_CCM_CTX *cctx = ctx->cipher_data;
+
+	if (!iv && !key)
+		return 1;
+
+	if (key) {
+		sms4_set_encrypt_key(&cctx->ks.ks, key);
+		CRYPTO_ccm128_init(&cctx->ccm, cctx->M, cctx->L, &cctx->ks,
+			(block128_f)sms4_encrypt);
+		cctx->key_set = 1;
+	}
+	if (iv) {
+		memcpy(ctx->iv, iv, 15 - cctx->L);
+		cctx->iv_set = 1;
+	}
+
+	return 1;
+}
+
+static int sms4_ccm_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t len)
+{
+	EVP_SMS4_CCM_CTX *cctx = ctx->cipher_data;
+	CCM128_CONTEXT *ccm = &cctx->ccm;
+	unsigned char tag[16];
+	int rv = -1;
+
+	if (!cctx->iv_set && !cctx->key_set)
+		return -1;
+	if (!ctx->encrypt && !cctx->tag_set)
+		return -1;
+
+	if (!out) {
+		/* set the total message length */
+		if (!in) {
+			if (CRYPTO_ccm128_setiv(ccm, ctx->iv, 15 - cctx->L, len))
+				return -1;
+			cctx->len_set = 1;
+			return len;
+		}
+		/* AAD needs the message length first */
+		if (!cctx->len_set && len)
+			return -1;
+		CRYPTO_ccm128_aad(ccm, in, len);
+		return len;
+	}
+
+	/* final does not output any data */
+	if (!in)
+		return 0;
+
+	if (!cctx->len_set) {
+		if (CRYPTO_ccm128_setiv(ccm, ctx->iv, 15 - cctx->L, len))
+			return -1;
+		cctx->len_set = 1;
+	}
+
+	if (ctx->encrypt) {
+		if (CRYPTO_ccm128_encrypt_ccm64(ccm, in, out, len,
+			(ccm128_f)sms4_ccm64_encrypt_blocks))
+			return -1;
+		cctx->tag_set = 1;
+		return len;
+	}
+
+	if (!CRYPTO_ccm128_decrypt_ccm64(ccm, in, out, len,
+		(ccm128_f)sms4_ccm64_decrypt_blocks)) {
+		if (CRYPTO_ccm128_tag(ccm, tag, cctx->M) &&
+			!CRYPTO_memcmp(tag, ctx->buf, cctx->M))
+			rv = len;
+	}
+	if (rv == -1)
+		OPENSSL_cleanse(out, len);
+	cctx->iv_set = 0;
+	cctx->tag_set = 0;
+	cctx->len_set = 0;
+	return rv;
+}
+
+#define SMS4_CCM_IV_LENGTH	12
+
+const EVP_CIPHER sms4_ccm = {
+	NID_sms4_ccm,
+	1, /* block_size */
+	SMS4_KEY_LENGTH,
+	SMS4_CCM_IV_LENGTH,
+	EVP_CIPH_CCM_MODE | SMS4_AEAD_FLAGS,
+	sms4_ccm_init_key,
+	sms4_ccm_cipher,
+	NULL, /* cleanup() */
+	sizeof(EVP_SMS4_CCM_CTX),
+	NULL, /* set_asn1_parameters() */
+	NULL, /* get_asn1_parameters() */
+	sms4_ccm_ctrl,
+	NULL  /* app_data */
+};
+
+const EVP_CIPHER *EVP_sms4_ccm(void)
+{
+	return &sms4_ccm;
+}
+
+typedef struct {
+	sms4_key_t ks1;
+	sms4_key_t ks2;
+	int key_set;
+	int iv_set;
+} EVP_SMS4_XTS_CTX;
+
+static int sms4_xts_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	EVP_SMS4_XTS_CTX *xctx = ctx->cipher_data;
+
+	if (type == EVP_CTRL_COPY)
+		return 1;
+	if (type != EVP_CTRL_INIT)
+		return -1;
+	xctx->key_set = 0;
+	xctx->iv_set = 0;
+	return 1;
+}
+
+static int sms4_xts_init_key(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+	const unsigned char *iv, int enc)
+{
+	EVP_SMS4_XTS_CTX *xctx = ctx->cipher_data;
+
+	if (!iv && !key)
+		return 1;
+
+	/* the key is the data key followed by the tweak key */
+	if (key) {
+		if (enc)
+			sms4_set_encrypt_key(&xctx->ks1, key);
+		else	sms4_set_decrypt_key(&xctx->ks1, key);
+		sms4_set_encrypt_key(&xctx->ks2, key + SMS4_KEY_LENGTH);
+		xctx->key_set = 1;
+	}
+	if (iv) {
+		memcpy(ctx->iv, iv, SMS4_IV_LENGTH);
+		xctx->iv_set = 1;
+	}
+
+	return 1;
+}
+
+static int sms4_xts_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t len)
+{
+	EVP_SMS4_XTS_CTX *xctx = ctx->cipher_data;
+
+	if (!xctx->key_set || !xctx->iv_set)
+		return 0;
+	if (!out || !in || len < SMS4_BLOCK_SIZE)
+		return 0;
+	if (sms4_xts_encrypt(in, out, len, &xctx->ks1, &xctx->ks2, ctx->iv,
+		ctx->encrypt))
+		return 0;
+	return 1;
+}
+
+#define SMS4_XTS_FLAGS		(EVP_CIPH_FLAG_DEFAULT_ASN1 | EVP_CIPH_CUSTOM_IV \
+		| EVP_CIPH_ALWAYS_CALL_INIT | EVP_CIPH_CTRL_INIT \
+		| EVP_CIPH_CUSTOM_COPY)
+
+const EVP_CIPHER sms4_xts = {
+	NID_sms4_xts,
+	1, /* block_size */
+	SMS4_KEY_LENGTH * 2,
+	SMS4_IV_LENGTH,
+	EVP_CIPH_XTS_MODE | SMS4_XTS_FLAGS,
+	sms4_xts_init_key,
+	sms4_xts_cipher,
+	NULL, /* cleanup() */
+	sizeof(EVP_SMS4_XTS_CTX),
+	NULL, /* set_asn1_parameters() */
+	NULL, /* get_asn1_parameters() */
+	sms4_xts_ctrl,
+	NULL  /* app_data */
+};
+
+const EVP_CIPHER *EVP_sms4_xts(void)
+{
+	return &sms4_xts;
 }
-#endif
 
 typedef struct {
 	union {
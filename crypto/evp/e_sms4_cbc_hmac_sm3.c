@@ -0,0 +1,803 @@
+/* crypto/evp/e_sms4_cbc_hmac_sm3.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * SMS4-CBC-HMAC-SM3 composite cipher for the TLS record layer, modelled
+ * on e_aes_cbc_hmac_sha256.c.
+ *
+ * On encryption the record is hashed and encrypted in a single pass,
+ * every 64-byte SM3 block is fed to the compression function and then
+ * CBC-encrypted while it is still in L1. With the TLS 1.1+ multi-block
+ * interface 4 or 8 records are processed in parallel: the HMACs with
+ * the multi-lane SM3 and the CBC chains as one block of each record per
+ * call of the multi-block SMS4 kernels. Decryption verifies the MAC and
+ * the padding in constant time.
+ */
+
+#include <stdio.h>
+#include "cryptlib.h"
+
+#if !defined(OPENSSL_NO_SMS4) && !defined(OPENSSL_NO_SM3)
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+#include <openssl/rand.h>
+#include <openssl/sms4.h>
+#include <openssl/sm3.h>
+
+#define TLS1_1_VERSION		0x0302
+
+typedef struct {
+	sms4_key_t ks;
+	sm3_ctx_t head, tail, md;
+	size_t payload_length;	/* AAD length in decrypt case */
+	union {
+		unsigned int tls_ver;
+		unsigned char tls_aad[16]; /* 13 used */
+	} aux;
+} EVP_SMS4_HMAC_SM3;
+
+#define NO_PAYLOAD_LENGTH	((size_t)-1)
+
+#define data(ctx)	((EVP_SMS4_HMAC_SM3 *)(ctx)->cipher_data)
+
+static int sms4_cbc_hmac_sm3_init_key(EVP_CIPHER_CTX *ctx,
+	const unsigned char *inkey, const unsigned char *iv, int enc)
+{
+	EVP_SMS4_HMAC_SM3 *key = data(ctx);
+
+	if (enc)
+		sms4_set_encrypt_key(&key->ks, inkey);
+	else	sms4_set_decrypt_key(&key->ks, inkey);
+
+	/* handy when benchmarking */
+	sm3_init(&key->head);
+	key->tail = key->head;
+	key->md = key->head;
+
+	key->payload_length = NO_PAYLOAD_LENGTH;
+	return 1;
+}
+
+/*
+ * Hash blocks * 64 bytes from in0 and CBC-encrypt as many bytes from in
+ * to out, one SM3 block at a time. in0 is ahead of in so this also
+ * works in place.
+ */
+static void sms4_cbc_sm3_enc(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, unsigned char iv[16],
+	sm3_ctx_t *md, const unsigned char *in0)
+{
+	size_t n = blocks;
+
+	while (n--) {
+		sm3_compress(md->digest, in0);
+		sms4_cbc_encrypt(in, out, SM3_BLOCK_SIZE, key, iv, 1);
+		in0 += SM3_BLOCK_SIZE;
+		in += SM3_BLOCK_SIZE;
+		out += SM3_BLOCK_SIZE;
+	}
+	md->nblocks += blocks;
+}
+
+#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+
+typedef struct {
+	const unsigned char *ptr;
+	int blocks;
+} HASH_DESC;
+
+typedef struct {
+	const unsigned char *inp;
+	unsigned char *out;
+	int blocks;
+	unsigned char iv[16];
+} CIPH_DESC;
+
+/* hash desc[i].blocks blocks in lane i, lanes past the end are left alone */
+static void sm3_multi_block(uint32_t digest[8][SM3_MB_LANES],
+	const HASH_DESC *desc, int lanes)
+{
+	static const unsigned char zero[SM3_BLOCK_SIZE] = {0};
+	const unsigned char *ptr[SM3_MB_LANES];
+	uint32_t save[8][SM3_MB_LANES];
+	int blocks[SM3_MB_LANES];
+	int i, j, n, max = 0;
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		ptr[i] = i < lanes ? desc[i].ptr : zero;
+		blocks[i] = i < lanes ? desc[i].blocks : 0;
+		if (blocks[i] > max)
+			max = blocks[i];
+	}
+
+	for (n = 0; n < max; n++) {
+		memcpy(save, digest, sizeof(save));
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			if (n >= blocks[i])
+				ptr[i] = zero;
+		}
+		sm3_compress_x8(digest, ptr);
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			if (n < blocks[i]) {
+				ptr[i] += SM3_BLOCK_SIZE;
+			} else {
+				for (j = 0; j < 8; j++)
+					digest[j][i] = save[j][i];
+			}
+		}
+	}
+}
+
+/* CBC-encrypt the lanes in parallel, one block of every lane per step */
+static void sms4_multi_cbc_encrypt(CIPH_DESC *desc, const sms4_key_t *key,
+	int lanes)
+{
+	unsigned char buf[SMS4_BLOCK_SIZE * SM3_MB_LANES];
+	int i, j, n, max = 0;
+
+	for (i = 0; i < lanes; i++) {
+		if (desc[i].blocks > max)
+			max = desc[i].blocks;
+	}
+
+	for (n = 0; n < max; n++) {
+		for (i = 0; i < lanes; i++) {
+			const unsigned char *in = desc[i].inp + SMS4_BLOCK_SIZE * n;
+			unsigned char *b = buf + SMS4_BLOCK_SIZE * i;
+
+			if (n < desc[i].blocks) {
+				for (j = 0; j < SMS4_BLOCK_SIZE; j++)
+					b[j] = in[j] ^ desc[i].iv[j];
+			} else {
+				memset(b, 0, SMS4_BLOCK_SIZE);
+			}
+		}
+		sms4_ecb_encrypt_blocks(buf, buf, lanes, key);
+		for (i = 0; i < lanes; i++) {
+			if (n < desc[i].blocks) {
+				memcpy(desc[i].out + SMS4_BLOCK_SIZE * n,
+					buf + SMS4_BLOCK_SIZE * i, SMS4_BLOCK_SIZE);
+				memcpy(desc[i].iv, buf + SMS4_BLOCK_SIZE * i,
+					SMS4_BLOCK_SIZE);
+			}
+		}
+	}
+	OPENSSL_cleanse(buf, sizeof(buf));
+}
+
+static void sm3_mb_put_digest(unsigned char *out,
+	uint32_t digest[8][SM3_MB_LANES], int lane)
+{
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		out[4 * i] = (unsigned char)(digest[i][lane] >> 24);
+		out[4 * i + 1] = (unsigned char)(digest[i][lane] >> 16);
+		out[4 * i + 2] = (unsigned char)(digest[i][lane] >> 8);
+		out[4 * i + 3] = (unsigned char)digest[i][lane];
+	}
+}
+
+static void sm3_mb_put_len(unsigned char *p, unsigned int len)
+{
+	p[0] = (unsigned char)(len >> 24);
+	p[1] = (unsigned char)(len >> 16);
+	p[2] = (unsigned char)(len >> 8);
+	p[3] = (unsigned char)len;
+}
+
+static size_t tls1_1_multi_block_encrypt(EVP_SMS4_HMAC_SM3 *key,
+	unsigned char *out, const unsigned char *inp, size_t inp_len,
+	int n4x) /* n4x is 1 or 2 */
+{
+	HASH_DESC hash_d[8], edges[8];
+	CIPH_DESC ciph_d[8];
+	uint32_t digest[8][SM3_MB_LANES];
+	unsigned char blocks[8][128];
+	unsigned char *IVs;
+	unsigned char *seq = key->md.block;
+	unsigned int frag, last, packlen, i, j, x4 = 4 * n4x, minblocks;
+	unsigned int processed = 0, carry;
+	size_t ret = 0;
+
+	/* ask for IVs in bulk */
+	if (RAND_bytes((IVs = blocks[0]), 16 * x4) <= 0)
+		return 0;
+
+	frag = (unsigned int)inp_len >> (1 + n4x);
+	last = (unsigned int)inp_len + frag - (frag << (1 + n4x));
+	if (last > frag && ((last + 13 + 9) % 64) < (x4 - 1)) {
+		frag++;
+		last -= x4 - 1;
+	}
+
+	packlen = 5 + 16 + ((frag + 32 + 16) & -16);
+
+	/* populate descriptors with pointers and IVs, 5+16 is header and IV */
+	hash_d[0].ptr = inp;
+	ciph_d[0].inp = inp;
+	ciph_d[0].out = out + 5 + 16;
+	memcpy(ciph_d[0].out - 16, IVs, 16);
+	memcpy(ciph_d[0].iv, IVs, 16);
+	IVs += 16;
+
+	for (i = 1; i < x4; i++) {
+		ciph_d[i].inp = hash_d[i].ptr = hash_d[i - 1].ptr + frag;
+		ciph_d[i].out = ciph_d[i - 1].out + packlen;
+		memcpy(ciph_d[i].out - 16, IVs, 16);
+		memcpy(ciph_d[i].iv, IVs, 16);
+		IVs += 16;
+	}
+
+	memset(digest, 0, sizeof(digest));
+	memset(edges, 0, sizeof(edges));
+	for (i = 0; i < x4; i++) {
+		unsigned int len = (i == (x4 - 1) ? last : frag);
+
+		for (j = 0; j < 8; j++)
+			digest[j][i] = key->md.digest[j];
+
+		/* the 13-byte header with the sequence number and length fixed */
+		for (carry = i, j = 8; j--;) {
+			blocks[i][j] = seq[j] + carry;
+			carry = (blocks[i][j] - carry) >> (sizeof(carry) * 8 - 1);
+		}
+		blocks[i][8] = seq[8];
+		blocks[i][9] = seq[9];
+		blocks[i][10] = seq[10];
+		blocks[i][11] = (unsigned char)(len >> 8);
+		blocks[i][12] = (unsigned char)len;
+
+		memcpy(blocks[i] + 13, hash_d[i].ptr, 64 - 13);
+		hash_d[i].ptr += 64 - 13;
+		hash_d[i].blocks = (len - (64 - 13)) / 64;
+
+		edges[i].ptr = blocks[i];
+		edges[i].blocks = 1;
+	}
+
+	/* hash 13-byte headers and first 64-13 bytes of inputs */
+	sm3_multi_block(digest, edges, x4);
+
+#define MAXCHUNKSIZE	2048
+	/*
+	 * move in short steps so that the hashed data is still in the cache
+	 * by the time it is encrypted
+	 */
+	minblocks = ((frag <= last ? frag : last) - (64 - 13)) / 64;
+	if (minblocks > MAXCHUNKSIZE / 64) {
+		for (i = 0; i < x4; i++) {
+			edges[i].ptr = hash_d[i].ptr;
+			edges[i].blocks = MAXCHUNKSIZE / 64;
+			ciph_d[i].blocks = MAXCHUNKSIZE / 16;
+		}
+		do {
+			sm3_multi_block(digest, edges, x4);
+			sms4_multi_cbc_encrypt(ciph_d, &key->ks, x4);
+
+			for (i = 0; i < x4; i++) {
+				edges[i].ptr = hash_d[i].ptr += MAXCHUNKSIZE;
+				hash_d[i].blocks -= MAXCHUNKSIZE / 64;
+				edges[i].blocks = MAXCHUNKSIZE / 64;
+				ciph_d[i].inp += MAXCHUNKSIZE;
+				ciph_d[i].out += MAXCHUNKSIZE;
+				ciph_d[i].blocks = MAXCHUNKSIZE / 16;
+				memcpy(ciph_d[i].iv, ciph_d[i].out - 16, 16);
+			}
+			processed += MAXCHUNKSIZE;
+			minblocks -= MAXCHUNKSIZE / 64;
+		} while (minblocks > MAXCHUNKSIZE / 64);
+	}
+#undef MAXCHUNKSIZE
+	sm3_multi_block(digest, hash_d, x4);
+
+	memset(blocks, 0, sizeof(blocks));
+	for (i = 0; i < x4; i++) {
+		unsigned int len = (i == (x4 - 1) ? last : frag);
+		unsigned int off = hash_d[i].blocks * 64;
+		const unsigned char *ptr = hash_d[i].ptr + off;
+
+		/* the remainder */
+		off = (len - processed) - (64 - 13) - off;
+		memcpy(blocks[i], ptr, off);
+		blocks[i][off] = 0x80;
+		len += 64 + 13;	/* 64 is the HMAC key block */
+		len *= 8;
+		if (off < (64 - 8)) {
+			sm3_mb_put_len(blocks[i] + 60, len);
+			edges[i].blocks = 1;
+		} else {
+			sm3_mb_put_len(blocks[i] + 124, len);
+			edges[i].blocks = 2;
+		}
+		edges[i].ptr = blocks[i];
+	}
+
+	/* hash input tails and finalize */
+	sm3_multi_block(digest, edges, x4);
+
+	memset(blocks, 0, sizeof(blocks));
+	for (i = 0; i < x4; i++) {
+		sm3_mb_put_digest(blocks[i], digest, i);
+		for (j = 0; j < 8; j++)
+			digest[j][i] = key->tail.digest[j];
+		blocks[i][32] = 0x80;
+		sm3_mb_put_len(blocks[i] + 60, (64 + 32) * 8);
+		edges[i].ptr = blocks[i];
+		edges[i].blocks = 1;
+	}
+
+	/* finalize MACs */
+	sm3_multi_block(digest, edges, x4);
+
+	for (i = 0; i < x4; i++) {
+		unsigned int len = (i == (x4 - 1) ? last : frag), pad;
+		unsigned char *out0 = out;
+
+		memcpy(ciph_d[i].out, ciph_d[i].inp, len - processed);
+		ciph_d[i].inp = ciph_d[i].out;
+
+		out += 5 + 16 + len;
+
+		/* write MAC */
+		sm3_mb_put_digest(out, digest, i);
+		out += 32;
+		len += 32;
+
+		/* pad */
+		pad = 15 - len % 16;
+		for (j = 0; j <= pad; j++)
+			*(out++) = pad;
+		len += pad + 1;
+
+		ciph_d[i].blocks = (len - processed) / 16;
+		len += 16;	/* explicit IV */
+
+		/* arrange header */
+		out0[0] = seq[8];
+		out0[1] = seq[9];
+		out0[2] = seq[10];
+		out0[3] = (unsigned char)(len >> 8);
+		out0[4] = (unsigned char)len;
+
+		ret += len + 5;
+		inp += frag;
+	}
+
+	sms4_multi_cbc_encrypt(ciph_d, &key->ks, x4);
+
+	OPENSSL_cleanse(blocks, sizeof(blocks));
+	OPENSSL_cleanse(digest, sizeof(digest));
+
+	return ret;
+}
+#endif
+
+static int sms4_cbc_hmac_sm3_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t len)
+{
+	EVP_SMS4_HMAC_SM3 *key = data(ctx);
+	unsigned int l;
+	size_t plen = key->payload_length;
+	size_t iv = 0; /* explicit IV in TLS 1.1 and later */
+	size_t sm3_off = 0, sms4_off = 0, blocks;
+
+	key->payload_length = NO_PAYLOAD_LENGTH;
+
+	if (len % SMS4_BLOCK_SIZE)
+		return 0;
+
+	if (ctx->encrypt) {
+		if (plen == NO_PAYLOAD_LENGTH)
+			plen = len;
+		else if (len != ((plen + SM3_DIGEST_LENGTH + SMS4_BLOCK_SIZE) &
+			-SMS4_BLOCK_SIZE))
+			return 0;
+		else if (key->aux.tls_ver >= TLS1_1_VERSION)
+			iv = SMS4_BLOCK_SIZE;
+
+		/* complete the pending SM3 block, then the one-pass loop */
+		sm3_off = SM3_BLOCK_SIZE - key->md.num;
+		if (plen > sm3_off + iv &&
+			(blocks = (plen - (sm3_off + iv)) / SM3_BLOCK_SIZE)) {
+			sm3_update(&key->md, in + iv, sm3_off);
+			sms4_cbc_sm3_enc(in, out, blocks, &key->ks, ctx->iv,
+				&key->md, in + iv + sm3_off);
+			blocks *= SM3_BLOCK_SIZE;
+			sms4_off += blocks;
+			sm3_off += blocks;
+		} else {
+			sm3_off = 0;
+		}
+		sm3_off += iv;
+		sm3_update(&key->md, in + sm3_off, plen - sm3_off);
+
+		if (plen != len) { /* TLS mode of operation */
+			if (in != out)
+				memcpy(out + sms4_off, in + sms4_off, plen - sms4_off);
+
+			/* calculate HMAC and append it to payload */
+			sm3_final(&key->md, out + plen);
+			key->md = key->tail;
+			sm3_update(&key->md, out + plen, SM3_DIGEST_LENGTH);
+			sm3_final(&key->md, out + plen);
+
+			/* pad the payload|hmac */
+			plen += SM3_DIGEST_LENGTH;
+			for (l = len - plen - 1; plen < len; plen++)
+				out[plen] = l;
+
+			/* encrypt HMAC|padding at once */
+			sms4_cbc_encrypt(out + sms4_off, out + sms4_off,
+				len - sms4_off, &key->ks, ctx->iv, 1);
+		} else {
+			sms4_cbc_encrypt(in + sms4_off, out + sms4_off,
+				len - sms4_off, &key->ks, ctx->iv, 1);
+		}
+	} else {
+		union {
+			uint32_t u[SM3_DIGEST_LENGTH / sizeof(uint32_t)];
+			unsigned char c[64 + SM3_DIGEST_LENGTH];
+		} mac, *pmac;
+
+		/* arrange cache line alignment */
+		pmac = (void *)(((size_t)mac.c + 63) & ((size_t)0 - 64));
+
+		/* decrypt HMAC|padding at once */
+		sms4_cbc_encrypt(in, out, len, &key->ks, ctx->iv, 0);
+
+		if (plen != NO_PAYLOAD_LENGTH) { /* TLS mode of operation */
+			size_t inp_len, mask, j, i;
+			unsigned int res, maxpad, pad, bitlen;
+			int ret = 1;
+			union {
+				uint32_t u[SM3_BLOCK_SIZE / 4];
+				unsigned char c[SM3_BLOCK_SIZE];
+			} *data = (void *)key->md.block;
+
+			if ((key->aux.tls_aad[plen - 4] << 8 |
+				key->aux.tls_aad[plen - 3]) >= TLS1_1_VERSION)
+				iv = SMS4_BLOCK_SIZE;
+
+			if (len < (iv + SM3_DIGEST_LENGTH + 1))
+				return 0;
+
+			/* omit explicit iv */
+			out += iv;
+			len -= iv;
+
+			/* figure out payload length */
+			pad = out[len - 1];
+			maxpad = len - (SM3_DIGEST_LENGTH + 1);
+			maxpad |= (255 - maxpad) >> (sizeof(maxpad) * 8 - 8);
+			maxpad &= 255;
+
+			inp_len = len - (SM3_DIGEST_LENGTH + pad + 1);
+			mask = (0 - ((inp_len - len) >> (sizeof(inp_len) * 8 - 1)));
+			inp_len &= mask;
+			ret &= (int)mask;
+
+			key->aux.tls_aad[plen - 2] = inp_len >> 8;
+			key->aux.tls_aad[plen - 1] = inp_len;
+
+			/* calculate HMAC */
+			key->md = key->head;
+			sm3_update(&key->md, key->aux.tls_aad, plen);
+
+			len -= SM3_DIGEST_LENGTH; /* amend mac */
+			if (len >= (256 + SM3_BLOCK_SIZE)) {
+				j = (len - (256 + SM3_BLOCK_SIZE)) & (0 - SM3_BLOCK_SIZE);
+				j += SM3_BLOCK_SIZE - key->md.num;
+				sm3_update(&key->md, out, j);
+				out += j;
+				len -= j;
+				inp_len -= j;
+			}
+
+			/* but pretend as if we hashed padded payload */
+			bitlen = (unsigned int)((key->md.nblocks * SM3_BLOCK_SIZE +
+				key->md.num + inp_len) << 3); /* at most 18 bits */
+			mac.c[0] = (unsigned char)(bitlen >> 24);
+			mac.c[1] = (unsigned char)(bitlen >> 16);
+			mac.c[2] = (unsigned char)(bitlen >> 8);
+			mac.c[3] = (unsigned char)bitlen;
+			bitlen = mac.u[0];
+
+			for (i = 0; i < 8; i++)
+				pmac->u[i] = 0;
+
+			for (res = key->md.num, j = 0; j < len; j++) {
+				size_t c = out[j];
+
+				mask = (j - inp_len) >> (sizeof(j) * 8 - 8);
+				c &= mask;
+				c |= 0x80 & ~mask & ~((inp_len - j) >> (sizeof(j) * 8 - 8));
+				data->c[res++] = (unsigned char)c;
+
+				if (res != SM3_BLOCK_SIZE)
+					continue;
+
+				/* j is not incremented yet */
+				mask = 0 - ((inp_len + 7 - j) >> (sizeof(j) * 8 - 1));
+				data->u[SM3_BLOCK_SIZE / 4 - 1] |= bitlen & mask;
+				sm3_compress(key->md.digest, data->c);
+				mask &= 0 - ((j - inp_len - 72) >> (sizeof(j) * 8 - 1));
+				for (i = 0; i < 8; i++)
+					pmac->u[i] |= key->md.digest[i] & mask;
+				res = 0;
+			}
+
+			for (i = res; i < SM3_BLOCK_SIZE; i++, j++)
+				data->c[i] = 0;
+
+			if (res > SM3_BLOCK_SIZE - 8) {
+				mask = 0 - ((inp_len + 8 - j) >> (sizeof(j) * 8 - 1));
+				data->u[SM3_BLOCK_SIZE / 4 - 1] |= bitlen & mask;
+				sm3_compress(key->md.digest, data->c);
+				mask &= 0 - ((j - inp_len - 73) >> (sizeof(j) * 8 - 1));
+				for (i = 0; i < 8; i++)
+					pmac->u[i] |= key->md.digest[i] & mask;
+
+				memset(data, 0, SM3_BLOCK_SIZE);
+				j += 64;
+			}
+			data->u[SM3_BLOCK_SIZE / 4 - 1] = bitlen;
+			sm3_compress(key->md.digest, data->c);
+			mask = 0 - ((j - inp_len - 73) >> (sizeof(j) * 8 - 1));
+			for (i = 0; i < 8; i++)
+				pmac->u[i] |= key->md.digest[i] & mask;
+
+			for (i = 0; i < 8; i++) {
+				res = pmac->u[i];
+				pmac->c[4 * i + 0] = (unsigned char)(res >> 24);
+				pmac->c[4 * i + 1] = (unsigned char)(res >> 16);
+				pmac->c[4 * i + 2] = (unsigned char)(res >> 8);
+				pmac->c[4 * i + 3] = (unsigned char)res;
+			}
+			len += SM3_DIGEST_LENGTH;
+
+			key->md = key->tail;
+			sm3_update(&key->md, pmac->c, SM3_DIGEST_LENGTH);
+			sm3_final(&key->md, pmac->c);
+
+			/* verify HMAC and padding */
+			out += inp_len;
+			len -= inp_len;
+			{
+				unsigned char *p =
+					out + len - 1 - maxpad - SM3_DIGEST_LENGTH;
+				size_t off = out - p;
+				unsigned int c, cmask;
+
+				maxpad += SM3_DIGEST_LENGTH;
+				for (res = 0, i = 0, j = 0; j < maxpad; j++) {
+					c = p[j];
+					cmask = ((int)(j - off - SM3_DIGEST_LENGTH)) >>
+						(sizeof(int) * 8 - 1);
+					res |= (c ^ pad) & ~cmask; /* ... and padding */
+					cmask &= ((int)(off - 1 - j)) >> (sizeof(int) * 8 - 1);
+					res |= (c ^ pmac->c[i]) & cmask;
+					i += 1 & cmask;
+				}
+				maxpad -= SM3_DIGEST_LENGTH;
+
+				res = 0 - ((0 - res) >> (sizeof(res) * 8 - 1));
+				ret &= (int)~res;
+			}
+			return ret;
+		} else {
+			sm3_update(&key->md, out, len);
+		}
+	}
+
+	return 1;
+}
+
+static int sms4_cbc_hmac_sm3_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg,
+	void *ptr)
+{
+	EVP_SMS4_HMAC_SM3 *key = data(ctx);
+
+	switch (type) {
+	case EVP_CTRL_AEAD_SET_MAC_KEY:
+		{
+			unsigned int i;
+			unsigned char hmac_key[64];
+
+			memset(hmac_key, 0, sizeof(hmac_key));
+
+			if (arg > (int)sizeof(hmac_key)) {
+				sm3_init(&key->head);
+				sm3_update(&key->head, ptr, arg);
+				sm3_final(&key->head, hmac_key);
+			} else {
+				memcpy(hmac_key, ptr, arg);
+			}
+
+			for (i = 0; i < sizeof(hmac_key); i++)
+				hmac_key[i] ^= 0x36; /* ipad */
+			sm3_init(&key->head);
+			sm3_update(&key->head, hmac_key, sizeof(hmac_key));
+
+			for (i = 0; i < sizeof(hmac_key); i++)
+				hmac_key[i] ^= 0x36 ^ 0x5c; /* opad */
+			sm3_init(&key->tail);
+			sm3_update(&key->tail, hmac_key, sizeof(hmac_key));
+
+			OPENSSL_cleanse(hmac_key, sizeof(hmac_key));
+
+			return 1;
+		}
+
+	case EVP_CTRL_AEAD_TLS1_AAD:
+		{
+			unsigned char *p = ptr;
+			unsigned int len;
+
+			if (arg != EVP_AEAD_TLS1_AAD_LEN)
+				return -1;
+
+			len = p[arg - 2] << 8 | p[arg - 1];
+
+			if (ctx->encrypt) {
+				key->payload_length = len;
+				if ((key->aux.tls_ver =
+					p[arg - 4] << 8 | p[arg - 3]) >= TLS1_1_VERSION) {
+					len -= SMS4_BLOCK_SIZE;
+					p[arg - 2] = len >> 8;
+					p[arg - 1] = len;
+				}
+				key->md = key->head;
+				sm3_update(&key->md, p, arg);
+
+				return (int)(((len + SM3_DIGEST_LENGTH +
+					SMS4_BLOCK_SIZE) & -SMS4_BLOCK_SIZE) - len);
+			} else {
+				memcpy(key->aux.tls_aad, ptr, arg);
+				key->payload_length = arg;
+
+				return SM3_DIGEST_LENGTH;
+			}
+		}
+
+#if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_MAX_BUFSIZE:
+		return (int)(5 + 16 + ((arg + 32 + 16) & -16));
+
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_AAD:
+		{
+			EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *param =
+				(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *)ptr;
+			unsigned int n4x = 1, x4;
+			unsigned int frag, last, packlen, inp_len;
+
+			if (arg < (int)sizeof(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM))
+				return -1;
+
+			inp_len = param->inp[11] << 8 | param->inp[12];
+
+			if (!ctx->encrypt)
+				return -1; /* not yet */
+
+			if ((param->inp[9] << 8 | param->inp[10]) < TLS1_1_VERSION)
+				return -1;
+
+			if (inp_len) {
+				if (inp_len < 4096)
+					return 0; /* too short */
+				if (inp_len >= 8192)
+					n4x = 2;
+			} else if ((n4x = param->interleave / 4) && n4x <= 2)
+				inp_len = param->len;
+			else
+				return -1;
+
+			key->md = key->head;
+			sm3_update(&key->md, param->inp, 13);
+
+			x4 = 4 * n4x;
+			n4x += 1;
+
+			frag = inp_len >> n4x;
+			last = inp_len + frag - (frag << n4x);
+			if (last > frag && ((last + 13 + 9) % 64 < (x4 - 1))) {
+				frag++;
+				last -= x4 - 1;
+			}
+
+			packlen = 5 + 16 + ((frag + 32 + 16) & -16);
+			packlen = (packlen << n4x) - packlen;
+			packlen += 5 + 16 + ((last + 32 + 16) & -16);
+
+			param->interleave = x4;
+
+			return (int)packlen;
+		}
+
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_ENCRYPT:
+		{
+			EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *param =
+				(EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM *)ptr;
+
+			return (int)tls1_1_multi_block_encrypt(key, param->out,
+				param->inp, param->len, param->interleave / 4);
+		}
+
+	case EVP_CTRL_TLS1_1_MULTIBLOCK_DECRYPT:
+#endif
+	default:
+		return -1;
+	}
+}
+
+static const EVP_CIPHER sms4_cbc_hmac_sm3 = {
+	NID_sms4_cbc_hmac_sm3,
+	SMS4_BLOCK_SIZE,
+	SMS4_KEY_LENGTH,
+	SMS4_BLOCK_SIZE,
+	EVP_CIPH_CBC_MODE | EVP_CIPH_FLAG_DEFAULT_ASN1 |
+		EVP_CIPH_FLAG_AEAD_CIPHER | EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK,
+	sms4_cbc_hmac_sm3_init_key,
+	sms4_cbc_hmac_sm3_cipher,
+	NULL, /* cleanup() */
+	sizeof(EVP_SMS4_HMAC_SM3),
+	NULL, /* set_asn1_parameters() */
+	NULL, /* get_asn1_parameters() */
+	sms4_cbc_hmac_sm3_ctrl,
+	NULL  /* app_data */
+};
+
+const EVP_CIPHER *EVP_sms4_cbc_hmac_sm3(void)
+{
+	return &sms4_cbc_hmac_sm3;
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <string.h>
 #include "cryptlib.h"
 
 #ifndef OPENSSL_NO_ZUC
@@ -7,40 +8,83 @@
 #include "evp_locl.h"
 #include <openssl/objects.h>
 #include <openssl/zuc.h>
+#include "../modes/modes_lcl.h"
 
 
 static int zuc_init(EVP_CIPHER_CTX *ctx, const unsigned char *key,
 	const unsigned char *iv, int enc)
 {
-	ZUC_set_key((ZUC_KEY *)&ctx->cipher_data, key, iv);
+	ZUC_set_key((ZUC_KEY *)ctx->cipher_data, key, iv);
 	return 1;
 }
 
 static int zuc_do_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
 	const unsigned char *in, size_t inlen)
 {
-	ZUC_encrypt((ZUC_KEY *)&ctx->cipher_data, inlen, in, out);
+	ZUC_encrypt((ZUC_KEY *)ctx->cipher_data, inlen, in, out);
 	return 1;
 }
 
-
 /*
- * FIXME:
- * evp_enc.c assert block_size in {1, 8, 16}, 4 not ok!
+ * batch do_cipher() of zuc, zuc-128-eea3 and zuc-256, the ZUC_KEY is at
+ * the start of the cipher data of all of them. Bit lengths of 128-EEA3
+ * are left to the single call.
  */
+static int zuc_do_cipher_mb(EVP_CIPHER_CTX *ctx[], unsigned char *out[],
+	const unsigned char *in[], const size_t len[], size_t n)
+{
+	ZUC_KEY *ks[ZUC_MB_LANES];
+	const unsigned char *pin[ZUC_MB_LANES];
+	unsigned char *pout[ZUC_MB_LANES];
+	size_t plen[ZUC_MB_LANES];
+	size_t i;
+	int lanes = 0;
+
+	for (i = 0; i < n; i++) {
+		if (ctx[i]->flags & EVP_CIPH_FLAG_LENGTH_BITS) {
+			if (!ctx[i]->cipher->do_cipher(ctx[i], out[i], in[i], len[i]))
+				return 0;
+			continue;
+		}
+		ks[lanes] = (ZUC_KEY *)ctx[i]->cipher_data;
+		pin[lanes] = in[i];
+		pout[lanes] = out[i];
+		plen[lanes++] = len[i];
+		if (lanes == ZUC_MB_LANES) {
+			ZUC_encrypt_mb(ks, plen, pin, pout, lanes);
+			lanes = 0;
+		}
+	}
+	if (lanes)
+		ZUC_encrypt_mb(ks, plen, pin, pout, lanes);
+	return 1;
+}
+
+static int zuc_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	switch (type) {
+	case EVP_CTRL_GET_CIPHER_MB:
+		*(EVP_CIPHER_MB_FUNC *)ptr = zuc_do_cipher_mb;
+		return 1;
+	default:
+		return -1;
+	}
+}
+
+/* a stream cipher, ZUC_encrypt() buffers the unused keystream bytes */
 static const EVP_CIPHER zuc_cipher = {
 	NID_zuc, /* nid */
-	4, /* block_size */
+	1, /* block_size */
 	16, /* key_len */
 	16, /* iv_len */
-	0, /* flags */
+	EVP_CIPH_FLAG_MULTI_BUFFER, /* flags */
 	zuc_init, /* init() */
 	zuc_do_cipher, /* do_cipher() */
 	NULL, /* cleanup() */
 	sizeof(ZUC_KEY), /* ctx_size */
 	NULL, /* set_asn1_parameters() */
 	NULL, /* get_asn1_parameters() */
-	NULL, /* ctrl() */
+	zuc_ctrl, /* ctrl() */
 	NULL /* app_data */
 };
 
@@ -49,5 +93,192 @@ const EVP_CIPHER *EVP_zuc(void)
 	return &zuc_cipher;
 }
 
+/*
+ * the key is kept until an iv is given, key and iv may be set in
+ * separate init calls. The ZUC-256 iv does not fit in ctx->iv
+ * (EVP_MAX_IV_LENGTH), it is kept here.
+ */
+typedef struct {
+	ZUC_KEY ks;
+	unsigned char key[32];
+	int key_set;
+	unsigned char iv[ZUC256_IV_LENGTH];
+	int ivlen;
+} EVP_ZUC_CTX;
+
+static int zuc_key_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	EVP_ZUC_CTX *zctx = (EVP_ZUC_CTX *)ctx->cipher_data;
+
+	switch (type) {
+	case EVP_CTRL_INIT:
+		zctx->key_set = 0;
+		return 1;
+	case EVP_CTRL_GET_CIPHER_MB:
+		*(EVP_CIPHER_MB_FUNC *)ptr = zuc_do_cipher_mb;
+		return 1;
+	default:
+		return -1;
+	}
+}
+
+static int zuc_key_cleanup(EVP_CIPHER_CTX *ctx)
+{
+	OPENSSL_cleanse(ctx->cipher_data, sizeof(EVP_ZUC_CTX));
+	return 1;
+}
+
+/*
+ * 128-EEA3, the 5 byte iv is COUNT (big endian) || BEARER << 3 |
+ * DIRECTION << 2, the first bytes of the 3GPP iv. With
+ * EVP_CIPH_FLAG_LENGTH_BITS set lengths are in bits, only the last call
+ * of a message may then end inside a byte.
+ */
+
+static int zuc_eea3_init(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+	const unsigned char *iv, int enc)
+{
+	EVP_ZUC_CTX *zctx = (EVP_ZUC_CTX *)ctx->cipher_data;
+
+	if (key) {
+		memcpy(zctx->key, key, ctx->key_len);
+		zctx->key_set = 1;
+	}
+	if (iv)
+		memcpy(ctx->iv, iv, ctx->cipher->iv_len);
+	if (zctx->key_set && (key || iv))
+		ZUC_eea3_set_key(&zctx->ks, zctx->key, GETU32(ctx->iv),
+			ctx->iv[4] >> 3, (ctx->iv[4] >> 2) & 1);
+	return 1;
+}
+
+static int zuc_eea3_do_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen)
+{
+	EVP_ZUC_CTX *zctx = (EVP_ZUC_CTX *)ctx->cipher_data;
+	size_t nbits, len;
+
+	if (!(ctx->flags & EVP_CIPH_FLAG_LENGTH_BITS)) {
+		ZUC_encrypt(&zctx->ks, inlen, in, out);
+		return 1;
+	}
+
+	nbits = inlen;
+	len = (nbits + 7) / 8;
+	ZUC_encrypt(&zctx->ks, len, in, out);
+	if (nbits % 8)
+		out[len - 1] &= (unsigned char)(0xFF << (8 - nbits % 8));
+	return 1;
+}
+
+static const EVP_CIPHER zuc_eea3_cipher = {
+	NID_zuc_128_eea3, /* nid */
+	1, /* block_size */
+	16, /* key_len */
+	5, /* iv_len */
+	EVP_CIPH_ALWAYS_CALL_INIT|EVP_CIPH_CUSTOM_IV|EVP_CIPH_CTRL_INIT|
+		EVP_CIPH_FLAG_MULTI_BUFFER, /* flags */
+	zuc_eea3_init, /* init() */
+	zuc_eea3_do_cipher, /* do_cipher() */
+	zuc_key_cleanup, /* cleanup() */
+	sizeof(EVP_ZUC_CTX), /* ctx_size */
+	NULL, /* set_asn1_parameters() */
+	NULL, /* get_asn1_parameters() */
+	zuc_key_ctrl, /* ctrl() */
+	NULL /* app_data */
+};
+
+const EVP_CIPHER *EVP_zuc_eea3(void)
+{
+	return &zuc_eea3_cipher;
+}
+
+/*
+ * ZUC-256 as a stream cipher, the keystream not used by a call is kept
+ * in the key (at most 64 bytes), in place operation is allowed. The 23
+ * byte iv is longer than EVP_MAX_IV_LENGTH, so iv_len can not give it.
+ * The caller sets it with EVP_CTRL_ZUC256_SET_IVLEN before the iv is
+ * given, an iv without it is refused rather than read past a buffer
+ * sized by EVP_CIPHER_iv_length():
+ *
+ *	EVP_EncryptInit_ex(ctx, EVP_zuc256(), NULL, NULL, NULL);
+ *	EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_ZUC256_SET_IVLEN,
+ *		ZUC256_IV_LENGTH, NULL);
+ *	EVP_EncryptInit_ex(ctx, NULL, NULL, key, iv);
+ */
+static int zuc256_init(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+	const unsigned char *iv, int enc)
+{
+	EVP_ZUC_CTX *zctx = (EVP_ZUC_CTX *)ctx->cipher_data;
+
+	if (iv && zctx->ivlen != ZUC256_IV_LENGTH) {
+		EVPerr(EVP_F_ZUC256_INIT, EVP_R_ZUC256_IV_LENGTH_NOT_SET);
+		return 0;
+	}
+	if (key) {
+		memcpy(zctx->key, key, ctx->key_len);
+		zctx->key_set = 1;
+	}
+	if (iv)
+		memcpy(zctx->iv, iv, ZUC256_IV_LENGTH);
+	if (zctx->key_set && (key || iv))
+		ZUC256_set_key(&zctx->ks, zctx->key, zctx->iv);
+	return 1;
+}
+
+static int zuc256_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg, void *ptr)
+{
+	EVP_ZUC_CTX *zctx = (EVP_ZUC_CTX *)ctx->cipher_data;
+
+	switch (type) {
+	case EVP_CTRL_INIT:
+		zctx->key_set = 0;
+		zctx->ivlen = 0;
+		memset(zctx->iv, 0, sizeof(zctx->iv));
+		return 1;
+	case EVP_CTRL_ZUC256_SET_IVLEN:
+		if (arg != ZUC256_IV_LENGTH)
+			return 0;
+		zctx->ivlen = arg;
+		return 1;
+	case EVP_CTRL_ZUC256_GET_IVLEN:
+		*(int *)ptr = ZUC256_IV_LENGTH;
+		return 1;
+	default:
+		return zuc_key_ctrl(ctx, type, arg, ptr);
+	}
+}
+
+static int zuc256_do_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen)
+{
+	EVP_ZUC_CTX *zctx = (EVP_ZUC_CTX *)ctx->cipher_data;
+
+	ZUC_encrypt(&zctx->ks, inlen, in, out);
+	return 1;
+}
+
+static const EVP_CIPHER zuc256_cipher = {
+	NID_zuc_256, /* nid */
+	1, /* block_size */
+	32, /* key_len */
+	EVP_MAX_IV_LENGTH, /* iv_len, the real one by ctrl, see above */
+	EVP_CIPH_ALWAYS_CALL_INIT|EVP_CIPH_CUSTOM_IV|EVP_CIPH_CTRL_INIT|
+		EVP_CIPH_FLAG_MULTI_BUFFER, /* flags */
+	zuc256_init, /* init() */
+	zuc256_do_cipher, /* do_cipher() */
+	zuc_key_cleanup, /* cleanup() */
+	sizeof(EVP_ZUC_CTX), /* ctx_size */
+	NULL, /* set_asn1_parameters() */
+	NULL, /* get_asn1_parameters() */
+	zuc256_ctrl, /* ctrl() */
+	NULL /* app_data */
+};
+
+const EVP_CIPHER *EVP_zuc256(void)
+{
+	return &zuc256_cipher;
+}
+
 #endif
 
@@ -235,6 +235,12 @@ typedef int evp_verify_method(int type, const unsigned char *m,
 
 #  define EVP_MD_CTRL_ALG_CTRL                    0x1000
 
+/*
+ * sm3-tree leaf size (*(size_t *)p2, NULL for the default) and number of
+ * threads (p1, 0 for the default), only before any data is digested
+ */
+#  define EVP_MD_CTRL_SM3_TREE_PARAMS     (EVP_MD_CTRL_ALG_CTRL + 0x1)
+
 #  define EVP_PKEY_NULL_method    NULL,NULL,{0,0,0,0}
 
 #  ifndef OPENSSL_NO_DSA
@@ -390,6 +396,8 @@ struct evp_cipher_st {
 # define         EVP_CIPH_FLAG_CUSTOM_CIPHER     0x100000
 # define         EVP_CIPH_FLAG_AEAD_CIPHER       0x200000
 # define         EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK 0x400000
+/* Cipher hands out a do_cipher() of n contexts with EVP_CTRL_GET_CIPHER_MB */
+# define         EVP_CIPH_FLAG_MULTI_BUFFER      0x800000
 
 /*
  * Cipher context flag to indicate we can handle wrap mode: if allowed in
@@ -434,6 +442,16 @@ struct evp_cipher_st {
 # define         EVP_CTRL_TLS1_1_MULTIBLOCK_ENCRYPT      0x1a
 # define         EVP_CTRL_TLS1_1_MULTIBLOCK_DECRYPT      0x1b
 # define         EVP_CTRL_TLS1_1_MULTIBLOCK_MAX_BUFSIZE  0x1c
+/* Take SMS4 key schedules from an SMS4_KEY_CACHE */
+# define         EVP_CTRL_SMS4_SET_KEY_CACHE     0x1d
+/* ptr is an EVP_CIPHER_MB_FUNC *, see EVP_CIPHER_CTX_batch_update() */
+# define         EVP_CTRL_GET_CIPHER_MB          0x1e
+/*
+ * The 23 byte ZUC-256 iv is longer than EVP_MAX_IV_LENGTH, its length is
+ * set before the iv is given and read back by these
+ */
+# define         EVP_CTRL_ZUC256_SET_IVLEN       0x1f
+# define         EVP_CTRL_ZUC256_GET_IVLEN       0x20
 
 /* RFC 5246 defines additional data to be 13 bytes in length */
 # define         EVP_AEAD_TLS1_AAD_LEN           13
@@ -445,6 +463,11 @@ typedef struct {
     unsigned int interleave;
 } EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM;
 
+/* do_cipher() of n distinct contexts of one cipher in one call */
+typedef int (*EVP_CIPHER_MB_FUNC) (EVP_CIPHER_CTX *ctx[], unsigned char *out[],
+                                   const unsigned char *in[],
+                                   const size_t inl[], size_t n);
+
 /* GCM TLS constants */
 /* Length of fixed part of IV derived from PRF */
 # define EVP_GCM_TLS_FIXED_IV_LEN                        4
@@ -605,6 +628,9 @@ int EVP_MD_CTX_cleanup(EVP_MD_CTX *ctx);
 EVP_MD_CTX *EVP_MD_CTX_create(void);
 void EVP_MD_CTX_destroy(EVP_MD_CTX *ctx);
 int EVP_MD_CTX_copy_ex(EVP_MD_CTX *out, const EVP_MD_CTX *in);
+/* restart the digest of ctx, nothing is freed or allocated */
+int EVP_MD_CTX_reinit(EVP_MD_CTX *ctx);
+int EVP_MD_CTX_ctrl(EVP_MD_CTX *ctx, int cmd, int p1, void *p2);
 void EVP_MD_CTX_set_flags(EVP_MD_CTX *ctx, int flags);
 void EVP_MD_CTX_clear_flags(EVP_MD_CTX *ctx, int flags);
 int EVP_MD_CTX_test_flags(const EVP_MD_CTX *ctx, int flags);
@@ -614,6 +640,9 @@ int EVP_DigestFinal_ex(EVP_MD_CTX *ctx, unsigned char *md, unsigned int *s);
 int EVP_Digest(const void *data, size_t count,
                unsigned char *md, unsigned int *size, const EVP_MD *type,
                ENGINE *impl);
+int EVP_Digest_mb(const void *data[], const size_t count[],
+                  unsigned char *md[], size_t n, const EVP_MD *type,
+                  ENGINE *impl);
 
 int EVP_MD_CTX_copy(EVP_MD_CTX *out, const EVP_MD_CTX *in);
 int EVP_DigestInit(EVP_MD_CTX *ctx, const EVP_MD *type);
@@ -664,6 +693,9 @@ int EVP_CipherUpdate(EVP_CIPHER_CTX *ctx, unsigned char *out, int *outl,
                      const unsigned char *in, int inl);
 int EVP_CipherFinal(EVP_CIPHER_CTX *ctx, unsigned char *outm, int *outl);
 int EVP_CipherFinal_ex(EVP_CIPHER_CTX *ctx, unsigned char *outm, int *outl);
+int EVP_CIPHER_CTX_batch_update(EVP_CIPHER_CTX *ctx[], unsigned char *out[],
+                                int outl[], const unsigned char *in[],
+                                const int inl[], size_t n);
 
 int EVP_SignFinal(EVP_MD_CTX *ctx, unsigned char *md, unsigned int *s,
                   EVP_PKEY *pkey);
@@ -758,6 +790,7 @@ const EVP_MD *EVP_whirlpool(void);
 # endif
 # ifndef OPENSSL_NO_SM3
 const EVP_MD *EVP_sm3(void);
+const EVP_MD *EVP_sm3_tree(void);
 # endif
 const EVP_CIPHER *EVP_enc_null(void); /* does nothing :-) */
 # ifndef OPENSSL_NO_DES
@@ -858,6 +891,7 @@ const EVP_CIPHER *EVP_sms4_ccm(void);
 const EVP_CIPHER *EVP_sms4_gcm(void);
 const EVP_CIPHER *EVP_sms4_xts(void);
 const EVP_CIPHER *EVP_sms4_wrap(void);
+const EVP_CIPHER *EVP_sms4_cbc_hmac_sm3(void);
 #define EVP_sm4_ecb EVP_sms4_ecb
 #define EVP_sm4_cbc EVP_sms4_cbc
 #define EVP_sm4_cfb EVP_sms4_cfb
@@ -865,6 +899,8 @@ const EVP_CIPHER *EVP_sms4_wrap(void);
 #endif
 #ifndef OPENSSL_NO_ZUC
 const EVP_CIPHER *EVP_zuc(void);
+const EVP_CIPHER *EVP_zuc_eea3(void);
+const EVP_CIPHER *EVP_zuc256(void);
 #endif
 # ifndef OPENSSL_NO_AES
 const EVP_CIPHER *EVP_aes_128_ecb(void);
@@ -1444,6 +1480,7 @@ void ERR_load_EVP_strings(void);
 # define EVP_F_EVP_DIGESTINIT_EX                          128
 # define EVP_F_EVP_ENCRYPTFINAL_EX                        127
 # define EVP_F_EVP_MD_CTX_COPY_EX                         110
+# define EVP_F_EVP_MD_CTX_REINIT                          180
 # define EVP_F_EVP_MD_SIZE                                162
 # define EVP_F_EVP_OPENINIT                               102
 # define EVP_F_EVP_PBE_ALG_ADD                            115
@@ -1503,6 +1540,7 @@ void ERR_load_EVP_strings(void);
 # ifndef OPENSSL_NO_GMSSL
 #  define EVP_F_EVP_ENCRYPT_EX				  200
 #  define EVP_F_EVP_DECRYPT_EX				  201
+#  define EVP_F_ZUC256_INIT				  202
 # endif
 
 /* Reason codes. */
@@ -1578,6 +1616,10 @@ void ERR_load_EVP_strings(void);
 # define EVP_R_WRONG_FINAL_BLOCK_LENGTH                   109
 # define EVP_R_WRONG_PUBLIC_KEY_TYPE                      110
 
+# ifndef OPENSSL_NO_GMSSL
+#  define EVP_R_ZUC256_IV_LENGTH_NOT_SET			  200
+# endif
+
 #ifdef  __cplusplus
 }
 #endif
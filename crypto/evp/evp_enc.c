@@ -103,6 +103,9 @@ int EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
                       ENGINE *impl, const unsigned char *key,
                       const unsigned char *iv, int enc)
 {
+    void *cipher_data = NULL;
+    int cipher_data_size = 0;
+
     if (enc == -1)
         enc = ctx->encrypt;
     else {
@@ -131,6 +134,20 @@ int EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
          */
         if (ctx->cipher) {
             unsigned long flags = ctx->flags;
+            /*
+             * Keep the cipher_data block of the same cipher for the new
+             * key instead of freeing it and allocating it again.
+             */
+            if (ctx->cipher == cipher && cipher->ctx_size
+                && ctx->cipher_data) {
+                if (cipher->cleanup && !cipher->cleanup(ctx))
+                    return 0;
+                OPENSSL_cleanse(ctx->cipher_data, cipher->ctx_size);
+                cipher_data = ctx->cipher_data;
+                cipher_data_size = cipher->ctx_size;
+                ctx->cipher_data = NULL;
+                ctx->cipher = NULL;
+            }
             EVP_CIPHER_CTX_cleanup(ctx);
             /* Restore encrypt and flags */
             ctx->encrypt = enc;
@@ -140,6 +157,8 @@ int EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
         if (impl) {
             if (!ENGINE_init(impl)) {
                 EVPerr(EVP_F_EVP_CIPHERINIT_EX, EVP_R_INITIALIZATION_ERROR);
+                if (cipher_data)
+                    OPENSSL_free(cipher_data);
                 return 0;
             }
         } else
@@ -155,6 +174,8 @@ int EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
                  * mispellings of "initialisation"?
                  */
                 EVPerr(EVP_F_EVP_CIPHERINIT_EX, EVP_R_INITIALIZATION_ERROR);
+                if (cipher_data)
+                    OPENSSL_free(cipher_data);
                 return 0;
             }
             /* We'll use the ENGINE's private cipher definition */
@@ -175,17 +196,29 @@ int EVP_CipherInit_ex(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
                 fcipher = evp_get_fips_cipher(cipher);
             if (fcipher)
                 cipher = fcipher;
+            if (cipher_data)
+                OPENSSL_free(cipher_data);
             return FIPS_cipherinit(ctx, cipher, key, iv, enc);
         }
 #endif
         ctx->cipher = cipher;
+        if (cipher_data && ctx->cipher->ctx_size > cipher_data_size) {
+            /* an ENGINE gave another cipher */
+            OPENSSL_free(cipher_data);
+            cipher_data = NULL;
+        }
         if (ctx->cipher->ctx_size) {
-            ctx->cipher_data = OPENSSL_malloc(ctx->cipher->ctx_size);
+            if (cipher_data)
+                ctx->cipher_data = cipher_data;
+            else
+                ctx->cipher_data = OPENSSL_malloc(ctx->cipher->ctx_size);
             if (!ctx->cipher_data) {
                 EVPerr(EVP_F_EVP_CIPHERINIT_EX, ERR_R_MALLOC_FAILURE);
                 return 0;
             }
         } else {
+            if (cipher_data)
+                OPENSSL_free(cipher_data);
             ctx->cipher_data = NULL;
         }
         ctx->key_len = cipher->key_len;
@@ -292,6 +325,90 @@ int EVP_CipherFinal(EVP_CIPHER_CTX *ctx, unsigned char *out, int *outl)
         return EVP_DecryptFinal(ctx, out, outl);
 }
 
+/*
+ * EVP_CipherUpdate() of n distinct contexts. Contexts of the cipher of
+ * the first one that is EVP_CIPH_FLAG_MULTI_BUFFER and has nothing
+ * buffered are handed together to the function it gives for
+ * EVP_CTRL_GET_CIPHER_MB, up to EVP_BATCH_CHUNK at a time, the block
+ * aligned part of their input that is. The others go through
+ * EVP_CipherUpdate(). On error outl[] is undefined.
+ */
+#define EVP_BATCH_CHUNK 64
+
+static int evp_batchable(const EVP_CIPHER_CTX *ctx, int inl)
+{
+    if (!(ctx->cipher->flags & EVP_CIPH_FLAG_MULTI_BUFFER)
+        || (ctx->cipher->flags & EVP_CIPH_FLAG_CUSTOM_CIPHER)
+        || ctx->buf_len != 0 || inl <= (int)ctx->block_mask)
+        return 0;
+    /* EVP_DecryptUpdate() keeps back the last block */
+    return ctx->encrypt || (ctx->flags & EVP_CIPH_NO_PADDING)
+        || !ctx->final_used;
+}
+
+int EVP_CIPHER_CTX_batch_update(EVP_CIPHER_CTX *ctx[], unsigned char *out[],
+                                int outl[], const unsigned char *in[],
+                                const int inl[], size_t n)
+{
+    EVP_CIPHER_CTX *bctx[EVP_BATCH_CHUNK];
+    unsigned char *bout[EVP_BATCH_CHUNK];
+    const unsigned char *bin[EVP_BATCH_CHUNK];
+    size_t blen[EVP_BATCH_CHUNK], idx[EVP_BATCH_CHUNK];
+    const EVP_CIPHER *cipher = NULL;
+    EVP_CIPHER_MB_FUNC do_cipher_mb = NULL;
+    EVP_CIPHER_CTX *c;
+    size_t i, j, m;
+    int b, len, tail;
+
+    for (i = 0; i < n; i += m) {
+        m = n - i < EVP_BATCH_CHUNK ? n - i : EVP_BATCH_CHUNK;
+
+        for (j = 0, len = 0; j < m; j++) {
+            c = ctx[i + j];
+            if (cipher == NULL && evp_batchable(c, inl[i + j])
+                && c->cipher->ctrl != NULL
+                && c->cipher->ctrl(c, EVP_CTRL_GET_CIPHER_MB, 0,
+                                   &do_cipher_mb) > 0)
+                cipher = c->cipher;
+            if (cipher != NULL && c->cipher == cipher
+                && evp_batchable(c, inl[i + j])) {
+                bctx[len] = c;
+                bout[len] = out[i + j];
+                bin[len] = in[i + j];
+                blen[len] = inl[i + j] - (inl[i + j] & c->block_mask);
+                idx[len++] = i + j;
+            } else if (!EVP_CipherUpdate(c, out[i + j], &outl[i + j],
+                                         in[i + j], inl[i + j]))
+                return 0;
+        }
+        if (len == 0)
+            continue;
+
+        if (!do_cipher_mb(bctx, bout, bin, blen, len))
+            return 0;
+
+        /* what EVP_EncryptUpdate() and EVP_DecryptUpdate() do afterwards */
+        for (j = 0; j < (size_t)len; j++) {
+            c = bctx[j];
+            b = c->cipher->block_size;
+            tail = inl[idx[j]] - (int)blen[j];
+            if (tail)
+                memcpy(c->buf, bin[j] + blen[j], tail);
+            c->buf_len = tail;
+            outl[idx[j]] = (int)blen[j];
+            if (c->encrypt || (c->flags & EVP_CIPH_NO_PADDING))
+                continue;
+            if (b > 1 && !c->buf_len) {
+                outl[idx[j]] -= b;
+                c->final_used = 1;
+                memcpy(c->final, bout[j] + outl[idx[j]], b);
+            } else
+                c->final_used = 0;
+        }
+    }
+    return 1;
+}
+
 int EVP_EncryptInit(EVP_CIPHER_CTX *ctx, const EVP_CIPHER *cipher,
                     const unsigned char *key, const unsigned char *iv)
 {
@@ -95,6 +95,7 @@ static ERR_STRING_DATA EVP_str_functs[] = {
     {ERR_FUNC(EVP_F_EVP_DIGESTINIT_EX), "EVP_DigestInit_ex"},
     {ERR_FUNC(EVP_F_EVP_ENCRYPTFINAL_EX), "EVP_EncryptFinal_ex"},
     {ERR_FUNC(EVP_F_EVP_MD_CTX_COPY_EX), "EVP_MD_CTX_copy_ex"},
+    {ERR_FUNC(EVP_F_EVP_MD_CTX_REINIT), "EVP_MD_CTX_reinit"},
     {ERR_FUNC(EVP_F_EVP_MD_SIZE), "EVP_MD_size"},
     {ERR_FUNC(EVP_F_EVP_OPENINIT), "EVP_OpenInit"},
     {ERR_FUNC(EVP_F_EVP_PBE_ALG_ADD), "EVP_PBE_alg_add"},
@@ -155,6 +156,7 @@ static ERR_STRING_DATA EVP_str_functs[] = {
 #ifndef OPENSSL_NO_GMSSL
     {ERR_FUNC(EVP_F_EVP_ENCRYPT_EX), "EVP_Encrypt_ex"},
     {ERR_FUNC(EVP_F_EVP_DECRYPT_EX), "EVP_Decrypt_ex"},
+    {ERR_FUNC(EVP_F_ZUC256_INIT), "ZUC256_INIT"},
 #endif
     {0, NULL}
 };
@@ -241,6 +243,9 @@ static ERR_STRING_DATA EVP_str_reasons[] = {
     {ERR_REASON(EVP_R_WRAP_MODE_NOT_ALLOWED), "wrap mode not allowed"},
     {ERR_REASON(EVP_R_WRONG_FINAL_BLOCK_LENGTH), "wrong final block length"},
     {ERR_REASON(EVP_R_WRONG_PUBLIC_KEY_TYPE), "wrong public key type"},
+#ifndef OPENSSL_NO_GMSSL
+    {ERR_REASON(EVP_R_ZUC256_IV_LENGTH_NOT_SET), "zuc256 iv length not set"},
+#endif
     {0, NULL}
 };
 
@@ -95,4 +95,89 @@ const EVP_MD *EVP_sm3(void)
         return &sm3_md;
 }
 
+/* md_data is zeroed when allocated, a reused one has its buffer freed */
+static int tree_init(EVP_MD_CTX *ctx)
+{
+	return sm3_tree_init(ctx->md_data, 0, 0);
+}
+
+static int tree_update(EVP_MD_CTX *ctx, const void *in, size_t inlen)
+{
+	return sm3_tree_update(ctx->md_data, in, inlen);
+}
+
+static int tree_final(EVP_MD_CTX *ctx, unsigned char *md)
+{
+	return sm3_tree_final(ctx->md_data, md);
+}
+
+static int tree_copy(EVP_MD_CTX *to, const EVP_MD_CTX *from)
+{
+	sm3_tree_ctx_t *dst = to->md_data;
+	const sm3_tree_ctx_t *src = from->md_data;
+
+	unsigned char *buf = NULL;
+
+	/*
+	 * md_data is already copied, only the leaf buffer is shared. On
+	 * failure dst is left empty so that it never refers to src->buf.
+	 */
+	if (src->buf &&
+		!(buf = OPENSSL_malloc(src->leaf_size * src->nthreads))) {
+		dst->buf = NULL;
+		dst->num = 0;
+		dst->nleaves = 0;
+		dst->depth = 0;
+		return 0;
+	}
+	if (buf)
+		memcpy(buf, src->buf, src->num);
+	dst->buf = buf;
+	return 1;
+}
+
+static int tree_ctrl(EVP_MD_CTX *ctx, int cmd, int p1, void *p2)
+{
+	sm3_tree_ctx_t *tctx = ctx->md_data;
+
+	if (cmd != EVP_MD_CTRL_SM3_TREE_PARAMS)
+		return -2;
+	if (tctx->nleaves || tctx->num)
+		return 0;
+	sm3_tree_cleanup(tctx);
+	return sm3_tree_init(tctx, p2 ? *(size_t *)p2 : 0, p1);
+}
+
+static int tree_cleanup(EVP_MD_CTX *ctx)
+{
+	if (ctx->md_data)
+		sm3_tree_cleanup(ctx->md_data);
+	return 1;
+}
+
+/*
+ * leaves of SM3_TREE_DEFAULT_LEAF_SIZE bytes and one thread per online
+ * processor, EVP_MD_CTRL_SM3_TREE_PARAMS changes them for one context
+ */
+static const EVP_MD sm3_tree_md = {
+        NID_sm3_tree,
+        NID_undef,
+        SM3_DIGEST_LENGTH,
+        0,
+        tree_init,
+        tree_update,
+        tree_final,
+        tree_copy,
+        tree_cleanup,
+        EVP_PKEY_NULL_method,
+        SM3_BLOCK_SIZE,
+        sizeof(EVP_MD *) + sizeof(sm3_tree_ctx_t),
+        tree_ctrl,
+};
+
+const EVP_MD *EVP_sm3_tree(void)
+{
+        return &sm3_tree_md;
+}
+
 #endif
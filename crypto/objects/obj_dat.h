@@ -62,9 +62,9 @@
  * [including the GNU Public Licence.]
  */
 
-#define NUM_NID 1034
-#define NUM_SN 1012
-#define NUM_LN 1012
+#define NUM_NID 1037
+#define NUM_SN 1016
+#define NUM_LN 1016
 #define NUM_OBJ 950
 
 static const unsigned char lvalues[6691]={
@@ -2645,7 +2645,7 @@ static const ASN1_OBJECT nid_objs[NUM_NID]={
 {"sm9keyagreement","sm9keyagreement",NID_sm9keyagreement,9,
 	&(lvalues[6512]),0},
 {"sm9encrypt","sm9encrypt",NID_sm9encrypt,9,&(lvalues[6521]),0},
-{NULL,NULL,NID_undef,0,NULL,0},
+{"SMS4-CBC-HMAC-SM3","sms4-cbc-hmac-sm3",NID_sms4_cbc_hmac_sm3,0,NULL,0},
 {"SM6-ECB","sm6-ecb",NID_sm6_ecb,8,&(lvalues[6530]),0},
 {"SM6-CBC","sm6-cbc",NID_sm6_cbc,8,&(lvalues[6538]),0},
 {"SM6-OFB","sm6-ofb",NID_sm6_ofb128,8,&(lvalues[6546]),0},
@@ -2669,6 +2669,9 @@ static const ASN1_OBJECT nid_objs[NUM_NID]={
 {"SMS4-CFB1","sms4-cfb1",NID_sms4_cfb1,8,&(lvalues[6666]),0},
 {"SMS4-CFB8","sms4-cfb8",NID_sms4_cfb8,8,&(lvalues[6674]),0},
 {"SMS4-WRAP","sms4-wrap",NID_sms4_wrap,8,&(lvalues[6682]),0},
+{"SM3-TREE","sm3-tree",NID_sm3_tree,0,NULL,0},
+{"ZUC-128-EEA3","zuc-128-eea3",NID_zuc_128_eea3,0,NULL,0},
+{"ZUC-256","zuc-256",NID_zuc_256,0,NULL,0},
 };
 
 static const unsigned int sn_objs[NUM_SN]={
@@ -2865,6 +2868,7 @@ static const unsigned int sn_objs[NUM_SN]={
 975,	/* "SM2Sign-with-SHA256" */
 973,	/* "SM2Sign-with-SM3" */
 962,	/* "SM3" */
+1034,	/* "SM3-TREE" */
 1006,	/* "SM5" */
 1013,	/* "SM6-CBC" */
 1015,	/* "SM6-CFB" */
@@ -2873,6 +2877,7 @@ static const unsigned int sn_objs[NUM_SN]={
 188,	/* "SMIME" */
 167,	/* "SMIME-CAPS" */
 978,	/* "SMS4-CBC" */
+1011,	/* "SMS4-CBC-HMAC-SM3" */
 1028,	/* "SMS4-CCM" */
 982,	/* "SMS4-CFB" */
 1031,	/* "SMS4-CFB1" */
@@ -2899,6 +2904,8 @@ static const unsigned int sn_objs[NUM_SN]={
 185,	/* "X9cm" */
 125,	/* "ZLIB" */
 1000,	/* "ZUC" */
+1035,	/* "ZUC-128-EEA3" */
+1036,	/* "ZUC-256" */
 478,	/* "aRecord" */
 289,	/* "aaControls" */
 287,	/* "ac-auditEntity" */
@@ -4629,6 +4636,7 @@ static const unsigned int ln_objs[NUM_LN]={
 975,	/* "sm2sign-with-sha256" */
 973,	/* "sm2sign-with-sm3" */
 962,	/* "sm3" */
+1034,	/* "sm3-tree" */
 1006,	/* "sm5" */
 1013,	/* "sm6-cbc" */
 1015,	/* "sm6-cfb" */
@@ -4638,6 +4646,7 @@ static const unsigned int ln_objs[NUM_LN]={
 1009,	/* "sm9keyagreement" */
 1008,	/* "sm9sign" */
 978,	/* "sms4-cbc" */
+1011,	/* "sms4-cbc-hmac-sm3" */
 1028,	/* "sms4-ccm" */
 982,	/* "sms4-cfb" */
 1031,	/* "sms4-cfb1" */
@@ -4699,6 +4708,8 @@ static const unsigned int ln_objs[NUM_LN]={
 989,	/* "xor-in-ecies" */
 125,	/* "zlib compression" */
 1000,	/* "zuc" */
+1035,	/* "zuc-128-eea3" */
+1036,	/* "zuc-256" */
 };
 
 static const unsigned int obj_objs[NUM_OBJ]={
@@ -4393,6 +4393,10 @@
 #define NID_sms4_wrap           1033
 #define OBJ_sms4_wrap           OBJ_sm,104L,11L
 
+#define SN_sms4_cbc_hmac_sm3            "SMS4-CBC-HMAC-SM3"
+#define LN_sms4_cbc_hmac_sm3            "sms4-cbc-hmac-sm3"
+#define NID_sms4_cbc_hmac_sm3           1011
+
 #define NID_sm7         1004
 #define OBJ_sm7         OBJ_sm,105L
 
@@ -4446,6 +4450,10 @@
 #define NID_hmac_sm3            963
 #define OBJ_hmac_sm3            OBJ_sm,401L,2L
 
+#define SN_sm3_tree             "SM3-TREE"
+#define LN_sm3_tree             "sm3-tree"
+#define NID_sm3_tree            1034
+
 #define SN_sm2sign_with_sm3             "SM2Sign-with-SM3"
 #define LN_sm2sign_with_sm3             "sm2sign-with-sm3"
 #define NID_sm2sign_with_sm3            973
@@ -4465,3 +4473,11 @@
 #define LN_zuc          "zuc"
 #define NID_zuc         1000
 #define OBJ_zuc         OBJ_sm,800L
+
+#define SN_zuc_128_eea3         "ZUC-128-EEA3"
+#define LN_zuc_128_eea3         "zuc-128-eea3"
+#define NID_zuc_128_eea3                1035
+
+#define SN_zuc_256              "ZUC-256"
+#define LN_zuc_256              "zuc-256"
+#define NID_zuc_256             1036
@@ -123,6 +123,65 @@ int SM2_encrypt(const unsigned char *in, size_t inlen,
 int SM2_decrypt(const unsigned char *in, size_t inlen,
 	unsigned char *out, size_t *outlen, EC_KEY *ec_key);
 
+/*
+ * Ciphertext written straight into the caller's buffers, with SM3 as KDF
+ * and MAC and an uncompressed C1. SM2_encrypt_to() writes C1 || C2 || C3
+ * or C1 || C3 || C2 as chosen by flags, the same layout is expected by
+ * SM2_decrypt_to(). With a NULL out *outlen is set to the length needed.
+ * in may be the C2 part of out.
+ */
+#define SM2_CIPHERTEXT_C1C2C3	0
+#define SM2_CIPHERTEXT_C1C3C2	1
+
+int SM2_encrypt_to(unsigned char *out, size_t *outlen,
+	const unsigned char *in, size_t inlen, EC_KEY *ec_key, int flags);
+int SM2_decrypt_to(unsigned char *out, size_t *outlen,
+	const unsigned char *in, size_t inlen, EC_KEY *ec_key, int flags);
+
+/*
+ * Incremental form of the above. SM2_encrypt_init() writes C1 (with a
+ * NULL c1 it only sets *c1len), each SM2_encrypt_update() writes inlen
+ * bytes of C2 and SM2_encrypt_final() writes C3. out may be in. The
+ * final calls fail when the KDF output was all zero, the message has to
+ * be encrypted again with a new C1 then.
+ *
+ * The plaintext given out by SM2_decrypt_update() is not authenticated
+ * until SM2_decrypt_final() has checked C3 and returned 1. It must not be
+ * acted upon before that, and must be discarded when the final call
+ * fails.
+ */
+typedef struct sm2_enc_ctx_st {
+
+	EVP_MD_CTX kdf_base;
+	EVP_MD_CTX kdf_ctx;
+	EVP_MD_CTX mac_ctx;
+	unsigned char y2[(OPENSSL_ECC_MAX_FIELD_BITS + 7)/8];
+	size_t nbytes;
+
+	unsigned int counter;
+	unsigned char ks[EVP_MAX_MD_SIZE];
+	unsigned int ks_len;
+	unsigned int ks_pos;
+	unsigned char ks_or;
+
+	int encrypt;
+
+} SM2_ENC_CTX;
+
+int SM2_encrypt_init(SM2_ENC_CTX *ctx, EC_KEY *ec_key,
+	unsigned char *c1, size_t *c1len);
+int SM2_encrypt_update(SM2_ENC_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen);
+int SM2_encrypt_final(SM2_ENC_CTX *ctx, unsigned char *c3,
+	unsigned int *c3len);
+int SM2_decrypt_init(SM2_ENC_CTX *ctx, EC_KEY *ec_key,
+	const unsigned char *c1, size_t c1len);
+int SM2_decrypt_update(SM2_ENC_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen);
+int SM2_decrypt_final(SM2_ENC_CTX *ctx, const unsigned char *c3,
+	size_t c3len);
+void SM2_ENC_CTX_cleanup(SM2_ENC_CTX *ctx);
+
 
 int SM2_compute_message_digest(const EVP_MD *id_md, const EVP_MD *msg_md,
 	const void *msg, size_t msglen, unsigned char *dgst,
@@ -150,6 +209,89 @@ int SM2_sign(int type, const unsigned char *dgst, int dgstlen,
 int SM2_verify(int type, const unsigned char *dgst, int dgstlen,
 	const unsigned char *sig, int siglen, EC_KEY *ec_key);
 
+/*
+ * Verification keeps a table of multiples of the public keys that are used
+ * in at least threshold verifications, for up to max_keys keys with the
+ * least recently used dropped first. The cache is off (max_keys = 0) by
+ * default, and then verification does not look at it at all.
+ * SM2_flush_verify_cache() frees the tables kept so far.
+ */
+#define SM2_VERIFY_CACHE_THRESHOLD	2
+int SM2_set_verify_cache(size_t max_keys, int threshold);
+void SM2_flush_verify_cache(void);
+
+/*
+ * Verifies the n signatures sigs[i] of dgsts[i] under keys[i], results[i]
+ * gets the SM2_do_verify() result of each. Returns SM2_VERIFY_SUCCESS if
+ * all of them verify. The batch is spread over the number of online
+ * processors, or nthreads as set with SM2_set_verify_batch_threads().
+ */
+int SM2_do_verify_batch(const unsigned char *dgsts[], int dgstlen,
+	const ECDSA_SIG *sigs[], EC_KEY *keys[], size_t n, int results[]);
+void SM2_set_verify_batch_threads(int nthreads);
+
+/*
+ * Pool of signing values (k, (kG).x mod n) of a group, filled with
+ * SM2_PRESIGN_POOL_fill() when idle or by the thread of
+ * SM2_PRESIGN_POOL_start(). SM2_PRESIGN_POOL_get() takes one value out,
+ * it returns 0 if the pool is empty. The values can be given to
+ * SM2_do_sign_ex() or used by a SM2_SIGN_CTX, each one is used once.
+ * After fork() the child finds the pool empty and has to fill or start
+ * it again, the values of the parent are never handed out twice. The
+ * pool may be in use by other threads, including its refill thread,
+ * while fork() is called.
+ */
+typedef struct sm2_presign_pool_st SM2_PRESIGN_POOL;
+
+SM2_PRESIGN_POOL *SM2_PRESIGN_POOL_new(const EC_GROUP *group, size_t size);
+void SM2_PRESIGN_POOL_free(SM2_PRESIGN_POOL *pool);
+size_t SM2_PRESIGN_POOL_fill(SM2_PRESIGN_POOL *pool, size_t n);
+int SM2_PRESIGN_POOL_start(SM2_PRESIGN_POOL *pool);
+void SM2_PRESIGN_POOL_stop(SM2_PRESIGN_POOL *pool);
+size_t SM2_PRESIGN_POOL_count(SM2_PRESIGN_POOL *pool);
+int SM2_PRESIGN_POOL_get(SM2_PRESIGN_POOL *pool, BIGNUM *k, BIGNUM *x);
+const EC_GROUP *SM2_PRESIGN_POOL_get0_group(const SM2_PRESIGN_POOL *pool);
+
+/*
+ * Signing context of one private key, the Z digest of the key and
+ * (1 + d)^-1 are computed once by SM2_SIGN_CTX_init(), which takes a
+ * reference of ec_key. SM2_SIGN_CTX_sign() signs the message itself, not
+ * its digest, with the SM3 digest of Z || msg. A context must not be used
+ * by several threads at once.
+ */
+typedef struct sm2_sign_ctx_st {
+
+	const EVP_MD *id_dgst_md;
+	const EVP_MD *msg_md;
+	EVP_MD_CTX md_ctx;
+
+	EC_KEY *ec_key;
+	unsigned char id_dgst[EVP_MAX_MD_SIZE];
+	unsigned int id_dgstlen;
+
+	const EC_GROUP *group;
+	BN_CTX *bn_ctx;
+	BIGNUM *order;
+	BIGNUM *d_inv;
+
+	BIGNUM *k;
+	BIGNUM *x;
+	BIGNUM *e;
+	EC_POINT *point;
+
+	SM2_PRESIGN_POOL *pool;
+
+} SM2_SIGN_CTX;
+
+int SM2_SIGN_CTX_init(SM2_SIGN_CTX *ctx, EC_KEY *ec_key);
+ECDSA_SIG *SM2_SIGN_CTX_do_sign(SM2_SIGN_CTX *ctx, const void *msg,
+	size_t msglen);
+int SM2_SIGN_CTX_sign(SM2_SIGN_CTX *ctx, const void *msg, size_t msglen,
+	unsigned char *sig, unsigned int *siglen);
+void SM2_SIGN_CTX_cleanup(SM2_SIGN_CTX *ctx);
+/* k is taken from pool while it is not empty, the pool is not owned by ctx */
+int SM2_SIGN_CTX_set_presign_pool(SM2_SIGN_CTX *ctx, SM2_PRESIGN_POOL *pool);
+
 
 
 typedef struct sm2_kap_ctx_st {
@@ -227,6 +369,20 @@ void ERR_load_SM2_strings(void);
 #define SM2_F_SM2_KAP_PREPARE			122
 #define SM2_F_SM2_KAP_COMPUTE_KEY		123
 #define SM2_F_SM2_KAP_FINAL_CHECK		124	
+#define SM2_F_SM2_DO_VERIFY_BATCH		125
+#define SM2_F_SM2_SIGN_CTX_INIT			126
+#define SM2_F_SM2_SIGN_CTX_DO_SIGN		127
+#define SM2_F_SM2_PRESIGN_POOL_NEW		128
+#define SM2_F_SM2_PRESIGN_POOL_FILL		129
+#define SM2_F_SM2_SIGN_CTX_SET_PRESIGN_POOL	130
+#define SM2_F_SM2_ENCRYPT_INIT			131
+#define SM2_F_SM2_ENCRYPT_UPDATE		132
+#define SM2_F_SM2_ENCRYPT_FINAL			133
+#define SM2_F_SM2_DECRYPT_INIT			134
+#define SM2_F_SM2_DECRYPT_UPDATE		135
+#define SM2_F_SM2_DECRYPT_FINAL			136
+#define SM2_F_SM2_ENCRYPT_TO			137
+#define SM2_F_SM2_DECRYPT_TO			138
 
 
 /* Reason codes. */
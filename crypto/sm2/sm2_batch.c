@@ -0,0 +1,387 @@
+/* crypto/sm2/sm2_batch.c */
+/* ====================================================================
+ * Copyright (c) 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * Batch verification of SM2 signatures. An SM2 signature carries only
+ * x1 + e mod n, not the point (x1, y1) itself, so the signatures can not be
+ * folded into one random linear combination as with Schnorr signatures,
+ * every signature needs its own sG + tP. The batch saves what can be
+ * shared: the public keys used several times in the batch get an
+ * EC_POINT_TABLE, x1 is compared in Jacobian coordinates without an
+ * inversion, and the signatures are spread over several threads.
+ */
+
+#include <stdlib.h>
+#include <openssl/e_os2.h>
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/objects.h>
+#include <openssl/sm2.h>
+#include "sm2_locl.h"
+
+#if defined(OPENSSL_THREADS) && defined(OPENSSL_SYS_UNIX)
+# define SM2_BATCH_THREADS
+# include <pthread.h>
+# include <unistd.h>
+#endif
+
+#define SM2_BATCH_MAX_THREADS		64
+/* signatures below which another thread is not worth starting */
+#define SM2_BATCH_PER_THREAD		16
+/* uses of a public key in a batch for which a table is built */
+#define SM2_BATCH_TABLE_THRESHOLD	4
+
+static int sm2_batch_default_threads = 0;
+
+typedef struct {
+	const unsigned char **dgsts;
+	int dgstlen;
+	const ECDSA_SIG **sigs;
+	EC_KEY **keys;
+	EC_POINT_TABLE **tables;
+	int *results;
+	size_t num;
+} SM2_BATCH_JOB;
+
+typedef struct {
+	EC_KEY *key;
+	size_t idx;
+} SM2_BATCH_KEY;
+
+void SM2_set_verify_batch_threads(int nthreads)
+{
+	sm2_batch_default_threads = nthreads > 0 ? nthreads : 0;
+}
+
+static int sm2_batch_verify_one(const unsigned char *dgst, int dgstlen,
+	const ECDSA_SIG *sig, EC_KEY *ec_key, EC_POINT_TABLE *table,
+	BN_CTX *ctx)
+{
+	int ret = SM2_VERIFY_INNER_ERROR;
+	const EC_GROUP *group;
+	const EC_POINT *pub_key;
+	EC_POINT *point = NULL;
+	EC_POINT_TABLE *own = NULL;
+	BIGNUM *p, *order, *c, *t, *x, *z;
+	int i;
+
+	if (!sig || !dgst || !ec_key ||
+		!(group = EC_KEY_get0_group(ec_key)) ||
+		!(pub_key = EC_KEY_get0_public_key(ec_key)))
+		return SM2_VERIFY_INNER_ERROR;
+
+	if (EC_METHOD_get_field_type(EC_GROUP_method_of(group)) !=
+		NID_X9_62_prime_field)
+		return SM2_do_verify(dgst, dgstlen, sig, ec_key);
+
+	BN_CTX_start(ctx);
+	p = BN_CTX_get(ctx);
+	order = BN_CTX_get(ctx);
+	c = BN_CTX_get(ctx);
+	t = BN_CTX_get(ctx);
+	x = BN_CTX_get(ctx);
+	z = BN_CTX_get(ctx);
+	if (!z || !(point = EC_POINT_new(group)))
+		goto end;
+	if (!EC_GROUP_get_curve_GFp(group, p, NULL, NULL, ctx) ||
+		!EC_GROUP_get_order(group, order, ctx))
+		goto end;
+
+	/* r, s in [1, n-1] and t = r + s != 0 (mod n) */
+	if (BN_is_zero(sig->r) || BN_is_negative(sig->r) ||
+		BN_ucmp(sig->r, order) >= 0 ||
+		BN_is_zero(sig->s) || BN_is_negative(sig->s) ||
+		BN_ucmp(sig->s, order) >= 0) {
+		ret = SM2_VERIFY_FAILED;
+		goto end;
+	}
+	if (!BN_mod_add(t, sig->r, sig->s, order, ctx))
+		goto end;
+	if (BN_is_zero(t)) {
+		ret = SM2_VERIFY_FAILED;
+		goto end;
+	}
+
+	/* (X, Y, Z) = sG + tP */
+	if (!table)
+		table = own = sm2_get_verify_table(ec_key, ctx);
+	if (table) {
+		if (!EC_POINT_mul_table(group, point, sig->s, table, t, ctx))
+			goto end;
+	} else if (!EC_POINT_mul(group, point, sig->s, pub_key, t, ctx))
+		goto end;
+	if (!EC_POINT_get_Jprojective_coordinates_GFp(group, point, x, NULL,
+		z, ctx))
+		goto end;
+	if (BN_is_zero(z)) {
+		ret = SM2_VERIFY_FAILED;
+		goto end;
+	}
+
+	/*
+	 * x1 + e = r (mod n) with x1 = X/Z^2 in [0, p), as p < 2n the
+	 * candidates for x1 are c = r - e mod n and c + n, each is checked
+	 * as X = c * Z^2 (mod p).
+	 */
+	if (!BN_bin2bn(dgst, dgstlen, c) ||
+		!BN_mod_sub(c, sig->r, c, order, ctx) ||
+		!BN_mod_sqr(z, z, p, ctx))
+		goto end;
+	ret = SM2_VERIFY_FAILED;
+	for (i = 0; i < 2 && BN_ucmp(c, p) < 0; i++) {
+		if (!BN_mod_mul(t, c, z, p, ctx) || !BN_add(c, c, order)) {
+			ret = SM2_VERIFY_INNER_ERROR;
+			break;
+		}
+		if (BN_ucmp(t, x) == 0) {
+			ret = SM2_VERIFY_SUCCESS;
+			break;
+		}
+	}
+
+end:
+	if (point) EC_POINT_free(point);
+	EC_POINT_TABLE_free(own);
+	BN_CTX_end(ctx);
+	return ret;
+}
+
+static void *sm2_batch_worker(void *arg)
+{
+	SM2_BATCH_JOB *job = (SM2_BATCH_JOB *)arg;
+	BN_CTX *ctx;
+	size_t i;
+
+	if (!(ctx = BN_CTX_new()))
+		return NULL;
+	for (i = 0; i < job->num; i++) {
+		job->results[i] = sm2_batch_verify_one(job->dgsts[i],
+			job->dgstlen, job->sigs[i], job->keys[i],
+			job->tables[i], ctx);
+	}
+	BN_CTX_free(ctx);
+	return NULL;
+}
+
+static int sm2_batch_key_cmp(const void *a, const void *b)
+{
+	const SM2_BATCH_KEY *ka = (const SM2_BATCH_KEY *)a;
+	const SM2_BATCH_KEY *kb = (const SM2_BATCH_KEY *)b;
+
+	if (ka->key != kb->key)
+		return ka->key < kb->key ? -1 : 1;
+	return ka->idx < kb->idx ? -1 : ka->idx > kb->idx;
+}
+
+/*
+ * give the keys used at least SM2_BATCH_TABLE_THRESHOLD times a table,
+ * either the one of the verify cache or a new one, the references are
+ * kept in owned[]
+ */
+static int sm2_batch_tables(EC_KEY **keys, size_t n,
+	EC_POINT_TABLE **tables, EC_POINT_TABLE **owned, size_t *nowned)
+{
+	SM2_BATCH_KEY *sorted;
+	EC_POINT_TABLE *table;
+	const EC_GROUP *group;
+	const EC_POINT *pub_key;
+	BN_CTX *ctx;
+	size_t i, j, k;
+
+	*nowned = 0;
+	if (n < SM2_BATCH_TABLE_THRESHOLD)
+		return 1;
+	if (!(sorted = OPENSSL_malloc(sizeof(*sorted) * n)))
+		return 0;
+	if (!(ctx = BN_CTX_new())) {
+		OPENSSL_free(sorted);
+		return 0;
+	}
+	for (i = 0; i < n; i++) {
+		sorted[i].key = keys[i];
+		sorted[i].idx = i;
+	}
+	qsort(sorted, n, sizeof(*sorted), sm2_batch_key_cmp);
+
+	for (i = 0; i < n; i = j) {
+		for (j = i + 1; j < n && sorted[j].key == sorted[i].key; j++)
+			;
+		if (j - i < SM2_BATCH_TABLE_THRESHOLD || !sorted[i].key ||
+			!(group = EC_KEY_get0_group(sorted[i].key)) ||
+			!(pub_key = EC_KEY_get0_public_key(sorted[i].key)))
+			continue;
+
+		if (!(table = sm2_get_verify_table(sorted[i].key, ctx))) {
+			/* a key the batch can not make a table for is verified as is */
+			ERR_set_mark();
+			table = EC_POINT_TABLE_new(group, pub_key, ctx);
+			ERR_pop_to_mark();
+			if (!table)
+				continue;
+		}
+		owned[(*nowned)++] = table;
+		for (k = i; k < j; k++)
+			tables[sorted[k].idx] = table;
+	}
+
+	BN_CTX_free(ctx);
+	OPENSSL_free(sorted);
+	return 1;
+}
+
+/*
+ * results[i] is set to SM2_VERIFY_SUCCESS, SM2_VERIFY_FAILED or
+ * SM2_VERIFY_INNER_ERROR for the i-th signature, the return value is
+ * SM2_VERIFY_SUCCESS if all of them verify, SM2_VERIFY_INNER_ERROR if any
+ * of them could not be checked and SM2_VERIFY_FAILED otherwise.
+ */
+int SM2_do_verify_batch(const unsigned char *dgsts[], int dgstlen,
+	const ECDSA_SIG *sigs[], EC_KEY *keys[], size_t n, int results[])
+{
+	int ret = SM2_VERIFY_INNER_ERROR;
+	SM2_BATCH_JOB job[SM2_BATCH_MAX_THREADS];
+#ifdef SM2_BATCH_THREADS
+	pthread_t tid[SM2_BATCH_MAX_THREADS];
+	int started[SM2_BATCH_MAX_THREADS];
+#endif
+	EC_POINT_TABLE **tables = NULL;
+	EC_POINT_TABLE **owned = NULL;
+	size_t nowned = 0, per, rem, off = 0, i;
+	int nthreads, nt;
+
+	if (!dgsts || !sigs || !keys || !results) {
+		SM2err(SM2_F_SM2_DO_VERIFY_BATCH, ERR_R_PASSED_NULL_PARAMETER);
+		return SM2_VERIFY_INNER_ERROR;
+	}
+	if (n == 0)
+		return SM2_VERIFY_SUCCESS;
+	for (i = 0; i < n; i++)
+		results[i] = SM2_VERIFY_INNER_ERROR;
+
+	if (n > ((size_t)-1) / sizeof(EC_POINT_TABLE *) ||
+		!(tables = OPENSSL_malloc(sizeof(*tables) * n)) ||
+		!(owned = OPENSSL_malloc(sizeof(*owned) * n))) {
+		SM2err(SM2_F_SM2_DO_VERIFY_BATCH, ERR_R_MALLOC_FAILURE);
+		goto end;
+	}
+	for (i = 0; i < n; i++)
+		tables[i] = NULL;
+	if (!sm2_batch_tables(keys, n, tables, owned, &nowned)) {
+		SM2err(SM2_F_SM2_DO_VERIFY_BATCH, ERR_R_MALLOC_FAILURE);
+		goto end;
+	}
+
+	nthreads = sm2_batch_default_threads;
+#ifdef SM2_BATCH_THREADS
+# ifdef _SC_NPROCESSORS_ONLN
+	if (nthreads <= 0)
+		nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+# endif
+	if (nthreads <= 0)
+		nthreads = 1;
+	if (nthreads > SM2_BATCH_MAX_THREADS)
+		nthreads = SM2_BATCH_MAX_THREADS;
+	if ((size_t)nthreads > (n + SM2_BATCH_PER_THREAD - 1) /
+		SM2_BATCH_PER_THREAD)
+		nthreads = (int)((n + SM2_BATCH_PER_THREAD - 1) /
+			SM2_BATCH_PER_THREAD);
+#else
+	nthreads = 1;
+#endif
+
+	per = n / nthreads;
+	rem = n % nthreads;
+	for (nt = 0; nt < nthreads; nt++) {
+		job[nt].dgsts = dgsts + off;
+		job[nt].dgstlen = dgstlen;
+		job[nt].sigs = sigs + off;
+		job[nt].keys = keys + off;
+		job[nt].tables = tables + off;
+		job[nt].results = results + off;
+		job[nt].num = per + ((size_t)nt < rem);
+		off += job[nt].num;
+	}
+
+#ifdef SM2_BATCH_THREADS
+	for (nt = 1; nt < nthreads; nt++) {
+		started[nt] = pthread_create(&tid[nt], NULL, sm2_batch_worker,
+			&job[nt]) == 0;
+	}
+	sm2_batch_worker(&job[0]);
+	for (nt = 1; nt < nthreads; nt++) {
+		if (started[nt])
+			pthread_join(tid[nt], NULL);
+		else
+			sm2_batch_worker(&job[nt]);
+	}
+#else
+	sm2_batch_worker(&job[0]);
+#endif
+
+	ret = SM2_VERIFY_SUCCESS;
+	for (i = 0; i < n; i++) {
+		if (results[i] == SM2_VERIFY_INNER_ERROR) {
+			ret = SM2_VERIFY_INNER_ERROR;
+			break;
+		}
+		if (results[i] != SM2_VERIFY_SUCCESS)
+			ret = SM2_VERIFY_FAILED;
+	}
+
+end:
+	for (i = 0; i < nowned; i++)
+		EC_POINT_TABLE_free(owned[i]);
+	if (owned) OPENSSL_free(owned);
+	if (tables) OPENSSL_free(tables);
+	return ret;
+}
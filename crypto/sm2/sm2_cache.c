@@ -0,0 +1,339 @@
+/* crypto/sm2/sm2_cache.c */
+/* ====================================================================
+ * Copyright (c) 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * Public key tables for SM2 verification. A public key that has been used
+ * in `threshold' verifications gets an EC_POINT_TABLE, the keys are kept in
+ * a hash with a LRU list of at most `max_keys' entries. The table is also
+ * attached to the EC_KEY, so that an EC_KEY used many times looks the
+ * cache up only once.
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/lhash.h>
+#include <openssl/err.h>
+#include <openssl/ec.h>
+#include <openssl/sm2.h>
+#include "sm2_locl.h"
+
+#define SM2_VERIFY_CACHE_KEY_SIZE	(1 + (OPENSSL_ECC_MAX_FIELD_BITS + 7)/4)
+
+typedef struct sm2_verify_cache_entry_st {
+	int curve_name;
+	unsigned char key[SM2_VERIFY_CACHE_KEY_SIZE];
+	size_t keylen;
+	unsigned long hash;
+	int count;
+	EC_POINT_TABLE *table;
+	struct sm2_verify_cache_entry_st *prev;
+	struct sm2_verify_cache_entry_st *next;
+} SM2_VERIFY_CACHE_ENTRY;
+
+/* protected by CRYPTO_LOCK_ECDSA, which the SM2 signatures share */
+static _LHASH *cache_hash = NULL;
+static SM2_VERIFY_CACHE_ENTRY *cache_head = NULL; /* most recently used */
+static SM2_VERIFY_CACHE_ENTRY *cache_tail = NULL;
+static size_t cache_num = 0;
+static size_t cache_max = 0;
+static int cache_threshold = SM2_VERIFY_CACHE_THRESHOLD;
+
+static unsigned long cache_entry_hash(const void *data)
+{
+	return ((const SM2_VERIFY_CACHE_ENTRY *)data)->hash;
+}
+
+static int cache_entry_cmp(const void *a_, const void *b_)
+{
+	const SM2_VERIFY_CACHE_ENTRY *a = a_;
+	const SM2_VERIFY_CACHE_ENTRY *b = b_;
+
+	if (a->curve_name != b->curve_name)
+		return a->curve_name - b->curve_name;
+	if (a->keylen != b->keylen)
+		return a->keylen < b->keylen ? -1 : 1;
+	return memcmp(a->key, b->key, a->keylen);
+}
+
+static void cache_unlink(SM2_VERIFY_CACHE_ENTRY *e)
+{
+	if (e->prev)
+		e->prev->next = e->next;
+	else	cache_head = e->next;
+	if (e->next)
+		e->next->prev = e->prev;
+	else	cache_tail = e->prev;
+	e->prev = e->next = NULL;
+}
+
+static void cache_push_front(SM2_VERIFY_CACHE_ENTRY *e)
+{
+	e->prev = NULL;
+	e->next = cache_head;
+	if (cache_head)
+		cache_head->prev = e;
+	cache_head = e;
+	if (!cache_tail)
+		cache_tail = e;
+}
+
+/* called with the lock held, drops the LRU entries beyond max */
+static void cache_shrink(size_t max)
+{
+	SM2_VERIFY_CACHE_ENTRY *e;
+
+	while (cache_num > max && (e = cache_tail) != NULL) {
+		cache_unlink(e);
+		(void)lh_delete(cache_hash, e);
+		cache_num--;
+		EC_POINT_TABLE_free(e->table);
+		OPENSSL_free(e);
+	}
+}
+
+int SM2_set_verify_cache(size_t max_keys, int threshold)
+{
+	int ret = 1;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_ECDSA);
+	if (max_keys && !cache_hash &&
+		!(cache_hash = lh_new(cache_entry_hash, cache_entry_cmp))) {
+		ret = 0;
+		max_keys = 0;
+	}
+	cache_max = max_keys;
+	cache_threshold = threshold > 0 ? threshold : 1;
+	cache_shrink(cache_max);
+	CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA);
+
+	return ret;
+}
+
+void SM2_flush_verify_cache(void)
+{
+	CRYPTO_w_lock(CRYPTO_LOCK_ECDSA);
+	cache_shrink(0);
+	CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA);
+}
+
+/*
+ * The table attached to an EC_KEY, it is replaced when the public key of
+ * the EC_KEY has changed. Protected by CRYPTO_LOCK_ECDSA.
+ */
+typedef struct {
+	EC_POINT_TABLE *table;
+} SM2_VERIFY_KEY_DATA;
+
+static void *verify_key_data_dup(void *data)
+{
+	SM2_VERIFY_KEY_DATA *src = data, *dst;
+
+	if (!(dst = OPENSSL_malloc(sizeof(*dst))))
+		return NULL;
+	CRYPTO_r_lock(CRYPTO_LOCK_ECDSA);
+	if ((dst->table = src->table) != NULL)
+		EC_POINT_TABLE_up_ref(dst->table);
+	CRYPTO_r_unlock(CRYPTO_LOCK_ECDSA);
+	return dst;
+}
+
+static void verify_key_data_free(void *data)
+{
+	SM2_VERIFY_KEY_DATA *kd = data;
+
+	EC_POINT_TABLE_free(kd->table);
+	OPENSSL_free(kd);
+}
+
+/*
+ * Looks the public key of ec_key up in the cache and returns a new reference
+ * to its table, building it when the key has been seen often enough.
+ */
+static EC_POINT_TABLE *cache_get_table(EC_KEY *ec_key, BN_CTX *ctx)
+{
+	const EC_GROUP *group = EC_KEY_get0_group(ec_key);
+	const EC_POINT *pub_key = EC_KEY_get0_public_key(ec_key);
+	SM2_VERIFY_CACHE_ENTRY tmp, *e;
+	EC_POINT_TABLE *table = NULL;
+	int build = 0;
+	size_t i;
+
+	if (!(tmp.curve_name = EC_GROUP_get_curve_name(group)))
+		return NULL;
+	if (!(tmp.keylen = EC_POINT_point2oct(group, pub_key,
+		POINT_CONVERSION_UNCOMPRESSED, tmp.key, sizeof(tmp.key), ctx)))
+		return NULL;
+	tmp.hash = (unsigned long)tmp.curve_name;
+	for (i = 0; i < tmp.keylen; i++)
+		tmp.hash = tmp.hash * 31 + tmp.key[i];
+
+	CRYPTO_w_lock(CRYPTO_LOCK_ECDSA);
+	if (!cache_max)
+		goto end;
+	if ((e = lh_retrieve(cache_hash, &tmp)) != NULL)
+		cache_unlink(e);
+	else {
+		if (!(e = OPENSSL_malloc(sizeof(*e))))
+			goto end;
+		memcpy(e, &tmp, sizeof(*e));
+		e->count = 0;
+		e->table = NULL;
+		(void)lh_insert(cache_hash, e);
+		if (lh_retrieve(cache_hash, &tmp) != e) {
+			OPENSSL_free(e);
+			goto end;
+		}
+		cache_num++;
+	}
+	cache_push_front(e);
+	cache_shrink(cache_max);
+
+	if (e->table) {
+		EC_POINT_TABLE_up_ref(e->table);
+		table = e->table;
+	} else if (++e->count >= cache_threshold)
+		build = 1;
+end:
+	CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA);
+
+	if (!build)
+		return table;
+
+	/* build it unlocked, the entry may be gone or filled meanwhile */
+	if (!(table = EC_POINT_TABLE_new(group, pub_key, ctx)))
+		return NULL;
+
+	CRYPTO_w_lock(CRYPTO_LOCK_ECDSA);
+	if (cache_hash && (e = lh_retrieve(cache_hash, &tmp)) != NULL &&
+		!e->table) {
+		EC_POINT_TABLE_up_ref(table);
+		e->table = table;
+	}
+	CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA);
+
+	return table;
+}
+
+/*
+ * Returns a new reference to the table of the public key of ec_key, or
+ * NULL. With the cache off nothing is looked up, not even the table
+ * attached to ec_key.
+ */
+EC_POINT_TABLE *sm2_get_verify_table(EC_KEY *ec_key, BN_CTX *ctx)
+{
+	const EC_GROUP *group = EC_KEY_get0_group(ec_key);
+	const EC_POINT *pub_key = EC_KEY_get0_public_key(ec_key);
+	SM2_VERIFY_KEY_DATA *kd, *attached;
+	EC_POINT_TABLE *table = NULL, *old;
+	size_t max;
+
+	if (!group || !pub_key)
+		return NULL;
+	CRYPTO_r_lock(CRYPTO_LOCK_ECDSA);
+	max = cache_max;
+	CRYPTO_r_unlock(CRYPTO_LOCK_ECDSA);
+	if (!max)
+		return NULL;
+
+	ERR_set_mark();
+
+	if ((kd = EC_KEY_get_key_method_data(ec_key, verify_key_data_dup,
+		verify_key_data_free, verify_key_data_free)) != NULL) {
+		CRYPTO_r_lock(CRYPTO_LOCK_ECDSA);
+		if ((table = kd->table) != NULL)
+			EC_POINT_TABLE_up_ref(table);
+		CRYPTO_r_unlock(CRYPTO_LOCK_ECDSA);
+
+		/* the public key may have been changed since */
+		if (table && EC_POINT_cmp(group, EC_POINT_TABLE_get0_point(table),
+			pub_key, ctx) == 0)
+			goto end;
+
+		/* drop the table of the old key */
+		old = NULL;
+		CRYPTO_w_lock(CRYPTO_LOCK_ECDSA);
+		if (table && kd->table == table) {
+			old = kd->table;
+			kd->table = NULL;
+		}
+		CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA);
+		EC_POINT_TABLE_free(old);
+		EC_POINT_TABLE_free(table);
+		table = NULL;
+	}
+
+	if (!(table = cache_get_table(ec_key, ctx)))
+		goto end;
+
+	if (!kd) {
+		if (!(kd = OPENSSL_malloc(sizeof(*kd))))
+			goto end;
+		kd->table = NULL;
+		if ((attached = EC_KEY_insert_key_method_data(ec_key, kd,
+			verify_key_data_dup, verify_key_data_free,
+			verify_key_data_free)) != NULL) {
+			OPENSSL_free(kd);
+			kd = attached;
+		}
+	}
+
+	/* the EC_KEY keeps a reference of the table of its current key */
+	EC_POINT_TABLE_up_ref(table);
+	CRYPTO_w_lock(CRYPTO_LOCK_ECDSA);
+	old = kd->table;
+	kd->table = table;
+	CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA);
+	EC_POINT_TABLE_free(old);
+
+end:
+	ERR_pop_to_mark();
+	return table;
+}
@@ -239,41 +239,503 @@ end:
 	return 0;
 }
 
-int SM2_encrypt_ex(const EVP_MD *kdf_md, const EVP_MD *mac_md,
-	point_conversion_form_t point_form,
-	const unsigned char *in, size_t inlen,
-	unsigned char *out, size_t *outlen, EC_KEY *ec_key)
+/*
+ * The keystream t = KDF(x2 || y2) is generated one digest block at a time,
+ * from a copy of the KDF digest that has absorbed x2 || y2 already. C3 =
+ * Hash(x2 || M || y2) is hashed along with the message.
+ */
+static int sm2_enc_ctx_setup(SM2_ENC_CTX *ctx, const EVP_MD *kdf_md,
+	const EVP_MD *mac_md, const EC_GROUP *group, const EC_POINT *point,
+	BN_CTX *bn_ctx)
 {
 	int ret = 0;
-	const EC_GROUP *ec_group = EC_KEY_get0_group(ec_key);
-	SM2_CIPHERTEXT_VALUE *cv = NULL;
-	int len;
+	unsigned char buf[(OPENSSL_ECC_MAX_FIELD_BITS + 7)/4 + 1];
+	size_t len;
 
-	if (!(len = SM2_CIPHERTEXT_VALUE_size(ec_group, point_form, inlen, mac_md))) {
+	ctx->nbytes = (EC_GROUP_get_degree(group) + 7) / 8;
+	if (!(len = EC_POINT_point2oct(group, point,
+		POINT_CONVERSION_UNCOMPRESSED, buf, sizeof(buf), bn_ctx)) ||
+		len != 1 + 2 * ctx->nbytes) {
 		goto end;
 	}
 
-	if (!out) {
-		*outlen = (size_t)len;
+	if (!EVP_DigestInit_ex(&ctx->kdf_base, kdf_md, NULL) ||
+		!EVP_DigestUpdate(&ctx->kdf_base, buf + 1, len - 1) ||
+		!EVP_DigestInit_ex(&ctx->mac_ctx, mac_md, NULL) ||
+		!EVP_DigestUpdate(&ctx->mac_ctx, buf + 1, ctx->nbytes)) {
+		goto end;
+	}
+	memcpy(ctx->y2, buf + 1 + ctx->nbytes, ctx->nbytes);
+
+	ctx->counter = 1;
+	ctx->ks_len = 0;
+	ctx->ks_pos = 0;
+	ctx->ks_or = 0;
+	ret = 1;
+end:
+	OPENSSL_cleanse(buf, sizeof(buf));
+	return ret;
+}
+
+/* out = in xor t for the next inlen bytes of t, out may be in */
+static int sm2_enc_ctx_xor(SM2_ENC_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen)
+{
+	unsigned char ctr[4];
+	size_t i, len;
+
+	while (inlen > 0) {
+		if (ctx->ks_pos == ctx->ks_len) {
+			ctr[0] = (unsigned char)(ctx->counter >> 24);
+			ctr[1] = (unsigned char)(ctx->counter >> 16);
+			ctr[2] = (unsigned char)(ctx->counter >> 8);
+			ctr[3] = (unsigned char)ctx->counter;
+			ctx->counter++;
+			if (!EVP_MD_CTX_copy_ex(&ctx->kdf_ctx, &ctx->kdf_base) ||
+				!EVP_DigestUpdate(&ctx->kdf_ctx, ctr, sizeof(ctr)) ||
+				!EVP_DigestFinal_ex(&ctx->kdf_ctx, ctx->ks,
+				&ctx->ks_len)) {
+				return 0;
+			}
+			ctx->ks_pos = 0;
+		}
+
+		len = ctx->ks_len - ctx->ks_pos;
+		if (len > inlen)
+			len = inlen;
+		for (i = 0; i < len; i++) {
+			ctx->ks_or |= ctx->ks[ctx->ks_pos + i];
+			out[i] = in[i] ^ ctx->ks[ctx->ks_pos + i];
+		}
+		ctx->ks_pos += len;
+		out += len;
+		in += len;
+		inlen -= len;
+	}
+	return 1;
+}
+
+/* returns the number of bytes of C1 for point_form */
+static size_t sm2_c1_size(const EC_GROUP *group,
+	point_conversion_form_t point_form)
+{
+	size_t nbytes = (EC_GROUP_get_degree(group) + 7) / 8;
+
+	if (point_form == POINT_CONVERSION_COMPRESSED)
+		return 1 + nbytes;
+	return 1 + 2 * nbytes;
+}
+
+static int sm2_encrypt_init_ex(SM2_ENC_CTX *ctx, const EVP_MD *kdf_md,
+	const EVP_MD *mac_md, point_conversion_form_t point_form,
+	EC_KEY *ec_key, unsigned char *c1, size_t *c1len)
+{
+	int ret = 0;
+	const EC_GROUP *group;
+	const EC_POINT *pub_key;
+	EC_POINT *point = NULL;
+	BN_CTX *bn_ctx = NULL;
+	BIGNUM *h, *k;
+	size_t len;
+
+	memset(ctx, 0, sizeof(*ctx));
+	EVP_MD_CTX_init(&ctx->kdf_base);
+	EVP_MD_CTX_init(&ctx->kdf_ctx);
+	EVP_MD_CTX_init(&ctx->mac_ctx);
+
+	if (!ec_key || !(group = EC_KEY_get0_group(ec_key)) ||
+		!(pub_key = EC_KEY_get0_public_key(ec_key))) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, ERR_R_PASSED_NULL_PARAMETER);
+		return 0;
+	}
+
+	len = sm2_c1_size(group, point_form);
+	if (!c1) {
+		*c1len = len;
 		return 1;
+	}
+	if (*c1len < len) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, SM2_R_BUFFER_TOO_SMALL);
+		return 0;
+	}
+
+	if (!(bn_ctx = BN_CTX_new()) || !(point = EC_POINT_new(group))) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, ERR_R_MALLOC_FAILURE);
+		goto end;
+	}
+	BN_CTX_start(bn_ctx);
+	h = BN_CTX_get(bn_ctx);
+	k = BN_CTX_get(bn_ctx);
+	if (!k || !EC_GROUP_get_cofactor(group, h, bn_ctx)) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, ERR_R_EC_LIB);
+		goto end;
+	}
+	BN_set_flags(k, BN_FLG_CONSTTIME);
+
+	/* A3: check [h]P_B != O, with h = 1 that is P_B itself */
+	if (BN_is_one(h)) {
+		if (EC_POINT_is_at_infinity(group, pub_key)) {
+			SM2err(SM2_F_SM2_ENCRYPT_INIT, SM2_R_BAD_DATA);
+			goto end;
+		}
+	} else if (!EC_POINT_mul(group, point, NULL, pub_key, h, bn_ctx) ||
+		EC_POINT_is_at_infinity(group, point)) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, SM2_R_BAD_DATA);
+		goto end;
+	}
+
+	/* A1: rand k in [1, n-1] */
+	if (!EC_GROUP_get_order(group, h, bn_ctx)) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, ERR_R_EC_LIB);
+		goto end;
+	}
+	do {
+		if (!BN_rand_range(k, h)) {
+			SM2err(SM2_F_SM2_ENCRYPT_INIT,
+				SM2_R_RANDOM_NUMBER_GENERATION_FAILED);
+			goto end;
+		}
+	} while (BN_is_zero(k));
+
+	/* A2: C1 = [k]G = (x1, y1), written to c1 */
+	if (!EC_POINT_mul(group, point, k, NULL, NULL, bn_ctx) ||
+		EC_POINT_point2oct(group, point, point_form, c1, len,
+		bn_ctx) != len) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, ERR_R_EC_LIB);
+		goto end;
+	}
 
-	} else if (*outlen < (size_t)len) {
+	/* A4: [k]P_B = (x2, y2) */
+	if (!EC_POINT_mul(group, point, NULL, pub_key, k, bn_ctx) ||
+		!sm2_enc_ctx_setup(ctx, kdf_md, mac_md, group, point, bn_ctx)) {
+		SM2err(SM2_F_SM2_ENCRYPT_INIT, SM2_R_ENCRYPT_FAILED);
+		goto end;
+	}
+
+	*c1len = len;
+	ctx->encrypt = 1;
+	ret = 1;
+end:
+	if (bn_ctx) {
+		BN_CTX_end(bn_ctx);
+		BN_CTX_free(bn_ctx);
+	}
+	if (point) EC_POINT_clear_free(point);
+	if (!ret) SM2_ENC_CTX_cleanup(ctx);
+	return ret;
+}
+
+static int sm2_decrypt_init_ex(SM2_ENC_CTX *ctx, const EVP_MD *kdf_md,
+	const EVP_MD *mac_md, EC_KEY *ec_key, const unsigned char *c1,
+	size_t c1len)
+{
+	int ret = 0;
+	const EC_GROUP *group;
+	const BIGNUM *pri_key;
+	EC_POINT *point = NULL;
+	BN_CTX *bn_ctx = NULL;
+	BIGNUM *h;
+
+	memset(ctx, 0, sizeof(*ctx));
+	EVP_MD_CTX_init(&ctx->kdf_base);
+	EVP_MD_CTX_init(&ctx->kdf_ctx);
+	EVP_MD_CTX_init(&ctx->mac_ctx);
+
+	if (!ec_key || !c1 || !(group = EC_KEY_get0_group(ec_key)) ||
+		!(pri_key = EC_KEY_get0_private_key(ec_key))) {
+		SM2err(SM2_F_SM2_DECRYPT_INIT, ERR_R_PASSED_NULL_PARAMETER);
 		return 0;
 	}
 
-	if (!(cv = SM2_do_encrypt(kdf_md, mac_md, in, inlen, ec_key))) {
+	if (!(bn_ctx = BN_CTX_new()) || !(point = EC_POINT_new(group))) {
+		SM2err(SM2_F_SM2_DECRYPT_INIT, ERR_R_MALLOC_FAILURE);
 		goto end;
 	}
-	if (!SM2_CIPHERTEXT_VALUE_encode(cv, ec_group, point_form, out, outlen)) {
+	BN_CTX_start(bn_ctx);
+	if (!(h = BN_CTX_get(bn_ctx)) ||
+		!EC_GROUP_get_cofactor(group, h, bn_ctx)) {
+		SM2err(SM2_F_SM2_DECRYPT_INIT, ERR_R_EC_LIB);
 		goto end;
 	}
-	
+
+	/* B1, B2: C1 on the curve and [h]C1 != O */
+	if (!EC_POINT_oct2point(group, point, c1, c1len, bn_ctx)) {
+		SM2err(SM2_F_SM2_DECRYPT_INIT, SM2_R_BAD_DATA);
+		goto end;
+	}
+	if (BN_is_one(h)) {
+		if (EC_POINT_is_at_infinity(group, point)) {
+			SM2err(SM2_F_SM2_DECRYPT_INIT, SM2_R_BAD_DATA);
+			goto end;
+		}
+	} else {
+		EC_POINT *hc1;
+
+		if (!(hc1 = EC_POINT_new(group))) {
+			SM2err(SM2_F_SM2_DECRYPT_INIT, ERR_R_MALLOC_FAILURE);
+			goto end;
+		}
+		if (!EC_POINT_mul(group, hc1, NULL, point, h, bn_ctx) ||
+			EC_POINT_is_at_infinity(group, hc1)) {
+			EC_POINT_free(hc1);
+			SM2err(SM2_F_SM2_DECRYPT_INIT, SM2_R_BAD_DATA);
+			goto end;
+		}
+		EC_POINT_free(hc1);
+	}
+
+	/* B3: [d]C1 = (x2, y2) */
+	if (!EC_POINT_mul(group, point, NULL, point, pri_key, bn_ctx) ||
+		!sm2_enc_ctx_setup(ctx, kdf_md, mac_md, group, point, bn_ctx)) {
+		SM2err(SM2_F_SM2_DECRYPT_INIT, SM2_R_DECRYPT_FAILED);
+		goto end;
+	}
+
+	ctx->encrypt = 0;
 	ret = 1;
 end:
-	if (cv) SM2_CIPHERTEXT_VALUE_free(cv);
+	if (bn_ctx) {
+		BN_CTX_end(bn_ctx);
+		BN_CTX_free(bn_ctx);
+	}
+	if (point) EC_POINT_clear_free(point);
+	if (!ret) SM2_ENC_CTX_cleanup(ctx);
 	return ret;
 }
 
+int SM2_encrypt_init(SM2_ENC_CTX *ctx, EC_KEY *ec_key,
+	unsigned char *c1, size_t *c1len)
+{
+	return sm2_encrypt_init_ex(ctx, EVP_sm3(), EVP_sm3(),
+		SM2_DEFAULT_POINT_CONVERSION_FORM, ec_key, c1, c1len);
+}
+
+/* A6: C2 = M xor t, the message goes to C3 before it is overwritten */
+int SM2_encrypt_update(SM2_ENC_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen)
+{
+	if (!ctx->encrypt ||
+		!EVP_DigestUpdate(&ctx->mac_ctx, in, inlen) ||
+		!sm2_enc_ctx_xor(ctx, out, in, inlen)) {
+		SM2err(SM2_F_SM2_ENCRYPT_UPDATE, SM2_R_ENCRYPT_FAILED);
+		return 0;
+	}
+	return 1;
+}
+
+/* A7: C3 = Hash(x2 || M || y2), an all zero t is refused */
+int SM2_encrypt_final(SM2_ENC_CTX *ctx, unsigned char *c3,
+	unsigned int *c3len)
+{
+	if (!ctx->encrypt || (ctx->ks_len && !ctx->ks_or)) {
+		SM2err(SM2_F_SM2_ENCRYPT_FINAL, SM2_R_ENCRYPT_FAILED);
+		return 0;
+	}
+	if (!EVP_DigestUpdate(&ctx->mac_ctx, ctx->y2, ctx->nbytes) ||
+		!EVP_DigestFinal_ex(&ctx->mac_ctx, c3, c3len)) {
+		SM2err(SM2_F_SM2_ENCRYPT_FINAL, SM2_R_GEN_MAC_FAILED);
+		return 0;
+	}
+	return 1;
+}
+
+int SM2_decrypt_init(SM2_ENC_CTX *ctx, EC_KEY *ec_key,
+	const unsigned char *c1, size_t c1len)
+{
+	return sm2_decrypt_init_ex(ctx, EVP_sm3(), EVP_sm3(), ec_key,
+		c1, c1len);
+}
+
+/* B5: M = C2 xor t */
+int SM2_decrypt_update(SM2_ENC_CTX *ctx, unsigned char *out,
+	const unsigned char *in, size_t inlen)
+{
+	if (ctx->encrypt ||
+		!sm2_enc_ctx_xor(ctx, out, in, inlen) ||
+		!EVP_DigestUpdate(&ctx->mac_ctx, out, inlen)) {
+		SM2err(SM2_F_SM2_DECRYPT_UPDATE, SM2_R_DECRYPT_FAILED);
+		return 0;
+	}
+	return 1;
+}
+
+/* B6: check Hash(x2 || M || y2) == C3 */
+int SM2_decrypt_final(SM2_ENC_CTX *ctx, const unsigned char *c3,
+	size_t c3len)
+{
+	unsigned char mac[EVP_MAX_MD_SIZE];
+	unsigned int maclen;
+
+	if (ctx->encrypt || (ctx->ks_len && !ctx->ks_or)) {
+		SM2err(SM2_F_SM2_DECRYPT_FINAL, SM2_R_DECRYPT_FAILED);
+		return 0;
+	}
+	if (!EVP_DigestUpdate(&ctx->mac_ctx, ctx->y2, ctx->nbytes) ||
+		!EVP_DigestFinal_ex(&ctx->mac_ctx, mac, &maclen)) {
+		SM2err(SM2_F_SM2_DECRYPT_FINAL, SM2_R_GEN_MAC_FAILED);
+		return 0;
+	}
+	if (c3len != maclen || CRYPTO_memcmp(c3, mac, maclen) != 0) {
+		SM2err(SM2_F_SM2_DECRYPT_FINAL, SM2_R_VERIFY_MAC_FAILED);
+		return 0;
+	}
+	return 1;
+}
+
+void SM2_ENC_CTX_cleanup(SM2_ENC_CTX *ctx)
+{
+	EVP_MD_CTX_cleanup(&ctx->kdf_base);
+	EVP_MD_CTX_cleanup(&ctx->kdf_ctx);
+	EVP_MD_CTX_cleanup(&ctx->mac_ctx);
+	OPENSSL_cleanse(ctx, sizeof(*ctx));
+}
+
+static int sm2_encrypt_to(const EVP_MD *kdf_md, const EVP_MD *mac_md,
+	point_conversion_form_t point_form, unsigned char *out,
+	size_t *outlen, const unsigned char *in, size_t inlen,
+	EC_KEY *ec_key, int flags)
+{
+	int ret = 0;
+	SM2_ENC_CTX ctx;
+	size_t c1len, len;
+	unsigned int maclen = EVP_MD_size(mac_md);
+	unsigned char *c2, *c3;
+	int i;
+
+	if (!ec_key || !EC_KEY_get0_group(ec_key)) {
+		SM2err(SM2_F_SM2_ENCRYPT_TO, ERR_R_PASSED_NULL_PARAMETER);
+		return 0;
+	}
+	c1len = sm2_c1_size(EC_KEY_get0_group(ec_key), point_form);
+	len = c1len + maclen + inlen;
+	if (!out) {
+		*outlen = len;
+		return 1;
+	}
+	if (*outlen < len) {
+		SM2err(SM2_F_SM2_ENCRYPT_TO, SM2_R_BUFFER_TOO_SMALL);
+		return 0;
+	}
+
+	if (flags & SM2_CIPHERTEXT_C1C3C2) {
+		c3 = out + c1len;
+		c2 = c3 + maclen;
+	} else {
+		c2 = out + c1len;
+		c3 = c2 + inlen;
+	}
+
+	/*
+	 * an all zero t leaves C2 = M, so even when in is c2 the message is
+	 * still there for another k
+	 */
+	for (i = 0; i < 8; i++) {
+		if (!sm2_encrypt_init_ex(&ctx, kdf_md, mac_md, point_form,
+			ec_key, out, &c1len)) {
+			return 0;
+		}
+		if (!SM2_encrypt_update(&ctx, c2, in, inlen)) {
+			goto end;
+		}
+		if (!inlen || ctx.ks_or) {
+			break;
+		}
+		SM2_ENC_CTX_cleanup(&ctx);
+	}
+	if (i == 8) {
+		SM2err(SM2_F_SM2_ENCRYPT_TO, SM2_R_ENCRYPT_FAILED);
+		return 0;
+	}
+	if (!SM2_encrypt_final(&ctx, c3, &maclen)) {
+		goto end;
+	}
+
+	*outlen = len;
+	ret = 1;
+end:
+	SM2_ENC_CTX_cleanup(&ctx);
+	return ret;
+}
+
+static int sm2_decrypt_to(const EVP_MD *kdf_md, const EVP_MD *mac_md,
+	point_conversion_form_t point_form, unsigned char *out,
+	size_t *outlen, const unsigned char *in, size_t inlen,
+	EC_KEY *ec_key, int flags)
+{
+	int ret = 0;
+	SM2_ENC_CTX ctx;
+	size_t c1len, mlen;
+	size_t maclen = EVP_MD_size(mac_md);
+	const unsigned char *c2, *c3;
+
+	if (!ec_key || !EC_KEY_get0_group(ec_key)) {
+		SM2err(SM2_F_SM2_DECRYPT_TO, ERR_R_PASSED_NULL_PARAMETER);
+		return 0;
+	}
+	c1len = sm2_c1_size(EC_KEY_get0_group(ec_key), point_form);
+	if (inlen <= c1len + maclen) {
+		SM2err(SM2_F_SM2_DECRYPT_TO, SM2_R_BAD_DATA);
+		return 0;
+	}
+	mlen = inlen - c1len - maclen;
+	if (!out) {
+		*outlen = mlen;
+		return 1;
+	}
+	if (*outlen < mlen) {
+		SM2err(SM2_F_SM2_DECRYPT_TO, SM2_R_BUFFER_TOO_SMALL);
+		return 0;
+	}
+
+	if (flags & SM2_CIPHERTEXT_C1C3C2) {
+		c3 = in + c1len;
+		c2 = c3 + maclen;
+	} else {
+		c2 = in + c1len;
+		c3 = c2 + mlen;
+	}
+
+	if (!sm2_decrypt_init_ex(&ctx, kdf_md, mac_md, ec_key, in, c1len)) {
+		return 0;
+	}
+	if (!SM2_decrypt_update(&ctx, out, c2, mlen) ||
+		!SM2_decrypt_final(&ctx, c3, maclen)) {
+		OPENSSL_cleanse(out, mlen);
+		goto end;
+	}
+
+	*outlen = mlen;
+	ret = 1;
+end:
+	SM2_ENC_CTX_cleanup(&ctx);
+	return ret;
+}
+
+int SM2_encrypt_to(unsigned char *out, size_t *outlen,
+	const unsigned char *in, size_t inlen, EC_KEY *ec_key, int flags)
+{
+	return sm2_encrypt_to(EVP_sm3(), EVP_sm3(),
+		SM2_DEFAULT_POINT_CONVERSION_FORM, out, outlen, in, inlen,
+		ec_key, flags);
+}
+
+int SM2_decrypt_to(unsigned char *out, size_t *outlen,
+	const unsigned char *in, size_t inlen, EC_KEY *ec_key, int flags)
+{
+	return sm2_decrypt_to(EVP_sm3(), EVP_sm3(),
+		SM2_DEFAULT_POINT_CONVERSION_FORM, out, outlen, in, inlen,
+		ec_key, flags);
+}
+
+int SM2_encrypt_ex(const EVP_MD *kdf_md, const EVP_MD *mac_md,
+	point_conversion_form_t point_form,
+	const unsigned char *in, size_t inlen,
+	unsigned char *out, size_t *outlen, EC_KEY *ec_key)
+{
+	return sm2_encrypt_to(kdf_md, mac_md, point_form, out, outlen,
+		in, inlen, ec_key, SM2_CIPHERTEXT_C1C2C3);
+}
+
 SM2_CIPHERTEXT_VALUE *SM2_do_encrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	const unsigned char *in, size_t inlen, EC_KEY *ec_key)
 {
@@ -287,12 +749,14 @@ SM2_CIPHERTEXT_VALUE *SM2_do_encrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	BIGNUM *h = NULL;
 	BIGNUM *k = NULL;
 	BN_CTX *bn_ctx = NULL;
-	EVP_MD_CTX *md_ctx = NULL;
+	EVP_MD_CTX md_ctx;
 	unsigned char buf[(OPENSSL_ECC_MAX_FIELD_BITS + 7)/4 + 1];
 	int nbytes;
 	size_t len;
 	int i;
 
+	EVP_MD_CTX_init(&md_ctx);
+
 	if (!ec_group || !pub_key) {
 		goto end;
 	}
@@ -317,8 +781,7 @@ SM2_CIPHERTEXT_VALUE *SM2_do_encrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	h = BN_new();
 	k = BN_new();
 	bn_ctx = BN_CTX_new();
-	md_ctx = EVP_MD_CTX_create();
-	if (!point || !n || !h || !k || !bn_ctx || !md_ctx) {
+	if (!point || !n || !h || !k || !bn_ctx) {
 		goto end;
 	}
 
@@ -395,19 +858,19 @@ SM2_CIPHERTEXT_VALUE *SM2_do_encrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	}
 	
 	/* A7: C3 = Hash(x2 || M || y2) */
-	if (!EVP_DigestInit_ex(md_ctx, mac_md, NULL)) {
+	if (!EVP_DigestInit_ex(&md_ctx, mac_md, NULL)) {
 		goto end;
 	}
-	if (!EVP_DigestUpdate(md_ctx, buf + 1, nbytes)) {
+	if (!EVP_DigestUpdate(&md_ctx, buf + 1, nbytes)) {
 		goto end;
 	}
-	if (!EVP_DigestUpdate(md_ctx, in, inlen)) {
+	if (!EVP_DigestUpdate(&md_ctx, in, inlen)) {
 		goto end;
 	}
-	if (!EVP_DigestUpdate(md_ctx, buf + 1 + nbytes, nbytes)) {
+	if (!EVP_DigestUpdate(&md_ctx, buf + 1 + nbytes, nbytes)) {
 		goto end;
 	}
-	if (!EVP_DigestFinal_ex(md_ctx, cv->mactag, &cv->mactag_size)) {
+	if (!EVP_DigestFinal_ex(&md_ctx, cv->mactag, &cv->mactag_size)) {
 		goto end;
 	}
 
@@ -425,7 +888,7 @@ end:
 	if (h) BN_free(h);
 	if (k) BN_free(k);
 	if (bn_ctx) BN_CTX_free(bn_ctx);
-	if (md_ctx) EVP_MD_CTX_destroy(md_ctx);
+	EVP_MD_CTX_cleanup(&md_ctx);
 
 	return cv;
 }
@@ -435,41 +898,8 @@ int SM2_decrypt_ex(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	const unsigned char *in, size_t inlen,
 	unsigned char *out, size_t *outlen, EC_KEY *ec_key)
 {
-	int ret = 0;
-	const EC_GROUP *ec_group = EC_KEY_get0_group(ec_key);
-	SM2_CIPHERTEXT_VALUE *cv = NULL;
-	int len;
-
-	if (!(len = SM2_CIPHERTEXT_VALUE_size(ec_group, point_form, 0, mac_md))) {
-		fprintf(stderr, "%s %d\n", __FILE__, __LINE__);
-		goto end;
-	}
-	if (inlen <= len) {
-		fprintf(stderr, "%s %d\n", __FILE__, __LINE__);
-		goto end;
-	}
-
-	if (!out) {
-		*outlen = inlen - len;
-		return 1;
-	} else if (*outlen < inlen - len) {
-		fprintf(stderr, "%s %d\n", __FILE__, __LINE__);
-		return 0;
-	}
-
-	if (!(cv = SM2_CIPHERTEXT_VALUE_decode(ec_group, point_form, mac_md, in, inlen))) {
-		fprintf(stderr, "%s %d\n", __FILE__, __LINE__);
-		goto end;
-	}
-	if (!SM2_do_decrypt(kdf_md, mac_md, cv, out, outlen, ec_key)) {
-		fprintf(stderr, "%s %d\n", __FILE__, __LINE__);
-		goto end;
-	}
-
-	ret = 1;
-end:
-	if (cv) SM2_CIPHERTEXT_VALUE_free(cv);
-	return ret;
+	return sm2_decrypt_to(kdf_md, mac_md, point_form, out, outlen,
+		in, inlen, ec_key, SM2_CIPHERTEXT_C1C2C3);
 }
 
 int SM2_do_decrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
@@ -484,7 +914,7 @@ int SM2_do_decrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	BIGNUM *n = NULL;
 	BIGNUM *h = NULL;
 	BN_CTX *bn_ctx = NULL;
-	EVP_MD_CTX *md_ctx = NULL;
+	EVP_MD_CTX md_ctx;
 	unsigned char buf[(OPENSSL_ECC_MAX_FIELD_BITS + 7)/4 + 1];
 	unsigned char mac[EVP_MAX_MD_SIZE];
 	unsigned int maclen;
@@ -495,6 +925,8 @@ int SM2_do_decrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	OPENSSL_assert(kdf_md && mac_md && cv && ec_key);
 	OPENSSL_assert(cv->ephem_point && cv->ciphertext);
 
+	EVP_MD_CTX_init(&md_ctx);
+
 	if (!ec_group || !pri_key) {
 		goto end;
 	}
@@ -515,8 +947,7 @@ int SM2_do_decrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	n = BN_new();
 	h = BN_new();
 	bn_ctx = BN_CTX_new();
-	md_ctx = EVP_MD_CTX_create();
-	if (!point || !n || !h || !bn_ctx || !md_ctx) {
+	if (!point || !n || !h || !bn_ctx) {
 		goto end;
 	}
 	
@@ -568,19 +999,19 @@ int SM2_do_decrypt(const EVP_MD *kdf_md, const EVP_MD *mac_md,
 	*outlen = cv->ciphertext_size;
 
 	/* B6: check Hash(x2 || M || y2) == C3 */
-	if (!EVP_DigestInit_ex(md_ctx, mac_md, NULL)) {
+	if (!EVP_DigestInit_ex(&md_ctx, mac_md, NULL)) {
 		goto end;
 	}
-	if (!EVP_DigestUpdate(md_ctx, buf + 1, nbytes)) {
+	if (!EVP_DigestUpdate(&md_ctx, buf + 1, nbytes)) {
 		goto end;
 	}
-	if (!EVP_DigestUpdate(md_ctx, out, *outlen)) {
+	if (!EVP_DigestUpdate(&md_ctx, out, *outlen)) {
 		goto end;
 	}
-	if (!EVP_DigestUpdate(md_ctx, buf + 1 + nbytes, nbytes)) {
+	if (!EVP_DigestUpdate(&md_ctx, buf + 1 + nbytes, nbytes)) {
 		goto end;
 	}
-	if (!EVP_DigestFinal_ex(md_ctx, mac, &maclen)) {
+	if (!EVP_DigestFinal_ex(&md_ctx, mac, &maclen)) {
 		goto end;
 	}
 	if (cv->mactag_size != maclen ||
@@ -594,7 +1025,7 @@ end:
 	if (n) BN_free(n);	
 	if (h) BN_free(h);
 	if (bn_ctx) BN_CTX_free(bn_ctx);
-	if (md_ctx) EVP_MD_CTX_destroy(md_ctx);
+	EVP_MD_CTX_cleanup(&md_ctx);
 
 	return ret;
 }
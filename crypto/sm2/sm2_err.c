@@ -86,6 +86,20 @@ static ERR_STRING_DATA SM2_str_functs[] = {
 	{ERR_FUNC(SM2_F_SM2_KAP_PREPARE),		"SM2_KAP_prepare"},
 	{ERR_FUNC(SM2_F_SM2_KAP_COMPUTE_KEY),		"SM2_KAP_compute_key"},
 	{ERR_FUNC(SM2_F_SM2_KAP_FINAL_CHECK),		"SM2_KAP_final_check"},
+	{ERR_FUNC(SM2_F_SM2_DO_VERIFY_BATCH),		"SM2_do_verify_batch"},
+	{ERR_FUNC(SM2_F_SM2_SIGN_CTX_INIT),		"SM2_SIGN_CTX_init"},
+	{ERR_FUNC(SM2_F_SM2_SIGN_CTX_DO_SIGN),		"SM2_SIGN_CTX_do_sign"},
+	{ERR_FUNC(SM2_F_SM2_PRESIGN_POOL_NEW),		"SM2_PRESIGN_POOL_new"},
+	{ERR_FUNC(SM2_F_SM2_PRESIGN_POOL_FILL),		"SM2_PRESIGN_POOL_fill"},
+	{ERR_FUNC(SM2_F_SM2_SIGN_CTX_SET_PRESIGN_POOL),	"SM2_SIGN_CTX_set_presign_pool"},
+	{ERR_FUNC(SM2_F_SM2_ENCRYPT_INIT),		"SM2_encrypt_init"},
+	{ERR_FUNC(SM2_F_SM2_ENCRYPT_UPDATE),		"SM2_encrypt_update"},
+	{ERR_FUNC(SM2_F_SM2_ENCRYPT_FINAL),		"SM2_encrypt_final"},
+	{ERR_FUNC(SM2_F_SM2_DECRYPT_INIT),		"SM2_decrypt_init"},
+	{ERR_FUNC(SM2_F_SM2_DECRYPT_UPDATE),		"SM2_decrypt_update"},
+	{ERR_FUNC(SM2_F_SM2_DECRYPT_FINAL),		"SM2_decrypt_final"},
+	{ERR_FUNC(SM2_F_SM2_ENCRYPT_TO),		"SM2_encrypt_to"},
+	{ERR_FUNC(SM2_F_SM2_DECRYPT_TO),		"SM2_decrypt_to"},
 	{0,NULL}
 };
 
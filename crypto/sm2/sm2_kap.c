@@ -52,6 +52,7 @@
 #include <string.h>
 #include <openssl/kdf.h>
 #include "sm2.h"
+#include "sm2_locl.h"
 
 int SM2_KAP_CTX_init(SM2_KAP_CTX *ctx, EC_KEY *ec_key,
 	EC_KEY *remote_pubkey, int is_initiator, int do_checksum)
@@ -330,14 +331,21 @@ int SM2_KAP_prepare(SM2_KAP_CTX *ctx, unsigned char *ephem_point,
 		goto end;
 	}
 
-	if (!BN_mod_mul(ctx->t, x, r, ctx->order, ctx->bn_ctx)) {
-		SM2err(SM2_F_SM2_KAP_PREPARE, ERR_R_BN_LIB);
-		goto end;
-	}
-
-	if (!BN_mod_add(ctx->t, ctx->t, prikey, ctx->order, ctx->bn_ctx)) {
-		SM2err(SM2_F_SM2_KAP_PREPARE, ERR_R_BN_LIB);
-		goto end;
+#ifdef SM2_Z256
+	if (sm2_z256_group(ctx->group)) {
+		if (!sm2_z256_mul_add(ctx->t, x, r, prikey)) {
+			SM2err(SM2_F_SM2_KAP_PREPARE, ERR_R_BN_LIB);
+			goto end;
+		}
+	} else
+#endif
+	{
+		if (!BN_mod_mul(ctx->t, x, r, ctx->order, ctx->bn_ctx) ||
+			!BN_mod_add(ctx->t, ctx->t, prikey, ctx->order,
+			ctx->bn_ctx)) {
+			SM2err(SM2_F_SM2_KAP_PREPARE, ERR_R_BN_LIB);
+			goto end;
+		}
 	}
 
 	if (!EC_GROUP_get_cofactor(ctx->group, h, ctx->bn_ctx)) {
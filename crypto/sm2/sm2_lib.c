@@ -208,12 +208,14 @@ int SM2_compute_id_digest(const EVP_MD *md, unsigned char *dgst,
 	unsigned int *dgstlen, EC_KEY *ec_key)
 {
         int ret = 0;
-        EVP_MD_CTX *md_ctx = NULL;
+        EVP_MD_CTX md_ctx;
         unsigned char pkdata[EC_MAX_NBYTES * 6];
 	unsigned char idbits[2];
 	int pkdatalen;
 	char *id;
 	
+	EVP_MD_CTX_init(&md_ctx);
+
 	if ((pkdatalen = sm2_get_public_key_data(pkdata, ec_key)) < 0) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto err;
@@ -228,28 +230,24 @@ int SM2_compute_id_digest(const EVP_MD *md, unsigned char *dgst,
 	idbits[1] = (strlen(id) * 8) % 256;
 
 
-	if (!(md_ctx = EVP_MD_CTX_create())) {
-		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
-		goto err;
-	}
-	if (!EVP_DigestInit_ex(md_ctx, md, NULL)) {
+	if (!EVP_DigestInit_ex(&md_ctx, md, NULL)) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		ERR_print_errors_fp(stderr);
 		goto err;
 	}
-	if (!EVP_DigestUpdate(md_ctx, idbits, sizeof(idbits))) {
+	if (!EVP_DigestUpdate(&md_ctx, idbits, sizeof(idbits))) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto err;
 	}
-	if (!EVP_DigestUpdate(md_ctx, id, strlen(id))) {
+	if (!EVP_DigestUpdate(&md_ctx, id, strlen(id))) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto err;
 	}
-	if (!EVP_DigestUpdate(md_ctx, pkdata, pkdatalen)) {
+	if (!EVP_DigestUpdate(&md_ctx, pkdata, pkdatalen)) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto err;
 	}
-	if (!EVP_DigestFinal_ex(md_ctx, dgst, dgstlen)) {
+	if (!EVP_DigestFinal_ex(&md_ctx, dgst, dgstlen)) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto err;
 	}
@@ -257,7 +255,7 @@ int SM2_compute_id_digest(const EVP_MD *md, unsigned char *dgst,
 	ret = 1;
 
 err:
-	if (md_ctx) EVP_MD_CTX_destroy(md_ctx);
+	EVP_MD_CTX_cleanup(&md_ctx);
         return ret;
 }
 
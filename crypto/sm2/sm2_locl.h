@@ -69,6 +69,32 @@ typedef struct sm2_data_st {
 
 SM2_DATA *sm2_check(EC_KEY *eckey);
 
+/* a new reference to the verification table of the public key, or NULL */
+EC_POINT_TABLE *sm2_get_verify_table(EC_KEY *ec_key, BN_CTX *ctx);
+
+/*
+ * constant time arithmetic modulo the order of sm2p256v1 on fixed 64-bit
+ * limbs, used for the secret scalars when sm2_z256_group() is true
+ */
+#if !defined(OPENSSL_NO_SM2Z256) && defined(SIXTY_FOUR_BIT_LONG) && \
+	defined(__SIZEOF_INT128__)
+# define SM2_Z256
+# define SM2_Z256_LIMBS		4
+
+int sm2_z256_group(const EC_GROUP *group);
+/* r = (1 + d)^-1 mod n */
+int sm2_z256_inv_1_plus_d(BIGNUM *r, const BIGNUM *d);
+/*
+ * r = e + x, s = d_inv * (k + r) - r (mod n), returns -1 if r, r + k or s
+ * is 0 and another k is needed
+ */
+int sm2_z256_sign_rs(BIGNUM *r, BIGNUM *s, const BIGNUM *e,
+	const BIGNUM *x, const BIGNUM *k, const BIGNUM *d_inv);
+/* r = a * b + c mod n */
+int sm2_z256_mul_add(BIGNUM *r, const BIGNUM *a, const BIGNUM *b,
+	const BIGNUM *c);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,499 @@
+/* crypto/sm2/sm2_presign.c */
+/* ====================================================================
+ * Copyright (c) 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * A pool of SM2 signing values (k, (kG).x mod n) computed ahead of the
+ * messages. The values are kept as fixed length big-endian strings in a
+ * ring of `size' slots, filled by SM2_PRESIGN_POOL_fill() or by a
+ * background thread, and a slot is wiped as soon as it is taken. The pool
+ * remembers the process that filled it, a child after fork() finds it
+ * empty instead of using the same k as its parent.
+ *
+ * A value is taken under a mutex rather than with one atomic operation:
+ * a slot is two field elements that are copied out and wiped, which a
+ * single compare-and-swap of the head does not cover without per-slot
+ * sequence numbers, and the tree has no portable atomics. The lock is
+ * held only for that copy. pthread_atfork() handlers take every pool
+ * lock around fork(), so a child never inherits a lock held by the
+ * refill thread of its parent.
+ */
+
+#include <string.h>
+#include <openssl/e_os2.h>
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/objects.h>
+#include <openssl/sm2.h>
+
+#ifdef OPENSSL_SYS_UNIX
+# include <sys/types.h>
+# include <unistd.h>
+#endif
+#if defined(OPENSSL_THREADS) && defined(OPENSSL_SYS_UNIX)
+# define SM2_PRESIGN_THREADS
+# include <pthread.h>
+#endif
+
+#define SM2_PRESIGN_MAX_NBYTES	((OPENSSL_ECC_MAX_FIELD_BITS + 7)/8)
+/* values computed by the thread between two checks for SM2_PRESIGN_POOL_stop() */
+#define SM2_PRESIGN_CHUNK	16
+
+typedef struct {
+	unsigned char k[SM2_PRESIGN_MAX_NBYTES];
+	unsigned char x[SM2_PRESIGN_MAX_NBYTES];
+} SM2_PRESIGN;
+
+struct sm2_presign_pool_st {
+	EC_GROUP *group;
+	BIGNUM *order;
+	int nbytes;
+	SM2_PRESIGN *slots;
+	size_t size;
+	size_t head;
+	size_t count;
+#ifdef OPENSSL_SYS_UNIX
+	pid_t pid;
+#endif
+#ifdef SM2_PRESIGN_THREADS
+	pthread_mutex_t mutex;
+	pthread_cond_t not_full;
+	pthread_t tid;
+	int running;
+	int stop;
+	struct sm2_presign_pool_st *next;
+#endif
+};
+
+#ifdef SM2_PRESIGN_THREADS
+# define POOL_LOCK(pool)	pthread_mutex_lock(&(pool)->mutex)
+# define POOL_UNLOCK(pool)	pthread_mutex_unlock(&(pool)->mutex)
+#else
+# define POOL_LOCK(pool)	CRYPTO_w_lock(CRYPTO_LOCK_ECDSA)
+# define POOL_UNLOCK(pool)	CRYPTO_w_unlock(CRYPTO_LOCK_ECDSA)
+#endif
+
+/*
+ * called with the lock held. In a child of the process that filled the
+ * pool the values are wiped, they are also in the parent, and the thread
+ * of the parent is forgotten as it does not run in the child.
+ */
+static void sm2_presign_check_pid(SM2_PRESIGN_POOL *pool)
+{
+#ifdef OPENSSL_SYS_UNIX
+	pid_t pid = getpid();
+
+	if (pool->pid == pid)
+		return;
+	OPENSSL_cleanse(pool->slots, sizeof(SM2_PRESIGN) * pool->size);
+	pool->head = 0;
+	pool->count = 0;
+	pool->pid = pid;
+# ifdef SM2_PRESIGN_THREADS
+	pool->running = 0;
+# endif
+#endif
+}
+
+#ifdef SM2_PRESIGN_THREADS
+/* the live pools, for the fork handlers */
+static pthread_mutex_t sm2_presign_pools_lock = PTHREAD_MUTEX_INITIALIZER;
+static SM2_PRESIGN_POOL *sm2_presign_pools = NULL;
+static pthread_once_t sm2_presign_atfork_once = PTHREAD_ONCE_INIT;
+
+static void sm2_presign_prepare(void)
+{
+	SM2_PRESIGN_POOL *pool;
+
+	pthread_mutex_lock(&sm2_presign_pools_lock);
+	for (pool = sm2_presign_pools; pool; pool = pool->next)
+		pthread_mutex_lock(&pool->mutex);
+}
+
+static void sm2_presign_parent(void)
+{
+	SM2_PRESIGN_POOL *pool;
+
+	for (pool = sm2_presign_pools; pool; pool = pool->next)
+		pthread_mutex_unlock(&pool->mutex);
+	pthread_mutex_unlock(&sm2_presign_pools_lock);
+}
+
+/* the refill thread is not in the child, nobody waits on not_full */
+static void sm2_presign_child(void)
+{
+	SM2_PRESIGN_POOL *pool;
+
+	for (pool = sm2_presign_pools; pool; pool = pool->next) {
+		sm2_presign_check_pid(pool);
+		pthread_cond_init(&pool->not_full, NULL);
+		pthread_mutex_unlock(&pool->mutex);
+	}
+	pthread_mutex_unlock(&sm2_presign_pools_lock);
+}
+
+static void sm2_presign_atfork_init(void)
+{
+	pthread_atfork(sm2_presign_prepare, sm2_presign_parent,
+		sm2_presign_child);
+}
+#endif
+
+SM2_PRESIGN_POOL *SM2_PRESIGN_POOL_new(const EC_GROUP *group, size_t size)
+{
+	SM2_PRESIGN_POOL *ret = NULL;
+
+	if (!group || size == 0 ||
+		EC_METHOD_get_field_type(EC_GROUP_method_of(group)) !=
+		NID_X9_62_prime_field) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, SM2_R_BAD_DATA);
+		return NULL;
+	}
+	if (size > ((size_t)-1) / sizeof(SM2_PRESIGN)) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, SM2_R_BAD_DATA);
+		return NULL;
+	}
+
+	if (!(ret = OPENSSL_malloc(sizeof(*ret)))) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, ERR_R_MALLOC_FAILURE);
+		return NULL;
+	}
+	memset(ret, 0, sizeof(*ret));
+
+	ret->group = EC_GROUP_dup(group);
+	ret->order = BN_new();
+	ret->slots = OPENSSL_malloc(sizeof(SM2_PRESIGN) * size);
+	if (!ret->group || !ret->order || !ret->slots) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, ERR_R_MALLOC_FAILURE);
+		goto err;
+	}
+	if (!EC_GROUP_get_order(group, ret->order, NULL)) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, ERR_R_EC_LIB);
+		goto err;
+	}
+	ret->nbytes = BN_num_bytes(ret->order);
+	ret->size = size;
+#ifdef OPENSSL_SYS_UNIX
+	ret->pid = getpid();
+#endif
+
+#ifdef SM2_PRESIGN_THREADS
+	if (pthread_mutex_init(&ret->mutex, NULL) != 0) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, ERR_R_INTERNAL_ERROR);
+		goto err;
+	}
+	if (pthread_cond_init(&ret->not_full, NULL) != 0) {
+		pthread_mutex_destroy(&ret->mutex);
+		SM2err(SM2_F_SM2_PRESIGN_POOL_NEW, ERR_R_INTERNAL_ERROR);
+		goto err;
+	}
+	pthread_once(&sm2_presign_atfork_once, sm2_presign_atfork_init);
+	pthread_mutex_lock(&sm2_presign_pools_lock);
+	ret->next = sm2_presign_pools;
+	sm2_presign_pools = ret;
+	pthread_mutex_unlock(&sm2_presign_pools_lock);
+#endif
+	return ret;
+
+err:
+	if (ret->group) EC_GROUP_free(ret->group);
+	if (ret->order) BN_free(ret->order);
+	if (ret->slots) OPENSSL_free(ret->slots);
+	OPENSSL_free(ret);
+	return NULL;
+}
+
+void SM2_PRESIGN_POOL_free(SM2_PRESIGN_POOL *pool)
+{
+#ifdef SM2_PRESIGN_THREADS
+	SM2_PRESIGN_POOL **p;
+#endif
+
+	if (!pool)
+		return;
+
+	SM2_PRESIGN_POOL_stop(pool);
+#ifdef SM2_PRESIGN_THREADS
+	pthread_mutex_lock(&sm2_presign_pools_lock);
+	for (p = &sm2_presign_pools; *p; p = &(*p)->next) {
+		if (*p == pool) {
+			*p = pool->next;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&sm2_presign_pools_lock);
+	pthread_cond_destroy(&pool->not_full);
+	pthread_mutex_destroy(&pool->mutex);
+#endif
+	OPENSSL_cleanse(pool->slots, sizeof(SM2_PRESIGN) * pool->size);
+	OPENSSL_free(pool->slots);
+	EC_GROUP_free(pool->group);
+	BN_free(pool->order);
+	OPENSSL_free(pool);
+}
+
+/* k in [1, n-1] and x = (kG).x mod n, k is flagged BN_FLG_CONSTTIME */
+static int sm2_presign_compute(SM2_PRESIGN_POOL *pool, SM2_PRESIGN *out,
+	BIGNUM *k, BIGNUM *x, EC_POINT *point, BN_CTX *ctx)
+{
+	do {
+		do {
+			if (!BN_rand_range(k, pool->order)) {
+				SM2err(SM2_F_SM2_PRESIGN_POOL_FILL,
+					SM2_R_RANDOM_NUMBER_GENERATION_FAILED);
+				return 0;
+			}
+		} while (BN_is_zero(k));
+
+		if (!EC_POINT_mul(pool->group, point, k, NULL, NULL, ctx) ||
+			!EC_POINT_get_affine_coordinates_GFp(pool->group, point,
+			x, NULL, ctx) ||
+			!BN_nnmod(x, x, pool->order, ctx)) {
+			SM2err(SM2_F_SM2_PRESIGN_POOL_FILL, ERR_R_EC_LIB);
+			return 0;
+		}
+	} while (BN_is_zero(x));
+
+	memset(out, 0, sizeof(*out));
+	BN_bn2bin(k, out->k + pool->nbytes - BN_num_bytes(k));
+	BN_bn2bin(x, out->x + pool->nbytes - BN_num_bytes(x));
+	return 1;
+}
+
+/* add one value, returns 0 if the pool is full */
+static int sm2_presign_push(SM2_PRESIGN_POOL *pool, const SM2_PRESIGN *in)
+{
+	int ret = 0;
+
+	POOL_LOCK(pool);
+	sm2_presign_check_pid(pool);
+	if (pool->count < pool->size) {
+		memcpy(&pool->slots[(pool->head + pool->count) % pool->size],
+			in, sizeof(*in));
+		pool->count++;
+		ret = 1;
+	}
+	POOL_UNLOCK(pool);
+	return ret;
+}
+
+/*
+ * adds up to n values and returns the number added, it stops early when
+ * the pool is full. This is the idle-time alternative to the thread.
+ */
+size_t SM2_PRESIGN_POOL_fill(SM2_PRESIGN_POOL *pool, size_t n)
+{
+	size_t ret = 0;
+	SM2_PRESIGN value;
+	BN_CTX *ctx = NULL;
+	BIGNUM *k, *x;
+	EC_POINT *point = NULL;
+
+	if (!(ctx = BN_CTX_new()) ||
+		!(point = EC_POINT_new(pool->group))) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_FILL, ERR_R_MALLOC_FAILURE);
+		goto end;
+	}
+	BN_CTX_start(ctx);
+	k = BN_CTX_get(ctx);
+	x = BN_CTX_get(ctx);
+	if (!x) {
+		SM2err(SM2_F_SM2_PRESIGN_POOL_FILL, ERR_R_MALLOC_FAILURE);
+		goto end;
+	}
+	BN_set_flags(k, BN_FLG_CONSTTIME);
+
+	while (ret < n && SM2_PRESIGN_POOL_count(pool) < pool->size) {
+		if (!sm2_presign_compute(pool, &value, k, x, point, ctx) ||
+			!sm2_presign_push(pool, &value))
+			break;
+		ret++;
+	}
+
+	BN_clear(k);
+	OPENSSL_cleanse(&value, sizeof(value));
+end:
+	if (point) EC_POINT_free(point);
+	if (ctx) {
+		BN_CTX_end(ctx);
+		BN_CTX_free(ctx);
+	}
+	return ret;
+}
+
+size_t SM2_PRESIGN_POOL_count(SM2_PRESIGN_POOL *pool)
+{
+	size_t ret;
+
+	POOL_LOCK(pool);
+	sm2_presign_check_pid(pool);
+	ret = pool->count;
+	POOL_UNLOCK(pool);
+	return ret;
+}
+
+/*
+ * takes the oldest value, k and x are set to k and (kG).x mod n. Returns
+ * 0 if the pool is empty, the caller then computes its own k.
+ */
+int SM2_PRESIGN_POOL_get(SM2_PRESIGN_POOL *pool, BIGNUM *k, BIGNUM *x)
+{
+	SM2_PRESIGN value;
+	SM2_PRESIGN *slot;
+	int ret = 0;
+
+	POOL_LOCK(pool);
+	sm2_presign_check_pid(pool);
+	if (pool->count > 0) {
+		slot = &pool->slots[pool->head];
+		memcpy(&value, slot, sizeof(value));
+		OPENSSL_cleanse(slot, sizeof(*slot));
+		pool->head = (pool->head + 1) % pool->size;
+		pool->count--;
+		ret = 1;
+#ifdef SM2_PRESIGN_THREADS
+		pthread_cond_signal(&pool->not_full);
+#endif
+	}
+	POOL_UNLOCK(pool);
+
+	if (ret && (!BN_bin2bn(value.k, pool->nbytes, k) ||
+		!BN_bin2bn(value.x, pool->nbytes, x)))
+		ret = 0;
+	OPENSSL_cleanse(&value, sizeof(value));
+	return ret;
+}
+
+#ifdef SM2_PRESIGN_THREADS
+static void *sm2_presign_worker(void *arg)
+{
+	SM2_PRESIGN_POOL *pool = (SM2_PRESIGN_POOL *)arg;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->mutex);
+		while (!pool->stop && pool->count == pool->size)
+			pthread_cond_wait(&pool->not_full, &pool->mutex);
+		if (pool->stop) {
+			pthread_mutex_unlock(&pool->mutex);
+			break;
+		}
+		pthread_mutex_unlock(&pool->mutex);
+
+		if (SM2_PRESIGN_POOL_fill(pool, SM2_PRESIGN_CHUNK) == 0 &&
+			SM2_PRESIGN_POOL_count(pool) < pool->size) {
+			/*
+			 * gives up on an error, SM2_PRESIGN_POOL_start() can
+			 * then start another thread. Unless a stop is under
+			 * way, which joins this one, nobody will join it.
+			 */
+			pthread_mutex_lock(&pool->mutex);
+			if (!pool->stop) {
+				pool->running = 0;
+				pthread_detach(pthread_self());
+			}
+			pthread_mutex_unlock(&pool->mutex);
+			break;
+		}
+	}
+	ERR_remove_thread_state(NULL);
+	return NULL;
+}
+#endif
+
+/*
+ * starts a thread that keeps the pool full, returns 0 if threads are not
+ * available, SM2_PRESIGN_POOL_fill() can then be called when idle
+ */
+int SM2_PRESIGN_POOL_start(SM2_PRESIGN_POOL *pool)
+{
+#ifdef SM2_PRESIGN_THREADS
+	int ret = 1;
+
+	pthread_mutex_lock(&pool->mutex);
+	sm2_presign_check_pid(pool);
+	if (!pool->running) {
+		pool->stop = 0;
+		if (pthread_create(&pool->tid, NULL, sm2_presign_worker,
+			pool) == 0)
+			pool->running = 1;
+		else
+			ret = 0;
+	}
+	pthread_mutex_unlock(&pool->mutex);
+	return ret;
+#else
+	return 0;
+#endif
+}
+
+void SM2_PRESIGN_POOL_stop(SM2_PRESIGN_POOL *pool)
+{
+#ifdef SM2_PRESIGN_THREADS
+	int running;
+
+	pthread_mutex_lock(&pool->mutex);
+	sm2_presign_check_pid(pool);
+	running = pool->running;
+	pool->stop = 1;
+	pool->running = 0;
+	pthread_cond_signal(&pool->not_full);
+	pthread_mutex_unlock(&pool->mutex);
+
+	if (running)
+		pthread_join(pool->tid, NULL);
+#endif
+}
+
+const EC_GROUP *SM2_PRESIGN_POOL_get0_group(const SM2_PRESIGN_POOL *pool)
+{
+	return pool->group;
+}
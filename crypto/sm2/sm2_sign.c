@@ -57,6 +57,7 @@
 #include <openssl/bn.h>
 #include <openssl/rand.h>
 #include <openssl/sm2.h>
+#include "sm2_locl.h"
 
 
 /* k in [1, n-1], (x, y) = kG */
@@ -163,6 +164,41 @@ err:
 	return(ret);
 }
 
+/* d_inv = (1 + d)^-1 mod n */
+static int sm2_compute_d_inv(const EC_GROUP *group, BIGNUM *d_inv,
+	const BIGNUM *d, const BIGNUM *order, BN_CTX *ctx)
+{
+#ifdef SM2_Z256
+	if (sm2_z256_group(group))
+		return sm2_z256_inv_1_plus_d(d_inv, d);
+#endif
+	return BN_mod_add(d_inv, d, BN_value_one(), order, ctx) &&
+		BN_mod_inverse(d_inv, d_inv, order, ctx) != NULL;
+}
+
+/*
+ * r = e + x, s = d_inv * (k + r) - r (mod n), which is (1 + d)^-1 * (k - rd).
+ * Returns -1 if r, r + k or s is 0 and another k is needed, tmp is scratch.
+ */
+static int sm2_compute_rs(const EC_GROUP *group, BIGNUM *r, BIGNUM *s,
+	const BIGNUM *e, const BIGNUM *x, const BIGNUM *k, const BIGNUM *d_inv,
+	const BIGNUM *order, BIGNUM *tmp, BN_CTX *ctx)
+{
+#ifdef SM2_Z256
+	if (sm2_z256_group(group) && BN_num_bits(e) <= 256)
+		return sm2_z256_sign_rs(r, s, e, x, k, d_inv);
+#endif
+	if (!BN_mod_add(r, e, x, order, ctx) ||
+		!BN_mod_add(tmp, r, k, order, ctx))
+		return 0;
+	if (BN_is_zero(r) || BN_is_zero(tmp))
+		return -1;
+	if (!BN_mod_mul(s, d_inv, tmp, order, ctx) ||
+		!BN_mod_sub(s, s, r, order, ctx))
+		return 0;
+	return BN_is_zero(s) ? -1 : 1;
+}
+
 static ECDSA_SIG *sm2_do_sign(const unsigned char *dgst, int dgst_len,
 	const BIGNUM *in_k, const BIGNUM *in_x, EC_KEY *ec_key)
 {
@@ -171,11 +207,15 @@ static ECDSA_SIG *sm2_do_sign(const unsigned char *dgst, int dgst_len,
 	const EC_GROUP *ec_group;
 	const BIGNUM *priv_key;
 	const BIGNUM *ck;
+	const BIGNUM *cx;
 	BIGNUM *k = NULL;
+	BIGNUM *x = NULL;
 	BN_CTX *ctx = NULL;
 	BIGNUM *order = NULL;
 	BIGNUM *e = NULL;
 	BIGNUM *bn = NULL;
+	BIGNUM *d_inv = NULL;
+	int rs;
 	int i;
 
 	ec_group = EC_KEY_get0_group(ec_key);
@@ -194,7 +234,8 @@ static ECDSA_SIG *sm2_do_sign(const unsigned char *dgst, int dgst_len,
 	order = BN_new();
 	e = BN_new();
 	bn = BN_new();
-	if (!ctx || !order || !e || !bn) {
+	d_inv = BN_new();
+	if (!ctx || !order || !e || !bn || !d_inv) {
 		ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_MALLOC_FAILURE);
 		goto err;
 	}
@@ -222,81 +263,41 @@ static ECDSA_SIG *sm2_do_sign(const unsigned char *dgst, int dgst_len,
 	}
 #endif
 
+	/* (1 + d)^-1 is the same for every k */
+	if (!sm2_compute_d_inv(ec_group, d_inv, priv_key, order, ctx)) {
+		ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
+		goto err;
+	}
+
 	do {
 		/* use or compute k and (kG).x */
 		if (!in_k || !in_x) {
-			if (!sm2_sign_setup(ec_key, ctx, &k, &ret->r)) {
+			if (!sm2_sign_setup(ec_key, ctx, &k, &x)) {
 				ECDSAerr(ECDSA_F_ECDSA_DO_SIGN,ERR_R_ECDSA_LIB);
 				goto err;
 			}
 			ck = k;
+			cx = x;
 		} else {
 			ck = in_k;
-			if (!BN_copy(ret->r, in_x)) {
-				ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_MALLOC_FAILURE);
-				goto err;
-			}
-		}
-
-
-		/* r = e + x (mod n) */	
-		if (!BN_mod_add(ret->r, ret->r, e, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
-			goto err;
-		}
-
-
-		if (!BN_mod_add(bn, ret->r, ck, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
-			goto err;
-		}
-
-		/* check r != 0 && r + k != n */
-		if (BN_is_zero(ret->r) || BN_is_zero(bn)) {
-			if (in_k && in_x) {
-				ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ECDSA_R_NEED_NEW_SETUP_VALUES);
-				goto err;
-			} else
-				continue;
+			cx = in_x;
 		}
 
-		/* s = ((1 + d)^-1 * (k - rd)) mod n */
-		if (!BN_one(bn)) {
+		/*
+		 * r = e + x (mod n), s = ((1 + d)^-1 * (k - rd)) mod n,
+		 * r = 0, r + k = n or s = 0 need another k
+		 */
+		if (!(rs = sm2_compute_rs(ec_group, ret->r, ret->s, e, cx, ck,
+			d_inv, order, bn, ctx))) {
 			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
 			goto err;
 		}
-		if (!BN_mod_add(ret->s, priv_key, bn, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
-			goto err;
-		}
-		if (!BN_mod_inverse(ret->s, ret->s, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
-			goto err;
-		}
-
-		if (!BN_mod_mul(bn, ret->r, priv_key, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
+		if (rs < 0 && in_k && in_x) {
+			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ECDSA_R_NEED_NEW_SETUP_VALUES);
 			goto err;
 		}
-		if (!BN_mod_sub(bn, ck, bn, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
-			goto err;
-		}
-		if (!BN_mod_mul(ret->s, ret->s, bn, order, ctx)) {
-			ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ERR_R_BN_LIB);
-			goto err;
-		}
-
-		/* check s != 0 */
-		if (BN_is_zero(ret->s)) {
-			if (in_k && in_x) {
-				ECDSAerr(ECDSA_F_ECDSA_DO_SIGN, ECDSA_R_NEED_NEW_SETUP_VALUES);
-				goto err;
-			}
-		} else
-			break;
 
-	} while (1);
+	} while (rs < 0);
 
 	ok = 1;
 
@@ -305,7 +306,9 @@ err:
 		ECDSA_SIG_free(ret);
 		ret = NULL;
 	}
-	if (k) BN_free(k);	
+	if (k) BN_clear_free(k);
+	if (x) BN_free(x);
+	if (d_inv) BN_clear_free(d_inv);
 	if (ctx) BN_CTX_free(ctx);
 	if (order) BN_free(order);
 	if (e) BN_free(e);
@@ -320,6 +323,7 @@ int sm2_do_verify(const unsigned char *dgst, int dgstlen,
 	int ret = SM2_VERIFY_INNER_ERROR;
 	const EC_GROUP *ec_group;
 	const EC_POINT *pub_key;
+	EC_POINT_TABLE *table = NULL;
 	EC_POINT *point = NULL;
 	BN_CTX *ctx = NULL;
 	BIGNUM *order = NULL;
@@ -395,7 +399,12 @@ int sm2_do_verify(const unsigned char *dgst, int dgstlen,
 		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY, ERR_R_MALLOC_FAILURE);
 		goto err;
 	}
-	if (!EC_POINT_mul(ec_group, point, sig->s, pub_key, t, ctx)) {
+	if ((table = sm2_get_verify_table(ec_key, ctx)) != NULL) {
+		if (!EC_POINT_mul_table(ec_group, point, sig->s, table, t, ctx)) {
+			ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY, ERR_R_EC_LIB);
+			goto err;
+		}
+	} else if (!EC_POINT_mul(ec_group, point, sig->s, pub_key, t, ctx)) {
 		ECDSAerr(ECDSA_F_ECDSA_DO_VERIFY, ERR_R_EC_LIB);
 		goto err;
 	}
@@ -428,6 +437,7 @@ int sm2_do_verify(const unsigned char *dgst, int dgstlen,
 
 err:
 	if (point) EC_POINT_free(point);
+	EC_POINT_TABLE_free(table);
 	if (order) BN_free(order);
 	if (e) BN_free(e);
 	if (t) BN_free(t);
@@ -514,3 +524,201 @@ err:
 	return ret;
 }
 
+
+int SM2_SIGN_CTX_init(SM2_SIGN_CTX *ctx, EC_KEY *ec_key)
+{
+	int ret = 0;
+	const BIGNUM *priv_key;
+
+	memset(ctx, 0, sizeof(*ctx));
+	EVP_MD_CTX_init(&ctx->md_ctx);
+
+	ctx->id_dgst_md = EVP_sm3();
+	ctx->msg_md = EVP_sm3();
+
+	if (!ec_key || !(ctx->group = EC_KEY_get0_group(ec_key)) ||
+		!(priv_key = EC_KEY_get0_private_key(ec_key))) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_PASSED_NULL_PARAMETER);
+		goto end;
+	}
+
+	if (!SM2_compute_id_digest(ctx->id_dgst_md, ctx->id_dgst,
+		&ctx->id_dgstlen, ec_key)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_SM2_LIB);
+		goto end;
+	}
+	if (!EVP_DigestInit_ex(&ctx->md_ctx, ctx->msg_md, NULL)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_EVP_LIB);
+		goto end;
+	}
+
+	ctx->bn_ctx = BN_CTX_new();
+	ctx->order = BN_new();
+	ctx->d_inv = BN_new();
+	ctx->k = BN_new();
+	ctx->x = BN_new();
+	ctx->e = BN_new();
+	ctx->point = EC_POINT_new(ctx->group);
+
+	if (!ctx->bn_ctx || !ctx->order || !ctx->d_inv || !ctx->k ||
+		!ctx->x || !ctx->e || !ctx->point) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_MALLOC_FAILURE);
+		goto end;
+	}
+	BN_set_flags(ctx->k, BN_FLG_CONSTTIME);
+
+	if (!EC_GROUP_get_order(ctx->group, ctx->order, ctx->bn_ctx)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_EC_LIB);
+		goto end;
+	}
+
+	/* d_inv = (1 + d)^-1 mod n */
+	if (!sm2_compute_d_inv(ctx->group, ctx->d_inv, priv_key, ctx->order,
+		ctx->bn_ctx)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_BN_LIB);
+		goto end;
+	}
+
+	if (!EC_KEY_up_ref(ec_key)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_INIT, ERR_R_EC_LIB);
+		goto end;
+	}
+	ctx->ec_key = ec_key;
+
+	ret = 1;
+end:
+	if (!ret) SM2_SIGN_CTX_cleanup(ctx);
+	return ret;
+}
+
+/* as sm2_do_sign() with the values of the key taken from ctx */
+ECDSA_SIG *SM2_SIGN_CTX_do_sign(SM2_SIGN_CTX *ctx, const void *msg,
+	size_t msglen)
+{
+	ECDSA_SIG *ret = NULL;
+	unsigned char dgst[EVP_MAX_MD_SIZE];
+	unsigned int dgstlen;
+	BIGNUM *tmp;
+	int rs;
+
+	if (!ctx->ec_key) {
+		SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_PASSED_NULL_PARAMETER);
+		return NULL;
+	}
+
+	/* e = H(Z || M) */
+	if (!EVP_MD_CTX_reinit(&ctx->md_ctx) ||
+		!EVP_DigestUpdate(&ctx->md_ctx, ctx->id_dgst, ctx->id_dgstlen) ||
+		!EVP_DigestUpdate(&ctx->md_ctx, msg, msglen) ||
+		!EVP_DigestFinal_ex(&ctx->md_ctx, dgst, &dgstlen)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_EVP_LIB);
+		return NULL;
+	}
+	if (!BN_bin2bn(dgst, dgstlen, ctx->e)) {
+		SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_BN_LIB);
+		return NULL;
+	}
+
+	BN_CTX_start(ctx->bn_ctx);
+	if (!(tmp = BN_CTX_get(ctx->bn_ctx)) || !(ret = ECDSA_SIG_new())) {
+		SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_MALLOC_FAILURE);
+		BN_CTX_end(ctx->bn_ctx);
+		return NULL;
+	}
+
+	for (;;) {
+		/* k in [1, n-1], x = (kG).x, or a (k, x) of the pool */
+		if (!ctx->pool ||
+			!SM2_PRESIGN_POOL_get(ctx->pool, ctx->k, ctx->x)) {
+			do {
+				if (!BN_rand_range(ctx->k, ctx->order)) {
+					SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN,
+						SM2_R_RANDOM_NUMBER_GENERATION_FAILED);
+					goto err;
+				}
+			} while (BN_is_zero(ctx->k));
+
+			if (!EC_POINT_mul(ctx->group, ctx->point, ctx->k, NULL,
+				NULL, ctx->bn_ctx)) {
+				SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_EC_LIB);
+				goto err;
+			}
+			if (EC_METHOD_get_field_type(EC_GROUP_method_of(
+				ctx->group)) == NID_X9_62_prime_field) {
+				if (!EC_POINT_get_affine_coordinates_GFp(ctx->group,
+					ctx->point, ctx->x, NULL, ctx->bn_ctx)) {
+					SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_EC_LIB);
+					goto err;
+				}
+			} else /* NID_X9_62_characteristic_two_field */ {
+				if (!EC_POINT_get_affine_coordinates_GF2m(ctx->group,
+					ctx->point, ctx->x, NULL, ctx->bn_ctx)) {
+					SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_EC_LIB);
+					goto err;
+				}
+			}
+		}
+
+		/* r = e + x, s = (1 + d)^-1 * (k + r) - r (mod n) */
+		if (!(rs = sm2_compute_rs(ctx->group, ret->r, ret->s, ctx->e,
+			ctx->x, ctx->k, ctx->d_inv, ctx->order, tmp,
+			ctx->bn_ctx))) {
+			SM2err(SM2_F_SM2_SIGN_CTX_DO_SIGN, ERR_R_BN_LIB);
+			goto err;
+		}
+		if (rs > 0)
+			break;
+	}
+
+	BN_clear(ctx->k);
+	BN_CTX_end(ctx->bn_ctx);
+	return ret;
+
+err:
+	BN_clear(ctx->k);
+	BN_CTX_end(ctx->bn_ctx);
+	ECDSA_SIG_free(ret);
+	return NULL;
+}
+
+int SM2_SIGN_CTX_sign(SM2_SIGN_CTX *ctx, const void *msg, size_t msglen,
+	unsigned char *sig, unsigned int *siglen)
+{
+	ECDSA_SIG *s;
+
+	if (!(s = SM2_SIGN_CTX_do_sign(ctx, msg, msglen))) {
+		*siglen = 0;
+		return 0;
+	}
+
+	*siglen = i2d_ECDSA_SIG(s, &sig);
+	ECDSA_SIG_free(s);
+
+	return 1;
+}
+
+int SM2_SIGN_CTX_set_presign_pool(SM2_SIGN_CTX *ctx, SM2_PRESIGN_POOL *pool)
+{
+	if (pool && EC_GROUP_cmp(ctx->group,
+		SM2_PRESIGN_POOL_get0_group(pool), ctx->bn_ctx) != 0) {
+		SM2err(SM2_F_SM2_SIGN_CTX_SET_PRESIGN_POOL, SM2_R_BAD_DATA);
+		return 0;
+	}
+	ctx->pool = pool;
+	return 1;
+}
+
+void SM2_SIGN_CTX_cleanup(SM2_SIGN_CTX *ctx)
+{
+	EVP_MD_CTX_cleanup(&ctx->md_ctx);
+	if (ctx->ec_key) EC_KEY_free(ctx->ec_key);
+	if (ctx->bn_ctx) BN_CTX_free(ctx->bn_ctx);
+	if (ctx->order) BN_free(ctx->order);
+	if (ctx->d_inv) BN_clear_free(ctx->d_inv);
+	if (ctx->k) BN_clear_free(ctx->k);
+	if (ctx->x) BN_free(ctx->x);
+	if (ctx->e) BN_free(ctx->e);
+	if (ctx->point) EC_POINT_free(ctx->point);
+
+	OPENSSL_cleanse(ctx, sizeof(*ctx));
+}
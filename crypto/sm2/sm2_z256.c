@@ -0,0 +1,328 @@
+/* crypto/sm2/sm2_z256.c */
+/* ====================================================================
+ * Copyright (c) 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * Arithmetic modulo the order n of sm2p256v1 on 4 64-bit limbs, for the
+ * secret scalars of signing and key agreement. The values are taken out
+ * of the BIGNUMs once, the operations run in constant time in Montgomery
+ * form, and only the results are put back into BIGNUMs. The field
+ * arithmetic of the curve is the one of EC_GFp_sm2z256_method().
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/objects.h>
+#include <openssl/sm2.h>
+#include "sm2_locl.h"
+
+#ifdef SM2_Z256
+
+typedef __uint128_t u128;
+
+/* n, -n^-1 mod 2^64 and 2^512 mod n */
+static const BN_ULONG N[SM2_Z256_LIMBS] = {
+	0x53bbf40939d54123ULL, 0x7203df6b21c6052bULL,
+	0xffffffffffffffffULL, 0xfffffffeffffffffULL
+};
+static const BN_ULONG N0 = 0x327f9e8872350975ULL;
+static const BN_ULONG RR[SM2_Z256_LIMBS] = {
+	0x901192af7c114f20ULL, 0x3464504ade6fa2faULL,
+	0x620fc84c3affe0d4ULL, 0x1eb5e412a22b3d3bULL
+};
+static const BN_ULONG ONE[SM2_Z256_LIMBS] = { 1 };
+
+/* r = a - n if that does not borrow, else a, a is the 257-bit (carry, a[]) */
+static void modn_reduce_once(BN_ULONG r[SM2_Z256_LIMBS],
+	const BN_ULONG a[SM2_Z256_LIMBS], BN_ULONG carry)
+{
+	BN_ULONG t[SM2_Z256_LIMBS], mask;
+	u128 c = 0;
+	int i;
+
+	for (i = 0; i < SM2_Z256_LIMBS; i++) {
+		c = (u128)a[i] - N[i] - (BN_ULONG)(c >> 64 & 1);
+		t[i] = (BN_ULONG)c;
+	}
+	mask = (BN_ULONG)0 - ((BN_ULONG)(c >> 64 & 1) & ~carry);
+	for (i = 0; i < SM2_Z256_LIMBS; i++)
+		r[i] = (a[i] & mask) | (t[i] & ~mask);
+}
+
+static void modn_add(BN_ULONG r[SM2_Z256_LIMBS],
+	const BN_ULONG a[SM2_Z256_LIMBS], const BN_ULONG b[SM2_Z256_LIMBS])
+{
+	BN_ULONG t[SM2_Z256_LIMBS];
+	u128 c = 0;
+	int i;
+
+	for (i = 0; i < SM2_Z256_LIMBS; i++) {
+		c = (u128)a[i] + b[i] + (BN_ULONG)(c >> 64);
+		t[i] = (BN_ULONG)c;
+	}
+	modn_reduce_once(r, t, (BN_ULONG)(c >> 64));
+}
+
+static void modn_sub(BN_ULONG r[SM2_Z256_LIMBS],
+	const BN_ULONG a[SM2_Z256_LIMBS], const BN_ULONG b[SM2_Z256_LIMBS])
+{
+	BN_ULONG t[SM2_Z256_LIMBS], mask;
+	u128 c = 0;
+	int i;
+
+	for (i = 0; i < SM2_Z256_LIMBS; i++) {
+		c = (u128)a[i] - b[i] - (BN_ULONG)(c >> 64 & 1);
+		t[i] = (BN_ULONG)c;
+	}
+	/* add n back on a borrow */
+	mask = (BN_ULONG)0 - (BN_ULONG)(c >> 64 & 1);
+	c = 0;
+	for (i = 0; i < SM2_Z256_LIMBS; i++) {
+		c = (u128)t[i] + (N[i] & mask) + (BN_ULONG)(c >> 64);
+		r[i] = (BN_ULONG)c;
+	}
+}
+
+/* r = a*b*2^-256 mod n */
+static void modn_mul_mont(BN_ULONG r[SM2_Z256_LIMBS],
+	const BN_ULONG a[SM2_Z256_LIMBS], const BN_ULONG b[SM2_Z256_LIMBS])
+{
+	BN_ULONG t[2 * SM2_Z256_LIMBS], m, top = 0;
+	u128 c;
+	int i, j;
+
+	for (i = 0; i < SM2_Z256_LIMBS; i++) {
+		c = 0;
+		for (j = 0; j < SM2_Z256_LIMBS; j++) {
+			c += (u128)a[j] * b[i] + (i == 0 ? 0 : t[i + j]);
+			t[i + j] = (BN_ULONG)c;
+			c >>= 64;
+		}
+		t[i + SM2_Z256_LIMBS] = (BN_ULONG)c;
+	}
+
+	for (i = 0; i < SM2_Z256_LIMBS; i++) {
+		m = t[i] * N0;
+		c = ((u128)m * N[0] + t[i]) >> 64;
+		for (j = 1; j < SM2_Z256_LIMBS; j++) {
+			c += (u128)m * N[j] + t[i + j];
+			t[i + j] = (BN_ULONG)c;
+			c >>= 64;
+		}
+		c += (u128)t[i + SM2_Z256_LIMBS] + top;
+		t[i + SM2_Z256_LIMBS] = (BN_ULONG)c;
+		top = (BN_ULONG)(c >> 64);
+	}
+	modn_reduce_once(r, t + SM2_Z256_LIMBS, top);
+}
+
+/* r = a*b mod n */
+static void modn_mul(BN_ULONG r[SM2_Z256_LIMBS],
+	const BN_ULONG a[SM2_Z256_LIMBS], const BN_ULONG b[SM2_Z256_LIMBS])
+{
+	BN_ULONG t[SM2_Z256_LIMBS];
+
+	modn_mul_mont(t, a, b);
+	modn_mul_mont(r, t, RR);
+}
+
+/*
+ * r = a^(n-2) = a^-1 mod n, 0 for a = 0. The exponent is public, it is
+ * scanned in 4-bit windows from the top.
+ */
+static void modn_inv(BN_ULONG r[SM2_Z256_LIMBS],
+	const BN_ULONG a[SM2_Z256_LIMBS])
+{
+	static const BN_ULONG E[SM2_Z256_LIMBS] = {
+		0x53bbf40939d54121ULL, 0x7203df6b21c6052bULL,
+		0xffffffffffffffffULL, 0xfffffffeffffffffULL
+	};
+	BN_ULONG table[16][SM2_Z256_LIMBS];
+	BN_ULONG t[SM2_Z256_LIMBS];
+	unsigned int w;
+	int i, j;
+
+	/* table[i] = a^i in Montgomery form */
+	modn_mul_mont(table[1], a, RR);
+	modn_mul_mont(table[2], table[1], table[1]);
+	for (i = 3; i < 16; i++)
+		modn_mul_mont(table[i], table[i - 1], table[1]);
+
+	memcpy(t, table[E[SM2_Z256_LIMBS - 1] >> 60], sizeof(t));
+	for (i = 256 - 8; i >= 0; i -= 4) {
+		for (j = 0; j < 4; j++)
+			modn_mul_mont(t, t, t);
+		w = (unsigned int)(E[i / 64] >> (i % 64)) & 0xf;
+		if (w)
+			modn_mul_mont(t, t, table[w]);
+	}
+	modn_mul_mont(r, t, ONE);
+
+	OPENSSL_cleanse(table, sizeof(table));
+	OPENSSL_cleanse(t, sizeof(t));
+}
+
+static BN_ULONG modn_is_zero(const BN_ULONG a[SM2_Z256_LIMBS])
+{
+	BN_ULONG t = a[0] | a[1] | a[2] | a[3];
+
+	return (BN_ULONG)1 & ((t | (0 - t)) >> 63 ^ 1);
+}
+
+/*
+ * a in [0, 2^256) is loaded reduced mod n, as 2^256 < 2n once is enough.
+ * a may be shared (the EC_KEY private key), it is only read: its limbs
+ * are copied and the rest zero filled.
+ */
+static int modn_from_bn(BN_ULONG r[SM2_Z256_LIMBS], const BIGNUM *a)
+{
+	BN_ULONG t[SM2_Z256_LIMBS];
+	int i;
+
+	if (BN_is_negative(a) || a->top > SM2_Z256_LIMBS)
+		return 0;
+	for (i = 0; i < a->top; i++)
+		t[i] = a->d[i];
+	for (; i < SM2_Z256_LIMBS; i++)
+		t[i] = 0;
+	modn_reduce_once(r, t, 0);
+	OPENSSL_cleanse(t, sizeof(t));
+	return 1;
+}
+
+static int modn_to_bn(BIGNUM *r, const BN_ULONG a[SM2_Z256_LIMBS])
+{
+	if (!bn_wexpand(r, SM2_Z256_LIMBS))
+		return 0;
+	memcpy(r->d, a, sizeof(BN_ULONG) * SM2_Z256_LIMBS);
+	r->top = SM2_Z256_LIMBS;
+	r->neg = 0;
+	bn_correct_top(r);
+	return 1;
+}
+
+int sm2_z256_group(const EC_GROUP *group)
+{
+	return EC_GROUP_get_curve_name(group) == NID_sm2p256v1;
+}
+
+int sm2_z256_inv_1_plus_d(BIGNUM *r, const BIGNUM *d)
+{
+	int ret = 0;
+	BN_ULONG a[SM2_Z256_LIMBS];
+
+	if (!modn_from_bn(a, d))
+		return 0;
+	modn_add(a, a, ONE);
+	modn_inv(a, a);
+	if (!modn_is_zero(a))
+		ret = modn_to_bn(r, a);
+	OPENSSL_cleanse(a, sizeof(a));
+	return ret;
+}
+
+int sm2_z256_sign_rs(BIGNUM *r, BIGNUM *s, const BIGNUM *e,
+	const BIGNUM *x, const BIGNUM *k, const BIGNUM *d_inv)
+{
+	int ret = 0;
+	BN_ULONG tr[SM2_Z256_LIMBS];
+	BN_ULONG tk[SM2_Z256_LIMBS];
+	BN_ULONG ts[SM2_Z256_LIMBS];
+	BN_ULONG t[SM2_Z256_LIMBS];
+
+	if (!modn_from_bn(tr, e) || !modn_from_bn(t, x) ||
+		!modn_from_bn(tk, k) || !modn_from_bn(ts, d_inv))
+		goto end;
+
+	/* r = e + x, s = (1 + d)^-1 * (k + r) - r */
+	modn_add(tr, tr, t);
+	modn_add(tk, tk, tr);
+	modn_mul(ts, ts, tk);
+	modn_sub(ts, ts, tr);
+
+	/* r = 0, r + k = n and s = 0 need another k */
+	if (modn_is_zero(tr) | modn_is_zero(tk) | modn_is_zero(ts)) {
+		ret = -1;
+		goto end;
+	}
+	if (!modn_to_bn(r, tr) || !modn_to_bn(s, ts))
+		goto end;
+	ret = 1;
+
+end:
+	OPENSSL_cleanse(tk, sizeof(tk));
+	OPENSSL_cleanse(ts, sizeof(ts));
+	OPENSSL_cleanse(t, sizeof(t));
+	return ret;
+}
+
+int sm2_z256_mul_add(BIGNUM *r, const BIGNUM *a, const BIGNUM *b,
+	const BIGNUM *c)
+{
+	int ret = 0;
+	BN_ULONG ta[SM2_Z256_LIMBS];
+	BN_ULONG tb[SM2_Z256_LIMBS];
+	BN_ULONG tc[SM2_Z256_LIMBS];
+
+	if (modn_from_bn(ta, a) && modn_from_bn(tb, b) &&
+		modn_from_bn(tc, c)) {
+		modn_mul(ta, ta, tb);
+		modn_add(ta, ta, tc);
+		ret = modn_to_bn(r, ta);
+	}
+	OPENSSL_cleanse(ta, sizeof(ta));
+	OPENSSL_cleanse(tb, sizeof(tb));
+	OPENSSL_cleanse(tc, sizeof(tc));
+	return ret;
+}
+
+#endif
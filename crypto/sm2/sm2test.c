@@ -1,12 +1,19 @@
 #include <stdio.h>
 #include <string.h>
 #include <strings.h>
+#include <openssl/e_os2.h>
+#ifdef OPENSSL_SYS_UNIX
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
 #include <openssl/ec.h>
 #include <openssl/bn.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 #include <openssl/engine.h>
-#include "./sm2.h"
+#include <openssl/sm2.h>
+#include "../crypto/sm2/sm2_locl.h"
 
 RAND_METHOD fake_rand;
 const RAND_METHOD *old_rand;
@@ -337,7 +344,7 @@ int test_sm2_enc(const EC_GROUP *group,
 	}
 
 	buflen = sizeof(buf);
-	if (!SM2_encrypt(kdf_md, mac_md, point_form,
+	if (!SM2_encrypt_ex(kdf_md, mac_md, point_form,
 		(const unsigned char *)M, strlen(M), buf, &buflen, ec_key)) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto end;
@@ -355,7 +362,8 @@ int test_sm2_enc(const EC_GROUP *group,
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto end;
 	}
-	if (!SM2_decrypt(kdf_md, mac_md, point_form, buf, buflen,
+	msglen = sizeof(msg);
+	if (!SM2_decrypt_ex(kdf_md, mac_md, point_form, buf, buflen,
 		msg, &msglen, ec_key)) {
 		fprintf(stderr, "error: %s %d\n", __FILE__, __LINE__);
 		goto end;
@@ -663,6 +671,547 @@ end:
 }
 
 
+/* verify with the public key cache, valid and altered digests */
+int test_sm2_verify_cache(void)
+{
+	int ret = 0;
+	EC_KEY *ec_key = NULL;
+	EC_KEY *pubkey = NULL;
+	EC_KEY *other = NULL;
+	unsigned char dgst[32];
+	unsigned char sig[256];
+	unsigned char sig2[256];
+	unsigned int siglen, sig2len;
+	int i;
+
+	if (!SM2_set_verify_cache(2, 2)) {
+		goto err;
+	}
+	if (!(ec_key = EC_KEY_new_by_curve_name(NID_sm2p256v1)) ||
+		!EC_KEY_generate_key(ec_key) ||
+		!(other = EC_KEY_new_by_curve_name(NID_sm2p256v1))) {
+		goto err;
+	}
+	RAND_pseudo_bytes(dgst, sizeof(dgst));
+	if (!SM2_sign(NID_undef, dgst, sizeof(dgst), sig, &siglen, ec_key)) {
+		goto err;
+	}
+
+	for (i = 0; i < 8; i++) {
+		/* a new EC_KEY of the same public key now and then */
+		if (i % 3 == 0) {
+			EC_KEY_free(pubkey);
+			if (!(pubkey = EC_KEY_new_by_curve_name(NID_sm2p256v1)) ||
+				!EC_KEY_set_public_key(pubkey,
+					EC_KEY_get0_public_key(ec_key))) {
+				goto err;
+			}
+		}
+		if (SM2_verify(NID_undef, dgst, sizeof(dgst), sig, siglen,
+			pubkey) != SM2_VERIFY_SUCCESS) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		dgst[i] ^= 1;
+		if (SM2_verify(NID_undef, dgst, sizeof(dgst), sig, siglen,
+			pubkey) != SM2_VERIFY_FAILED) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		dgst[i] ^= 1;
+
+		/* other keys push the key out of the cache */
+		if (i == 4) {
+			int j;
+			for (j = 0; j < 3; j++) {
+				if (!EC_KEY_generate_key(other) ||
+					SM2_verify(NID_undef, dgst, sizeof(dgst),
+					sig, siglen, other) != SM2_VERIFY_FAILED) {
+					fprintf(stderr, "error: %s %d\n",
+						__FUNCTION__, __LINE__);
+					goto err;
+				}
+			}
+		}
+	}
+
+	/* the table of an EC_KEY follows a change of its public key */
+	if (!EC_KEY_generate_key(other) ||
+		!SM2_sign(NID_undef, dgst, sizeof(dgst), sig2, &sig2len, other)) {
+		goto err;
+	}
+	for (i = 0; i < 6; i++) {
+		if (i == 3 && !EC_KEY_set_public_key(pubkey,
+			EC_KEY_get0_public_key(other))) {
+			goto err;
+		}
+		if (SM2_verify(NID_undef, dgst, sizeof(dgst), sig, siglen,
+			pubkey) != (i < 3 ? SM2_VERIFY_SUCCESS : SM2_VERIFY_FAILED) ||
+			SM2_verify(NID_undef, dgst, sizeof(dgst), sig2, sig2len,
+			pubkey) != (i < 3 ? SM2_VERIFY_FAILED : SM2_VERIFY_SUCCESS)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+	}
+
+	ret = 1;
+err:
+	SM2_set_verify_cache(0, SM2_VERIFY_CACHE_THRESHOLD);
+	EC_KEY_free(ec_key);
+	EC_KEY_free(pubkey);
+	EC_KEY_free(other);
+	return ret;
+}
+
+int test_sm2_verify_batch(void)
+{
+	int ret = 0;
+	EC_KEY *keys[3] = {NULL, NULL, NULL};
+	EC_KEY *batch_keys[70];
+	ECDSA_SIG *sigs[70];
+	const unsigned char *dgsts[70];
+	unsigned char dgstbuf[70][32];
+	int results[70];
+	int i, nthreads;
+
+	memset(sigs, 0, sizeof(sigs));
+	for (i = 0; i < 3; i++) {
+		if (!(keys[i] = EC_KEY_new_by_curve_name(NID_sm2p256v1)) ||
+			!EC_KEY_generate_key(keys[i])) {
+			goto err;
+		}
+	}
+
+	/* mostly one key, a few signatures are broken */
+	for (i = 0; i < 70; i++) {
+		batch_keys[i] = keys[i < 50 ? 0 : (i < 60 ? 1 : 2)];
+		RAND_pseudo_bytes(dgstbuf[i], sizeof(dgstbuf[i]));
+		dgsts[i] = dgstbuf[i];
+		if (!(sigs[i] = SM2_do_sign(dgsts[i], 32, batch_keys[i]))) {
+			goto err;
+		}
+		if (i % 17 == 3) {
+			dgstbuf[i][0] ^= 1;
+		}
+	}
+	/* signed with another key */
+	batch_keys[65] = keys[0];
+
+	for (nthreads = 1; nthreads <= 4; nthreads += 3) {
+		SM2_set_verify_batch_threads(nthreads);
+		if (SM2_do_verify_batch(dgsts, 32, (const ECDSA_SIG **)sigs,
+			batch_keys, 70, results) != SM2_VERIFY_FAILED) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		for (i = 0; i < 70; i++) {
+			if (results[i] != SM2_do_verify(dgsts[i], 32, sigs[i],
+				batch_keys[i])) {
+				fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+				goto err;
+			}
+		}
+		if (SM2_do_verify_batch(dgsts, 32, (const ECDSA_SIG **)sigs,
+			batch_keys, 3, results) != SM2_VERIFY_SUCCESS) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+	}
+
+	ret = 1;
+err:
+	SM2_set_verify_batch_threads(0);
+	for (i = 0; i < 70; i++) {
+		ECDSA_SIG_free(sigs[i]);
+	}
+	for (i = 0; i < 3; i++) {
+		EC_KEY_free(keys[i]);
+	}
+	return ret;
+}
+
+int test_sm2_sign_ctx(void)
+{
+	int ret = 0;
+	EC_KEY *ec_key = NULL;
+	SM2_SIGN_CTX ctx;
+	unsigned char msg[100];
+	unsigned char dgst[32];
+	unsigned int dgstlen;
+	unsigned char sig[256];
+	unsigned int siglen;
+	int i;
+
+	memset(&ctx, 0, sizeof(ctx));
+	if (!(ec_key = EC_KEY_new_by_curve_name(NID_sm2p256v1)) ||
+		!EC_KEY_generate_key(ec_key) ||
+		!SM2_set_id(ec_key, "ALICE123@YAHOO.COM") ||
+		!SM2_SIGN_CTX_init(&ctx, ec_key)) {
+		goto err;
+	}
+
+	for (i = 0; i < 8; i++) {
+		RAND_pseudo_bytes(msg, sizeof(msg));
+		if (!SM2_SIGN_CTX_sign(&ctx, msg, i * 13, sig, &siglen)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		dgstlen = sizeof(dgst);
+		if (!SM2_digest(msg, i * 13, dgst, &dgstlen, ec_key) ||
+			SM2_verify(NID_undef, dgst, dgstlen, sig, siglen,
+			ec_key) != SM2_VERIFY_SUCCESS) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		dgst[0] ^= 1;
+		if (SM2_verify(NID_undef, dgst, dgstlen, sig, siglen,
+			ec_key) != SM2_VERIFY_FAILED) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+	}
+
+	ret = 1;
+err:
+	SM2_SIGN_CTX_cleanup(&ctx);
+	EC_KEY_free(ec_key);
+	return ret;
+}
+
+int test_sm2_presign_pool(void)
+{
+	int ret = 0;
+	EC_KEY *ec_key = NULL;
+	SM2_PRESIGN_POOL *pool = NULL;
+	SM2_SIGN_CTX ctx;
+	ECDSA_SIG *sig = NULL;
+	BIGNUM *k = NULL;
+	BIGNUM *x = NULL;
+	unsigned char msg[32];
+	unsigned char dgst[32];
+	unsigned int dgstlen;
+	int i;
+
+	memset(&ctx, 0, sizeof(ctx));
+	if (!(ec_key = EC_KEY_new_by_curve_name(NID_sm2p256v1)) ||
+		!EC_KEY_generate_key(ec_key) ||
+		!SM2_SIGN_CTX_init(&ctx, ec_key) ||
+		!(pool = SM2_PRESIGN_POOL_new(EC_KEY_get0_group(ec_key), 8)) ||
+		!SM2_SIGN_CTX_set_presign_pool(&ctx, pool) ||
+		!(k = BN_new()) || !(x = BN_new())) {
+		goto err;
+	}
+
+	if (SM2_PRESIGN_POOL_fill(pool, 4) != 4 ||
+		SM2_PRESIGN_POOL_count(pool) != 4) {
+		fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+		goto err;
+	}
+
+	/* the last two signatures find the pool empty */
+	for (i = 0; i < 6; i++) {
+		RAND_pseudo_bytes(msg, sizeof(msg));
+		dgstlen = sizeof(dgst);
+		if (!(sig = SM2_SIGN_CTX_do_sign(&ctx, msg, sizeof(msg))) ||
+			!SM2_digest(msg, sizeof(msg), dgst, &dgstlen, ec_key) ||
+			SM2_do_verify(dgst, dgstlen, sig, ec_key) !=
+			SM2_VERIFY_SUCCESS) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		ECDSA_SIG_free(sig);
+		sig = NULL;
+	}
+	if (SM2_PRESIGN_POOL_count(pool) != 0 ||
+		SM2_PRESIGN_POOL_fill(pool, 100) != 8) {
+		fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+		goto err;
+	}
+
+	/* a value of the pool given to SM2_do_sign_ex() */
+	if (!SM2_PRESIGN_POOL_get(pool, k, x) ||
+		!(sig = SM2_do_sign_ex(dgst, dgstlen, k, x, ec_key)) ||
+		SM2_do_verify(dgst, dgstlen, sig, ec_key) != SM2_VERIFY_SUCCESS) {
+		fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+		goto err;
+	}
+
+	/* signing while the thread refills the pool */
+	if (SM2_PRESIGN_POOL_start(pool)) {
+		for (i = 0; i < 16; i++) {
+			ECDSA_SIG_free(sig);
+			if (!(sig = SM2_SIGN_CTX_do_sign(&ctx, msg, sizeof(msg))) ||
+				SM2_do_verify(dgst, dgstlen, sig, ec_key) !=
+				SM2_VERIFY_SUCCESS) {
+				fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+				goto err;
+			}
+		}
+		SM2_PRESIGN_POOL_stop(pool);
+	}
+
+#ifdef OPENSSL_SYS_UNIX
+	/* a child does not get the values of the parent */
+	{
+		pid_t pid;
+		int status;
+
+		SM2_PRESIGN_POOL_fill(pool, 100);
+		if ((pid = fork()) < 0) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		if (pid == 0)
+			_exit(SM2_PRESIGN_POOL_count(pool) == 0 &&
+				!SM2_PRESIGN_POOL_get(pool, k, x) &&
+				SM2_PRESIGN_POOL_fill(pool, 1) == 1 ? 0 : 1);
+		if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) ||
+			WEXITSTATUS(status) != 0 ||
+			SM2_PRESIGN_POOL_count(pool) != 8) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+
+		/* fork while the thread refills, the child must not deadlock */
+		if (SM2_PRESIGN_POOL_start(pool)) {
+			for (i = 0; i < 8; i++) {
+				SM2_PRESIGN_POOL_get(pool, k, x);
+				if ((pid = fork()) < 0) {
+					fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+					goto err;
+				}
+				if (pid == 0) {
+					alarm(10);
+					_exit(SM2_PRESIGN_POOL_count(pool) == 0 &&
+						SM2_PRESIGN_POOL_start(pool) &&
+						(SM2_PRESIGN_POOL_stop(pool), 1) &&
+						SM2_PRESIGN_POOL_fill(pool, 1) == 1 ? 0 : 1);
+				}
+				if (waitpid(pid, &status, 0) != pid ||
+					!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+					fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+					goto err;
+				}
+			}
+			SM2_PRESIGN_POOL_stop(pool);
+		}
+	}
+#endif
+
+	ret = 1;
+err:
+	SM2_SIGN_CTX_cleanup(&ctx);
+	SM2_PRESIGN_POOL_free(pool);
+	ECDSA_SIG_free(sig);
+	BN_free(k);
+	BN_free(x);
+	EC_KEY_free(ec_key);
+	return ret;
+}
+
+int test_sm2_z256(void)
+{
+	int ret = 0;
+#ifdef SM2_Z256
+	EC_GROUP *group = NULL;
+	BN_CTX *ctx = NULL;
+	BIGNUM *n, *a, *b, *c, *r, *s, *t, *u;
+	int i, rs;
+
+	if (!(group = EC_GROUP_new_by_curve_name(NID_sm2p256v1)) ||
+		!sm2_z256_group(group) || !(ctx = BN_CTX_new())) {
+		goto err;
+	}
+	BN_CTX_start(ctx);
+	n = BN_CTX_get(ctx);
+	a = BN_CTX_get(ctx);
+	b = BN_CTX_get(ctx);
+	c = BN_CTX_get(ctx);
+	r = BN_CTX_get(ctx);
+	s = BN_CTX_get(ctx);
+	t = BN_CTX_get(ctx);
+	u = BN_CTX_get(ctx);
+	if (!u || !EC_GROUP_get_order(group, n, ctx)) {
+		goto end;
+	}
+
+	for (i = 0; i < 64; i++) {
+		/* edge values first: n (loaded as 0), n - 1 and n - 2 */
+		if (i < 3) {
+			if (!BN_copy(a, n) || !BN_sub_word(a, i)) {
+				goto end;
+			}
+			if (!BN_copy(b, a) || !BN_copy(c, a)) {
+				goto end;
+			}
+		} else if (!BN_rand_range(a, n) || !BN_rand_range(b, n) ||
+			!BN_rand(c, 256, -1, 0)) {
+			goto end;
+		}
+
+		/* a * b + c */
+		if (!sm2_z256_mul_add(r, a, b, c) ||
+			!BN_mod_mul(t, a, b, n, ctx) ||
+			!BN_mod_add(t, t, c, n, ctx) || BN_cmp(r, t) != 0) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto end;
+		}
+
+		/* (1 + a)^-1, n - 1 has no inverse */
+		if (!BN_add(t, a, BN_value_one())) {
+			goto end;
+		}
+		if (BN_cmp(t, n) == 0) {
+			if (sm2_z256_inv_1_plus_d(r, a)) {
+				fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+				goto end;
+			}
+			continue;
+		}
+		if (!sm2_z256_inv_1_plus_d(r, a) ||
+			!BN_mod_inverse(t, t, n, ctx) || BN_cmp(r, t) != 0) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto end;
+		}
+
+		/* r = c + b, s = a * (b' + r) - r with a as d_inv, b' = k */
+		if (!(rs = sm2_z256_sign_rs(r, s, c, b, a, t))) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto end;
+		}
+		if (!BN_mod_add(u, c, b, n, ctx) ||
+			(rs > 0 && BN_cmp(r, u) != 0) ||
+			!BN_mod_add(u, u, a, n, ctx) ||
+			!BN_mod_mul(u, u, t, n, ctx) ||
+			!BN_mod_sub(u, u, r, n, ctx) ||
+			(rs > 0 && BN_cmp(s, u) != 0)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto end;
+		}
+	}
+
+	ret = 1;
+end:
+	BN_CTX_end(ctx);
+err:
+	BN_CTX_free(ctx);
+	EC_GROUP_free(group);
+#else
+	ret = 1;
+#endif
+	return ret;
+}
+
+int test_sm2_encrypt_to(void)
+{
+	int ret = 0;
+	EC_KEY *ec_key = NULL;
+	SM2_ENC_CTX ctx;
+	unsigned char msg[100];
+	unsigned char buf[256];
+	unsigned char out[256];
+	size_t c1len = 65, c3len = 32;
+	size_t len, outlen, i;
+	unsigned int maclen;
+	int flags;
+
+	memset(&ctx, 0, sizeof(ctx));
+	if (!(ec_key = EC_KEY_new_by_curve_name(NID_sm2p256v1)) ||
+		!EC_KEY_generate_key(ec_key)) {
+		goto err;
+	}
+	RAND_pseudo_bytes(msg, sizeof(msg));
+
+	for (flags = SM2_CIPHERTEXT_C1C2C3; flags <= SM2_CIPHERTEXT_C1C3C2;
+		flags++) {
+		size_t c2 = flags ? c1len + c3len : c1len;
+		size_t c3 = flags ? c1len : c1len + sizeof(msg);
+
+		if (!SM2_encrypt_to(NULL, &len, msg, sizeof(msg), ec_key, flags) ||
+			len != c1len + sizeof(msg) + c3len) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+
+		/* encrypted in place, the message is put at C2 */
+		memcpy(buf + c2, msg, sizeof(msg));
+		outlen = sizeof(out);
+		if (!SM2_encrypt_to(buf, &len, buf + c2, sizeof(msg), ec_key,
+			flags) ||
+			!SM2_decrypt_to(out, &outlen, buf, len, ec_key, flags) ||
+			outlen != sizeof(msg) || memcmp(out, msg, outlen)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+
+		/* decrypted in chunks */
+		if (!SM2_decrypt_init(&ctx, ec_key, buf, c1len)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		for (i = 0; i < sizeof(msg); i += 7) {
+			size_t n = sizeof(msg) - i < 7 ? sizeof(msg) - i : 7;
+			if (!SM2_decrypt_update(&ctx, out + i, buf + c2 + i, n)) {
+				fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+				goto err;
+			}
+		}
+		if (!SM2_decrypt_final(&ctx, buf + c3, c3len) ||
+			memcmp(out, msg, sizeof(msg))) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		SM2_ENC_CTX_cleanup(&ctx);
+
+		/* C1 || C2 || C3 is the format of SM2_decrypt() */
+		outlen = sizeof(out);
+		if (flags == SM2_CIPHERTEXT_C1C2C3 &&
+			(!SM2_decrypt(buf, len, out, &outlen, ec_key) ||
+			outlen != sizeof(msg) || memcmp(out, msg, outlen))) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+
+		/* a modified C3 is refused */
+		buf[c3] ^= 1;
+		outlen = sizeof(out);
+		if (SM2_decrypt_to(out, &outlen, buf, len, ec_key, flags)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+		ERR_clear_error();
+	}
+
+	/* encrypted in chunks, read by SM2_decrypt() */
+	len = sizeof(buf);
+	if (!SM2_encrypt_init(&ctx, ec_key, buf, &len) || len != c1len) {
+		fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+		goto err;
+	}
+	for (i = 0; i < sizeof(msg); i += 33) {
+		size_t n = sizeof(msg) - i < 33 ? sizeof(msg) - i : 33;
+		if (!SM2_encrypt_update(&ctx, buf + len + i, msg + i, n)) {
+			fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+			goto err;
+		}
+	}
+	outlen = sizeof(out);
+	if (!SM2_encrypt_final(&ctx, buf + len + sizeof(msg), &maclen) ||
+		maclen != c3len ||
+		!SM2_decrypt(buf, len + sizeof(msg) + maclen, out, &outlen,
+		ec_key) ||
+		outlen != sizeof(msg) || memcmp(out, msg, outlen)) {
+		fprintf(stderr, "error: %s %d\n", __FUNCTION__, __LINE__);
+		goto err;
+	}
+
+	ret = 1;
+err:
+	SM2_ENC_CTX_cleanup(&ctx);
+	EC_KEY_free(ec_key);
+	return ret;
+}
+
 int main(int argc, char **argv)
 {	
 	int ret = -1;
@@ -688,6 +1237,42 @@ int main(int argc, char **argv)
 	if (!test_sm2_test_vector()) {
 		goto err;
 	}
+	if (!test_sm2_z256()) {
+		printf("sm2 z256 failed\n");
+		goto err;
+	} else {
+		printf("sm2 z256 passed\n");
+	}
+	if (!test_sm2_verify_cache()) {
+		printf("sm2 verify cache failed\n");
+		goto err;
+	} else {
+		printf("sm2 verify cache passed\n");
+	}
+	if (!test_sm2_verify_batch()) {
+		printf("sm2 verify batch failed\n");
+		goto err;
+	} else {
+		printf("sm2 verify batch passed\n");
+	}
+	if (!test_sm2_sign_ctx()) {
+		printf("sm2 sign ctx failed\n");
+		goto err;
+	} else {
+		printf("sm2 sign ctx passed\n");
+	}
+	if (!test_sm2_presign_pool()) {
+		printf("sm2 presign pool failed\n");
+		goto err;
+	} else {
+		printf("sm2 presign pool passed\n");
+	}
+	if (!test_sm2_encrypt_to()) {
+		printf("sm2 encrypt to failed\n");
+		goto err;
+	} else {
+		printf("sm2 encrypt to passed\n");
+	}
 	/*
 	if (!test_sm2_evp_pkey_sign()) {
 		goto err;
@@ -51,7 +51,7 @@
 
 
 #include "sm3.h"
-#include "../byteorder.h"
+#include "sm3_lcl.h"
 #include <string.h>
 
 
@@ -89,11 +89,12 @@ int sm3_update(sm3_ctx_t *ctx, const unsigned char* data, size_t data_len)
 			data_len -= left;
 		}
 	}
-	while (data_len >= SM3_BLOCK_SIZE) {
-		sm3_compress(ctx->digest, data);
-		ctx->nblocks++;
-		data += SM3_BLOCK_SIZE;
-		data_len -= SM3_BLOCK_SIZE;
+	if (data_len >= SM3_BLOCK_SIZE) {
+		size_t nblocks = data_len / SM3_BLOCK_SIZE;
+		sm3_compress_blocks(ctx->digest, data, nblocks);
+		ctx->nblocks += nblocks;
+		data += nblocks * SM3_BLOCK_SIZE;
+		data_len -= nblocks * SM3_BLOCK_SIZE;
 	}
 	ctx->num = data_len;
 	if (data_len) {
@@ -104,13 +105,14 @@ int sm3_update(sm3_ctx_t *ctx, const unsigned char* data, size_t data_len)
 
 int sm3_final(sm3_ctx_t *ctx, unsigned char *digest)
 {
-        if(ctx == NULL) return 0;
 	int i;
-	uint32_t *pdigest = (uint32_t *)digest;
-	uint32_t *count = (uint32_t *)(ctx->block + SM3_BLOCK_SIZE - 8);
-		
+	uint64_t nbits;
+
+	if (ctx == NULL)
+		return 0;
+
 	ctx->block[ctx->num] = 0x80;
-	
+
 	if (ctx->num + 9 <= SM3_BLOCK_SIZE) {
 		memset(ctx->block + ctx->num + 1, 0, SM3_BLOCK_SIZE - ctx->num - 9);
 	} else {
@@ -119,34 +121,79 @@ int sm3_final(sm3_ctx_t *ctx, unsigned char *digest)
 		memset(ctx->block, 0, SM3_BLOCK_SIZE - 8);
 	}
 
-	count[0] = cpu_to_be32((ctx->nblocks) >> 23);
-	count[1] = cpu_to_be32((ctx->nblocks << 9) + (ctx->num << 3));
-	
+	/* the bit length is a 64-bit counter, nblocks may exceed 2^32 */
+	nbits = (ctx->nblocks << 9) + ((uint64_t)ctx->num << 3);
+	PUTU32(ctx->block + SM3_BLOCK_SIZE - 8, (uint32_t)(nbits >> 32));
+	PUTU32(ctx->block + SM3_BLOCK_SIZE - 4, (uint32_t)nbits);
+
 	sm3_compress(ctx->digest, ctx->block);
-	for (i = 0; i < sizeof(ctx->digest)/sizeof(ctx->digest[0]); i++) {
-		pdigest[i] = cpu_to_be32(ctx->digest[i]);
+	for (i = 0; i < 8; i++) {
+		PUTU32(digest + 4 * i, ctx->digest[i]);
 	}
-        return 1;
+	return 1;
 }
 
-#define ROTATELEFT(X,n)  (((X)<<(n)) | ((X)>>(32-(n))))
+const uint32_t sm3_k[64] = {
+	0x79CC4519, 0xF3988A32, 0xE7311465, 0xCE6228CB,
+	0x9CC45197, 0x3988A32F, 0x7311465E, 0xE6228CBC,
+	0xCC451979, 0x988A32F3, 0x311465E7, 0x6228CBCE,
+	0xC451979C, 0x88A32F39, 0x11465E73, 0x228CBCE6,
+	0x9D8A7A87, 0x3B14F50F, 0x7629EA1E, 0xEC53D43C,
+	0xD8A7A879, 0xB14F50F3, 0x629EA1E7, 0xC53D43CE,
+	0x8A7A879D, 0x14F50F3B, 0x29EA1E76, 0x53D43CEC,
+	0xA7A879D8, 0x4F50F3B1, 0x9EA1E762, 0x3D43CEC5,
+	0x7A879D8A, 0xF50F3B14, 0xEA1E7629, 0xD43CEC53,
+	0xA879D8A7, 0x50F3B14F, 0xA1E7629E, 0x43CEC53D,
+	0x879D8A7A, 0x0F3B14F5, 0x1E7629EA, 0x3CEC53D4,
+	0x79D8A7A8, 0xF3B14F50, 0xE7629EA1, 0xCEC53D43,
+	0x9D8A7A87, 0x3B14F50F, 0x7629EA1E, 0xEC53D43C,
+	0xD8A7A879, 0xB14F50F3, 0x629EA1E7, 0xC53D43CE,
+	0x8A7A879D, 0x14F50F3B, 0x29EA1E76, 0x53D43CEC,
+	0xA7A879D8, 0x4F50F3B1, 0x9EA1E762, 0x3D43CEC5,
+};
 
-#define P0(x) ((x) ^  ROTATELEFT((x),9)  ^ ROTATELEFT((x),17)) 
-#define P1(x) ((x) ^  ROTATELEFT((x),15) ^ ROTATELEFT((x),23)) 
+/*
+ * One round with the register moves folded into the caller's argument
+ * order: after R(A..H) the next round is R(D, A, B, C, H, E, F, G).
+ * Wj is W[j], Wj4 is W[j + 4], W'[j] = W[j] ^ W[j + 4] is never stored.
+ */
+#define R(A, B, C, D, E, F, G, H, Kj, Wj, Wj4, FF, GG)		\
+	do {							\
+		uint32_t A12 = ROTL(A, 12);			\
+		uint32_t SS1 = ROTL(A12 + E + Kj, 7);		\
+		uint32_t TT1 = FF(A, B, C) + D + (SS1 ^ A12) + (Wj ^ Wj4); \
+		uint32_t TT2 = GG(E, F, G) + H + SS1 + Wj;	\
+		B = ROTL(B, 9);					\
+		D = TT1;					\
+		F = ROTL(F, 19);				\
+		H = P0(TT2);					\
+	} while (0)
 
-#define FF0(x,y,z) ( (x) ^ (y) ^ (z)) 
-#define FF1(x,y,z) (((x) & (y)) | ( (x) & (z)) | ( (y) & (z)))
+#define R0(A, B, C, D, E, F, G, H, Kj, Wj, Wj4) \
+	R(A, B, C, D, E, F, G, H, Kj, Wj, Wj4, FF0, GG0)
+#define R1(A, B, C, D, E, F, G, H, Kj, Wj, Wj4) \
+	R(A, B, C, D, E, F, G, H, Kj, Wj, Wj4, FF1, GG1)
 
-#define GG0(x,y,z) ( (x) ^ (y) ^ (z)) 
-#define GG1(x,y,z) (((x) & (y)) | ( (~(x)) & (z)) )
+/* W[j + 16] from W[j], W[j + 7], W[j + 13], W[j + 3] and W[j + 10] */
+#define EXPAND(W0, W7, W13, W3, W10) \
+	(P1((W0) ^ (W7) ^ ROTL((W13), 15)) ^ ROTL((W3), 7) ^ (W10))
 
+#if defined(__GNUC__)
+# define SM3_INLINE	static inline __attribute__((always_inline))
+#else
+# define SM3_INLINE	static
+#endif
 
-void sm3_compress(uint32_t digest[8], const unsigned char block[64])
+#if !defined(OPENSSL_NO_ASM) && defined(__GNUC__) && \
+	(defined(__x86_64) || defined(__x86_64__))
+/* the same code built for BMI2, where every rotation becomes a rorx */
+# define SM3_BMI2
+extern unsigned int OPENSSL_ia32cap_P[];
+# define BMI2_CAPABLE	(OPENSSL_ia32cap_P[2] & (1 << 8))
+#endif
+
+SM3_INLINE void sm3_compress_block(uint32_t digest[8], const unsigned char *p)
 {
-	int j;
-	uint32_t W[68], W1[64];
-	const uint32_t *pblock = (const uint32_t *)block;
-	
 	uint32_t A = digest[0];
 	uint32_t B = digest[1];
 	uint32_t C = digest[2];
@@ -155,51 +202,132 @@ void sm3_compress(uint32_t digest[8], const unsigned char block[64])
 	uint32_t F = digest[5];
 	uint32_t G = digest[6];
 	uint32_t H = digest[7];
-	uint32_t SS1,SS2,TT1,TT2,T[64];
-
-	for (j = 0; j < 16; j++) {
-		W[j] = cpu_to_be32(pblock[j]);
-	}
-	for (j = 16; j < 68; j++) {
-		W[j] = P1( W[j-16] ^ W[j-9] ^ ROTATELEFT(W[j-3],15)) ^ ROTATELEFT(W[j - 13],7 ) ^ W[j-6];;
-	}
-	for( j = 0; j < 64; j++) {
-		W1[j] = W[j] ^ W[j+4];
-	}
-
-	for(j =0; j < 16; j++) {
-
-		T[j] = 0x79CC4519;
-		SS1 = ROTATELEFT((ROTATELEFT(A,12) + E + ROTATELEFT(T[j],j)), 7); 
-		SS2 = SS1 ^ ROTATELEFT(A,12);
-		TT1 = FF0(A,B,C) + D + SS2 + W1[j];
-		TT2 = GG0(E,F,G) + H + SS1 + W[j];
-		D = C;
-		C = ROTATELEFT(B,9);
-		B = A;
-		A = TT1;
-		H = G;
-		G = ROTATELEFT(F,19);
-		F = E;
-		E = P0(TT2);
-	}
+	uint32_t W00 = GETU32(p     ), W01 = GETU32(p +  4);
+	uint32_t W02 = GETU32(p +  8), W03 = GETU32(p + 12);
+	uint32_t W04 = GETU32(p + 16), W05 = GETU32(p + 20);
+	uint32_t W06 = GETU32(p + 24), W07 = GETU32(p + 28);
+	uint32_t W08 = GETU32(p + 32), W09 = GETU32(p + 36);
+	uint32_t W10 = GETU32(p + 40), W11 = GETU32(p + 44);
+	uint32_t W12 = GETU32(p + 48), W13 = GETU32(p + 52);
+	uint32_t W14 = GETU32(p + 56), W15 = GETU32(p + 60);
+	const uint32_t *K = sm3_k;
 
-	for(j =16; j < 64; j++) {
-
-		T[j] = 0x7A879D8A;
-		SS1 = ROTATELEFT((ROTATELEFT(A,12) + E + ROTATELEFT(T[j],j)), 7); 
-		SS2 = SS1 ^ ROTATELEFT(A,12);
-		TT1 = FF1(A,B,C) + D + SS2 + W1[j];
-		TT2 = GG1(E,F,G) + H + SS1 + W[j];
-		D = C;
-		C = ROTATELEFT(B,9);
-		B = A;
-		A = TT1;
-		H = G;
-		G = ROTATELEFT(F,19);
-		F = E;
-		E = P0(TT2);
-	}
+	R0(A, B, C, D, E, F, G, H, K[0], W00, W04);
+	W00 = EXPAND(W00, W07, W13, W03, W10);
+	R0(D, A, B, C, H, E, F, G, K[1], W01, W05);
+	W01 = EXPAND(W01, W08, W14, W04, W11);
+	R0(C, D, A, B, G, H, E, F, K[2], W02, W06);
+	W02 = EXPAND(W02, W09, W15, W05, W12);
+	R0(B, C, D, A, F, G, H, E, K[3], W03, W07);
+	W03 = EXPAND(W03, W10, W00, W06, W13);
+	R0(A, B, C, D, E, F, G, H, K[4], W04, W08);
+	W04 = EXPAND(W04, W11, W01, W07, W14);
+	R0(D, A, B, C, H, E, F, G, K[5], W05, W09);
+	W05 = EXPAND(W05, W12, W02, W08, W15);
+	R0(C, D, A, B, G, H, E, F, K[6], W06, W10);
+	W06 = EXPAND(W06, W13, W03, W09, W00);
+	R0(B, C, D, A, F, G, H, E, K[7], W07, W11);
+	W07 = EXPAND(W07, W14, W04, W10, W01);
+	R0(A, B, C, D, E, F, G, H, K[8], W08, W12);
+	W08 = EXPAND(W08, W15, W05, W11, W02);
+	R0(D, A, B, C, H, E, F, G, K[9], W09, W13);
+	W09 = EXPAND(W09, W00, W06, W12, W03);
+	R0(C, D, A, B, G, H, E, F, K[10], W10, W14);
+	W10 = EXPAND(W10, W01, W07, W13, W04);
+	R0(B, C, D, A, F, G, H, E, K[11], W11, W15);
+	W11 = EXPAND(W11, W02, W08, W14, W05);
+	R0(A, B, C, D, E, F, G, H, K[12], W12, W00);
+	W12 = EXPAND(W12, W03, W09, W15, W06);
+	R0(D, A, B, C, H, E, F, G, K[13], W13, W01);
+	W13 = EXPAND(W13, W04, W10, W00, W07);
+	R0(C, D, A, B, G, H, E, F, K[14], W14, W02);
+	W14 = EXPAND(W14, W05, W11, W01, W08);
+	R0(B, C, D, A, F, G, H, E, K[15], W15, W03);
+	W15 = EXPAND(W15, W06, W12, W02, W09);
+	R1(A, B, C, D, E, F, G, H, K[16], W00, W04);
+	W00 = EXPAND(W00, W07, W13, W03, W10);
+	R1(D, A, B, C, H, E, F, G, K[17], W01, W05);
+	W01 = EXPAND(W01, W08, W14, W04, W11);
+	R1(C, D, A, B, G, H, E, F, K[18], W02, W06);
+	W02 = EXPAND(W02, W09, W15, W05, W12);
+	R1(B, C, D, A, F, G, H, E, K[19], W03, W07);
+	W03 = EXPAND(W03, W10, W00, W06, W13);
+	R1(A, B, C, D, E, F, G, H, K[20], W04, W08);
+	W04 = EXPAND(W04, W11, W01, W07, W14);
+	R1(D, A, B, C, H, E, F, G, K[21], W05, W09);
+	W05 = EXPAND(W05, W12, W02, W08, W15);
+	R1(C, D, A, B, G, H, E, F, K[22], W06, W10);
+	W06 = EXPAND(W06, W13, W03, W09, W00);
+	R1(B, C, D, A, F, G, H, E, K[23], W07, W11);
+	W07 = EXPAND(W07, W14, W04, W10, W01);
+	R1(A, B, C, D, E, F, G, H, K[24], W08, W12);
+	W08 = EXPAND(W08, W15, W05, W11, W02);
+	R1(D, A, B, C, H, E, F, G, K[25], W09, W13);
+	W09 = EXPAND(W09, W00, W06, W12, W03);
+	R1(C, D, A, B, G, H, E, F, K[26], W10, W14);
+	W10 = EXPAND(W10, W01, W07, W13, W04);
+	R1(B, C, D, A, F, G, H, E, K[27], W11, W15);
+	W11 = EXPAND(W11, W02, W08, W14, W05);
+	R1(A, B, C, D, E, F, G, H, K[28], W12, W00);
+	W12 = EXPAND(W12, W03, W09, W15, W06);
+	R1(D, A, B, C, H, E, F, G, K[29], W13, W01);
+	W13 = EXPAND(W13, W04, W10, W00, W07);
+	R1(C, D, A, B, G, H, E, F, K[30], W14, W02);
+	W14 = EXPAND(W14, W05, W11, W01, W08);
+	R1(B, C, D, A, F, G, H, E, K[31], W15, W03);
+	W15 = EXPAND(W15, W06, W12, W02, W09);
+	R1(A, B, C, D, E, F, G, H, K[32], W00, W04);
+	W00 = EXPAND(W00, W07, W13, W03, W10);
+	R1(D, A, B, C, H, E, F, G, K[33], W01, W05);
+	W01 = EXPAND(W01, W08, W14, W04, W11);
+	R1(C, D, A, B, G, H, E, F, K[34], W02, W06);
+	W02 = EXPAND(W02, W09, W15, W05, W12);
+	R1(B, C, D, A, F, G, H, E, K[35], W03, W07);
+	W03 = EXPAND(W03, W10, W00, W06, W13);
+	R1(A, B, C, D, E, F, G, H, K[36], W04, W08);
+	W04 = EXPAND(W04, W11, W01, W07, W14);
+	R1(D, A, B, C, H, E, F, G, K[37], W05, W09);
+	W05 = EXPAND(W05, W12, W02, W08, W15);
+	R1(C, D, A, B, G, H, E, F, K[38], W06, W10);
+	W06 = EXPAND(W06, W13, W03, W09, W00);
+	R1(B, C, D, A, F, G, H, E, K[39], W07, W11);
+	W07 = EXPAND(W07, W14, W04, W10, W01);
+	R1(A, B, C, D, E, F, G, H, K[40], W08, W12);
+	W08 = EXPAND(W08, W15, W05, W11, W02);
+	R1(D, A, B, C, H, E, F, G, K[41], W09, W13);
+	W09 = EXPAND(W09, W00, W06, W12, W03);
+	R1(C, D, A, B, G, H, E, F, K[42], W10, W14);
+	W10 = EXPAND(W10, W01, W07, W13, W04);
+	R1(B, C, D, A, F, G, H, E, K[43], W11, W15);
+	W11 = EXPAND(W11, W02, W08, W14, W05);
+	R1(A, B, C, D, E, F, G, H, K[44], W12, W00);
+	W12 = EXPAND(W12, W03, W09, W15, W06);
+	R1(D, A, B, C, H, E, F, G, K[45], W13, W01);
+	W13 = EXPAND(W13, W04, W10, W00, W07);
+	R1(C, D, A, B, G, H, E, F, K[46], W14, W02);
+	W14 = EXPAND(W14, W05, W11, W01, W08);
+	R1(B, C, D, A, F, G, H, E, K[47], W15, W03);
+	W15 = EXPAND(W15, W06, W12, W02, W09);
+	R1(A, B, C, D, E, F, G, H, K[48], W00, W04);
+	W00 = EXPAND(W00, W07, W13, W03, W10);
+	R1(D, A, B, C, H, E, F, G, K[49], W01, W05);
+	W01 = EXPAND(W01, W08, W14, W04, W11);
+	R1(C, D, A, B, G, H, E, F, K[50], W02, W06);
+	W02 = EXPAND(W02, W09, W15, W05, W12);
+	R1(B, C, D, A, F, G, H, E, K[51], W03, W07);
+	W03 = EXPAND(W03, W10, W00, W06, W13);
+	R1(A, B, C, D, E, F, G, H, K[52], W04, W08);
+	R1(D, A, B, C, H, E, F, G, K[53], W05, W09);
+	R1(C, D, A, B, G, H, E, F, K[54], W06, W10);
+	R1(B, C, D, A, F, G, H, E, K[55], W07, W11);
+	R1(A, B, C, D, E, F, G, H, K[56], W08, W12);
+	R1(D, A, B, C, H, E, F, G, K[57], W09, W13);
+	R1(C, D, A, B, G, H, E, F, K[58], W10, W14);
+	R1(B, C, D, A, F, G, H, E, K[59], W11, W15);
+	R1(A, B, C, D, E, F, G, H, K[60], W12, W00);
+	R1(D, A, B, C, H, E, F, G, K[61], W13, W01);
+	R1(C, D, A, B, G, H, E, F, K[62], W14, W02);
+	R1(B, C, D, A, F, G, H, E, K[63], W15, W03);
 
 	digest[0] ^= A;
 	digest[1] ^= B;
@@ -211,6 +339,44 @@ void sm3_compress(uint32_t digest[8], const unsigned char block[64])
 	digest[7] ^= H;
 }
 
+static void sm3_compress_blocks_c(uint32_t digest[8],
+	const unsigned char *data, size_t nblocks)
+{
+	while (nblocks--) {
+		sm3_compress_block(digest, data);
+		data += SM3_BLOCK_SIZE;
+	}
+}
+
+#ifdef SM3_BMI2
+__attribute__((target("bmi2")))
+static void sm3_compress_blocks_bmi2(uint32_t digest[8],
+	const unsigned char *data, size_t nblocks)
+{
+	while (nblocks--) {
+		sm3_compress_block(digest, data);
+		data += SM3_BLOCK_SIZE;
+	}
+}
+#endif
+
+void sm3_compress_blocks(uint32_t digest[8], const unsigned char *data,
+	size_t nblocks)
+{
+#ifdef SM3_BMI2
+	if (BMI2_CAPABLE) {
+		sm3_compress_blocks_bmi2(digest, data, nblocks);
+		return;
+	}
+#endif
+	sm3_compress_blocks_c(digest, data, nblocks);
+}
+
+void sm3_compress(uint32_t digest[8], const unsigned char block[64])
+{
+	sm3_compress_blocks(digest, block, 1);
+}
+
 void sm3(const unsigned char *msg, size_t  msglen, unsigned char dgst[SM3_DIGEST_LENGTH])
 {
 	sm3_ctx_t ctx;
@@ -66,7 +66,7 @@ extern "C" {
 
 typedef struct {
 	uint32_t digest[8];
-	int nblocks;
+	uint64_t nblocks;
 	unsigned char block[64];
 	int num;
 } sm3_ctx_t;
@@ -75,8 +75,71 @@ int sm3_init(sm3_ctx_t *ctx);
 int sm3_update(sm3_ctx_t *ctx, const unsigned char* data, size_t data_len);
 int sm3_final(sm3_ctx_t *ctx, unsigned char digest[SM3_DIGEST_LENGTH]);
 void sm3_compress(uint32_t digest[8], const unsigned char block[SM3_BLOCK_SIZE]);
+void sm3_compress_blocks(uint32_t digest[8], const unsigned char *data, size_t nblocks);
 void sm3(const unsigned char *data, size_t datalen, unsigned char digest[SM3_DIGEST_LENGTH]);
 
+
+/*
+ * multi-buffer interface, hash up to SM3_MB_LANES independent messages
+ * in parallel SIMD lanes
+ */
+#define SM3_MB_LANES		8
+
+typedef struct {
+	const unsigned char *data;
+	size_t len;
+	unsigned char digest[SM3_DIGEST_LENGTH];
+	void *user_data;
+} SM3_MB_JOB;
+
+typedef struct {
+	uint32_t digest[8][SM3_MB_LANES];
+	SM3_MB_JOB *job[SM3_MB_LANES];
+	const unsigned char *data[SM3_MB_LANES];
+	size_t nblocks[SM3_MB_LANES];
+	size_t ntail[SM3_MB_LANES];
+	unsigned char tail[SM3_MB_LANES][SM3_BLOCK_SIZE * 2];
+	int lanes_in_use;
+} SM3_MB_CTX;
+
+void sm3_compress_x8(uint32_t digest[8][SM3_MB_LANES],
+	const unsigned char *blocks[SM3_MB_LANES]);
+void sm3_mb_init(SM3_MB_CTX *ctx);
+SM3_MB_JOB *sm3_mb_submit(SM3_MB_CTX *ctx, SM3_MB_JOB *job);
+SM3_MB_JOB *sm3_mb_flush(SM3_MB_CTX *ctx);
+void sm3_mb(const unsigned char *data[], const size_t datalen[],
+	unsigned char *digest[], size_t n);
+
+
+/*
+ * tree hash, the input is split into leaves of leaf_size bytes which are
+ * hashed on worker threads and combined as a binary Merkle tree:
+ *   leaf = SM3(0x00 || chunk), node = SM3(0x01 || left || right)
+ * the left subtree of every node is complete, an empty input is one
+ * empty leaf. The result depends on leaf_size but not on nthreads.
+ * A context is zeroed before its first sm3_tree_init().
+ */
+#define SM3_TREE_DEFAULT_LEAF_SIZE	(1024 * 1024)
+#define SM3_TREE_MAX_THREADS		64
+#define SM3_TREE_MAX_DEPTH		64
+
+typedef struct {
+	size_t leaf_size;
+	int nthreads;
+	uint64_t nleaves;
+	unsigned char stack[SM3_TREE_MAX_DEPTH][SM3_DIGEST_LENGTH];
+	int depth;
+	unsigned char *buf;
+	size_t num;
+} sm3_tree_ctx_t;
+
+int sm3_tree_init(sm3_tree_ctx_t *ctx, size_t leaf_size, int nthreads);
+int sm3_tree_update(sm3_tree_ctx_t *ctx, const unsigned char *data, size_t data_len);
+int sm3_tree_final(sm3_tree_ctx_t *ctx, unsigned char digest[SM3_DIGEST_LENGTH]);
+void sm3_tree_cleanup(sm3_tree_ctx_t *ctx);
+int sm3_tree(const unsigned char *data, size_t datalen, size_t leaf_size,
+	int nthreads, unsigned char digest[SM3_DIGEST_LENGTH]);
+
 #ifdef __cplusplus
 }
 #endif
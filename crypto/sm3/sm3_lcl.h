@@ -1,4 +1,4 @@
-/* crypto/sms4/sms4speed.c */
+/* crypto/sm3/sm3_lcl.h */
 /* ====================================================================
  * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
  *
@@ -46,42 +46,38 @@
  * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  * ====================================================================
+ *
  */
 
+#ifndef HEADER_SM3_LCL_H
+#define HEADER_SM3_LCL_H
+
+#include <stdint.h>
+
+#define GETU32(p) \
+	((uint32_t)(p)[0] << 24 | \
+	 (uint32_t)(p)[1] << 16 | \
+	 (uint32_t)(p)[2] <<  8 | \
+	 (uint32_t)(p)[3])
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <libgen.h>
-#include <openmp.h>
-#include "sms4.h"
+#define PUTU32(p,v) \
+	((p)[0] = (uint8_t)((v) >> 24), \
+	 (p)[1] = (uint8_t)((v) >> 16), \
+	 (p)[2] = (uint8_t)((v) >>  8), \
+	 (p)[3] = (uint8_t)(v))
 
+#define ROTL(x,n)	(((x) << (n)) | ((x) >> (32 - (n))))
 
-int main(int argc, char **argv)
-{
-	sms4_key_t sms4_key;
-	unsigned char user_key[16] = {
-		0x11,  0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
-		0x11,  0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
-	};
-	size_t buflen = SMS4_BLOCK_SIZE * 8 * 3 * 1000 * 1000;	
-	unsigned char *buf = NULL;
-	unsigned char *p;
-	int i;	
+#define P0(x)		((x) ^ ROTL((x), 9) ^ ROTL((x),17))
+#define P1(x)		((x) ^ ROTL((x),15) ^ ROTL((x),23))
 
+#define FF0(x,y,z)	((x) ^ (y) ^ (z))
+#define FF1(x,y,z)	(((x) & (y)) | ((x) & (z)) | ((y) & (z)))
 
-	if (!(buf = (unsigned char *)malloc(buflen))) {
-		fprintf(stderr, "malloc failed\n");
-		return -1;
-	}
+#define GG0(x,y,z)	((x) ^ (y) ^ (z))
+#define GG1(x,y,z)	((((y) ^ (z)) & (x)) ^ (z))
 
-	sms4_set_encrypt_key(&sms4_key, user_key);
-	
-	#pragma omp parallel for
-	for (i = 0, p = buf; i < buflen/(SMS4_BLOCK_SIZE * 16); i++, p += SMS4_BLOCK_SIZE * 16) {
-		sms4_encrypt_16blocks(&sms4_key, p, p);
-	}	
-	
-	return 0;
-}
+/* round constants, K[j] = T[j] <<< (j mod 32), internal to libcrypto */
+extern const uint32_t sm3_k[64];
 
+#endif
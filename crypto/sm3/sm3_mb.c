@@ -0,0 +1,473 @@
+/* crypto/sm3/sm3_mb.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * Multi-buffer SM3: SM3_MB_LANES independent messages are hashed in
+ * lock step, each 32-bit lane of a vector register carries one message.
+ * The state is kept word-sliced (digest[i][lane]) so that both the
+ * portable code and the AVX2 code can load a whole state word of all
+ * lanes at once.
+ */
+
+#include <string.h>
+#include "sm3.h"
+#include "sm3_lcl.h"
+
+static const uint32_t sm3_iv[8] = {
+	0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+	0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+};
+
+/* used as the input of idle lanes, the output of those lanes is ignored */
+static const unsigned char sm3_mb_zero_block[SM3_BLOCK_SIZE];
+
+static void sm3_compress_x8_c(uint32_t digest[8][SM3_MB_LANES],
+	const unsigned char *blocks[SM3_MB_LANES])
+{
+	uint32_t W[68][SM3_MB_LANES];
+	uint32_t A[SM3_MB_LANES], B[SM3_MB_LANES], C[SM3_MB_LANES];
+	uint32_t D[SM3_MB_LANES], E[SM3_MB_LANES], F[SM3_MB_LANES];
+	uint32_t G[SM3_MB_LANES], H[SM3_MB_LANES];
+	uint32_t SS1, SS2, TT1, TT2, T, a12;
+	int i, j;
+
+	for (j = 0; j < 16; j++) {
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			W[j][i] = GETU32(blocks[i] + 4 * j);
+		}
+	}
+	for (j = 16; j < 68; j++) {
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			TT1 = W[j - 16][i] ^ W[j - 9][i] ^ ROTL(W[j - 3][i], 15);
+			W[j][i] = P1(TT1) ^ ROTL(W[j - 13][i], 7) ^ W[j - 6][i];
+		}
+	}
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		A[i] = digest[0][i];
+		B[i] = digest[1][i];
+		C[i] = digest[2][i];
+		D[i] = digest[3][i];
+		E[i] = digest[4][i];
+		F[i] = digest[5][i];
+		G[i] = digest[6][i];
+		H[i] = digest[7][i];
+	}
+
+	for (j = 0; j < 64; j++) {
+		T = sm3_k[j];
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			a12 = ROTL(A[i], 12);
+			SS1 = ROTL(a12 + E[i] + T, 7);
+			SS2 = SS1 ^ a12;
+			if (j < 16) {
+				TT1 = FF0(A[i], B[i], C[i]);
+				TT2 = GG0(E[i], F[i], G[i]);
+			} else {
+				TT1 = FF1(A[i], B[i], C[i]);
+				TT2 = GG1(E[i], F[i], G[i]);
+			}
+			TT1 += D[i] + SS2 + (W[j][i] ^ W[j + 4][i]);
+			TT2 += H[i] + SS1 + W[j][i];
+			D[i] = C[i];
+			C[i] = ROTL(B[i], 9);
+			B[i] = A[i];
+			A[i] = TT1;
+			H[i] = G[i];
+			G[i] = ROTL(F[i], 19);
+			F[i] = E[i];
+			E[i] = P0(TT2);
+		}
+	}
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		digest[0][i] ^= A[i];
+		digest[1][i] ^= B[i];
+		digest[2][i] ^= C[i];
+		digest[3][i] ^= D[i];
+		digest[4][i] ^= E[i];
+		digest[5][i] ^= F[i];
+		digest[6][i] ^= G[i];
+		digest[7][i] ^= H[i];
+	}
+}
+
+#if !defined(OPENSSL_NO_ASM) && defined(__GNUC__) && SM3_MB_LANES == 8 && \
+	(defined(__x86_64) || defined(__x86_64__))
+# define SM3_MB_AVX2
+#endif
+
+#ifdef SM3_MB_AVX2
+# include <immintrin.h>
+
+extern unsigned int OPENSSL_ia32cap_P[];
+# define AVX2_CAPABLE	(OPENSSL_ia32cap_P[2] & (1 << 5))
+
+# define AVX2_FUNC	__attribute__((target("avx2")))
+
+# define VROTL(x,n) \
+	_mm256_or_si256(_mm256_slli_epi32((x),(n)), _mm256_srli_epi32((x),32-(n)))
+# define VP0(x) \
+	_mm256_xor_si256(_mm256_xor_si256((x), VROTL((x), 9)), VROTL((x),17))
+# define VP1(x) \
+	_mm256_xor_si256(_mm256_xor_si256((x), VROTL((x),15)), VROTL((x),23))
+# define VXOR3(x,y,z) \
+	_mm256_xor_si256(_mm256_xor_si256((x),(y)),(z))
+# define VFF1(x,y,z) \
+	_mm256_or_si256(_mm256_and_si256((x), _mm256_or_si256((y),(z))), \
+		_mm256_and_si256((y),(z)))
+# define VGG1(x,y,z) \
+	_mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256((y),(z)),(x)),(z))
+
+/*
+ * Load 8 consecutive big-endian words (word w..w+7) of the 8 lanes and
+ * transpose them so that W[w + k] holds word w + k of every lane.
+ */
+AVX2_FUNC static void sm3_mb_load8(__m256i *W,
+	const unsigned char *blocks[8], int w)
+{
+	const __m256i bswap = _mm256_setr_epi8(
+		3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,
+		3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);
+	__m256i r0, r1, r2, r3, r4, r5, r6, r7;
+	__m256i t0, t1, t2, t3, t4, t5, t6, t7;
+
+	r0 = _mm256_loadu_si256((const __m256i *)(blocks[0] + 4 * w));
+	r1 = _mm256_loadu_si256((const __m256i *)(blocks[1] + 4 * w));
+	r2 = _mm256_loadu_si256((const __m256i *)(blocks[2] + 4 * w));
+	r3 = _mm256_loadu_si256((const __m256i *)(blocks[3] + 4 * w));
+	r4 = _mm256_loadu_si256((const __m256i *)(blocks[4] + 4 * w));
+	r5 = _mm256_loadu_si256((const __m256i *)(blocks[5] + 4 * w));
+	r6 = _mm256_loadu_si256((const __m256i *)(blocks[6] + 4 * w));
+	r7 = _mm256_loadu_si256((const __m256i *)(blocks[7] + 4 * w));
+
+	t0 = _mm256_unpacklo_epi32(r0, r1);
+	t1 = _mm256_unpackhi_epi32(r0, r1);
+	t2 = _mm256_unpacklo_epi32(r2, r3);
+	t3 = _mm256_unpackhi_epi32(r2, r3);
+	t4 = _mm256_unpacklo_epi32(r4, r5);
+	t5 = _mm256_unpackhi_epi32(r4, r5);
+	t6 = _mm256_unpacklo_epi32(r6, r7);
+	t7 = _mm256_unpackhi_epi32(r6, r7);
+
+	r0 = _mm256_unpacklo_epi64(t0, t2);
+	r1 = _mm256_unpackhi_epi64(t0, t2);
+	r2 = _mm256_unpacklo_epi64(t1, t3);
+	r3 = _mm256_unpackhi_epi64(t1, t3);
+	r4 = _mm256_unpacklo_epi64(t4, t6);
+	r5 = _mm256_unpackhi_epi64(t4, t6);
+	r6 = _mm256_unpacklo_epi64(t5, t7);
+	r7 = _mm256_unpackhi_epi64(t5, t7);
+
+	W[w + 0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r0, r4, 0x20), bswap);
+	W[w + 1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r1, r5, 0x20), bswap);
+	W[w + 2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r2, r6, 0x20), bswap);
+	W[w + 3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r3, r7, 0x20), bswap);
+	W[w + 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r0, r4, 0x31), bswap);
+	W[w + 5] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r1, r5, 0x31), bswap);
+	W[w + 6] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r2, r6, 0x31), bswap);
+	W[w + 7] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(r3, r7, 0x31), bswap);
+}
+
+AVX2_FUNC static void sm3_compress_x8_avx2(uint32_t digest[8][8],
+	const unsigned char *blocks[8])
+{
+	__m256i W[68];
+	__m256i A, B, C, D, E, F, G, H;
+	__m256i SS1, SS2, TT1, TT2, a12;
+	int j;
+
+	sm3_mb_load8(W, blocks, 0);
+	sm3_mb_load8(W, blocks, 8);
+	for (j = 16; j < 68; j++) {
+		TT1 = VXOR3(W[j - 16], W[j - 9], VROTL(W[j - 3], 15));
+		W[j] = VXOR3(VP1(TT1), VROTL(W[j - 13], 7), W[j - 6]);
+	}
+
+	A = _mm256_loadu_si256((const __m256i *)digest[0]);
+	B = _mm256_loadu_si256((const __m256i *)digest[1]);
+	C = _mm256_loadu_si256((const __m256i *)digest[2]);
+	D = _mm256_loadu_si256((const __m256i *)digest[3]);
+	E = _mm256_loadu_si256((const __m256i *)digest[4]);
+	F = _mm256_loadu_si256((const __m256i *)digest[5]);
+	G = _mm256_loadu_si256((const __m256i *)digest[6]);
+	H = _mm256_loadu_si256((const __m256i *)digest[7]);
+
+	for (j = 0; j < 64; j++) {
+		uint32_t T = sm3_k[j];
+
+		a12 = VROTL(A, 12);
+		SS1 = _mm256_add_epi32(_mm256_add_epi32(a12, E),
+			_mm256_set1_epi32((int)T));
+		SS1 = VROTL(SS1, 7);
+		SS2 = _mm256_xor_si256(SS1, a12);
+		if (j < 16) {
+			TT1 = VXOR3(A, B, C);
+			TT2 = VXOR3(E, F, G);
+		} else {
+			TT1 = VFF1(A, B, C);
+			TT2 = VGG1(E, F, G);
+		}
+		TT1 = _mm256_add_epi32(TT1, _mm256_add_epi32(D, SS2));
+		TT1 = _mm256_add_epi32(TT1, _mm256_xor_si256(W[j], W[j + 4]));
+		TT2 = _mm256_add_epi32(TT2, _mm256_add_epi32(H, SS1));
+		TT2 = _mm256_add_epi32(TT2, W[j]);
+		D = C;
+		C = VROTL(B, 9);
+		B = A;
+		A = TT1;
+		H = G;
+		G = VROTL(F, 19);
+		F = E;
+		E = VP0(TT2);
+	}
+
+# define VSTORE(i,X) \
+	_mm256_storeu_si256((__m256i *)digest[i], _mm256_xor_si256(X, \
+		_mm256_loadu_si256((const __m256i *)digest[i])))
+	VSTORE(0, A);
+	VSTORE(1, B);
+	VSTORE(2, C);
+	VSTORE(3, D);
+	VSTORE(4, E);
+	VSTORE(5, F);
+	VSTORE(6, G);
+	VSTORE(7, H);
+# undef VSTORE
+}
+#endif
+
+void sm3_compress_x8(uint32_t digest[8][SM3_MB_LANES],
+	const unsigned char *blocks[SM3_MB_LANES])
+{
+#ifdef SM3_MB_AVX2
+	if (AVX2_CAPABLE) {
+		sm3_compress_x8_avx2(digest, blocks);
+		return;
+	}
+#endif
+	sm3_compress_x8_c(digest, blocks);
+}
+
+void sm3_mb_init(SM3_MB_CTX *ctx)
+{
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+static void sm3_mb_start(SM3_MB_CTX *ctx, int lane, SM3_MB_JOB *job)
+{
+	unsigned char *tail = ctx->tail[lane];
+	size_t nblocks = job->len / SM3_BLOCK_SIZE;
+	size_t rem = job->len % SM3_BLOCK_SIZE;
+	uint64_t nbits = (uint64_t)job->len << 3;
+	size_t ntail = (rem + 9 <= SM3_BLOCK_SIZE) ? 1 : 2;
+	unsigned char *p;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		ctx->digest[i][lane] = sm3_iv[i];
+	}
+
+	/* only the final partial block and the padding are ever copied */
+	memcpy(tail, job->data + nblocks * SM3_BLOCK_SIZE, rem);
+	tail[rem] = 0x80;
+	memset(tail + rem + 1, 0, ntail * SM3_BLOCK_SIZE - rem - 9);
+	p = tail + ntail * SM3_BLOCK_SIZE - 8;
+	PUTU32(p, (uint32_t)(nbits >> 32));
+	PUTU32(p + 4, (uint32_t)nbits);
+
+	ctx->job[lane] = job;
+	if (nblocks) {
+		ctx->data[lane] = job->data;
+		ctx->nblocks[lane] = nblocks;
+		ctx->ntail[lane] = ntail;
+	} else {
+		ctx->data[lane] = tail;
+		ctx->nblocks[lane] = ntail;
+		ctx->ntail[lane] = 0;
+	}
+	ctx->lanes_in_use++;
+}
+
+/* return a job whose digest is complete and release its lane */
+static SM3_MB_JOB *sm3_mb_retire(SM3_MB_CTX *ctx)
+{
+	SM3_MB_JOB *job;
+	int lane, i;
+
+	for (lane = 0; lane < SM3_MB_LANES; lane++) {
+		if (ctx->job[lane] && !ctx->nblocks[lane]) {
+			job = ctx->job[lane];
+			for (i = 0; i < 8; i++) {
+				PUTU32(job->digest + 4 * i, ctx->digest[i][lane]);
+			}
+			ctx->job[lane] = NULL;
+			ctx->lanes_in_use--;
+			return job;
+		}
+	}
+	return NULL;
+}
+
+/* run all lanes in lock step until at least one message is finished */
+static void sm3_mb_process(SM3_MB_CTX *ctx)
+{
+	const unsigned char *blocks[SM3_MB_LANES];
+	size_t n, min;
+	int lane, done = 0;
+
+	while (!done) {
+		min = 0;
+		for (lane = 0; lane < SM3_MB_LANES; lane++) {
+			if (ctx->job[lane]) {
+				if (!min || ctx->nblocks[lane] < min)
+					min = ctx->nblocks[lane];
+				blocks[lane] = ctx->data[lane];
+			} else {
+				blocks[lane] = sm3_mb_zero_block;
+			}
+		}
+		if (!min)
+			return;
+
+		for (n = 0; n < min; n++) {
+			sm3_compress_x8(ctx->digest, blocks);
+			for (lane = 0; lane < SM3_MB_LANES; lane++) {
+				if (ctx->job[lane])
+					blocks[lane] += SM3_BLOCK_SIZE;
+			}
+		}
+
+		for (lane = 0; lane < SM3_MB_LANES; lane++) {
+			if (!ctx->job[lane])
+				continue;
+			ctx->data[lane] = blocks[lane];
+			ctx->nblocks[lane] -= min;
+			if (ctx->nblocks[lane])
+				continue;
+			if (ctx->ntail[lane]) {
+				ctx->data[lane] = ctx->tail[lane];
+				ctx->nblocks[lane] = ctx->ntail[lane];
+				ctx->ntail[lane] = 0;
+			} else {
+				done = 1;
+			}
+		}
+	}
+}
+
+SM3_MB_JOB *sm3_mb_submit(SM3_MB_CTX *ctx, SM3_MB_JOB *job)
+{
+	int lane;
+
+	if (job) {
+		for (lane = 0; lane < SM3_MB_LANES; lane++) {
+			if (!ctx->job[lane])
+				break;
+		}
+		if (lane == SM3_MB_LANES)
+			return NULL;
+		sm3_mb_start(ctx, lane, job);
+	}
+
+	if ((job = sm3_mb_retire(ctx)) != NULL)
+		return job;
+	if (ctx->lanes_in_use < SM3_MB_LANES)
+		return NULL;
+
+	sm3_mb_process(ctx);
+	return sm3_mb_retire(ctx);
+}
+
+SM3_MB_JOB *sm3_mb_flush(SM3_MB_CTX *ctx)
+{
+	SM3_MB_JOB *job;
+
+	if ((job = sm3_mb_retire(ctx)) != NULL)
+		return job;
+	if (!ctx->lanes_in_use)
+		return NULL;
+
+	sm3_mb_process(ctx);
+	return sm3_mb_retire(ctx);
+}
+
+void sm3_mb(const unsigned char *data[], const size_t datalen[],
+	unsigned char *digest[], size_t n)
+{
+	SM3_MB_CTX ctx;
+	SM3_MB_JOB jobs[SM3_MB_LANES];
+	SM3_MB_JOB *free_jobs[SM3_MB_LANES];
+	SM3_MB_JOB *job;
+	size_t i;
+	int nfree;
+
+	sm3_mb_init(&ctx);
+	for (nfree = 0; nfree < SM3_MB_LANES; nfree++) {
+		free_jobs[nfree] = &jobs[nfree];
+	}
+
+	for (i = 0; i < n; i++) {
+		job = free_jobs[--nfree];
+		job->data = data[i];
+		job->len = datalen[i];
+		job->user_data = digest[i];
+		if ((job = sm3_mb_submit(&ctx, job)) != NULL) {
+			memcpy(job->user_data, job->digest, SM3_DIGEST_LENGTH);
+			free_jobs[nfree++] = job;
+		}
+	}
+	while ((job = sm3_mb_flush(&ctx)) != NULL) {
+		memcpy(job->user_data, job->digest, SM3_DIGEST_LENGTH);
+	}
+
+	memset(&ctx, 0, sizeof(ctx));
+}
@@ -0,0 +1,333 @@
+/* crypto/sm3/sm3_tree.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * Tree SM3: the leaves of the input are hashed independently on worker
+ * threads and the chain values are folded into a binary Merkle tree.
+ * Like a binary counter, the context keeps one chain value per set bit
+ * of the number of leaves seen so far, so memory use is O(log n) and the
+ * tree is independent of how the input is split over update calls.
+ */
+
+#include <string.h>
+#include <openssl/e_os2.h>
+#include <openssl/crypto.h>
+#include "sm3.h"
+
+#if defined(OPENSSL_THREADS) && defined(OPENSSL_SYS_UNIX)
+# define SM3_TREE_THREADS
+# include <pthread.h>
+# include <unistd.h>
+#endif
+
+/* leaves given to each thread per dispatch */
+#define SM3_TREE_GROUP		4
+
+typedef struct {
+	const unsigned char *data;
+	size_t leaf_size;
+	size_t nleaves;
+	unsigned char (*cv)[SM3_DIGEST_LENGTH];
+} SM3_TREE_JOB;
+
+static void sm3_tree_leaf(const unsigned char *data, size_t len,
+	unsigned char cv[SM3_DIGEST_LENGTH])
+{
+	static const unsigned char prefix = 0x00;
+	sm3_ctx_t ctx;
+
+	sm3_init(&ctx);
+	sm3_update(&ctx, &prefix, 1);
+	sm3_update(&ctx, data, len);
+	sm3_final(&ctx, cv);
+}
+
+/* out may be the same buffer as left or right */
+static void sm3_tree_node(const unsigned char left[SM3_DIGEST_LENGTH],
+	const unsigned char right[SM3_DIGEST_LENGTH],
+	unsigned char out[SM3_DIGEST_LENGTH])
+{
+	unsigned char buf[1 + 2 * SM3_DIGEST_LENGTH];
+
+	buf[0] = 0x01;
+	memcpy(buf + 1, left, SM3_DIGEST_LENGTH);
+	memcpy(buf + 1 + SM3_DIGEST_LENGTH, right, SM3_DIGEST_LENGTH);
+	sm3(buf, sizeof(buf), out);
+}
+
+static void *sm3_tree_worker(void *arg)
+{
+	SM3_TREE_JOB *job = (SM3_TREE_JOB *)arg;
+	size_t i;
+
+	for (i = 0; i < job->nleaves; i++) {
+		sm3_tree_leaf(job->data + i * job->leaf_size, job->leaf_size,
+			job->cv[i]);
+	}
+	return NULL;
+}
+
+/*
+ * hash nleaves full leaves, the leaves are spread over the threads. The
+ * threads are started for each batch and joined before it returns, with
+ * leaves of a megabyte the thread start is small next to the hashing and
+ * the context needs no pool to tear down.
+ */
+static void sm3_tree_hash_leaves(int nthreads, const unsigned char *data,
+	size_t leaf_size, size_t nleaves, unsigned char (*cv)[SM3_DIGEST_LENGTH])
+{
+	SM3_TREE_JOB job[SM3_TREE_MAX_THREADS];
+#ifdef SM3_TREE_THREADS
+	pthread_t tid[SM3_TREE_MAX_THREADS];
+	int started[SM3_TREE_MAX_THREADS];
+#endif
+	size_t per, rem, off = 0;
+	int i, n;
+
+	n = nleaves < (size_t)nthreads ? (int)nleaves : nthreads;
+	per = nleaves / n;
+	rem = nleaves % n;
+
+	for (i = 0; i < n; i++) {
+		job[i].data = data + off * leaf_size;
+		job[i].leaf_size = leaf_size;
+		job[i].nleaves = per + ((size_t)i < rem);
+		job[i].cv = cv + off;
+		off += job[i].nleaves;
+	}
+
+#ifdef SM3_TREE_THREADS
+	for (i = 1; i < n; i++) {
+		started[i] = pthread_create(&tid[i], NULL, sm3_tree_worker,
+			&job[i]) == 0;
+	}
+	sm3_tree_worker(&job[0]);
+	for (i = 1; i < n; i++) {
+		if (started[i])
+			pthread_join(tid[i], NULL);
+		else
+			sm3_tree_worker(&job[i]);
+	}
+#else
+	for (i = 0; i < n; i++) {
+		sm3_tree_worker(&job[i]);
+	}
+#endif
+}
+
+static void sm3_tree_push(sm3_tree_ctx_t *ctx,
+	const unsigned char cv[SM3_DIGEST_LENGTH])
+{
+	unsigned char node[SM3_DIGEST_LENGTH];
+	uint64_t n;
+
+	memcpy(node, cv, SM3_DIGEST_LENGTH);
+
+	/* every trailing zero bit of the leaf count completes a subtree */
+	for (n = ++ctx->nleaves; !(n & 1); n >>= 1) {
+		sm3_tree_node(ctx->stack[--ctx->depth], node, node);
+	}
+	memcpy(ctx->stack[ctx->depth++], node, SM3_DIGEST_LENGTH);
+}
+
+static void sm3_tree_process(sm3_tree_ctx_t *ctx, const unsigned char *data,
+	size_t nleaves)
+{
+	unsigned char cv[SM3_TREE_MAX_THREADS * SM3_TREE_GROUP][SM3_DIGEST_LENGTH];
+	size_t group = (size_t)ctx->nthreads * SM3_TREE_GROUP;
+	size_t i, n;
+
+	while (nleaves) {
+		n = nleaves < group ? nleaves : group;
+		sm3_tree_hash_leaves(ctx->nthreads, data, ctx->leaf_size, n, cv);
+		for (i = 0; i < n; i++) {
+			sm3_tree_push(ctx, cv[i]);
+		}
+		data += n * ctx->leaf_size;
+		nleaves -= n;
+	}
+}
+
+/*
+ * leaf_size 0 selects SM3_TREE_DEFAULT_LEAF_SIZE, nthreads <= 0 the
+ * number of online processors. The leaf buffer of an earlier use of ctx
+ * is freed, so ctx must be zeroed before its first init.
+ */
+int sm3_tree_init(sm3_tree_ctx_t *ctx, size_t leaf_size, int nthreads)
+{
+	if (ctx == NULL)
+		return 0;
+	sm3_tree_cleanup(ctx);
+
+	if (leaf_size == 0)
+		leaf_size = SM3_TREE_DEFAULT_LEAF_SIZE;
+	if (leaf_size > ((size_t)-1) / SM3_TREE_MAX_THREADS)
+		return 0;
+#ifdef SM3_TREE_THREADS
+# ifdef _SC_NPROCESSORS_ONLN
+	if (nthreads <= 0)
+		nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+# endif
+	if (nthreads <= 0)
+		nthreads = 1;
+	if (nthreads > SM3_TREE_MAX_THREADS)
+		nthreads = SM3_TREE_MAX_THREADS;
+#else
+	nthreads = 1;
+#endif
+
+	ctx->leaf_size = leaf_size;
+	ctx->nthreads = nthreads;
+	ctx->nleaves = 0;
+	ctx->depth = 0;
+	return 1;
+}
+
+/*
+ * Input is collected until every thread has a leaf, full leaves in the
+ * caller's buffer are hashed in place.
+ */
+int sm3_tree_update(sm3_tree_ctx_t *ctx, const unsigned char *data,
+	size_t data_len)
+{
+	size_t batch, n;
+
+	if (ctx == NULL)
+		return 0;
+
+	batch = ctx->leaf_size * ctx->nthreads;
+
+	if (ctx->num) {
+		n = batch - ctx->num;
+		if (n > data_len)
+			n = data_len;
+		memcpy(ctx->buf + ctx->num, data, n);
+		ctx->num += n;
+		data += n;
+		data_len -= n;
+		if (ctx->num < batch)
+			return 1;
+		sm3_tree_process(ctx, ctx->buf, ctx->nthreads);
+		ctx->num = 0;
+	}
+
+	if (data_len >= ctx->leaf_size) {
+		n = data_len / ctx->leaf_size;
+		sm3_tree_process(ctx, data, n);
+		data += n * ctx->leaf_size;
+		data_len -= n * ctx->leaf_size;
+	}
+
+	if (data_len) {
+		if (ctx->buf == NULL &&
+			(ctx->buf = OPENSSL_malloc(batch)) == NULL)
+			return 0;
+		memcpy(ctx->buf, data, data_len);
+		ctx->num = data_len;
+	}
+	return 1;
+}
+
+int sm3_tree_final(sm3_tree_ctx_t *ctx, unsigned char digest[SM3_DIGEST_LENGTH])
+{
+	unsigned char cv[SM3_DIGEST_LENGTH];
+	size_t nfull, tail;
+
+	if (ctx == NULL)
+		return 0;
+
+	nfull = ctx->num / ctx->leaf_size;
+	tail = ctx->num % ctx->leaf_size;
+	if (nfull)
+		sm3_tree_process(ctx, ctx->buf, nfull);
+	if (tail) {
+		sm3_tree_leaf(ctx->buf + nfull * ctx->leaf_size, tail, cv);
+		sm3_tree_push(ctx, cv);
+	} else if (ctx->nleaves == 0) {
+		sm3_tree_leaf((const unsigned char *)"", 0, cv);
+		sm3_tree_push(ctx, cv);
+	}
+
+	/* fold the incomplete right edge of the tree */
+	memcpy(cv, ctx->stack[--ctx->depth], SM3_DIGEST_LENGTH);
+	while (ctx->depth) {
+		sm3_tree_node(ctx->stack[--ctx->depth], cv, cv);
+	}
+	memcpy(digest, cv, SM3_DIGEST_LENGTH);
+
+	sm3_tree_cleanup(ctx);
+	return 1;
+}
+
+void sm3_tree_cleanup(sm3_tree_ctx_t *ctx)
+{
+	if (ctx->buf) {
+		OPENSSL_cleanse(ctx->buf, ctx->leaf_size * ctx->nthreads);
+		OPENSSL_free(ctx->buf);
+		ctx->buf = NULL;
+	}
+	ctx->num = 0;
+}
+
+int sm3_tree(const unsigned char *data, size_t datalen, size_t leaf_size,
+	int nthreads, unsigned char digest[SM3_DIGEST_LENGTH])
+{
+	sm3_tree_ctx_t ctx;
+
+	memset(&ctx, 0, sizeof(ctx));
+	if (!sm3_tree_init(&ctx, leaf_size, nthreads))
+		return 0;
+	if (!sm3_tree_update(&ctx, data, datalen)) {
+		sm3_tree_cleanup(&ctx);
+		return 0;
+	}
+	return sm3_tree_final(&ctx, digest);
+}
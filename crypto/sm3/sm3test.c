@@ -62,6 +62,7 @@ int main(int argc, char *argv[])
     return (0);
 }
 #else
+# include <openssl/crypto.h>
 # include <openssl/evp.h>
 # include <openssl/sm3.h>
 
@@ -78,6 +79,248 @@ static char *ret[] = {
 };
 
 static char *pt(unsigned char *md);
+
+/* hash messages of many different lengths with sm3_mb() and compare with sm3() */
+static int test_sm3_mb(void)
+{
+    unsigned char msg[700];
+    const unsigned char *data[37];
+    size_t datalen[37];
+    unsigned char dgst[37][SM3_DIGEST_LENGTH];
+    unsigned char *pdgst[37];
+    unsigned char md[SM3_DIGEST_LENGTH];
+    size_t i, n;
+
+    for (i = 0; i < sizeof(msg); i++)
+        msg[i] = (unsigned char)(i * 7 + 1);
+
+    for (n = 1; n <= 37; n += 4) {
+        for (i = 0; i < n; i++) {
+            data[i] = msg + i;
+            datalen[i] = (i * 53 + n * 11) % (sizeof(msg) - i);
+            pdgst[i] = dgst[i];
+        }
+        if (!EVP_Digest_mb((const void **)data, datalen, pdgst, n,
+                           EVP_sm3(), NULL)) {
+            printf("EVP_Digest_mb() failed for %lu buffers\n",
+                   (unsigned long)n);
+            return 1;
+        }
+        for (i = 0; i < n; i++) {
+            sm3(data[i], datalen[i], md);
+            if (memcmp(md, dgst[i], SM3_DIGEST_LENGTH) != 0) {
+                printf("error calculating multi-buffer SM3 of %lu bytes\n",
+                       (unsigned long)datalen[i]);
+                return 1;
+            }
+        }
+    }
+    printf("multi-buffer test ok\n");
+    return 0;
+}
+
+/* straightforward recursive reference of the tree hash */
+static void sm3_tree_ref(const unsigned char *data, size_t leaf_size,
+                         size_t first, size_t nleaves, size_t len,
+                         unsigned char md[SM3_DIGEST_LENGTH])
+{
+    unsigned char buf[1 + 2 * SM3_DIGEST_LENGTH];
+    size_t half;
+    sm3_ctx_t ctx;
+
+    if (nleaves == 1) {
+        size_t n = len - first * leaf_size;
+        if (n > leaf_size)
+            n = leaf_size;
+        buf[0] = 0x00;
+        sm3_init(&ctx);
+        sm3_update(&ctx, buf, 1);
+        sm3_update(&ctx, data + first * leaf_size, n);
+        sm3_final(&ctx, md);
+        return;
+    }
+    for (half = 1; half * 2 < nleaves; half *= 2) ;
+    buf[0] = 0x01;
+    sm3_tree_ref(data, leaf_size, first, half, len, buf + 1);
+    sm3_tree_ref(data, leaf_size, first + half, nleaves - half, len,
+                 buf + 1 + SM3_DIGEST_LENGTH);
+    sm3(buf, sizeof(buf), md);
+}
+
+/* compare sm3_tree() and chunked EVP_sm3_tree() updates with the reference */
+static int test_sm3_tree(void)
+{
+    static const size_t leaf_sizes[] = { 64, 100, 1024 };
+    static const int threads[] = { 1, 3, 8 };
+    unsigned char *msg;
+    unsigned char md[SM3_DIGEST_LENGTH], ref[SM3_DIGEST_LENGTH];
+    size_t len, leaf, off, n, i, j;
+    EVP_MD_CTX ctx;
+    int err = 0;
+
+    if ((msg = malloc(40000)) == NULL)
+        return 1;
+    for (i = 0; i < 40000; i++)
+        msg[i] = (unsigned char)(i * 13 + 5);
+
+    EVP_MD_CTX_init(&ctx);
+    for (i = 0; i < sizeof(leaf_sizes) / sizeof(leaf_sizes[0]); i++) {
+        leaf = leaf_sizes[i];
+        for (len = 0; len <= 40000; len = len * 3 + leaf - 1) {
+            n = len ? (len + leaf - 1) / leaf : 1;
+            sm3_tree_ref(msg, leaf, 0, n, len, ref);
+            for (j = 0; j < sizeof(threads) / sizeof(threads[0]); j++) {
+                sm3_tree(msg, len, leaf, threads[j], md);
+                if (memcmp(md, ref, SM3_DIGEST_LENGTH) != 0) {
+                    printf("error calculating tree SM3 of %lu bytes, "
+                           "leaf size %lu, %d threads\n", (unsigned long)len,
+                           (unsigned long)leaf, threads[j]);
+                    err++;
+                }
+                if (!EVP_DigestInit_ex(&ctx, EVP_sm3_tree(), NULL) ||
+                    !EVP_MD_CTX_ctrl(&ctx, EVP_MD_CTRL_SM3_TREE_PARAMS,
+                                     threads[j], &leaf)) {
+                    printf("error setting EVP tree SM3 parameters\n");
+                    err++;
+                    continue;
+                }
+                for (off = 0; off < len; off += n) {
+                    n = (off * 7) % (3 * leaf) + 1;
+                    if (n > len - off)
+                        n = len - off;
+                    EVP_DigestUpdate(&ctx, msg + off, n);
+                }
+                EVP_DigestFinal_ex(&ctx, md, NULL);
+                if (memcmp(md, ref, SM3_DIGEST_LENGTH) != 0) {
+                    printf("error calculating EVP tree SM3 of %lu bytes, "
+                           "leaf size %lu, %d threads\n", (unsigned long)len,
+                           (unsigned long)leaf, threads[j]);
+                    err++;
+                }
+            }
+        }
+    }
+    EVP_MD_CTX_cleanup(&ctx);
+    free(msg);
+
+    if (!err)
+        printf("tree test ok\n");
+    return err ? 1 : 0;
+}
+
+static size_t malloc_count = 0, free_count = 0;
+
+static void *count_malloc(size_t n)
+{
+    malloc_count++;
+    return malloc(n);
+}
+
+static void count_free(void *p)
+{
+    if (p != NULL)
+        free_count++;
+    free(p);
+}
+
+static void *count_realloc(void *p, size_t n)
+{
+    malloc_count++;
+    return realloc(p, n);
+}
+
+/*
+ * once the contexts have their md_data, reusing them with EVP_MD_CTX_reinit()
+ * or EVP_DigestInit_ex() of the same digest and copying between them must
+ * not allocate anything
+ */
+static int test_sm3_reuse(void)
+{
+    EVP_MD_CTX ctx, ctx2;
+    unsigned char md[SM3_DIGEST_LENGTH], md2[SM3_DIGEST_LENGTH];
+    size_t count;
+    int i, err = 0;
+
+    EVP_MD_CTX_init(&ctx);
+    EVP_MD_CTX_init(&ctx2);
+    if (EVP_MD_CTX_reinit(&ctx)) {
+        printf("EVP_MD_CTX_reinit() without a digest should fail\n");
+        err++;
+    }
+
+    EVP_DigestInit_ex(&ctx, EVP_sm3(), NULL);
+    EVP_MD_CTX_copy_ex(&ctx2, &ctx);
+    count = malloc_count;
+    for (i = 0; i < 100; i++) {
+        if (i % 2)
+            EVP_MD_CTX_reinit(&ctx);
+        else
+            EVP_DigestInit_ex(&ctx, EVP_sm3(), NULL);
+        EVP_DigestUpdate(&ctx, "ab", 2);
+        EVP_MD_CTX_copy_ex(&ctx2, &ctx);
+        EVP_DigestUpdate(&ctx, "c", 1);
+        EVP_DigestUpdate(&ctx2, "c", 1);
+        EVP_DigestFinal_ex(&ctx, md, NULL);
+        EVP_DigestFinal_ex(&ctx2, md2, NULL);
+        if (strcmp(pt(md), ret[0]) != 0 || strcmp(pt(md2), ret[0]) != 0) {
+            printf("error calculating SM3 with a reused context\n");
+            err++;
+            break;
+        }
+    }
+    if (malloc_count != count) {
+        printf("SM3 context reuse allocated %lu times\n",
+               (unsigned long)(malloc_count - count));
+        err++;
+    }
+    EVP_MD_CTX_cleanup(&ctx2);
+    EVP_MD_CTX_cleanup(&ctx);
+
+    if (!err)
+        printf("reuse test ok\n");
+    return err ? 1 : 0;
+}
+
+/* a new init of a tree context holding buffered input frees the buffer */
+static int test_sm3_tree_reinit(void)
+{
+    static const unsigned char msg[100];
+    sm3_tree_ctx_t tctx;
+    EVP_MD_CTX ctx;
+    size_t leaf = 64, count;
+    int err = 0;
+
+    memset(&tctx, 0, sizeof(tctx));
+    sm3_tree_init(&tctx, leaf, 2);
+    sm3_tree_update(&tctx, msg, 10);
+    count = free_count;
+    sm3_tree_init(&tctx, leaf, 2);
+    if (free_count != count + 1 || tctx.buf != NULL) {
+        printf("sm3_tree_init() did not free the leaf buffer\n");
+        err++;
+    }
+    sm3_tree_cleanup(&tctx);
+
+    EVP_MD_CTX_init(&ctx);
+    if (!EVP_DigestInit_ex(&ctx, EVP_sm3_tree(), NULL) ||
+        !EVP_MD_CTX_ctrl(&ctx, EVP_MD_CTRL_SM3_TREE_PARAMS, 2, &leaf) ||
+        !EVP_DigestUpdate(&ctx, msg, 10)) {
+        printf("error setting up EVP tree SM3\n");
+        err++;
+    }
+    count = free_count;
+    EVP_DigestInit_ex(&ctx, EVP_sm3_tree(), NULL);
+    if (free_count != count + 1) {
+        printf("EVP_DigestInit_ex() did not free the tree leaf buffer\n");
+        err++;
+    }
+    EVP_MD_CTX_cleanup(&ctx);
+
+    if (!err)
+        printf("tree reinit test ok\n");
+    return err ? 1 : 0;
+}
+
 int main(int argc, char *argv[])
 {
     int i, err = 0;
@@ -85,6 +328,8 @@ int main(int argc, char *argv[])
     char *p;
     unsigned char md[SM3_DIGEST_LENGTH];
 
+    CRYPTO_set_mem_functions(count_malloc, count_realloc, count_free);
+
     P = test;
     R = ret;
     i = 1;
@@ -101,6 +346,10 @@ int main(int argc, char *argv[])
         R++;
         P++;
     }
+    err += test_sm3_mb();
+    err += test_sm3_tree();
+    err += test_sm3_tree_reinit();
+    err += test_sm3_reuse();
 
 # ifdef OPENSSL_SYS_NETWARE
     if (err)
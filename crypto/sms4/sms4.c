@@ -49,6 +49,7 @@
  *
  */
 
+#include <openssl/crypto.h>
 #include "sms4.h"
 
 #define FK0	0xa3b1bac6
@@ -239,6 +240,22 @@ void sms4_set_decrypt_key(sms4_key_t *key, const unsigned char *user_key)
 	ROUND_(X1, X2, X3, X4, X0, CK31, rk[0]);
 }
 
+void sms4_set_key(sms4_key_t *enc_key, sms4_key_t *dec_key,
+	const unsigned char *user_key)
+{
+	sms4_key_t key;
+	int i;
+
+	sms4_set_encrypt_key(&key, user_key);
+	if (dec_key) {
+		for (i = 0; i < SMS4_NUM_ROUNDS; i++)
+			dec_key->rk[i] = key.rk[SMS4_NUM_ROUNDS - 1 - i];
+	}
+	if (enc_key)
+		memcpy(enc_key, &key, sizeof(key));
+	OPENSSL_cleanse(&key, sizeof(key));
+}
+
 void sms4_encrypt(const unsigned char *in, unsigned char *out, const sms4_key_t *key)
 {
 	const uint32_t *rk = key->rk;
@@ -71,13 +71,35 @@ typedef struct {
 
 void sms4_set_encrypt_key(sms4_key_t *key, const unsigned char *user_key);
 void sms4_set_decrypt_key(sms4_key_t *key, const unsigned char *user_key);
+/* both schedules from one expansion, either key may be NULL */
+void sms4_set_key(sms4_key_t *enc_key, sms4_key_t *dec_key,
+	const unsigned char *user_key);
 void sms4_encrypt(const unsigned char *in, unsigned char *out, const sms4_key_t *key);
 #define sms4_decrypt(in,out,key)  sms4_encrypt(in,out,key)
 
+/* n-block interfaces, use the AVX2/AES-NI kernels when available */
+void sms4_encrypt_8blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key);
+void sms4_encrypt_16blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key);
+void sms4_ecb_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key);
+void sms4_ctr32_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char iv[16]);
+
 void sms4_ecb_encrypt(const unsigned char *in, unsigned char *out,
 	const sms4_key_t *key, int enc);
 void sms4_cbc_encrypt(const unsigned char *in, unsigned char *out,
 	size_t len, const sms4_key_t *key, unsigned char *iv, int enc);
+/*
+ * CBC encryption of n independent messages under one key, blocks[i]
+ * blocks of in[i] to out[i] chained from iv[i], which is updated. Up to
+ * SMS4_MB_LANES chains run in parallel.
+ */
+#define SMS4_MB_LANES		64
+void sms4_cbc_encrypt_mb(const unsigned char *in[], unsigned char *out[],
+	const size_t blocks[], size_t n, const sms4_key_t *key,
+	unsigned char *iv[]);
 void sms4_cfb128_encrypt(const unsigned char *in, unsigned char *out,
 	size_t len, const sms4_key_t *key, unsigned char *iv, int *num, int enc);
 void sms4_ofb128_encrypt(const unsigned char *in, unsigned char *out,
@@ -85,6 +107,31 @@ void sms4_ofb128_encrypt(const unsigned char *in, unsigned char *out,
 void sms4_ctr128_encrypt(const unsigned char *in, unsigned char *out,
 	size_t len, const sms4_key_t *key, unsigned char *iv,
 	unsigned char ecount_buf[SMS4_BLOCK_SIZE], unsigned int *num);
+int sms4_xts_encrypt(const unsigned char *in, unsigned char *out,
+	size_t len, const sms4_key_t *key1, const sms4_key_t *key2,
+	const unsigned char iv[16], int enc);
+
+/* ccm128_f for CRYPTO_ccm128_encrypt_ccm64/CRYPTO_ccm128_decrypt_ccm64 */
+void sms4_ccm64_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char ivec[16],
+	unsigned char cmac[16]);
+void sms4_ccm64_decrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char ivec[16],
+	unsigned char cmac[16]);
+
+/*
+ * LRU cache of key schedules keyed by the raw key, for workloads that
+ * keep switching between a limited set of keys. A cache is not locked,
+ * keep one per thread or per connection.
+ */
+#define SMS4_KEY_CACHE_SIZE	64
+typedef struct sms4_key_cache_st SMS4_KEY_CACHE;
+
+SMS4_KEY_CACHE *SMS4_KEY_CACHE_new(void);
+void SMS4_KEY_CACHE_free(SMS4_KEY_CACHE *cache);
+/* returns 1 on a hit, 0 if the schedules had to be computed */
+int SMS4_KEY_CACHE_get(SMS4_KEY_CACHE *cache, const unsigned char *user_key,
+	sms4_key_t *enc_key, sms4_key_t *dec_key);
 
 int sms4_wrap_key(sms4_key_t *key, const unsigned char *iv,
 	unsigned char *out, const unsigned char *in, unsigned int inlen);
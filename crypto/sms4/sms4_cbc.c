@@ -49,14 +49,102 @@
  *
  */
 
+#include <string.h>
+#include <openssl/crypto.h>
 #include <openssl/sms4.h>
 #include <openssl/modes.h>
 
+/*
+ * CBC decryption has no chaining dependency between the block cipher
+ * calls, so full chunks are decrypted with the multi-block ECB kernels
+ * and then xored with the previous ciphertext blocks. The xor goes from
+ * the last block to the first so that in == out works.
+ */
+static void sms4_cbc_decrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	unsigned char *iv)
+{
+	unsigned char buf[16 * 16];
+	unsigned char next_iv[16];
+	size_t n, i;
+
+	while (blocks) {
+		n = blocks < 16 ? blocks : 16;
+		sms4_ecb_encrypt_blocks(in, buf, n, key);
+		memcpy(next_iv, in + 16 * (n - 1), 16);
+		for (i = 16 * n; i > 16; i--) {
+			out[i - 1] = buf[i - 1] ^ in[i - 17];
+		}
+		for (i = 0; i < 16; i++) {
+			out[i] = buf[i] ^ iv[i];
+		}
+		memcpy(iv, next_iv, 16);
+		in += 16 * n;
+		out += 16 * n;
+		blocks -= n;
+	}
+	OPENSSL_cleanse(buf, sizeof(buf));
+}
+
+/*
+ * CBC encryption is serial inside a message, so the chains of different
+ * messages are interleaved instead: block i of every lane still active
+ * is encrypted in the same multi-block call.
+ */
+void sms4_cbc_encrypt_mb(const unsigned char *in[], unsigned char *out[],
+	const size_t blocks[], size_t n, const sms4_key_t *key,
+	unsigned char *iv[])
+{
+	unsigned char buf[16 * SMS4_MB_LANES];
+	int lane[SMS4_MB_LANES];
+	size_t max, b, i, j;
+	int lanes, k, m;
+
+	for (; n; in += lanes, out += lanes, blocks += lanes, iv += lanes,
+		n -= lanes) {
+		lanes = n < SMS4_MB_LANES ? (int)n : SMS4_MB_LANES;
+
+		max = 0;
+		for (k = 0; k < lanes; k++) {
+			if (blocks[k] > max)
+				max = blocks[k];
+		}
+
+		for (b = 0; b < max; b++) {
+			for (k = 0, m = 0; k < lanes; k++) {
+				const unsigned char *p, *c;
+
+				if (b >= blocks[k])
+					continue;
+				p = in[k] + 16 * b;
+				c = b ? out[k] + 16 * (b - 1) : iv[k];
+				for (j = 0; j < 16; j++)
+					buf[16 * m + j] = p[j] ^ c[j];
+				lane[m++] = k;
+			}
+			sms4_ecb_encrypt_blocks(buf, buf, m, key);
+			for (i = 0; i < (size_t)m; i++)
+				memcpy(out[lane[i]] + 16 * b, buf + 16 * i, 16);
+		}
+
+		for (k = 0; k < lanes; k++) {
+			if (blocks[k])
+				memcpy(iv[k], out[k] + 16 * (blocks[k] - 1), 16);
+		}
+	}
+	OPENSSL_cleanse(buf, sizeof(buf));
+}
+
 void sms4_cbc_encrypt(const unsigned char *in, unsigned char *out,
 	size_t len, const sms4_key_t *key, unsigned char *iv, int enc)
 {
-	if (enc)
+	if (enc) {
 		CRYPTO_cbc128_encrypt(in, out, len, key, iv, (block128_f)sms4_encrypt);
-	else	CRYPTO_cbc128_decrypt(in, out, len, key, iv, (block128_f)sms4_encrypt);
+		return;
+	}
+	sms4_cbc_decrypt_blocks(in, out, len / 16, key, iv);
+	in += len & ~(size_t)15;
+	out += len & ~(size_t)15;
+	if (len & 15)
+		CRYPTO_cbc128_decrypt(in, out, len & 15, key, iv, (block128_f)sms4_encrypt);
 }
-
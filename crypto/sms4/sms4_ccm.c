@@ -0,0 +1,123 @@
+/* crypto/sms4/sms4_ccm.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+#include <openssl/crypto.h>
+#include <openssl/sms4.h>
+#include "sms4_lcl.h"
+
+/*
+ * ccm128_f stream functions for CRYPTO_ccm128_{en,de}crypt_ccm64(). The
+ * CBC-MAC is inherently serial, but the CTR half of CCM goes through the
+ * multi-block kernels.
+ */
+
+#define SMS4_CCM_CHUNK	16
+
+static void sms4_ccm64_encrypt(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char ivec[16],
+	unsigned char cmac[16], int enc)
+{
+	unsigned char ctr[16];
+	uint32_t lo, hi;
+	size_t n, i, j;
+
+	memcpy(ctr, ivec, 16);
+
+	while (blocks) {
+		/* sms4_ctr32_encrypt_blocks() must not wrap the low word */
+		lo = GET32(ctr + 12);
+		n = blocks < SMS4_CCM_CHUNK ? blocks : SMS4_CCM_CHUNK;
+		if ((uint32_t)(0 - lo) && n > (uint32_t)(0 - lo))
+			n = (uint32_t)(0 - lo);
+
+		if (enc) {
+			for (i = 0; i < n; i++) {
+				for (j = 0; j < 16; j++)
+					cmac[j] ^= in[16 * i + j];
+				sms4_encrypt(cmac, cmac, key);
+			}
+		}
+		sms4_ctr32_encrypt_blocks(in, out, n, key, ctr);
+		if (!enc) {
+			for (i = 0; i < n; i++) {
+				for (j = 0; j < 16; j++)
+					cmac[j] ^= out[16 * i + j];
+				sms4_encrypt(cmac, cmac, key);
+			}
+		}
+
+		/* 64-bit counter */
+		lo += (uint32_t)n;
+		PUT32(lo, ctr + 12);
+		if (lo == 0) {
+			hi = GET32(ctr + 8) + 1;
+			PUT32(hi, ctr + 8);
+		}
+
+		in += 16 * n;
+		out += 16 * n;
+		blocks -= n;
+	}
+}
+
+void sms4_ccm64_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char ivec[16],
+	unsigned char cmac[16])
+{
+	sms4_ccm64_encrypt(in, out, blocks, key, ivec, cmac, 1);
+}
+
+void sms4_ccm64_decrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char ivec[16],
+	unsigned char cmac[16])
+{
+	sms4_ccm64_encrypt(in, out, blocks, key, ivec, cmac, 0);
+}
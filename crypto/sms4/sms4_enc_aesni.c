@@ -0,0 +1,284 @@
+/* crypto/sms4/sms4_enc_aesni.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * SMS4 with the S-box computed by AESENCLAST. The SMS4 and AES S-boxes
+ * are both affine transforms around inversion in GF(2^8), and the two
+ * fields are isomorphic, so
+ *
+ *   S_sms4(x) = post(S_aes(pre(x)))
+ *
+ * with the affine maps pre and post absorbing the field isomorphism and
+ * both S-box affine transforms. The affine maps are applied with two
+ * 16-entry PSHUFB lookups per byte nibble, ShiftRows is undone by a byte
+ * shuffle in advance. The cipher is table free and constant time. Four
+ * blocks are word-sliced in one set of xmm registers, the 8-block
+ * functions interleave two sets. CPUs with AVX2 use the 256-bit variant
+ * in sms4_enc_avx2.c instead.
+ */
+
+#include <openssl/crypto.h>
+#include "sms4.h"
+#include "sms4_lcl.h"
+
+#ifdef SMS4_AESNI
+#include <immintrin.h>
+
+#define SMS4_AESNI_TARGET	__attribute__((target("aes,ssse3")))
+#define SMS4_AESNI_INLINE	static inline __attribute__((always_inline, target("aes,ssse3")))
+
+#define PRE_LO		_mm_setr_epi8(SMS4_AESNI_PRE_LO)
+#define PRE_HI		_mm_setr_epi8(SMS4_AESNI_PRE_HI)
+#define POST_LO		_mm_setr_epi8(SMS4_AESNI_POST_LO)
+#define POST_HI		_mm_setr_epi8(SMS4_AESNI_POST_HI)
+#define INV_SHIFT_ROWS	_mm_setr_epi8(SMS4_AESNI_INV_SHIFT_ROWS)
+
+#define BSWAP32		_mm_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12)
+#define ROTL8		_mm_setr_epi8(3,0,1,2,7,4,5,6,11,8,9,10,15,12,13,14)
+#define ROTL16		_mm_setr_epi8(2,3,0,1,6,7,4,5,10,11,8,9,14,15,12,13)
+#define ROTL24		_mm_setr_epi8(1,2,3,0,5,6,7,4,9,10,11,8,13,14,15,12)
+
+SMS4_AESNI_INLINE __m128i sms4_aesni_affine(__m128i x, __m128i lo, __m128i hi)
+{
+	const __m128i mask = _mm_set1_epi8(0x0f);
+
+	return _mm_xor_si128(
+		_mm_shuffle_epi8(lo, _mm_and_si128(x, mask)),
+		_mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(x, 4), mask)));
+}
+
+/* L(S(x)) of every word */
+SMS4_AESNI_INLINE __m128i sms4_aesni_t(__m128i x)
+{
+	__m128i t;
+
+	x = _mm_shuffle_epi8(x, INV_SHIFT_ROWS);
+	x = sms4_aesni_affine(x, PRE_LO, PRE_HI);
+	x = _mm_aesenclast_si128(x, _mm_setzero_si128());
+	x = sms4_aesni_affine(x, POST_LO, POST_HI);
+
+	/* L(x) = x ^ (x ^ x <<< 8 ^ x <<< 16) <<< 2 ^ x <<< 24 */
+	t = _mm_xor_si128(x, _mm_xor_si128(_mm_shuffle_epi8(x, ROTL8),
+		_mm_shuffle_epi8(x, ROTL16)));
+	t = _mm_xor_si128(_mm_slli_epi32(t, 2), _mm_srli_epi32(t, 30));
+	return _mm_xor_si128(_mm_xor_si128(x, t), _mm_shuffle_epi8(x, ROTL24));
+}
+
+#define ROUND(x0, x1, x2, x3, rk)					\
+	x0 = _mm_xor_si128(x0, sms4_aesni_t(_mm_xor_si128(		\
+		_mm_xor_si128(x1, x2),					\
+		_mm_xor_si128(x3, _mm_set1_epi32(rk)))))
+
+/* 32 rounds over nsets interleaved groups of 4 blocks */
+SMS4_AESNI_INLINE void sms4_aesni_rounds(__m128i *x, int nsets,
+	const uint32_t *rk)
+{
+	int i, j;
+
+	for (i = 0; i < SMS4_NUM_ROUNDS; i += 4) {
+		for (j = 0; j < nsets; j++) {
+			ROUND(x[4*j+0], x[4*j+1], x[4*j+2], x[4*j+3], rk[i]);
+		}
+		for (j = 0; j < nsets; j++) {
+			ROUND(x[4*j+1], x[4*j+2], x[4*j+3], x[4*j+0], rk[i+1]);
+		}
+		for (j = 0; j < nsets; j++) {
+			ROUND(x[4*j+2], x[4*j+3], x[4*j+0], x[4*j+1], rk[i+2]);
+		}
+		for (j = 0; j < nsets; j++) {
+			ROUND(x[4*j+3], x[4*j+0], x[4*j+1], x[4*j+2], rk[i+3]);
+		}
+	}
+}
+
+/* 4x4 word transpose, blocks to word-sliced and back */
+#define TRANSPOSE(x0, x1, x2, x3) do {					\
+	__m128i t0 = _mm_unpacklo_epi32(x0, x1);			\
+	__m128i t1 = _mm_unpackhi_epi32(x0, x1);			\
+	__m128i t2 = _mm_unpacklo_epi32(x2, x3);			\
+	__m128i t3 = _mm_unpackhi_epi32(x2, x3);			\
+	x0 = _mm_unpacklo_epi64(t0, t2);				\
+	x1 = _mm_unpackhi_epi64(t0, t2);				\
+	x2 = _mm_unpacklo_epi64(t1, t3);				\
+	x3 = _mm_unpackhi_epi64(t1, t3);				\
+	} while (0)
+
+SMS4_AESNI_INLINE void sms4_aesni_load(__m128i *x, const unsigned char *in)
+{
+	const __m128i bswap = BSWAP32;
+
+	x[0] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)in), bswap);
+	x[1] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + 16)), bswap);
+	x[2] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + 32)), bswap);
+	x[3] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + 48)), bswap);
+	TRANSPOSE(x[0], x[1], x[2], x[3]);
+}
+
+/* x[] as left by sms4_aesni_rounds(), converted back into 4 blocks */
+SMS4_AESNI_INLINE void sms4_aesni_output(__m128i y[4], const __m128i *x)
+{
+	const __m128i bswap = BSWAP32;
+
+	y[0] = x[3];
+	y[1] = x[2];
+	y[2] = x[1];
+	y[3] = x[0];
+	TRANSPOSE(y[0], y[1], y[2], y[3]);
+	y[0] = _mm_shuffle_epi8(y[0], bswap);
+	y[1] = _mm_shuffle_epi8(y[1], bswap);
+	y[2] = _mm_shuffle_epi8(y[2], bswap);
+	y[3] = _mm_shuffle_epi8(y[3], bswap);
+}
+
+SMS4_AESNI_INLINE void sms4_aesni_store(unsigned char *out, const __m128i y[4])
+{
+	_mm_storeu_si128((__m128i *)out, y[0]);
+	_mm_storeu_si128((__m128i *)(out + 16), y[1]);
+	_mm_storeu_si128((__m128i *)(out + 32), y[2]);
+	_mm_storeu_si128((__m128i *)(out + 48), y[3]);
+}
+
+SMS4_AESNI_INLINE void sms4_aesni_xor_store(unsigned char *out,
+	const unsigned char *in, const __m128i y[4])
+{
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		_mm_storeu_si128((__m128i *)(out + 16 * i), _mm_xor_si128(y[i],
+			_mm_loadu_si128((const __m128i *)(in + 16 * i))));
+	}
+}
+
+SMS4_AESNI_TARGET
+void sms4_aesni_encrypt_4blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key)
+{
+	__m128i x[4], y[4];
+
+	sms4_aesni_load(x, in);
+	sms4_aesni_rounds(x, 1, key->rk);
+	sms4_aesni_output(y, x);
+	sms4_aesni_store(out, y);
+}
+
+SMS4_AESNI_TARGET
+void sms4_aesni_encrypt_8blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key)
+{
+	__m128i x[8], y[4];
+
+	sms4_aesni_load(x, in);
+	sms4_aesni_load(x + 4, in + 64);
+	sms4_aesni_rounds(x, 2, key->rk);
+	sms4_aesni_output(y, x);
+	sms4_aesni_store(out, y);
+	sms4_aesni_output(y, x + 4);
+	sms4_aesni_store(out + 64, y);
+}
+
+/* ctr128_f compatible, only the low 32 bits of the counter are incremented */
+SMS4_AESNI_TARGET
+void sms4_aesni_ctr32_encrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	const unsigned char iv[16])
+{
+	const __m128i four = _mm_set1_epi32(4);
+	__m128i c0, c1, c2, ctr;
+	__m128i x[8], y[4];
+	unsigned char buf[16 * 4];
+	size_t i, n;
+
+	c0 = _mm_set1_epi32((int)GET32(iv));
+	c1 = _mm_set1_epi32((int)GET32(iv + 4));
+	c2 = _mm_set1_epi32((int)GET32(iv + 8));
+	ctr = _mm_add_epi32(_mm_set1_epi32((int)GET32(iv + 12)),
+		_mm_setr_epi32(0, 1, 2, 3));
+
+	while (blocks >= 8) {
+		x[0] = c0; x[1] = c1; x[2] = c2; x[3] = ctr;
+		ctr = _mm_add_epi32(ctr, four);
+		x[4] = c0; x[5] = c1; x[6] = c2; x[7] = ctr;
+		ctr = _mm_add_epi32(ctr, four);
+		sms4_aesni_rounds(x, 2, key->rk);
+		sms4_aesni_output(y, x);
+		sms4_aesni_xor_store(out, in, y);
+		sms4_aesni_output(y, x + 4);
+		sms4_aesni_xor_store(out + 64, in + 64, y);
+		in += 128;
+		out += 128;
+		blocks -= 8;
+	}
+
+	while (blocks) {
+		x[0] = c0; x[1] = c1; x[2] = c2; x[3] = ctr;
+		ctr = _mm_add_epi32(ctr, four);
+		sms4_aesni_rounds(x, 1, key->rk);
+		sms4_aesni_output(y, x);
+		if (blocks >= 4) {
+			sms4_aesni_xor_store(out, in, y);
+			n = 64;
+		} else {
+			sms4_aesni_store(buf, y);
+			n = blocks * 16;
+			for (i = 0; i < n; i++) {
+				out[i] = in[i] ^ buf[i];
+			}
+			OPENSSL_cleanse(buf, sizeof(buf));
+		}
+		in += n;
+		out += n;
+		blocks -= n / 16;
+	}
+}
+
+#else
+static void *dummy = &dummy;
+#endif
@@ -49,102 +49,339 @@
  */
 
 
+/*
+ * AVX2 SMS4 kernels, 8 blocks per 256-bit register set. The blocks are
+ * transposed so that register j holds word j of every block, a round is
+ * then 8 independent rounds of the scalar cipher. The S-box and the
+ * linear transform are merged into one 1 KB table SMS4_T[x] = L(S(x)),
+ * the other three bytes of a word use the same table rotated, as L
+ * commutes with rotation, so a round costs 4 gathers and 3 byte shuffles.
+ *
+ * On CPUs with AES-NI the same kernels are built around the table free
+ * S-box of sms4_enc_aesni.c instead, with the affine maps and the linear
+ * transform done on 256-bit registers and AESENCLAST on each half.
+ */
+
+#include <openssl/crypto.h>
 #include "sms4.h"
 #include "sms4_lcl.h"
+
+#ifdef SMS4_AVX2
 #include <immintrin.h>
 
-static __m256i mask_ffff;
-static __m256i vindex_0s;
-static __m256i vindex_4i;
-static __m256i vindex_swap;
-static __m256i vindex_read;
+#define SMS4_AVX2_TARGET	__attribute__((target("avx2")))
+#define SMS4_AVX2_INLINE	static inline __attribute__((always_inline, target("avx2")))
+#define SMS4_AVX2_AESNI_TARGET	__attribute__((target("avx2,aes")))
+#define SMS4_AVX2_AESNI_INLINE	static inline __attribute__((always_inline, target("avx2,aes")))
+
+static const uint32_t SMS4_T[256] = {
+	0xd55b5b8e, 0x924242d0, 0xeaa7a74d, 0xfdfbfb06,
+	0xcf3333fc, 0xe2878765, 0x3df4f4c9, 0xb5dede6b,
+	0x1658584e, 0xb4dada6e, 0x14505044, 0xc10b0bca,
+	0x28a0a088, 0xf8efef17, 0x2cb0b09c, 0x05141411,
+	0x2bacac87, 0x669d9dfb, 0x986a6af2, 0x77d9d9ae,
+	0x2aa8a882, 0xbcfafa46, 0x04101014, 0xc00f0fcf,
+	0xa8aaaa02, 0x45111154, 0x134c4c5f, 0x269898be,
+	0x4825256d, 0x841a1a9e, 0x0618181e, 0x9b6666fd,
+	0x9e7272ec, 0x4309094a, 0x51414110, 0xf7d3d324,
+	0x934646d5, 0xecbfbf53, 0x9a6262f8, 0x7be9e992,
+	0x33ccccff, 0x55515104, 0x0b2c2c27, 0x420d0d4f,
+	0xeeb7b759, 0xcc3f3ff3, 0xaeb2b21c, 0x638989ea,
+	0xe7939374, 0xb1cece7f, 0x1c70706c, 0xaba6a60d,
+	0xca2727ed, 0x08202028, 0xeba3a348, 0x975656c1,
+	0x82020280, 0xdc7f7fa3, 0x965252c4, 0xf9ebeb12,
+	0x74d5d5a1, 0x8d3e3eb3, 0x3ffcfcc3, 0xa49a9a3e,
+	0x461d1d5b, 0x071c1c1b, 0xa59e9e3b, 0xfff3f30c,
+	0xf0cfcf3f, 0x72cdcdbf, 0x175c5c4b, 0xb8eaea52,
+	0x810e0e8f, 0x5865653d, 0x3cf0f0cc, 0x1964647d,
+	0xe59b9b7e, 0x87161691, 0x4e3d3d73, 0xaaa2a208,
+	0x69a1a1c8, 0x6aadadc7, 0x83060685, 0xb0caca7a,
+	0x70c5c5b5, 0x659191f4, 0xd96b6bb2, 0x892e2ea7,
+	0xfbe3e318, 0xe8afaf47, 0x0f3c3c33, 0x4a2d2d67,
+	0x71c1c1b0, 0x5759590e, 0x9f7676e9, 0x35d4d4e1,
+	0x1e787866, 0x249090b4, 0x0e383836, 0x5f797926,
+	0x628d8def, 0x59616138, 0xd2474795, 0xa08a8a2a,
+	0x259494b1, 0x228888aa, 0x7df1f18c, 0x3bececd7,
+	0x01040405, 0x218484a5, 0x79e1e198, 0x851e1e9b,
+	0xd7535384, 0x00000000, 0x4719195e, 0x565d5d0b,
+	0x9d7e7ee3, 0xd04f4f9f, 0x279c9cbb, 0x5349491a,
+	0x4d31317c, 0x36d8d8ee, 0x0208080a, 0xe49f9f7b,
+	0xa2828220, 0xc71313d4, 0xcb2323e8, 0x9c7a7ae6,
+	0xe9abab42, 0xbdfefe43, 0x882a2aa2, 0xd14b4b9a,
+	0x41010140, 0xc41f1fdb, 0x38e0e0d8, 0xb7d6d661,
+	0xa18e8e2f, 0xf4dfdf2b, 0xf1cbcb3a, 0xcd3b3bf6,
+	0xfae7e71d, 0x608585e5, 0x15545441, 0xa3868625,
+	0xe3838360, 0xacbaba16, 0x5c757529, 0xa6929234,
+	0x996e6ef7, 0x34d0d0e4, 0x1a686872, 0x54555501,
+	0xafb6b619, 0x914e4edf, 0x32c8c8fa, 0x30c0c0f0,
+	0xf6d7d721, 0x8e3232bc, 0xb3c6c675, 0xe08f8f6f,
+	0x1d747469, 0xf5dbdb2e, 0xe18b8b6a, 0x2eb8b896,
+	0x800a0a8a, 0x679999fe, 0xc92b2be2, 0x618181e0,
+	0xc30303c0, 0x29a4a48d, 0x238c8caf, 0xa9aeae07,
+	0x0d343439, 0x524d4d1f, 0x4f393976, 0x6ebdbdd3,
+	0xd6575781, 0xd86f6fb7, 0x37dcdceb, 0x44151551,
+	0xdd7b7ba6, 0xfef7f709, 0x8c3a3ab6, 0x2fbcbc93,
+	0x030c0c0f, 0xfcffff03, 0x6ba9a9c2, 0x73c9c9ba,
+	0x6cb5b5d9, 0x6db1b1dc, 0x5a6d6d37, 0x50454515,
+	0x8f3636b9, 0x1b6c6c77, 0xadbebe13, 0x904a4ada,
+	0xb9eeee57, 0xde7777a9, 0xbef2f24c, 0x7efdfd83,
+	0x11444455, 0xda6767bd, 0x5d71712c, 0x40050545,
+	0x1f7c7c63, 0x10404050, 0x5b696932, 0xdb6363b8,
+	0x0a282822, 0xc20707c5, 0x31c4c4f5, 0x8a2222a8,
+	0xa7969631, 0xce3737f9, 0x7aeded97, 0xbff6f649,
+	0x2db4b499, 0x75d1d1a4, 0xd3434390, 0x1248485a,
+	0xbae2e258, 0xe6979771, 0xb6d2d264, 0xb2c2c270,
+	0x8b2626ad, 0x68a5a5cd, 0x955e5ecb, 0x4b292962,
+	0x0c30303c, 0x945a5ace, 0x76ddddab, 0x7ff9f986,
+	0x649595f1, 0xbbe6e65d, 0xf2c7c735, 0x0924242d,
+	0xc61717d1, 0x6fb9b9d6, 0xc51b1bde, 0x86121294,
+	0x18606078, 0xf3c3c330, 0x7cf5f589, 0xefb3b35c,
+	0x3ae8e8d2, 0xdf7373ac, 0x4c353579, 0x208080a0,
+	0x78e5e59d, 0xedbbbb56, 0x5e7d7d23, 0x3ef8f8c6,
+	0xd45f5f8b, 0xc82f2fe7, 0x39e4e4dd, 0x49212168,
+};
+
+/* byte swap of each word, and rotation of each word left by 8, 16, 24 */
+#define BSWAP32		_mm256_setr_epi8(3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12, \
+				3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12)
+#define ROTL8		_mm256_setr_epi8(3,0,1,2,7,4,5,6,11,8,9,10,15,12,13,14, \
+				3,0,1,2,7,4,5,6,11,8,9,10,15,12,13,14)
+#define ROTL16		_mm256_setr_epi8(2,3,0,1,6,7,4,5,10,11,8,9,14,15,12,13, \
+				2,3,0,1,6,7,4,5,10,11,8,9,14,15,12,13)
+#define ROTL24		_mm256_setr_epi8(1,2,3,0,5,6,7,4,9,10,11,8,13,14,15,12, \
+				1,2,3,0,5,6,7,4,9,10,11,8,13,14,15,12)
+
+/* L(S(x)) of every word with the table */
+SMS4_AVX2_INLINE __m256i sms4_avx2_t(__m256i x)
+{
+	const int *T = (const int *)SMS4_T;
+	const __m256i mask = _mm256_set1_epi32(0xff);
+	__m256i t0, t1, t2, t3;
+
+	t0 = _mm256_i32gather_epi32(T, _mm256_and_si256(x, mask), 4);
+	t1 = _mm256_i32gather_epi32(T,
+		_mm256_and_si256(_mm256_srli_epi32(x, 8), mask), 4);
+	t2 = _mm256_i32gather_epi32(T,
+		_mm256_and_si256(_mm256_srli_epi32(x, 16), mask), 4);
+	t3 = _mm256_i32gather_epi32(T, _mm256_srli_epi32(x, 24), 4);
+
+	t1 = _mm256_shuffle_epi8(t1, ROTL8);
+	t2 = _mm256_shuffle_epi8(t2, ROTL16);
+	t3 = _mm256_shuffle_epi8(t3, ROTL24);
+	return _mm256_xor_si256(_mm256_xor_si256(t0, t1),
+		_mm256_xor_si256(t2, t3));
+}
+
+SMS4_AVX2_INLINE __m256i sms4_avx2_affine(__m256i x, __m256i lo, __m256i hi)
+{
+	const __m256i mask = _mm256_set1_epi8(0x0f);
+
+	return _mm256_xor_si256(
+		_mm256_shuffle_epi8(lo, _mm256_and_si256(x, mask)),
+		_mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(x, 4), mask)));
+}
+
+#define DUP128(...)	_mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+
+/* L(S(x)) of every word with AESENCLAST */
+SMS4_AVX2_AESNI_INLINE __m256i sms4_avx2_aesni_t(__m256i x)
+{
+	__m128i lo, hi;
+	__m256i t;
+
+	x = _mm256_shuffle_epi8(x, DUP128(SMS4_AESNI_INV_SHIFT_ROWS));
+	x = sms4_avx2_affine(x, DUP128(SMS4_AESNI_PRE_LO),
+		DUP128(SMS4_AESNI_PRE_HI));
+	lo = _mm_aesenclast_si128(_mm256_castsi256_si128(x), _mm_setzero_si128());
+	hi = _mm_aesenclast_si128(_mm256_extracti128_si256(x, 1), _mm_setzero_si128());
+	x = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+	x = sms4_avx2_affine(x, DUP128(SMS4_AESNI_POST_LO),
+		DUP128(SMS4_AESNI_POST_HI));
+
+	/* L(x) = x ^ (x ^ x <<< 8 ^ x <<< 16) <<< 2 ^ x <<< 24 */
+	t = _mm256_xor_si256(x, _mm256_xor_si256(_mm256_shuffle_epi8(x, ROTL8),
+		_mm256_shuffle_epi8(x, ROTL16)));
+	t = _mm256_xor_si256(_mm256_slli_epi32(t, 2), _mm256_srli_epi32(t, 30));
+	return _mm256_xor_si256(_mm256_xor_si256(x, t),
+		_mm256_shuffle_epi8(x, ROTL24));
+}
+
+#define ROUND(x0, x1, x2, x3, rk, T)					\
+	x0 = _mm256_xor_si256(x0, T(_mm256_xor_si256(			\
+		_mm256_xor_si256(x1, x2),				\
+		_mm256_xor_si256(x3, _mm256_set1_epi32(rk)))))
+
+/*
+ * 32 rounds over nsets groups of 8 blocks, the groups are interleaved
+ * round by round to hide latency. Afterwards x[4*j+0..3] hold X32..X35,
+ * the output words are in reverse order.
+ */
+#define SMS4_AVX2_ROUNDS(x, nsets, rk, T) do {				\
+	int i_, j_;							\
+	for (i_ = 0; i_ < SMS4_NUM_ROUNDS; i_ += 4) {			\
+		for (j_ = 0; j_ < (nsets); j_++)			\
+			ROUND(x[4*j_+0], x[4*j_+1], x[4*j_+2], x[4*j_+3], rk[i_], T); \
+		for (j_ = 0; j_ < (nsets); j_++)			\
+			ROUND(x[4*j_+1], x[4*j_+2], x[4*j_+3], x[4*j_+0], rk[i_+1], T); \
+		for (j_ = 0; j_ < (nsets); j_++)			\
+			ROUND(x[4*j_+2], x[4*j_+3], x[4*j_+0], x[4*j_+1], rk[i_+2], T); \
+		for (j_ = 0; j_ < (nsets); j_++)			\
+			ROUND(x[4*j_+3], x[4*j_+0], x[4*j_+1], x[4*j_+2], rk[i_+3], T); \
+	}								\
+	} while (0)
+
+/*
+ * 4x4 word transpose inside each 128-bit lane. Applied to four registers
+ * holding blocks (0,1) (2,3) (4,5) (6,7) it yields word-sliced registers
+ * with the blocks in lane order 0,2,4,6,1,3,5,7, and it is its own
+ * inverse.
+ */
+#define TRANSPOSE(x0, x1, x2, x3) do {					\
+	__m256i t0 = _mm256_unpacklo_epi32(x0, x1);			\
+	__m256i t1 = _mm256_unpackhi_epi32(x0, x1);			\
+	__m256i t2 = _mm256_unpacklo_epi32(x2, x3);			\
+	__m256i t3 = _mm256_unpackhi_epi32(x2, x3);			\
+	x0 = _mm256_unpacklo_epi64(t0, t2);				\
+	x1 = _mm256_unpackhi_epi64(t0, t2);				\
+	x2 = _mm256_unpacklo_epi64(t1, t3);				\
+	x3 = _mm256_unpackhi_epi64(t1, t3);				\
+	} while (0)
+
+SMS4_AVX2_INLINE void sms4_avx2_load(__m256i *x, const unsigned char *in)
+{
+	const __m256i bswap = BSWAP32;
 
+	x[0] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)in), bswap);
+	x[1] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 32)), bswap);
+	x[2] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 64)), bswap);
+	x[3] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 96)), bswap);
+	TRANSPOSE(x[0], x[1], x[2], x[3]);
+}
 
-void sms4_encrypt_init(sms4_key_t *key)
+/* x[] as left by SMS4_AVX2_ROUNDS(), converted back into 8 blocks */
+SMS4_AVX2_INLINE void sms4_avx2_output(__m256i y[4], const __m256i *x)
 {
-	mask_ffff = _mm256_set1_epi32(0xffff);
-	vindex_0s = _mm256_set1_epi32(0);
-	vindex_4i = _mm256_setr_epi32(0,4,8,12,16,20,24,28);
-	vindex_read = _mm256_setr_epi32(0,8,16,24,1,9,17,25);
-	vindex_swap = _mm256_setr_epi8(
-		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
-		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12
-	);
-	sms4_init_sbox32();
+	const __m256i bswap = BSWAP32;
+
+	y[0] = x[3];
+	y[1] = x[2];
+	y[2] = x[1];
+	y[3] = x[0];
+	TRANSPOSE(y[0], y[1], y[2], y[3]);
+	y[0] = _mm256_shuffle_epi8(y[0], bswap);
+	y[1] = _mm256_shuffle_epi8(y[1], bswap);
+	y[2] = _mm256_shuffle_epi8(y[2], bswap);
+	y[3] = _mm256_shuffle_epi8(y[3], bswap);
 }
 
-#define GET_BLKS(x0, x1, x2, x3, in)					\
-	t0 = _mm256_i32gather_epi32((int *)(in+4*0), vindex_4i, 4);	\
-	t1 = _mm256_i32gather_epi32((int *)(in+4*1), vindex_4i, 4);	\
-	t2 = _mm256_i32gather_epi32((int *)(in+4*2), vindex_4i, 4);	\
-	t3 = _mm256_i32gather_epi32((int *)(in+4*3), vindex_4i, 4);	\
-	x0 = _mm256_shuffle_epi8(t0, vindex_swap);			\
-	x1 = _mm256_shuffle_epi8(t1, vindex_swap);			\
-	x2 = _mm256_shuffle_epi8(t2, vindex_swap);			\
-	x3 = _mm256_shuffle_epi8(t3, vindex_swap)
-
-#define PUT_BLKS(out, x0, x1, x2, x3)					\
-	t0 = _mm256_shuffle_epi8(x0, vindex_swap);			\
-	t1 = _mm256_shuffle_epi8(x1, vindex_swap);			\
-	t2 = _mm256_shuffle_epi8(x2, vindex_swap);			\
-	t3 = _mm256_shuffle_epi8(x3, vindex_swap);			\
-	_mm256_storeu_si256((__m256i *)(out+32*0), t0);			\
-	_mm256_storeu_si256((__m256i *)(out+32*1), t1);			\
-	_mm256_storeu_si256((__m256i *)(out+32*2), t2);			\
-	_mm256_storeu_si256((__m256i *)(out+32*3), t3);			\
-	x0 = _mm256_i32gather_epi32((int *)(in+32*0), vindex_read, 4);	\
-	x1 = _mm256_i32gather_epi32((int *)(in+32*1), vindex_read, 4);	\
-	x2 = _mm256_i32gather_epi32((int *)(in+32*2), vindex_read, 4);	\
-	x3 = _mm256_i32gather_epi32((int *)(in+32*3), vindex_read, 4);	\
-	_mm256_storeu_si256((__m256i *)(out+2*0), x0);			\
-	_mm256_storeu_si256((__m256i *)(out+2*1), x1);			\
-	_mm256_storeu_si256((__m256i *)(out+2*2), x2);			\
-	_mm256_storeu_si256((__m256i *)(out+2*3), x3)
-
-#define S(x0, t0, t1, t2)					\
-	t0 = _mm256_and_si256(x0, mask_ffff);			\
-	t1 = _mm256_i32gather_epi32(SBOX32L, t0, 4);		\
-	t0 = _mm256_srli_epi32(x0, 16);				\
-	t2 = _mm256_i32gather_epi32(SBOX32H, t0, 4);		\
-	x0 = _mm256_xor_si256(t1, t2)
-
-#define ROT(r0, x0, i, t0, t1)					\
-	t0 = _mm256_slli_epi32(x0, i);				\
-	t1 = _mm256_srli_epi32(x0,32-i);			\
-	r0 = _mm256_xor_si256(t0, t1)
-
-#define L(x0, t0, t1, t2, t3, t4)				\
-	ROT(t0, x0,  2, t2, t3);				\
-	ROT(t1, x0, 10, t2, t3);				\
-	t4 = _mm256_xor_si256(t0, t1);				\
-	ROT(t0, x0, 18, t2, t3);				\
-	ROT(t1, x0, 24, t2, t3);				\
-	t3 = _mm256_xor_si256(t0, t1);				\
-	t2 = _mm256_xor_si256(x0, t3);				\
-	x0 = _mm256_xor_si256(t2, t4)
-
-#define ROUND(x0, x1, x2, x3, x4, i)				\
-	t0 = _mm256_i32gather_epi32(rk+i, vindex_0s, 4);	\
-	t1 = _mm256_xor_si256(x1, x2);				\
-	t2 = _mm256_xor_si256(x3, t0);				\
-	t0 = _mm256_xor_si256(t1, t2);				\
-	S(t0, x4, t1, t2);					\
-	L(t0, x4, t1, t2, t3, t4);				\
-	x4 = _mm256_xor_si256(x0, t0);
-
-
-void sms4_encrypt_8blocks(sms4_key_t *key, const unsigned char *in, unsigned char *out)
+SMS4_AVX2_INLINE void sms4_avx2_store(unsigned char *out, const __m256i y[4])
 {
-	int *rk = (int *)key->rk;
-	__m256i x0, x1, x2, x3, x4;
-	__m256i t0, t1, t2, t3, t4;
-	GET_BLKS(x0, x1, x2, x3, in);
-	ROUNDS(x0, x1, x2, x3, x4);
-	PUT_BLKS(out, x0, x4, x3, x2);
+	_mm256_storeu_si256((__m256i *)out, y[0]);
+	_mm256_storeu_si256((__m256i *)(out + 32), y[1]);
+	_mm256_storeu_si256((__m256i *)(out + 64), y[2]);
+	_mm256_storeu_si256((__m256i *)(out + 96), y[3]);
 }
 
-void sms4_encrypt_16blocks(sms4_key_t *key, const unsigned char *in, unsigned char *out)
+SMS4_AVX2_INLINE void sms4_avx2_xor_store(unsigned char *out,
+	const unsigned char *in, const __m256i y[4])
 {
-	sms4_encrypt_8blocks(key, in, out);
-	sms4_encrypt_8blocks(key, in + 16*8, out + 16*8);
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		_mm256_storeu_si256((__m256i *)(out + 32 * i), _mm256_xor_si256(y[i],
+			_mm256_loadu_si256((const __m256i *)(in + 32 * i))));
+	}
 }
+
+/*
+ * The 8-block, 16-block and CTR kernels, instantiated for the table and
+ * the AES-NI round function. The CTR kernel is ctr128_f compatible, the
+ * counter blocks are built directly in word-sliced form and only the low
+ * 32 bits of the counter are incremented.
+ */
+#define SMS4_AVX2_KERNELS(name, T, TARGET)				\
+TARGET void name##_encrypt_8blocks(const unsigned char *in,		\
+	unsigned char *out, const sms4_key_t *key)			\
+{									\
+	__m256i x[4], y[4];						\
+									\
+	sms4_avx2_load(x, in);						\
+	SMS4_AVX2_ROUNDS(x, 1, key->rk, T);				\
+	sms4_avx2_output(y, x);						\
+	sms4_avx2_store(out, y);					\
+}									\
+									\
+TARGET void name##_encrypt_16blocks(const unsigned char *in,		\
+	unsigned char *out, const sms4_key_t *key)			\
+{									\
+	__m256i x[8], y[4];						\
+									\
+	sms4_avx2_load(x, in);						\
+	sms4_avx2_load(x + 4, in + 128);				\
+	SMS4_AVX2_ROUNDS(x, 2, key->rk, T);				\
+	sms4_avx2_output(y, x);						\
+	sms4_avx2_store(out, y);					\
+	sms4_avx2_output(y, x + 4);					\
+	sms4_avx2_store(out + 128, y);					\
+}									\
+									\
+TARGET void name##_ctr32_encrypt_blocks(const unsigned char *in,	\
+	unsigned char *out, size_t blocks, const sms4_key_t *key,	\
+	const unsigned char iv[16])					\
+{									\
+	/* counter offsets matching the lane order of TRANSPOSE() */	\
+	const __m256i lane = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);	\
+	const __m256i eight = _mm256_set1_epi32(8);			\
+	__m256i c0, c1, c2, ctr;					\
+	__m256i x[8], y[4];						\
+	unsigned char buf[16 * 8];					\
+	size_t i, n;							\
+									\
+	c0 = _mm256_set1_epi32((int)GET32(iv));				\
+	c1 = _mm256_set1_epi32((int)GET32(iv + 4));			\
+	c2 = _mm256_set1_epi32((int)GET32(iv + 8));			\
+	ctr = _mm256_add_epi32(_mm256_set1_epi32((int)GET32(iv + 12)), lane); \
+									\
+	while (blocks >= 16) {						\
+		x[0] = c0; x[1] = c1; x[2] = c2; x[3] = ctr;		\
+		ctr = _mm256_add_epi32(ctr, eight);			\
+		x[4] = c0; x[5] = c1; x[6] = c2; x[7] = ctr;		\
+		ctr = _mm256_add_epi32(ctr, eight);			\
+		SMS4_AVX2_ROUNDS(x, 2, key->rk, T);			\
+		sms4_avx2_output(y, x);					\
+		sms4_avx2_xor_store(out, in, y);			\
+		sms4_avx2_output(y, x + 4);				\
+		sms4_avx2_xor_store(out + 128, in + 128, y);		\
+		in += 256;						\
+		out += 256;						\
+		blocks -= 16;						\
+	}								\
+									\
+	while (blocks) {						\
+		x[0] = c0; x[1] = c1; x[2] = c2; x[3] = ctr;		\
+		ctr = _mm256_add_epi32(ctr, eight);			\
+		SMS4_AVX2_ROUNDS(x, 1, key->rk, T);			\
+		sms4_avx2_output(y, x);					\
+		if (blocks >= 8) {					\
+			sms4_avx2_xor_store(out, in, y);		\
+			n = 128;					\
+		} else {						\
+			sms4_avx2_store(buf, y);			\
+			n = blocks * 16;				\
+			for (i = 0; i < n; i++) {			\
+				out[i] = in[i] ^ buf[i];		\
+			}						\
+			OPENSSL_cleanse(buf, sizeof(buf));		\
+		}							\
+		in += n;						\
+		out += n;						\
+		blocks -= n / 16;					\
+	}								\
+}
+
+SMS4_AVX2_KERNELS(sms4_avx2, sms4_avx2_t, SMS4_AVX2_TARGET)
+SMS4_AVX2_KERNELS(sms4_avx2_aesni, sms4_avx2_aesni_t, SMS4_AVX2_AESNI_TARGET)
+
+#else
+static void *dummy = &dummy;
+#endif
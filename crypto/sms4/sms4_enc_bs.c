@@ -0,0 +1,467 @@
+/* crypto/sms4/sms4_enc_bs.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ */
+
+
+/*
+ * Bitsliced SMS4, 32 blocks per set of 128-bit registers (SSSE3) or 64
+ * blocks per set of 256-bit registers (AVX2). Nothing is looked up in
+ * tables, every step is a fixed sequence of logic operations, so the
+ * running time does not depend on the key or the data.
+ *
+ * Each state word X[i] is kept as 8 bit planes, plane b holds bit b of
+ * the four bytes of the word of every block, byte j of the word in the
+ * 32-bit lane j of each 128-bit lane. The transposition is a 4x4 word
+ * transpose and a byte shuffle per group of 4 blocks, followed by an
+ * 8x8 bit matrix transpose over 8 such groups (three swapmove steps).
+ * In this layout
+ *
+ *   - the S-box is a boolean circuit over the 8 planes, all 4 bytes of
+ *     the word and all blocks at once,
+ *   - rotating the word by 8, 16 or 24 bits is a PSHUFD of the planes,
+ *     and rotating by 2 renames planes, so the linear transform L costs
+ *     only shuffles and XORs,
+ *   - the round key is expanded to 8 masks with PCMPEQD.
+ *
+ * The circuit computes the inversion in GF(2^8) in the tower field
+ * GF(((2^2)^2)^2), the SMS4 affine transforms and the change of basis
+ * are merged into the linear layers around it:
+ *
+ *   S(x ^ 0x75) = Mout * inv(Min * x) ^ 0xd3
+ *
+ * which takes 36 AND, 158 XOR and 5 NOT. The input constant is added to
+ * the round key. Only long inputs without AES-NI are sent here, see
+ * sms4_enc_nblks.c.
+ */
+
+#include <openssl/crypto.h>
+#include "sms4.h"
+#include "sms4_lcl.h"
+
+#ifdef SMS4_BS
+#include <immintrin.h>
+
+#define SMS4_BS_SSSE3_TARGET	__attribute__((target("ssse3")))
+#define SMS4_BS_SSSE3_INLINE	static inline __attribute__((always_inline, target("ssse3")))
+#define SMS4_BS_AVX2_TARGET	__attribute__((target("avx2")))
+#define SMS4_BS_AVX2_INLINE	static inline __attribute__((always_inline, target("avx2")))
+
+/* the S-box input constant, added to every byte of the round key */
+#define SMS4_BS_RK_MASK		0x75757575
+
+/* x[0..7] = S(x[0..7] ^ 0x75) on bit planes, generated and verified
+ * exhaustively against SBOX[] */
+#define SMS4_BS_SBOX(T, x) do {						\
+	T t0 = x[4] ^ x[5]; T t1 = x[3] ^ x[6];				\
+	T t2 = x[2] ^ t1; T t3 = x[1] ^ t2;				\
+	T t4 = x[0] ^ t3; T t5 = t0 & t4;				\
+	T t6 = x[1] ^ x[2]; T t7 = x[0] ^ t6;				\
+	T t8 = t0 ^ x[7]; T t9 = t2 ^ t8;				\
+	T t10 = t7 & t9; T t11 = t7 ^ t0;				\
+	T t12 = x[0] ^ x[1]; T t13 = t8 ^ t12;				\
+	T t14 = t11 & t13; T t15 = x[3] ^ x[4];				\
+	T t16 = x[1] ^ t15; T t17 = t16 ^ x[6];				\
+	T t18 = t16 & t17; T t19 = t8 ^ t1;				\
+	T t20 = x[5] ^ x[7]; T t21 = t4 ^ t20;				\
+	T t22 = t19 & t21; T t23 = x[1] ^ x[6];				\
+	T t24 = t20 ^ t23; T t25 = x[0] ^ x[2];				\
+	T t26 = t8 ^ t25; T t27 = t24 & t26;				\
+	T t28 = x[3] ^ x[5]; T t29 = x[1] ^ t28;			\
+	T t30 = t25 ^ x[4]; T t31 = t29 & t30;				\
+	T t32 = t21 ^ x[4]; T t33 = t12 ^ x[4];				\
+	T t34 = t32 & t33; T t35 = x[6] ^ x[7];				\
+	T t36 = t30 ^ t35; T t37 = t36 & t6;				\
+	T t38 = t37 ^ x[5]; T t39 = t34 ^ t38;				\
+	T t40 = t27 ^ t39; T t41 = t22 ^ t40;				\
+	T t42 = t1 ^ t41; T t43 = t5 ^ x[4];				\
+	T t44 = t27 ^ t43; T t45 = t22 ^ t44;				\
+	T t46 = t10 ^ t45; T t47 = t7 ^ t46;				\
+	T t48 = t42 & t47; T t49 = t34 ^ x[2];				\
+	T t50 = t31 ^ t49; T t51 = t22 ^ t50;				\
+	T t52 = t18 ^ t51; T t53 = t35 ^ t52;				\
+	T t54 = t5 ^ x[6]; T t55 = t22 ^ t54;				\
+	T t56 = t18 ^ t55; T t57 = t14 ^ t56;				\
+	T t58 = t53 & t57; T t59 = x[2] ^ x[3];				\
+	T t60 = t37 ^ t59; T t61 = t31 ^ t60;				\
+	T t62 = t27 ^ t61; T t63 = t18 ^ t62;				\
+	T t64 = t20 ^ t63; T t65 = x[4] ^ x[6];				\
+	T t66 = t27 ^ t65; T t67 = t18 ^ t66;				\
+	T t68 = t14 ^ t67; T t69 = t10 ^ t68;				\
+	T t70 = t7 ^ t69; T t71 = t64 & t70;				\
+	T t72 = t43 ^ t10; T t73 = t39 ^ t72;				\
+	T t74 = t4 ^ t73; T t75 = t71 ^ x[3];				\
+	T t76 = t5 ^ t75; T t77 = t58 ^ t76;				\
+	T t78 = t37 ^ t77; T t79 = t31 ^ t78;				\
+	T t80 = t22 ^ t79; T t81 = t18 ^ t80;				\
+	T t82 = t10 ^ t81; T t83 = t13 ^ t82;				\
+	T t84 = t74 & t83; T t85 = t5 ^ x[7];				\
+	T t86 = t14 ^ t85; T t87 = t50 ^ t86;				\
+	T t88 = t18 ^ t48; T t89 = t14 ^ t88;				\
+	T t90 = t76 ^ t89; T t91 = t40 ^ t90;				\
+	T t92 = t87 & t91; T t93 = t31 ^ t37;				\
+	T t94 = t14 ^ t93; T t95 = t10 ^ t94;				\
+	T t96 = t1 ^ t95; T t97 = t13 ^ t96;				\
+	T t98 = t58 ^ x[7]; T t99 = t48 ^ t98;				\
+	T t100 = t34 ^ t99; T t101 = t31 ^ t100;			\
+	T t102 = t27 ^ t101; T t103 = t22 ^ t102;			\
+	T t104 = t14 ^ t103; T t105 = t10 ^ t104;			\
+	T t106 = t33 ^ t105; T t107 = t97 & t106;			\
+	T t108 = t42 & t83; T t109 = t53 & t91;				\
+	T t110 = t64 & t106; T t111 = t109 ^ t110;			\
+	T t112 = t0 & t111; T t113 = t108 ^ t109;			\
+	T t114 = t7 & t113; T t115 = t108 ^ t110;			\
+	T t116 = t11 & t115; T t117 = t107 ^ t92;			\
+	T t118 = t16 & t117; T t119 = t84 ^ t92;			\
+	T t120 = t19 & t119; T t121 = t107 ^ t84;			\
+	T t122 = t24 & t121; T t123 = t111 ^ t117;			\
+	T t124 = t29 & t123; T t125 = t113 ^ t119;			\
+	T t126 = t32 & t125; T t127 = t115 ^ t121;			\
+	T t128 = t36 & t127; T t129 = t4 ^ t0;				\
+	T t130 = t129 & t111; T t131 = t13 ^ t1;			\
+	T t132 = t131 & t113; T t133 = x[2] ^ x[7];			\
+	T t134 = t133 & t115; T t135 = x[6] & t117;			\
+	T t136 = t7 ^ x[4]; T t137 = t136 & t119;			\
+	T t138 = t136 ^ x[6]; T t139 = t138 & t121;			\
+	T t140 = t11 ^ x[3]; T t141 = t140 & t123;			\
+	T t142 = t2 ^ t20; T t143 = t142 & t125;			\
+	T t144 = t33 ^ t35; T t145 = t144 & t127;			\
+	T t146 = t135 ^ t139; T t147 = t134 ^ t146;			\
+	T t148 = t132 ^ t147; T t149 = t128 ^ t148;			\
+	T t150 = t124 ^ t149; T t151 = t116 ^ t150;			\
+	T t152 = t114 ^ t151; T t153 = ~t152;				\
+	T t154 = t135 ^ t137; T t155 = t134 ^ t154;			\
+	T t156 = t130 ^ t155; T t157 = t122 ^ t156;			\
+	T t158 = t118 ^ t157; T t159 = t116 ^ t158;			\
+	T t160 = t114 ^ t159; T t161 = ~t160;				\
+	T t162 = t141 ^ t143; T t163 = t139 ^ t162;			\
+	T t164 = t137 ^ t163; T t165 = t134 ^ t164;			\
+	T t166 = t132 ^ t165; T t167 = t128 ^ t166;			\
+	T t168 = t124 ^ t167; T t169 = t120 ^ t168;			\
+	T t170 = t118 ^ t169; T t171 = t114 ^ t170;			\
+	T t172 = t112 ^ t171; T t173 = t143 ^ t145;			\
+	T t174 = t132 ^ t173; T t175 = t130 ^ t174;			\
+	T t176 = t122 ^ t175; T t177 = t118 ^ t176;			\
+	T t178 = t116 ^ t177; T t179 = t114 ^ t178;			\
+	T t180 = t126 ^ t128; T t181 = t114 ^ t180;			\
+	T t182 = t112 ^ t181; T t183 = ~t182;				\
+	T t184 = t175 ^ t182; T t185 = t132 ^ t135;			\
+	T t186 = t130 ^ t185; T t187 = t120 ^ t186;			\
+	T t188 = t118 ^ t187; T t189 = t116 ^ t188;			\
+	T t190 = t112 ^ t189; T t191 = t163 ^ t190;			\
+	T t192 = ~t191; T t193 = t124 ^ t126;				\
+	T t194 = t116 ^ t193; T t195 = t112 ^ t194;			\
+	T t196 = t186 ^ t195; T t197 = t163 ^ t196;			\
+	T t198 = ~t197; x[0] = t153;					\
+	x[1] = t161;							\
+	x[2] = t172;							\
+	x[3] = t179;							\
+	x[4] = t183;							\
+	x[5] = t184;							\
+	x[6] = t192;							\
+	x[7] = t198;							\
+} while (0)
+
+/* a[] bits selected by m are swapped with b[] bits n positions higher */
+#define SMS4_BS_SWAPMOVE(T, a, b, n, m, SRL, SLL) do {			\
+	T t_ = (SRL(b, n) ^ (a)) & (m);					\
+	(a) ^= t_;							\
+	(b) ^= SLL(t_, n);						\
+	} while (0)
+
+/*
+ * Transpose the 8x8 bit matrices formed by the bytes at the same offset
+ * of r[0..7], afterwards bit b of r[i] is bit i of r[b]. The transpose
+ * is an involution, the same network goes back.
+ */
+#define SMS4_BS_TRANSPOSE(T, r, SRL, SLL, SET1) do {			\
+	T m_ = SET1(0x55);						\
+	SMS4_BS_SWAPMOVE(T, r[1], r[0], 1, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[3], r[2], 1, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[5], r[4], 1, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[7], r[6], 1, m_, SRL, SLL);		\
+	m_ = SET1(0x33);						\
+	SMS4_BS_SWAPMOVE(T, r[2], r[0], 2, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[3], r[1], 2, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[6], r[4], 2, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[7], r[5], 2, m_, SRL, SLL);		\
+	m_ = SET1(0x0f);						\
+	SMS4_BS_SWAPMOVE(T, r[4], r[0], 4, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[5], r[1], 4, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[6], r[2], 4, m_, SRL, SLL);		\
+	SMS4_BS_SWAPMOVE(T, r[7], r[3], 4, m_, SRL, SLL);		\
+	} while (0)
+
+/*
+ * X0 ^= L(S(X1 ^ X2 ^ X3 ^ rk)) on planes, K holds the round key masks.
+ * R8(v) moves byte j of the word to byte j + 1, so rol(v, 2) is plane
+ * b - 2, or R8 of plane b + 6 for the two low planes.
+ */
+#define SMS4_BS_ROUND(T, X0, X1, X2, X3, K, R8, R16, R24) do {		\
+	T x_[8];							\
+	int b_;								\
+	for (b_ = 0; b_ < 8; b_++)					\
+		x_[b_] = X1[b_] ^ X2[b_] ^ X3[b_] ^ K[b_];		\
+	SMS4_BS_SBOX(T, x_);						\
+	for (b_ = 0; b_ < 8; b_++) {					\
+		T t_ = b_ >= 2 ? x_[b_ - 2] : R8(x_[b_ + 6]);		\
+		X0[b_] ^= x_[b_] ^ R24(x_[b_]) ^ t_ ^ R8(t_) ^ R16(t_);	\
+	}								\
+	} while (0)
+
+/*
+ * Kernels over T registers with the helpers name##_load, name##_store
+ * and name##_key, n blocks per call. The CTR kernel takes a multiple of
+ * n blocks.
+ */
+#define SMS4_BS_KERNELS(name, T, n, encrypt, TARGET, R8, R16, R24)	\
+TARGET void encrypt(const unsigned char *in, unsigned char *out,	\
+	const sms4_key_t *key)						\
+{									\
+	T X[4][8], K[8];						\
+	int i;								\
+									\
+	name##_load(X, in);						\
+	for (i = 0; i < SMS4_NUM_ROUNDS; i += 4) {			\
+		name##_key(K, key->rk[i] ^ SMS4_BS_RK_MASK);		\
+		SMS4_BS_ROUND(T, X[0], X[1], X[2], X[3], K, R8, R16, R24); \
+		name##_key(K, key->rk[i + 1] ^ SMS4_BS_RK_MASK);	\
+		SMS4_BS_ROUND(T, X[1], X[2], X[3], X[0], K, R8, R16, R24); \
+		name##_key(K, key->rk[i + 2] ^ SMS4_BS_RK_MASK);	\
+		SMS4_BS_ROUND(T, X[2], X[3], X[0], X[1], K, R8, R16, R24); \
+		name##_key(K, key->rk[i + 3] ^ SMS4_BS_RK_MASK);	\
+		SMS4_BS_ROUND(T, X[3], X[0], X[1], X[2], K, R8, R16, R24); \
+	}								\
+	name##_store(out, X);						\
+}									\
+									\
+TARGET void name##_ctr32_encrypt_blocks(const unsigned char *in,	\
+	unsigned char *out, size_t blocks, const sms4_key_t *key,	\
+	const unsigned char iv[16])					\
+{									\
+	unsigned char buf[16 * (n)];					\
+	uint32_t ctr = GET32(iv + 12);					\
+	size_t i;							\
+									\
+	for (; blocks >= (n); blocks -= (n)) {				\
+		for (i = 0; i < (n); i++) {				\
+			memcpy(buf + 16 * i, iv, 12);			\
+			PUT32(ctr, buf + 16 * i + 12);			\
+			ctr++;						\
+		}							\
+		encrypt(buf, buf, key);					\
+		for (i = 0; i < 16 * (n); i++)				\
+			out[i] = in[i] ^ buf[i];			\
+		in += 16 * (n);						\
+		out += 16 * (n);					\
+	}								\
+	OPENSSL_cleanse(buf, sizeof(buf));				\
+}
+
+/* dst byte 4j+m is byte j (from the least significant) of word m */
+#define SMS4_BS_BYTE_GROUP						\
+	3,7,11,15,2,6,10,14,1,5,9,13,0,4,8,12
+#define SMS4_BS_BYTE_UNGROUP						\
+	12,8,4,0,13,9,5,1,14,10,6,2,15,11,7,3
+
+/* 4x4 transpose of the 32-bit words of a[0..3] */
+#define SMS4_BS_TRANSPOSE4(T, a, UNPACKLO32, UNPACKHI32, UNPACKLO64,	\
+	UNPACKHI64) do {						\
+	T t0_ = UNPACKLO32(a[0], a[1]);					\
+	T t1_ = UNPACKLO32(a[2], a[3]);					\
+	T t2_ = UNPACKHI32(a[0], a[1]);					\
+	T t3_ = UNPACKHI32(a[2], a[3]);					\
+	a[0] = UNPACKLO64(t0_, t1_);					\
+	a[1] = UNPACKHI64(t0_, t1_);					\
+	a[2] = UNPACKLO64(t2_, t3_);					\
+	a[3] = UNPACKHI64(t2_, t3_);					\
+	} while (0)
+
+#define SMS4_BS_R8(v)		_mm_shuffle_epi32(v, 0x93)
+#define SMS4_BS_R16(v)		_mm_shuffle_epi32(v, 0x4e)
+#define SMS4_BS_R24(v)		_mm_shuffle_epi32(v, 0x39)
+
+/* blocks 4g..4g+3 go to bit position g of the planes */
+SMS4_BS_SSSE3_INLINE void sms4_ssse3_bs_load(__m128i X[4][8],
+	const unsigned char *in)
+{
+	__m128i group = _mm_setr_epi8(SMS4_BS_BYTE_GROUP);
+	__m128i a[4];
+	int g, i;
+
+	for (g = 0; g < 8; g++) {
+		for (i = 0; i < 4; i++)
+			a[i] = _mm_loadu_si128((const __m128i *)(in + 16 * (4 * g + i)));
+		SMS4_BS_TRANSPOSE4(__m128i, a, _mm_unpacklo_epi32,
+			_mm_unpackhi_epi32, _mm_unpacklo_epi64, _mm_unpackhi_epi64);
+		for (i = 0; i < 4; i++)
+			X[i][g] = _mm_shuffle_epi8(a[i], group);
+	}
+	for (i = 0; i < 4; i++)
+		SMS4_BS_TRANSPOSE(__m128i, X[i], _mm_srli_epi64,
+			_mm_slli_epi64, _mm_set1_epi8);
+}
+
+/* the output words are X[3], X[2], X[1], X[0] */
+SMS4_BS_SSSE3_INLINE void sms4_ssse3_bs_store(unsigned char *out,
+	__m128i X[4][8])
+{
+	__m128i ungroup = _mm_setr_epi8(SMS4_BS_BYTE_UNGROUP);
+	__m128i a[4];
+	int g, i;
+
+	for (i = 0; i < 4; i++)
+		SMS4_BS_TRANSPOSE(__m128i, X[i], _mm_srli_epi64,
+			_mm_slli_epi64, _mm_set1_epi8);
+	for (g = 0; g < 8; g++) {
+		for (i = 0; i < 4; i++)
+			a[i] = _mm_shuffle_epi8(X[3 - i][g], ungroup);
+		SMS4_BS_TRANSPOSE4(__m128i, a, _mm_unpacklo_epi32,
+			_mm_unpackhi_epi32, _mm_unpacklo_epi64, _mm_unpackhi_epi64);
+		for (i = 0; i < 4; i++)
+			_mm_storeu_si128((__m128i *)(out + 16 * (4 * g + i)), a[i]);
+	}
+}
+
+/* plane b of the round key, lane j all ones if bit 8j+b of rk is set */
+SMS4_BS_SSSE3_INLINE void sms4_ssse3_bs_key(__m128i K[8], uint32_t rk)
+{
+	__m128i k = _mm_setr_epi32(rk & 0xff, (rk >> 8) & 0xff,
+		(rk >> 16) & 0xff, rk >> 24);
+	int b;
+
+	for (b = 0; b < 8; b++) {
+		__m128i m = _mm_set1_epi32(1 << b);
+		K[b] = _mm_cmpeq_epi32(_mm_and_si128(k, m), m);
+	}
+}
+
+SMS4_BS_KERNELS(sms4_ssse3_bs, __m128i, 32, sms4_ssse3_bs_encrypt_32blocks,
+	SMS4_BS_SSSE3_TARGET, SMS4_BS_R8, SMS4_BS_R16, SMS4_BS_R24)
+
+#undef SMS4_BS_R8
+#undef SMS4_BS_R16
+#undef SMS4_BS_R24
+
+/*
+ * The 256-bit kernels do the same with every instruction working on two
+ * independent 128-bit lanes, blocks 0..31 in the low lanes and 32..63
+ * in the high lanes.
+ */
+#define SMS4_BS_R8(v)		_mm256_shuffle_epi32(v, 0x93)
+#define SMS4_BS_R16(v)		_mm256_shuffle_epi32(v, 0x4e)
+#define SMS4_BS_R24(v)		_mm256_shuffle_epi32(v, 0x39)
+
+SMS4_BS_AVX2_INLINE void sms4_avx2_bs_load(__m256i X[4][8],
+	const unsigned char *in)
+{
+	__m256i group = _mm256_setr_epi8(SMS4_BS_BYTE_GROUP, SMS4_BS_BYTE_GROUP);
+	__m256i a[4];
+	int g, i;
+
+	for (g = 0; g < 8; g++) {
+		for (i = 0; i < 4; i++) {
+			const unsigned char *p = in + 16 * (4 * g + i);
+			a[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(
+				_mm_loadu_si128((const __m128i *)p)),
+				_mm_loadu_si128((const __m128i *)(p + 16 * 32)), 1);
+		}
+		SMS4_BS_TRANSPOSE4(__m256i, a, _mm256_unpacklo_epi32,
+			_mm256_unpackhi_epi32, _mm256_unpacklo_epi64,
+			_mm256_unpackhi_epi64);
+		for (i = 0; i < 4; i++)
+			X[i][g] = _mm256_shuffle_epi8(a[i], group);
+	}
+	for (i = 0; i < 4; i++)
+		SMS4_BS_TRANSPOSE(__m256i, X[i], _mm256_srli_epi64,
+			_mm256_slli_epi64, _mm256_set1_epi8);
+}
+
+SMS4_BS_AVX2_INLINE void sms4_avx2_bs_store(unsigned char *out,
+	__m256i X[4][8])
+{
+	__m256i ungroup = _mm256_setr_epi8(SMS4_BS_BYTE_UNGROUP,
+		SMS4_BS_BYTE_UNGROUP);
+	__m256i a[4];
+	int g, i;
+
+	for (i = 0; i < 4; i++)
+		SMS4_BS_TRANSPOSE(__m256i, X[i], _mm256_srli_epi64,
+			_mm256_slli_epi64, _mm256_set1_epi8);
+	for (g = 0; g < 8; g++) {
+		for (i = 0; i < 4; i++)
+			a[i] = _mm256_shuffle_epi8(X[3 - i][g], ungroup);
+		SMS4_BS_TRANSPOSE4(__m256i, a, _mm256_unpacklo_epi32,
+			_mm256_unpackhi_epi32, _mm256_unpacklo_epi64,
+			_mm256_unpackhi_epi64);
+		for (i = 0; i < 4; i++) {
+			unsigned char *p = out + 16 * (4 * g + i);
+			_mm_storeu_si128((__m128i *)p, _mm256_castsi256_si128(a[i]));
+			_mm_storeu_si128((__m128i *)(p + 16 * 32),
+				_mm256_extracti128_si256(a[i], 1));
+		}
+	}
+}
+
+SMS4_BS_AVX2_INLINE void sms4_avx2_bs_key(__m256i K[8], uint32_t rk)
+{
+	__m256i k = _mm256_setr_epi32(rk & 0xff, (rk >> 8) & 0xff,
+		(rk >> 16) & 0xff, rk >> 24, rk & 0xff, (rk >> 8) & 0xff,
+		(rk >> 16) & 0xff, rk >> 24);
+	int b;
+
+	for (b = 0; b < 8; b++) {
+		__m256i m = _mm256_set1_epi32(1 << b);
+		K[b] = _mm256_cmpeq_epi32(_mm256_and_si256(k, m), m);
+	}
+}
+
+SMS4_BS_KERNELS(sms4_avx2_bs, __m256i, 64, sms4_avx2_bs_encrypt_64blocks,
+	SMS4_BS_AVX2_TARGET, SMS4_BS_R8, SMS4_BS_R16, SMS4_BS_R24)
+
+#endif /* SMS4_BS */
@@ -49,27 +49,166 @@
  */
 
 
+/*
+ * Multi-block SMS4 entry points, dispatched at run time to the widest
+ * kernel the CPU supports and falling back to sms4_encrypt(). Long ECB
+ * and CTR inputs go through the bitsliced kernels first: the 64-block
+ * AVX2 one whenever AVX2 is present, the 32-block SSSE3 one only without
+ * AES-NI, as the AES-NI kernel is faster at 128 bits.
+ */
+
+#include <openssl/crypto.h>
 #include "sms4.h"
+#include "sms4_lcl.h"
 
-void sms4_encrypt_init(sms4_key_t *key)
+void sms4_encrypt_8blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key)
 {
+	int i;
+
+#ifdef SMS4_AVX2
+	if (SMS4_AVX2_CAPABLE) {
+		if (SMS4_AESNI_CAPABLE)
+			sms4_avx2_aesni_encrypt_8blocks(in, out, key);
+		else
+			sms4_avx2_encrypt_8blocks(in, out, key);
+		return;
+	}
+#endif
+#ifdef SMS4_AESNI
+	if (SMS4_AESNI_CAPABLE) {
+		sms4_aesni_encrypt_8blocks(in, out, key);
+		return;
+	}
+#endif
+	for (i = 0; i < 8; i++) {
+		sms4_encrypt(in + 16 * i, out + 16 * i, key);
+	}
 }
 
-void sms4_encrypt_8blocks(sms4_key_t *key, const unsigned char *in, unsigned char *out)
+void sms4_encrypt_16blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key)
 {
-	sms4_encrypt(key, in         , out         );
-	sms4_encrypt(key, in + 16    , out + 16    );
-	sms4_encrypt(key, in + 16 * 2, out + 16 * 2);
-	sms4_encrypt(key, in + 16 * 3, out + 16 * 3);
-	sms4_encrypt(key, in + 16 * 4, out + 16 * 4);
-	sms4_encrypt(key, in + 16 * 5, out + 16 * 5);
-	sms4_encrypt(key, in + 16 * 6, out + 16 * 6);
-	sms4_encrypt(key, in + 16 * 7, out + 16 * 7);
+#ifdef SMS4_AVX2
+	if (SMS4_AVX2_CAPABLE) {
+		if (SMS4_AESNI_CAPABLE)
+			sms4_avx2_aesni_encrypt_16blocks(in, out, key);
+		else
+			sms4_avx2_encrypt_16blocks(in, out, key);
+		return;
+	}
+#endif
+	sms4_encrypt_8blocks(in, out, key);
+	sms4_encrypt_8blocks(in + 16 * 8, out + 16 * 8, key);
 }
 
-void sms4_encrypt_16blocks(sms4_key_t *key, const unsigned char *in, unsigned char *out)
+/* with a decryption key schedule this decrypts */
+void sms4_ecb_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key)
 {
-	sms4_encrypt_8blocks(key, in, out);
-	sms4_encrypt_8blocks(key, in + 16 * 8, out + 16 * 8);
+#ifdef SMS4_BS
+	if (SMS4_AVX2_CAPABLE) {
+		while (blocks >= SMS4_BS_AVX2_BLOCKS) {
+			sms4_avx2_bs_encrypt_64blocks(in, out, key);
+			in += 16 * SMS4_BS_AVX2_BLOCKS;
+			out += 16 * SMS4_BS_AVX2_BLOCKS;
+			blocks -= SMS4_BS_AVX2_BLOCKS;
+		}
+	} else if (SMS4_SSSE3_CAPABLE && !SMS4_AESNI_CAPABLE) {
+		while (blocks >= SMS4_BS_SSSE3_BLOCKS) {
+			sms4_ssse3_bs_encrypt_32blocks(in, out, key);
+			in += 16 * SMS4_BS_SSSE3_BLOCKS;
+			out += 16 * SMS4_BS_SSSE3_BLOCKS;
+			blocks -= SMS4_BS_SSSE3_BLOCKS;
+		}
+	}
+#endif
+#ifdef SMS4_AVX2
+	if (SMS4_AVX2_CAPABLE) {
+		while (blocks >= 16) {
+			sms4_encrypt_16blocks(in, out, key);
+			in += 16 * 16;
+			out += 16 * 16;
+			blocks -= 16;
+		}
+	}
+#endif
+#if defined(SMS4_AVX2) || defined(SMS4_AESNI)
+	while (blocks >= 8 && (SMS4_AVX2_CAPABLE || SMS4_AESNI_CAPABLE)) {
+		sms4_encrypt_8blocks(in, out, key);
+		in += 16 * 8;
+		out += 16 * 8;
+		blocks -= 8;
+	}
+#endif
+#ifdef SMS4_AESNI
+	if (blocks >= 4 && SMS4_AESNI_CAPABLE) {
+		sms4_aesni_encrypt_4blocks(in, out, key);
+		in += 16 * 4;
+		out += 16 * 4;
+		blocks -= 4;
+	}
+#endif
+	while (blocks--) {
+		sms4_encrypt(in, out, key);
+		in += 16;
+		out += 16;
+	}
 }
 
+void sms4_ctr32_encrypt_blocks(const unsigned char *in, unsigned char *out,
+	size_t blocks, const sms4_key_t *key, const unsigned char iv[16])
+{
+	unsigned char ctr[16], buf[16];
+	uint32_t n;
+	int i;
+
+	memcpy(ctr, iv, 16);
+	n = GET32(iv + 12);
+#ifdef SMS4_BS
+	if (blocks >= SMS4_BS_AVX2_BLOCKS && SMS4_AVX2_CAPABLE) {
+		size_t len = blocks - blocks % SMS4_BS_AVX2_BLOCKS;
+		sms4_avx2_bs_ctr32_encrypt_blocks(in, out, len, key, ctr);
+		in += 16 * len;
+		out += 16 * len;
+		blocks -= len;
+		n += (uint32_t)len;
+		PUT32(n, ctr + 12);
+	} else if (blocks >= SMS4_BS_SSSE3_BLOCKS && SMS4_SSSE3_CAPABLE &&
+		!SMS4_AESNI_CAPABLE && !SMS4_AVX2_CAPABLE) {
+		size_t len = blocks - blocks % SMS4_BS_SSSE3_BLOCKS;
+		sms4_ssse3_bs_ctr32_encrypt_blocks(in, out, len, key, ctr);
+		in += 16 * len;
+		out += 16 * len;
+		blocks -= len;
+		n += (uint32_t)len;
+		PUT32(n, ctr + 12);
+	}
+#endif
+#ifdef SMS4_AVX2
+	if (SMS4_AVX2_CAPABLE) {
+		if (SMS4_AESNI_CAPABLE)
+			sms4_avx2_aesni_ctr32_encrypt_blocks(in, out, blocks, key, ctr);
+		else
+			sms4_avx2_ctr32_encrypt_blocks(in, out, blocks, key, ctr);
+		return;
+	}
+#endif
+#ifdef SMS4_AESNI
+	if (SMS4_AESNI_CAPABLE) {
+		sms4_aesni_ctr32_encrypt_blocks(in, out, blocks, key, ctr);
+		return;
+	}
+#endif
+	while (blocks--) {
+		sms4_encrypt(ctr, buf, key);
+		for (i = 0; i < 16; i++) {
+			out[i] = in[i] ^ buf[i];
+		}
+		n++;
+		PUT32(n, ctr + 12);
+		in += 16;
+		out += 16;
+	}
+	OPENSSL_cleanse(buf, sizeof(buf));
+}
@@ -0,0 +1,149 @@
+/* crypto/sms4/sms4_key_cache.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ */
+
+/*
+ * The cache is 4-way set associative. The set is chosen by a hash of the
+ * key salted at creation, so the memory access pattern does not follow
+ * raw key bits, and keys are compared with CRYPTO_memcmp(). Within a set
+ * the least recently used entry is replaced. A hit costs a hash and a
+ * 16-byte compare, a miss computes both schedules in one expansion, so
+ * the decryption schedule is ready when the same key comes back for the
+ * other direction.
+ */
+
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+#include "sms4.h"
+#include "sms4_lcl.h"
+
+#define SMS4_KEY_CACHE_WAYS	4
+#define SMS4_KEY_CACHE_SETS	(SMS4_KEY_CACHE_SIZE / SMS4_KEY_CACHE_WAYS)
+
+typedef struct {
+	unsigned char user_key[SMS4_KEY_LENGTH];
+	unsigned long used;	/* 0 for an empty entry */
+	sms4_key_t enc_key;
+	sms4_key_t dec_key;
+} SMS4_KEY_CACHE_ENTRY;
+
+struct sms4_key_cache_st {
+	SMS4_KEY_CACHE_ENTRY entry[SMS4_KEY_CACHE_SIZE];
+	uint32_t salt[4];
+	unsigned long clock;
+};
+
+SMS4_KEY_CACHE *SMS4_KEY_CACHE_new(void)
+{
+	SMS4_KEY_CACHE *ret;
+
+	if (!(ret = OPENSSL_malloc(sizeof(*ret))))
+		return NULL;
+	memset(ret, 0, sizeof(*ret));
+	if (RAND_bytes((unsigned char *)ret->salt, sizeof(ret->salt)) <= 0) {
+		OPENSSL_free(ret);
+		return NULL;
+	}
+	return ret;
+}
+
+void SMS4_KEY_CACHE_free(SMS4_KEY_CACHE *cache)
+{
+	if (cache) {
+		OPENSSL_cleanse(cache, sizeof(*cache));
+		OPENSSL_free(cache);
+	}
+}
+
+static SMS4_KEY_CACHE_ENTRY *sms4_key_cache_set(const SMS4_KEY_CACHE *cache,
+	const unsigned char *user_key)
+{
+	uint32_t h = 0;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		h = (h ^ GET32(user_key + 4 * i) ^ cache->salt[i]) * 0x9e3779b1;
+		h ^= h >> 15;
+	}
+	return (SMS4_KEY_CACHE_ENTRY *)cache->entry +
+		SMS4_KEY_CACHE_WAYS * (h % SMS4_KEY_CACHE_SETS);
+}
+
+int SMS4_KEY_CACHE_get(SMS4_KEY_CACHE *cache, const unsigned char *user_key,
+	sms4_key_t *enc_key, sms4_key_t *dec_key)
+{
+	SMS4_KEY_CACHE_ENTRY *set = sms4_key_cache_set(cache, user_key);
+	SMS4_KEY_CACHE_ENTRY *e = set;
+	int i, hit = 0;
+
+	for (i = 0; i < SMS4_KEY_CACHE_WAYS; i++) {
+		if (set[i].used && CRYPTO_memcmp(set[i].user_key, user_key,
+			SMS4_KEY_LENGTH) == 0) {
+			e = &set[i];
+			hit = 1;
+			break;
+		}
+		if (set[i].used < e->used)
+			e = &set[i];
+	}
+
+	if (!hit) {
+		memcpy(e->user_key, user_key, SMS4_KEY_LENGTH);
+		sms4_set_key(&e->enc_key, &e->dec_key, user_key);
+	}
+	if (!++cache->clock)
+		cache->clock = 1;
+	e->used = cache->clock;
+
+	if (enc_key)
+		memcpy(enc_key, &e->enc_key, sizeof(sms4_key_t));
+	if (dec_key)
+		memcpy(dec_key, &e->dec_key, sizeof(sms4_key_t));
+	return hit;
+}
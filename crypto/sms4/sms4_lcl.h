@@ -118,6 +118,72 @@ extern uint32_t SBOX32H[256 * 256];
 
 void sms4_init_sbox32(void);
 
+#if !defined(OPENSSL_NO_ASM) && defined(__GNUC__) && \
+	(defined(__x86_64) || defined(__x86_64__))
+# define SMS4_AVX2
+# define SMS4_AESNI
+# define SMS4_BS
+extern unsigned int OPENSSL_ia32cap_P[];
+# define SMS4_AVX2_CAPABLE	(OPENSSL_ia32cap_P[2] & (1 << 5))
+/* AES-NI and SSSE3 */
+# define SMS4_AESNI_CAPABLE	((OPENSSL_ia32cap_P[1] & ((1 << (57 - 32)) | \
+	(1 << (41 - 32)))) == ((1 << (57 - 32)) | (1 << (41 - 32))))
+# define SMS4_SSSE3_CAPABLE	(OPENSSL_ia32cap_P[1] & (1 << (41 - 32)))
+
+/*
+ * S_sms4(x) = post(S_aes(pre(x))), nibble lookup tables of the affine
+ * maps pre and post (the constant is in the low tables) and the byte
+ * order that cancels ShiftRows, see sms4_enc_aesni.c
+ */
+# define SMS4_AESNI_PRE_LO \
+	0x3e,0xb2,0x0e,0x82,0xbb,0x37,0x8b,0x07,0xa1,0x2d,0x91,0x1d,0x24,0xa8,0x14,0x98
+# define SMS4_AESNI_PRE_HI \
+	0x00,0xdc,0x2e,0xf2,0xc5,0x19,0xeb,0x37,0x08,0xd4,0x26,0xfa,0xcd,0x11,0xe3,0x3f
+# define SMS4_AESNI_POST_LO \
+	0x6c,0xd4,0xa6,0x1e,0x52,0xea,0x98,0x20,0x0b,0xb3,0xc1,0x79,0x35,0x8d,0xff,0x47
+# define SMS4_AESNI_POST_HI \
+	0x00,0xe0,0x50,0xb0,0x9d,0x7d,0xcd,0x2d,0xc0,0x20,0x90,0x70,0x5d,0xbd,0x0d,0xed
+# define SMS4_AESNI_INV_SHIFT_ROWS \
+	0,13,10,7,4,1,14,11,8,5,2,15,12,9,6,3
+
+void sms4_aesni_encrypt_4blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key);
+void sms4_aesni_encrypt_8blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key);
+void sms4_aesni_ctr32_encrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	const unsigned char iv[16]);
+
+void sms4_avx2_encrypt_8blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key);
+void sms4_avx2_encrypt_16blocks(const unsigned char *in, unsigned char *out,
+	const sms4_key_t *key);
+void sms4_avx2_ctr32_encrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	const unsigned char iv[16]);
+void sms4_avx2_aesni_encrypt_8blocks(const unsigned char *in,
+	unsigned char *out, const sms4_key_t *key);
+void sms4_avx2_aesni_encrypt_16blocks(const unsigned char *in,
+	unsigned char *out, const sms4_key_t *key);
+void sms4_avx2_aesni_ctr32_encrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	const unsigned char iv[16]);
+
+/* bitsliced kernels, see sms4_enc_bs.c */
+# define SMS4_BS_SSSE3_BLOCKS	32
+# define SMS4_BS_AVX2_BLOCKS	64
+void sms4_ssse3_bs_encrypt_32blocks(const unsigned char *in,
+	unsigned char *out, const sms4_key_t *key);
+void sms4_ssse3_bs_ctr32_encrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	const unsigned char iv[16]);
+void sms4_avx2_bs_encrypt_64blocks(const unsigned char *in,
+	unsigned char *out, const sms4_key_t *key);
+void sms4_avx2_bs_ctr32_encrypt_blocks(const unsigned char *in,
+	unsigned char *out, size_t blocks, const sms4_key_t *key,
+	const unsigned char iv[16]);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
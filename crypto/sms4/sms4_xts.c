@@ -0,0 +1,189 @@
+/* crypto/sms4/sms4_xts.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+#include <openssl/crypto.h>
+#include <openssl/sms4.h>
+
+/*
+ * XTS (IEEE P1619) with ciphertext stealing. The data is processed in
+ * chunks of 64 blocks: the tweaks of a chunk are computed first, then the
+ * whole chunk goes through the multi-block kernels, a full chunk is one
+ * call of the widest bitsliced kernel.
+ */
+
+#define SMS4_XTS_CHUNK	64
+
+/* the tweak is a little-endian element of GF(2^128) */
+static void sms4_xts_load(uint64_t t[2], const unsigned char *p)
+{
+	int i;
+
+	t[0] = t[1] = 0;
+	for (i = 7; i >= 0; i--) {
+		t[0] = (t[0] << 8) | p[i];
+		t[1] = (t[1] << 8) | p[8 + i];
+	}
+}
+
+static void sms4_xts_double(uint64_t t[2])
+{
+	uint64_t carry = 0 - (t[1] >> 63);
+
+	t[1] = (t[1] << 1) | (t[0] >> 63);
+	t[0] = (t[0] << 1) ^ (carry & 0x87);
+}
+
+static void sms4_xts_store(unsigned char *p, const uint64_t t[2])
+{
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		p[i] = (unsigned char)(t[0] >> (8 * i));
+		p[8 + i] = (unsigned char)(t[1] >> (8 * i));
+	}
+}
+
+static void sms4_xts_xor(unsigned char *out, const unsigned char *in,
+	const unsigned char *tweak, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		out[i] = in[i] ^ tweak[i];
+}
+
+/* en/decrypt one block in place */
+static void sms4_xts_block(unsigned char *block, const sms4_key_t *key,
+	const uint64_t t[2])
+{
+	unsigned char tweak[16];
+
+	sms4_xts_store(tweak, t);
+	sms4_xts_xor(block, block, tweak, 16);
+	sms4_encrypt(block, block, key);
+	sms4_xts_xor(block, block, tweak, 16);
+}
+
+/*
+ * key1 is the data key (decryption schedule when decrypting), key2 the
+ * tweak key. Returns -1 if len is less than one block.
+ */
+int sms4_xts_encrypt(const unsigned char *in, unsigned char *out,
+	size_t len, const sms4_key_t *key1, const sms4_key_t *key2,
+	const unsigned char iv[16], int enc)
+{
+	unsigned char buf[16 * SMS4_XTS_CHUNK];
+	unsigned char tweak[16 * SMS4_XTS_CHUNK];
+	uint64_t t[2], t1[2];
+	size_t blocks, n, i;
+	unsigned char c;
+
+	if (len < 16)
+		return -1;
+
+	sms4_encrypt(iv, buf, key2);
+	sms4_xts_load(t, buf);
+
+	/* when decrypting with stealing, the last full block is special */
+	blocks = len / 16;
+	if (!enc && (len % 16))
+		blocks--;
+	len -= blocks * 16;
+
+	while (blocks) {
+		n = blocks < SMS4_XTS_CHUNK ? blocks : SMS4_XTS_CHUNK;
+		for (i = 0; i < n; i++) {
+			sms4_xts_store(tweak + 16 * i, t);
+			sms4_xts_double(t);
+		}
+		sms4_xts_xor(buf, in, tweak, 16 * n);
+		sms4_ecb_encrypt_blocks(buf, buf, n, key1);
+		sms4_xts_xor(out, buf, tweak, 16 * n);
+		in += 16 * n;
+		out += 16 * n;
+		blocks -= n;
+	}
+
+	if (len == 0)
+		goto end;
+
+	if (enc) {
+		/* swap the tail with the head of the last output block */
+		memcpy(buf, out - 16, 16);
+		for (i = 0; i < len; i++) {
+			c = in[i];
+			out[i] = buf[i];
+			buf[i] = c;
+		}
+		sms4_xts_block(buf, key1, t);
+		memcpy(out - 16, buf, 16);
+	} else {
+		/* the last full block uses the tweak after the stolen one */
+		t1[0] = t[0];
+		t1[1] = t[1];
+		sms4_xts_double(t1);
+		memcpy(buf, in, 16);
+		sms4_xts_block(buf, key1, t1);
+		for (i = 0; i < len - 16; i++) {
+			c = in[16 + i];
+			out[16 + i] = buf[i];
+			buf[i] = c;
+		}
+		sms4_xts_block(buf, key1, t);
+		memcpy(out, buf, 16);
+	}
+
+end:
+	OPENSSL_cleanse(buf, sizeof(buf));
+	OPENSSL_cleanse(tweak, sizeof(tweak));
+	OPENSSL_cleanse(t, sizeof(t));
+	return 0;
+}
@@ -1,7 +1,586 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include "sms4.h"
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/sms4.h>
+
+/* compare the multi-block functions with sms4_encrypt() block by block */
+static int test_sms4_blocks(const sms4_key_t *key)
+{
+	unsigned char in[16 * 140], out[16 * 140], ref[16 * 140];
+	unsigned char iv[16], ctr[16];
+	size_t i, j, n;
+	uint32_t c;
+
+	for (i = 0; i < sizeof(in); i++)
+		in[i] = (unsigned char)(i * 31 + 7);
+	/* start close to the 32-bit wrap of the counter */
+	for (i = 0; i < 16; i++)
+		iv[i] = (unsigned char)(0xf0 + i);
+
+	for (n = 0; n <= 140; n++) {
+		for (i = 0; i < n; i++)
+			sms4_encrypt(in + 16 * i, ref + 16 * i, key);
+		sms4_ecb_encrypt_blocks(in, out, n, key);
+		if (memcmp(out, ref, 16 * n) != 0) {
+			printf("sms4 ecb %d blocks not pass!\n", (int)n);
+			return -1;
+		}
+
+		memcpy(ctr, iv, 16);
+		for (i = 0; i < n; i++) {
+			sms4_encrypt(ctr, ref + 16 * i, key);
+			for (j = 0; j < 16; j++)
+				ref[16 * i + j] ^= in[16 * i + j];
+			c = ((uint32_t)ctr[12] << 24 | (uint32_t)ctr[13] << 16 |
+				(uint32_t)ctr[14] << 8 | ctr[15]) + 1;
+			ctr[12] = c >> 24; ctr[13] = c >> 16; ctr[14] = c >> 8; ctr[15] = c;
+		}
+		sms4_ctr32_encrypt_blocks(in, out, n, key, iv);
+		if (memcmp(out, ref, 16 * n) != 0) {
+			printf("sms4 ctr32 %d blocks not pass!\n", (int)n);
+			return -1;
+		}
+	}
+
+	sms4_encrypt_16blocks(in, out, key);
+	sms4_ecb_encrypt_blocks(in, ref, 16, key);
+	if (memcmp(out, ref, 16 * 16) != 0) {
+		printf("sms4 encrypt 16 blocks not pass!\n");
+		return -1;
+	}
+	printf("sms4 multi-block pass!\n");
+	return 0;
+}
+
+/* the multi-block decryption path against CBC encryption, also in place */
+static int test_sms4_cbc(const unsigned char *user_key)
+{
+	unsigned char in[16 * 40], out[16 * 40], buf[16 * 40];
+	unsigned char iv[16], ivec[16];
+	sms4_key_t enc_key, dec_key;
+	size_t i, len;
+
+	sms4_set_encrypt_key(&enc_key, user_key);
+	sms4_set_decrypt_key(&dec_key, user_key);
+	for (i = 0; i < sizeof(in); i++)
+		in[i] = (unsigned char)(i * 13 + 1);
+	for (i = 0; i < 16; i++)
+		iv[i] = (unsigned char)i;
+
+	for (len = 0; len <= sizeof(in); len += 16) {
+		memcpy(ivec, iv, 16);
+		sms4_cbc_encrypt(in, out, len, &enc_key, ivec, 1);
+
+		memcpy(ivec, iv, 16);
+		sms4_cbc_encrypt(out, buf, len, &dec_key, ivec, 0);
+		if (memcmp(buf, in, len) != 0 ||
+			(len && memcmp(ivec, out + len - 16, 16) != 0)) {
+			printf("sms4 cbc %d bytes not pass!\n", (int)len);
+			return -1;
+		}
+
+		memcpy(ivec, iv, 16);
+		sms4_cbc_encrypt(out, out, len, &dec_key, ivec, 0);
+		if (memcmp(out, in, len) != 0) {
+			printf("sms4 cbc in place %d bytes not pass!\n", (int)len);
+			return -1;
+		}
+	}
+	printf("sms4 cbc pass!\n");
+	return 0;
+}
+
+/* XTS in place against out of place, including a stolen partial block */
+static int test_sms4_xts(const unsigned char *user_key)
+{
+	unsigned char in[100], out[100], buf[100], iv[16];
+	sms4_key_t key1, key2, dec_key;
+	size_t i, len;
+
+	sms4_set_encrypt_key(&key1, user_key);
+	sms4_set_decrypt_key(&dec_key, user_key);
+	for (i = 0; i < 16; i++)
+		iv[i] = (unsigned char)(i * 7);
+	sms4_set_encrypt_key(&key2, iv);
+	for (i = 0; i < sizeof(in); i++)
+		in[i] = (unsigned char)(i * 13 + 1);
+
+	for (len = 16; len <= sizeof(in); len++) {
+		if (sms4_xts_encrypt(in, out, len, &key1, &key2, iv, 1) != 0)
+			return -1;
+		memcpy(buf, in, len);
+		sms4_xts_encrypt(buf, buf, len, &key1, &key2, iv, 1);
+		if (memcmp(buf, out, len) != 0) {
+			printf("sms4 xts in place encrypt %d bytes not pass!\n",
+				(int)len);
+			return -1;
+		}
+		sms4_xts_encrypt(out, buf, len, &dec_key, &key2, iv, 0);
+		if (memcmp(buf, in, len) != 0) {
+			printf("sms4 xts decrypt %d bytes not pass!\n", (int)len);
+			return -1;
+		}
+		sms4_xts_encrypt(out, out, len, &dec_key, &key2, iv, 0);
+		if (memcmp(out, in, len) != 0) {
+			printf("sms4 xts in place decrypt %d bytes not pass!\n",
+				(int)len);
+			return -1;
+		}
+	}
+	printf("sms4 xts pass!\n");
+	return 0;
+}
+
+/*
+ * the EVP context keeps its key schedule block when it is given a new key
+ * for the same cipher, a copy gets a block of its own
+ */
+static int test_sms4_ctx_reuse(const unsigned char *user_key)
+{
+	EVP_CIPHER_CTX ctx, ctx2;
+	void *cipher_data;
+	unsigned char iv[16], ivec[16];
+	unsigned char in[64], out[64], buf[64];
+	sms4_key_t key;
+	int i, len, ret = -1;
+
+	for (i = 0; i < (int)sizeof(in); i++)
+		in[i] = (unsigned char)(i * 5 + 3);
+	for (i = 0; i < 16; i++)
+		iv[i] = (unsigned char)(i + 16);
+	sms4_set_encrypt_key(&key, user_key);
+	memcpy(ivec, iv, 16);
+	sms4_cbc_encrypt(in, out, sizeof(in), &key, ivec, 1);
+
+	EVP_CIPHER_CTX_init(&ctx);
+	EVP_CIPHER_CTX_init(&ctx2);
+	if (!EVP_DecryptInit_ex(&ctx, EVP_sms4_cbc(), NULL, user_key, iv)) {
+		printf("sms4 context init not pass!\n");
+		goto end;
+	}
+	cipher_data = ctx.cipher_data;
+	if (!EVP_EncryptInit_ex(&ctx, EVP_sms4_cbc(), NULL, user_key, iv)
+		|| ctx.cipher_data != cipher_data) {
+		printf("sms4 context reuse not pass!\n");
+		goto end;
+	}
+	if (!EVP_CIPHER_CTX_copy(&ctx2, &ctx)
+		|| ctx2.cipher_data == ctx.cipher_data) {
+		printf("sms4 context copy init not pass!\n");
+		goto end;
+	}
+	EVP_CIPHER_CTX_cleanup(&ctx);
+	if (!EVP_EncryptUpdate(&ctx2, buf, &len, in, sizeof(in))
+		|| len != (int)sizeof(in) || memcmp(buf, out, len) != 0) {
+		printf("sms4 context copy not pass!\n");
+		goto end;
+	}
+	printf("sms4 context reuse pass!\n");
+	ret = 0;
+end:
+	EVP_CIPHER_CTX_cleanup(&ctx);
+	EVP_CIPHER_CTX_cleanup(&ctx2);
+	return ret;
+}
+
+/* sms4_set_key() and SMS4_KEY_CACHE against the two key schedules */
+static int test_sms4_key_cache(void)
+{
+	SMS4_KEY_CACHE *cache;
+	sms4_key_t enc_key, dec_key, ref_enc, ref_dec;
+	unsigned char user_key[16];
+	int i, j, hits = 0, ret = -1;
+
+	if (!(cache = SMS4_KEY_CACHE_new())) {
+		printf("sms4 key cache new failed!\n");
+		return -1;
+	}
+	memset(user_key, 0, sizeof(user_key));
+	for (i = 0; i < 8 * SMS4_KEY_CACHE_SIZE; i++) {
+		user_key[0] = (unsigned char)i;
+		user_key[1] = (unsigned char)(i >> 8);
+		user_key[15] = (unsigned char)(i * 7);
+		sms4_set_encrypt_key(&ref_enc, user_key);
+		sms4_set_decrypt_key(&ref_dec, user_key);
+
+		sms4_set_key(&enc_key, &dec_key, user_key);
+		if (memcmp(&enc_key, &ref_enc, sizeof(ref_enc)) != 0 ||
+			memcmp(&dec_key, &ref_dec, sizeof(ref_dec)) != 0) {
+			printf("sms4 set key not pass!\n");
+			goto end;
+		}
+
+		/* the first lookup misses, the following ones hit */
+		for (j = 0; j < 3; j++) {
+			memset(&enc_key, 0, sizeof(enc_key));
+			memset(&dec_key, 0, sizeof(dec_key));
+			hits += SMS4_KEY_CACHE_get(cache, user_key,
+				j == 1 ? NULL : &enc_key, j == 2 ? NULL : &dec_key);
+			if ((j != 1 && memcmp(&enc_key, &ref_enc, sizeof(ref_enc))) ||
+				(j != 2 && memcmp(&dec_key, &ref_dec, sizeof(ref_dec)))) {
+				printf("sms4 key cache not pass!\n");
+				goto end;
+			}
+		}
+	}
+	if (hits != 2 * 8 * SMS4_KEY_CACHE_SIZE) {
+		printf("sms4 key cache hits not pass!\n");
+		goto end;
+	}
+	/* the first key has been evicted */
+	memset(user_key, 0, sizeof(user_key));
+	if (SMS4_KEY_CACHE_get(cache, user_key, &enc_key, NULL) != 0) {
+		printf("sms4 key cache eviction not pass!\n");
+		goto end;
+	}
+	printf("sms4 key cache pass!\n");
+	ret = 0;
+end:
+	SMS4_KEY_CACHE_free(cache);
+	return ret;
+}
+
+/*
+ * sms4_cbc_encrypt_mb() and EVP_CIPHER_CTX_batch_update() against CBC one
+ * message at a time, with more messages than lanes, a context under
+ * another key, one without padding and lengths that are not aligned
+ */
+#define NMSGS	70
+
+static int sms4_batch_init(EVP_CIPHER_CTX *ctx, const unsigned char *key,
+	const unsigned char *iv, int enc, int padding)
+{
+	return EVP_CipherInit_ex(ctx, EVP_sms4_cbc(), NULL, key, iv, enc) &&
+		EVP_CIPHER_CTX_set_padding(ctx, padding);
+}
+
+static int test_sms4_cbc_batch(const unsigned char *user_key)
+{
+	static unsigned char in[NMSGS][300], out[NMSGS][320], ref[NMSGS][320];
+	static unsigned char dec[NMSGS][320];
+	EVP_CIPHER_CTX ctx[NMSGS], *pctx[NMSGS];
+	const unsigned char *pin[NMSGS], *k;
+	unsigned char *pout[NMSGS], *piv[NMSGS];
+	unsigned char iv[NMSGS][16], ivec[16], other_key[16];
+	size_t blocks[NMSGS];
+	int inl[NMSGS], outl[NMSGS], reflen[NMSGS], len, i, j;
+	sms4_key_t key;
+	int ret = -1;
+
+	sms4_set_encrypt_key(&key, user_key);
+	memcpy(other_key, user_key, 16);
+	other_key[0] ^= 1;
+	for (i = 0; i < NMSGS; i++) {
+		for (j = 0; j < (int)sizeof(in[i]); j++)
+			in[i][j] = (unsigned char)(i * 7 + j * 13);
+		blocks[i] = i % 19;
+		EVP_CIPHER_CTX_init(&ctx[i]);
+		pctx[i] = &ctx[i];
+	}
+
+	for (i = 0; i < NMSGS; i++) {
+		for (j = 0; j < 16; j++)
+			iv[i][j] = (unsigned char)(i + j);
+		memcpy(ivec, iv[i], 16);
+		sms4_cbc_encrypt(in[i], ref[i], 16 * blocks[i], &key, ivec, 1);
+		pin[i] = in[i];
+		pout[i] = out[i];
+		piv[i] = iv[i];
+	}
+	sms4_cbc_encrypt_mb(pin, pout, blocks, NMSGS, &key, piv);
+	for (i = 0; i < NMSGS; i++) {
+		if (memcmp(out[i], ref[i], 16 * blocks[i]) != 0 || (blocks[i] &&
+			memcmp(iv[i], out[i] + 16 * (blocks[i] - 1), 16) != 0)) {
+			printf("sms4 cbc multi-buffer %d not pass!\n", i);
+			goto end;
+		}
+	}
+
+	/* context 5 has another key, context 9 no padding */
+	for (i = 0; i < NMSGS; i++) {
+		for (j = 0; j < 16; j++)
+			iv[i][j] = (unsigned char)(i + j);
+		inl[i] = (i * 37) % (int)sizeof(in[i]);
+		if (i == 9)
+			inl[i] &= ~15;
+		k = i == 5 ? other_key : user_key;
+		if (!sms4_batch_init(&ctx[i], k, iv[i], 1, i != 9) ||
+			!EVP_CipherUpdate(&ctx[i], ref[i], &reflen[i], in[i], inl[i]) ||
+			!EVP_CipherFinal_ex(&ctx[i], ref[i] + reflen[i], &len) ||
+			!sms4_batch_init(&ctx[i], k, iv[i], 1, i != 9))
+			goto end;
+		reflen[i] += len;
+	}
+	if (!EVP_CIPHER_CTX_batch_update(pctx, pout, outl, pin, inl, NMSGS))
+		goto end;
+	for (i = 0; i < NMSGS; i++) {
+		if (!EVP_CipherFinal_ex(&ctx[i], out[i] + outl[i], &len) ||
+			outl[i] + len != reflen[i] ||
+			memcmp(out[i], ref[i], reflen[i]) != 0) {
+			printf("sms4 cbc batch encrypt %d not pass!\n", i);
+			goto end;
+		}
+	}
+
+	/* and back, the padded decryptions keep a block until the final */
+	for (i = 0; i < NMSGS; i++) {
+		k = i == 5 ? other_key : user_key;
+		if (!sms4_batch_init(&ctx[i], k, iv[i], 0, i != 9))
+			goto end;
+		pin[i] = ref[i];
+		pout[i] = dec[i];
+	}
+	if (!EVP_CIPHER_CTX_batch_update(pctx, pout, outl, pin, reflen, NMSGS))
+		goto end;
+	for (i = 0; i < NMSGS; i++) {
+		if (!EVP_CipherFinal_ex(&ctx[i], dec[i] + outl[i], &len) ||
+			outl[i] + len != inl[i] ||
+			memcmp(dec[i], in[i], inl[i]) != 0) {
+			printf("sms4 cbc batch decrypt %d not pass!\n", i);
+			goto end;
+		}
+	}
+
+	printf("sms4 cbc batch pass!\n");
+	ret = 0;
+end:
+	for (i = 0; i < NMSGS; i++)
+		EVP_CIPHER_CTX_cleanup(&ctx[i]);
+	return ret;
+}
+
+static const unsigned char tls_mac_key[32] = {
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+	0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+	0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+};
+
+/* 13-byte TLS 1.1 header of record seq with the length field len */
+static void tls_aad(unsigned char aad[13], unsigned int seq, size_t len)
+{
+	memset(aad, 0, 8);
+	aad[4] = (unsigned char)(seq >> 24);
+	aad[5] = (unsigned char)(seq >> 16);
+	aad[6] = (unsigned char)(seq >> 8);
+	aad[7] = (unsigned char)seq;
+	aad[8] = 0x17;
+	aad[9] = 0x03;
+	aad[10] = 0x02;
+	aad[11] = (unsigned char)(len >> 8);
+	aad[12] = (unsigned char)len;
+}
+
+#define TLS_BAD_MAC	1
+#define TLS_BAD_PAD	2
+
+/*
+ * The record explicit IV || payload || HMAC-SM3 || padding encrypted with
+ * the plain SMS4-CBC, the MAC or the first padding byte spoilt by flaw.
+ * Returns the record length.
+ */
+static int tls_record(unsigned char *out, const unsigned char *key,
+	const unsigned char *iv, const unsigned char *exiv, unsigned int seq,
+	const unsigned char *in, size_t inlen, int flaw)
+{
+	unsigned char aad[13];
+	unsigned char *p = out;
+	unsigned int maclen = 32;
+	size_t len, pad, i;
+	HMAC_CTX hmac;
+	EVP_CIPHER_CTX ctx;
+	int outl, ok;
+
+	memcpy(p, exiv, 16);
+	memcpy(p + 16, in, inlen);
+	p += 16 + inlen;
+	tls_aad(aad, seq, inlen);
+	HMAC_CTX_init(&hmac);
+	ok = HMAC_Init_ex(&hmac, tls_mac_key, sizeof(tls_mac_key), EVP_sm3(),
+		NULL) && HMAC_Update(&hmac, aad, sizeof(aad)) &&
+		HMAC_Update(&hmac, in, inlen) && HMAC_Final(&hmac, p, &maclen);
+	HMAC_CTX_cleanup(&hmac);
+	if (!ok)
+		return -1;
+	if (flaw == TLS_BAD_MAC)
+		p[5] ^= 0x40;
+	p += maclen;
+
+	len = p - out;
+	pad = 15 - len % 16;
+	for (i = 0; i <= pad; i++)
+		p[i] = (unsigned char)pad;
+	if (flaw == TLS_BAD_PAD)
+		p[0] ^= 0x01;
+	len += pad + 1;
+
+	EVP_CIPHER_CTX_init(&ctx);
+	ok = EVP_EncryptInit_ex(&ctx, EVP_sms4_cbc(), NULL, key, iv) &&
+		EVP_CIPHER_CTX_set_padding(&ctx, 0) &&
+		EVP_EncryptUpdate(&ctx, out, &outl, out, (int)len);
+	EVP_CIPHER_CTX_cleanup(&ctx);
+	return ok ? (int)len : -1;
+}
+
+/* opens one record with the stitched cipher, returns the payload length */
+static int tls_open(unsigned char *out, const unsigned char *key,
+	unsigned int seq, const unsigned char *in, size_t inlen)
+{
+	static const unsigned char iv[16] = {0};
+	unsigned char aad[13];
+	EVP_CIPHER_CTX ctx;
+	int ret = -1;
+
+	tls_aad(aad, seq, inlen);
+	EVP_CIPHER_CTX_init(&ctx);
+	if (EVP_DecryptInit_ex(&ctx, EVP_sms4_cbc_hmac_sm3(), NULL, key, iv) &&
+		EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_SET_MAC_KEY,
+			sizeof(tls_mac_key), (void *)tls_mac_key) &&
+		EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_TLS1_AAD, sizeof(aad),
+			aad) == 32 &&
+		EVP_Cipher(&ctx, out, in, (unsigned int)inlen) == 1)
+		ret = (int)inlen - 16 - 32 - out[inlen - 1] - 1;
+	EVP_CIPHER_CTX_cleanup(&ctx);
+	return ret;
+}
+
+/*
+ * SMS4-CBC-HMAC-SM3 against SMS4-CBC and HMAC-SM3 done apart, both ways,
+ * then records with a wrong MAC or padding and the multi-block path
+ */
+static int test_sms4_cbc_hmac_sm3(const unsigned char *user_key)
+{
+	static const size_t lens[] = {0, 1, 15, 16, 31, 100, 333, 1000, 2049};
+	static unsigned char in[16384], ref[16384 + 1024], out[16384 + 1024];
+	static unsigned char dec[16384 + 1024];
+	unsigned char iv[16], exiv[16], aad[13];
+	EVP_CIPHER_CTX ctx;
+	size_t i, j, inlen;
+	int len, reclen, pad, n;
+	int ret = -1;
+
+	for (i = 0; i < sizeof(in); i++)
+		in[i] = (unsigned char)(i * 11 + 3);
+	for (i = 0; i < 16; i++) {
+		iv[i] = (unsigned char)(0xa0 + i);
+		exiv[i] = (unsigned char)(0x50 + i);
+	}
+	EVP_CIPHER_CTX_init(&ctx);
+
+	for (i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+		inlen = lens[i];
+		if ((reclen = tls_record(ref, user_key, iv, exiv, (unsigned int)i,
+			in, inlen, 0)) < 0)
+			goto end;
+
+		/* the AAD length includes the explicit IV when encrypting */
+		tls_aad(aad, (unsigned int)i, 16 + inlen);
+		memcpy(out, exiv, 16);
+		memcpy(out + 16, in, inlen);
+		if (!EVP_EncryptInit_ex(&ctx, EVP_sms4_cbc_hmac_sm3(), NULL,
+			user_key, iv) ||
+			!EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_SET_MAC_KEY,
+			sizeof(tls_mac_key), (void *)tls_mac_key) ||
+			(pad = EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_TLS1_AAD,
+			sizeof(aad), aad)) <= 0 ||
+			(int)(16 + inlen) + pad != reclen ||
+			EVP_Cipher(&ctx, out, out, reclen) != 1 ||
+			memcmp(out, ref, reclen) != 0) {
+			printf("sms4 cbc hmac sm3 encrypt %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+
+		if (tls_open(dec, user_key, (unsigned int)i, ref, reclen) !=
+			(int)inlen || memcmp(dec + 16, in, inlen) != 0) {
+			printf("sms4 cbc hmac sm3 decrypt %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+
+		/* another sequence number, a spoilt MAC or padding */
+		if (tls_open(dec, user_key, (unsigned int)i + 1, ref, reclen) >= 0) {
+			printf("sms4 cbc hmac sm3 wrong sequence %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+		if ((reclen = tls_record(ref, user_key, iv, exiv, (unsigned int)i,
+			in, inlen, TLS_BAD_MAC)) < 0 ||
+			tls_open(dec, user_key, (unsigned int)i, ref, reclen) >= 0) {
+			printf("sms4 cbc hmac sm3 bad mac %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+		if ((reclen = tls_record(ref, user_key, iv, exiv, (unsigned int)i,
+			in, inlen, TLS_BAD_PAD)) < 0 ||
+			tls_open(dec, user_key, (unsigned int)i, ref, reclen) >= 0) {
+			printf("sms4 cbc hmac sm3 bad padding %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+	}
+
+#ifdef EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
+	/* 4 and 8 records at once, each one opened on its own */
+	for (inlen = 4096; inlen <= sizeof(in); inlen *= 4) {
+		EVP_CTRL_TLS1_1_MULTIBLOCK_PARAM param;
+		unsigned char *p = out;
+		size_t off = 0;
+
+		tls_aad(aad, 0x100, inlen);
+		memset(&param, 0, sizeof(param));
+		param.inp = aad;
+		param.len = inlen;
+		if (!EVP_EncryptInit_ex(&ctx, EVP_sms4_cbc_hmac_sm3(), NULL,
+			user_key, iv) ||
+			!EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_AEAD_SET_MAC_KEY,
+			sizeof(tls_mac_key), (void *)tls_mac_key))
+			goto end;
+		if ((len = EVP_CIPHER_CTX_ctrl(&ctx,
+			EVP_CTRL_TLS1_1_MULTIBLOCK_AAD, sizeof(param), &param)) <= 0)
+			break; /* not built in */
+		if (len > (int)sizeof(out))
+			goto end;
+		param.out = out;
+		param.inp = in;
+		param.len = inlen;
+		if (EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_TLS1_1_MULTIBLOCK_ENCRYPT,
+			sizeof(param), &param) != len) {
+			printf("sms4 cbc hmac sm3 multi-block %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+
+		for (j = 0; j < param.interleave; j++) {
+			reclen = p[3] << 8 | p[4];
+			if (p[0] != 0x17 || p[1] != 0x03 || p[2] != 0x02 ||
+				p + 5 + reclen > out + len ||
+				(n = tls_open(dec, user_key, 0x100 + (unsigned int)j,
+				p + 5, reclen)) < 0 ||
+				off + n > inlen || memcmp(dec + 16, in + off, n) != 0) {
+				printf("sms4 cbc hmac sm3 multi-block %d bytes record %d "
+					"not pass!\n", (int)inlen, (int)j);
+				goto end;
+			}
+			off += n;
+			p += 5 + reclen;
+		}
+		if (off != inlen || p != out + len) {
+			printf("sms4 cbc hmac sm3 multi-block %d bytes not pass!\n",
+				(int)inlen);
+			goto end;
+		}
+	}
+#endif
+
+	printf("sms4 cbc hmac sm3 pass!\n");
+	ret = 0;
+end:
+	EVP_CIPHER_CTX_cleanup(&ctx);
+	return ret;
+}
 
 int main(int argc, char **argv)
 {
@@ -50,7 +629,7 @@ int main(int argc, char **argv)
 	printf("sms4 key scheduling passed!\n");
 	
 	/* test encrypt once */
-	sms4_encrypt(&key, plaintext, buf);
+	sms4_encrypt(plaintext, buf, &key);
 	
 	if (memcmp(buf, ciphertext1, sizeof(ciphertext1)) != 0) {
 		printf("sms4 encrypt not pass!\n");
@@ -61,7 +640,7 @@ int main(int argc, char **argv)
 	/* test encrypt 1000000 times */
 	memcpy(buf, plaintext, sizeof(plaintext));
 	for (i = 0; i < 1000000; i++) {
-		sms4_encrypt(&key, buf, buf);
+		sms4_encrypt(buf, buf, &key);
 	}
 
 	if (memcmp(buf, ciphertext2, sizeof(ciphertext2)) != 0) {
@@ -69,6 +648,21 @@ int main(int argc, char **argv)
 		goto end;
 	}
 	printf("sms4 encrypt 1000000 times pass!\n");
+
+	if (test_sms4_blocks(&key) != 0)
+		goto end;
+	if (test_sms4_cbc(user_key) != 0)
+		goto end;
+	if (test_sms4_xts(user_key) != 0)
+		goto end;
+	if (test_sms4_ctx_reuse(user_key) != 0)
+		goto end;
+	if (test_sms4_key_cache() != 0)
+		goto end;
+	if (test_sms4_cbc_batch(user_key) != 0)
+		goto end;
+	if (test_sms4_cbc_hmac_sm3(user_key) != 0)
+		goto end;
 	printf("sms4 all test vectors pass!\n");
 	
 	return 0;
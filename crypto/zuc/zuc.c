@@ -1,9 +1,18 @@
-#include <assert.h>
+/* crypto/zuc/zuc.c */
+/*
+ * ZUC stream cipher. The LFSR is not shifted, a ring of 16 words is
+ * indexed relative to the step number instead, so 16 steps unrolled use
+ * constant indices and bring the ring back to its initial place. The
+ * keystream is produced 16 words at a time and xored a word at a time.
+ */
+
+#include <string.h>
 #include "../modes/modes_lcl.h"
 #include "zuc.h"
+#include "zuc_lcl.h"
 
 
-static uint8_t S0[256] = {
+const uint8_t ZUC_S0[256 + 4] = {
 	0x3e,0x72,0x5b,0x47,0xca,0xe0,0x00,0x33,0x04,0xd1,0x54,0x98,0x09,0xb9,0x6d,0xcb,
 	0x7b,0x1b,0xf9,0x32,0xaf,0x9d,0x6a,0xa5,0xb8,0x2d,0xfc,0x1d,0x08,0x53,0x03,0x90,
 	0x4d,0x4e,0x84,0x99,0xe4,0xce,0xd9,0x91,0xdd,0xb6,0x85,0x48,0x8b,0x29,0x6e,0xac,
@@ -20,9 +29,9 @@ static uint8_t S0[256] = {
 	0xf6,0xfa,0x36,0xd2,0x50,0x68,0x9e,0x62,0x71,0x15,0x3d,0xd6,0x40,0xc4,0xe2,0x0f,
 	0x8e,0x83,0x77,0x6b,0x25,0x05,0x3f,0x0c,0x30,0xea,0x70,0xb7,0xa1,0xe8,0xa9,0x65,
 	0x8d,0x27,0x1a,0xdb,0x81,0xb3,0xa0,0xf4,0x45,0x7a,0x19,0xdf,0xee,0x78,0x34,0x60
-}; 
+};
 
-static uint8_t S1[256] =  {
+const uint8_t ZUC_S1[256 + 4] = {
 	0x55,0xc2,0x63,0x71,0x3b,0xc8,0x47,0x86,0x9f,0x3c,0xda,0x5b,0x29,0xaa,0xfd,0x77,
 	0x8c,0xc5,0x94,0x0c,0xa6,0x1a,0x13,0x00,0xe3,0xa8,0x16,0x72,0x40,0xf9,0xf8,0x42,
 	0x44,0x26,0x68,0x96,0x81,0xd9,0x45,0x3e,0x10,0x76,0xc6,0xa7,0x8b,0x39,0x43,0xe1,
@@ -41,210 +50,174 @@ static uint8_t S1[256] =  {
 	0x64,0xbe,0x85,0x9b,0x2f,0x59,0x8a,0xd7,0xb0,0x25,0xac,0xaf,0x12,0x03,0xe2,0xf2
 };
 
-static uint32_t EK_d[16] = {
+static const uint32_t EK_d[16] = {
 	0x44D7, 0x26BC, 0x626B, 0x135E, 0x5789, 0x35E2, 0x7135, 0x09AF,
 	0x4D78, 0x2F13, 0x6BC4, 0x1AF1, 0x5E26, 0x3C4D, 0x789A, 0x47AC
 };
 
-static inline uint32_t AddM(uint32_t a, uint32_t b)
-{
-	uint32_t c = a + b;
-	return (c & 0x7FFFFFFF) + (c >> 31);
-}
+#define ROT(a, k)	(((a) << (k)) | ((a) >> (32 - (k))))
+
+#define L1(X)	((X) ^ ROT(X, 2) ^ ROT(X, 10) ^ ROT(X, 18) ^ ROT(X, 24))
+#define L2(X)	((X) ^ ROT(X, 8) ^ ROT(X, 14) ^ ROT(X, 22) ^ ROT(X, 30))
 
-#define MulByPow2(x, k) ((((x) << k) | ((x) >> (31 - k))) & 0x7FFFFFFF)
+#define SBOX(x)	(((uint32_t)ZUC_S0[(x) >> 24] << 24) | \
+		((uint32_t)ZUC_S1[((x) >> 16) & 0xFF] << 16) | \
+		((uint32_t)ZUC_S0[((x) >> 8) & 0xFF] << 8) | \
+		(uint32_t)ZUC_S1[(x) & 0xFF])
 
-static void LFSRWithInitialisationMode(ZUC_KEY *key, uint32_t u)
+#define MAKEU31(a, b, c) (((uint32_t)(a) << 23) | ((uint32_t)(b) << 8) | (uint32_t)(c))
+
+/*
+ * one step with s0 at s[i & 15]: bit reorganization, F, and the LFSR
+ * whose new word s16 replaces s0. The feedback is summed without the
+ * rotations modulo 2^31 - 1, in 64 bits (less than 2^53) and folded
+ * twice. The words of the LFSR are never 0, so the result is in
+ * [1, 2^31 - 1] as the specification requires.
+ */
+static inline uint32_t zuc_step(uint32_t s[16], int i,
+	uint32_t *R1, uint32_t *R2, int init)
 {
-	uint32_t f, v;
-	f = key->LFSR_S0;
-	
-	v = MulByPow2(key->LFSR_S0, 8);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S4, 20);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S10, 21);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S13, 17);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S15, 15);
-	f = AddM(f, v);
-	
-	f = AddM(f, u);
-	
-	/* update the state */
-	key->LFSR_S0 = key->LFSR_S1;
-	key->LFSR_S1 = key->LFSR_S2;
-	key->LFSR_S2 = key->LFSR_S3;
-	key->LFSR_S3 = key->LFSR_S4;
-	key->LFSR_S4 = key->LFSR_S5;
-	key->LFSR_S5 = key->LFSR_S6;
-	key->LFSR_S6 = key->LFSR_S7;
-	key->LFSR_S7 = key->LFSR_S8;
-	key->LFSR_S8 = key->LFSR_S9;
-	key->LFSR_S9 = key->LFSR_S10;
-	key->LFSR_S10 = key->LFSR_S11;
-	key->LFSR_S11 = key->LFSR_S12;
-	key->LFSR_S12 = key->LFSR_S13;
-	key->LFSR_S13 = key->LFSR_S14;
-	key->LFSR_S14 = key->LFSR_S15;
-	key->LFSR_S15 = f;
+#define S(j)	s[(i + (j)) & 15]
+	uint32_t X0, X1, X2, X3, W, W1, W2, u, v;
+	uint64_t f;
+
+	X0 = ((S(15) & 0x7FFF8000) << 1) | (S(14) & 0xFFFF);
+	X1 = (S(11) << 16) | (S(9) >> 15);
+	X2 = (S(7) << 16) | (S(5) >> 15);
+	X3 = (S(2) << 16) | (S(0) >> 15);
+
+	W  = (X0 ^ *R1) + *R2;
+	W1 = *R1 + X1;
+	W2 = *R2 ^ X2;
+	u = L1((W1 << 16) | (W2 >> 16));
+	v = L2((W2 << 16) | (W1 >> 16));
+	*R1 = SBOX(u);
+	*R2 = SBOX(v);
+
+	f = (uint64_t)S(0) + ((uint64_t)S(0) << 8) + ((uint64_t)S(4) << 20)
+		+ ((uint64_t)S(10) << 21) + ((uint64_t)S(13) << 17)
+		+ ((uint64_t)S(15) << 15);
+	if (init)
+		f += W >> 1;
+	f = (f & 0x7FFFFFFF) + (f >> 31);
+	f = (f & 0x7FFFFFFF) + (f >> 31);
+	S(0) = (uint32_t)f;
+#undef S
+
+	return W ^ X3;
 }
 
-/* LFSR with work mode */
-static void LFSRWithWorkMode(ZUC_KEY *key)
+void zuc_load_lfsr(uint32_t s[16], const unsigned char *k,
+	const unsigned char *iv)
 {
-	uint32_t f, v;
-	f = key->LFSR_S0;
-	
-	v = MulByPow2(key->LFSR_S0, 8);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S4, 20);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S10, 21);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S13, 17);
-	f = AddM(f, v);
-	v = MulByPow2(key->LFSR_S15, 15);
-	f = AddM(f, v);
-	
-	/* update the state */
-	key->LFSR_S0 = key->LFSR_S1;
-	key->LFSR_S1 = key->LFSR_S2;
-	key->LFSR_S2 = key->LFSR_S3;
-	key->LFSR_S3 = key->LFSR_S4;
-	key->LFSR_S4 = key->LFSR_S5;
-	key->LFSR_S5 = key->LFSR_S6;
-	key->LFSR_S6 = key->LFSR_S7;
-	key->LFSR_S7 = key->LFSR_S8;
-	key->LFSR_S8 = key->LFSR_S9;
-	key->LFSR_S9 = key->LFSR_S10;
-	key->LFSR_S10 = key->LFSR_S11;
-	key->LFSR_S11 = key->LFSR_S12;
-	key->LFSR_S12 = key->LFSR_S13;
-	key->LFSR_S13 = key->LFSR_S14;
-	key->LFSR_S14 = key->LFSR_S15;
-	key->LFSR_S15 = f;
+	int i;
+	for (i = 0; i < 16; i++)
+		s[i] = MAKEU31(k[i], EK_d[i], iv[i]);
 }
 
-/* BitReorganization */
-static inline void BitReorganization(ZUC_KEY *key)
+void zuc_init(uint32_t s[16], uint32_t *R1, uint32_t *R2)
 {
-	key->BRC_X0 = ((key->LFSR_S15 & 0x7FFF8000) << 1) | (key->LFSR_S14 & 0xFFFF);
-	key->BRC_X1 = ((key->LFSR_S11 & 0xFFFF) << 16) | (key->LFSR_S9 >> 15);
-	key->BRC_X2 = ((key->LFSR_S7 & 0xFFFF) << 16) | (key->LFSR_S5 >> 15);
-	key->BRC_X3 = ((key->LFSR_S2 & 0xFFFF) << 16) | (key->LFSR_S0 >> 15);
+	uint32_t t[16], r1 = 0, r2 = 0;
+	int i;
+
+	memcpy(t, s, sizeof(t));
+	for (i = 0; i < 32; i++)
+		zuc_step(t, i, &r1, &r2, 1);
+	zuc_step(t, 32, &r1, &r2, 0);
+
+	/* 33 steps, s0 is now at t[1] */
+	for (i = 0; i < 16; i++)
+		s[i] = t[(i + 1) & 15];
+	*R1 = r1;
+	*R2 = r2;
 }
 
-#define ROT(a, k) (((a) << k) | ((a) >> (32 - k)))
-
-static inline uint32_t L1(uint32_t X)
+void zuc_keystream16(uint32_t s[16], uint32_t *R1, uint32_t *R2,
+	uint32_t Z[16])
 {
-	return (X ^ ROT(X, 2) ^ ROT(X, 10) ^ ROT(X, 18) ^ ROT(X, 24));
+	uint32_t t[16], r1 = *R1, r2 = *R2;
+
+	memcpy(t, s, sizeof(t));
+	Z[0] = zuc_step(t, 0, &r1, &r2, 0);
+	Z[1] = zuc_step(t, 1, &r1, &r2, 0);
+	Z[2] = zuc_step(t, 2, &r1, &r2, 0);
+	Z[3] = zuc_step(t, 3, &r1, &r2, 0);
+	Z[4] = zuc_step(t, 4, &r1, &r2, 0);
+	Z[5] = zuc_step(t, 5, &r1, &r2, 0);
+	Z[6] = zuc_step(t, 6, &r1, &r2, 0);
+	Z[7] = zuc_step(t, 7, &r1, &r2, 0);
+	Z[8] = zuc_step(t, 8, &r1, &r2, 0);
+	Z[9] = zuc_step(t, 9, &r1, &r2, 0);
+	Z[10] = zuc_step(t, 10, &r1, &r2, 0);
+	Z[11] = zuc_step(t, 11, &r1, &r2, 0);
+	Z[12] = zuc_step(t, 12, &r1, &r2, 0);
+	Z[13] = zuc_step(t, 13, &r1, &r2, 0);
+	Z[14] = zuc_step(t, 14, &r1, &r2, 0);
+	Z[15] = zuc_step(t, 15, &r1, &r2, 0);
+	memcpy(s, t, sizeof(t));
+	*R1 = r1;
+	*R2 = r2;
 }
 
-static inline uint32_t L2(uint32_t X)
+void ZUC_set_key(ZUC_KEY *key, const unsigned char *k, const unsigned char *iv)
 {
-	return (X ^ ROT(X, 8) ^ ROT(X, 14) ^ ROT(X, 22) ^ ROT(X, 30));
+	zuc_load_lfsr(key->LFSR, k, iv);
+	zuc_init(key->LFSR, &key->R1, &key->R2);
+	key->ks_pos = sizeof(key->ks);
 }
 
-#define MAKEuint32_t(a, b, c, d) (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | ((uint32_t)(d)))
+#define KS_BYTE(key, n)	((unsigned char)((key)->ks[(n) >> 2] >> (24 - 8 * ((n) & 3))))
 
-static uint32_t F(ZUC_KEY *key)
+void ZUC_encrypt(ZUC_KEY *key, size_t inlen, const unsigned char *in, unsigned char *out)
 {
-	uint32_t W, W1, W2, u, v;
-	
-	W  = (key->BRC_X0 ^ key->F_R1) + key->F_R2;
-	W1 = key->F_R1 + key->BRC_X1;
-	W2 = key->F_R2 ^ key->BRC_X2;
-	
-	u = L1((W1 << 16) | (W2 >> 16));
-	v = L2((W2 << 16) | (W1 >> 16));
-	
-	key->F_R1 = MAKEuint32_t(S0[u >> 24], S1[(u >> 16) & 0xFF], S0[(u >> 8) & 0xFF], S1[u & 0xFF]);
-	key->F_R2 = MAKEuint32_t(S0[v >> 24], S1[(v >> 16) & 0xFF], S0[(v >> 8) & 0xFF], S1[v & 0xFF]);
-	
-	return W;
-}
+	uint32_t Z[16];
+	unsigned int n = key->ks_pos;
+	int i;
 
-#define MAKEU31(a, b, c) (((uint32_t)(a) << 23) | ((uint32_t)(b) << 8) | (uint32_t)(c))
+	while (n < sizeof(key->ks) && inlen) {
+		*(out++) = *(in++) ^ KS_BYTE(key, n);
+		n++;
+		inlen--;
+	}
 
-void ZUC_set_key(ZUC_KEY *key, const unsigned char *k, const unsigned char *iv)
-{
-	uint32_t w, nCount;
-
-	key->LFSR_S0 = MAKEU31(k[0], EK_d[0], iv[0]);
-	key->LFSR_S1 = MAKEU31(k[1], EK_d[1], iv[1]);
-	key->LFSR_S2 = MAKEU31(k[2], EK_d[2], iv[2]);
-	key->LFSR_S3 = MAKEU31(k[3], EK_d[3], iv[3]);
-	key->LFSR_S4 = MAKEU31(k[4], EK_d[4], iv[4]);
-	key->LFSR_S5 = MAKEU31(k[5], EK_d[5], iv[5]);
-	key->LFSR_S6 = MAKEU31(k[6], EK_d[6], iv[6]);
-	key->LFSR_S7 = MAKEU31(k[7], EK_d[7], iv[7]);
-	key->LFSR_S8 = MAKEU31(k[8], EK_d[8], iv[8]);
-	key->LFSR_S9 = MAKEU31(k[9], EK_d[9], iv[9]);
-	key->LFSR_S10 = MAKEU31(k[10], EK_d[10], iv[10]);
-	key->LFSR_S11 = MAKEU31(k[11], EK_d[11], iv[11]);
-	key->LFSR_S12 = MAKEU31(k[12], EK_d[12], iv[12]);
-	key->LFSR_S13 = MAKEU31(k[13], EK_d[13], iv[13]);
-	key->LFSR_S14 = MAKEU31(k[14], EK_d[14], iv[14]);
-	key->LFSR_S15 = MAKEU31(k[15], EK_d[15], iv[15]);
-
-	key->F_R1 = 0;
-	key->F_R2 = 0;
-	nCount = 32;
-
-	while (nCount > 0) {
-		BitReorganization(key);
-		w = F(key);
-		LFSRWithInitialisationMode(key, w >> 1);
-		nCount--;
+	while (inlen >= sizeof(Z)) {
+		zuc_keystream16(key->LFSR, &key->R1, &key->R2, Z);
+		for (i = 0; i < 16; i++)
+			PUTU32(out + 4 * i, GETU32(in + 4 * i) ^ Z[i]);
+		inlen -= sizeof(Z);
+		in += sizeof(Z);
+		out += sizeof(Z);
 	}
 
-	BitReorganization(key);
-	F(key);
-	LFSRWithWorkMode(key);
+	if (inlen) {
+		zuc_keystream16(key->LFSR, &key->R1, &key->R2, key->ks);
+		for (n = 0; n < inlen; n++)
+			out[n] = in[n] ^ KS_BYTE(key, n);
+	}
 
+	key->ks_pos = n;
 }
 
-void ZUC_encrypt(ZUC_KEY *key, size_t inlen, const unsigned char *in, unsigned char *out)
+void ZUC_generate_keystream(ZUC_KEY *key, size_t nwords, uint32_t *words)
 {
-#if 0
-	uint32_t word;
-	int n = key->buf_index;
-
-	assert(n < 4);
+	unsigned int n = (key->ks_pos + 3) / 4;
 
-	while (n && inlen) {
-		*(out++) = *(in++) ^ key->buf[n];
-		n = (n + 1) % 4;
-		inlen--;
+	while (n < 16 && nwords) {
+		*(words++) = key->ks[n++];
+		nwords--;
 	}
-	
-	while (inlen >= 4) {
-		BitReorganization(key);
-		word = GETU32(in);
-		word ^= F(key) ^ key->BRC_X3;
-		PUTU32(out, word);
-		LFSRWithWorkMode(key);
-		inlen -= 4;
-		in += 4;
-		out += 4;
+
+	while (nwords >= 16) {
+		zuc_keystream16(key->LFSR, &key->R1, &key->R2, words);
+		nwords -= 16;
+		words += 16;
 	}
 
-	if (inlen) {
-		BitReorganization(key);
-		word = F(key) ^ key->BRC_X3;
-		LFSRWithWorkMode(key);
-		PUTU32(key->buf, word);
-		while (inlen-- > 0) {
-			out[n] = in[n] ^ key->buf[n];
-			n++;
-		}
+	if (nwords) {
+		zuc_keystream16(key->LFSR, &key->R1, &key->R2, key->ks);
+		for (n = 0; n < nwords; n++)
+			words[n] = key->ks[n];
 	}
 
-	key->buf_index = n;
-	return;
-#endif
+	key->ks_pos = n * 4;
 }
-
@@ -9,43 +9,106 @@ extern "C" {
 #endif
 
 
+/*
+ * The LFSR is a ring of 16 words, LFSR[0] is s0. The keystream is
+ * generated 16 words at a time, after which the ring is back in place,
+ * the words not yet used are kept in ks[].
+ */
 typedef struct {
-	uint32_t LFSR_S0;
-	uint32_t LFSR_S1;
-	uint32_t LFSR_S2;
-	uint32_t LFSR_S3;
-	uint32_t LFSR_S4;
-	uint32_t LFSR_S5;
-	uint32_t LFSR_S6;
-	uint32_t LFSR_S7;
-	uint32_t LFSR_S8;
-	uint32_t LFSR_S9;
-	uint32_t LFSR_S10;
-	uint32_t LFSR_S11;
-	uint32_t LFSR_S12;
-	uint32_t LFSR_S13;
-	uint32_t LFSR_S14;
-	uint32_t LFSR_S15;
+	uint32_t LFSR[16];
 
 	/* the registers of F */
-	uint32_t F_R1;
-	uint32_t F_R2;
-
-	/* the outputs of BitReorganization */
-	uint32_t BRC_X0;
-	uint32_t BRC_X1;
-	uint32_t BRC_X2;
-	uint32_t BRC_X3;
-
-	/* word buffer */
-	unsigned char buf[4];
-	int buf_index;
+	uint32_t R1;
+	uint32_t R2;
+
+	/* keystream buffer, ks_pos bytes of it are already used */
+	uint32_t ks[16];
+	unsigned int ks_pos;
 } ZUC_KEY;
 
 
 void ZUC_set_key(ZUC_KEY *key, const unsigned char *k, const unsigned char *iv);
 void ZUC_encrypt(ZUC_KEY *key, size_t inlen, const unsigned char *in, unsigned char *out);
+/* continues the keystream of ZUC_encrypt() from the next word boundary */
+void ZUC_generate_keystream(ZUC_KEY *key, size_t nwords, uint32_t *words);
+
+/*
+ * ZUC-256, the iv is 17 bytes followed by eight 6-bit values packed in
+ * 6 bytes. The key is then used with ZUC_encrypt() and
+ * ZUC_generate_keystream() as above. The MAC is 32, 64 or 128 bits long
+ * (macbits), other values are rejected.
+ */
+#define ZUC256_IV_LENGTH	23
+
+void ZUC256_set_key(ZUC_KEY *key, const unsigned char k[32],
+	const unsigned char iv[ZUC256_IV_LENGTH]);
+int ZUC256_generate_mac(const unsigned char k[32],
+	const unsigned char iv[ZUC256_IV_LENGTH], const unsigned char *data,
+	size_t nbits, int macbits, unsigned char *mac);
+
+
+/*
+ * multi-lane interface, generate the keystreams of up to ZUC_MB_LANES
+ * independent key/iv pairs in parallel SIMD lanes. The state is kept
+ * word-sliced, LFSR[i][lane].
+ */
+#define ZUC_MB_LANES		8
+
+typedef struct {
+	uint32_t LFSR[16][ZUC_MB_LANES];
+	uint32_t R1[ZUC_MB_LANES];
+	uint32_t R2[ZUC_MB_LANES];
+	uint32_t ks[16][ZUC_MB_LANES];
+	unsigned int ks_pos;
+} ZUC_MB_KEY;
+
+/* lanes with a NULL k are idle */
+void ZUC_mb_set_key(ZUC_MB_KEY *key, const unsigned char *k[ZUC_MB_LANES],
+	const unsigned char *iv[ZUC_MB_LANES]);
+/* writes nwords keystream words of every lane with a non NULL words[] */
+void ZUC_mb_generate_keystream(ZUC_MB_KEY *key, size_t nwords,
+	uint32_t *words[ZUC_MB_LANES]);
+/*
+ * same as ZUC_encrypt(key[i], len[i], in[i], out[i]) for i < n, the
+ * running keys are advanced in the lanes of a ZUC_MB_KEY
+ */
+void ZUC_encrypt_mb(ZUC_KEY *key[], const size_t len[],
+	const unsigned char *in[], unsigned char *out[], size_t n);
+
+
+/*
+ * 128-EEA3 and 128-EIA3 of 3GPP, the iv is built from COUNT, BEARER and
+ * DIRECTION, lengths are in bits. Bits of the last output byte beyond
+ * nbits are set to 0.
+ */
+void ZUC_eea3_set_key(ZUC_KEY *key, const unsigned char ck[16],
+	uint32_t count, uint32_t bearer, uint32_t direction);
+void ZUC_eea3_encrypt(const unsigned char ck[16], uint32_t count,
+	uint32_t bearer, uint32_t direction, const unsigned char *in,
+	size_t nbits, unsigned char *out);
+void ZUC_eia3_set_key(ZUC_KEY *key, const unsigned char ik[16],
+	uint32_t count, uint32_t bearer, uint32_t direction);
+uint32_t ZUC_eia3_generate_mac(const unsigned char ik[16], uint32_t count,
+	uint32_t bearer, uint32_t direction, const unsigned char *data,
+	size_t nbits);
+
+/*
+ * batch interface, the jobs are run ZUC_MB_LANES at a time in the lanes
+ * of ZUC_MB_KEY, jobs of similar lengths should be submitted together
+ */
+typedef struct {
+	const unsigned char *key;
+	uint32_t count;
+	uint32_t bearer;
+	uint32_t direction;
+	const unsigned char *in;
+	size_t nbits;
+	unsigned char *out;	/* EEA3 output */
+	uint32_t mac;		/* EIA3 output */
+} ZUC_MB_JOB;
 
+void ZUC_eea3_encrypt_mb(ZUC_MB_JOB *jobs, size_t njobs);
+void ZUC_eia3_generate_mac_mb(ZUC_MB_JOB *jobs, size_t njobs);
 
 
 #ifdef __cplusplus
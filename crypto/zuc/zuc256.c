@@ -0,0 +1,216 @@
+/* crypto/zuc/zuc256.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * ZUC-256: the 128-bit cipher with a 256-bit key and a 184-bit iv loaded
+ * with different constants, so the initialisation and the keystream are
+ * the ones of zuc.c. The MAC keeps a tag of t = 32, 64 or 128 bits, the
+ * window of the keystream at bit i + t is added for every set message
+ * bit i, one 32-bit word of the tag at a time as in 128-EIA3.
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include "../modes/modes_lcl.h"
+#include "zuc.h"
+#include "zuc_lcl.h"
+
+static const unsigned char ZUC256_D[16] = {
+	0x22, 0x2F, 0x24, 0x2A, 0x6D, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x52, 0x10, 0x30,
+};
+
+/* the constants of the MAC differ in d0 and d2 with the tag length */
+static const unsigned char ZUC256_MAC_D[3][16] = {
+	{0x22, 0x2F, 0x25, 0x2A, 0x6D, 0x40, 0x40, 0x40,
+	 0x40, 0x40, 0x40, 0x40, 0x40, 0x52, 0x10, 0x30},
+	{0x23, 0x2F, 0x24, 0x2A, 0x6D, 0x40, 0x40, 0x40,
+	 0x40, 0x40, 0x40, 0x40, 0x40, 0x52, 0x10, 0x30},
+	{0x23, 0x2F, 0x25, 0x2A, 0x6D, 0x40, 0x40, 0x40,
+	 0x40, 0x40, 0x40, 0x40, 0x40, 0x52, 0x10, 0x30},
+};
+
+#define MAKEU31(a, b, c, d) (((uint32_t)(a) << 23) | ((uint32_t)(b) << 16) | \
+		((uint32_t)(c) << 8) | (uint32_t)(d))
+
+void zuc256_load_lfsr(uint32_t s[16], const unsigned char *K,
+	const unsigned char *iv, const unsigned char *d)
+{
+	unsigned char IV[25];
+
+	/* IV17 to IV24 are 6 bits each */
+	memcpy(IV, iv, 17);
+	IV[17] = iv[17] >> 2;
+	IV[18] = ((iv[17] & 0x03) << 4) | (iv[18] >> 4);
+	IV[19] = ((iv[18] & 0x0F) << 2) | (iv[19] >> 6);
+	IV[20] = iv[19] & 0x3F;
+	IV[21] = iv[20] >> 2;
+	IV[22] = ((iv[20] & 0x03) << 4) | (iv[21] >> 4);
+	IV[23] = ((iv[21] & 0x0F) << 2) | (iv[22] >> 6);
+	IV[24] = iv[22] & 0x3F;
+
+	s[0] = MAKEU31(K[0], d[0], K[21], K[16]);
+	s[1] = MAKEU31(K[1], d[1], K[22], K[17]);
+	s[2] = MAKEU31(K[2], d[2], K[23], K[18]);
+	s[3] = MAKEU31(K[3], d[3], K[24], K[19]);
+	s[4] = MAKEU31(K[4], d[4], K[25], K[20]);
+	s[5] = MAKEU31(IV[0], d[5] | IV[17], K[5], K[26]);
+	s[6] = MAKEU31(IV[1], d[6] | IV[18], K[6], K[27]);
+	s[7] = MAKEU31(IV[10], d[7] | IV[19], K[7], IV[2]);
+	s[8] = MAKEU31(K[8], d[8] | IV[20], IV[3], IV[11]);
+	s[9] = MAKEU31(K[9], d[9] | IV[21], IV[12], IV[4]);
+	s[10] = MAKEU31(IV[5], d[10] | IV[22], K[10], K[28]);
+	s[11] = MAKEU31(K[11], d[11] | IV[23], IV[6], IV[13]);
+	s[12] = MAKEU31(K[12], d[12] | IV[24], IV[7], IV[14]);
+	s[13] = MAKEU31(K[13], d[13], IV[15], IV[8]);
+	s[14] = MAKEU31(K[14], d[14] | (K[31] >> 4), IV[16], IV[9]);
+	s[15] = MAKEU31(K[15], d[15] | (K[31] & 0x0F), K[30], K[29]);
+
+	OPENSSL_cleanse(IV, sizeof(IV));
+}
+
+void ZUC256_set_key(ZUC_KEY *key, const unsigned char k[32],
+	const unsigned char iv[ZUC256_IV_LENGTH])
+{
+	zuc256_load_lfsr(key->LFSR, k, iv, ZUC256_D);
+	zuc_init(key->LFSR, &key->R1, &key->R2);
+	key->ks_pos = sizeof(key->ks);
+}
+
+/*
+ * the keystream is read through a window w[0..WINDOW-1] = z[base..],
+ * advanced 16 words at a time, the last 2 * nt + 2 words are carried
+ */
+#define ZUC256_MAC_WINDOW	(16 + 2 * 4 + 2)
+
+int ZUC256_generate_mac(const unsigned char k[32],
+	const unsigned char iv[ZUC256_IV_LENGTH], const unsigned char *data,
+	size_t nbits, int macbits, unsigned char *mac)
+{
+	ZUC_KEY key;
+	uint32_t w[ZUC256_MAC_WINDOW], tag[4], m = 0;
+	size_t nfull = nbits / 32, base, end;
+	unsigned int rem = nbits % 32;
+	const unsigned char *d;
+	const uint32_t *z;
+	int nt, carry, j;
+
+	switch (macbits) {
+	case 32:
+		d = ZUC256_MAC_D[0];
+		break;
+	case 64:
+		d = ZUC256_MAC_D[1];
+		break;
+	case 128:
+		d = ZUC256_MAC_D[2];
+		break;
+	default:
+		return 0;
+	}
+	nt = macbits / 32;
+	carry = 2 * nt + 2;
+
+	zuc256_load_lfsr(key.LFSR, k, iv, d);
+	zuc_init(key.LFSR, &key.R1, &key.R2);
+	key.ks_pos = sizeof(key.ks);
+
+	/* the tag starts with the first t bits of the keystream */
+	ZUC_generate_keystream(&key, carry, w);
+	for (j = 0; j < nt; j++)
+		tag[j] = w[j];
+
+	if (rem) {
+		const unsigned char *p = data + 4 * nfull;
+		m = (uint32_t)p[0] << 24;
+		if (rem > 8)
+			m |= (uint32_t)p[1] << 16;
+		if (rem > 16)
+			m |= (uint32_t)p[2] << 8;
+		if (rem > 24)
+			m |= p[3];
+		m &= 0xFFFFFFFF << (32 - rem);
+	}
+
+	for (base = 0; ; base += 16) {
+		ZUC_generate_keystream(&key, 16, w + carry);
+
+		/* message word i needs z[i + nt + j] and z[i + nt + j + 1] */
+		if (base < nfull) {
+			end = nfull < base + 16 ? nfull : base + 16;
+			for (j = 0; j < nt; j++)
+				tag[j] = zuc_mac_words(tag[j], w + nt + j,
+					data + 4 * base, end - base);
+		}
+
+		/* the end needs up to z[nfull + 2 * nt] */
+		if (nfull + 2 * nt < base + 16 + carry) {
+			z = w + (nfull - base) + nt;
+			for (j = 0; j < nt; j++) {
+				if (rem) {
+					tag[j] ^= zuc_mac_mul(m, z[j], z[j + 1]);
+					tag[j] ^= (z[j] << rem) | (z[j + 1] >> (32 - rem));
+				} else
+					tag[j] ^= z[j];
+			}
+			break;
+		}
+		memmove(w, w + 16, carry * sizeof(w[0]));
+	}
+
+	for (j = 0; j < nt; j++)
+		PUTU32(mac + 4 * j, tag[j]);
+
+	OPENSSL_cleanse(&key, sizeof(key));
+	OPENSSL_cleanse(w, sizeof(w));
+	OPENSSL_cleanse(tag, sizeof(tag));
+	return 1;
+}
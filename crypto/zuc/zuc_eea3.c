@@ -0,0 +1,153 @@
+/* crypto/zuc/zuc_eea3.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include "../modes/modes_lcl.h"
+#include "zuc.h"
+#include "zuc_lcl.h"
+
+static void zuc_eea3_iv(uint32_t count, uint32_t bearer, uint32_t direction,
+	unsigned char iv[16])
+{
+	PUTU32(iv, count);
+	iv[4] = (unsigned char)(((bearer & 0x1F) << 3) | ((direction & 1) << 2));
+	iv[5] = iv[6] = iv[7] = 0;
+	memcpy(iv + 8, iv, 8);
+}
+
+void ZUC_eea3_set_key(ZUC_KEY *key, const unsigned char ck[16],
+	uint32_t count, uint32_t bearer, uint32_t direction)
+{
+	unsigned char iv[16];
+
+	zuc_eea3_iv(count, bearer, direction, iv);
+	ZUC_set_key(key, ck, iv);
+}
+
+void ZUC_eea3_encrypt(const unsigned char ck[16], uint32_t count,
+	uint32_t bearer, uint32_t direction, const unsigned char *in,
+	size_t nbits, unsigned char *out)
+{
+	ZUC_KEY key;
+	size_t len = (nbits + 7) / 8;
+
+	ZUC_eea3_set_key(&key, ck, count, bearer, direction);
+	ZUC_encrypt(&key, len, in, out);
+	if (nbits % 8)
+		out[len - 1] &= (unsigned char)(0xFF << (8 - nbits % 8));
+	OPENSSL_cleanse(&key, sizeof(key));
+}
+
+void ZUC_eea3_encrypt_mb(ZUC_MB_JOB *jobs, size_t njobs)
+{
+	const unsigned char *k[ZUC_MB_LANES], *iv[ZUC_MB_LANES];
+	unsigned char ivs[ZUC_MB_LANES][16];
+	uint32_t z[ZUC_MB_LANES][16], *pz[ZUC_MB_LANES];
+	ZUC_MB_KEY key;
+	ZUC_MB_JOB *job;
+	size_t len[ZUC_MB_LANES], maxlen, off, n, i;
+	int lane, nlanes;
+
+	for (; njobs; jobs += nlanes, njobs -= nlanes) {
+		nlanes = njobs < ZUC_MB_LANES ? (int)njobs : ZUC_MB_LANES;
+
+		maxlen = 0;
+		for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+			k[lane] = NULL;
+			pz[lane] = NULL;
+			len[lane] = 0;
+			if (lane >= nlanes)
+				continue;
+			job = &jobs[lane];
+			zuc_eea3_iv(job->count, job->bearer, job->direction, ivs[lane]);
+			k[lane] = job->key;
+			iv[lane] = ivs[lane];
+			len[lane] = (job->nbits + 7) / 8;
+			if (len[lane] > maxlen)
+				maxlen = len[lane];
+		}
+		ZUC_mb_set_key(&key, k, iv);
+
+		for (off = 0; off < maxlen; off += sizeof(z[0])) {
+			for (lane = 0; lane < nlanes; lane++)
+				pz[lane] = off < len[lane] ? z[lane] : NULL;
+			ZUC_mb_generate_keystream(&key, 16, pz);
+
+			for (lane = 0; lane < nlanes; lane++) {
+				const unsigned char *in;
+				unsigned char *out;
+
+				if (!pz[lane])
+					continue;
+				in = jobs[lane].in + off;
+				out = jobs[lane].out + off;
+				n = len[lane] - off;
+				if (n > sizeof(z[0]))
+					n = sizeof(z[0]);
+				for (i = 0; i + 4 <= n; i += 4)
+					PUTU32(out + i, GETU32(in + i) ^ z[lane][i / 4]);
+				for (; i < n; i++)
+					out[i] = in[i] ^ (unsigned char)(z[lane][i / 4] >> (24 - 8 * (i % 4)));
+			}
+		}
+
+		for (lane = 0; lane < nlanes; lane++) {
+			job = &jobs[lane];
+			if (job->nbits % 8)
+				job->out[len[lane] - 1] &=
+					(unsigned char)(0xFF << (8 - job->nbits % 8));
+		}
+	}
+
+	OPENSSL_cleanse(&key, sizeof(key));
+	OPENSSL_cleanse(z, sizeof(z));
+}
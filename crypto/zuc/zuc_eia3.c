@@ -0,0 +1,288 @@
+/* crypto/zuc/zuc_eia3.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * 128-EIA3. The tag is the xor of the 32-bit keystream windows starting
+ * at the set bits of the message. For a message word m and the keystream
+ * words z[i], z[i+1] the xor of its windows is bits 32..63 of the carry
+ * less product of z[i] || z[i+1] and m with its bits reversed, so the
+ * message is processed a word at a time, with PCLMULQDQ when available.
+ *
+ * The keystream is generated 16 words at a time into a window of 18
+ * words w[0..17] = z[base..base + 17], the last two words are carried to
+ * the next window.
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include "../modes/modes_lcl.h"
+#include "zuc.h"
+#include "zuc_lcl.h"
+
+#define EIA3_WINDOW	18
+
+static void zuc_eia3_iv(uint32_t count, uint32_t bearer, uint32_t direction,
+	unsigned char iv[16])
+{
+	PUTU32(iv, count);
+	iv[4] = (unsigned char)((bearer & 0x1F) << 3);
+	iv[5] = iv[6] = iv[7] = 0;
+	iv[8] = iv[0] ^ (unsigned char)((direction & 1) << 7);
+	memcpy(iv + 9, iv + 1, 5);
+	iv[14] = iv[6] ^ (unsigned char)((direction & 1) << 7);
+	iv[15] = iv[7];
+}
+
+void ZUC_eia3_set_key(ZUC_KEY *key, const unsigned char ik[16],
+	uint32_t count, uint32_t bearer, uint32_t direction)
+{
+	unsigned char iv[16];
+
+	zuc_eia3_iv(count, bearer, direction, iv);
+	ZUC_set_key(key, ik, iv);
+}
+
+/* the xor of the windows of z0 || z1 at the set bits of m */
+uint32_t zuc_mac_mul(uint32_t m, uint32_t z0, uint32_t z1)
+{
+	uint64_t k = ((uint64_t)z0 << 32) | z1;
+	uint32_t t = 0;
+	int i;
+
+	for (i = 0; i < 32; i++)
+		t ^= (uint32_t)((k << i) >> 32) & (0 - ((m >> (31 - i)) & 1));
+	return t;
+}
+
+static uint32_t eia3_words_c(uint32_t t, const uint32_t *w,
+	const unsigned char *data, size_t nwords)
+{
+	size_t i;
+
+	for (i = 0; i < nwords; i++)
+		t ^= zuc_mac_mul(GETU32(data + 4 * i), w[i], w[i + 1]);
+	return t;
+}
+
+#ifdef ZUC_AVX2
+# include <immintrin.h>
+
+# define ZUC_CLMUL_TARGET	__attribute__((target("pclmul,ssse3")))
+
+/*
+ * the bits of every byte are reversed with two nibble lookups, a little
+ * endian 32-bit load then gives the message word with its bits reversed
+ */
+ZUC_CLMUL_TARGET static uint32_t eia3_words_clmul(uint32_t t,
+	const uint32_t *w, const unsigned char *data, size_t nwords)
+{
+	const __m128i lo_rev = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C,
+		0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D,
+		0x03, 0x0B, 0x07, 0x0F);
+	const __m128i hi_rev = _mm_slli_epi32(lo_rev, 4);
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	__m128i acc = _mm_setzero_si128();
+	__m128i x, r01, r23, k01, k23;
+	size_t i;
+
+	for (i = 0; i + 4 <= nwords; i += 4) {
+		x = _mm_loadu_si128((const __m128i *)(data + 4 * i));
+		x = _mm_or_si128(
+			_mm_shuffle_epi8(hi_rev, _mm_and_si128(x, mask)),
+			_mm_shuffle_epi8(lo_rev, _mm_and_si128(_mm_srli_epi16(x, 4), mask)));
+		r01 = _mm_unpacklo_epi32(x, _mm_setzero_si128());
+		r23 = _mm_unpackhi_epi32(x, _mm_setzero_si128());
+
+		k01 = _mm_set_epi64x(
+			(long long)(((uint64_t)w[i + 1] << 32) | w[i + 2]),
+			(long long)(((uint64_t)w[i] << 32) | w[i + 1]));
+		k23 = _mm_set_epi64x(
+			(long long)(((uint64_t)w[i + 3] << 32) | w[i + 4]),
+			(long long)(((uint64_t)w[i + 2] << 32) | w[i + 3]));
+
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(k01, r01, 0x00));
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(k01, r01, 0x11));
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(k23, r23, 0x00));
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(k23, r23, 0x11));
+	}
+	t ^= (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(acc, 4));
+
+	return eia3_words_c(t, w + i, data + 4 * i, nwords - i);
+}
+#endif
+
+uint32_t zuc_mac_words(uint32_t t, const uint32_t *w,
+	const unsigned char *data, size_t nwords)
+{
+#ifdef ZUC_AVX2
+	if (ZUC_CLMUL_CAPABLE)
+		return eia3_words_clmul(t, w, data, nwords);
+#endif
+	return eia3_words_c(t, w, data, nwords);
+}
+
+/*
+ * process the message words covered by the window w = z[base..base + 17],
+ * return 1 and the tag once the keystream of the end of the message is
+ * in the window
+ */
+static int eia3_window(uint32_t *t, const uint32_t w[EIA3_WINDOW],
+	size_t base, const unsigned char *data, size_t nbits)
+{
+	size_t nfull = nbits / 32, end;
+	unsigned int rem = nbits % 32;
+	const uint32_t *z;
+	uint32_t m;
+
+	if (base < nfull) {
+		end = nfull < base + 16 ? nfull : base + 16;
+		*t = zuc_mac_words(*t, w, data + 4 * base, end - base);
+	}
+	if (nfull + 2 > base + EIA3_WINDOW - 1)
+		return 0;
+
+	z = w + (nfull - base);
+	if (rem) {
+		data += 4 * nfull;
+		m = (uint32_t)data[0] << 24;
+		if (rem > 8)
+			m |= (uint32_t)data[1] << 16;
+		if (rem > 16)
+			m |= (uint32_t)data[2] << 8;
+		if (rem > 24)
+			m |= data[3];
+		m &= 0xFFFFFFFF << (32 - rem);
+		*t ^= zuc_mac_mul(m, z[0], z[1]);
+		*t ^= (z[0] << rem) | (z[1] >> (32 - rem));
+		*t ^= z[2];
+	} else {
+		*t ^= z[0] ^ z[1];
+	}
+	return 1;
+}
+
+uint32_t ZUC_eia3_generate_mac(const unsigned char ik[16], uint32_t count,
+	uint32_t bearer, uint32_t direction, const unsigned char *data,
+	size_t nbits)
+{
+	ZUC_KEY key;
+	uint32_t w[EIA3_WINDOW], t = 0;
+	size_t base;
+
+	ZUC_eia3_set_key(&key, ik, count, bearer, direction);
+	ZUC_generate_keystream(&key, 2, w);
+	for (base = 0; ; base += 16) {
+		ZUC_generate_keystream(&key, 16, w + 2);
+		if (eia3_window(&t, w, base, data, nbits))
+			break;
+		w[0] = w[16];
+		w[1] = w[17];
+	}
+
+	OPENSSL_cleanse(&key, sizeof(key));
+	OPENSSL_cleanse(w, sizeof(w));
+	return t;
+}
+
+void ZUC_eia3_generate_mac_mb(ZUC_MB_JOB *jobs, size_t njobs)
+{
+	const unsigned char *k[ZUC_MB_LANES], *iv[ZUC_MB_LANES];
+	unsigned char ivs[ZUC_MB_LANES][16];
+	uint32_t w[ZUC_MB_LANES][EIA3_WINDOW], *pw[ZUC_MB_LANES];
+	uint32_t t[ZUC_MB_LANES];
+	int done[ZUC_MB_LANES];
+	ZUC_MB_KEY key;
+	ZUC_MB_JOB *job;
+	size_t base;
+	int lane, nlanes, left;
+
+	for (; njobs; jobs += nlanes, njobs -= nlanes) {
+		nlanes = njobs < ZUC_MB_LANES ? (int)njobs : ZUC_MB_LANES;
+
+		for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+			k[lane] = NULL;
+			pw[lane] = NULL;
+			if (lane >= nlanes)
+				continue;
+			job = &jobs[lane];
+			zuc_eia3_iv(job->count, job->bearer, job->direction, ivs[lane]);
+			k[lane] = job->key;
+			iv[lane] = ivs[lane];
+			pw[lane] = w[lane];
+			t[lane] = 0;
+			done[lane] = 0;
+		}
+		ZUC_mb_set_key(&key, k, iv);
+		ZUC_mb_generate_keystream(&key, 2, pw);
+
+		for (base = 0, left = nlanes; left; base += 16) {
+			for (lane = 0; lane < nlanes; lane++)
+				pw[lane] = done[lane] ? NULL : w[lane] + 2;
+			ZUC_mb_generate_keystream(&key, 16, pw);
+
+			for (lane = 0; lane < nlanes; lane++) {
+				if (done[lane])
+					continue;
+				job = &jobs[lane];
+				if (eia3_window(&t[lane], w[lane], base, job->in, job->nbits)) {
+					job->mac = t[lane];
+					done[lane] = 1;
+					left--;
+				}
+				w[lane][0] = w[lane][16];
+				w[lane][1] = w[lane][17];
+			}
+		}
+	}
+
+	OPENSSL_cleanse(&key, sizeof(key));
+	OPENSSL_cleanse(w, sizeof(w));
+}
@@ -0,0 +1,101 @@
+/* crypto/zuc/zuc_lcl.h */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ */
+
+#ifndef HEADER_ZUC_LCL_H
+#define HEADER_ZUC_LCL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * the S-boxes are padded so that a 32-bit load (or gather) at any index
+ * stays inside the table, only the low byte of such a load is used
+ */
+extern const uint8_t ZUC_S0[256 + 4];
+extern const uint8_t ZUC_S1[256 + 4];
+
+/* s[i] = k[i] || d[i] || iv[i] */
+void zuc_load_lfsr(uint32_t s[16], const unsigned char *k,
+	const unsigned char *iv);
+/* 32 steps of initialisation mode and the first step of work mode */
+void zuc_init(uint32_t s[16], uint32_t *R1, uint32_t *R2);
+/* 16 keystream words, the ring is back in place afterwards */
+void zuc_keystream16(uint32_t s[16], uint32_t *R1, uint32_t *R2,
+	uint32_t Z[16]);
+/* s[i] = a || d[i] || c || b, ZUC-256 layout with a 25 value iv */
+void zuc256_load_lfsr(uint32_t s[16], const unsigned char *k,
+	const unsigned char *iv, const unsigned char *d);
+
+/*
+ * the xor of the 32-bit windows of z0 || z1 at the set bits of m, and
+ * the same summed over nwords message words with keystream w[0..nwords]
+ */
+uint32_t zuc_mac_mul(uint32_t m, uint32_t z0, uint32_t z1);
+uint32_t zuc_mac_words(uint32_t t, const uint32_t *w,
+	const unsigned char *data, size_t nwords);
+
+#if !defined(OPENSSL_NO_ASM) && defined(__GNUC__) && \
+	(defined(__x86_64) || defined(__x86_64__))
+# define ZUC_AVX2
+extern unsigned int OPENSSL_ia32cap_P[];
+# define ZUC_AVX2_CAPABLE	(OPENSSL_ia32cap_P[2] & (1 << 5))
+/* PCLMULQDQ and SSSE3 */
+# define ZUC_CLMUL_CAPABLE	((OPENSSL_ia32cap_P[1] & ((1 << 1) | (1 << 9))) \
+	== ((1 << 1) | (1 << 9)))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif
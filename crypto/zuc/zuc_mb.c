@@ -0,0 +1,370 @@
+/* crypto/zuc/zuc_mb.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+/*
+ * Multi-lane ZUC: ZUC_MB_LANES independent key/iv pairs are run in lock
+ * step, each 32-bit lane of a vector register carries one LFSR word of
+ * one lane, so a step of the AVX2 code is a step of all 8 ciphers. The
+ * S-boxes are read with gathers of the padded byte tables.
+ */
+
+#include <string.h>
+#include <openssl/crypto.h>
+#include "../modes/modes_lcl.h"
+#include "zuc.h"
+#include "zuc_lcl.h"
+
+#ifdef ZUC_AVX2
+# include <immintrin.h>
+
+# define ZUC_AVX2_TARGET	__attribute__((target("avx2")))
+# define ZUC_AVX2_INLINE	static inline __attribute__((always_inline, target("avx2")))
+
+# define VROT(x, k) \
+	_mm256_or_si256(_mm256_slli_epi32((x), (k)), _mm256_srli_epi32((x), 32 - (k)))
+# define VROT31(x, k) _mm256_and_si256(_mm256_or_si256( \
+	_mm256_slli_epi32((x), (k)), _mm256_srli_epi32((x), 31 - (k))), M31)
+# define VL1(x) _mm256_xor_si256(_mm256_xor_si256((x), VROT((x), 2)), \
+	_mm256_xor_si256(_mm256_xor_si256(VROT((x), 10), VROT((x), 18)), VROT((x), 24)))
+# define VL2(x) _mm256_xor_si256(_mm256_xor_si256((x), VROT((x), 8)), \
+	_mm256_xor_si256(_mm256_xor_si256(VROT((x), 14), VROT((x), 22)), VROT((x), 30)))
+# define M31	_mm256_set1_epi32(0x7FFFFFFF)
+
+/* a + b mod 2^31 - 1 for a, b in [1, 2^31 - 1] */
+ZUC_AVX2_INLINE __m256i zuc_avx2_addm(__m256i a, __m256i b)
+{
+	__m256i c = _mm256_add_epi32(a, b);
+	return _mm256_add_epi32(_mm256_and_si256(c, M31), _mm256_srli_epi32(c, 31));
+}
+
+ZUC_AVX2_INLINE __m256i zuc_avx2_sbox(__m256i x)
+{
+	const __m256i ff = _mm256_set1_epi32(0xFF);
+	__m256i b3, b2, b1, b0;
+
+	b3 = _mm256_srli_epi32(x, 24);
+	b2 = _mm256_and_si256(_mm256_srli_epi32(x, 16), ff);
+	b1 = _mm256_and_si256(_mm256_srli_epi32(x, 8), ff);
+	b0 = _mm256_and_si256(x, ff);
+
+	b3 = _mm256_i32gather_epi32((const int *)ZUC_S0, b3, 1);
+	b2 = _mm256_i32gather_epi32((const int *)ZUC_S1, b2, 1);
+	b1 = _mm256_i32gather_epi32((const int *)ZUC_S0, b1, 1);
+	b0 = _mm256_i32gather_epi32((const int *)ZUC_S1, b0, 1);
+
+	b3 = _mm256_slli_epi32(b3, 24);
+	b2 = _mm256_slli_epi32(_mm256_and_si256(b2, ff), 16);
+	b1 = _mm256_slli_epi32(_mm256_and_si256(b1, ff), 8);
+	b0 = _mm256_and_si256(b0, ff);
+	return _mm256_or_si256(_mm256_or_si256(b3, b2), _mm256_or_si256(b1, b0));
+}
+
+/* the step of zuc.c on 8 lanes, s0 is at s[i & 15] */
+ZUC_AVX2_INLINE __m256i zuc_avx2_step(__m256i s[16], int i,
+	__m256i *R1, __m256i *R2, int init)
+{
+#define S(j)	s[(i + (j)) & 15]
+	const __m256i lo16 = _mm256_set1_epi32(0xFFFF);
+	__m256i X0, X1, X2, X3, W, W1, W2, u, v, f;
+
+	X0 = _mm256_or_si256(
+		_mm256_slli_epi32(_mm256_and_si256(S(15), _mm256_set1_epi32(0x7FFF8000)), 1),
+		_mm256_and_si256(S(14), lo16));
+	X1 = _mm256_or_si256(_mm256_slli_epi32(S(11), 16), _mm256_srli_epi32(S(9), 15));
+	X2 = _mm256_or_si256(_mm256_slli_epi32(S(7), 16), _mm256_srli_epi32(S(5), 15));
+	X3 = _mm256_or_si256(_mm256_slli_epi32(S(2), 16), _mm256_srli_epi32(S(0), 15));
+
+	W  = _mm256_add_epi32(_mm256_xor_si256(X0, *R1), *R2);
+	W1 = _mm256_add_epi32(*R1, X1);
+	W2 = _mm256_xor_si256(*R2, X2);
+	u = _mm256_or_si256(_mm256_slli_epi32(W1, 16), _mm256_srli_epi32(W2, 16));
+	v = _mm256_or_si256(_mm256_slli_epi32(W2, 16), _mm256_srli_epi32(W1, 16));
+	*R1 = zuc_avx2_sbox(VL1(u));
+	*R2 = zuc_avx2_sbox(VL2(v));
+
+	f = zuc_avx2_addm(S(0), VROT31(S(0), 8));
+	f = zuc_avx2_addm(f, VROT31(S(4), 20));
+	f = zuc_avx2_addm(f, VROT31(S(10), 21));
+	f = zuc_avx2_addm(f, VROT31(S(13), 17));
+	f = zuc_avx2_addm(f, VROT31(S(15), 15));
+	if (init)
+		f = zuc_avx2_addm(f, _mm256_srli_epi32(W, 1));
+	S(0) = f;
+#undef S
+
+	return _mm256_xor_si256(W, X3);
+}
+
+ZUC_AVX2_TARGET static void zuc_mb_init_avx2(ZUC_MB_KEY *key)
+{
+	__m256i s[16], R1, R2;
+	int i;
+
+	for (i = 0; i < 16; i++)
+		s[i] = _mm256_loadu_si256((const __m256i *)key->LFSR[i]);
+	R1 = R2 = _mm256_setzero_si256();
+
+	for (i = 0; i < 32; i++)
+		zuc_avx2_step(s, i, &R1, &R2, 1);
+	zuc_avx2_step(s, 32, &R1, &R2, 0);
+
+	for (i = 0; i < 16; i++)
+		_mm256_storeu_si256((__m256i *)key->LFSR[i], s[(i + 1) & 15]);
+	_mm256_storeu_si256((__m256i *)key->R1, R1);
+	_mm256_storeu_si256((__m256i *)key->R2, R2);
+}
+
+ZUC_AVX2_TARGET static void zuc_mb_keystream16_avx2(ZUC_MB_KEY *key)
+{
+	__m256i s[16], R1, R2;
+	int i;
+
+	for (i = 0; i < 16; i++)
+		s[i] = _mm256_loadu_si256((const __m256i *)key->LFSR[i]);
+	R1 = _mm256_loadu_si256((const __m256i *)key->R1);
+	R2 = _mm256_loadu_si256((const __m256i *)key->R2);
+
+# define STEP(i) _mm256_storeu_si256((__m256i *)key->ks[i], \
+	zuc_avx2_step(s, i, &R1, &R2, 0))
+	STEP(0);  STEP(1);  STEP(2);  STEP(3);
+	STEP(4);  STEP(5);  STEP(6);  STEP(7);
+	STEP(8);  STEP(9);  STEP(10); STEP(11);
+	STEP(12); STEP(13); STEP(14); STEP(15);
+# undef STEP
+
+	for (i = 0; i < 16; i++)
+		_mm256_storeu_si256((__m256i *)key->LFSR[i], s[i]);
+	_mm256_storeu_si256((__m256i *)key->R1, R1);
+	_mm256_storeu_si256((__m256i *)key->R2, R2);
+}
+#endif
+
+static void zuc_mb_keystream16(ZUC_MB_KEY *key)
+{
+	uint32_t s[16], Z[16];
+	int lane, i;
+
+#ifdef ZUC_AVX2
+	if (ZUC_AVX2_CAPABLE) {
+		zuc_mb_keystream16_avx2(key);
+		return;
+	}
+#endif
+	for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+		for (i = 0; i < 16; i++)
+			s[i] = key->LFSR[i][lane];
+		zuc_keystream16(s, &key->R1[lane], &key->R2[lane], Z);
+		for (i = 0; i < 16; i++) {
+			key->LFSR[i][lane] = s[i];
+			key->ks[i][lane] = Z[i];
+		}
+	}
+}
+
+void ZUC_mb_set_key(ZUC_MB_KEY *key, const unsigned char *k[ZUC_MB_LANES],
+	const unsigned char *iv[ZUC_MB_LANES])
+{
+	static const unsigned char zero[16];
+	uint32_t s[16];
+	int lane, i;
+
+	for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+		if (k[lane])
+			zuc_load_lfsr(s, k[lane], iv[lane]);
+		else
+			zuc_load_lfsr(s, zero, zero);
+		for (i = 0; i < 16; i++)
+			key->LFSR[i][lane] = s[i];
+	}
+	key->ks_pos = 16;
+
+#ifdef ZUC_AVX2
+	if (ZUC_AVX2_CAPABLE) {
+		zuc_mb_init_avx2(key);
+		return;
+	}
+#endif
+	for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+		for (i = 0; i < 16; i++)
+			s[i] = key->LFSR[i][lane];
+		zuc_init(s, &key->R1[lane], &key->R2[lane]);
+		for (i = 0; i < 16; i++)
+			key->LFSR[i][lane] = s[i];
+	}
+}
+
+void ZUC_mb_generate_keystream(ZUC_MB_KEY *key, size_t nwords,
+	uint32_t *words[ZUC_MB_LANES])
+{
+	unsigned int n = key->ks_pos;
+	size_t done = 0, m, i;
+	int lane;
+
+	while (nwords) {
+		if (n == 16) {
+			zuc_mb_keystream16(key);
+			n = 0;
+		}
+		m = 16 - n < nwords ? 16 - n : nwords;
+		for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+			if (!words[lane])
+				continue;
+			for (i = 0; i < m; i++)
+				words[lane][done + i] = key->ks[n + i][lane];
+		}
+		n += m;
+		done += m;
+		nwords -= m;
+	}
+
+	key->ks_pos = n;
+}
+
+#ifdef ZUC_AVX2
+static void zuc_encrypt_lanes(ZUC_KEY *key[], const size_t len[],
+	const unsigned char *in[], unsigned char *out[], size_t n)
+{
+	ZUC_MB_KEY mb;
+	const unsigned char *pin[ZUC_MB_LANES];
+	unsigned char *pout[ZUC_MB_LANES];
+	size_t left[ZUC_MB_LANES], m, j;
+	ZUC_KEY *k;
+	int lanes, active, lane, i;
+
+	for (; n; key += lanes, len += lanes, in += lanes, out += lanes,
+		n -= lanes) {
+		lanes = n < ZUC_MB_LANES ? (int)n : ZUC_MB_LANES;
+
+		/* use up the buffered keystream, then move the rest to the lanes */
+		memset(&mb, 0, sizeof(mb));
+		active = 0;
+		for (lane = 0; lane < lanes; lane++) {
+			k = key[lane];
+			m = sizeof(k->ks) - k->ks_pos;
+			if (m > len[lane])
+				m = len[lane];
+			ZUC_encrypt(k, m, in[lane], out[lane]);
+			left[lane] = len[lane] - m;
+			pin[lane] = in[lane] + m;
+			pout[lane] = out[lane] + m;
+			if (!left[lane])
+				continue;
+			for (i = 0; i < 16; i++)
+				mb.LFSR[i][lane] = k->LFSR[i];
+			mb.R1[lane] = k->R1;
+			mb.R2[lane] = k->R2;
+			active++;
+		}
+		for (; lane < ZUC_MB_LANES; lane++)
+			left[lane] = 0;
+
+		if (active == 1) {
+			for (lane = 0; lane < lanes; lane++) {
+				if (left[lane])
+					ZUC_encrypt(key[lane], left[lane], pin[lane],
+						pout[lane]);
+			}
+			continue;
+		}
+
+		/*
+		 * a lane is copied back when its last chunk is generated, it
+		 * keeps running idle afterwards
+		 */
+		while (active) {
+			zuc_mb_keystream16(&mb);
+			for (lane = 0; lane < lanes; lane++) {
+				if (!left[lane])
+					continue;
+				m = left[lane] < 64 ? left[lane] : 64;
+				for (j = 0; j + 4 <= m; j += 4)
+					PUTU32(pout[lane] + j, GETU32(pin[lane] + j)
+						^ mb.ks[j / 4][lane]);
+				for (; j < m; j++)
+					pout[lane][j] = pin[lane][j] ^ (unsigned char)
+						(mb.ks[j / 4][lane] >> (24 - 8 * (j % 4)));
+				left[lane] -= m;
+				pin[lane] += m;
+				pout[lane] += m;
+				if (left[lane])
+					continue;
+
+				k = key[lane];
+				for (i = 0; i < 16; i++) {
+					k->LFSR[i] = mb.LFSR[i][lane];
+					k->ks[i] = mb.ks[i][lane];
+				}
+				k->R1 = mb.R1[lane];
+				k->R2 = mb.R2[lane];
+				k->ks_pos = (unsigned int)m;
+				active--;
+			}
+		}
+	}
+	OPENSSL_cleanse(&mb, sizeof(mb));
+}
+#endif
+
+void ZUC_encrypt_mb(ZUC_KEY *key[], const size_t len[],
+	const unsigned char *in[], unsigned char *out[], size_t n)
+{
+	size_t i;
+
+#ifdef ZUC_AVX2
+	if (ZUC_AVX2_CAPABLE) {
+		zuc_encrypt_lanes(key, len, in, out, n);
+		return;
+	}
+#endif
+	/* without AVX2 the lanes are run one by one anyway */
+	for (i = 0; i < n; i++)
+		ZUC_encrypt(key[i], len[i], in[i], out[i]);
+}
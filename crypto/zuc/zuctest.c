@@ -0,0 +1,514 @@
+/* crypto/zuc/zuctest.c */
+/* ====================================================================
+ * Copyright (c) 2014 - 2016 The GmSSL Project.  All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgment:
+ *    "This product includes software developed by the GmSSL Project.
+ *    (http://gmssl.org/)"
+ *
+ * 4. The name "GmSSL Project" must not be used to endorse or promote
+ *    products derived from this software without prior written
+ *    permission. For written permission, please contact
+ *    guanzhi1980@gmail.com.
+ *
+ * 5. Products derived from this software may not be called "GmSSL"
+ *    nor may "GmSSL" appear in their names without prior written
+ *    permission of the GmSSL Project.
+ *
+ * 6. Redistributions of any form whatsoever must retain the following
+ *    acknowledgment:
+ *    "This product includes software developed by the GmSSL Project
+ *    (http://gmssl.org/)"
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE GmSSL PROJECT ``AS IS'' AND ANY
+ * EXPRESSED OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE GmSSL PROJECT OR
+ * ITS CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+ * NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ====================================================================
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "../e_os.h"
+
+#ifdef OPENSSL_NO_ZUC
+int main(int argc, char *argv[])
+{
+    printf("No ZUC support\n");
+    return (0);
+}
+#else
+# include <openssl/err.h>
+# include <openssl/evp.h>
+# include <openssl/zuc.h>
+
+/* test sets of the ZUC specification, z1, z2 and the last word */
+static struct {
+    const char *key;
+    const char *iv;
+    size_t nwords;
+    uint32_t z1, z2, zn;
+} test[] = {
+    {"00000000000000000000000000000000",
+     "00000000000000000000000000000000",
+     2, 0x27bede74, 0x018082da, 0x018082da},
+    {"ffffffffffffffffffffffffffffffff",
+     "ffffffffffffffffffffffffffffffff",
+     2, 0x0657cfa0, 0x7096398b, 0x7096398b},
+    {"3d4c4be96a82fdaeb58f641db17b455b",
+     "84319aa8de6915ca1f6bda6bfbd8c766",
+     2, 0x14f1c272, 0x3279c419, 0x3279c419},
+    {"4d320bfad4c285bfd6b8bd00f39d8b41",
+     "52959daba0bf176ece2dc315049eb574",
+     2000, 0xed4400e7, 0x0633e5c5, 0x7a574cdb},
+};
+
+#define NTESTS (sizeof(test) / sizeof(test[0]))
+
+static void hex2bin(const char *hex, unsigned char *bin)
+{
+    unsigned int v;
+
+    while (*hex) {
+        sscanf(hex, "%2x", &v);
+        *bin++ = (unsigned char)v;
+        hex += 2;
+    }
+}
+
+static int test_zuc_vectors(void)
+{
+    unsigned char k[16], iv[16];
+    uint32_t z[2000];
+    ZUC_KEY key;
+    size_t i;
+    int err = 0;
+
+    for (i = 0; i < NTESTS; i++) {
+        hex2bin(test[i].key, k);
+        hex2bin(test[i].iv, iv);
+        ZUC_set_key(&key, k, iv);
+        ZUC_generate_keystream(&key, test[i].nwords, z);
+        if (z[0] != test[i].z1 || z[1] != test[i].z2 ||
+            z[test[i].nwords - 1] != test[i].zn) {
+            printf("error in ZUC test set %d\n", (int)i + 1);
+            err++;
+        } else
+            printf("test %d ok\n", (int)i + 1);
+    }
+    return err;
+}
+
+/*
+ * encrypt in pieces of odd lengths, mixed with ZUC_generate_keystream(),
+ * and compare with the keystream generated in one call
+ */
+static int test_zuc_stream(void)
+{
+    unsigned char k[16], iv[16];
+    unsigned char buf[1000], out[1000];
+    uint32_t z[250], w;
+    ZUC_KEY key;
+    size_t i, n, len;
+
+    hex2bin(test[3].key, k);
+    hex2bin(test[3].iv, iv);
+    ZUC_set_key(&key, k, iv);
+    ZUC_generate_keystream(&key, 250, z);
+
+    for (len = 1; len <= 131; len += 13) {
+        memset(buf, 0, sizeof(buf));
+        ZUC_set_key(&key, k, iv);
+        for (i = 0; i < sizeof(buf); i += n) {
+            n = len < sizeof(buf) - i ? len : sizeof(buf) - i;
+            ZUC_encrypt(&key, n, buf + i, out + i);
+        }
+        for (i = 0; i < sizeof(buf); i++) {
+            if (out[i] != (unsigned char)(z[i / 4] >> (24 - 8 * (i % 4)))) {
+                printf("error in ZUC encryption of %d byte pieces\n", (int)len);
+                return 1;
+            }
+        }
+    }
+
+    /* a partly used word is skipped by ZUC_generate_keystream() */
+    ZUC_set_key(&key, k, iv);
+    ZUC_encrypt(&key, 5, buf, out);
+    ZUC_generate_keystream(&key, 1, &w);
+    if (w != z[2]) {
+        printf("error in ZUC keystream after encryption\n");
+        return 1;
+    }
+
+    printf("stream test ok\n");
+    return 0;
+}
+
+/* compare the lanes of the multi-lane generator with ZUC_KEY */
+static int test_zuc_mb(void)
+{
+    unsigned char k[ZUC_MB_LANES][16], iv[ZUC_MB_LANES][16];
+    const unsigned char *pk[ZUC_MB_LANES], *piv[ZUC_MB_LANES];
+    uint32_t z[ZUC_MB_LANES][200], ref[200];
+    uint32_t *pz[ZUC_MB_LANES];
+    ZUC_MB_KEY mbkey;
+    ZUC_KEY key;
+    size_t i, j, n;
+    int lane;
+
+    for (lane = 0; lane < ZUC_MB_LANES; lane++) {
+        for (i = 0; i < 16; i++) {
+            k[lane][i] = (unsigned char)(lane * 37 + i * 11);
+            iv[lane][i] = (unsigned char)(lane * 91 + i * 3 + 1);
+        }
+        /* the last lane is idle */
+        pk[lane] = lane < ZUC_MB_LANES - 1 ? k[lane] : NULL;
+        piv[lane] = iv[lane];
+        pz[lane] = z[lane];
+    }
+
+    ZUC_mb_set_key(&mbkey, pk, piv);
+    for (i = 0, n = 1; i < 200; i += n, n += 7) {
+        if (n > 200 - i)
+            n = 200 - i;
+        for (lane = 0; lane < ZUC_MB_LANES; lane++)
+            pz[lane] = z[lane] + i;
+        ZUC_mb_generate_keystream(&mbkey, n, pz);
+    }
+
+    for (lane = 0; lane < ZUC_MB_LANES - 1; lane++) {
+        ZUC_set_key(&key, k[lane], iv[lane]);
+        ZUC_generate_keystream(&key, 200, ref);
+        for (j = 0; j < 200; j++) {
+            if (z[lane][j] != ref[j]) {
+                printf("error in multi-lane ZUC lane %d word %d\n",
+                       lane, (int)j);
+                return 1;
+            }
+        }
+    }
+    printf("multi-lane test ok\n");
+    return 0;
+}
+
+/* 128-EEA3 test set 1 and 128-EIA3 test sets 1 to 3 of 3GPP */
+static struct {
+    const char *key;
+    uint32_t count, bearer, direction;
+    size_t nbits;
+    const char *in;
+    const char *out;
+} eea3_test[] = {
+    {"173d14ba5003731d7a60049470f00a29", 0x66035492, 0xf, 0, 193,
+     "6cf65340735552ab0c9752fa6f9025fe0bd675d9005875b200000000",
+     "a6c85fc66afb8533aafc2518dfe784940ee1e4b030238cc800000000"},
+};
+
+static struct {
+    const char *key;
+    uint32_t count, bearer, direction;
+    size_t nbits;
+    const char *in;
+    uint32_t mac;
+} eia3_test[] = {
+    {"00000000000000000000000000000000", 0, 0, 0, 1,
+     "00000000", 0xc8a9595e},
+    {"47054125561eb2dda94059da05097850", 0x561eb2dd, 0x14, 0, 90,
+     "000000000000000000000000", 0x6719a088},
+    {"c9e6cec4607c72db000aefa88385ab0a", 0xa94059da, 0xa, 1, 577,
+     "983b41d47d780c9e1ad11d7eb70391b1de0b35da2dc62f83e7b78d6306ca0ea0"
+     "7e941b7be91348f9fcb170e2217fecd97f9f68adb16e5d7d21e569d280ed775c"
+     "ebde3f4093c5388100000000", 0xfae8ff0b},
+};
+
+static int test_zuc_3gpp(void)
+{
+    unsigned char k[16], in[100], out[100], buf[100];
+    size_t i, len;
+    int err = 0;
+
+    for (i = 0; i < sizeof(eea3_test) / sizeof(eea3_test[0]); i++) {
+        hex2bin(eea3_test[i].key, k);
+        hex2bin(eea3_test[i].in, in);
+        hex2bin(eea3_test[i].out, out);
+        len = (eea3_test[i].nbits + 7) / 8;
+        ZUC_eea3_encrypt(k, eea3_test[i].count, eea3_test[i].bearer,
+                         eea3_test[i].direction, in, eea3_test[i].nbits, buf);
+        if (memcmp(buf, out, len) != 0) {
+            printf("error in 128-EEA3 test set %d\n", (int)i + 1);
+            err++;
+        } else
+            printf("128-EEA3 test %d ok\n", (int)i + 1);
+    }
+
+    for (i = 0; i < sizeof(eia3_test) / sizeof(eia3_test[0]); i++) {
+        hex2bin(eia3_test[i].key, k);
+        hex2bin(eia3_test[i].in, in);
+        if (ZUC_eia3_generate_mac(k, eia3_test[i].count, eia3_test[i].bearer,
+                                  eia3_test[i].direction, in,
+                                  eia3_test[i].nbits) != eia3_test[i].mac) {
+            printf("error in 128-EIA3 test set %d\n", (int)i + 1);
+            err++;
+        } else
+            printf("128-EIA3 test %d ok\n", (int)i + 1);
+    }
+    return err;
+}
+
+/* a batch of bearers of different bit lengths against the one-shot calls */
+static int test_zuc_3gpp_mb(void)
+{
+    unsigned char key[19][16], in[19][300], out[19][300], ref[300];
+    ZUC_MB_JOB jobs[19];
+    size_t i, j, len;
+
+    for (i = 0; i < 19; i++) {
+        for (j = 0; j < 16; j++)
+            key[i][j] = (unsigned char)(i * 13 + j);
+        for (j = 0; j < sizeof(in[i]); j++)
+            in[i][j] = (unsigned char)(i * 7 + j * 5);
+        jobs[i].key = key[i];
+        jobs[i].count = 0x1000 + i;
+        jobs[i].bearer = i & 0x1f;
+        jobs[i].direction = i & 1;
+        jobs[i].in = in[i];
+        jobs[i].nbits = (i * 127) % (8 * sizeof(in[i]));
+        jobs[i].out = out[i];
+    }
+
+    ZUC_eea3_encrypt_mb(jobs, 19);
+    ZUC_eia3_generate_mac_mb(jobs, 19);
+
+    for (i = 0; i < 19; i++) {
+        len = (jobs[i].nbits + 7) / 8;
+        ZUC_eea3_encrypt(key[i], jobs[i].count, jobs[i].bearer,
+                         jobs[i].direction, in[i], jobs[i].nbits, ref);
+        if (memcmp(out[i], ref, len) != 0) {
+            printf("error in 128-EEA3 batch job %d\n", (int)i);
+            return 1;
+        }
+        if (jobs[i].mac != ZUC_eia3_generate_mac(key[i], jobs[i].count,
+                                                 jobs[i].bearer,
+                                                 jobs[i].direction, in[i],
+                                                 jobs[i].nbits)) {
+            printf("error in 128-EIA3 batch job %d\n", (int)i);
+            return 1;
+        }
+    }
+    printf("128-EEA3/EIA3 batch test ok\n");
+    return 0;
+}
+
+/* ZUC-256 keystream and MAC test vectors */
+static struct {
+    unsigned char k, iv;
+    uint32_t z[8];
+} zuc256_test[] = {
+    {0x00, 0x00, {0x58d03ad6, 0x2e032ce2, 0xdafc683a, 0x39bdcb03,
+                  0x52a2bc67, 0xf1b7de74, 0x163ce3a1, 0x01ef5558}},
+    {0xff, 0xff, {0x3356cbae, 0xd1a1c18b, 0x6baa4ffe, 0x343f777c,
+                  0x9e15128f, 0x251ab65b, 0x949f7b26, 0xef7157f2}},
+};
+
+static struct {
+    unsigned char k, iv, m;
+    size_t nbits;
+    const char *mac[3];
+} zuc256_mac_test[] = {
+    {0x00, 0x00, 0x00, 400, {"9b972a74", "673e54990034d38c",
+                             "d85e54bbcb9600967084c952a1654b26"}},
+    {0x00, 0x00, 0x11, 4000, {"8754f5cf", "130dc225e72240cc",
+                              "df1e8307b31cc62beca1ac6f8190c22f"}},
+    {0xff, 0xff, 0x00, 400, {"1f3079b4", "8c71394d39957725",
+                             "a35bb274b567c48b28319f111af34fbd"}},
+    {0xff, 0xff, 0x11, 4000, {"5c7c8b88", "ea1dee544bb6223b",
+                              "3a83b554be408ca5494124ed9d473205"}},
+};
+
+static int test_zuc256(void)
+{
+    ZUC_KEY key;
+    EVP_CIPHER_CTX ctx;
+    unsigned char k[32], iv[ZUC256_IV_LENGTH], m[500], mac[16], buf[16];
+    uint32_t z[8];
+    size_t i, j;
+    int macbits, ivlen;
+
+    for (i = 0; i < sizeof(zuc256_test) / sizeof(zuc256_test[0]); i++) {
+        memset(k, zuc256_test[i].k, sizeof(k));
+        memset(iv, zuc256_test[i].iv, sizeof(iv));
+        ZUC256_set_key(&key, k, iv);
+        ZUC_generate_keystream(&key, 8, z);
+        if (memcmp(z, zuc256_test[i].z, sizeof(z)) != 0) {
+            printf("error in ZUC-256 keystream test %d\n", (int)i);
+            return 1;
+        }
+    }
+
+    for (i = 0; i < sizeof(zuc256_mac_test) / sizeof(zuc256_mac_test[0]);
+         i++) {
+        memset(k, zuc256_mac_test[i].k, sizeof(k));
+        memset(iv, zuc256_mac_test[i].iv, sizeof(iv));
+        memset(m, zuc256_mac_test[i].m, sizeof(m));
+        for (j = 0; j < 3; j++) {
+            macbits = 32 << j;
+            hex2bin(zuc256_mac_test[i].mac[j], buf);
+            if (!ZUC256_generate_mac(k, iv, m, zuc256_mac_test[i].nbits,
+                                     macbits, mac)
+                || memcmp(mac, buf, macbits / 8) != 0) {
+                printf("error in ZUC-256 MAC%d test %d\n", macbits, (int)i);
+                return 1;
+            }
+        }
+    }
+
+    /* bits beyond nbits are ignored */
+    for (i = 0; i < 20; i++) {
+        k[i] = (unsigned char)(i + 0x10);
+        m[i] = (unsigned char)(i * 13 + 5);
+    }
+    for (; i < 32; i++)
+        k[i] = (unsigned char)(i + 0x10);
+    for (i = 0; i < 17; i++)
+        iv[i] = (unsigned char)(i + 0x80);
+    memcpy(iv + 17, "\x12\x34\x56\x78\x9a\xbc", 6);
+    hex2bin("e5f8a8dd85de4fd6a9abc17e27ac6ea5", buf);
+    if (!ZUC256_generate_mac(k, iv, m, 157, 128, mac)
+        || memcmp(mac, buf, 16) != 0) {
+        printf("error in ZUC-256 MAC partial byte test\n");
+        return 1;
+    }
+    if (ZUC256_generate_mac(k, iv, m, 8, 48, mac)) {
+        printf("error in ZUC-256 MAC, bad length accepted\n");
+        return 1;
+    }
+
+    /* the EVP iv is refused until its length is set */
+    EVP_CIPHER_CTX_init(&ctx);
+    ERR_clear_error();
+    if (EVP_EncryptInit_ex(&ctx, EVP_zuc256(), NULL, k, iv)
+        || ERR_GET_REASON(ERR_peek_last_error())
+           != EVP_R_ZUC256_IV_LENGTH_NOT_SET
+        || !EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_ZUC256_GET_IVLEN, 0, &ivlen)
+        || ivlen != ZUC256_IV_LENGTH
+        || EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_ZUC256_SET_IVLEN, 16, NULL) > 0
+        || !EVP_CIPHER_CTX_ctrl(&ctx, EVP_CTRL_ZUC256_SET_IVLEN,
+                                ZUC256_IV_LENGTH, NULL)
+        || !EVP_EncryptInit_ex(&ctx, NULL, NULL, k, iv)) {
+        printf("error in ZUC-256 EVP iv length test\n");
+        EVP_CIPHER_CTX_cleanup(&ctx);
+        return 1;
+    }
+    ERR_clear_error();
+    EVP_CIPHER_CTX_cleanup(&ctx);
+
+    printf("ZUC-256 test ok\n");
+    return 0;
+}
+
+/*
+ * EVP_CIPHER_CTX_batch_update() of zuc-256 and zuc-128-eea3 contexts, each
+ * one part way into its keystream buffer, against EVP_CipherUpdate()
+ */
+static int test_zuc_batch(void)
+{
+    static unsigned char in[21][320], out[21][320], ref[21][320];
+    EVP_CIPHER_CTX ctx[21], *pctx[21];
+    const unsigned char *pin[21];
+    unsigned char *pout[21];
+    unsigned char k[32], iv[ZUC256_IV_LENGTH];
+    int inl[21], outl[21], len, i, j, ret = 1;
+
+    for (i = 0; i < 21; i++) {
+        EVP_CIPHER_CTX_init(&ctx[i]);
+        pctx[i] = &ctx[i];
+    }
+    for (i = 0; i < 21; i++) {
+        const EVP_CIPHER *cipher = i % 3 ? EVP_zuc256() : EVP_zuc_eea3();
+
+        for (j = 0; j < 32; j++)
+            k[j] = (unsigned char)(i * 5 + j);
+        for (j = 0; j < ZUC256_IV_LENGTH; j++)
+            iv[j] = (unsigned char)(i + j * 3);
+        for (j = 0; j < 320; j++)
+            in[i][j] = (unsigned char)(i * 11 + j);
+        inl[i] = 150 + i * 7;
+
+        /* ref: i bytes, then the rest, the batch repeats the second call */
+        /* the 23 byte ZUC-256 iv length is set by ctrl */
+        if (!EVP_EncryptInit_ex(&ctx[i], cipher, NULL, NULL, NULL)
+            || (cipher == EVP_zuc256()
+                && !EVP_CIPHER_CTX_ctrl(&ctx[i], EVP_CTRL_ZUC256_SET_IVLEN,
+                                        ZUC256_IV_LENGTH, NULL))
+            || !EVP_EncryptInit_ex(&ctx[i], NULL, NULL, k, iv)
+            || !EVP_EncryptUpdate(&ctx[i], ref[i], &len, in[i], i)
+            || !EVP_EncryptUpdate(&ctx[i], ref[i] + i, &len, in[i] + i,
+                                  inl[i])
+            || !EVP_EncryptInit_ex(&ctx[i], NULL, NULL, k, iv)
+            || !EVP_EncryptUpdate(&ctx[i], out[i], &len, in[i], i))
+            goto end;
+        pin[i] = in[i] + i;
+        pout[i] = out[i] + i;
+    }
+
+    if (!EVP_CIPHER_CTX_batch_update(pctx, pout, outl, pin, inl, 21))
+        goto end;
+    for (i = 0; i < 21; i++) {
+        if (outl[i] != inl[i] || memcmp(out[i], ref[i], i + inl[i]) != 0) {
+            printf("error in ZUC batch update %d\n", i);
+            goto end;
+        }
+    }
+
+    printf("ZUC batch update test ok\n");
+    ret = 0;
+ end:
+    for (i = 0; i < 21; i++)
+        EVP_CIPHER_CTX_cleanup(&ctx[i]);
+    return ret;
+}
+
+int main(int argc, char *argv[])
+{
+    int err = 0;
+
+    err += test_zuc_vectors();
+    err += test_zuc_stream();
+    err += test_zuc_mb();
+    err += test_zuc_3gpp();
+    err += test_zuc_3gpp_mb();
+    err += test_zuc256();
+    err += test_zuc_batch();
+
+# ifdef OPENSSL_SYS_NETWARE
+    if (err)
+        printf("ERROR: %d\n", err);
+# endif
+    EXIT(err);
+    return (0);
+}
+#endif
@@ -0,0 +1 @@
+../crypto/sms4/sms4test.c
\ No newline at end of file
@@ -0,0 +1 @@
+../crypto/zuc/zuctest.c
\ No newline at end of file